@@ -0,0 +1,356 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include "binaryninjaapi.h"
+
+#ifdef BN_API_PROFILE
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+using namespace BinaryNinja;
+using namespace std;
+
+namespace
+{
+	struct EntryCounters
+	{
+		atomic<uint64_t> calls {0};
+		atomic<uint64_t> nanoseconds {0};
+		atomic<uint64_t> histogram[ApiProfile::HistogramBuckets] = {};
+	};
+
+	// Only the owning thread writes to its counters, so plain loads and stores are enough and no atomic
+	// read-modify-write is needed. Readers may see slightly stale values.
+	struct ThreadCounters
+	{
+		atomic<EntryCounters*> entries[ApiProfile::EntryCount] = {};
+		atomic<uint64_t> allocations[ApiProfile::MaxClasses] = {};
+
+		~ThreadCounters()
+		{
+			for (auto& entry : entries)
+				delete entry.load();
+		}
+	};
+
+	struct Profile
+	{
+		mutex lock;
+		vector<unique_ptr<ThreadCounters>> threads;
+		// Counts of threads that have exited, so that work done by short lived threads is still reported
+		vector<ApiProfileEntry> retiredEntries;
+		vector<uint64_t> retiredAllocations;
+		vector<string> classNames;
+		vector<ApiProfileEntry> baseline;
+		vector<ApiProfileAllocation> allocationBaseline;
+	};
+
+	Profile& GetProfile()
+	{
+		static Profile* profile = new Profile;
+		return *profile;
+	}
+
+	void InitEntries(vector<ApiProfileEntry>& entries)
+	{
+		entries.resize(ApiProfile::EntryCount);
+		for (size_t i = 0; i < ApiProfile::EntryCount; i++)
+		{
+			entries[i].name = ApiProfile::EntryNames[i];
+			entries[i].calls = 0;
+			entries[i].totalNanoseconds = 0;
+			entries[i].histogram.assign(ApiProfile::HistogramBuckets, 0);
+		}
+	}
+
+	void AddThreadCounters(
+	    const ThreadCounters& thread, vector<ApiProfileEntry>& entries, vector<uint64_t>& allocations)
+	{
+		for (size_t i = 0; i < ApiProfile::EntryCount; i++)
+		{
+			EntryCounters* counters = thread.entries[i].load(memory_order_acquire);
+			if (!counters)
+				continue;
+			entries[i].calls += counters->calls.load(memory_order_relaxed);
+			entries[i].totalNanoseconds += counters->nanoseconds.load(memory_order_relaxed);
+			for (size_t j = 0; j < ApiProfile::HistogramBuckets; j++)
+				entries[i].histogram[j] += counters->histogram[j].load(memory_order_relaxed);
+		}
+		for (size_t i = 0; i < allocations.size(); i++)
+			allocations[i] += thread.allocations[i].load(memory_order_relaxed);
+	}
+
+	thread_local ThreadCounters* t_counters = nullptr;
+	thread_local bool t_retired = false;
+
+	// Folds the counts of a thread into the retired totals and frees its counters when the thread exits, so that
+	// the threads started by each ParallelFor call don't keep their counters for the life of the process
+	void RetireThreadCounters()
+	{
+		Profile& profile = GetProfile();
+		lock_guard<mutex> lock(profile.lock);
+		auto i = find_if(profile.threads.begin(), profile.threads.end(),
+		    [](const unique_ptr<ThreadCounters>& thread) { return thread.get() == t_counters; });
+		if (i != profile.threads.end())
+		{
+			if (profile.retiredEntries.empty())
+			{
+				InitEntries(profile.retiredEntries);
+				profile.retiredAllocations.assign(ApiProfile::MaxClasses, 0);
+			}
+			AddThreadCounters(**i, profile.retiredEntries, profile.retiredAllocations);
+			profile.threads.erase(i);
+		}
+		t_counters = nullptr;
+		t_retired = true;
+	}
+
+	struct ThreadRetirement
+	{
+		~ThreadRetirement() { RetireThreadCounters(); }
+	};
+
+	// Returns nullptr for calls made while the thread is exiting, after its counters have been retired
+	ThreadCounters* GetThreadCounters()
+	{
+		if (!t_counters)
+		{
+			if (t_retired)
+				return nullptr;
+			thread_local ThreadRetirement retirement;
+			auto owned = make_unique<ThreadCounters>();
+			t_counters = owned.get();
+			Profile& profile = GetProfile();
+			lock_guard<mutex> lock(profile.lock);
+			profile.threads.push_back(std::move(owned));
+		}
+		return t_counters;
+	}
+
+	void Increment(atomic<uint64_t>& value, uint64_t amount)
+	{
+		value.store(value.load(memory_order_relaxed) + amount, memory_order_relaxed);
+	}
+
+	size_t GetHistogramBucket(uint64_t nanoseconds)
+	{
+		size_t bucket = 0;
+		while ((nanoseconds != 0) && (bucket < (ApiProfile::HistogramBuckets - 1)))
+		{
+			nanoseconds >>= 1;
+			bucket++;
+		}
+		return bucket;
+	}
+
+	string ExtractClassName(const char* signature)
+	{
+		string str = signature;
+		size_t start, end;
+		if ((start = str.find("T = ")) != string::npos)
+		{
+			// GCC and Clang: "... GetClassSignature() [with T = BNFunction]"
+			start += 4;
+			end = str.find_first_of(";]", start);
+		}
+		else if ((start = str.find("GetClassSignature<")) != string::npos)
+		{
+			// MSVC: "... GetClassSignature<struct BNFunction>(void)"
+			start += strlen("GetClassSignature<");
+			end = str.rfind(">(");
+			if (str.compare(start, 7, "struct ") == 0)
+				start += 7;
+			else if (str.compare(start, 6, "class ") == 0)
+				start += 6;
+		}
+		else
+		{
+			return str;
+		}
+		if ((end == string::npos) || (end < start))
+			return str.substr(start);
+		return str.substr(start, end - start);
+	}
+
+	void CollectTotals(vector<ApiProfileEntry>& entries, vector<ApiProfileAllocation>& allocations)
+	{
+		Profile& profile = GetProfile();
+		if (profile.retiredEntries.empty())
+			InitEntries(entries);
+		else
+			entries = profile.retiredEntries;
+		vector<uint64_t> counts(profile.classNames.size(), 0);
+		for (size_t i = 0; i < profile.retiredAllocations.size() && i < counts.size(); i++)
+			counts[i] = profile.retiredAllocations[i];
+
+		for (auto& thread : profile.threads)
+			AddThreadCounters(*thread, entries, counts);
+
+		allocations.resize(profile.classNames.size());
+		for (size_t i = 0; i < profile.classNames.size(); i++)
+		{
+			allocations[i].className = profile.classNames[i];
+			allocations[i].count = counts[i];
+		}
+
+		for (size_t i = 0; i < profile.baseline.size(); i++)
+		{
+			entries[i].calls -= profile.baseline[i].calls;
+			entries[i].totalNanoseconds -= profile.baseline[i].totalNanoseconds;
+			for (size_t j = 0; j < ApiProfile::HistogramBuckets; j++)
+				entries[i].histogram[j] -= profile.baseline[i].histogram[j];
+		}
+		for (size_t i = 0; i < profile.allocationBaseline.size(); i++)
+			allocations[i].count -= profile.allocationBaseline[i].count;
+	}
+
+	uint64_t GetPercentile(const ApiProfileEntry& entry, double percentile)
+	{
+		uint64_t target = (uint64_t)((double)entry.calls * percentile);
+		uint64_t seen = 0;
+		for (size_t i = 0; i < entry.histogram.size(); i++)
+		{
+			seen += entry.histogram[i];
+			if (seen > target)
+				return (uint64_t)1 << i;
+		}
+		return (uint64_t)1 << (entry.histogram.size() - 1);
+	}
+}  // namespace
+
+
+void ApiProfile::Record(size_t entry, uint64_t nanoseconds)
+{
+	ThreadCounters* thread = GetThreadCounters();
+	if (!thread)
+		return;
+	EntryCounters* counters = thread->entries[entry].load(memory_order_relaxed);
+	if (!counters)
+	{
+		counters = new EntryCounters;
+		thread->entries[entry].store(counters, memory_order_release);
+	}
+	Increment(counters->calls, 1);
+	Increment(counters->nanoseconds, nanoseconds);
+	Increment(counters->histogram[GetHistogramBucket(nanoseconds)], 1);
+}
+
+
+size_t ApiProfile::RegisterClass(const char* signature)
+{
+	Profile& profile = GetProfile();
+	lock_guard<mutex> lock(profile.lock);
+	string name = ExtractClassName(signature);
+	auto i = find(profile.classNames.begin(), profile.classNames.end(), name);
+	if (i != profile.classNames.end())
+		return (size_t)(i - profile.classNames.begin());
+	if (profile.classNames.size() >= MaxClasses)
+		return MaxClasses;
+	profile.classNames.push_back(name);
+	return profile.classNames.size() - 1;
+}
+
+
+void ApiProfile::RecordAllocation(size_t classId)
+{
+	if (classId >= MaxClasses)
+		return;
+	ThreadCounters* thread = GetThreadCounters();
+	if (!thread)
+		return;
+	Increment(thread->allocations[classId], 1);
+}
+
+
+vector<ApiProfileEntry> BinaryNinja::GetApiProfile()
+{
+	vector<ApiProfileEntry> entries;
+	vector<ApiProfileAllocation> allocations;
+	{
+		lock_guard<mutex> lock(GetProfile().lock);
+		CollectTotals(entries, allocations);
+	}
+	entries.erase(remove_if(entries.begin(), entries.end(), [](const ApiProfileEntry& e) { return e.calls == 0; }),
+	    entries.end());
+	return entries;
+}
+
+
+vector<ApiProfileAllocation> BinaryNinja::GetApiProfileAllocations()
+{
+	vector<ApiProfileEntry> entries;
+	vector<ApiProfileAllocation> allocations;
+	{
+		lock_guard<mutex> lock(GetProfile().lock);
+		CollectTotals(entries, allocations);
+	}
+	allocations.erase(remove_if(allocations.begin(), allocations.end(),
+	    [](const ApiProfileAllocation& a) { return a.count == 0; }), allocations.end());
+	return allocations;
+}
+
+
+string BinaryNinja::DumpApiProfile(size_t maxEntries)
+{
+	vector<ApiProfileEntry> entries = GetApiProfile();
+	vector<ApiProfileAllocation> allocations = GetApiProfileAllocations();
+	sort(entries.begin(), entries.end(), [](const ApiProfileEntry& a, const ApiProfileEntry& b) {
+		return a.totalNanoseconds > b.totalNanoseconds;
+	});
+	sort(allocations.begin(), allocations.end(), [](const ApiProfileAllocation& a, const ApiProfileAllocation& b) {
+		return a.count > b.count;
+	});
+	if ((maxEntries != 0) && (entries.size() > maxEntries))
+		entries.resize(maxEntries);
+
+	string result;
+	auto out = back_inserter(result);
+	fmt::format_to(out, "{:<56} {:>12} {:>12} {:>10} {:>10} {:>10}\n", "API", "Calls", "Total (ms)", "Mean (ns)",
+	    "p50 (ns)", "p99 (ns)");
+	for (auto& entry : entries)
+	{
+		fmt::format_to(out, "{:<56} {:>12} {:>12.3f} {:>10} {:>10} {:>10}\n", entry.name, entry.calls,
+		    (double)entry.totalNanoseconds / 1000000.0, entry.totalNanoseconds / entry.calls,
+		    GetPercentile(entry, 0.5), GetPercentile(entry, 0.99));
+	}
+
+	fmt::format_to(out, "\n{:<56} {:>12}\n", "Wrapper class", "Allocations");
+	for (auto& allocation : allocations)
+		fmt::format_to(out, "{:<56} {:>12}\n", allocation.className, allocation.count);
+	return result;
+}
+
+
+void BinaryNinja::ResetApiProfile()
+{
+	Profile& profile = GetProfile();
+	lock_guard<mutex> lock(profile.lock);
+	profile.baseline.clear();
+	profile.allocationBaseline.clear();
+
+	vector<ApiProfileEntry> entries;
+	vector<ApiProfileAllocation> allocations;
+	CollectTotals(entries, allocations);
+	profile.baseline = std::move(entries);
+	profile.allocationBaseline = std::move(allocations);
+}
+#endif
@@ -0,0 +1,170 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// When BN_API_PROFILE is defined, every call the API makes into the core is routed through
+// BinaryNinja::ApiProfile::Instrument, which counts and times it. Counters are kept per thread and updated without
+// locks. Without BN_API_PROFILE none of this is compiled in.
+
+namespace BinaryNinja
+{
+	/*!
+		\ingroup coreapi
+	*/
+	struct ApiProfileEntry
+	{
+		std::string name;
+		uint64_t calls;
+		uint64_t totalNanoseconds;
+		/*! histogram[i] counts calls that took less than 2^i nanoseconds (and at least 2^(i-1)) */
+		std::vector<uint64_t> histogram;
+	};
+
+	/*!
+		\ingroup coreapi
+	*/
+	struct ApiProfileAllocation
+	{
+		std::string className;
+		uint64_t count;
+	};
+
+#ifdef BN_API_PROFILE
+	/*! Get the counters collected for every core API entry point that has been called at least once since the last
+		ResetApiProfile, summed over all threads
+
+		@threadsafe
+		\ingroup coreapi
+	*/
+	std::vector<ApiProfileEntry> GetApiProfile();
+
+	/*! Get the number of wrapper objects created for each core object type since the last ResetApiProfile
+
+		@threadsafe
+		\ingroup coreapi
+	*/
+	std::vector<ApiProfileAllocation> GetApiProfileAllocations();
+
+	/*! Format the collected counters as a text report, sorted by total time spent in each entry point
+
+		@threadsafe
+		\ingroup coreapi
+
+		\param maxEntries Maximum number of entry points to list, or 0 for all of them
+	*/
+	std::string DumpApiProfile(size_t maxEntries = 50);
+
+	/*! Start collecting counters from zero
+
+		@threadsafe
+		\ingroup coreapi
+	*/
+	void ResetApiProfile();
+#else
+	inline std::vector<ApiProfileEntry> GetApiProfile() { return {}; }
+	inline std::vector<ApiProfileAllocation> GetApiProfileAllocations() { return {}; }
+	inline std::string DumpApiProfile(size_t = 50) { return ""; }
+	inline void ResetApiProfile() {}
+#endif
+}  // namespace BinaryNinja
+
+#ifdef BN_API_PROFILE
+#include <atomic>
+#include <chrono>
+
+namespace BinaryNinja
+{
+	namespace ApiProfile
+	{
+		constexpr size_t HistogramBuckets = 40;
+		constexpr size_t MaxClasses = 256;
+
+		void Record(size_t entry, uint64_t nanoseconds);
+		size_t RegisterClass(const char* signature);
+		void RecordAllocation(size_t classId);
+
+		// The signature of this function contains the name of T, which RegisterClass extracts. This avoids typeid,
+		// which can't be used on the opaque core types.
+		template <class T>
+		const char* GetClassSignature()
+		{
+#ifdef _MSC_VER
+			return __FUNCSIG__;
+#else
+			return __PRETTY_FUNCTION__;
+#endif
+		}
+
+		template <class T>
+		size_t GetClassId()
+		{
+			static size_t id = RegisterClass(GetClassSignature<T>());
+			return id;
+		}
+
+		class CallTimer
+		{
+			size_t m_entry;
+			std::chrono::steady_clock::time_point m_start;
+
+		  public:
+			explicit CallTimer(size_t entry) : m_entry(entry), m_start(std::chrono::steady_clock::now()) {}
+			~CallTimer()
+			{
+				auto elapsed = std::chrono::steady_clock::now() - m_start;
+				Record(m_entry, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+			}
+		};
+
+		// Binding the function first and taking the arguments in a second call means they are converted to the
+		// real parameter types, exactly as in a direct call
+		template <size_t Entry, class R, class... Params>
+		struct InstrumentedCall
+		{
+			R (*func)(Params...);
+
+			R operator()(Params... params) const
+			{
+				CallTimer timer(Entry);
+				return func(params...);
+			}
+		};
+
+		template <size_t Entry, class R, class... Params>
+		InstrumentedCall<Entry, R, Params...> Instrument(R (*func)(Params...))
+		{
+			return InstrumentedCall<Entry, R, Params...> {func};
+		}
+	}  // namespace ApiProfile
+}  // namespace BinaryNinja
+
+#include "apiprofileshim.h"
+
+#define BN_API_PROFILE_ALLOCATION(T) \
+	::BinaryNinja::ApiProfile::RecordAllocation(::BinaryNinja::ApiProfile::GetClassId<T>())
+#else
+#define BN_API_PROFILE_ALLOCATION(T)
+#endif
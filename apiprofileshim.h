@@ -0,0 +1,4810 @@
+// Generated by scripts/generate_api_profile.py from binaryninjacore.h, do not edit.
+// Only included by apiprofile.h when BN_API_PROFILE is defined.
+#pragma once
+
+namespace BinaryNinja
+{
+	namespace ApiProfile
+	{
+		constexpr size_t EntryCount = 2398;
+		inline const char* const EntryNames[EntryCount] = {
+			"BNAllocString",
+			"BNFreeString",
+			"BNAllocStringList",
+			"BNFreeStringList",
+			"BNShutdown",
+			"BNIsShutdownRequested",
+			"BNGetVersionInfo",
+			"BNGetVersionString",
+			"BNGetBuildId",
+			"BNGetCurrentCoreABIVersion",
+			"BNGetMinimumCoreABIVersion",
+			"BNGetSerialNumber",
+			"BNGetLicenseExpirationTime",
+			"BNIsLicenseValidated",
+			"BNGetLicensedUserEmail",
+			"BNGetProduct",
+			"BNGetProductType",
+			"BNGetLicenseCount",
+			"BNIsUIEnabled",
+			"BNSetLicense",
+			"BNAuthenticateEnterpriseServerWithCredentials",
+			"BNAuthenticateEnterpriseServerWithMethod",
+			"BNGetEnterpriseServerAuthenticationMethods",
+			"BNDeauthenticateEnterpriseServer",
+			"BNCancelEnterpriseServerAuthentication",
+			"BNConnectEnterpriseServer",
+			"BNUpdateEnterpriseServerLicense",
+			"BNReleaseEnterpriseServerLicense",
+			"BNIsEnterpriseServerConnected",
+			"BNIsEnterpriseServerAuthenticated",
+			"BNGetEnterpriseServerUsername",
+			"BNGetEnterpriseServerToken",
+			"BNGetEnterpriseServerUrl",
+			"BNSetEnterpriseServerUrl",
+			"BNGetEnterpriseServerName",
+			"BNGetEnterpriseServerId",
+			"BNGetEnterpriseServerVersion",
+			"BNGetEnterpriseServerBuildId",
+			"BNGetEnterpriseServerLicenseExpirationTime",
+			"BNGetEnterpriseServerLicenseDuration",
+			"BNIsEnterpriseServerFloatingLicense",
+			"BNGetEnterpriseServerReservationTimeLimit",
+			"BNIsEnterpriseServerLicenseStillActivated",
+			"BNGetEnterpriseServerLastError",
+			"BNRegisterEnterpriseServerNotification",
+			"BNUnregisterEnterpriseServerNotification",
+			"BNIsEnterpriseServerInitialized",
+			"BNRegisterObjectDestructionCallbacks",
+			"BNUnregisterObjectDestructionCallbacks",
+			"BNGetUniqueIdentifierString",
+			"BNInitPlugins",
+			"BNInitCorePlugins",
+			"BNDisablePlugins",
+			"BNIsPluginsEnabled",
+			"BNInitUserPlugins",
+			"BNInitRepoPlugins",
+			"BNGetInstallDirectory",
+			"BNGetBundledPluginDirectory",
+			"BNSetBundledPluginDirectory",
+			"BNGetUserDirectory",
+			"BNGetUserPluginDirectory",
+			"BNGetRepositoriesDirectory",
+			"BNGetSettingsFileName",
+			"BNSaveLastRun",
+			"BNGetPathRelativeToBundledPluginDirectory",
+			"BNGetPathRelativeToUserPluginDirectory",
+			"BNGetPathRelativeToUserDirectory",
+			"BNExecuteWorkerProcess",
+			"BNSetCurrentPluginLoadOrder",
+			"BNAddRequiredPluginDependency",
+			"BNAddOptionalPluginDependency",
+			"BNLogString",
+			"BNNewLoggerReference",
+			"BNFreeLogger",
+			"BNLoggerLogString",
+			"BNLoggerGetName",
+			"BNLoggerGetSessionId",
+			"BNLogCreateLogger",
+			"BNLogGetLogger",
+			"BNLogGetLoggerNames",
+			"BNLogRegisterLoggerCallback",
+			"BNRegisterLogListener",
+			"BNUnregisterLogListener",
+			"BNUpdateLogListeners",
+			"BNLogToStdout",
+			"BNLogToStderr",
+			"BNLogToFile",
+			"BNCloseLogs",
+			"BNCreateTemporaryFile",
+			"BNCreateTemporaryFileWithContents",
+			"BNNewTemporaryFileReference",
+			"BNFreeTemporaryFile",
+			"BNGetTemporaryFilePath",
+			"BNGetTemporaryFileContents",
+			"BNCreateDataBuffer",
+			"BNDuplicateDataBuffer",
+			"BNFreeDataBuffer",
+			"BNGetDataBufferContents",
+			"BNGetDataBufferContentsAt",
+			"BNGetDataBufferLength",
+			"BNGetDataBufferSlice",
+			"BNSetDataBufferLength",
+			"BNClearDataBuffer",
+			"BNSetDataBufferContents",
+			"BNAssignDataBuffer",
+			"BNAppendDataBuffer",
+			"BNAppendDataBufferContents",
+			"BNGetDataBufferByte",
+			"BNSetDataBufferByte",
+			"BNDataBufferToEscapedString",
+			"BNDecodeEscapedString",
+			"BNDataBufferToBase64",
+			"BNDecodeBase64",
+			"BNZlibCompress",
+			"BNZlibDecompress",
+			"BNCreateSaveSettings",
+			"BNNewSaveSettingsReference",
+			"BNFreeSaveSettings",
+			"BNIsSaveSettingsOptionSet",
+			"BNSetSaveSettingsOption",
+			"BNGetSaveSettingsName",
+			"BNSetSaveSettingsName",
+			"BNCreateFileMetadata",
+			"BNNewFileReference",
+			"BNFreeFileMetadata",
+			"BNCloseFile",
+			"BNSetFileMetadataNavigationHandler",
+			"BNIsFileModified",
+			"BNIsAnalysisChanged",
+			"BNMarkFileModified",
+			"BNMarkFileSaved",
+			"BNIsBackedByDatabase",
+			"BNCreateDatabase",
+			"BNCreateDatabaseWithProgress",
+			"BNOpenExistingDatabase",
+			"BNOpenExistingDatabaseWithProgress",
+			"BNOpenDatabaseForConfiguration",
+			"BNSaveAutoSnapshot",
+			"BNSaveAutoSnapshotWithProgress",
+			"BNGetSnapshotData",
+			"BNApplySnapshotData",
+			"BNGetFileMetadataDatabase",
+			"BNCreateKeyValueStore",
+			"BNCreateKeyValueStoreFromDataBuffer",
+			"BNNewKeyValueStoreReference",
+			"BNFreeKeyValueStore",
+			"BNGetKeyValueStoreKeys",
+			"BNKeyValueStoreHasValue",
+			"BNGetKeyValueStoreValue",
+			"BNGetKeyValueStoreValueHash",
+			"BNGetKeyValueStoreBuffer",
+			"BNSetKeyValueStoreValue",
+			"BNSetKeyValueStoreBuffer",
+			"BNGetKeyValueStoreSerializedData",
+			"BNBeginKeyValueStoreNamespace",
+			"BNEndKeyValueStoreNamespace",
+			"BNIsKeyValueStoreEmpty",
+			"BNGetKeyValueStoreValueSize",
+			"BNGetKeyValueStoreDataSize",
+			"BNGetKeyValueStoreValueStorageSize",
+			"BNGetKeyValueStoreNamespaceSize",
+			"BNNewDatabaseReference",
+			"BNFreeDatabase",
+			"BNSetDatabaseCurrentSnapshot",
+			"BNGetDatabaseCurrentSnapshot",
+			"BNGetDatabaseSnapshots",
+			"BNGetDatabaseSnapshot",
+			"BNWriteDatabaseSnapshotData",
+			"BNTrimDatabaseSnapshot",
+			"BNRemoveDatabaseSnapshot",
+			"BNGetDatabaseGlobalKeys",
+			"BNDatabaseHasGlobal",
+			"BNReadDatabaseGlobal",
+			"BNWriteDatabaseGlobal",
+			"BNReadDatabaseGlobalData",
+			"BNWriteDatabaseGlobalData",
+			"BNGetDatabaseFile",
+			"BNReadDatabaseAnalysisCache",
+			"BNWriteDatabaseAnalysisCache",
+			"BNSnapshotHasData",
+			"BNNewSnapshotReference",
+			"BNFreeSnapshot",
+			"BNFreeSnapshotList",
+			"BNGetSnapshotDatabase",
+			"BNGetSnapshotId",
+			"BNGetSnapshotFirstParent",
+			"BNGetSnapshotParents",
+			"BNGetSnapshotChildren",
+			"BNGetSnapshotName",
+			"BNSetSnapshotName",
+			"BNIsSnapshotAutoSave",
+			"BNSnapshotHasContents",
+			"BNSnapshotHasUndo",
+			"BNGetSnapshotFileContents",
+			"BNGetSnapshotFileContentsHash",
+			"BNReadSnapshotData",
+			"BNReadSnapshotDataWithProgress",
+			"BNGetSnapshotUndoData",
+			"BNGetSnapshotUndoEntries",
+			"BNGetSnapshotUndoEntriesWithProgress",
+			"BNSnapshotHasAncestor",
+			"BNSnapshotStoreData",
+			"BNRebase",
+			"BNRebaseWithProgress",
+			"BNCreateSnapshotedView",
+			"BNCreateSnapshotedViewWithProgress",
+			"BNGetOriginalFilename",
+			"BNSetOriginalFilename",
+			"BNGetFilename",
+			"BNSetFilename",
+			"BNBeginUndoActions",
+			"BNCommitUndoActions",
+			"BNRevertUndoActions",
+			"BNCanUndo",
+			"BNUndo",
+			"BNCanRedo",
+			"BNRedo",
+			"BNGetUndoEntries",
+			"BNGetRedoEntries",
+			"BNGetLastUndoEntry",
+			"BNGetLastRedoEntry",
+			"BNGetLastUndoEntryTitle",
+			"BNGetLastRedoEntryTitle",
+			"BNFreeUndoEntries",
+			"BNClearUndoEntries",
+			"BNNewUserReference",
+			"BNFreeUser",
+			"BNGetUsers",
+			"BNFreeUserList",
+			"BNGetUserName",
+			"BNGetUserEmail",
+			"BNGetUserId",
+			"BNOpenProject",
+			"BNCloseProject",
+			"BNIsProjectOpen",
+			"BNGetCurrentView",
+			"BNGetCurrentOffset",
+			"BNNavigate",
+			"BNGetFileViewOfType",
+			"BNGetExistingViews",
+			"BNFileMetadataGetSessionId",
+			"BNIsSnapshotDataAppliedWithoutError",
+			"BNUnregisterViewOfType",
+			"BNNewViewReference",
+			"BNFreeBinaryView",
+			"BNGetFileForView",
+			"BNGetViewType",
+			"BNGetParentView",
+			"BNReadViewData",
+			"BNReadViewBuffer",
+			"BNWriteViewData",
+			"BNWriteViewBuffer",
+			"BNInsertViewData",
+			"BNInsertViewBuffer",
+			"BNRemoveViewData",
+			"BNNotifyDataWritten",
+			"BNNotifyDataInserted",
+			"BNNotifyDataRemoved",
+			"BNGetEntropy",
+			"BNGetModification",
+			"BNGetModificationArray",
+			"BNIsValidOffset",
+			"BNIsOffsetReadable",
+			"BNIsOffsetWritable",
+			"BNIsOffsetExecutable",
+			"BNIsOffsetBackedByFile",
+			"BNIsOffsetCodeSemantics",
+			"BNIsOffsetExternSemantics",
+			"BNIsOffsetWritableSemantics",
+			"BNGetNextValidOffset",
+			"BNGetStartOffset",
+			"BNGetEndOffset",
+			"BNGetViewLength",
+			"BNGetEntryPoint",
+			"BNGetDefaultArchitecture",
+			"BNSetDefaultArchitecture",
+			"BNGetDefaultPlatform",
+			"BNSetDefaultPlatform",
+			"BNGetDefaultEndianness",
+			"BNIsRelocatable",
+			"BNGetViewAddressSize",
+			"BNIsViewModified",
+			"BNIsExecutableView",
+			"BNSaveToFile",
+			"BNSaveToFilename",
+			"BNDefineRelocation",
+			"BNDefineSymbolRelocation",
+			"BNGetRelocationRanges",
+			"BNGetRelocationRangesAtAddress",
+			"BNRangeContainsRelocation",
+			"BNRegisterDataNotification",
+			"BNUnregisterDataNotification",
+			"BNCanAssemble",
+			"BNIsNeverBranchPatchAvailable",
+			"BNIsAlwaysBranchPatchAvailable",
+			"BNIsInvertBranchPatchAvailable",
+			"BNIsSkipAndReturnZeroPatchAvailable",
+			"BNIsSkipAndReturnValuePatchAvailable",
+			"BNConvertToNop",
+			"BNAlwaysBranch",
+			"BNInvertBranch",
+			"BNSkipAndReturnValue",
+			"BNGetInstructionLength",
+			"BNFindNextData",
+			"BNFindNextText",
+			"BNFindNextConstant",
+			"BNFindNextDataWithProgress",
+			"BNFindNextTextWithProgress",
+			"BNFindNextConstantWithProgress",
+			"BNFindAllDataWithProgress",
+			"BNFindAllTextWithProgress",
+			"BNFindAllConstantWithProgress",
+			"BNAddAutoSegment",
+			"BNRemoveAutoSegment",
+			"BNAddUserSegment",
+			"BNRemoveUserSegment",
+			"BNGetSegments",
+			"BNFreeSegmentList",
+			"BNGetSegmentAt",
+			"BNGetAddressForDataOffset",
+			"BNGetComponentByGuid",
+			"BNGetRootComponent",
+			"BNCreateComponent",
+			"BNCreateComponentWithParent",
+			"BNCreateComponentWithName",
+			"BNCreateComponentWithParentAndName",
+			"BNGetComponentByPath",
+			"BNRemoveComponent",
+			"BNRemoveComponentByGuid",
+			"BNAddAutoSection",
+			"BNRemoveAutoSection",
+			"BNAddUserSection",
+			"BNRemoveUserSection",
+			"BNGetSections",
+			"BNGetSectionsAt",
+			"BNFreeSectionList",
+			"BNGetSectionByName",
+			"BNGetUniqueSectionNames",
+			"BNGetNameSpaces",
+			"BNFreeNameSpaceList",
+			"BNGetExternalNameSpace",
+			"BNGetInternalNameSpace",
+			"BNFreeNameSpace",
+			"BNGetAllocatedRanges",
+			"BNFreeAddressRanges",
+			"BNGetGlobalPointerValue",
+			"BNCreateBinaryDataView",
+			"BNCreateBinaryDataViewFromBuffer",
+			"BNCreateBinaryDataViewFromData",
+			"BNCreateBinaryDataViewFromFilename",
+			"BNCreateBinaryDataViewFromFile",
+			"BNCreateCustomBinaryView",
+			"BNGetBinaryViewTypeByName",
+			"BNGetBinaryViewTypes",
+			"BNGetBinaryViewTypesForData",
+			"BNFreeBinaryViewTypeList",
+			"BNGetBinaryViewTypeName",
+			"BNGetBinaryViewTypeLongName",
+			"BNIsBinaryViewTypeDeprecated",
+			"BNCreateBinaryViewOfType",
+			"BNParseBinaryViewOfType",
+			"BNIsBinaryViewTypeValidForData",
+			"BNGetBinaryViewDefaultLoadSettingsForData",
+			"BNGetBinaryViewLoadSettingsForData",
+			"BNRegisterBinaryViewType",
+			"BNRegisterArchitectureForViewType",
+			"BNGetArchitectureForViewType",
+			"BNRegisterPlatformForViewType",
+			"BNGetPlatformForViewType",
+			"BNRegisterDefaultPlatformForViewType",
+			"BNRegisterPlatformRecognizerForViewType",
+			"BNRecognizePlatformForViewType",
+			"BNRegisterBinaryViewEvent",
+			"BNCreateBinaryReader",
+			"BNFreeBinaryReader",
+			"BNGetBinaryReaderEndianness",
+			"BNSetBinaryReaderEndianness",
+			"BNReadData",
+			"BNRead8",
+			"BNRead16",
+			"BNRead32",
+			"BNRead64",
+			"BNReadLE16",
+			"BNReadLE32",
+			"BNReadLE64",
+			"BNReadBE16",
+			"BNReadBE32",
+			"BNReadBE64",
+			"BNGetReaderPosition",
+			"BNSeekBinaryReader",
+			"BNSeekBinaryReaderRelative",
+			"BNGetBinaryReaderVirtualBase",
+			"BNSetBinaryReaderVirtualBase",
+			"BNIsEndOfFile",
+			"BNCreateBinaryWriter",
+			"BNFreeBinaryWriter",
+			"BNGetBinaryWriterEndianness",
+			"BNSetBinaryWriterEndianness",
+			"BNWriteData",
+			"BNWrite8",
+			"BNWrite16",
+			"BNWrite32",
+			"BNWrite64",
+			"BNWriteLE16",
+			"BNWriteLE32",
+			"BNWriteLE64",
+			"BNWriteBE16",
+			"BNWriteBE32",
+			"BNWriteBE64",
+			"BNGetWriterPosition",
+			"BNSeekBinaryWriter",
+			"BNSeekBinaryWriterRelative",
+			"BNGetTransformByName",
+			"BNGetTransformTypeList",
+			"BNFreeTransformTypeList",
+			"BNRegisterTransformType",
+			"BNGetTransformType",
+			"BNGetTransformName",
+			"BNGetTransformLongName",
+			"BNGetTransformGroup",
+			"BNGetTransformParameterList",
+			"BNFreeTransformParameterList",
+			"BNDecode",
+			"BNEncode",
+			"BNGetArchitectureByName",
+			"BNGetArchitectureList",
+			"BNFreeArchitectureList",
+			"BNRegisterArchitecture",
+			"BNRegisterArchitectureExtension",
+			"BNAddArchitectureRedirection",
+			"BNRegisterArchitectureHook",
+			"BNFinalizeArchitectureHook",
+			"BNGetNativeTypeParserArchitecture",
+			"BNGetArchitectureName",
+			"BNGetArchitectureEndianness",
+			"BNGetArchitectureAddressSize",
+			"BNGetArchitectureDefaultIntegerSize",
+			"BNGetArchitectureInstructionAlignment",
+			"BNGetArchitectureMaxInstructionLength",
+			"BNGetArchitectureOpcodeDisplayLength",
+			"BNGetAssociatedArchitectureByAddress",
+			"BNGetInstructionInfo",
+			"BNGetInstructionText",
+			"BNGetInstructionLowLevelIL",
+			"BNFreeInstructionText",
+			"BNFreeInstructionTextLines",
+			"BNGetArchitectureRegisterName",
+			"BNGetArchitectureFlagName",
+			"BNGetArchitectureFlagWriteTypeName",
+			"BNGetArchitectureSemanticFlagClassName",
+			"BNGetArchitectureSemanticFlagGroupName",
+			"BNGetFullWidthArchitectureRegisters",
+			"BNGetAllArchitectureRegisters",
+			"BNGetAllArchitectureFlags",
+			"BNGetAllArchitectureFlagWriteTypes",
+			"BNGetAllArchitectureSemanticFlagClasses",
+			"BNGetAllArchitectureSemanticFlagGroups",
+			"BNGetArchitectureFlagRole",
+			"BNGetArchitectureFlagsRequiredForFlagCondition",
+			"BNGetArchitectureFlagsRequiredForSemanticFlagGroup",
+			"BNGetArchitectureFlagConditionsForSemanticFlagGroup",
+			"BNFreeFlagConditionsForSemanticFlagGroup",
+			"BNGetArchitectureFlagsWrittenByFlagWriteType",
+			"BNGetArchitectureSemanticClassForFlagWriteType",
+			"BNGetArchitectureFlagWriteLowLevelIL",
+			"BNGetDefaultArchitectureFlagWriteLowLevelIL",
+			"BNGetArchitectureFlagConditionLowLevelIL",
+			"BNGetDefaultArchitectureFlagConditionLowLevelIL",
+			"BNGetArchitectureSemanticFlagGroupLowLevelIL",
+			"BNGetModifiedArchitectureRegistersOnWrite",
+			"BNFreeRegisterList",
+			"BNGetArchitectureRegisterInfo",
+			"BNGetArchitectureStackPointerRegister",
+			"BNGetArchitectureLinkRegister",
+			"BNGetArchitectureGlobalRegisters",
+			"BNIsArchitectureGlobalRegister",
+			"BNGetArchitectureSystemRegisters",
+			"BNIsArchitectureSystemRegister",
+			"BNGetArchitectureRegisterByName",
+			"BNGetArchitectureRegisterStackName",
+			"BNGetAllArchitectureRegisterStacks",
+			"BNGetArchitectureRegisterStackInfo",
+			"BNGetArchitectureRegisterStackForRegister",
+			"BNGetArchitectureIntrinsicName",
+			"BNGetAllArchitectureIntrinsics",
+			"BNGetArchitectureIntrinsicInputs",
+			"BNFreeNameAndTypeList",
+			"BNGetArchitectureIntrinsicOutputs",
+			"BNFreeOutputTypeList",
+			"BNCanArchitectureAssemble",
+			"BNAssemble",
+			"BNIsArchitectureNeverBranchPatchAvailable",
+			"BNIsArchitectureAlwaysBranchPatchAvailable",
+			"BNIsArchitectureInvertBranchPatchAvailable",
+			"BNIsArchitectureSkipAndReturnZeroPatchAvailable",
+			"BNIsArchitectureSkipAndReturnValuePatchAvailable",
+			"BNArchitectureConvertToNop",
+			"BNArchitectureAlwaysBranch",
+			"BNArchitectureInvertBranch",
+			"BNArchitectureSkipAndReturnValue",
+			"BNRegisterArchitectureFunctionRecognizer",
+			"BNArchitectureRegisterRelocationHandler",
+			"BNCreateRelocationHandler",
+			"BNArchitectureGetRelocationHandler",
+			"BNNewRelocationHandlerReference",
+			"BNFreeRelocationHandler",
+			"BNRelocationHandlerGetRelocationInfo",
+			"BNRelocationHandlerApplyRelocation",
+			"BNRelocationHandlerDefaultApplyRelocation",
+			"BNRelocationHandlerGetOperandForExternalRelocation",
+			"BNAddAnalysisOption",
+			"BNAddFunctionForAnalysis",
+			"BNAddEntryPointForAnalysis",
+			"BNRemoveAnalysisFunction",
+			"BNCreateUserFunction",
+			"BNRemoveUserFunction",
+			"BNHasInitialAnalysis",
+			"BNSetAnalysisHold",
+			"BNUpdateAnalysisAndWait",
+			"BNUpdateAnalysis",
+			"BNAbortAnalysis",
+			"BNIsFunctionUpdateNeeded",
+			"BNRequestAdvancedFunctionAnalysisData",
+			"BNReleaseAdvancedFunctionAnalysisData",
+			"BNReleaseAdvancedFunctionAnalysisDataMultiple",
+			"BNNewFunctionReference",
+			"BNFreeFunction",
+			"BNGetAnalysisFunctionList",
+			"BNFreeFunctionList",
+			"BNHasFunctions",
+			"BNHasSymbols",
+			"BNHasDataVariables",
+			"BNGetAnalysisFunction",
+			"BNGetRecentAnalysisFunctionForAddress",
+			"BNGetAnalysisFunctionsForAddress",
+			"BNGetAnalysisFunctionsContainingAddress",
+			"BNGetAnalysisEntryPoint",
+			"BNGetGlobalCommentForAddress",
+			"BNGetGlobalCommentedAddresses",
+			"BNSetGlobalCommentForAddress",
+			"BNGetFunctionData",
+			"BNGetFunctionArchitecture",
+			"BNGetFunctionPlatform",
+			"BNGetFunctionStart",
+			"BNGetFunctionSymbol",
+			"BNWasFunctionAutomaticallyDiscovered",
+			"BNFunctionHasUserAnnotations",
+			"BNCanFunctionReturn",
+			"BNIsFunctionPure",
+			"BNSetFunctionAutoType",
+			"BNSetFunctionUserType",
+			"BNFunctionHasUserType",
+			"BNGetFunctionComment",
+			"BNGetCommentForAddress",
+			"BNGetCommentedAddresses",
+			"BNFreeAddressList",
+			"BNSetFunctionComment",
+			"BNSetCommentForAddress",
+			"BNAddUserCodeReference",
+			"BNRemoveUserCodeReference",
+			"BNAddUserTypeReference",
+			"BNRemoveUserTypeReference",
+			"BNAddUserTypeFieldReference",
+			"BNRemoveUserTypeFieldReference",
+			"BNNewBasicBlockReference",
+			"BNFreeBasicBlock",
+			"BNGetFunctionBasicBlockList",
+			"BNFreeBasicBlockList",
+			"BNGetFunctionBasicBlockAtAddress",
+			"BNGetRecentBasicBlockForAddress",
+			"BNGetBasicBlocksForAddress",
+			"BNGetBasicBlocksStartingAtAddress",
+			"BNGetFunctionHighestAddress",
+			"BNGetFunctionLowestAddress",
+			"BNGetFunctionAddressRanges",
+			"BNGetFunctionLowLevelIL",
+			"BNGetFunctionLowLevelILIfAvailable",
+			"BNGetLowLevelILForInstruction",
+			"BNGetLowLevelILInstructionsForAddress",
+			"BNGetLowLevelILExitsForInstruction",
+			"BNFreeILInstructionList",
+			"BNGetFunctionMediumLevelIL",
+			"BNGetFunctionMediumLevelILIfAvailable",
+			"BNGetFunctionMappedMediumLevelIL",
+			"BNGetFunctionMappedMediumLevelILIfAvailable",
+			"BNGetFunctionHighLevelIL",
+			"BNGetFunctionHighLevelILIfAvailable",
+			"BNGetFunctionLanguageRepresentation",
+			"BNGetFunctionLanguageRepresentationIfAvailable",
+			"BNGetConstantData",
+			"BNGetRegisterValueAtInstruction",
+			"BNGetRegisterValueAfterInstruction",
+			"BNGetStackContentsAtInstruction",
+			"BNGetStackContentsAfterInstruction",
+			"BNGetParameterValueAtInstruction",
+			"BNGetParameterValueAtLowLevelILInstruction",
+			"BNFreePossibleValueSet",
+			"BNGetRegistersReadByInstruction",
+			"BNGetRegistersWrittenByInstruction",
+			"BNGetStackVariablesReferencedByInstruction",
+			"BNGetStackVariablesReferencedByInstructionIfAvailable",
+			"BNFreeStackVariableReferenceList",
+			"BNGetConstantsReferencedByInstruction",
+			"BNGetConstantsReferencedByInstructionIfAvailable",
+			"BNFreeConstantReferenceList",
+			"BNGetFunctionLiftedIL",
+			"BNGetFunctionLiftedILIfAvailable",
+			"BNGetLiftedILForInstruction",
+			"BNGetLiftedILInstructionsForAddress",
+			"BNGetLiftedILFlagUsesForDefinition",
+			"BNGetLiftedILFlagDefinitionsForUse",
+			"BNGetFlagsReadByLiftedILInstruction",
+			"BNGetFlagsWrittenByLiftedILInstruction",
+			"BNGetFunctionType",
+			"BNGetFunctionReturnType",
+			"BNGetFunctionReturnRegisters",
+			"BNGetFunctionCallingConvention",
+			"BNGetFunctionParameterVariables",
+			"BNFreeParameterVariables",
+			"BNFunctionHasVariableArguments",
+			"BNGetFunctionStackAdjustment",
+			"BNGetFunctionRegisterStackAdjustments",
+			"BNFreeRegisterStackAdjustments",
+			"BNGetFunctionClobberedRegisters",
+			"BNFreeRegisterSet",
+			"BNSetAutoFunctionReturnType",
+			"BNSetAutoFunctionReturnRegisters",
+			"BNSetAutoFunctionCallingConvention",
+			"BNSetAutoFunctionParameterVariables",
+			"BNSetAutoFunctionHasVariableArguments",
+			"BNSetAutoFunctionCanReturn",
+			"BNSetAutoFunctionPure",
+			"BNSetAutoFunctionStackAdjustment",
+			"BNSetAutoFunctionRegisterStackAdjustments",
+			"BNSetAutoFunctionClobberedRegisters",
+			"BNSetUserFunctionReturnType",
+			"BNSetUserFunctionReturnRegisters",
+			"BNSetUserFunctionCallingConvention",
+			"BNSetUserFunctionParameterVariables",
+			"BNSetUserFunctionHasVariableArguments",
+			"BNSetUserFunctionCanReturn",
+			"BNSetUserFunctionPure",
+			"BNSetUserFunctionStackAdjustment",
+			"BNSetUserFunctionRegisterStackAdjustments",
+			"BNSetUserFunctionClobberedRegisters",
+			"BNApplyImportedTypes",
+			"BNApplyAutoDiscoveredFunctionType",
+			"BNFunctionHasExplicitlyDefinedType",
+			"BNGetFunctionTypeTokens",
+			"BNGetFunctionGlobalPointerValue",
+			"BNGetFunctionRegisterValueAtExit",
+			"BNIsFunctionInlinedDuringAnalysis",
+			"BNSetAutoFunctionInlinedDuringAnalysis",
+			"BNSetUserFunctionInlinedDuringAnalysis",
+			"BNGetInstructionContainingAddress",
+			"BNGetBasicBlockFunction",
+			"BNGetBasicBlockArchitecture",
+			"BNGetBasicBlockSource",
+			"BNGetBasicBlockStart",
+			"BNGetBasicBlockEnd",
+			"BNGetBasicBlockLength",
+			"BNGetBasicBlockOutgoingEdges",
+			"BNGetBasicBlockIncomingEdges",
+			"BNFreeBasicBlockEdgeList",
+			"BNBasicBlockHasUndeterminedOutgoingEdges",
+			"BNBasicBlockCanExit",
+			"BNBasicBlockSetCanExit",
+			"BNBasicBlockHasInvalidInstructions",
+			"BNGetBasicBlockIndex",
+			"BNGetBasicBlockDominators",
+			"BNGetBasicBlockStrictDominators",
+			"BNGetBasicBlockImmediateDominator",
+			"BNGetBasicBlockDominatorTreeChildren",
+			"BNGetBasicBlockDominanceFrontier",
+			"BNGetBasicBlockIteratedDominanceFrontier",
+			"BNIsILBasicBlock",
+			"BNIsLowLevelILBasicBlock",
+			"BNIsMediumLevelILBasicBlock",
+			"BNIsHighLevelILBasicBlock",
+			"BNGetBasicBlockFunctionGraphType",
+			"BNGetBasicBlockLowLevelILFunction",
+			"BNGetBasicBlockMediumLevelILFunction",
+			"BNGetBasicBlockHighLevelILFunction",
+			"BNGetBasicBlockInstructionContainingAddress",
+			"BNGetBasicBlockSourceBlock",
+			"BNGetBasicBlockDisassemblyText",
+			"BNFreeDisassemblyTextLines",
+			"BNGetDisplayStringForInteger",
+			"BNCreateDisassemblyTextRenderer",
+			"BNCreateLowLevelILDisassemblyTextRenderer",
+			"BNCreateMediumLevelILDisassemblyTextRenderer",
+			"BNCreateHighLevelILDisassemblyTextRenderer",
+			"BNNewDisassemblyTextRendererReference",
+			"BNFreeDisassemblyTextRenderer",
+			"BNGetDisassemblyTextRendererFunction",
+			"BNGetDisassemblyTextRendererLowLevelILFunction",
+			"BNGetDisassemblyTextRendererMediumLevelILFunction",
+			"BNGetDisassemblyTextRendererHighLevelILFunction",
+			"BNGetDisassemblyTextRendererBasicBlock",
+			"BNGetDisassemblyTextRendererArchitecture",
+			"BNGetDisassemblyTextRendererSettings",
+			"BNSetDisassemblyTextRendererBasicBlock",
+			"BNSetDisassemblyTextRendererArchitecture",
+			"BNSetDisassemblyTextRendererSettings",
+			"BNIsILDisassemblyTextRenderer",
+			"BNDisassemblyTextRendererHasDataFlow",
+			"BNGetDisassemblyTextRendererInstructionAnnotations",
+			"BNGetDisassemblyTextRendererInstructionText",
+			"BNGetDisassemblyTextRendererLines",
+			"BNPostProcessDisassemblyTextRendererLines",
+			"BNResetDisassemblyTextRendererDeduplicatedComments",
+			"BNGetDisassemblyTextRendererSymbolTokens",
+			"BNGetDisassemblyTextRendererStackVariableReferenceTokens",
+			"BNIsIntegerToken",
+			"BNGetDisassemblyTextRendererIntegerTokens",
+			"BNDisassemblyTextRendererWrapComment",
+			"BNMarkFunctionAsRecentlyUsed",
+			"BNMarkBasicBlockAsRecentlyUsed",
+			"BNGetCodeReferences",
+			"BNGetCodeReferencesInRange",
+			"BNFreeCodeReferences",
+			"BNFreeTypeFieldReferences",
+			"BNFreeILReferences",
+			"BNGetCodeReferencesFrom",
+			"BNGetCodeReferencesFromInRange",
+			"BNGetDataReferences",
+			"BNGetDataReferencesInRange",
+			"BNGetDataReferencesFrom",
+			"BNGetDataReferencesFromInRange",
+			"BNAddUserDataReference",
+			"BNRemoveUserDataReference",
+			"BNFreeDataReferences",
+			"BNFreeTypeReferences",
+			"BNFreeTypeFieldReferenceSizeInfo",
+			"BNFreeTypeFieldReferenceTypeInfo",
+			"BNFreeTypeFieldReferenceSizes",
+			"BNFreeTypeFieldReferenceTypes",
+			"BNGetCodeReferencesForType",
+			"BNGetDataReferencesForType",
+			"BNGetTypeReferencesForType",
+			"BNGetCodeReferencesForTypeField",
+			"BNGetDataReferencesForTypeField",
+			"BNGetDataReferencesFromForTypeField",
+			"BNGetTypeReferencesForTypeField",
+			"BNGetCodeReferencesForTypeFrom",
+			"BNGetCodeReferencesForTypeFromInRange",
+			"BNGetCodeReferencesForTypeFieldsFrom",
+			"BNGetCodeReferencesForTypeFieldsFromInRange",
+			"BNGetAllFieldsReferenced",
+			"BNGetAllSizesReferenced",
+			"BNGetAllTypesReferenced",
+			"BNGetSizesReferenced",
+			"BNGetTypesReferenced",
+			"BNGetOutgoingDirectTypeReferences",
+			"BNGetOutgoingRecursiveTypeReferences",
+			"BNGetIncomingDirectTypeReferences",
+			"BNGetIncomingRecursiveTypeReferences",
+			"BNRegisterGlobalFunctionRecognizer",
+			"BNGetStringAtAddress",
+			"BNGetStrings",
+			"BNGetStringsInRange",
+			"BNFreeStringReferenceList",
+			"BNGetStackLayout",
+			"BNFreeVariableNameAndTypeList",
+			"BNCreateAutoStackVariable",
+			"BNCreateUserStackVariable",
+			"BNDeleteAutoStackVariable",
+			"BNDeleteUserStackVariable",
+			"BNGetStackVariableAtFrameOffset",
+			"BNFreeVariableNameAndType",
+			"BNGetFunctionVariables",
+			"BNCreateAutoVariable",
+			"BNCreateUserVariable",
+			"BNDeleteUserVariable",
+			"BNIsVariableUserDefined",
+			"BNGetVariableType",
+			"BNGetVariableName",
+			"BNGetVariableNameOrDefault",
+			"BNGetLastSeenVariableNameOrDefault",
+			"BNToVariableIdentifier",
+			"BNFromVariableIdentifier",
+			"BNGetFunctionVariableDeadStoreElimination",
+			"BNSetFunctionVariableDeadStoreElimination",
+			"BNGetMergedVariables",
+			"BNFreeMergedVariableList",
+			"BNMergeVariables",
+			"BNUnmergeVariables",
+			"BNGetSplitVariables",
+			"BNSplitVariable",
+			"BNUnsplitVariable",
+			"BNGetFunctionCallSites",
+			"BNGetCallees",
+			"BNGetCallers",
+			"BNSetAutoIndirectBranches",
+			"BNSetUserIndirectBranches",
+			"BNGetIndirectBranches",
+			"BNGetIndirectBranchesAt",
+			"BNFreeIndirectBranchList",
+			"BNGetUnresolvedIndirectBranches",
+			"BNHasUnresolvedIndirectBranches",
+			"BNSetAutoCallTypeAdjustment",
+			"BNSetUserCallTypeAdjustment",
+			"BNSetAutoCallStackAdjustment",
+			"BNSetUserCallStackAdjustment",
+			"BNSetAutoCallRegisterStackAdjustment",
+			"BNSetUserCallRegisterStackAdjustment",
+			"BNSetAutoCallRegisterStackAdjustmentForRegisterStack",
+			"BNSetUserCallRegisterStackAdjustmentForRegisterStack",
+			"BNGetCallTypeAdjustment",
+			"BNGetCallStackAdjustment",
+			"BNGetCallRegisterStackAdjustment",
+			"BNGetCallRegisterStackAdjustmentForRegisterStack",
+			"BNIsCallInstruction",
+			"BNGetFunctionBlockAnnotations",
+			"BNGetIntegerConstantDisplayType",
+			"BNSetIntegerConstantDisplayType",
+			"BNGetIntegerConstantDisplayTypeEnumerationType",
+			"BNSetIntegerConstantDisplayTypeEnumerationType",
+			"BNIsFunctionTooLarge",
+			"BNIsFunctionAnalysisSkipped",
+			"BNGetAnalysisSkipReason",
+			"BNGetFunctionAnalysisSkipOverride",
+			"BNSetFunctionAnalysisSkipOverride",
+			"BNGetGotoLabelName",
+			"BNSetUserGotoLabelName",
+			"BNGetParametersForAnalysis",
+			"BNSetParametersForAnalysis",
+			"BNGetMaxFunctionSizeForAnalysis",
+			"BNSetMaxFunctionSizeForAnalysis",
+			"BNGetNewAutoFunctionAnalysisSuppressed",
+			"BNSetNewAutoFunctionAnalysisSuppressed",
+			"BNAddAnalysisCompletionEvent",
+			"BNNewAnalysisCompletionEventReference",
+			"BNFreeAnalysisCompletionEvent",
+			"BNCancelAnalysisCompletionEvent",
+			"BNGetAnalysisInfo",
+			"BNFreeAnalysisInfo",
+			"BNGetAnalysisProgress",
+			"BNGetBackgroundAnalysisTask",
+			"BNGetNextFunctionStartAfterAddress",
+			"BNGetNextBasicBlockStartAfterAddress",
+			"BNGetNextDataAfterAddress",
+			"BNGetNextDataVariableStartAfterAddress",
+			"BNGetPreviousFunctionStartBeforeAddress",
+			"BNGetPreviousBasicBlockStartBeforeAddress",
+			"BNGetPreviousBasicBlockEndBeforeAddress",
+			"BNGetPreviousDataBeforeAddress",
+			"BNGetPreviousDataVariableStartBeforeAddress",
+			"BNCreateLinearViewDisassembly",
+			"BNCreateLinearViewLiftedIL",
+			"BNCreateLinearViewLowLevelIL",
+			"BNCreateLinearViewLowLevelILSSAForm",
+			"BNCreateLinearViewMediumLevelIL",
+			"BNCreateLinearViewMediumLevelILSSAForm",
+			"BNCreateLinearViewMappedMediumLevelIL",
+			"BNCreateLinearViewMappedMediumLevelILSSAForm",
+			"BNCreateLinearViewHighLevelIL",
+			"BNCreateLinearViewHighLevelILSSAForm",
+			"BNCreateLinearViewLanguageRepresentation",
+			"BNCreateLinearViewDataOnly",
+			"BNCreateLinearViewSingleFunctionDisassembly",
+			"BNCreateLinearViewSingleFunctionLiftedIL",
+			"BNCreateLinearViewSingleFunctionLowLevelIL",
+			"BNCreateLinearViewSingleFunctionLowLevelILSSAForm",
+			"BNCreateLinearViewSingleFunctionMediumLevelIL",
+			"BNCreateLinearViewSingleFunctionMediumLevelILSSAForm",
+			"BNCreateLinearViewSingleFunctionMappedMediumLevelIL",
+			"BNCreateLinearViewSingleFunctionMappedMediumLevelILSSAForm",
+			"BNCreateLinearViewSingleFunctionHighLevelIL",
+			"BNCreateLinearViewSingleFunctionHighLevelILSSAForm",
+			"BNCreateLinearViewSingleFunctionLanguageRepresentation",
+			"BNNewLinearViewObjectReference",
+			"BNFreeLinearViewObject",
+			"BNGetFirstLinearViewObjectChild",
+			"BNGetLastLinearViewObjectChild",
+			"BNGetPreviousLinearViewObjectChild",
+			"BNGetNextLinearViewObjectChild",
+			"BNGetLinearViewObjectChildForAddress",
+			"BNGetLinearViewObjectChildForIdentifier",
+			"BNGetLinearViewObjectLines",
+			"BNFreeLinearDisassemblyLines",
+			"BNGetLinearViewObjectStart",
+			"BNGetLinearViewObjectEnd",
+			"BNGetLinearViewObjectIdentifier",
+			"BNFreeLinearViewObjectIdentifier",
+			"BNCompareLinearViewObjectChildren",
+			"BNGetLinearViewObjectOrderingIndexTotal",
+			"BNGetLinearViewObjectOrderingIndexForChild",
+			"BNGetLinearViewObjectChildForOrderingIndex",
+			"BNCreateLinearViewCursor",
+			"BNDuplicateLinearViewCursor",
+			"BNNewLinearViewCursorReference",
+			"BNFreeLinearViewCursor",
+			"BNIsLinearViewCursorBeforeBegin",
+			"BNIsLinearViewCursorAfterEnd",
+			"BNGetLinearViewCursorCurrentObject",
+			"BNGetLinearViewCursorPath",
+			"BNFreeLinearViewCursorPath",
+			"BNGetLinearViewCursorPathObjects",
+			"BNFreeLinearViewCursorPathObjects",
+			"BNGetLinearViewCursorOrderingIndex",
+			"BNGetLinearViewCursorOrderingIndexTotal",
+			"BNSeekLinearViewCursorToBegin",
+			"BNSeekLinearViewCursorToEnd",
+			"BNSeekLinearViewCursorToAddress",
+			"BNSeekLinearViewCursorToPath",
+			"BNSeekLinearViewCursorToPathAndAddress",
+			"BNSeekLinearViewCursorToCursorPath",
+			"BNSeekLinearViewCursorToCursorPathAndAddress",
+			"BNSeekLinearViewCursorToOrderingIndex",
+			"BNLinearViewCursorNext",
+			"BNLinearViewCursorPrevious",
+			"BNGetLinearViewCursorLines",
+			"BNCompareLinearViewCursors",
+			"BNDefineDataVariable",
+			"BNDefineUserDataVariable",
+			"BNUndefineDataVariable",
+			"BNUndefineUserDataVariable",
+			"BNGetDataVariables",
+			"BNFreeDataVariable",
+			"BNFreeDataVariables",
+			"BNFreeDataVariableAndName",
+			"BNFreeDataVariablesAndName",
+			"BNFreeDataVariableAndNameAndDebugParserList",
+			"BNGetDataVariableAtAddress",
+			"BNParseTypeString",
+			"BNParseTypesString",
+			"BNFreeQualifiedNameAndType",
+			"BNFreeQualifiedNameAndTypeArray",
+			"BNFreeQualifiedNameTypeAndId",
+			"BNEscapeTypeName",
+			"BNUnescapeTypeName",
+			"BNGetAnalysisTypeList",
+			"BNGetAnalysisDependencySortedTypeList",
+			"BNFreeTypeAndNameList",
+			"BNFreeTypeIdList",
+			"BNGetAnalysisTypeNames",
+			"BNFreeTypeNameList",
+			"BNGetAnalysisTypeContainer",
+			"BNGetAnalysisAutoTypeContainer",
+			"BNGetAnalysisUserTypeContainer",
+			"BNGetAnalysisTypeByName",
+			"BNGetAnalysisTypeByRef",
+			"BNGetAnalysisTypeById",
+			"BNGetAnalysisTypeId",
+			"BNGetAnalysisTypeNameById",
+			"BNIsAnalysisTypeAutoDefined",
+			"BNDefineAnalysisType",
+			"BNDefineUserAnalysisType",
+			"BNDefineAnalysisTypes",
+			"BNDefineUserAnalysisTypes",
+			"BNUndefineAnalysisType",
+			"BNUndefineUserAnalysisType",
+			"BNRenameAnalysisType",
+			"BNGenerateAutoTypeId",
+			"BNGenerateAutoPlatformTypeId",
+			"BNGenerateAutoDemangledTypeId",
+			"BNGetAutoPlatformTypeIdSource",
+			"BNGetAutoDemangledTypeIdSource",
+			"BNGenerateAutoDebugTypeId",
+			"BNGetAutoDebugTypeIdSource",
+			"BNRegisterPlatformTypes",
+			"BNLookupImportedTypePlatform",
+			"BNReanalyzeAllFunctions",
+			"BNReanalyzeFunction",
+			"BNMarkUpdatesRequired",
+			"BNMarkCallerUpdatesRequired",
+			"BNGetWorkflowForBinaryView",
+			"BNGetWorkflowForFunction",
+			"BNPostWorkflowRequestForFunction",
+			"BNGetProvenanceString",
+			"BNGetInstructionHighlight",
+			"BNSetAutoInstructionHighlight",
+			"BNSetUserInstructionHighlight",
+			"BNGetBasicBlockHighlight",
+			"BNSetAutoBasicBlockHighlight",
+			"BNSetUserBasicBlockHighlight",
+			"BNFreeTypeContainer",
+			"BNDuplicateTypeContainer",
+			"BNTypeContainerGetId",
+			"BNTypeContainerGetName",
+			"BNTypeContainerGetType",
+			"BNTypeContainerIsMutable",
+			"BNTypeContainerGetPlatform",
+			"BNTypeContainerAddTypes",
+			"BNTypeContainerRenameType",
+			"BNTypeContainerDeleteType",
+			"BNTypeContainerGetTypeId",
+			"BNTypeContainerGetTypeName",
+			"BNTypeContainerGetTypeById",
+			"BNTypeContainerGetTypes",
+			"BNTypeContainerGetTypeByName",
+			"BNTypeContainerGetTypeIds",
+			"BNTypeContainerGetTypeNames",
+			"BNTypeContainerGetTypeNamesAndIds",
+			"BNTypeContainerParseTypesFromSource",
+			"BNCreateTagType",
+			"BNNewTagTypeReference",
+			"BNFreeTagType",
+			"BNFreeTagTypeList",
+			"BNTagTypeGetView",
+			"BNTagTypeGetId",
+			"BNTagTypeGetName",
+			"BNTagTypeSetName",
+			"BNTagTypeGetIcon",
+			"BNTagTypeSetIcon",
+			"BNTagTypeGetVisible",
+			"BNTagTypeSetVisible",
+			"BNTagTypeGetType",
+			"BNTagTypeSetType",
+			"BNCreateTag",
+			"BNNewTagReference",
+			"BNFreeTag",
+			"BNFreeTagList",
+			"BNTagGetId",
+			"BNTagGetType",
+			"BNTagGetData",
+			"BNTagSetData",
+			"BNAddTagType",
+			"BNRemoveTagType",
+			"BNGetTagType",
+			"BNGetTagTypeWithType",
+			"BNGetTagTypeById",
+			"BNGetTagTypeByIdWithType",
+			"BNGetTagTypes",
+			"BNAddTag",
+			"BNGetTag",
+			"BNRemoveTag",
+			"BNGetAllTagReferences",
+			"BNGetAllAddressTagReferences",
+			"BNGetAllFunctionTagReferences",
+			"BNGetAllTagReferencesOfType",
+			"BNGetTagReferencesOfType",
+			"BNGetDataTagReferences",
+			"BNGetAutoDataTagReferences",
+			"BNGetUserDataTagReferences",
+			"BNRemoveTagReference",
+			"BNFreeTagReferences",
+			"BNGetDataTags",
+			"BNGetAutoDataTags",
+			"BNGetUserDataTags",
+			"BNGetDataTagsOfType",
+			"BNGetAutoDataTagsOfType",
+			"BNGetUserDataTagsOfType",
+			"BNGetDataTagsInRange",
+			"BNGetAutoDataTagsInRange",
+			"BNGetUserDataTagsInRange",
+			"BNAddAutoDataTag",
+			"BNRemoveAutoDataTag",
+			"BNRemoveAutoDataTagsOfType",
+			"BNAddUserDataTag",
+			"BNRemoveUserDataTag",
+			"BNRemoveUserDataTagsOfType",
+			"BNGetTagReferencesOfTypeCount",
+			"BNGetAllTagReferencesOfTypeCount",
+			"BNGetAllTagReferenceTypeCounts",
+			"BNFreeTagReferenceTypeCounts",
+			"BNGetFunctionAllTagReferences",
+			"BNGetFunctionTagReferencesOfType",
+			"BNGetAddressTagReferences",
+			"BNGetAutoAddressTagReferences",
+			"BNGetUserAddressTagReferences",
+			"BNGetAddressTags",
+			"BNGetAutoAddressTags",
+			"BNGetUserAddressTags",
+			"BNGetAddressTagsOfType",
+			"BNGetAutoAddressTagsOfType",
+			"BNGetUserAddressTagsOfType",
+			"BNGetAddressTagsInRange",
+			"BNGetAutoAddressTagsInRange",
+			"BNGetUserAddressTagsInRange",
+			"BNAddAutoAddressTag",
+			"BNRemoveAutoAddressTag",
+			"BNRemoveAutoAddressTagsOfType",
+			"BNAddUserAddressTag",
+			"BNRemoveUserAddressTag",
+			"BNRemoveUserAddressTagsOfType",
+			"BNGetFunctionTagReferences",
+			"BNGetAutoFunctionTagReferences",
+			"BNGetUserFunctionTagReferences",
+			"BNGetFunctionTags",
+			"BNGetAutoFunctionTags",
+			"BNGetUserFunctionTags",
+			"BNGetFunctionTagsOfType",
+			"BNGetAutoFunctionTagsOfType",
+			"BNGetUserFunctionTagsOfType",
+			"BNAddAutoFunctionTag",
+			"BNRemoveAutoFunctionTag",
+			"BNRemoveAutoFunctionTagsOfType",
+			"BNAddUserFunctionTag",
+			"BNRemoveUserFunctionTag",
+			"BNRemoveUserFunctionTagsOfType",
+			"BNGetFunctionAnalysisPerformanceInfo",
+			"BNFreeAnalysisPerformanceInfo",
+			"BNGetUnresolvedStackAdjustmentGraph",
+			"BNSetUserVariableValue",
+			"BNClearUserVariableValue",
+			"BNGetAllUserVariableValues",
+			"BNFreeUserVariableValues",
+			"BNParsePossibleValueSet",
+			"BNRequestFunctionDebugReport",
+			"BNGetMediumLevelILVariableReferences",
+			"BNGetMediumLevelILVariableReferencesFrom",
+			"BNGetMediumLevelILVariableReferencesInRange",
+			"BNGetMediumLevelILVariableReferencesIfAvailable",
+			"BNGetMediumLevelILVariableReferencesFromIfAvailable",
+			"BNGetMediumLevelILVariableReferencesInRangeIfAvailable",
+			"BNGetHighLevelILVariableReferences",
+			"BNGetHighLevelILVariableReferencesFrom",
+			"BNGetHighLevelILVariableReferencesInRange",
+			"BNGetHighLevelILVariableReferencesIfAvailable",
+			"BNGetHighLevelILVariableReferencesFromIfAvailable",
+			"BNGetHighLevelILVariableReferencesInRangeIfAvailable",
+			"BNFreeVariableList",
+			"BNFreeVariableReferenceSourceList",
+			"BNCreateAnalysisContext",
+			"BNNewAnalysisContextReference",
+			"BNFreeAnalysisContext",
+			"BNAnalysisContextGetFunction",
+			"BNAnalysisContextGetLowLevelILFunction",
+			"BNAnalysisContextGetMediumLevelILFunction",
+			"BNAnalysisContextGetHighLevelILFunction",
+			"BNSetBasicBlockList",
+			"BNSetLiftedILFunction",
+			"BNSetLowLevelILFunction",
+			"BNSetMediumLevelILFunction",
+			"BNSetHighLevelILFunction",
+			"BNAnalysisContextInform",
+			"BNCreateActivity",
+			"BNNewActivityReference",
+			"BNFreeActivity",
+			"BNActivityGetName",
+			"BNCreateWorkflow",
+			"BNNewWorkflowReference",
+			"BNFreeWorkflow",
+			"BNGetWorkflowList",
+			"BNFreeWorkflowList",
+			"BNWorkflowInstance",
+			"BNRegisterWorkflow",
+			"BNWorkflowClone",
+			"BNWorkflowRegisterActivity",
+			"BNWorkflowContains",
+			"BNWorkflowGetConfiguration",
+			"BNGetWorkflowName",
+			"BNWorkflowIsRegistered",
+			"BNWorkflowSize",
+			"BNWorkflowGetActivity",
+			"BNWorkflowGetActivityRoots",
+			"BNWorkflowGetSubactivities",
+			"BNWorkflowAssignSubactivities",
+			"BNWorkflowClear",
+			"BNWorkflowInsert",
+			"BNWorkflowRemove",
+			"BNWorkflowReplace",
+			"BNWorkflowGetGraph",
+			"BNWorkflowShowReport",
+			"BNCreateDisassemblySettings",
+			"BNNewDisassemblySettingsReference",
+			"BNDuplicateDisassemblySettings",
+			"BNFreeDisassemblySettings",
+			"BNIsDisassemblySettingsOptionSet",
+			"BNSetDisassemblySettingsOption",
+			"BNGetDisassemblyWidth",
+			"BNSetDisassemblyWidth",
+			"BNGetDisassemblyMaximumSymbolWidth",
+			"BNSetDisassemblyMaximumSymbolWidth",
+			"BNGetDisassemblyGutterWidth",
+			"BNSetDisassemblyGutterWidth",
+			"BNCreateFlowGraph",
+			"BNCreateFunctionGraph",
+			"BNCreateLowLevelILFunctionGraph",
+			"BNCreateMediumLevelILFunctionGraph",
+			"BNCreateHighLevelILFunctionGraph",
+			"BNCreateCustomFlowGraph",
+			"BNNewFlowGraphReference",
+			"BNFreeFlowGraph",
+			"BNGetFunctionForFlowGraph",
+			"BNSetFunctionForFlowGraph",
+			"BNGetViewForFlowGraph",
+			"BNSetViewForFlowGraph",
+			"BNGetHorizontalFlowGraphNodeMargin",
+			"BNGetVerticalFlowGraphNodeMargin",
+			"BNSetFlowGraphNodeMargins",
+			"BNStartFlowGraphLayout",
+			"BNIsFlowGraphLayoutComplete",
+			"BNNewFlowGraphLayoutRequestReference",
+			"BNFreeFlowGraphLayoutRequest",
+			"BNIsFlowGraphLayoutRequestComplete",
+			"BNGetGraphForFlowGraphLayoutRequest",
+			"BNAbortFlowGraphLayoutRequest",
+			"BNIsILFlowGraph",
+			"BNIsLowLevelILFlowGraph",
+			"BNIsMediumLevelILFlowGraph",
+			"BNIsHighLevelILFlowGraph",
+			"BNGetFlowGraphLowLevelILFunction",
+			"BNGetFlowGraphMediumLevelILFunction",
+			"BNGetFlowGraphHighLevelILFunction",
+			"BNSetFlowGraphLowLevelILFunction",
+			"BNSetFlowGraphMediumLevelILFunction",
+			"BNSetFlowGraphHighLevelILFunction",
+			"BNGetFlowGraphNodes",
+			"BNGetFlowGraphNode",
+			"BNGetFlowGraphNodesInRegion",
+			"BNFreeFlowGraphNodeList",
+			"BNFlowGraphHasNodes",
+			"BNAddFlowGraphNode",
+			"BNGetFlowGraphWidth",
+			"BNGetFlowGraphHeight",
+			"BNCreateFlowGraphNode",
+			"BNNewFlowGraphNodeReference",
+			"BNFreeFlowGraphNode",
+			"BNGetFlowGraphNodeOwner",
+			"BNGetFlowGraphBasicBlock",
+			"BNSetFlowGraphBasicBlock",
+			"BNGetFlowGraphNodeX",
+			"BNGetFlowGraphNodeY",
+			"BNGetFlowGraphNodeWidth",
+			"BNGetFlowGraphNodeHeight",
+			"BNGetFlowGraphNodeLines",
+			"BNSetFlowGraphNodeLines",
+			"BNGetFlowGraphNodeOutgoingEdges",
+			"BNGetFlowGraphNodeIncomingEdges",
+			"BNFreeFlowGraphNodeEdgeList",
+			"BNAddFlowGraphNodeOutgoingEdge",
+			"BNGetFlowGraphNodeHighlight",
+			"BNSetFlowGraphNodeHighlight",
+			"BNFinishPrepareForLayout",
+			"BNFlowGraphUpdateQueryMode",
+			"BNFlowGraphHasUpdates",
+			"BNUpdateFlowGraph",
+			"BNSetFlowGraphOption",
+			"BNIsFlowGraphOptionSet",
+			"BNIsNodeValidForFlowGraph",
+			"BNCreateSymbol",
+			"BNNewSymbolReference",
+			"BNFreeSymbol",
+			"BNGetSymbolType",
+			"BNGetSymbolBinding",
+			"BNGetSymbolNameSpace",
+			"BNGetSymbolShortName",
+			"BNGetSymbolFullName",
+			"BNGetSymbolRawName",
+			"BNGetSymbolRawBytes",
+			"BNFreeSymbolRawBytes",
+			"BNGetSymbolAddress",
+			"BNGetSymbolOrdinal",
+			"BNIsSymbolAutoDefined",
+			"BNGetSymbolByAddress",
+			"BNGetSymbolByRawName",
+			"BNGetSymbolsByName",
+			"BNGetSymbolsByRawName",
+			"BNGetSymbols",
+			"BNGetSymbolsInRange",
+			"BNGetSymbolsOfType",
+			"BNGetSymbolsOfTypeInRange",
+			"BNFreeSymbolList",
+			"BNGetVisibleSymbols",
+			"BNDefineAutoSymbol",
+			"BNUndefineAutoSymbol",
+			"BNDefineUserSymbol",
+			"BNUndefineUserSymbol",
+			"BNDefineImportedFunction",
+			"BNDefineAutoSymbolAndVariableOrFunction",
+			"BNBeginBulkModifySymbols",
+			"BNEndBulkModifySymbols",
+			"BNGetDebugInfo",
+			"BNApplyDebugInfo",
+			"BNSetDebugInfo",
+			"BNIsApplyingDebugInfo",
+			"BNImportedFunctionFromImportAddressSymbol",
+			"BNCreateLowLevelILFunction",
+			"BNNewLowLevelILFunctionReference",
+			"BNFreeLowLevelILFunction",
+			"BNGetLowLevelILOwnerFunction",
+			"BNLowLevelILGetCurrentAddress",
+			"BNLowLevelILSetCurrentAddress",
+			"BNLowLevelILSetCurrentSourceBlock",
+			"BNLowLevelILGetInstructionStart",
+			"BNLowLevelILClearIndirectBranches",
+			"BNLowLevelILSetIndirectBranches",
+			"BNLowLevelILAddExpr",
+			"BNLowLevelILAddExprWithLocation",
+			"BNLowLevelILSetExprSourceOperand",
+			"BNLowLevelILAddInstruction",
+			"BNLowLevelILGoto",
+			"BNLowLevelILGotoWithLocation",
+			"BNLowLevelILIf",
+			"BNLowLevelILIfWithLocation",
+			"BNLowLevelILInitLabel",
+			"BNLowLevelILMarkLabel",
+			"BNFinalizeLowLevelILFunction",
+			"BNGenerateLowLevelILSSAForm",
+			"BNPrepareToCopyLowLevelILFunction",
+			"BNPrepareToCopyLowLevelILBasicBlock",
+			"BNGetLabelForLowLevelILSourceInstruction",
+			"BNLowLevelILAddLabelMap",
+			"BNLowLevelILAddOperandList",
+			"BNLowLevelILGetOperandList",
+			"BNLowLevelILFreeOperandList",
+			"BNGetLowLevelILByIndex",
+			"BNGetLowLevelILIndexForInstruction",
+			"BNGetLowLevelILInstructionForExpr",
+			"BNGetLowLevelILInstructionCount",
+			"BNGetLowLevelILExprCount",
+			"BNUpdateLowLevelILOperand",
+			"BNReplaceLowLevelILExpr",
+			"BNSetLowLevelILExprAttributes",
+			"BNAddLowLevelILLabelForAddress",
+			"BNGetLowLevelILLabelForAddress",
+			"BNGetLowLevelILExprText",
+			"BNGetLowLevelILInstructionText",
+			"BNGetLowLevelILTemporaryRegisterCount",
+			"BNGetLowLevelILTemporaryFlagCount",
+			"BNGetLowLevelILBasicBlockList",
+			"BNGetLowLevelILBasicBlockForInstruction",
+			"BNGetLowLevelILSSAForm",
+			"BNGetLowLevelILNonSSAForm",
+			"BNGetLowLevelILSSAInstructionIndex",
+			"BNGetLowLevelILNonSSAInstructionIndex",
+			"BNGetLowLevelILSSAExprIndex",
+			"BNGetLowLevelILNonSSAExprIndex",
+			"BNGetLowLevelILSSARegisterDefinition",
+			"BNGetLowLevelILSSAFlagDefinition",
+			"BNGetLowLevelILSSAMemoryDefinition",
+			"BNGetLowLevelILSSARegisterUses",
+			"BNGetLowLevelILSSAFlagUses",
+			"BNGetLowLevelILSSAMemoryUses",
+			"BNGetLowLevelILSSARegisterValue",
+			"BNGetLowLevelILSSAFlagValue",
+			"BNGetLowLevelILExprValue",
+			"BNGetLowLevelILPossibleExprValues",
+			"BNGetLowLevelILRegisterValueAtInstruction",
+			"BNGetLowLevelILRegisterValueAfterInstruction",
+			"BNGetLowLevelILPossibleRegisterValuesAtInstruction",
+			"BNGetLowLevelILPossibleRegisterValuesAfterInstruction",
+			"BNGetLowLevelILFlagValueAtInstruction",
+			"BNGetLowLevelILFlagValueAfterInstruction",
+			"BNGetLowLevelILPossibleFlagValuesAtInstruction",
+			"BNGetLowLevelILPossibleFlagValuesAfterInstruction",
+			"BNGetLowLevelILStackContentsAtInstruction",
+			"BNGetLowLevelILStackContentsAfterInstruction",
+			"BNGetLowLevelILPossibleStackContentsAtInstruction",
+			"BNGetLowLevelILPossibleStackContentsAfterInstruction",
+			"BNGetLowLevelRegisters",
+			"BNGetLowLevelRegisterStacks",
+			"BNGetLowLevelFlags",
+			"BNGetLowLevelSSARegistersWithoutVersions",
+			"BNGetLowLevelSSARegisterStacksWithoutVersions",
+			"BNGetLowLevelSSAFlagsWithoutVersions",
+			"BNGetLowLevelRegisterSSAVersions",
+			"BNGetLowLevelRegisterStackSSAVersions",
+			"BNGetLowLevelFlagSSAVersions",
+			"BNGetLowLevelMemoryVersions",
+			"BNFreeLLILVariablesList",
+			"BNFreeLLILVariableVersionList",
+			"BNGetMediumLevelILForLowLevelIL",
+			"BNGetMappedMediumLevelIL",
+			"BNGetMediumLevelILInstructionIndex",
+			"BNGetMediumLevelILExprIndex",
+			"BNGetMediumLevelILExprIndexes",
+			"BNGetMappedMediumLevelILInstructionIndex",
+			"BNGetMappedMediumLevelILExprIndex",
+			"BNCreateMediumLevelILFunction",
+			"BNNewMediumLevelILFunctionReference",
+			"BNFreeMediumLevelILFunction",
+			"BNGetMediumLevelILOwnerFunction",
+			"BNMediumLevelILGetCurrentAddress",
+			"BNMediumLevelILSetCurrentAddress",
+			"BNMediumLevelILGetInstructionStart",
+			"BNMediumLevelILAddExpr",
+			"BNMediumLevelILAddExprWithLocation",
+			"BNMediumLevelILAddInstruction",
+			"BNMediumLevelILGoto",
+			"BNMediumLevelILGotoWithLocation",
+			"BNMediumLevelILIf",
+			"BNMediumLevelILIfWithLocation",
+			"BNMediumLevelILInitLabel",
+			"BNMediumLevelILMarkLabel",
+			"BNFinalizeMediumLevelILFunction",
+			"BNGenerateMediumLevelILSSAForm",
+			"BNPrepareToCopyMediumLevelILFunction",
+			"BNPrepareToCopyMediumLevelILBasicBlock",
+			"BNGetLabelForMediumLevelILSourceInstruction",
+			"BNMediumLevelILAddLabelMap",
+			"BNMediumLevelILAddOperandList",
+			"BNMediumLevelILGetOperandList",
+			"BNMediumLevelILFreeOperandList",
+			"BNGetMediumLevelILByIndex",
+			"BNGetMediumLevelILIndexForInstruction",
+			"BNGetMediumLevelILInstructionForExpr",
+			"BNGetMediumLevelILInstructionCount",
+			"BNGetMediumLevelILExprCount",
+			"BNUpdateMediumLevelILOperand",
+			"BNMarkMediumLevelILInstructionForRemoval",
+			"BNReplaceMediumLevelILInstruction",
+			"BNReplaceMediumLevelILExpr",
+			"BNSetMediumLevelILExprAttributes",
+			"BNGetMediumLevelILExprText",
+			"BNGetMediumLevelILInstructionText",
+			"BNGetMediumLevelILBasicBlockList",
+			"BNGetMediumLevelILBasicBlockForInstruction",
+			"BNGetMediumLevelILSSAForm",
+			"BNGetMediumLevelILNonSSAForm",
+			"BNGetMediumLevelILSSAInstructionIndex",
+			"BNGetMediumLevelILNonSSAInstructionIndex",
+			"BNGetMediumLevelILSSAExprIndex",
+			"BNGetMediumLevelILNonSSAExprIndex",
+			"BNGetMediumLevelILSSAVarDefinition",
+			"BNGetMediumLevelILSSAMemoryDefinition",
+			"BNGetMediumLevelILSSAVarUses",
+			"BNGetMediumLevelILSSAMemoryUses",
+			"BNIsMediumLevelILSSAVarLive",
+			"BNGetMediumLevelILVariables",
+			"BNGetMediumLevelILAliasedVariables",
+			"BNGetMediumLevelILVariableSSAVersions",
+			"BNGetMediumLevelILVariableDefinitions",
+			"BNGetMediumLevelILVariableUses",
+			"BNGetMediumLevelILLiveInstructionsForVariable",
+			"BNGetDefaultIndexForMediumLevelILVariableDefinition",
+			"BNGetMediumLevelILSSAVarValue",
+			"BNGetMediumLevelILExprValue",
+			"BNGetMediumLevelILPossibleSSAVarValues",
+			"BNGetMediumLevelILPossibleExprValues",
+			"BNGetMediumLevelILSSAVarVersionAtILInstruction",
+			"BNGetMediumLevelILSSAMemoryVersionAtILInstruction",
+			"BNGetMediumLevelILVariableForRegisterAtInstruction",
+			"BNGetMediumLevelILVariableForFlagAtInstruction",
+			"BNGetMediumLevelILVariableForStackLocationAtInstruction",
+			"BNGetMediumLevelILRegisterValueAtInstruction",
+			"BNGetMediumLevelILRegisterValueAfterInstruction",
+			"BNGetMediumLevelILPossibleRegisterValuesAtInstruction",
+			"BNGetMediumLevelILPossibleRegisterValuesAfterInstruction",
+			"BNGetMediumLevelILFlagValueAtInstruction",
+			"BNGetMediumLevelILFlagValueAfterInstruction",
+			"BNGetMediumLevelILPossibleFlagValuesAtInstruction",
+			"BNGetMediumLevelILPossibleFlagValuesAfterInstruction",
+			"BNGetMediumLevelILStackContentsAtInstruction",
+			"BNGetMediumLevelILStackContentsAfterInstruction",
+			"BNGetMediumLevelILPossibleStackContentsAtInstruction",
+			"BNGetMediumLevelILPossibleStackContentsAfterInstruction",
+			"BNGetMediumLevelILBranchDependence",
+			"BNGetAllMediumLevelILBranchDependence",
+			"BNFreeILBranchDependenceList",
+			"BNGetLowLevelILForMediumLevelIL",
+			"BNGetLowLevelILInstructionIndex",
+			"BNGetLowLevelILExprIndex",
+			"BNGetLowLevelILExprIndexes",
+			"BNGetHighLevelILForMediumLevelIL",
+			"BNGetHighLevelILInstructionIndex",
+			"BNGetHighLevelILExprIndex",
+			"BNGetHighLevelILExprIndexes",
+			"BNGetMediumLevelILExprType",
+			"BNSetMediumLevelILExprType",
+			"BNCreateHighLevelILFunction",
+			"BNNewHighLevelILFunctionReference",
+			"BNFreeHighLevelILFunction",
+			"BNGetHighLevelILOwnerFunction",
+			"BNHighLevelILGetCurrentAddress",
+			"BNHighLevelILSetCurrentAddress",
+			"BNHighLevelILAddExpr",
+			"BNHighLevelILAddExprWithLocation",
+			"BNGetHighLevelILRootExpr",
+			"BNSetHighLevelILRootExpr",
+			"BNFinalizeHighLevelILFunction",
+			"BNGenerateHighLevelILSSAForm",
+			"BNHighLevelILAddOperandList",
+			"BNHighLevelILGetOperandList",
+			"BNHighLevelILFreeOperandList",
+			"BNGetHighLevelILByIndex",
+			"BNGetHighLevelILIndexForInstruction",
+			"BNGetHighLevelILInstructionForExpr",
+			"BNGetHighLevelILInstructionCount",
+			"BNGetHighLevelILExprCount",
+			"BNGetMediumLevelILForHighLevelILFunction",
+			"BNGetMediumLevelILExprIndexFromHighLevelIL",
+			"BNGetMediumLevelILExprIndexesFromHighLevelIL",
+			"BNUpdateHighLevelILOperand",
+			"BNReplaceHighLevelILExpr",
+			"BNSetHighLevelILExprAttributes",
+			"BNGetHighLevelILExprText",
+			"BNGetHighLevelILExprType",
+			"BNSetHighLevelILExprType",
+			"BNGetHighLevelILBasicBlockList",
+			"BNGetHighLevelILBasicBlockForInstruction",
+			"BNGetHighLevelILSSAForm",
+			"BNGetHighLevelILNonSSAForm",
+			"BNGetHighLevelILSSAInstructionIndex",
+			"BNGetHighLevelILNonSSAInstructionIndex",
+			"BNGetHighLevelILSSAExprIndex",
+			"BNGetHighLevelILNonSSAExprIndex",
+			"BNGetHighLevelILSSAVarDefinition",
+			"BNGetHighLevelILSSAMemoryDefinition",
+			"BNGetHighLevelILSSAVarUses",
+			"BNGetHighLevelILSSAMemoryUses",
+			"BNIsHighLevelILSSAVarLive",
+			"BNIsHighLevelILSSAVarLiveAt",
+			"BNIsHighLevelILVarLiveAt",
+			"BNGetHighLevelILVariables",
+			"BNGetHighLevelILAliasedVariables",
+			"BNGetHighLevelILVariableSSAVersions",
+			"BNGetHighLevelILVariableDefinitions",
+			"BNGetHighLevelILVariableUses",
+			"BNGetHighLevelILSSAVarVersionAtILInstruction",
+			"BNGetHighLevelILSSAMemoryVersionAtILInstruction",
+			"BNGetHighLevelILExprIndexForLabel",
+			"BNGetHighLevelILUsesForLabel",
+			"BNHighLevelILExprLessThan",
+			"BNHighLevelILExprEqual",
+			"BNNewTypeLibrary",
+			"BNNewTypeLibraryReference",
+			"BNDuplicateTypeLibrary",
+			"BNLoadTypeLibraryFromFile",
+			"BNTypeLibraryDecompressToFile",
+			"BNFreeTypeLibrary",
+			"BNLookupTypeLibraryByName",
+			"BNLookupTypeLibraryByGuid",
+			"BNGetArchitectureTypeLibraries",
+			"BNFreeTypeLibraryList",
+			"BNFinalizeTypeLibrary",
+			"BNGetTypeLibraryArchitecture",
+			"BNSetTypeLibraryName",
+			"BNGetTypeLibraryName",
+			"BNAddTypeLibraryAlternateName",
+			"BNGetTypeLibraryAlternateNames",
+			"BNSetTypeLibraryDependencyName",
+			"BNGetTypeLibraryDependencyName",
+			"BNSetTypeLibraryGuid",
+			"BNGetTypeLibraryGuid",
+			"BNClearTypeLibraryPlatforms",
+			"BNAddTypeLibraryPlatform",
+			"BNGetTypeLibraryPlatforms",
+			"BNTypeLibraryStoreMetadata",
+			"BNTypeLibraryQueryMetadata",
+			"BNTypeLibraryRemoveMetadata",
+			"BNGetTypeLibraryTypeContainer",
+			"BNAddTypeLibraryNamedObject",
+			"BNAddTypeLibraryNamedType",
+			"BNAddTypeLibraryNamedTypeSource",
+			"BNGetTypeLibraryNamedObject",
+			"BNGetTypeLibraryNamedType",
+			"BNGetTypeLibraryNamedObjects",
+			"BNGetTypeLibraryNamedTypes",
+			"BNWriteTypeLibraryToFile",
+			"BNAddBinaryViewTypeLibrary",
+			"BNGetBinaryViewTypeLibrary",
+			"BNGetBinaryViewTypeLibraries",
+			"BNBinaryViewImportTypeLibraryType",
+			"BNBinaryViewImportTypeLibraryObject",
+			"BNBinaryViewExportTypeToTypeLibrary",
+			"BNBinaryViewExportObjectToTypeLibrary",
+			"BNBinaryViewSetManualDependencies",
+			"BNBinaryViewRecordImportedObjectLibrary",
+			"BNBinaryViewLookupImportedObjectLibrary",
+			"BNBinaryViewLookupImportedTypeLibrary",
+			"BNCreateLanguageRepresentationFunction",
+			"BNNewLanguageRepresentationFunctionReference",
+			"BNFreeLanguageRepresentationFunction",
+			"BNGetLanguageRepresentationOwnerFunction",
+			"BNTypesEqual",
+			"BNTypesNotEqual",
+			"BNCreateVoidType",
+			"BNCreateBoolType",
+			"BNCreateIntegerType",
+			"BNCreateFloatType",
+			"BNCreateWideCharType",
+			"BNCreateStructureType",
+			"BNCreateEnumerationType",
+			"BNCreateEnumerationTypeOfWidth",
+			"BNCreatePointerType",
+			"BNCreatePointerTypeOfWidth",
+			"BNCreateArrayType",
+			"BNCreateFunctionType",
+			"BNNewTypeReference",
+			"BNDuplicateType",
+			"BNGetTypeAndName",
+			"BNFreeType",
+			"BNFreeTypeList",
+			"BNCreateTypeBuilderFromType",
+			"BNCreateVoidTypeBuilder",
+			"BNCreateBoolTypeBuilder",
+			"BNCreateIntegerTypeBuilder",
+			"BNCreateFloatTypeBuilder",
+			"BNCreateWideCharTypeBuilder",
+			"BNCreateStructureTypeBuilder",
+			"BNCreateStructureTypeBuilderWithBuilder",
+			"BNCreateEnumerationTypeBuilder",
+			"BNCreateEnumerationTypeBuilderWithBuilder",
+			"BNCreatePointerTypeBuilder",
+			"BNCreatePointerTypeBuilderOfWidth",
+			"BNCreateArrayTypeBuilder",
+			"BNCreateFunctionTypeBuilder",
+			"BNFinalizeTypeBuilder",
+			"BNDuplicateTypeBuilder",
+			"BNGetTypeBuilderTypeAndName",
+			"BNFreeTypeBuilder",
+			"BNTypeGetTypeName",
+			"BNGetTypeClass",
+			"BNGetTypeWidth",
+			"BNGetTypeAlignment",
+			"BNGetIntegerTypeDisplayType",
+			"BNSetIntegerTypeDisplayType",
+			"BNIsTypeSigned",
+			"BNIsTypeConst",
+			"BNIsTypeVolatile",
+			"BNIsTypeFloatingPoint",
+			"BNGetChildType",
+			"BNGetTypeCallingConvention",
+			"BNGetTypeParameters",
+			"BNFreeTypeParameterList",
+			"BNTypeHasVariableArguments",
+			"BNFunctionTypeCanReturn",
+			"BNIsTypePure",
+			"BNGetTypeStructure",
+			"BNGetTypeEnumeration",
+			"BNGetTypeNamedTypeReference",
+			"BNGetTypeElementCount",
+			"BNGetTypeOffset",
+			"BNGetTypeStackAdjustment",
+			"BNTypeGetStructureName",
+			"BNGetRegisteredTypeName",
+			"BNTypeGetReferenceType",
+			"BNGetTypeAlternateName",
+			"BNTypeGetSystemCallNumber",
+			"BNTypeIsSystemCall",
+			"BNGetTypeString",
+			"BNGetTypeStringBeforeName",
+			"BNGetTypeStringAfterName",
+			"BNGetTypeTokens",
+			"BNGetTypeTokensBeforeName",
+			"BNGetTypeTokensAfterName",
+			"BNTypeWithReplacedStructure",
+			"BNTypeWithReplacedEnumeration",
+			"BNTypeWithReplacedNamedTypeReference",
+			"BNAddTypeMemberTokens",
+			"BNGetTypeLines",
+			"BNFreeTypeDefinitionLineList",
+			"BNTypeBuilderGetTypeName",
+			"BNTypeBuilderSetTypeName",
+			"BNTypeBuilderSetAlternateName",
+			"BNGetTypeBuilderClass",
+			"BNTypeBuilderSetSystemCallNumber",
+			"BNGetTypeBuilderWidth",
+			"BNGetTypeBuilderAlignment",
+			"BNIsTypeBuilderSigned",
+			"BNIsTypeBuilderConst",
+			"BNIsTypeBuilderVolatile",
+			"BNIsTypeBuilderFloatingPoint",
+			"BNGetTypeBuilderChildType",
+			"BNGetTypeBuilderCallingConvention",
+			"BNGetTypeBuilderParameters",
+			"BNTypeBuilderHasVariableArguments",
+			"BNFunctionTypeBuilderCanReturn",
+			"BNIsTypeBuilderPure",
+			"BNGetTypeBuilderStructure",
+			"BNGetTypeBuilderEnumeration",
+			"BNGetTypeBuilderNamedTypeReference",
+			"BNSetTypeBuilderNamedTypeReference",
+			"BNGetTypeBuilderElementCount",
+			"BNGetTypeBuilderOffset",
+			"BNSetTypeBuilderOffset",
+			"BNSetFunctionTypeBuilderCanReturn",
+			"BNSetTypeBuilderPure",
+			"BNSetFunctionTypeBuilderParameters",
+			"BNTypeBuilderSetConst",
+			"BNTypeBuilderSetVolatile",
+			"BNTypeBuilderSetSigned",
+			"BNTypeBuilderSetChildType",
+			"BNGetTypeBuilderStackAdjustment",
+			"BNTypeBuilderGetStructureName",
+			"BNTypeBuilderGetReferenceType",
+			"BNGetTypeBuilderAlternateName",
+			"BNTypeBuilderIsSystemCall",
+			"BNTypeBuilderGetSystemCallNumber",
+			"BNTypeBuilderSetStackAdjustment",
+			"BNGetTypeBuilderString",
+			"BNGetTypeBuilderStringBeforeName",
+			"BNGetTypeBuilderStringAfterName",
+			"BNGetTypeBuilderTokens",
+			"BNGetTypeBuilderTokensBeforeName",
+			"BNGetTypeBuilderTokensAfterName",
+			"BNCreateNamedTypeReference",
+			"BNCreateNamedTypeReferenceFromTypeAndId",
+			"BNCreateNamedTypeReferenceFromType",
+			"BNCreateNamedTypeReferenceBuilder",
+			"BNCreateNamedTypeReferenceBuilderWithBuilder",
+			"BNCreateNamedTypeReferenceBuilderFromTypeAndId",
+			"BNCreateNamedTypeReferenceBuilderFromType",
+			"BNCreateNamedType",
+			"BNGetTypeReferenceClass",
+			"BNGetTypeReferenceId",
+			"BNGetTypeReferenceName",
+			"BNFreeQualifiedName",
+			"BNFreeQualifiedNameArray",
+			"BNFreeNamedTypeReference",
+			"BNNewNamedTypeReference",
+			"BNCreateNamedTypeBuilder",
+			"BNFreeNamedTypeReferenceBuilder",
+			"BNSetNamedTypeReferenceBuilderTypeClass",
+			"BNSetNamedTypeReferenceBuilderTypeId",
+			"BNSetNamedTypeReferenceBuilderName",
+			"BNFinalizeNamedTypeReferenceBuilder",
+			"BNGetTypeReferenceBuilderClass",
+			"BNGetTypeReferenceBuilderId",
+			"BNGetTypeReferenceBuilderName",
+			"BNCreateStructureBuilder",
+			"BNCreateStructureBuilderWithOptions",
+			"BNCreateStructureBuilderFromStructure",
+			"BNDuplicateStructureBuilder",
+			"BNFinalizeStructureBuilder",
+			"BNNewStructureReference",
+			"BNFreeStructure",
+			"BNFreeStructureBuilder",
+			"BNGetStructureMemberByName",
+			"BNGetStructureMemberAtOffset",
+			"BNFreeStructureMember",
+			"BNGetStructureMembers",
+			"BNFreeStructureMemberList",
+			"BNGetStructureMembersIncludingInherited",
+			"BNFreeInheritedStructureMemberList",
+			"BNGetMemberIncludingInheritedAtOffset",
+			"BNFreeInheritedStructureMember",
+			"BNGetStructureWidth",
+			"BNGetStructurePointerOffset",
+			"BNGetStructureAlignment",
+			"BNIsStructurePacked",
+			"BNIsStructureUnion",
+			"BNStructurePropagatesDataVariableReferences",
+			"BNGetStructureType",
+			"BNGetBaseStructuresForStructure",
+			"BNFreeBaseStructureList",
+			"BNStructureWithReplacedStructure",
+			"BNStructureWithReplacedEnumeration",
+			"BNStructureWithReplacedNamedTypeReference",
+			"BNGetStructureBuilderMemberByName",
+			"BNGetStructureBuilderMemberAtOffset",
+			"BNGetStructureBuilderMembers",
+			"BNGetStructureBuilderWidth",
+			"BNSetStructureBuilderWidth",
+			"BNGetStructureBuilderPointerOffset",
+			"BNSetStructureBuilderPointerOffset",
+			"BNGetStructureBuilderAlignment",
+			"BNSetStructureBuilderAlignment",
+			"BNIsStructureBuilderPacked",
+			"BNSetStructureBuilderPacked",
+			"BNIsStructureBuilderUnion",
+			"BNSetStructureBuilderType",
+			"BNStructureBuilderPropagatesDataVariableReferences",
+			"BNSetStructureBuilderPropagatesDataVariableReferences",
+			"BNGetStructureBuilderType",
+			"BNGetBaseStructuresForStructureBuilder",
+			"BNSetBaseStructuresForStructureBuilder",
+			"BNAddStructureBuilderMember",
+			"BNAddStructureBuilderMemberAtOffset",
+			"BNRemoveStructureBuilderMember",
+			"BNReplaceStructureBuilderMember",
+			"BNCreateEnumerationBuilder",
+			"BNCreateEnumerationBuilderFromEnumeration",
+			"BNDuplicateEnumerationBuilder",
+			"BNFinalizeEnumerationBuilder",
+			"BNNewEnumerationReference",
+			"BNFreeEnumeration",
+			"BNFreeEnumerationBuilder",
+			"BNGetEnumerationMembers",
+			"BNGetEnumerationTokensForValue",
+			"BNFreeEnumerationMemberList",
+			"BNGetEnumerationBuilderMembers",
+			"BNAddEnumerationBuilderMember",
+			"BNAddEnumerationBuilderMemberWithValue",
+			"BNRemoveEnumerationBuilderMember",
+			"BNReplaceEnumerationBuilderMember",
+			"BNCreateStructureFromOffsetAccess",
+			"BNCreateStructureMemberFromAccess",
+			"BNAddExpressionParserMagicValue",
+			"BNRemoveExpressionParserMagicValue",
+			"BNAddExpressionParserMagicValues",
+			"BNRemoveExpressionParserMagicValues",
+			"BNGetExpressionParserMagicValue",
+			"BNGetFunctionParentComponents",
+			"BNGetDataVariableParentComponents",
+			"BNCheckForStringAnnotationType",
+			"BNLoadFilename",
+			"BNLoadBinaryView",
+			"BNPreprocessSource",
+			"BNParseTypesFromSource",
+			"BNParseTypesFromSourceFile",
+			"BNRegisterTypeParser",
+			"BNGetTypeParserList",
+			"BNFreeTypeParserList",
+			"BNGetTypeParserByName",
+			"BNGetDefaultTypeParser",
+			"BNGetTypeParserName",
+			"BNGetTypeParserOptionText",
+			"BNTypeParserPreprocessSource",
+			"BNTypeParserParseTypesFromSource",
+			"BNTypeParserParseTypeString",
+			"BNParseTypeParserOptionsText",
+			"BNFormatTypeParserParseErrors",
+			"BNRegisterTypePrinter",
+			"BNGetTypePrinterList",
+			"BNFreeTypePrinterList",
+			"BNGetTypePrinterByName",
+			"BNGetTypePrinterName",
+			"BNGetTypePrinterTypeTokens",
+			"BNGetTypePrinterTypeTokensBeforeName",
+			"BNGetTypePrinterTypeTokensAfterName",
+			"BNGetTypePrinterTypeString",
+			"BNGetTypePrinterTypeStringBeforeName",
+			"BNGetTypePrinterTypeStringAfterName",
+			"BNGetTypePrinterTypeLines",
+			"BNTypePrinterPrintAllTypes",
+			"BNTypePrinterDefaultPrintAllTypes",
+			"BNFreeTypeParserResult",
+			"BNFreeTypeParserErrors",
+			"BNGetUpdateChannels",
+			"BNFreeUpdateChannelList",
+			"BNGetUpdateChannelVersions",
+			"BNFreeUpdateChannelVersionList",
+			"BNAreUpdatesAvailable",
+			"BNUpdateToVersion",
+			"BNUpdateToLatestVersion",
+			"BNAreAutoUpdatesEnabled",
+			"BNSetAutoUpdatesEnabled",
+			"BNGetTimeSinceLastUpdateCheck",
+			"BNUpdatesChecked",
+			"BNGetActiveUpdateChannel",
+			"BNSetActiveUpdateChannel",
+			"BNIsUpdateInstallationPending",
+			"BNInstallPendingUpdate",
+			"BNRegisterPluginCommand",
+			"BNRegisterPluginCommandForAddress",
+			"BNRegisterPluginCommandForRange",
+			"BNRegisterPluginCommandForFunction",
+			"BNRegisterPluginCommandForLowLevelILFunction",
+			"BNRegisterPluginCommandForLowLevelILInstruction",
+			"BNRegisterPluginCommandForMediumLevelILFunction",
+			"BNRegisterPluginCommandForMediumLevelILInstruction",
+			"BNRegisterPluginCommandForHighLevelILFunction",
+			"BNRegisterPluginCommandForHighLevelILInstruction",
+			"BNGetAllPluginCommands",
+			"BNGetValidPluginCommands",
+			"BNGetValidPluginCommandsForAddress",
+			"BNGetValidPluginCommandsForRange",
+			"BNGetValidPluginCommandsForFunction",
+			"BNGetValidPluginCommandsForLowLevelILFunction",
+			"BNGetValidPluginCommandsForLowLevelILInstruction",
+			"BNGetValidPluginCommandsForMediumLevelILFunction",
+			"BNGetValidPluginCommandsForMediumLevelILInstruction",
+			"BNGetValidPluginCommandsForHighLevelILFunction",
+			"BNGetValidPluginCommandsForHighLevelILInstruction",
+			"BNFreePluginCommandList",
+			"BNCreateCallingConvention",
+			"BNRegisterCallingConvention",
+			"BNNewCallingConventionReference",
+			"BNFreeCallingConvention",
+			"BNGetArchitectureCallingConventions",
+			"BNFreeCallingConventionList",
+			"BNGetArchitectureCallingConventionByName",
+			"BNGetCallingConventionArchitecture",
+			"BNGetCallingConventionName",
+			"BNGetCallerSavedRegisters",
+			"BNGetCalleeSavedRegisters",
+			"BNGetIntegerArgumentRegisters",
+			"BNGetFloatArgumentRegisters",
+			"BNAreArgumentRegistersSharedIndex",
+			"BNAreArgumentRegistersUsedForVarArgs",
+			"BNIsStackReservedForArgumentRegisters",
+			"BNIsStackAdjustedOnReturn",
+			"BNIsEligibleForHeuristics",
+			"BNGetIntegerReturnValueRegister",
+			"BNGetHighIntegerReturnValueRegister",
+			"BNGetFloatReturnValueRegister",
+			"BNGetGlobalPointerRegister",
+			"BNGetImplicitlyDefinedRegisters",
+			"BNGetIncomingRegisterValue",
+			"BNGetIncomingFlagValue",
+			"BNGetVariablesForParametersDefaultPermittedArgs",
+			"BNGetVariablesForParameters",
+			"BNGetParameterOrderingForVariables",
+			"BNGetStackAdjustmentForVariables",
+			"BNGetRegisterStackAdjustments",
+			"BNGetIncomingVariableForParameterVariable",
+			"BNGetParameterVariableForIncomingVariable",
+			"BNGetDefaultIncomingVariableForParameterVariable",
+			"BNGetDefaultParameterVariableForIncomingVariable",
+			"BNGetArchitectureDefaultCallingConvention",
+			"BNGetArchitectureCdeclCallingConvention",
+			"BNGetArchitectureStdcallCallingConvention",
+			"BNGetArchitectureFastcallCallingConvention",
+			"BNSetArchitectureDefaultCallingConvention",
+			"BNSetArchitectureCdeclCallingConvention",
+			"BNSetArchitectureStdcallCallingConvention",
+			"BNSetArchitectureFastcallCallingConvention",
+			"BNCreatePlatform",
+			"BNCreatePlatformWithTypes",
+			"BNRegisterPlatform",
+			"BNNewPlatformReference",
+			"BNFreePlatform",
+			"BNGetPlatformName",
+			"BNGetPlatformArchitecture",
+			"BNGetPlatformByName",
+			"BNGetPlatformList",
+			"BNGetPlatformListByArchitecture",
+			"BNGetPlatformListByOS",
+			"BNGetPlatformListByOSAndArchitecture",
+			"BNFreePlatformList",
+			"BNGetPlatformOSList",
+			"BNFreePlatformOSList",
+			"BNGetPlatformDefaultCallingConvention",
+			"BNGetPlatformCdeclCallingConvention",
+			"BNGetPlatformStdcallCallingConvention",
+			"BNGetPlatformFastcallCallingConvention",
+			"BNGetPlatformCallingConventions",
+			"BNGetPlatformSystemCallConvention",
+			"BNRegisterPlatformCallingConvention",
+			"BNRegisterPlatformDefaultCallingConvention",
+			"BNRegisterPlatformCdeclCallingConvention",
+			"BNRegisterPlatformStdcallCallingConvention",
+			"BNRegisterPlatformFastcallCallingConvention",
+			"BNSetPlatformSystemCallConvention",
+			"BNGetArchitectureStandalonePlatform",
+			"BNGetRelatedPlatform",
+			"BNAddRelatedPlatform",
+			"BNGetAssociatedPlatformByAddress",
+			"BNGetPlatformTypeContainer",
+			"BNGetPlatformTypes",
+			"BNGetPlatformVariables",
+			"BNGetPlatformFunctions",
+			"BNGetPlatformSystemCalls",
+			"BNFreeSystemCallList",
+			"BNGetPlatformTypeByName",
+			"BNGetPlatformVariableByName",
+			"BNGetPlatformFunctionByName",
+			"BNGetPlatformSystemCallName",
+			"BNGetPlatformSystemCallType",
+			"BNGetPlatformTypeLibraries",
+			"BNGetPlatformTypeLibrariesByName",
+			"BNDemangleMS",
+			"BNDemangleMSWithOptions",
+			"BNDemangleMSPlatform",
+			"BNRegisterDownloadProvider",
+			"BNGetDownloadProviderList",
+			"BNFreeDownloadProviderList",
+			"BNGetDownloadProviderByName",
+			"BNGetDownloadProviderName",
+			"BNCreateDownloadProviderInstance",
+			"BNInitDownloadInstance",
+			"BNNewDownloadInstanceReference",
+			"BNFreeDownloadInstance",
+			"BNFreeDownloadInstanceResponse",
+			"BNPerformDownloadRequest",
+			"BNPerformCustomRequest",
+			"BNReadDataForDownloadInstance",
+			"BNWriteDataForDownloadInstance",
+			"BNNotifyProgressForDownloadInstance",
+			"BNGetErrorForDownloadInstance",
+			"BNSetErrorForDownloadInstance",
+			"BNRegisterWebsocketProvider",
+			"BNGetWebsocketProviderList",
+			"BNFreeWebsocketProviderList",
+			"BNGetWebsocketProviderByName",
+			"BNGetWebsocketProviderName",
+			"BNCreateWebsocketProviderClient",
+			"BNInitWebsocketClient",
+			"BNNewWebsocketClientReference",
+			"BNFreeWebsocketClient",
+			"BNConnectWebsocketClient",
+			"BNNotifyWebsocketClientConnect",
+			"BNNotifyWebsocketClientDisconnect",
+			"BNNotifyWebsocketClientError",
+			"BNNotifyWebsocketClientReadData",
+			"BNWriteWebsocketClientData",
+			"BNDisconnectWebsocketClient",
+			"BNRegisterScriptingProvider",
+			"BNGetScriptingProviderList",
+			"BNFreeScriptingProviderList",
+			"BNGetScriptingProviderByName",
+			"BNGetScriptingProviderByAPIName",
+			"BNGetScriptingProviderName",
+			"BNGetScriptingProviderAPIName",
+			"BNCreateScriptingProviderInstance",
+			"BNLoadScriptingProviderModule",
+			"BNInstallScriptingProviderModules",
+			"BNInitScriptingInstance",
+			"BNNewScriptingInstanceReference",
+			"BNFreeScriptingInstance",
+			"BNNotifyOutputForScriptingInstance",
+			"BNNotifyWarningForScriptingInstance",
+			"BNNotifyErrorForScriptingInstance",
+			"BNNotifyInputReadyStateForScriptingInstance",
+			"BNRegisterScriptingInstanceOutputListener",
+			"BNUnregisterScriptingInstanceOutputListener",
+			"BNGetScriptingInstanceDelimiters",
+			"BNSetScriptingInstanceDelimiters",
+			"BNGetScriptingInstanceInputReadyState",
+			"BNExecuteScriptInput",
+			"BNExecuteScriptInputFromFilename",
+			"BNCancelScriptInput",
+			"BNScriptingInstanceReleaseBinaryView",
+			"BNSetScriptingInstanceCurrentBinaryView",
+			"BNSetScriptingInstanceCurrentFunction",
+			"BNSetScriptingInstanceCurrentBasicBlock",
+			"BNSetScriptingInstanceCurrentAddress",
+			"BNSetScriptingInstanceCurrentSelection",
+			"BNScriptingInstanceCompleteInput",
+			"BNStopScriptingInstance",
+			"BNRegisterMainThread",
+			"BNNewMainThreadActionReference",
+			"BNFreeMainThreadAction",
+			"BNExecuteMainThreadAction",
+			"BNIsMainThreadActionDone",
+			"BNWaitForMainThreadAction",
+			"BNExecuteOnMainThread",
+			"BNExecuteOnMainThreadAndWait",
+			"BNIsMainThread",
+			"BNWorkerEnqueue",
+			"BNWorkerEnqueueNamed",
+			"BNWorkerPriorityEnqueue",
+			"BNWorkerPriorityEnqueueNamed",
+			"BNWorkerInteractiveEnqueue",
+			"BNWorkerInteractiveEnqueueNamed",
+			"BNGetWorkerThreadCount",
+			"BNSetWorkerThreadCount",
+			"BNBeginBackgroundTask",
+			"BNFinishBackgroundTask",
+			"BNSetBackgroundTaskProgressText",
+			"BNIsBackgroundTaskCancelled",
+			"BNGetRunningBackgroundTasks",
+			"BNNewBackgroundTaskReference",
+			"BNFreeBackgroundTask",
+			"BNFreeBackgroundTaskList",
+			"BNGetBackgroundTaskProgressText",
+			"BNCanCancelBackgroundTask",
+			"BNCancelBackgroundTask",
+			"BNIsBackgroundTaskFinished",
+			"BNRegisterInteractionHandler",
+			"BNMarkdownToHTML",
+			"BNShowPlainTextReport",
+			"BNShowMarkdownReport",
+			"BNShowHTMLReport",
+			"BNShowGraphReport",
+			"BNShowReportCollection",
+			"BNGetTextLineInput",
+			"BNGetIntegerInput",
+			"BNGetAddressInput",
+			"BNGetChoiceInput",
+			"BNGetLargeChoiceInput",
+			"BNGetOpenFileNameInput",
+			"BNGetSaveFileNameInput",
+			"BNGetDirectoryNameInput",
+			"BNGetFormInput",
+			"BNFreeFormInputResults",
+			"BNShowMessageBox",
+			"BNOpenUrl",
+			"BNRunProgressDialog",
+			"BNCreateReportCollection",
+			"BNNewReportCollectionReference",
+			"BNFreeReportCollection",
+			"BNGetReportCollectionCount",
+			"BNGetReportType",
+			"BNGetReportView",
+			"BNGetReportTitle",
+			"BNGetReportContents",
+			"BNGetReportPlainText",
+			"BNGetReportFlowGraph",
+			"BNAddPlainTextReportToCollection",
+			"BNAddMarkdownReportToCollection",
+			"BNAddHTMLReportToCollection",
+			"BNAddGraphReportToCollection",
+			"BNUpdateReportFlowGraph",
+			"BNIsGNU3MangledString",
+			"BNDemangleGNU3",
+			"BNDemangleGNU3WithOptions",
+			"BNFreeDemangledName",
+			"BNPluginGetApis",
+			"BNPluginGetAuthor",
+			"BNPluginGetDescription",
+			"BNPluginGetLicense",
+			"BNPluginGetLicenseText",
+			"BNPluginGetLongdescription",
+			"BNPluginGetMinimumVersion",
+			"BNPluginGetName",
+			"BNPluginGetProjectUrl",
+			"BNPluginGetPackageUrl",
+			"BNPluginGetAuthorUrl",
+			"BNPluginGetVersion",
+			"BNPluginGetCommit",
+			"BNFreePluginTypes",
+			"BNNewPluginReference",
+			"BNFreePlugin",
+			"BNPluginGetPath",
+			"BNPluginGetSubdir",
+			"BNPluginGetDependencies",
+			"BNPluginIsInstalled",
+			"BNPluginIsEnabled",
+			"BNPluginGetPluginStatus",
+			"BNPluginGetPluginTypes",
+			"BNPluginEnable",
+			"BNPluginDisable",
+			"BNPluginInstall",
+			"BNPluginInstallDependencies",
+			"BNPluginUninstall",
+			"BNPluginUpdate",
+			"BNPluginGetInstallInstructions",
+			"BNPluginGetPlatforms",
+			"BNFreePluginPlatforms",
+			"BNPluginGetRepository",
+			"BNPluginIsBeingDeleted",
+			"BNPluginIsBeingUpdated",
+			"BNPluginIsRunning",
+			"BNPluginIsUpdatePending",
+			"BNPluginIsDisablePending",
+			"BNPluginIsDeletePending",
+			"BNPluginIsUpdateAvailable",
+			"BNPluginAreDependenciesBeingInstalled",
+			"BNPluginGetProjectData",
+			"BNPluginGetLastUpdate",
+			"BNNewRepositoryReference",
+			"BNFreeRepository",
+			"BNRepositoryGetUrl",
+			"BNRepositoryGetRepoPath",
+			"BNRepositoryGetPlugins",
+			"BNFreeRepositoryPluginList",
+			"BNRepositoryFreePluginDirectoryList",
+			"BNRepositoryGetPluginByPath",
+			"BNRepositoryGetPluginsPath",
+			"BNCreateRepositoryManager",
+			"BNNewRepositoryManagerReference",
+			"BNFreeRepositoryManager",
+			"BNRepositoryManagerCheckForUpdates",
+			"BNRepositoryManagerGetRepositories",
+			"BNFreeRepositoryManagerRepositoriesList",
+			"BNRepositoryManagerAddRepository",
+			"BNRepositoryGetRepositoryByPath",
+			"BNGetRepositoryManager",
+			"BNRepositoryManagerGetDefaultRepository",
+			"BNNewComponentReference",
+			"BNFreeComponent",
+			"BNComponentGetContainedFunctions",
+			"BNComponentGetContainedComponents",
+			"BNComponentGetContainedDataVariables",
+			"BNComponentGetReferencedDataVariables",
+			"BNComponentGetReferencedDataVariablesRecursive",
+			"BNComponentGetReferencedTypes",
+			"BNComponentGetReferencedTypesRecursive",
+			"BNFreeComponents",
+			"BNComponentFreeReferencedTypes",
+			"BNComponentGetParent",
+			"BNComponentContainsFunction",
+			"BNComponentContainsComponent",
+			"BNComponentContainsDataVariable",
+			"BNComponentAddFunctionReference",
+			"BNComponentAddComponent",
+			"BNComponentAddDataVariable",
+			"BNComponentRemoveComponent",
+			"BNComponentRemoveFunctionReference",
+			"BNComponentRemoveAllFunctions",
+			"BNComponentRemoveDataVariable",
+			"BNComponentAddAllMembersFromComponent",
+			"BNComponentGetGuid",
+			"BNComponentsEqual",
+			"BNComponentsNotEqual",
+			"BNComponentGetDisplayName",
+			"BNComponentGetOriginalName",
+			"BNComponentSetName",
+			"BNComponentGetView",
+			"BNLlvmServicesInit",
+			"BNLlvmServicesAssemble",
+			"BNLlvmServicesAssembleFree",
+			"BNDeleteFile",
+			"BNDeleteDirectory",
+			"BNCreateDirectory",
+			"BNPathExists",
+			"BNGetParentPath",
+			"BNIsPathDirectory",
+			"BNIsPathRegularFile",
+			"BNFileSize",
+			"BNRenameFile",
+			"BNCopyFile",
+			"BNGetFileName",
+			"BNGetFileExtension",
+			"BNGetFilePathsInDirectory",
+			"BNAppendPath",
+			"BNFreePath",
+			"BNCreateSettings",
+			"BNNewSettingsReference",
+			"BNFreeSettings",
+			"BNLoadSettingsFile",
+			"BNSettingsSetResourceId",
+			"BNSettingsRegisterGroup",
+			"BNSettingsRegisterSetting",
+			"BNSettingsContains",
+			"BNSettingsIsEmpty",
+			"BNSettingsKeysList",
+			"BNSettingsQueryPropertyStringList",
+			"BNSettingsUpdateProperty",
+			"BNSettingsUpdateBoolProperty",
+			"BNSettingsUpdateDoubleProperty",
+			"BNSettingsUpdateInt64Property",
+			"BNSettingsUpdateUInt64Property",
+			"BNSettingsUpdateStringProperty",
+			"BNSettingsUpdateStringListProperty",
+			"BNSettingsDeserializeSchema",
+			"BNSettingsSerializeSchema",
+			"BNDeserializeSettings",
+			"BNSerializeSettings",
+			"BNSettingsReset",
+			"BNSettingsResetAll",
+			"BNSettingsGetBool",
+			"BNSettingsGetDouble",
+			"BNSettingsGetInt64",
+			"BNSettingsGetUInt64",
+			"BNSettingsGetString",
+			"BNSettingsGetStringList",
+			"BNSettingsGetJson",
+			"BNSettingsSetBool",
+			"BNSettingsSetDouble",
+			"BNSettingsSetInt64",
+			"BNSettingsSetUInt64",
+			"BNSettingsSetString",
+			"BNSettingsSetStringList",
+			"BNSettingsSetJson",
+			"BNNewMetadataReference",
+			"BNCreateMetadataBooleanData",
+			"BNCreateMetadataStringData",
+			"BNCreateMetadataUnsignedIntegerData",
+			"BNCreateMetadataSignedIntegerData",
+			"BNCreateMetadataDoubleData",
+			"BNCreateMetadataOfType",
+			"BNCreateMetadataRawData",
+			"BNCreateMetadataArray",
+			"BNCreateMetadataValueStore",
+			"BNCreateMetadataBooleanListData",
+			"BNCreateMetadataUnsignedIntegerListData",
+			"BNCreateMetadataSignedIntegerListData",
+			"BNCreateMetadataDoubleListData",
+			"BNCreateMetadataStringListData",
+			"BNMetadataIsEqual",
+			"BNMetadataSetValueForKey",
+			"BNMetadataGetForKey",
+			"BNMetadataArrayAppend",
+			"BNMetadataRemoveKey",
+			"BNMetadataSize",
+			"BNMetadataGetForIndex",
+			"BNMetadataRemoveIndex",
+			"BNFreeMetadataArray",
+			"BNFreeMetadataValueStore",
+			"BNFreeMetadata",
+			"BNFreeMetadataRaw",
+			"BNFreeMetadataBooleanList",
+			"BNFreeMetadataUnsignedIntegerList",
+			"BNFreeMetadataSignedIntegerList",
+			"BNFreeMetadataDoubleList",
+			"BNFreeMetadataStringList",
+			"BNMetadataGetBoolean",
+			"BNMetadataGetString",
+			"BNMetadataGetUnsignedInteger",
+			"BNMetadataGetSignedInteger",
+			"BNMetadataGetDouble",
+			"BNMetadataGetBooleanList",
+			"BNMetadataGetStringList",
+			"BNMetadataGetUnsignedIntegerList",
+			"BNMetadataGetSignedIntegerList",
+			"BNMetadataGetDoubleList",
+			"BNMetadataGetRaw",
+			"BNMetadataGetArray",
+			"BNMetadataGetValueStore",
+			"BNMetadataGetType",
+			"BNMetadataIsBoolean",
+			"BNMetadataIsString",
+			"BNMetadataIsUnsignedInteger",
+			"BNMetadataIsSignedInteger",
+			"BNMetadataIsDouble",
+			"BNMetadataIsBooleanList",
+			"BNMetadataIsStringList",
+			"BNMetadataIsUnsignedIntegerList",
+			"BNMetadataIsSignedIntegerList",
+			"BNMetadataIsDoubleList",
+			"BNMetadataIsRaw",
+			"BNMetadataIsArray",
+			"BNMetadataIsKeyValueStore",
+			"BNBinaryViewStoreMetadata",
+			"BNBinaryViewQueryMetadata",
+			"BNBinaryViewRemoveMetadata",
+			"BNBinaryViewGetLoadSettingsTypeNames",
+			"BNBinaryViewGetLoadSettings",
+			"BNBinaryViewSetLoadSettings",
+			"BNNewRelocationReference",
+			"BNFreeRelocation",
+			"BNRelocationGetInfo",
+			"BNRelocationGetArchitecture",
+			"BNRelocationGetTarget",
+			"BNRelocationGetReloc",
+			"BNRelocationGetSymbol",
+			"BNCreateSegment",
+			"BNNewSegmentReference",
+			"BNFreeSegment",
+			"BNSegmentGetRelocationRanges",
+			"BNSegmentGetRelocationsCount",
+			"BNSegmentGetRelocationRangesAtAddress",
+			"BNSegmentRangeContainsRelocation",
+			"BNFreeRelocationRanges",
+			"BNSegmentGetStart",
+			"BNSegmentGetLength",
+			"BNSegmentGetEnd",
+			"BNSegmentGetDataEnd",
+			"BNSegmentGetDataOffset",
+			"BNSegmentGetDataLength",
+			"BNSegmentGetFlags",
+			"BNSegmentIsAutoDefined",
+			"BNSegmentSetLength",
+			"BNSegmentSetDataOffset",
+			"BNSegmentSetDataLength",
+			"BNSegmentSetFlags",
+			"BNNewSectionReference",
+			"BNFreeSection",
+			"BNSectionGetName",
+			"BNSectionGetType",
+			"BNSectionGetStart",
+			"BNSectionGetLength",
+			"BNSectionGetEnd",
+			"BNSectionGetLinkedSection",
+			"BNSectionGetInfoSection",
+			"BNSectionGetInfoData",
+			"BNSectionGetAlign",
+			"BNSectionGetEntrySize",
+			"BNSectionGetSemantics",
+			"BNSectionIsAutoDefined",
+			"BNCreateDataRenderer",
+			"BNNewDataRendererReference",
+			"BNIsValidForData",
+			"BNGetLinesForData",
+			"BNRenderLinesForData",
+			"BNFreeDataRenderer",
+			"BNGetDataRendererContainer",
+			"BNRegisterGenericDataRenderer",
+			"BNRegisterTypeSpecificDataRenderer",
+			"BNParseExpression",
+			"BNFreeParseError",
+			"BNGetCurrentStackTraceString",
+			"BNRegisterObjectRefDebugTrace",
+			"BNUnregisterObjectRefDebugTrace",
+			"BNGetMemoryUsageInfo",
+			"BNFreeMemoryUsageInfo",
+			"BNGetAddressRenderedWidth",
+			"BNRustSimplifyStrToFQN",
+			"BNRustSimplifyStrToStr",
+			"BNRegisterDebugInfoParser",
+			"BNUnregisterDebugInfoParser",
+			"BNGetDebugInfoParserByName",
+			"BNGetDebugInfoParsers",
+			"BNGetDebugInfoParsersForView",
+			"BNGetDebugInfoParserName",
+			"BNIsDebugInfoParserValidForView",
+			"BNParseDebugInfo",
+			"BNNewDebugInfoParserReference",
+			"BNFreeDebugInfoParserReference",
+			"BNFreeDebugInfoParserList",
+			"BNNewDebugInfoReference",
+			"BNFreeDebugInfoReference",
+			"BNGetDebugParserNames",
+			"BNGetDebugInfoTypeContainer",
+			"BNRemoveDebugParserInfo",
+			"BNRemoveDebugParserTypes",
+			"BNRemoveDebugParserFunctions",
+			"BNRemoveDebugParserDataVariables",
+			"BNAddDebugType",
+			"BNGetDebugTypes",
+			"BNGetDebugTypeByName",
+			"BNGetDebugTypesByName",
+			"BNRemoveDebugTypeByName",
+			"BNFreeDebugTypes",
+			"BNAddDebugFunction",
+			"BNGetDebugFunctions",
+			"BNRemoveDebugFunctionByIndex",
+			"BNFreeDebugFunctions",
+			"BNAddDebugDataVariable",
+			"BNAddDebugDataVariableInfo",
+			"BNGetDebugDataVariables",
+			"BNGetDebugDataVariableByName",
+			"BNGetDebugDataVariableByAddress",
+			"BNGetDebugDataVariablesByName",
+			"BNGetDebugDataVariablesByAddress",
+			"BNRemoveDebugDataVariableByAddress",
+			"BNRegisterSecretsProvider",
+			"BNGetSecretsProviderList",
+			"BNFreeSecretsProviderList",
+			"BNGetSecretsProviderByName",
+			"BNGetSecretsProviderName",
+			"BNSecretsProviderHasData",
+			"BNGetSecretsProviderData",
+			"BNStoreSecretsProviderData",
+			"BNDeleteSecretsProviderData",
+			"BNCreateSymbolQueue",
+			"BNDestroySymbolQueue",
+			"BNAppendSymbolQueue",
+			"BNProcessSymbolQueue",
+			"BNCoreEnumToString",
+			"BNCoreEnumFromString",
+		};
+	}  // namespace ApiProfile
+}  // namespace BinaryNinja
+
+#define BNAllocString(...) ::BinaryNinja::ApiProfile::Instrument<0>(::BNAllocString)(__VA_ARGS__)
+#define BNFreeString(...) ::BinaryNinja::ApiProfile::Instrument<1>(::BNFreeString)(__VA_ARGS__)
+#define BNAllocStringList(...) ::BinaryNinja::ApiProfile::Instrument<2>(::BNAllocStringList)(__VA_ARGS__)
+#define BNFreeStringList(...) ::BinaryNinja::ApiProfile::Instrument<3>(::BNFreeStringList)(__VA_ARGS__)
+#define BNShutdown(...) ::BinaryNinja::ApiProfile::Instrument<4>(::BNShutdown)(__VA_ARGS__)
+#define BNIsShutdownRequested(...) ::BinaryNinja::ApiProfile::Instrument<5>(::BNIsShutdownRequested)(__VA_ARGS__)
+#define BNGetVersionInfo(...) ::BinaryNinja::ApiProfile::Instrument<6>(::BNGetVersionInfo)(__VA_ARGS__)
+#define BNGetVersionString(...) ::BinaryNinja::ApiProfile::Instrument<7>(::BNGetVersionString)(__VA_ARGS__)
+#define BNGetBuildId(...) ::BinaryNinja::ApiProfile::Instrument<8>(::BNGetBuildId)(__VA_ARGS__)
+#define BNGetCurrentCoreABIVersion(...) ::BinaryNinja::ApiProfile::Instrument<9>(::BNGetCurrentCoreABIVersion)(__VA_ARGS__)
+#define BNGetMinimumCoreABIVersion(...) ::BinaryNinja::ApiProfile::Instrument<10>(::BNGetMinimumCoreABIVersion)(__VA_ARGS__)
+#define BNGetSerialNumber(...) ::BinaryNinja::ApiProfile::Instrument<11>(::BNGetSerialNumber)(__VA_ARGS__)
+#define BNGetLicenseExpirationTime(...) ::BinaryNinja::ApiProfile::Instrument<12>(::BNGetLicenseExpirationTime)(__VA_ARGS__)
+#define BNIsLicenseValidated(...) ::BinaryNinja::ApiProfile::Instrument<13>(::BNIsLicenseValidated)(__VA_ARGS__)
+#define BNGetLicensedUserEmail(...) ::BinaryNinja::ApiProfile::Instrument<14>(::BNGetLicensedUserEmail)(__VA_ARGS__)
+#define BNGetProduct(...) ::BinaryNinja::ApiProfile::Instrument<15>(::BNGetProduct)(__VA_ARGS__)
+#define BNGetProductType(...) ::BinaryNinja::ApiProfile::Instrument<16>(::BNGetProductType)(__VA_ARGS__)
+#define BNGetLicenseCount(...) ::BinaryNinja::ApiProfile::Instrument<17>(::BNGetLicenseCount)(__VA_ARGS__)
+#define BNIsUIEnabled(...) ::BinaryNinja::ApiProfile::Instrument<18>(::BNIsUIEnabled)(__VA_ARGS__)
+#define BNSetLicense(...) ::BinaryNinja::ApiProfile::Instrument<19>(::BNSetLicense)(__VA_ARGS__)
+#define BNAuthenticateEnterpriseServerWithCredentials(...) ::BinaryNinja::ApiProfile::Instrument<20>(::BNAuthenticateEnterpriseServerWithCredentials)(__VA_ARGS__)
+#define BNAuthenticateEnterpriseServerWithMethod(...) ::BinaryNinja::ApiProfile::Instrument<21>(::BNAuthenticateEnterpriseServerWithMethod)(__VA_ARGS__)
+#define BNGetEnterpriseServerAuthenticationMethods(...) ::BinaryNinja::ApiProfile::Instrument<22>(::BNGetEnterpriseServerAuthenticationMethods)(__VA_ARGS__)
+#define BNDeauthenticateEnterpriseServer(...) ::BinaryNinja::ApiProfile::Instrument<23>(::BNDeauthenticateEnterpriseServer)(__VA_ARGS__)
+#define BNCancelEnterpriseServerAuthentication(...) ::BinaryNinja::ApiProfile::Instrument<24>(::BNCancelEnterpriseServerAuthentication)(__VA_ARGS__)
+#define BNConnectEnterpriseServer(...) ::BinaryNinja::ApiProfile::Instrument<25>(::BNConnectEnterpriseServer)(__VA_ARGS__)
+#define BNUpdateEnterpriseServerLicense(...) ::BinaryNinja::ApiProfile::Instrument<26>(::BNUpdateEnterpriseServerLicense)(__VA_ARGS__)
+#define BNReleaseEnterpriseServerLicense(...) ::BinaryNinja::ApiProfile::Instrument<27>(::BNReleaseEnterpriseServerLicense)(__VA_ARGS__)
+#define BNIsEnterpriseServerConnected(...) ::BinaryNinja::ApiProfile::Instrument<28>(::BNIsEnterpriseServerConnected)(__VA_ARGS__)
+#define BNIsEnterpriseServerAuthenticated(...) ::BinaryNinja::ApiProfile::Instrument<29>(::BNIsEnterpriseServerAuthenticated)(__VA_ARGS__)
+#define BNGetEnterpriseServerUsername(...) ::BinaryNinja::ApiProfile::Instrument<30>(::BNGetEnterpriseServerUsername)(__VA_ARGS__)
+#define BNGetEnterpriseServerToken(...) ::BinaryNinja::ApiProfile::Instrument<31>(::BNGetEnterpriseServerToken)(__VA_ARGS__)
+#define BNGetEnterpriseServerUrl(...) ::BinaryNinja::ApiProfile::Instrument<32>(::BNGetEnterpriseServerUrl)(__VA_ARGS__)
+#define BNSetEnterpriseServerUrl(...) ::BinaryNinja::ApiProfile::Instrument<33>(::BNSetEnterpriseServerUrl)(__VA_ARGS__)
+#define BNGetEnterpriseServerName(...) ::BinaryNinja::ApiProfile::Instrument<34>(::BNGetEnterpriseServerName)(__VA_ARGS__)
+#define BNGetEnterpriseServerId(...) ::BinaryNinja::ApiProfile::Instrument<35>(::BNGetEnterpriseServerId)(__VA_ARGS__)
+#define BNGetEnterpriseServerVersion(...) ::BinaryNinja::ApiProfile::Instrument<36>(::BNGetEnterpriseServerVersion)(__VA_ARGS__)
+#define BNGetEnterpriseServerBuildId(...) ::BinaryNinja::ApiProfile::Instrument<37>(::BNGetEnterpriseServerBuildId)(__VA_ARGS__)
+#define BNGetEnterpriseServerLicenseExpirationTime(...) ::BinaryNinja::ApiProfile::Instrument<38>(::BNGetEnterpriseServerLicenseExpirationTime)(__VA_ARGS__)
+#define BNGetEnterpriseServerLicenseDuration(...) ::BinaryNinja::ApiProfile::Instrument<39>(::BNGetEnterpriseServerLicenseDuration)(__VA_ARGS__)
+#define BNIsEnterpriseServerFloatingLicense(...) ::BinaryNinja::ApiProfile::Instrument<40>(::BNIsEnterpriseServerFloatingLicense)(__VA_ARGS__)
+#define BNGetEnterpriseServerReservationTimeLimit(...) ::BinaryNinja::ApiProfile::Instrument<41>(::BNGetEnterpriseServerReservationTimeLimit)(__VA_ARGS__)
+#define BNIsEnterpriseServerLicenseStillActivated(...) ::BinaryNinja::ApiProfile::Instrument<42>(::BNIsEnterpriseServerLicenseStillActivated)(__VA_ARGS__)
+#define BNGetEnterpriseServerLastError(...) ::BinaryNinja::ApiProfile::Instrument<43>(::BNGetEnterpriseServerLastError)(__VA_ARGS__)
+#define BNRegisterEnterpriseServerNotification(...) ::BinaryNinja::ApiProfile::Instrument<44>(::BNRegisterEnterpriseServerNotification)(__VA_ARGS__)
+#define BNUnregisterEnterpriseServerNotification(...) ::BinaryNinja::ApiProfile::Instrument<45>(::BNUnregisterEnterpriseServerNotification)(__VA_ARGS__)
+#define BNIsEnterpriseServerInitialized(...) ::BinaryNinja::ApiProfile::Instrument<46>(::BNIsEnterpriseServerInitialized)(__VA_ARGS__)
+#define BNRegisterObjectDestructionCallbacks(...) ::BinaryNinja::ApiProfile::Instrument<47>(::BNRegisterObjectDestructionCallbacks)(__VA_ARGS__)
+#define BNUnregisterObjectDestructionCallbacks(...) ::BinaryNinja::ApiProfile::Instrument<48>(::BNUnregisterObjectDestructionCallbacks)(__VA_ARGS__)
+#define BNGetUniqueIdentifierString(...) ::BinaryNinja::ApiProfile::Instrument<49>(::BNGetUniqueIdentifierString)(__VA_ARGS__)
+#define BNInitPlugins(...) ::BinaryNinja::ApiProfile::Instrument<50>(::BNInitPlugins)(__VA_ARGS__)
+#define BNInitCorePlugins(...) ::BinaryNinja::ApiProfile::Instrument<51>(::BNInitCorePlugins)(__VA_ARGS__)
+#define BNDisablePlugins(...) ::BinaryNinja::ApiProfile::Instrument<52>(::BNDisablePlugins)(__VA_ARGS__)
+#define BNIsPluginsEnabled(...) ::BinaryNinja::ApiProfile::Instrument<53>(::BNIsPluginsEnabled)(__VA_ARGS__)
+#define BNInitUserPlugins(...) ::BinaryNinja::ApiProfile::Instrument<54>(::BNInitUserPlugins)(__VA_ARGS__)
+#define BNInitRepoPlugins(...) ::BinaryNinja::ApiProfile::Instrument<55>(::BNInitRepoPlugins)(__VA_ARGS__)
+#define BNGetInstallDirectory(...) ::BinaryNinja::ApiProfile::Instrument<56>(::BNGetInstallDirectory)(__VA_ARGS__)
+#define BNGetBundledPluginDirectory(...) ::BinaryNinja::ApiProfile::Instrument<57>(::BNGetBundledPluginDirectory)(__VA_ARGS__)
+#define BNSetBundledPluginDirectory(...) ::BinaryNinja::ApiProfile::Instrument<58>(::BNSetBundledPluginDirectory)(__VA_ARGS__)
+#define BNGetUserDirectory(...) ::BinaryNinja::ApiProfile::Instrument<59>(::BNGetUserDirectory)(__VA_ARGS__)
+#define BNGetUserPluginDirectory(...) ::BinaryNinja::ApiProfile::Instrument<60>(::BNGetUserPluginDirectory)(__VA_ARGS__)
+#define BNGetRepositoriesDirectory(...) ::BinaryNinja::ApiProfile::Instrument<61>(::BNGetRepositoriesDirectory)(__VA_ARGS__)
+#define BNGetSettingsFileName(...) ::BinaryNinja::ApiProfile::Instrument<62>(::BNGetSettingsFileName)(__VA_ARGS__)
+#define BNSaveLastRun(...) ::BinaryNinja::ApiProfile::Instrument<63>(::BNSaveLastRun)(__VA_ARGS__)
+#define BNGetPathRelativeToBundledPluginDirectory(...) ::BinaryNinja::ApiProfile::Instrument<64>(::BNGetPathRelativeToBundledPluginDirectory)(__VA_ARGS__)
+#define BNGetPathRelativeToUserPluginDirectory(...) ::BinaryNinja::ApiProfile::Instrument<65>(::BNGetPathRelativeToUserPluginDirectory)(__VA_ARGS__)
+#define BNGetPathRelativeToUserDirectory(...) ::BinaryNinja::ApiProfile::Instrument<66>(::BNGetPathRelativeToUserDirectory)(__VA_ARGS__)
+#define BNExecuteWorkerProcess(...) ::BinaryNinja::ApiProfile::Instrument<67>(::BNExecuteWorkerProcess)(__VA_ARGS__)
+#define BNSetCurrentPluginLoadOrder(...) ::BinaryNinja::ApiProfile::Instrument<68>(::BNSetCurrentPluginLoadOrder)(__VA_ARGS__)
+#define BNAddRequiredPluginDependency(...) ::BinaryNinja::ApiProfile::Instrument<69>(::BNAddRequiredPluginDependency)(__VA_ARGS__)
+#define BNAddOptionalPluginDependency(...) ::BinaryNinja::ApiProfile::Instrument<70>(::BNAddOptionalPluginDependency)(__VA_ARGS__)
+#define BNLogString(...) ::BinaryNinja::ApiProfile::Instrument<71>(::BNLogString)(__VA_ARGS__)
+#define BNNewLoggerReference(...) ::BinaryNinja::ApiProfile::Instrument<72>(::BNNewLoggerReference)(__VA_ARGS__)
+#define BNFreeLogger(...) ::BinaryNinja::ApiProfile::Instrument<73>(::BNFreeLogger)(__VA_ARGS__)
+#define BNLoggerLogString(...) ::BinaryNinja::ApiProfile::Instrument<74>(::BNLoggerLogString)(__VA_ARGS__)
+#define BNLoggerGetName(...) ::BinaryNinja::ApiProfile::Instrument<75>(::BNLoggerGetName)(__VA_ARGS__)
+#define BNLoggerGetSessionId(...) ::BinaryNinja::ApiProfile::Instrument<76>(::BNLoggerGetSessionId)(__VA_ARGS__)
+#define BNLogCreateLogger(...) ::BinaryNinja::ApiProfile::Instrument<77>(::BNLogCreateLogger)(__VA_ARGS__)
+#define BNLogGetLogger(...) ::BinaryNinja::ApiProfile::Instrument<78>(::BNLogGetLogger)(__VA_ARGS__)
+#define BNLogGetLoggerNames(...) ::BinaryNinja::ApiProfile::Instrument<79>(::BNLogGetLoggerNames)(__VA_ARGS__)
+#define BNLogRegisterLoggerCallback(...) ::BinaryNinja::ApiProfile::Instrument<80>(::BNLogRegisterLoggerCallback)(__VA_ARGS__)
+#define BNRegisterLogListener(...) ::BinaryNinja::ApiProfile::Instrument<81>(::BNRegisterLogListener)(__VA_ARGS__)
+#define BNUnregisterLogListener(...) ::BinaryNinja::ApiProfile::Instrument<82>(::BNUnregisterLogListener)(__VA_ARGS__)
+#define BNUpdateLogListeners(...) ::BinaryNinja::ApiProfile::Instrument<83>(::BNUpdateLogListeners)(__VA_ARGS__)
+#define BNLogToStdout(...) ::BinaryNinja::ApiProfile::Instrument<84>(::BNLogToStdout)(__VA_ARGS__)
+#define BNLogToStderr(...) ::BinaryNinja::ApiProfile::Instrument<85>(::BNLogToStderr)(__VA_ARGS__)
+#define BNLogToFile(...) ::BinaryNinja::ApiProfile::Instrument<86>(::BNLogToFile)(__VA_ARGS__)
+#define BNCloseLogs(...) ::BinaryNinja::ApiProfile::Instrument<87>(::BNCloseLogs)(__VA_ARGS__)
+#define BNCreateTemporaryFile(...) ::BinaryNinja::ApiProfile::Instrument<88>(::BNCreateTemporaryFile)(__VA_ARGS__)
+#define BNCreateTemporaryFileWithContents(...) ::BinaryNinja::ApiProfile::Instrument<89>(::BNCreateTemporaryFileWithContents)(__VA_ARGS__)
+#define BNNewTemporaryFileReference(...) ::BinaryNinja::ApiProfile::Instrument<90>(::BNNewTemporaryFileReference)(__VA_ARGS__)
+#define BNFreeTemporaryFile(...) ::BinaryNinja::ApiProfile::Instrument<91>(::BNFreeTemporaryFile)(__VA_ARGS__)
+#define BNGetTemporaryFilePath(...) ::BinaryNinja::ApiProfile::Instrument<92>(::BNGetTemporaryFilePath)(__VA_ARGS__)
+#define BNGetTemporaryFileContents(...) ::BinaryNinja::ApiProfile::Instrument<93>(::BNGetTemporaryFileContents)(__VA_ARGS__)
+#define BNCreateDataBuffer(...) ::BinaryNinja::ApiProfile::Instrument<94>(::BNCreateDataBuffer)(__VA_ARGS__)
+#define BNDuplicateDataBuffer(...) ::BinaryNinja::ApiProfile::Instrument<95>(::BNDuplicateDataBuffer)(__VA_ARGS__)
+#define BNFreeDataBuffer(...) ::BinaryNinja::ApiProfile::Instrument<96>(::BNFreeDataBuffer)(__VA_ARGS__)
+#define BNGetDataBufferContents(...) ::BinaryNinja::ApiProfile::Instrument<97>(::BNGetDataBufferContents)(__VA_ARGS__)
+#define BNGetDataBufferContentsAt(...) ::BinaryNinja::ApiProfile::Instrument<98>(::BNGetDataBufferContentsAt)(__VA_ARGS__)
+#define BNGetDataBufferLength(...) ::BinaryNinja::ApiProfile::Instrument<99>(::BNGetDataBufferLength)(__VA_ARGS__)
+#define BNGetDataBufferSlice(...) ::BinaryNinja::ApiProfile::Instrument<100>(::BNGetDataBufferSlice)(__VA_ARGS__)
+#define BNSetDataBufferLength(...) ::BinaryNinja::ApiProfile::Instrument<101>(::BNSetDataBufferLength)(__VA_ARGS__)
+#define BNClearDataBuffer(...) ::BinaryNinja::ApiProfile::Instrument<102>(::BNClearDataBuffer)(__VA_ARGS__)
+#define BNSetDataBufferContents(...) ::BinaryNinja::ApiProfile::Instrument<103>(::BNSetDataBufferContents)(__VA_ARGS__)
+#define BNAssignDataBuffer(...) ::BinaryNinja::ApiProfile::Instrument<104>(::BNAssignDataBuffer)(__VA_ARGS__)
+#define BNAppendDataBuffer(...) ::BinaryNinja::ApiProfile::Instrument<105>(::BNAppendDataBuffer)(__VA_ARGS__)
+#define BNAppendDataBufferContents(...) ::BinaryNinja::ApiProfile::Instrument<106>(::BNAppendDataBufferContents)(__VA_ARGS__)
+#define BNGetDataBufferByte(...) ::BinaryNinja::ApiProfile::Instrument<107>(::BNGetDataBufferByte)(__VA_ARGS__)
+#define BNSetDataBufferByte(...) ::BinaryNinja::ApiProfile::Instrument<108>(::BNSetDataBufferByte)(__VA_ARGS__)
+#define BNDataBufferToEscapedString(...) ::BinaryNinja::ApiProfile::Instrument<109>(::BNDataBufferToEscapedString)(__VA_ARGS__)
+#define BNDecodeEscapedString(...) ::BinaryNinja::ApiProfile::Instrument<110>(::BNDecodeEscapedString)(__VA_ARGS__)
+#define BNDataBufferToBase64(...) ::BinaryNinja::ApiProfile::Instrument<111>(::BNDataBufferToBase64)(__VA_ARGS__)
+#define BNDecodeBase64(...) ::BinaryNinja::ApiProfile::Instrument<112>(::BNDecodeBase64)(__VA_ARGS__)
+#define BNZlibCompress(...) ::BinaryNinja::ApiProfile::Instrument<113>(::BNZlibCompress)(__VA_ARGS__)
+#define BNZlibDecompress(...) ::BinaryNinja::ApiProfile::Instrument<114>(::BNZlibDecompress)(__VA_ARGS__)
+#define BNCreateSaveSettings(...) ::BinaryNinja::ApiProfile::Instrument<115>(::BNCreateSaveSettings)(__VA_ARGS__)
+#define BNNewSaveSettingsReference(...) ::BinaryNinja::ApiProfile::Instrument<116>(::BNNewSaveSettingsReference)(__VA_ARGS__)
+#define BNFreeSaveSettings(...) ::BinaryNinja::ApiProfile::Instrument<117>(::BNFreeSaveSettings)(__VA_ARGS__)
+#define BNIsSaveSettingsOptionSet(...) ::BinaryNinja::ApiProfile::Instrument<118>(::BNIsSaveSettingsOptionSet)(__VA_ARGS__)
+#define BNSetSaveSettingsOption(...) ::BinaryNinja::ApiProfile::Instrument<119>(::BNSetSaveSettingsOption)(__VA_ARGS__)
+#define BNGetSaveSettingsName(...) ::BinaryNinja::ApiProfile::Instrument<120>(::BNGetSaveSettingsName)(__VA_ARGS__)
+#define BNSetSaveSettingsName(...) ::BinaryNinja::ApiProfile::Instrument<121>(::BNSetSaveSettingsName)(__VA_ARGS__)
+#define BNCreateFileMetadata(...) ::BinaryNinja::ApiProfile::Instrument<122>(::BNCreateFileMetadata)(__VA_ARGS__)
+#define BNNewFileReference(...) ::BinaryNinja::ApiProfile::Instrument<123>(::BNNewFileReference)(__VA_ARGS__)
+#define BNFreeFileMetadata(...) ::BinaryNinja::ApiProfile::Instrument<124>(::BNFreeFileMetadata)(__VA_ARGS__)
+#define BNCloseFile(...) ::BinaryNinja::ApiProfile::Instrument<125>(::BNCloseFile)(__VA_ARGS__)
+#define BNSetFileMetadataNavigationHandler(...) ::BinaryNinja::ApiProfile::Instrument<126>(::BNSetFileMetadataNavigationHandler)(__VA_ARGS__)
+#define BNIsFileModified(...) ::BinaryNinja::ApiProfile::Instrument<127>(::BNIsFileModified)(__VA_ARGS__)
+#define BNIsAnalysisChanged(...) ::BinaryNinja::ApiProfile::Instrument<128>(::BNIsAnalysisChanged)(__VA_ARGS__)
+#define BNMarkFileModified(...) ::BinaryNinja::ApiProfile::Instrument<129>(::BNMarkFileModified)(__VA_ARGS__)
+#define BNMarkFileSaved(...) ::BinaryNinja::ApiProfile::Instrument<130>(::BNMarkFileSaved)(__VA_ARGS__)
+#define BNIsBackedByDatabase(...) ::BinaryNinja::ApiProfile::Instrument<131>(::BNIsBackedByDatabase)(__VA_ARGS__)
+#define BNCreateDatabase(...) ::BinaryNinja::ApiProfile::Instrument<132>(::BNCreateDatabase)(__VA_ARGS__)
+#define BNCreateDatabaseWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<133>(::BNCreateDatabaseWithProgress)(__VA_ARGS__)
+#define BNOpenExistingDatabase(...) ::BinaryNinja::ApiProfile::Instrument<134>(::BNOpenExistingDatabase)(__VA_ARGS__)
+#define BNOpenExistingDatabaseWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<135>(::BNOpenExistingDatabaseWithProgress)(__VA_ARGS__)
+#define BNOpenDatabaseForConfiguration(...) ::BinaryNinja::ApiProfile::Instrument<136>(::BNOpenDatabaseForConfiguration)(__VA_ARGS__)
+#define BNSaveAutoSnapshot(...) ::BinaryNinja::ApiProfile::Instrument<137>(::BNSaveAutoSnapshot)(__VA_ARGS__)
+#define BNSaveAutoSnapshotWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<138>(::BNSaveAutoSnapshotWithProgress)(__VA_ARGS__)
+#define BNGetSnapshotData(...) ::BinaryNinja::ApiProfile::Instrument<139>(::BNGetSnapshotData)(__VA_ARGS__)
+#define BNApplySnapshotData(...) ::BinaryNinja::ApiProfile::Instrument<140>(::BNApplySnapshotData)(__VA_ARGS__)
+#define BNGetFileMetadataDatabase(...) ::BinaryNinja::ApiProfile::Instrument<141>(::BNGetFileMetadataDatabase)(__VA_ARGS__)
+#define BNCreateKeyValueStore(...) ::BinaryNinja::ApiProfile::Instrument<142>(::BNCreateKeyValueStore)(__VA_ARGS__)
+#define BNCreateKeyValueStoreFromDataBuffer(...) ::BinaryNinja::ApiProfile::Instrument<143>(::BNCreateKeyValueStoreFromDataBuffer)(__VA_ARGS__)
+#define BNNewKeyValueStoreReference(...) ::BinaryNinja::ApiProfile::Instrument<144>(::BNNewKeyValueStoreReference)(__VA_ARGS__)
+#define BNFreeKeyValueStore(...) ::BinaryNinja::ApiProfile::Instrument<145>(::BNFreeKeyValueStore)(__VA_ARGS__)
+#define BNGetKeyValueStoreKeys(...) ::BinaryNinja::ApiProfile::Instrument<146>(::BNGetKeyValueStoreKeys)(__VA_ARGS__)
+#define BNKeyValueStoreHasValue(...) ::BinaryNinja::ApiProfile::Instrument<147>(::BNKeyValueStoreHasValue)(__VA_ARGS__)
+#define BNGetKeyValueStoreValue(...) ::BinaryNinja::ApiProfile::Instrument<148>(::BNGetKeyValueStoreValue)(__VA_ARGS__)
+#define BNGetKeyValueStoreValueHash(...) ::BinaryNinja::ApiProfile::Instrument<149>(::BNGetKeyValueStoreValueHash)(__VA_ARGS__)
+#define BNGetKeyValueStoreBuffer(...) ::BinaryNinja::ApiProfile::Instrument<150>(::BNGetKeyValueStoreBuffer)(__VA_ARGS__)
+#define BNSetKeyValueStoreValue(...) ::BinaryNinja::ApiProfile::Instrument<151>(::BNSetKeyValueStoreValue)(__VA_ARGS__)
+#define BNSetKeyValueStoreBuffer(...) ::BinaryNinja::ApiProfile::Instrument<152>(::BNSetKeyValueStoreBuffer)(__VA_ARGS__)
+#define BNGetKeyValueStoreSerializedData(...) ::BinaryNinja::ApiProfile::Instrument<153>(::BNGetKeyValueStoreSerializedData)(__VA_ARGS__)
+#define BNBeginKeyValueStoreNamespace(...) ::BinaryNinja::ApiProfile::Instrument<154>(::BNBeginKeyValueStoreNamespace)(__VA_ARGS__)
+#define BNEndKeyValueStoreNamespace(...) ::BinaryNinja::ApiProfile::Instrument<155>(::BNEndKeyValueStoreNamespace)(__VA_ARGS__)
+#define BNIsKeyValueStoreEmpty(...) ::BinaryNinja::ApiProfile::Instrument<156>(::BNIsKeyValueStoreEmpty)(__VA_ARGS__)
+#define BNGetKeyValueStoreValueSize(...) ::BinaryNinja::ApiProfile::Instrument<157>(::BNGetKeyValueStoreValueSize)(__VA_ARGS__)
+#define BNGetKeyValueStoreDataSize(...) ::BinaryNinja::ApiProfile::Instrument<158>(::BNGetKeyValueStoreDataSize)(__VA_ARGS__)
+#define BNGetKeyValueStoreValueStorageSize(...) ::BinaryNinja::ApiProfile::Instrument<159>(::BNGetKeyValueStoreValueStorageSize)(__VA_ARGS__)
+#define BNGetKeyValueStoreNamespaceSize(...) ::BinaryNinja::ApiProfile::Instrument<160>(::BNGetKeyValueStoreNamespaceSize)(__VA_ARGS__)
+#define BNNewDatabaseReference(...) ::BinaryNinja::ApiProfile::Instrument<161>(::BNNewDatabaseReference)(__VA_ARGS__)
+#define BNFreeDatabase(...) ::BinaryNinja::ApiProfile::Instrument<162>(::BNFreeDatabase)(__VA_ARGS__)
+#define BNSetDatabaseCurrentSnapshot(...) ::BinaryNinja::ApiProfile::Instrument<163>(::BNSetDatabaseCurrentSnapshot)(__VA_ARGS__)
+#define BNGetDatabaseCurrentSnapshot(...) ::BinaryNinja::ApiProfile::Instrument<164>(::BNGetDatabaseCurrentSnapshot)(__VA_ARGS__)
+#define BNGetDatabaseSnapshots(...) ::BinaryNinja::ApiProfile::Instrument<165>(::BNGetDatabaseSnapshots)(__VA_ARGS__)
+#define BNGetDatabaseSnapshot(...) ::BinaryNinja::ApiProfile::Instrument<166>(::BNGetDatabaseSnapshot)(__VA_ARGS__)
+#define BNWriteDatabaseSnapshotData(...) ::BinaryNinja::ApiProfile::Instrument<167>(::BNWriteDatabaseSnapshotData)(__VA_ARGS__)
+#define BNTrimDatabaseSnapshot(...) ::BinaryNinja::ApiProfile::Instrument<168>(::BNTrimDatabaseSnapshot)(__VA_ARGS__)
+#define BNRemoveDatabaseSnapshot(...) ::BinaryNinja::ApiProfile::Instrument<169>(::BNRemoveDatabaseSnapshot)(__VA_ARGS__)
+#define BNGetDatabaseGlobalKeys(...) ::BinaryNinja::ApiProfile::Instrument<170>(::BNGetDatabaseGlobalKeys)(__VA_ARGS__)
+#define BNDatabaseHasGlobal(...) ::BinaryNinja::ApiProfile::Instrument<171>(::BNDatabaseHasGlobal)(__VA_ARGS__)
+#define BNReadDatabaseGlobal(...) ::BinaryNinja::ApiProfile::Instrument<172>(::BNReadDatabaseGlobal)(__VA_ARGS__)
+#define BNWriteDatabaseGlobal(...) ::BinaryNinja::ApiProfile::Instrument<173>(::BNWriteDatabaseGlobal)(__VA_ARGS__)
+#define BNReadDatabaseGlobalData(...) ::BinaryNinja::ApiProfile::Instrument<174>(::BNReadDatabaseGlobalData)(__VA_ARGS__)
+#define BNWriteDatabaseGlobalData(...) ::BinaryNinja::ApiProfile::Instrument<175>(::BNWriteDatabaseGlobalData)(__VA_ARGS__)
+#define BNGetDatabaseFile(...) ::BinaryNinja::ApiProfile::Instrument<176>(::BNGetDatabaseFile)(__VA_ARGS__)
+#define BNReadDatabaseAnalysisCache(...) ::BinaryNinja::ApiProfile::Instrument<177>(::BNReadDatabaseAnalysisCache)(__VA_ARGS__)
+#define BNWriteDatabaseAnalysisCache(...) ::BinaryNinja::ApiProfile::Instrument<178>(::BNWriteDatabaseAnalysisCache)(__VA_ARGS__)
+#define BNSnapshotHasData(...) ::BinaryNinja::ApiProfile::Instrument<179>(::BNSnapshotHasData)(__VA_ARGS__)
+#define BNNewSnapshotReference(...) ::BinaryNinja::ApiProfile::Instrument<180>(::BNNewSnapshotReference)(__VA_ARGS__)
+#define BNFreeSnapshot(...) ::BinaryNinja::ApiProfile::Instrument<181>(::BNFreeSnapshot)(__VA_ARGS__)
+#define BNFreeSnapshotList(...) ::BinaryNinja::ApiProfile::Instrument<182>(::BNFreeSnapshotList)(__VA_ARGS__)
+#define BNGetSnapshotDatabase(...) ::BinaryNinja::ApiProfile::Instrument<183>(::BNGetSnapshotDatabase)(__VA_ARGS__)
+#define BNGetSnapshotId(...) ::BinaryNinja::ApiProfile::Instrument<184>(::BNGetSnapshotId)(__VA_ARGS__)
+#define BNGetSnapshotFirstParent(...) ::BinaryNinja::ApiProfile::Instrument<185>(::BNGetSnapshotFirstParent)(__VA_ARGS__)
+#define BNGetSnapshotParents(...) ::BinaryNinja::ApiProfile::Instrument<186>(::BNGetSnapshotParents)(__VA_ARGS__)
+#define BNGetSnapshotChildren(...) ::BinaryNinja::ApiProfile::Instrument<187>(::BNGetSnapshotChildren)(__VA_ARGS__)
+#define BNGetSnapshotName(...) ::BinaryNinja::ApiProfile::Instrument<188>(::BNGetSnapshotName)(__VA_ARGS__)
+#define BNSetSnapshotName(...) ::BinaryNinja::ApiProfile::Instrument<189>(::BNSetSnapshotName)(__VA_ARGS__)
+#define BNIsSnapshotAutoSave(...) ::BinaryNinja::ApiProfile::Instrument<190>(::BNIsSnapshotAutoSave)(__VA_ARGS__)
+#define BNSnapshotHasContents(...) ::BinaryNinja::ApiProfile::Instrument<191>(::BNSnapshotHasContents)(__VA_ARGS__)
+#define BNSnapshotHasUndo(...) ::BinaryNinja::ApiProfile::Instrument<192>(::BNSnapshotHasUndo)(__VA_ARGS__)
+#define BNGetSnapshotFileContents(...) ::BinaryNinja::ApiProfile::Instrument<193>(::BNGetSnapshotFileContents)(__VA_ARGS__)
+#define BNGetSnapshotFileContentsHash(...) ::BinaryNinja::ApiProfile::Instrument<194>(::BNGetSnapshotFileContentsHash)(__VA_ARGS__)
+#define BNReadSnapshotData(...) ::BinaryNinja::ApiProfile::Instrument<195>(::BNReadSnapshotData)(__VA_ARGS__)
+#define BNReadSnapshotDataWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<196>(::BNReadSnapshotDataWithProgress)(__VA_ARGS__)
+#define BNGetSnapshotUndoData(...) ::BinaryNinja::ApiProfile::Instrument<197>(::BNGetSnapshotUndoData)(__VA_ARGS__)
+#define BNGetSnapshotUndoEntries(...) ::BinaryNinja::ApiProfile::Instrument<198>(::BNGetSnapshotUndoEntries)(__VA_ARGS__)
+#define BNGetSnapshotUndoEntriesWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<199>(::BNGetSnapshotUndoEntriesWithProgress)(__VA_ARGS__)
+#define BNSnapshotHasAncestor(...) ::BinaryNinja::ApiProfile::Instrument<200>(::BNSnapshotHasAncestor)(__VA_ARGS__)
+#define BNSnapshotStoreData(...) ::BinaryNinja::ApiProfile::Instrument<201>(::BNSnapshotStoreData)(__VA_ARGS__)
+#define BNRebase(...) ::BinaryNinja::ApiProfile::Instrument<202>(::BNRebase)(__VA_ARGS__)
+#define BNRebaseWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<203>(::BNRebaseWithProgress)(__VA_ARGS__)
+#define BNCreateSnapshotedView(...) ::BinaryNinja::ApiProfile::Instrument<204>(::BNCreateSnapshotedView)(__VA_ARGS__)
+#define BNCreateSnapshotedViewWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<205>(::BNCreateSnapshotedViewWithProgress)(__VA_ARGS__)
+#define BNGetOriginalFilename(...) ::BinaryNinja::ApiProfile::Instrument<206>(::BNGetOriginalFilename)(__VA_ARGS__)
+#define BNSetOriginalFilename(...) ::BinaryNinja::ApiProfile::Instrument<207>(::BNSetOriginalFilename)(__VA_ARGS__)
+#define BNGetFilename(...) ::BinaryNinja::ApiProfile::Instrument<208>(::BNGetFilename)(__VA_ARGS__)
+#define BNSetFilename(...) ::BinaryNinja::ApiProfile::Instrument<209>(::BNSetFilename)(__VA_ARGS__)
+#define BNBeginUndoActions(...) ::BinaryNinja::ApiProfile::Instrument<210>(::BNBeginUndoActions)(__VA_ARGS__)
+#define BNCommitUndoActions(...) ::BinaryNinja::ApiProfile::Instrument<211>(::BNCommitUndoActions)(__VA_ARGS__)
+#define BNRevertUndoActions(...) ::BinaryNinja::ApiProfile::Instrument<212>(::BNRevertUndoActions)(__VA_ARGS__)
+#define BNCanUndo(...) ::BinaryNinja::ApiProfile::Instrument<213>(::BNCanUndo)(__VA_ARGS__)
+#define BNUndo(...) ::BinaryNinja::ApiProfile::Instrument<214>(::BNUndo)(__VA_ARGS__)
+#define BNCanRedo(...) ::BinaryNinja::ApiProfile::Instrument<215>(::BNCanRedo)(__VA_ARGS__)
+#define BNRedo(...) ::BinaryNinja::ApiProfile::Instrument<216>(::BNRedo)(__VA_ARGS__)
+#define BNGetUndoEntries(...) ::BinaryNinja::ApiProfile::Instrument<217>(::BNGetUndoEntries)(__VA_ARGS__)
+#define BNGetRedoEntries(...) ::BinaryNinja::ApiProfile::Instrument<218>(::BNGetRedoEntries)(__VA_ARGS__)
+#define BNGetLastUndoEntry(...) ::BinaryNinja::ApiProfile::Instrument<219>(::BNGetLastUndoEntry)(__VA_ARGS__)
+#define BNGetLastRedoEntry(...) ::BinaryNinja::ApiProfile::Instrument<220>(::BNGetLastRedoEntry)(__VA_ARGS__)
+#define BNGetLastUndoEntryTitle(...) ::BinaryNinja::ApiProfile::Instrument<221>(::BNGetLastUndoEntryTitle)(__VA_ARGS__)
+#define BNGetLastRedoEntryTitle(...) ::BinaryNinja::ApiProfile::Instrument<222>(::BNGetLastRedoEntryTitle)(__VA_ARGS__)
+#define BNFreeUndoEntries(...) ::BinaryNinja::ApiProfile::Instrument<223>(::BNFreeUndoEntries)(__VA_ARGS__)
+#define BNClearUndoEntries(...) ::BinaryNinja::ApiProfile::Instrument<224>(::BNClearUndoEntries)(__VA_ARGS__)
+#define BNNewUserReference(...) ::BinaryNinja::ApiProfile::Instrument<225>(::BNNewUserReference)(__VA_ARGS__)
+#define BNFreeUser(...) ::BinaryNinja::ApiProfile::Instrument<226>(::BNFreeUser)(__VA_ARGS__)
+#define BNGetUsers(...) ::BinaryNinja::ApiProfile::Instrument<227>(::BNGetUsers)(__VA_ARGS__)
+#define BNFreeUserList(...) ::BinaryNinja::ApiProfile::Instrument<228>(::BNFreeUserList)(__VA_ARGS__)
+#define BNGetUserName(...) ::BinaryNinja::ApiProfile::Instrument<229>(::BNGetUserName)(__VA_ARGS__)
+#define BNGetUserEmail(...) ::BinaryNinja::ApiProfile::Instrument<230>(::BNGetUserEmail)(__VA_ARGS__)
+#define BNGetUserId(...) ::BinaryNinja::ApiProfile::Instrument<231>(::BNGetUserId)(__VA_ARGS__)
+#define BNOpenProject(...) ::BinaryNinja::ApiProfile::Instrument<232>(::BNOpenProject)(__VA_ARGS__)
+#define BNCloseProject(...) ::BinaryNinja::ApiProfile::Instrument<233>(::BNCloseProject)(__VA_ARGS__)
+#define BNIsProjectOpen(...) ::BinaryNinja::ApiProfile::Instrument<234>(::BNIsProjectOpen)(__VA_ARGS__)
+#define BNGetCurrentView(...) ::BinaryNinja::ApiProfile::Instrument<235>(::BNGetCurrentView)(__VA_ARGS__)
+#define BNGetCurrentOffset(...) ::BinaryNinja::ApiProfile::Instrument<236>(::BNGetCurrentOffset)(__VA_ARGS__)
+#define BNNavigate(...) ::BinaryNinja::ApiProfile::Instrument<237>(::BNNavigate)(__VA_ARGS__)
+#define BNGetFileViewOfType(...) ::BinaryNinja::ApiProfile::Instrument<238>(::BNGetFileViewOfType)(__VA_ARGS__)
+#define BNGetExistingViews(...) ::BinaryNinja::ApiProfile::Instrument<239>(::BNGetExistingViews)(__VA_ARGS__)
+#define BNFileMetadataGetSessionId(...) ::BinaryNinja::ApiProfile::Instrument<240>(::BNFileMetadataGetSessionId)(__VA_ARGS__)
+#define BNIsSnapshotDataAppliedWithoutError(...) ::BinaryNinja::ApiProfile::Instrument<241>(::BNIsSnapshotDataAppliedWithoutError)(__VA_ARGS__)
+#define BNUnregisterViewOfType(...) ::BinaryNinja::ApiProfile::Instrument<242>(::BNUnregisterViewOfType)(__VA_ARGS__)
+#define BNNewViewReference(...) ::BinaryNinja::ApiProfile::Instrument<243>(::BNNewViewReference)(__VA_ARGS__)
+#define BNFreeBinaryView(...) ::BinaryNinja::ApiProfile::Instrument<244>(::BNFreeBinaryView)(__VA_ARGS__)
+#define BNGetFileForView(...) ::BinaryNinja::ApiProfile::Instrument<245>(::BNGetFileForView)(__VA_ARGS__)
+#define BNGetViewType(...) ::BinaryNinja::ApiProfile::Instrument<246>(::BNGetViewType)(__VA_ARGS__)
+#define BNGetParentView(...) ::BinaryNinja::ApiProfile::Instrument<247>(::BNGetParentView)(__VA_ARGS__)
+#define BNReadViewData(...) ::BinaryNinja::ApiProfile::Instrument<248>(::BNReadViewData)(__VA_ARGS__)
+#define BNReadViewBuffer(...) ::BinaryNinja::ApiProfile::Instrument<249>(::BNReadViewBuffer)(__VA_ARGS__)
+#define BNWriteViewData(...) ::BinaryNinja::ApiProfile::Instrument<250>(::BNWriteViewData)(__VA_ARGS__)
+#define BNWriteViewBuffer(...) ::BinaryNinja::ApiProfile::Instrument<251>(::BNWriteViewBuffer)(__VA_ARGS__)
+#define BNInsertViewData(...) ::BinaryNinja::ApiProfile::Instrument<252>(::BNInsertViewData)(__VA_ARGS__)
+#define BNInsertViewBuffer(...) ::BinaryNinja::ApiProfile::Instrument<253>(::BNInsertViewBuffer)(__VA_ARGS__)
+#define BNRemoveViewData(...) ::BinaryNinja::ApiProfile::Instrument<254>(::BNRemoveViewData)(__VA_ARGS__)
+#define BNNotifyDataWritten(...) ::BinaryNinja::ApiProfile::Instrument<255>(::BNNotifyDataWritten)(__VA_ARGS__)
+#define BNNotifyDataInserted(...) ::BinaryNinja::ApiProfile::Instrument<256>(::BNNotifyDataInserted)(__VA_ARGS__)
+#define BNNotifyDataRemoved(...) ::BinaryNinja::ApiProfile::Instrument<257>(::BNNotifyDataRemoved)(__VA_ARGS__)
+#define BNGetEntropy(...) ::BinaryNinja::ApiProfile::Instrument<258>(::BNGetEntropy)(__VA_ARGS__)
+#define BNGetModification(...) ::BinaryNinja::ApiProfile::Instrument<259>(::BNGetModification)(__VA_ARGS__)
+#define BNGetModificationArray(...) ::BinaryNinja::ApiProfile::Instrument<260>(::BNGetModificationArray)(__VA_ARGS__)
+#define BNIsValidOffset(...) ::BinaryNinja::ApiProfile::Instrument<261>(::BNIsValidOffset)(__VA_ARGS__)
+#define BNIsOffsetReadable(...) ::BinaryNinja::ApiProfile::Instrument<262>(::BNIsOffsetReadable)(__VA_ARGS__)
+#define BNIsOffsetWritable(...) ::BinaryNinja::ApiProfile::Instrument<263>(::BNIsOffsetWritable)(__VA_ARGS__)
+#define BNIsOffsetExecutable(...) ::BinaryNinja::ApiProfile::Instrument<264>(::BNIsOffsetExecutable)(__VA_ARGS__)
+#define BNIsOffsetBackedByFile(...) ::BinaryNinja::ApiProfile::Instrument<265>(::BNIsOffsetBackedByFile)(__VA_ARGS__)
+#define BNIsOffsetCodeSemantics(...) ::BinaryNinja::ApiProfile::Instrument<266>(::BNIsOffsetCodeSemantics)(__VA_ARGS__)
+#define BNIsOffsetExternSemantics(...) ::BinaryNinja::ApiProfile::Instrument<267>(::BNIsOffsetExternSemantics)(__VA_ARGS__)
+#define BNIsOffsetWritableSemantics(...) ::BinaryNinja::ApiProfile::Instrument<268>(::BNIsOffsetWritableSemantics)(__VA_ARGS__)
+#define BNGetNextValidOffset(...) ::BinaryNinja::ApiProfile::Instrument<269>(::BNGetNextValidOffset)(__VA_ARGS__)
+#define BNGetStartOffset(...) ::BinaryNinja::ApiProfile::Instrument<270>(::BNGetStartOffset)(__VA_ARGS__)
+#define BNGetEndOffset(...) ::BinaryNinja::ApiProfile::Instrument<271>(::BNGetEndOffset)(__VA_ARGS__)
+#define BNGetViewLength(...) ::BinaryNinja::ApiProfile::Instrument<272>(::BNGetViewLength)(__VA_ARGS__)
+#define BNGetEntryPoint(...) ::BinaryNinja::ApiProfile::Instrument<273>(::BNGetEntryPoint)(__VA_ARGS__)
+#define BNGetDefaultArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<274>(::BNGetDefaultArchitecture)(__VA_ARGS__)
+#define BNSetDefaultArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<275>(::BNSetDefaultArchitecture)(__VA_ARGS__)
+#define BNGetDefaultPlatform(...) ::BinaryNinja::ApiProfile::Instrument<276>(::BNGetDefaultPlatform)(__VA_ARGS__)
+#define BNSetDefaultPlatform(...) ::BinaryNinja::ApiProfile::Instrument<277>(::BNSetDefaultPlatform)(__VA_ARGS__)
+#define BNGetDefaultEndianness(...) ::BinaryNinja::ApiProfile::Instrument<278>(::BNGetDefaultEndianness)(__VA_ARGS__)
+#define BNIsRelocatable(...) ::BinaryNinja::ApiProfile::Instrument<279>(::BNIsRelocatable)(__VA_ARGS__)
+#define BNGetViewAddressSize(...) ::BinaryNinja::ApiProfile::Instrument<280>(::BNGetViewAddressSize)(__VA_ARGS__)
+#define BNIsViewModified(...) ::BinaryNinja::ApiProfile::Instrument<281>(::BNIsViewModified)(__VA_ARGS__)
+#define BNIsExecutableView(...) ::BinaryNinja::ApiProfile::Instrument<282>(::BNIsExecutableView)(__VA_ARGS__)
+#define BNSaveToFile(...) ::BinaryNinja::ApiProfile::Instrument<283>(::BNSaveToFile)(__VA_ARGS__)
+#define BNSaveToFilename(...) ::BinaryNinja::ApiProfile::Instrument<284>(::BNSaveToFilename)(__VA_ARGS__)
+#define BNDefineRelocation(...) ::BinaryNinja::ApiProfile::Instrument<285>(::BNDefineRelocation)(__VA_ARGS__)
+#define BNDefineSymbolRelocation(...) ::BinaryNinja::ApiProfile::Instrument<286>(::BNDefineSymbolRelocation)(__VA_ARGS__)
+#define BNGetRelocationRanges(...) ::BinaryNinja::ApiProfile::Instrument<287>(::BNGetRelocationRanges)(__VA_ARGS__)
+#define BNGetRelocationRangesAtAddress(...) ::BinaryNinja::ApiProfile::Instrument<288>(::BNGetRelocationRangesAtAddress)(__VA_ARGS__)
+#define BNRangeContainsRelocation(...) ::BinaryNinja::ApiProfile::Instrument<289>(::BNRangeContainsRelocation)(__VA_ARGS__)
+#define BNRegisterDataNotification(...) ::BinaryNinja::ApiProfile::Instrument<290>(::BNRegisterDataNotification)(__VA_ARGS__)
+#define BNUnregisterDataNotification(...) ::BinaryNinja::ApiProfile::Instrument<291>(::BNUnregisterDataNotification)(__VA_ARGS__)
+#define BNCanAssemble(...) ::BinaryNinja::ApiProfile::Instrument<292>(::BNCanAssemble)(__VA_ARGS__)
+#define BNIsNeverBranchPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<293>(::BNIsNeverBranchPatchAvailable)(__VA_ARGS__)
+#define BNIsAlwaysBranchPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<294>(::BNIsAlwaysBranchPatchAvailable)(__VA_ARGS__)
+#define BNIsInvertBranchPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<295>(::BNIsInvertBranchPatchAvailable)(__VA_ARGS__)
+#define BNIsSkipAndReturnZeroPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<296>(::BNIsSkipAndReturnZeroPatchAvailable)(__VA_ARGS__)
+#define BNIsSkipAndReturnValuePatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<297>(::BNIsSkipAndReturnValuePatchAvailable)(__VA_ARGS__)
+#define BNConvertToNop(...) ::BinaryNinja::ApiProfile::Instrument<298>(::BNConvertToNop)(__VA_ARGS__)
+#define BNAlwaysBranch(...) ::BinaryNinja::ApiProfile::Instrument<299>(::BNAlwaysBranch)(__VA_ARGS__)
+#define BNInvertBranch(...) ::BinaryNinja::ApiProfile::Instrument<300>(::BNInvertBranch)(__VA_ARGS__)
+#define BNSkipAndReturnValue(...) ::BinaryNinja::ApiProfile::Instrument<301>(::BNSkipAndReturnValue)(__VA_ARGS__)
+#define BNGetInstructionLength(...) ::BinaryNinja::ApiProfile::Instrument<302>(::BNGetInstructionLength)(__VA_ARGS__)
+#define BNFindNextData(...) ::BinaryNinja::ApiProfile::Instrument<303>(::BNFindNextData)(__VA_ARGS__)
+#define BNFindNextText(...) ::BinaryNinja::ApiProfile::Instrument<304>(::BNFindNextText)(__VA_ARGS__)
+#define BNFindNextConstant(...) ::BinaryNinja::ApiProfile::Instrument<305>(::BNFindNextConstant)(__VA_ARGS__)
+#define BNFindNextDataWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<306>(::BNFindNextDataWithProgress)(__VA_ARGS__)
+#define BNFindNextTextWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<307>(::BNFindNextTextWithProgress)(__VA_ARGS__)
+#define BNFindNextConstantWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<308>(::BNFindNextConstantWithProgress)(__VA_ARGS__)
+#define BNFindAllDataWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<309>(::BNFindAllDataWithProgress)(__VA_ARGS__)
+#define BNFindAllTextWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<310>(::BNFindAllTextWithProgress)(__VA_ARGS__)
+#define BNFindAllConstantWithProgress(...) ::BinaryNinja::ApiProfile::Instrument<311>(::BNFindAllConstantWithProgress)(__VA_ARGS__)
+#define BNAddAutoSegment(...) ::BinaryNinja::ApiProfile::Instrument<312>(::BNAddAutoSegment)(__VA_ARGS__)
+#define BNRemoveAutoSegment(...) ::BinaryNinja::ApiProfile::Instrument<313>(::BNRemoveAutoSegment)(__VA_ARGS__)
+#define BNAddUserSegment(...) ::BinaryNinja::ApiProfile::Instrument<314>(::BNAddUserSegment)(__VA_ARGS__)
+#define BNRemoveUserSegment(...) ::BinaryNinja::ApiProfile::Instrument<315>(::BNRemoveUserSegment)(__VA_ARGS__)
+#define BNGetSegments(...) ::BinaryNinja::ApiProfile::Instrument<316>(::BNGetSegments)(__VA_ARGS__)
+#define BNFreeSegmentList(...) ::BinaryNinja::ApiProfile::Instrument<317>(::BNFreeSegmentList)(__VA_ARGS__)
+#define BNGetSegmentAt(...) ::BinaryNinja::ApiProfile::Instrument<318>(::BNGetSegmentAt)(__VA_ARGS__)
+#define BNGetAddressForDataOffset(...) ::BinaryNinja::ApiProfile::Instrument<319>(::BNGetAddressForDataOffset)(__VA_ARGS__)
+#define BNGetComponentByGuid(...) ::BinaryNinja::ApiProfile::Instrument<320>(::BNGetComponentByGuid)(__VA_ARGS__)
+#define BNGetRootComponent(...) ::BinaryNinja::ApiProfile::Instrument<321>(::BNGetRootComponent)(__VA_ARGS__)
+#define BNCreateComponent(...) ::BinaryNinja::ApiProfile::Instrument<322>(::BNCreateComponent)(__VA_ARGS__)
+#define BNCreateComponentWithParent(...) ::BinaryNinja::ApiProfile::Instrument<323>(::BNCreateComponentWithParent)(__VA_ARGS__)
+#define BNCreateComponentWithName(...) ::BinaryNinja::ApiProfile::Instrument<324>(::BNCreateComponentWithName)(__VA_ARGS__)
+#define BNCreateComponentWithParentAndName(...) ::BinaryNinja::ApiProfile::Instrument<325>(::BNCreateComponentWithParentAndName)(__VA_ARGS__)
+#define BNGetComponentByPath(...) ::BinaryNinja::ApiProfile::Instrument<326>(::BNGetComponentByPath)(__VA_ARGS__)
+#define BNRemoveComponent(...) ::BinaryNinja::ApiProfile::Instrument<327>(::BNRemoveComponent)(__VA_ARGS__)
+#define BNRemoveComponentByGuid(...) ::BinaryNinja::ApiProfile::Instrument<328>(::BNRemoveComponentByGuid)(__VA_ARGS__)
+#define BNAddAutoSection(...) ::BinaryNinja::ApiProfile::Instrument<329>(::BNAddAutoSection)(__VA_ARGS__)
+#define BNRemoveAutoSection(...) ::BinaryNinja::ApiProfile::Instrument<330>(::BNRemoveAutoSection)(__VA_ARGS__)
+#define BNAddUserSection(...) ::BinaryNinja::ApiProfile::Instrument<331>(::BNAddUserSection)(__VA_ARGS__)
+#define BNRemoveUserSection(...) ::BinaryNinja::ApiProfile::Instrument<332>(::BNRemoveUserSection)(__VA_ARGS__)
+#define BNGetSections(...) ::BinaryNinja::ApiProfile::Instrument<333>(::BNGetSections)(__VA_ARGS__)
+#define BNGetSectionsAt(...) ::BinaryNinja::ApiProfile::Instrument<334>(::BNGetSectionsAt)(__VA_ARGS__)
+#define BNFreeSectionList(...) ::BinaryNinja::ApiProfile::Instrument<335>(::BNFreeSectionList)(__VA_ARGS__)
+#define BNGetSectionByName(...) ::BinaryNinja::ApiProfile::Instrument<336>(::BNGetSectionByName)(__VA_ARGS__)
+#define BNGetUniqueSectionNames(...) ::BinaryNinja::ApiProfile::Instrument<337>(::BNGetUniqueSectionNames)(__VA_ARGS__)
+#define BNGetNameSpaces(...) ::BinaryNinja::ApiProfile::Instrument<338>(::BNGetNameSpaces)(__VA_ARGS__)
+#define BNFreeNameSpaceList(...) ::BinaryNinja::ApiProfile::Instrument<339>(::BNFreeNameSpaceList)(__VA_ARGS__)
+#define BNGetExternalNameSpace(...) ::BinaryNinja::ApiProfile::Instrument<340>(::BNGetExternalNameSpace)(__VA_ARGS__)
+#define BNGetInternalNameSpace(...) ::BinaryNinja::ApiProfile::Instrument<341>(::BNGetInternalNameSpace)(__VA_ARGS__)
+#define BNFreeNameSpace(...) ::BinaryNinja::ApiProfile::Instrument<342>(::BNFreeNameSpace)(__VA_ARGS__)
+#define BNGetAllocatedRanges(...) ::BinaryNinja::ApiProfile::Instrument<343>(::BNGetAllocatedRanges)(__VA_ARGS__)
+#define BNFreeAddressRanges(...) ::BinaryNinja::ApiProfile::Instrument<344>(::BNFreeAddressRanges)(__VA_ARGS__)
+#define BNGetGlobalPointerValue(...) ::BinaryNinja::ApiProfile::Instrument<345>(::BNGetGlobalPointerValue)(__VA_ARGS__)
+#define BNCreateBinaryDataView(...) ::BinaryNinja::ApiProfile::Instrument<346>(::BNCreateBinaryDataView)(__VA_ARGS__)
+#define BNCreateBinaryDataViewFromBuffer(...) ::BinaryNinja::ApiProfile::Instrument<347>(::BNCreateBinaryDataViewFromBuffer)(__VA_ARGS__)
+#define BNCreateBinaryDataViewFromData(...) ::BinaryNinja::ApiProfile::Instrument<348>(::BNCreateBinaryDataViewFromData)(__VA_ARGS__)
+#define BNCreateBinaryDataViewFromFilename(...) ::BinaryNinja::ApiProfile::Instrument<349>(::BNCreateBinaryDataViewFromFilename)(__VA_ARGS__)
+#define BNCreateBinaryDataViewFromFile(...) ::BinaryNinja::ApiProfile::Instrument<350>(::BNCreateBinaryDataViewFromFile)(__VA_ARGS__)
+#define BNCreateCustomBinaryView(...) ::BinaryNinja::ApiProfile::Instrument<351>(::BNCreateCustomBinaryView)(__VA_ARGS__)
+#define BNGetBinaryViewTypeByName(...) ::BinaryNinja::ApiProfile::Instrument<352>(::BNGetBinaryViewTypeByName)(__VA_ARGS__)
+#define BNGetBinaryViewTypes(...) ::BinaryNinja::ApiProfile::Instrument<353>(::BNGetBinaryViewTypes)(__VA_ARGS__)
+#define BNGetBinaryViewTypesForData(...) ::BinaryNinja::ApiProfile::Instrument<354>(::BNGetBinaryViewTypesForData)(__VA_ARGS__)
+#define BNFreeBinaryViewTypeList(...) ::BinaryNinja::ApiProfile::Instrument<355>(::BNFreeBinaryViewTypeList)(__VA_ARGS__)
+#define BNGetBinaryViewTypeName(...) ::BinaryNinja::ApiProfile::Instrument<356>(::BNGetBinaryViewTypeName)(__VA_ARGS__)
+#define BNGetBinaryViewTypeLongName(...) ::BinaryNinja::ApiProfile::Instrument<357>(::BNGetBinaryViewTypeLongName)(__VA_ARGS__)
+#define BNIsBinaryViewTypeDeprecated(...) ::BinaryNinja::ApiProfile::Instrument<358>(::BNIsBinaryViewTypeDeprecated)(__VA_ARGS__)
+#define BNCreateBinaryViewOfType(...) ::BinaryNinja::ApiProfile::Instrument<359>(::BNCreateBinaryViewOfType)(__VA_ARGS__)
+#define BNParseBinaryViewOfType(...) ::BinaryNinja::ApiProfile::Instrument<360>(::BNParseBinaryViewOfType)(__VA_ARGS__)
+#define BNIsBinaryViewTypeValidForData(...) ::BinaryNinja::ApiProfile::Instrument<361>(::BNIsBinaryViewTypeValidForData)(__VA_ARGS__)
+#define BNGetBinaryViewDefaultLoadSettingsForData(...) ::BinaryNinja::ApiProfile::Instrument<362>(::BNGetBinaryViewDefaultLoadSettingsForData)(__VA_ARGS__)
+#define BNGetBinaryViewLoadSettingsForData(...) ::BinaryNinja::ApiProfile::Instrument<363>(::BNGetBinaryViewLoadSettingsForData)(__VA_ARGS__)
+#define BNRegisterBinaryViewType(...) ::BinaryNinja::ApiProfile::Instrument<364>(::BNRegisterBinaryViewType)(__VA_ARGS__)
+#define BNRegisterArchitectureForViewType(...) ::BinaryNinja::ApiProfile::Instrument<365>(::BNRegisterArchitectureForViewType)(__VA_ARGS__)
+#define BNGetArchitectureForViewType(...) ::BinaryNinja::ApiProfile::Instrument<366>(::BNGetArchitectureForViewType)(__VA_ARGS__)
+#define BNRegisterPlatformForViewType(...) ::BinaryNinja::ApiProfile::Instrument<367>(::BNRegisterPlatformForViewType)(__VA_ARGS__)
+#define BNGetPlatformForViewType(...) ::BinaryNinja::ApiProfile::Instrument<368>(::BNGetPlatformForViewType)(__VA_ARGS__)
+#define BNRegisterDefaultPlatformForViewType(...) ::BinaryNinja::ApiProfile::Instrument<369>(::BNRegisterDefaultPlatformForViewType)(__VA_ARGS__)
+#define BNRegisterPlatformRecognizerForViewType(...) ::BinaryNinja::ApiProfile::Instrument<370>(::BNRegisterPlatformRecognizerForViewType)(__VA_ARGS__)
+#define BNRecognizePlatformForViewType(...) ::BinaryNinja::ApiProfile::Instrument<371>(::BNRecognizePlatformForViewType)(__VA_ARGS__)
+#define BNRegisterBinaryViewEvent(...) ::BinaryNinja::ApiProfile::Instrument<372>(::BNRegisterBinaryViewEvent)(__VA_ARGS__)
+#define BNCreateBinaryReader(...) ::BinaryNinja::ApiProfile::Instrument<373>(::BNCreateBinaryReader)(__VA_ARGS__)
+#define BNFreeBinaryReader(...) ::BinaryNinja::ApiProfile::Instrument<374>(::BNFreeBinaryReader)(__VA_ARGS__)
+#define BNGetBinaryReaderEndianness(...) ::BinaryNinja::ApiProfile::Instrument<375>(::BNGetBinaryReaderEndianness)(__VA_ARGS__)
+#define BNSetBinaryReaderEndianness(...) ::BinaryNinja::ApiProfile::Instrument<376>(::BNSetBinaryReaderEndianness)(__VA_ARGS__)
+#define BNReadData(...) ::BinaryNinja::ApiProfile::Instrument<377>(::BNReadData)(__VA_ARGS__)
+#define BNRead8(...) ::BinaryNinja::ApiProfile::Instrument<378>(::BNRead8)(__VA_ARGS__)
+#define BNRead16(...) ::BinaryNinja::ApiProfile::Instrument<379>(::BNRead16)(__VA_ARGS__)
+#define BNRead32(...) ::BinaryNinja::ApiProfile::Instrument<380>(::BNRead32)(__VA_ARGS__)
+#define BNRead64(...) ::BinaryNinja::ApiProfile::Instrument<381>(::BNRead64)(__VA_ARGS__)
+#define BNReadLE16(...) ::BinaryNinja::ApiProfile::Instrument<382>(::BNReadLE16)(__VA_ARGS__)
+#define BNReadLE32(...) ::BinaryNinja::ApiProfile::Instrument<383>(::BNReadLE32)(__VA_ARGS__)
+#define BNReadLE64(...) ::BinaryNinja::ApiProfile::Instrument<384>(::BNReadLE64)(__VA_ARGS__)
+#define BNReadBE16(...) ::BinaryNinja::ApiProfile::Instrument<385>(::BNReadBE16)(__VA_ARGS__)
+#define BNReadBE32(...) ::BinaryNinja::ApiProfile::Instrument<386>(::BNReadBE32)(__VA_ARGS__)
+#define BNReadBE64(...) ::BinaryNinja::ApiProfile::Instrument<387>(::BNReadBE64)(__VA_ARGS__)
+#define BNGetReaderPosition(...) ::BinaryNinja::ApiProfile::Instrument<388>(::BNGetReaderPosition)(__VA_ARGS__)
+#define BNSeekBinaryReader(...) ::BinaryNinja::ApiProfile::Instrument<389>(::BNSeekBinaryReader)(__VA_ARGS__)
+#define BNSeekBinaryReaderRelative(...) ::BinaryNinja::ApiProfile::Instrument<390>(::BNSeekBinaryReaderRelative)(__VA_ARGS__)
+#define BNGetBinaryReaderVirtualBase(...) ::BinaryNinja::ApiProfile::Instrument<391>(::BNGetBinaryReaderVirtualBase)(__VA_ARGS__)
+#define BNSetBinaryReaderVirtualBase(...) ::BinaryNinja::ApiProfile::Instrument<392>(::BNSetBinaryReaderVirtualBase)(__VA_ARGS__)
+#define BNIsEndOfFile(...) ::BinaryNinja::ApiProfile::Instrument<393>(::BNIsEndOfFile)(__VA_ARGS__)
+#define BNCreateBinaryWriter(...) ::BinaryNinja::ApiProfile::Instrument<394>(::BNCreateBinaryWriter)(__VA_ARGS__)
+#define BNFreeBinaryWriter(...) ::BinaryNinja::ApiProfile::Instrument<395>(::BNFreeBinaryWriter)(__VA_ARGS__)
+#define BNGetBinaryWriterEndianness(...) ::BinaryNinja::ApiProfile::Instrument<396>(::BNGetBinaryWriterEndianness)(__VA_ARGS__)
+#define BNSetBinaryWriterEndianness(...) ::BinaryNinja::ApiProfile::Instrument<397>(::BNSetBinaryWriterEndianness)(__VA_ARGS__)
+#define BNWriteData(...) ::BinaryNinja::ApiProfile::Instrument<398>(::BNWriteData)(__VA_ARGS__)
+#define BNWrite8(...) ::BinaryNinja::ApiProfile::Instrument<399>(::BNWrite8)(__VA_ARGS__)
+#define BNWrite16(...) ::BinaryNinja::ApiProfile::Instrument<400>(::BNWrite16)(__VA_ARGS__)
+#define BNWrite32(...) ::BinaryNinja::ApiProfile::Instrument<401>(::BNWrite32)(__VA_ARGS__)
+#define BNWrite64(...) ::BinaryNinja::ApiProfile::Instrument<402>(::BNWrite64)(__VA_ARGS__)
+#define BNWriteLE16(...) ::BinaryNinja::ApiProfile::Instrument<403>(::BNWriteLE16)(__VA_ARGS__)
+#define BNWriteLE32(...) ::BinaryNinja::ApiProfile::Instrument<404>(::BNWriteLE32)(__VA_ARGS__)
+#define BNWriteLE64(...) ::BinaryNinja::ApiProfile::Instrument<405>(::BNWriteLE64)(__VA_ARGS__)
+#define BNWriteBE16(...) ::BinaryNinja::ApiProfile::Instrument<406>(::BNWriteBE16)(__VA_ARGS__)
+#define BNWriteBE32(...) ::BinaryNinja::ApiProfile::Instrument<407>(::BNWriteBE32)(__VA_ARGS__)
+#define BNWriteBE64(...) ::BinaryNinja::ApiProfile::Instrument<408>(::BNWriteBE64)(__VA_ARGS__)
+#define BNGetWriterPosition(...) ::BinaryNinja::ApiProfile::Instrument<409>(::BNGetWriterPosition)(__VA_ARGS__)
+#define BNSeekBinaryWriter(...) ::BinaryNinja::ApiProfile::Instrument<410>(::BNSeekBinaryWriter)(__VA_ARGS__)
+#define BNSeekBinaryWriterRelative(...) ::BinaryNinja::ApiProfile::Instrument<411>(::BNSeekBinaryWriterRelative)(__VA_ARGS__)
+#define BNGetTransformByName(...) ::BinaryNinja::ApiProfile::Instrument<412>(::BNGetTransformByName)(__VA_ARGS__)
+#define BNGetTransformTypeList(...) ::BinaryNinja::ApiProfile::Instrument<413>(::BNGetTransformTypeList)(__VA_ARGS__)
+#define BNFreeTransformTypeList(...) ::BinaryNinja::ApiProfile::Instrument<414>(::BNFreeTransformTypeList)(__VA_ARGS__)
+#define BNRegisterTransformType(...) ::BinaryNinja::ApiProfile::Instrument<415>(::BNRegisterTransformType)(__VA_ARGS__)
+#define BNGetTransformType(...) ::BinaryNinja::ApiProfile::Instrument<416>(::BNGetTransformType)(__VA_ARGS__)
+#define BNGetTransformName(...) ::BinaryNinja::ApiProfile::Instrument<417>(::BNGetTransformName)(__VA_ARGS__)
+#define BNGetTransformLongName(...) ::BinaryNinja::ApiProfile::Instrument<418>(::BNGetTransformLongName)(__VA_ARGS__)
+#define BNGetTransformGroup(...) ::BinaryNinja::ApiProfile::Instrument<419>(::BNGetTransformGroup)(__VA_ARGS__)
+#define BNGetTransformParameterList(...) ::BinaryNinja::ApiProfile::Instrument<420>(::BNGetTransformParameterList)(__VA_ARGS__)
+#define BNFreeTransformParameterList(...) ::BinaryNinja::ApiProfile::Instrument<421>(::BNFreeTransformParameterList)(__VA_ARGS__)
+#define BNDecode(...) ::BinaryNinja::ApiProfile::Instrument<422>(::BNDecode)(__VA_ARGS__)
+#define BNEncode(...) ::BinaryNinja::ApiProfile::Instrument<423>(::BNEncode)(__VA_ARGS__)
+#define BNGetArchitectureByName(...) ::BinaryNinja::ApiProfile::Instrument<424>(::BNGetArchitectureByName)(__VA_ARGS__)
+#define BNGetArchitectureList(...) ::BinaryNinja::ApiProfile::Instrument<425>(::BNGetArchitectureList)(__VA_ARGS__)
+#define BNFreeArchitectureList(...) ::BinaryNinja::ApiProfile::Instrument<426>(::BNFreeArchitectureList)(__VA_ARGS__)
+#define BNRegisterArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<427>(::BNRegisterArchitecture)(__VA_ARGS__)
+#define BNRegisterArchitectureExtension(...) ::BinaryNinja::ApiProfile::Instrument<428>(::BNRegisterArchitectureExtension)(__VA_ARGS__)
+#define BNAddArchitectureRedirection(...) ::BinaryNinja::ApiProfile::Instrument<429>(::BNAddArchitectureRedirection)(__VA_ARGS__)
+#define BNRegisterArchitectureHook(...) ::BinaryNinja::ApiProfile::Instrument<430>(::BNRegisterArchitectureHook)(__VA_ARGS__)
+#define BNFinalizeArchitectureHook(...) ::BinaryNinja::ApiProfile::Instrument<431>(::BNFinalizeArchitectureHook)(__VA_ARGS__)
+#define BNGetNativeTypeParserArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<432>(::BNGetNativeTypeParserArchitecture)(__VA_ARGS__)
+#define BNGetArchitectureName(...) ::BinaryNinja::ApiProfile::Instrument<433>(::BNGetArchitectureName)(__VA_ARGS__)
+#define BNGetArchitectureEndianness(...) ::BinaryNinja::ApiProfile::Instrument<434>(::BNGetArchitectureEndianness)(__VA_ARGS__)
+#define BNGetArchitectureAddressSize(...) ::BinaryNinja::ApiProfile::Instrument<435>(::BNGetArchitectureAddressSize)(__VA_ARGS__)
+#define BNGetArchitectureDefaultIntegerSize(...) ::BinaryNinja::ApiProfile::Instrument<436>(::BNGetArchitectureDefaultIntegerSize)(__VA_ARGS__)
+#define BNGetArchitectureInstructionAlignment(...) ::BinaryNinja::ApiProfile::Instrument<437>(::BNGetArchitectureInstructionAlignment)(__VA_ARGS__)
+#define BNGetArchitectureMaxInstructionLength(...) ::BinaryNinja::ApiProfile::Instrument<438>(::BNGetArchitectureMaxInstructionLength)(__VA_ARGS__)
+#define BNGetArchitectureOpcodeDisplayLength(...) ::BinaryNinja::ApiProfile::Instrument<439>(::BNGetArchitectureOpcodeDisplayLength)(__VA_ARGS__)
+#define BNGetAssociatedArchitectureByAddress(...) ::BinaryNinja::ApiProfile::Instrument<440>(::BNGetAssociatedArchitectureByAddress)(__VA_ARGS__)
+#define BNGetInstructionInfo(...) ::BinaryNinja::ApiProfile::Instrument<441>(::BNGetInstructionInfo)(__VA_ARGS__)
+#define BNGetInstructionText(...) ::BinaryNinja::ApiProfile::Instrument<442>(::BNGetInstructionText)(__VA_ARGS__)
+#define BNGetInstructionLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<443>(::BNGetInstructionLowLevelIL)(__VA_ARGS__)
+#define BNFreeInstructionText(...) ::BinaryNinja::ApiProfile::Instrument<444>(::BNFreeInstructionText)(__VA_ARGS__)
+#define BNFreeInstructionTextLines(...) ::BinaryNinja::ApiProfile::Instrument<445>(::BNFreeInstructionTextLines)(__VA_ARGS__)
+#define BNGetArchitectureRegisterName(...) ::BinaryNinja::ApiProfile::Instrument<446>(::BNGetArchitectureRegisterName)(__VA_ARGS__)
+#define BNGetArchitectureFlagName(...) ::BinaryNinja::ApiProfile::Instrument<447>(::BNGetArchitectureFlagName)(__VA_ARGS__)
+#define BNGetArchitectureFlagWriteTypeName(...) ::BinaryNinja::ApiProfile::Instrument<448>(::BNGetArchitectureFlagWriteTypeName)(__VA_ARGS__)
+#define BNGetArchitectureSemanticFlagClassName(...) ::BinaryNinja::ApiProfile::Instrument<449>(::BNGetArchitectureSemanticFlagClassName)(__VA_ARGS__)
+#define BNGetArchitectureSemanticFlagGroupName(...) ::BinaryNinja::ApiProfile::Instrument<450>(::BNGetArchitectureSemanticFlagGroupName)(__VA_ARGS__)
+#define BNGetFullWidthArchitectureRegisters(...) ::BinaryNinja::ApiProfile::Instrument<451>(::BNGetFullWidthArchitectureRegisters)(__VA_ARGS__)
+#define BNGetAllArchitectureRegisters(...) ::BinaryNinja::ApiProfile::Instrument<452>(::BNGetAllArchitectureRegisters)(__VA_ARGS__)
+#define BNGetAllArchitectureFlags(...) ::BinaryNinja::ApiProfile::Instrument<453>(::BNGetAllArchitectureFlags)(__VA_ARGS__)
+#define BNGetAllArchitectureFlagWriteTypes(...) ::BinaryNinja::ApiProfile::Instrument<454>(::BNGetAllArchitectureFlagWriteTypes)(__VA_ARGS__)
+#define BNGetAllArchitectureSemanticFlagClasses(...) ::BinaryNinja::ApiProfile::Instrument<455>(::BNGetAllArchitectureSemanticFlagClasses)(__VA_ARGS__)
+#define BNGetAllArchitectureSemanticFlagGroups(...) ::BinaryNinja::ApiProfile::Instrument<456>(::BNGetAllArchitectureSemanticFlagGroups)(__VA_ARGS__)
+#define BNGetArchitectureFlagRole(...) ::BinaryNinja::ApiProfile::Instrument<457>(::BNGetArchitectureFlagRole)(__VA_ARGS__)
+#define BNGetArchitectureFlagsRequiredForFlagCondition(...) ::BinaryNinja::ApiProfile::Instrument<458>(::BNGetArchitectureFlagsRequiredForFlagCondition)(__VA_ARGS__)
+#define BNGetArchitectureFlagsRequiredForSemanticFlagGroup(...) ::BinaryNinja::ApiProfile::Instrument<459>(::BNGetArchitectureFlagsRequiredForSemanticFlagGroup)(__VA_ARGS__)
+#define BNGetArchitectureFlagConditionsForSemanticFlagGroup(...) ::BinaryNinja::ApiProfile::Instrument<460>(::BNGetArchitectureFlagConditionsForSemanticFlagGroup)(__VA_ARGS__)
+#define BNFreeFlagConditionsForSemanticFlagGroup(...) ::BinaryNinja::ApiProfile::Instrument<461>(::BNFreeFlagConditionsForSemanticFlagGroup)(__VA_ARGS__)
+#define BNGetArchitectureFlagsWrittenByFlagWriteType(...) ::BinaryNinja::ApiProfile::Instrument<462>(::BNGetArchitectureFlagsWrittenByFlagWriteType)(__VA_ARGS__)
+#define BNGetArchitectureSemanticClassForFlagWriteType(...) ::BinaryNinja::ApiProfile::Instrument<463>(::BNGetArchitectureSemanticClassForFlagWriteType)(__VA_ARGS__)
+#define BNGetArchitectureFlagWriteLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<464>(::BNGetArchitectureFlagWriteLowLevelIL)(__VA_ARGS__)
+#define BNGetDefaultArchitectureFlagWriteLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<465>(::BNGetDefaultArchitectureFlagWriteLowLevelIL)(__VA_ARGS__)
+#define BNGetArchitectureFlagConditionLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<466>(::BNGetArchitectureFlagConditionLowLevelIL)(__VA_ARGS__)
+#define BNGetDefaultArchitectureFlagConditionLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<467>(::BNGetDefaultArchitectureFlagConditionLowLevelIL)(__VA_ARGS__)
+#define BNGetArchitectureSemanticFlagGroupLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<468>(::BNGetArchitectureSemanticFlagGroupLowLevelIL)(__VA_ARGS__)
+#define BNGetModifiedArchitectureRegistersOnWrite(...) ::BinaryNinja::ApiProfile::Instrument<469>(::BNGetModifiedArchitectureRegistersOnWrite)(__VA_ARGS__)
+#define BNFreeRegisterList(...) ::BinaryNinja::ApiProfile::Instrument<470>(::BNFreeRegisterList)(__VA_ARGS__)
+#define BNGetArchitectureRegisterInfo(...) ::BinaryNinja::ApiProfile::Instrument<471>(::BNGetArchitectureRegisterInfo)(__VA_ARGS__)
+#define BNGetArchitectureStackPointerRegister(...) ::BinaryNinja::ApiProfile::Instrument<472>(::BNGetArchitectureStackPointerRegister)(__VA_ARGS__)
+#define BNGetArchitectureLinkRegister(...) ::BinaryNinja::ApiProfile::Instrument<473>(::BNGetArchitectureLinkRegister)(__VA_ARGS__)
+#define BNGetArchitectureGlobalRegisters(...) ::BinaryNinja::ApiProfile::Instrument<474>(::BNGetArchitectureGlobalRegisters)(__VA_ARGS__)
+#define BNIsArchitectureGlobalRegister(...) ::BinaryNinja::ApiProfile::Instrument<475>(::BNIsArchitectureGlobalRegister)(__VA_ARGS__)
+#define BNGetArchitectureSystemRegisters(...) ::BinaryNinja::ApiProfile::Instrument<476>(::BNGetArchitectureSystemRegisters)(__VA_ARGS__)
+#define BNIsArchitectureSystemRegister(...) ::BinaryNinja::ApiProfile::Instrument<477>(::BNIsArchitectureSystemRegister)(__VA_ARGS__)
+#define BNGetArchitectureRegisterByName(...) ::BinaryNinja::ApiProfile::Instrument<478>(::BNGetArchitectureRegisterByName)(__VA_ARGS__)
+#define BNGetArchitectureRegisterStackName(...) ::BinaryNinja::ApiProfile::Instrument<479>(::BNGetArchitectureRegisterStackName)(__VA_ARGS__)
+#define BNGetAllArchitectureRegisterStacks(...) ::BinaryNinja::ApiProfile::Instrument<480>(::BNGetAllArchitectureRegisterStacks)(__VA_ARGS__)
+#define BNGetArchitectureRegisterStackInfo(...) ::BinaryNinja::ApiProfile::Instrument<481>(::BNGetArchitectureRegisterStackInfo)(__VA_ARGS__)
+#define BNGetArchitectureRegisterStackForRegister(...) ::BinaryNinja::ApiProfile::Instrument<482>(::BNGetArchitectureRegisterStackForRegister)(__VA_ARGS__)
+#define BNGetArchitectureIntrinsicName(...) ::BinaryNinja::ApiProfile::Instrument<483>(::BNGetArchitectureIntrinsicName)(__VA_ARGS__)
+#define BNGetAllArchitectureIntrinsics(...) ::BinaryNinja::ApiProfile::Instrument<484>(::BNGetAllArchitectureIntrinsics)(__VA_ARGS__)
+#define BNGetArchitectureIntrinsicInputs(...) ::BinaryNinja::ApiProfile::Instrument<485>(::BNGetArchitectureIntrinsicInputs)(__VA_ARGS__)
+#define BNFreeNameAndTypeList(...) ::BinaryNinja::ApiProfile::Instrument<486>(::BNFreeNameAndTypeList)(__VA_ARGS__)
+#define BNGetArchitectureIntrinsicOutputs(...) ::BinaryNinja::ApiProfile::Instrument<487>(::BNGetArchitectureIntrinsicOutputs)(__VA_ARGS__)
+#define BNFreeOutputTypeList(...) ::BinaryNinja::ApiProfile::Instrument<488>(::BNFreeOutputTypeList)(__VA_ARGS__)
+#define BNCanArchitectureAssemble(...) ::BinaryNinja::ApiProfile::Instrument<489>(::BNCanArchitectureAssemble)(__VA_ARGS__)
+#define BNAssemble(...) ::BinaryNinja::ApiProfile::Instrument<490>(::BNAssemble)(__VA_ARGS__)
+#define BNIsArchitectureNeverBranchPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<491>(::BNIsArchitectureNeverBranchPatchAvailable)(__VA_ARGS__)
+#define BNIsArchitectureAlwaysBranchPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<492>(::BNIsArchitectureAlwaysBranchPatchAvailable)(__VA_ARGS__)
+#define BNIsArchitectureInvertBranchPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<493>(::BNIsArchitectureInvertBranchPatchAvailable)(__VA_ARGS__)
+#define BNIsArchitectureSkipAndReturnZeroPatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<494>(::BNIsArchitectureSkipAndReturnZeroPatchAvailable)(__VA_ARGS__)
+#define BNIsArchitectureSkipAndReturnValuePatchAvailable(...) ::BinaryNinja::ApiProfile::Instrument<495>(::BNIsArchitectureSkipAndReturnValuePatchAvailable)(__VA_ARGS__)
+#define BNArchitectureConvertToNop(...) ::BinaryNinja::ApiProfile::Instrument<496>(::BNArchitectureConvertToNop)(__VA_ARGS__)
+#define BNArchitectureAlwaysBranch(...) ::BinaryNinja::ApiProfile::Instrument<497>(::BNArchitectureAlwaysBranch)(__VA_ARGS__)
+#define BNArchitectureInvertBranch(...) ::BinaryNinja::ApiProfile::Instrument<498>(::BNArchitectureInvertBranch)(__VA_ARGS__)
+#define BNArchitectureSkipAndReturnValue(...) ::BinaryNinja::ApiProfile::Instrument<499>(::BNArchitectureSkipAndReturnValue)(__VA_ARGS__)
+#define BNRegisterArchitectureFunctionRecognizer(...) ::BinaryNinja::ApiProfile::Instrument<500>(::BNRegisterArchitectureFunctionRecognizer)(__VA_ARGS__)
+#define BNArchitectureRegisterRelocationHandler(...) ::BinaryNinja::ApiProfile::Instrument<501>(::BNArchitectureRegisterRelocationHandler)(__VA_ARGS__)
+#define BNCreateRelocationHandler(...) ::BinaryNinja::ApiProfile::Instrument<502>(::BNCreateRelocationHandler)(__VA_ARGS__)
+#define BNArchitectureGetRelocationHandler(...) ::BinaryNinja::ApiProfile::Instrument<503>(::BNArchitectureGetRelocationHandler)(__VA_ARGS__)
+#define BNNewRelocationHandlerReference(...) ::BinaryNinja::ApiProfile::Instrument<504>(::BNNewRelocationHandlerReference)(__VA_ARGS__)
+#define BNFreeRelocationHandler(...) ::BinaryNinja::ApiProfile::Instrument<505>(::BNFreeRelocationHandler)(__VA_ARGS__)
+#define BNRelocationHandlerGetRelocationInfo(...) ::BinaryNinja::ApiProfile::Instrument<506>(::BNRelocationHandlerGetRelocationInfo)(__VA_ARGS__)
+#define BNRelocationHandlerApplyRelocation(...) ::BinaryNinja::ApiProfile::Instrument<507>(::BNRelocationHandlerApplyRelocation)(__VA_ARGS__)
+#define BNRelocationHandlerDefaultApplyRelocation(...) ::BinaryNinja::ApiProfile::Instrument<508>(::BNRelocationHandlerDefaultApplyRelocation)(__VA_ARGS__)
+#define BNRelocationHandlerGetOperandForExternalRelocation(...) ::BinaryNinja::ApiProfile::Instrument<509>(::BNRelocationHandlerGetOperandForExternalRelocation)(__VA_ARGS__)
+#define BNAddAnalysisOption(...) ::BinaryNinja::ApiProfile::Instrument<510>(::BNAddAnalysisOption)(__VA_ARGS__)
+#define BNAddFunctionForAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<511>(::BNAddFunctionForAnalysis)(__VA_ARGS__)
+#define BNAddEntryPointForAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<512>(::BNAddEntryPointForAnalysis)(__VA_ARGS__)
+#define BNRemoveAnalysisFunction(...) ::BinaryNinja::ApiProfile::Instrument<513>(::BNRemoveAnalysisFunction)(__VA_ARGS__)
+#define BNCreateUserFunction(...) ::BinaryNinja::ApiProfile::Instrument<514>(::BNCreateUserFunction)(__VA_ARGS__)
+#define BNRemoveUserFunction(...) ::BinaryNinja::ApiProfile::Instrument<515>(::BNRemoveUserFunction)(__VA_ARGS__)
+#define BNHasInitialAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<516>(::BNHasInitialAnalysis)(__VA_ARGS__)
+#define BNSetAnalysisHold(...) ::BinaryNinja::ApiProfile::Instrument<517>(::BNSetAnalysisHold)(__VA_ARGS__)
+#define BNUpdateAnalysisAndWait(...) ::BinaryNinja::ApiProfile::Instrument<518>(::BNUpdateAnalysisAndWait)(__VA_ARGS__)
+#define BNUpdateAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<519>(::BNUpdateAnalysis)(__VA_ARGS__)
+#define BNAbortAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<520>(::BNAbortAnalysis)(__VA_ARGS__)
+#define BNIsFunctionUpdateNeeded(...) ::BinaryNinja::ApiProfile::Instrument<521>(::BNIsFunctionUpdateNeeded)(__VA_ARGS__)
+#define BNRequestAdvancedFunctionAnalysisData(...) ::BinaryNinja::ApiProfile::Instrument<522>(::BNRequestAdvancedFunctionAnalysisData)(__VA_ARGS__)
+#define BNReleaseAdvancedFunctionAnalysisData(...) ::BinaryNinja::ApiProfile::Instrument<523>(::BNReleaseAdvancedFunctionAnalysisData)(__VA_ARGS__)
+#define BNReleaseAdvancedFunctionAnalysisDataMultiple(...) ::BinaryNinja::ApiProfile::Instrument<524>(::BNReleaseAdvancedFunctionAnalysisDataMultiple)(__VA_ARGS__)
+#define BNNewFunctionReference(...) ::BinaryNinja::ApiProfile::Instrument<525>(::BNNewFunctionReference)(__VA_ARGS__)
+#define BNFreeFunction(...) ::BinaryNinja::ApiProfile::Instrument<526>(::BNFreeFunction)(__VA_ARGS__)
+#define BNGetAnalysisFunctionList(...) ::BinaryNinja::ApiProfile::Instrument<527>(::BNGetAnalysisFunctionList)(__VA_ARGS__)
+#define BNFreeFunctionList(...) ::BinaryNinja::ApiProfile::Instrument<528>(::BNFreeFunctionList)(__VA_ARGS__)
+#define BNHasFunctions(...) ::BinaryNinja::ApiProfile::Instrument<529>(::BNHasFunctions)(__VA_ARGS__)
+#define BNHasSymbols(...) ::BinaryNinja::ApiProfile::Instrument<530>(::BNHasSymbols)(__VA_ARGS__)
+#define BNHasDataVariables(...) ::BinaryNinja::ApiProfile::Instrument<531>(::BNHasDataVariables)(__VA_ARGS__)
+#define BNGetAnalysisFunction(...) ::BinaryNinja::ApiProfile::Instrument<532>(::BNGetAnalysisFunction)(__VA_ARGS__)
+#define BNGetRecentAnalysisFunctionForAddress(...) ::BinaryNinja::ApiProfile::Instrument<533>(::BNGetRecentAnalysisFunctionForAddress)(__VA_ARGS__)
+#define BNGetAnalysisFunctionsForAddress(...) ::BinaryNinja::ApiProfile::Instrument<534>(::BNGetAnalysisFunctionsForAddress)(__VA_ARGS__)
+#define BNGetAnalysisFunctionsContainingAddress(...) ::BinaryNinja::ApiProfile::Instrument<535>(::BNGetAnalysisFunctionsContainingAddress)(__VA_ARGS__)
+#define BNGetAnalysisEntryPoint(...) ::BinaryNinja::ApiProfile::Instrument<536>(::BNGetAnalysisEntryPoint)(__VA_ARGS__)
+#define BNGetGlobalCommentForAddress(...) ::BinaryNinja::ApiProfile::Instrument<537>(::BNGetGlobalCommentForAddress)(__VA_ARGS__)
+#define BNGetGlobalCommentedAddresses(...) ::BinaryNinja::ApiProfile::Instrument<538>(::BNGetGlobalCommentedAddresses)(__VA_ARGS__)
+#define BNSetGlobalCommentForAddress(...) ::BinaryNinja::ApiProfile::Instrument<539>(::BNSetGlobalCommentForAddress)(__VA_ARGS__)
+#define BNGetFunctionData(...) ::BinaryNinja::ApiProfile::Instrument<540>(::BNGetFunctionData)(__VA_ARGS__)
+#define BNGetFunctionArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<541>(::BNGetFunctionArchitecture)(__VA_ARGS__)
+#define BNGetFunctionPlatform(...) ::BinaryNinja::ApiProfile::Instrument<542>(::BNGetFunctionPlatform)(__VA_ARGS__)
+#define BNGetFunctionStart(...) ::BinaryNinja::ApiProfile::Instrument<543>(::BNGetFunctionStart)(__VA_ARGS__)
+#define BNGetFunctionSymbol(...) ::BinaryNinja::ApiProfile::Instrument<544>(::BNGetFunctionSymbol)(__VA_ARGS__)
+#define BNWasFunctionAutomaticallyDiscovered(...) ::BinaryNinja::ApiProfile::Instrument<545>(::BNWasFunctionAutomaticallyDiscovered)(__VA_ARGS__)
+#define BNFunctionHasUserAnnotations(...) ::BinaryNinja::ApiProfile::Instrument<546>(::BNFunctionHasUserAnnotations)(__VA_ARGS__)
+#define BNCanFunctionReturn(...) ::BinaryNinja::ApiProfile::Instrument<547>(::BNCanFunctionReturn)(__VA_ARGS__)
+#define BNIsFunctionPure(...) ::BinaryNinja::ApiProfile::Instrument<548>(::BNIsFunctionPure)(__VA_ARGS__)
+#define BNSetFunctionAutoType(...) ::BinaryNinja::ApiProfile::Instrument<549>(::BNSetFunctionAutoType)(__VA_ARGS__)
+#define BNSetFunctionUserType(...) ::BinaryNinja::ApiProfile::Instrument<550>(::BNSetFunctionUserType)(__VA_ARGS__)
+#define BNFunctionHasUserType(...) ::BinaryNinja::ApiProfile::Instrument<551>(::BNFunctionHasUserType)(__VA_ARGS__)
+#define BNGetFunctionComment(...) ::BinaryNinja::ApiProfile::Instrument<552>(::BNGetFunctionComment)(__VA_ARGS__)
+#define BNGetCommentForAddress(...) ::BinaryNinja::ApiProfile::Instrument<553>(::BNGetCommentForAddress)(__VA_ARGS__)
+#define BNGetCommentedAddresses(...) ::BinaryNinja::ApiProfile::Instrument<554>(::BNGetCommentedAddresses)(__VA_ARGS__)
+#define BNFreeAddressList(...) ::BinaryNinja::ApiProfile::Instrument<555>(::BNFreeAddressList)(__VA_ARGS__)
+#define BNSetFunctionComment(...) ::BinaryNinja::ApiProfile::Instrument<556>(::BNSetFunctionComment)(__VA_ARGS__)
+#define BNSetCommentForAddress(...) ::BinaryNinja::ApiProfile::Instrument<557>(::BNSetCommentForAddress)(__VA_ARGS__)
+#define BNAddUserCodeReference(...) ::BinaryNinja::ApiProfile::Instrument<558>(::BNAddUserCodeReference)(__VA_ARGS__)
+#define BNRemoveUserCodeReference(...) ::BinaryNinja::ApiProfile::Instrument<559>(::BNRemoveUserCodeReference)(__VA_ARGS__)
+#define BNAddUserTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<560>(::BNAddUserTypeReference)(__VA_ARGS__)
+#define BNRemoveUserTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<561>(::BNRemoveUserTypeReference)(__VA_ARGS__)
+#define BNAddUserTypeFieldReference(...) ::BinaryNinja::ApiProfile::Instrument<562>(::BNAddUserTypeFieldReference)(__VA_ARGS__)
+#define BNRemoveUserTypeFieldReference(...) ::BinaryNinja::ApiProfile::Instrument<563>(::BNRemoveUserTypeFieldReference)(__VA_ARGS__)
+#define BNNewBasicBlockReference(...) ::BinaryNinja::ApiProfile::Instrument<564>(::BNNewBasicBlockReference)(__VA_ARGS__)
+#define BNFreeBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<565>(::BNFreeBasicBlock)(__VA_ARGS__)
+#define BNGetFunctionBasicBlockList(...) ::BinaryNinja::ApiProfile::Instrument<566>(::BNGetFunctionBasicBlockList)(__VA_ARGS__)
+#define BNFreeBasicBlockList(...) ::BinaryNinja::ApiProfile::Instrument<567>(::BNFreeBasicBlockList)(__VA_ARGS__)
+#define BNGetFunctionBasicBlockAtAddress(...) ::BinaryNinja::ApiProfile::Instrument<568>(::BNGetFunctionBasicBlockAtAddress)(__VA_ARGS__)
+#define BNGetRecentBasicBlockForAddress(...) ::BinaryNinja::ApiProfile::Instrument<569>(::BNGetRecentBasicBlockForAddress)(__VA_ARGS__)
+#define BNGetBasicBlocksForAddress(...) ::BinaryNinja::ApiProfile::Instrument<570>(::BNGetBasicBlocksForAddress)(__VA_ARGS__)
+#define BNGetBasicBlocksStartingAtAddress(...) ::BinaryNinja::ApiProfile::Instrument<571>(::BNGetBasicBlocksStartingAtAddress)(__VA_ARGS__)
+#define BNGetFunctionHighestAddress(...) ::BinaryNinja::ApiProfile::Instrument<572>(::BNGetFunctionHighestAddress)(__VA_ARGS__)
+#define BNGetFunctionLowestAddress(...) ::BinaryNinja::ApiProfile::Instrument<573>(::BNGetFunctionLowestAddress)(__VA_ARGS__)
+#define BNGetFunctionAddressRanges(...) ::BinaryNinja::ApiProfile::Instrument<574>(::BNGetFunctionAddressRanges)(__VA_ARGS__)
+#define BNGetFunctionLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<575>(::BNGetFunctionLowLevelIL)(__VA_ARGS__)
+#define BNGetFunctionLowLevelILIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<576>(::BNGetFunctionLowLevelILIfAvailable)(__VA_ARGS__)
+#define BNGetLowLevelILForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<577>(::BNGetLowLevelILForInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILInstructionsForAddress(...) ::BinaryNinja::ApiProfile::Instrument<578>(::BNGetLowLevelILInstructionsForAddress)(__VA_ARGS__)
+#define BNGetLowLevelILExitsForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<579>(::BNGetLowLevelILExitsForInstruction)(__VA_ARGS__)
+#define BNFreeILInstructionList(...) ::BinaryNinja::ApiProfile::Instrument<580>(::BNFreeILInstructionList)(__VA_ARGS__)
+#define BNGetFunctionMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<581>(::BNGetFunctionMediumLevelIL)(__VA_ARGS__)
+#define BNGetFunctionMediumLevelILIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<582>(::BNGetFunctionMediumLevelILIfAvailable)(__VA_ARGS__)
+#define BNGetFunctionMappedMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<583>(::BNGetFunctionMappedMediumLevelIL)(__VA_ARGS__)
+#define BNGetFunctionMappedMediumLevelILIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<584>(::BNGetFunctionMappedMediumLevelILIfAvailable)(__VA_ARGS__)
+#define BNGetFunctionHighLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<585>(::BNGetFunctionHighLevelIL)(__VA_ARGS__)
+#define BNGetFunctionHighLevelILIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<586>(::BNGetFunctionHighLevelILIfAvailable)(__VA_ARGS__)
+#define BNGetFunctionLanguageRepresentation(...) ::BinaryNinja::ApiProfile::Instrument<587>(::BNGetFunctionLanguageRepresentation)(__VA_ARGS__)
+#define BNGetFunctionLanguageRepresentationIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<588>(::BNGetFunctionLanguageRepresentationIfAvailable)(__VA_ARGS__)
+#define BNGetConstantData(...) ::BinaryNinja::ApiProfile::Instrument<589>(::BNGetConstantData)(__VA_ARGS__)
+#define BNGetRegisterValueAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<590>(::BNGetRegisterValueAtInstruction)(__VA_ARGS__)
+#define BNGetRegisterValueAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<591>(::BNGetRegisterValueAfterInstruction)(__VA_ARGS__)
+#define BNGetStackContentsAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<592>(::BNGetStackContentsAtInstruction)(__VA_ARGS__)
+#define BNGetStackContentsAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<593>(::BNGetStackContentsAfterInstruction)(__VA_ARGS__)
+#define BNGetParameterValueAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<594>(::BNGetParameterValueAtInstruction)(__VA_ARGS__)
+#define BNGetParameterValueAtLowLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<595>(::BNGetParameterValueAtLowLevelILInstruction)(__VA_ARGS__)
+#define BNFreePossibleValueSet(...) ::BinaryNinja::ApiProfile::Instrument<596>(::BNFreePossibleValueSet)(__VA_ARGS__)
+#define BNGetRegistersReadByInstruction(...) ::BinaryNinja::ApiProfile::Instrument<597>(::BNGetRegistersReadByInstruction)(__VA_ARGS__)
+#define BNGetRegistersWrittenByInstruction(...) ::BinaryNinja::ApiProfile::Instrument<598>(::BNGetRegistersWrittenByInstruction)(__VA_ARGS__)
+#define BNGetStackVariablesReferencedByInstruction(...) ::BinaryNinja::ApiProfile::Instrument<599>(::BNGetStackVariablesReferencedByInstruction)(__VA_ARGS__)
+#define BNGetStackVariablesReferencedByInstructionIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<600>(::BNGetStackVariablesReferencedByInstructionIfAvailable)(__VA_ARGS__)
+#define BNFreeStackVariableReferenceList(...) ::BinaryNinja::ApiProfile::Instrument<601>(::BNFreeStackVariableReferenceList)(__VA_ARGS__)
+#define BNGetConstantsReferencedByInstruction(...) ::BinaryNinja::ApiProfile::Instrument<602>(::BNGetConstantsReferencedByInstruction)(__VA_ARGS__)
+#define BNGetConstantsReferencedByInstructionIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<603>(::BNGetConstantsReferencedByInstructionIfAvailable)(__VA_ARGS__)
+#define BNFreeConstantReferenceList(...) ::BinaryNinja::ApiProfile::Instrument<604>(::BNFreeConstantReferenceList)(__VA_ARGS__)
+#define BNGetFunctionLiftedIL(...) ::BinaryNinja::ApiProfile::Instrument<605>(::BNGetFunctionLiftedIL)(__VA_ARGS__)
+#define BNGetFunctionLiftedILIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<606>(::BNGetFunctionLiftedILIfAvailable)(__VA_ARGS__)
+#define BNGetLiftedILForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<607>(::BNGetLiftedILForInstruction)(__VA_ARGS__)
+#define BNGetLiftedILInstructionsForAddress(...) ::BinaryNinja::ApiProfile::Instrument<608>(::BNGetLiftedILInstructionsForAddress)(__VA_ARGS__)
+#define BNGetLiftedILFlagUsesForDefinition(...) ::BinaryNinja::ApiProfile::Instrument<609>(::BNGetLiftedILFlagUsesForDefinition)(__VA_ARGS__)
+#define BNGetLiftedILFlagDefinitionsForUse(...) ::BinaryNinja::ApiProfile::Instrument<610>(::BNGetLiftedILFlagDefinitionsForUse)(__VA_ARGS__)
+#define BNGetFlagsReadByLiftedILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<611>(::BNGetFlagsReadByLiftedILInstruction)(__VA_ARGS__)
+#define BNGetFlagsWrittenByLiftedILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<612>(::BNGetFlagsWrittenByLiftedILInstruction)(__VA_ARGS__)
+#define BNGetFunctionType(...) ::BinaryNinja::ApiProfile::Instrument<613>(::BNGetFunctionType)(__VA_ARGS__)
+#define BNGetFunctionReturnType(...) ::BinaryNinja::ApiProfile::Instrument<614>(::BNGetFunctionReturnType)(__VA_ARGS__)
+#define BNGetFunctionReturnRegisters(...) ::BinaryNinja::ApiProfile::Instrument<615>(::BNGetFunctionReturnRegisters)(__VA_ARGS__)
+#define BNGetFunctionCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<616>(::BNGetFunctionCallingConvention)(__VA_ARGS__)
+#define BNGetFunctionParameterVariables(...) ::BinaryNinja::ApiProfile::Instrument<617>(::BNGetFunctionParameterVariables)(__VA_ARGS__)
+#define BNFreeParameterVariables(...) ::BinaryNinja::ApiProfile::Instrument<618>(::BNFreeParameterVariables)(__VA_ARGS__)
+#define BNFunctionHasVariableArguments(...) ::BinaryNinja::ApiProfile::Instrument<619>(::BNFunctionHasVariableArguments)(__VA_ARGS__)
+#define BNGetFunctionStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<620>(::BNGetFunctionStackAdjustment)(__VA_ARGS__)
+#define BNGetFunctionRegisterStackAdjustments(...) ::BinaryNinja::ApiProfile::Instrument<621>(::BNGetFunctionRegisterStackAdjustments)(__VA_ARGS__)
+#define BNFreeRegisterStackAdjustments(...) ::BinaryNinja::ApiProfile::Instrument<622>(::BNFreeRegisterStackAdjustments)(__VA_ARGS__)
+#define BNGetFunctionClobberedRegisters(...) ::BinaryNinja::ApiProfile::Instrument<623>(::BNGetFunctionClobberedRegisters)(__VA_ARGS__)
+#define BNFreeRegisterSet(...) ::BinaryNinja::ApiProfile::Instrument<624>(::BNFreeRegisterSet)(__VA_ARGS__)
+#define BNSetAutoFunctionReturnType(...) ::BinaryNinja::ApiProfile::Instrument<625>(::BNSetAutoFunctionReturnType)(__VA_ARGS__)
+#define BNSetAutoFunctionReturnRegisters(...) ::BinaryNinja::ApiProfile::Instrument<626>(::BNSetAutoFunctionReturnRegisters)(__VA_ARGS__)
+#define BNSetAutoFunctionCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<627>(::BNSetAutoFunctionCallingConvention)(__VA_ARGS__)
+#define BNSetAutoFunctionParameterVariables(...) ::BinaryNinja::ApiProfile::Instrument<628>(::BNSetAutoFunctionParameterVariables)(__VA_ARGS__)
+#define BNSetAutoFunctionHasVariableArguments(...) ::BinaryNinja::ApiProfile::Instrument<629>(::BNSetAutoFunctionHasVariableArguments)(__VA_ARGS__)
+#define BNSetAutoFunctionCanReturn(...) ::BinaryNinja::ApiProfile::Instrument<630>(::BNSetAutoFunctionCanReturn)(__VA_ARGS__)
+#define BNSetAutoFunctionPure(...) ::BinaryNinja::ApiProfile::Instrument<631>(::BNSetAutoFunctionPure)(__VA_ARGS__)
+#define BNSetAutoFunctionStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<632>(::BNSetAutoFunctionStackAdjustment)(__VA_ARGS__)
+#define BNSetAutoFunctionRegisterStackAdjustments(...) ::BinaryNinja::ApiProfile::Instrument<633>(::BNSetAutoFunctionRegisterStackAdjustments)(__VA_ARGS__)
+#define BNSetAutoFunctionClobberedRegisters(...) ::BinaryNinja::ApiProfile::Instrument<634>(::BNSetAutoFunctionClobberedRegisters)(__VA_ARGS__)
+#define BNSetUserFunctionReturnType(...) ::BinaryNinja::ApiProfile::Instrument<635>(::BNSetUserFunctionReturnType)(__VA_ARGS__)
+#define BNSetUserFunctionReturnRegisters(...) ::BinaryNinja::ApiProfile::Instrument<636>(::BNSetUserFunctionReturnRegisters)(__VA_ARGS__)
+#define BNSetUserFunctionCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<637>(::BNSetUserFunctionCallingConvention)(__VA_ARGS__)
+#define BNSetUserFunctionParameterVariables(...) ::BinaryNinja::ApiProfile::Instrument<638>(::BNSetUserFunctionParameterVariables)(__VA_ARGS__)
+#define BNSetUserFunctionHasVariableArguments(...) ::BinaryNinja::ApiProfile::Instrument<639>(::BNSetUserFunctionHasVariableArguments)(__VA_ARGS__)
+#define BNSetUserFunctionCanReturn(...) ::BinaryNinja::ApiProfile::Instrument<640>(::BNSetUserFunctionCanReturn)(__VA_ARGS__)
+#define BNSetUserFunctionPure(...) ::BinaryNinja::ApiProfile::Instrument<641>(::BNSetUserFunctionPure)(__VA_ARGS__)
+#define BNSetUserFunctionStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<642>(::BNSetUserFunctionStackAdjustment)(__VA_ARGS__)
+#define BNSetUserFunctionRegisterStackAdjustments(...) ::BinaryNinja::ApiProfile::Instrument<643>(::BNSetUserFunctionRegisterStackAdjustments)(__VA_ARGS__)
+#define BNSetUserFunctionClobberedRegisters(...) ::BinaryNinja::ApiProfile::Instrument<644>(::BNSetUserFunctionClobberedRegisters)(__VA_ARGS__)
+#define BNApplyImportedTypes(...) ::BinaryNinja::ApiProfile::Instrument<645>(::BNApplyImportedTypes)(__VA_ARGS__)
+#define BNApplyAutoDiscoveredFunctionType(...) ::BinaryNinja::ApiProfile::Instrument<646>(::BNApplyAutoDiscoveredFunctionType)(__VA_ARGS__)
+#define BNFunctionHasExplicitlyDefinedType(...) ::BinaryNinja::ApiProfile::Instrument<647>(::BNFunctionHasExplicitlyDefinedType)(__VA_ARGS__)
+#define BNGetFunctionTypeTokens(...) ::BinaryNinja::ApiProfile::Instrument<648>(::BNGetFunctionTypeTokens)(__VA_ARGS__)
+#define BNGetFunctionGlobalPointerValue(...) ::BinaryNinja::ApiProfile::Instrument<649>(::BNGetFunctionGlobalPointerValue)(__VA_ARGS__)
+#define BNGetFunctionRegisterValueAtExit(...) ::BinaryNinja::ApiProfile::Instrument<650>(::BNGetFunctionRegisterValueAtExit)(__VA_ARGS__)
+#define BNIsFunctionInlinedDuringAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<651>(::BNIsFunctionInlinedDuringAnalysis)(__VA_ARGS__)
+#define BNSetAutoFunctionInlinedDuringAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<652>(::BNSetAutoFunctionInlinedDuringAnalysis)(__VA_ARGS__)
+#define BNSetUserFunctionInlinedDuringAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<653>(::BNSetUserFunctionInlinedDuringAnalysis)(__VA_ARGS__)
+#define BNGetInstructionContainingAddress(...) ::BinaryNinja::ApiProfile::Instrument<654>(::BNGetInstructionContainingAddress)(__VA_ARGS__)
+#define BNGetBasicBlockFunction(...) ::BinaryNinja::ApiProfile::Instrument<655>(::BNGetBasicBlockFunction)(__VA_ARGS__)
+#define BNGetBasicBlockArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<656>(::BNGetBasicBlockArchitecture)(__VA_ARGS__)
+#define BNGetBasicBlockSource(...) ::BinaryNinja::ApiProfile::Instrument<657>(::BNGetBasicBlockSource)(__VA_ARGS__)
+#define BNGetBasicBlockStart(...) ::BinaryNinja::ApiProfile::Instrument<658>(::BNGetBasicBlockStart)(__VA_ARGS__)
+#define BNGetBasicBlockEnd(...) ::BinaryNinja::ApiProfile::Instrument<659>(::BNGetBasicBlockEnd)(__VA_ARGS__)
+#define BNGetBasicBlockLength(...) ::BinaryNinja::ApiProfile::Instrument<660>(::BNGetBasicBlockLength)(__VA_ARGS__)
+#define BNGetBasicBlockOutgoingEdges(...) ::BinaryNinja::ApiProfile::Instrument<661>(::BNGetBasicBlockOutgoingEdges)(__VA_ARGS__)
+#define BNGetBasicBlockIncomingEdges(...) ::BinaryNinja::ApiProfile::Instrument<662>(::BNGetBasicBlockIncomingEdges)(__VA_ARGS__)
+#define BNFreeBasicBlockEdgeList(...) ::BinaryNinja::ApiProfile::Instrument<663>(::BNFreeBasicBlockEdgeList)(__VA_ARGS__)
+#define BNBasicBlockHasUndeterminedOutgoingEdges(...) ::BinaryNinja::ApiProfile::Instrument<664>(::BNBasicBlockHasUndeterminedOutgoingEdges)(__VA_ARGS__)
+#define BNBasicBlockCanExit(...) ::BinaryNinja::ApiProfile::Instrument<665>(::BNBasicBlockCanExit)(__VA_ARGS__)
+#define BNBasicBlockSetCanExit(...) ::BinaryNinja::ApiProfile::Instrument<666>(::BNBasicBlockSetCanExit)(__VA_ARGS__)
+#define BNBasicBlockHasInvalidInstructions(...) ::BinaryNinja::ApiProfile::Instrument<667>(::BNBasicBlockHasInvalidInstructions)(__VA_ARGS__)
+#define BNGetBasicBlockIndex(...) ::BinaryNinja::ApiProfile::Instrument<668>(::BNGetBasicBlockIndex)(__VA_ARGS__)
+#define BNGetBasicBlockDominators(...) ::BinaryNinja::ApiProfile::Instrument<669>(::BNGetBasicBlockDominators)(__VA_ARGS__)
+#define BNGetBasicBlockStrictDominators(...) ::BinaryNinja::ApiProfile::Instrument<670>(::BNGetBasicBlockStrictDominators)(__VA_ARGS__)
+#define BNGetBasicBlockImmediateDominator(...) ::BinaryNinja::ApiProfile::Instrument<671>(::BNGetBasicBlockImmediateDominator)(__VA_ARGS__)
+#define BNGetBasicBlockDominatorTreeChildren(...) ::BinaryNinja::ApiProfile::Instrument<672>(::BNGetBasicBlockDominatorTreeChildren)(__VA_ARGS__)
+#define BNGetBasicBlockDominanceFrontier(...) ::BinaryNinja::ApiProfile::Instrument<673>(::BNGetBasicBlockDominanceFrontier)(__VA_ARGS__)
+#define BNGetBasicBlockIteratedDominanceFrontier(...) ::BinaryNinja::ApiProfile::Instrument<674>(::BNGetBasicBlockIteratedDominanceFrontier)(__VA_ARGS__)
+#define BNIsILBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<675>(::BNIsILBasicBlock)(__VA_ARGS__)
+#define BNIsLowLevelILBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<676>(::BNIsLowLevelILBasicBlock)(__VA_ARGS__)
+#define BNIsMediumLevelILBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<677>(::BNIsMediumLevelILBasicBlock)(__VA_ARGS__)
+#define BNIsHighLevelILBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<678>(::BNIsHighLevelILBasicBlock)(__VA_ARGS__)
+#define BNGetBasicBlockFunctionGraphType(...) ::BinaryNinja::ApiProfile::Instrument<679>(::BNGetBasicBlockFunctionGraphType)(__VA_ARGS__)
+#define BNGetBasicBlockLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<680>(::BNGetBasicBlockLowLevelILFunction)(__VA_ARGS__)
+#define BNGetBasicBlockMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<681>(::BNGetBasicBlockMediumLevelILFunction)(__VA_ARGS__)
+#define BNGetBasicBlockHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<682>(::BNGetBasicBlockHighLevelILFunction)(__VA_ARGS__)
+#define BNGetBasicBlockInstructionContainingAddress(...) ::BinaryNinja::ApiProfile::Instrument<683>(::BNGetBasicBlockInstructionContainingAddress)(__VA_ARGS__)
+#define BNGetBasicBlockSourceBlock(...) ::BinaryNinja::ApiProfile::Instrument<684>(::BNGetBasicBlockSourceBlock)(__VA_ARGS__)
+#define BNGetBasicBlockDisassemblyText(...) ::BinaryNinja::ApiProfile::Instrument<685>(::BNGetBasicBlockDisassemblyText)(__VA_ARGS__)
+#define BNFreeDisassemblyTextLines(...) ::BinaryNinja::ApiProfile::Instrument<686>(::BNFreeDisassemblyTextLines)(__VA_ARGS__)
+#define BNGetDisplayStringForInteger(...) ::BinaryNinja::ApiProfile::Instrument<687>(::BNGetDisplayStringForInteger)(__VA_ARGS__)
+#define BNCreateDisassemblyTextRenderer(...) ::BinaryNinja::ApiProfile::Instrument<688>(::BNCreateDisassemblyTextRenderer)(__VA_ARGS__)
+#define BNCreateLowLevelILDisassemblyTextRenderer(...) ::BinaryNinja::ApiProfile::Instrument<689>(::BNCreateLowLevelILDisassemblyTextRenderer)(__VA_ARGS__)
+#define BNCreateMediumLevelILDisassemblyTextRenderer(...) ::BinaryNinja::ApiProfile::Instrument<690>(::BNCreateMediumLevelILDisassemblyTextRenderer)(__VA_ARGS__)
+#define BNCreateHighLevelILDisassemblyTextRenderer(...) ::BinaryNinja::ApiProfile::Instrument<691>(::BNCreateHighLevelILDisassemblyTextRenderer)(__VA_ARGS__)
+#define BNNewDisassemblyTextRendererReference(...) ::BinaryNinja::ApiProfile::Instrument<692>(::BNNewDisassemblyTextRendererReference)(__VA_ARGS__)
+#define BNFreeDisassemblyTextRenderer(...) ::BinaryNinja::ApiProfile::Instrument<693>(::BNFreeDisassemblyTextRenderer)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererFunction(...) ::BinaryNinja::ApiProfile::Instrument<694>(::BNGetDisassemblyTextRendererFunction)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<695>(::BNGetDisassemblyTextRendererLowLevelILFunction)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<696>(::BNGetDisassemblyTextRendererMediumLevelILFunction)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<697>(::BNGetDisassemblyTextRendererHighLevelILFunction)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<698>(::BNGetDisassemblyTextRendererBasicBlock)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<699>(::BNGetDisassemblyTextRendererArchitecture)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererSettings(...) ::BinaryNinja::ApiProfile::Instrument<700>(::BNGetDisassemblyTextRendererSettings)(__VA_ARGS__)
+#define BNSetDisassemblyTextRendererBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<701>(::BNSetDisassemblyTextRendererBasicBlock)(__VA_ARGS__)
+#define BNSetDisassemblyTextRendererArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<702>(::BNSetDisassemblyTextRendererArchitecture)(__VA_ARGS__)
+#define BNSetDisassemblyTextRendererSettings(...) ::BinaryNinja::ApiProfile::Instrument<703>(::BNSetDisassemblyTextRendererSettings)(__VA_ARGS__)
+#define BNIsILDisassemblyTextRenderer(...) ::BinaryNinja::ApiProfile::Instrument<704>(::BNIsILDisassemblyTextRenderer)(__VA_ARGS__)
+#define BNDisassemblyTextRendererHasDataFlow(...) ::BinaryNinja::ApiProfile::Instrument<705>(::BNDisassemblyTextRendererHasDataFlow)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererInstructionAnnotations(...) ::BinaryNinja::ApiProfile::Instrument<706>(::BNGetDisassemblyTextRendererInstructionAnnotations)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererInstructionText(...) ::BinaryNinja::ApiProfile::Instrument<707>(::BNGetDisassemblyTextRendererInstructionText)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererLines(...) ::BinaryNinja::ApiProfile::Instrument<708>(::BNGetDisassemblyTextRendererLines)(__VA_ARGS__)
+#define BNPostProcessDisassemblyTextRendererLines(...) ::BinaryNinja::ApiProfile::Instrument<709>(::BNPostProcessDisassemblyTextRendererLines)(__VA_ARGS__)
+#define BNResetDisassemblyTextRendererDeduplicatedComments(...) ::BinaryNinja::ApiProfile::Instrument<710>(::BNResetDisassemblyTextRendererDeduplicatedComments)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererSymbolTokens(...) ::BinaryNinja::ApiProfile::Instrument<711>(::BNGetDisassemblyTextRendererSymbolTokens)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererStackVariableReferenceTokens(...) ::BinaryNinja::ApiProfile::Instrument<712>(::BNGetDisassemblyTextRendererStackVariableReferenceTokens)(__VA_ARGS__)
+#define BNIsIntegerToken(...) ::BinaryNinja::ApiProfile::Instrument<713>(::BNIsIntegerToken)(__VA_ARGS__)
+#define BNGetDisassemblyTextRendererIntegerTokens(...) ::BinaryNinja::ApiProfile::Instrument<714>(::BNGetDisassemblyTextRendererIntegerTokens)(__VA_ARGS__)
+#define BNDisassemblyTextRendererWrapComment(...) ::BinaryNinja::ApiProfile::Instrument<715>(::BNDisassemblyTextRendererWrapComment)(__VA_ARGS__)
+#define BNMarkFunctionAsRecentlyUsed(...) ::BinaryNinja::ApiProfile::Instrument<716>(::BNMarkFunctionAsRecentlyUsed)(__VA_ARGS__)
+#define BNMarkBasicBlockAsRecentlyUsed(...) ::BinaryNinja::ApiProfile::Instrument<717>(::BNMarkBasicBlockAsRecentlyUsed)(__VA_ARGS__)
+#define BNGetCodeReferences(...) ::BinaryNinja::ApiProfile::Instrument<718>(::BNGetCodeReferences)(__VA_ARGS__)
+#define BNGetCodeReferencesInRange(...) ::BinaryNinja::ApiProfile::Instrument<719>(::BNGetCodeReferencesInRange)(__VA_ARGS__)
+#define BNFreeCodeReferences(...) ::BinaryNinja::ApiProfile::Instrument<720>(::BNFreeCodeReferences)(__VA_ARGS__)
+#define BNFreeTypeFieldReferences(...) ::BinaryNinja::ApiProfile::Instrument<721>(::BNFreeTypeFieldReferences)(__VA_ARGS__)
+#define BNFreeILReferences(...) ::BinaryNinja::ApiProfile::Instrument<722>(::BNFreeILReferences)(__VA_ARGS__)
+#define BNGetCodeReferencesFrom(...) ::BinaryNinja::ApiProfile::Instrument<723>(::BNGetCodeReferencesFrom)(__VA_ARGS__)
+#define BNGetCodeReferencesFromInRange(...) ::BinaryNinja::ApiProfile::Instrument<724>(::BNGetCodeReferencesFromInRange)(__VA_ARGS__)
+#define BNGetDataReferences(...) ::BinaryNinja::ApiProfile::Instrument<725>(::BNGetDataReferences)(__VA_ARGS__)
+#define BNGetDataReferencesInRange(...) ::BinaryNinja::ApiProfile::Instrument<726>(::BNGetDataReferencesInRange)(__VA_ARGS__)
+#define BNGetDataReferencesFrom(...) ::BinaryNinja::ApiProfile::Instrument<727>(::BNGetDataReferencesFrom)(__VA_ARGS__)
+#define BNGetDataReferencesFromInRange(...) ::BinaryNinja::ApiProfile::Instrument<728>(::BNGetDataReferencesFromInRange)(__VA_ARGS__)
+#define BNAddUserDataReference(...) ::BinaryNinja::ApiProfile::Instrument<729>(::BNAddUserDataReference)(__VA_ARGS__)
+#define BNRemoveUserDataReference(...) ::BinaryNinja::ApiProfile::Instrument<730>(::BNRemoveUserDataReference)(__VA_ARGS__)
+#define BNFreeDataReferences(...) ::BinaryNinja::ApiProfile::Instrument<731>(::BNFreeDataReferences)(__VA_ARGS__)
+#define BNFreeTypeReferences(...) ::BinaryNinja::ApiProfile::Instrument<732>(::BNFreeTypeReferences)(__VA_ARGS__)
+#define BNFreeTypeFieldReferenceSizeInfo(...) ::BinaryNinja::ApiProfile::Instrument<733>(::BNFreeTypeFieldReferenceSizeInfo)(__VA_ARGS__)
+#define BNFreeTypeFieldReferenceTypeInfo(...) ::BinaryNinja::ApiProfile::Instrument<734>(::BNFreeTypeFieldReferenceTypeInfo)(__VA_ARGS__)
+#define BNFreeTypeFieldReferenceSizes(...) ::BinaryNinja::ApiProfile::Instrument<735>(::BNFreeTypeFieldReferenceSizes)(__VA_ARGS__)
+#define BNFreeTypeFieldReferenceTypes(...) ::BinaryNinja::ApiProfile::Instrument<736>(::BNFreeTypeFieldReferenceTypes)(__VA_ARGS__)
+#define BNGetCodeReferencesForType(...) ::BinaryNinja::ApiProfile::Instrument<737>(::BNGetCodeReferencesForType)(__VA_ARGS__)
+#define BNGetDataReferencesForType(...) ::BinaryNinja::ApiProfile::Instrument<738>(::BNGetDataReferencesForType)(__VA_ARGS__)
+#define BNGetTypeReferencesForType(...) ::BinaryNinja::ApiProfile::Instrument<739>(::BNGetTypeReferencesForType)(__VA_ARGS__)
+#define BNGetCodeReferencesForTypeField(...) ::BinaryNinja::ApiProfile::Instrument<740>(::BNGetCodeReferencesForTypeField)(__VA_ARGS__)
+#define BNGetDataReferencesForTypeField(...) ::BinaryNinja::ApiProfile::Instrument<741>(::BNGetDataReferencesForTypeField)(__VA_ARGS__)
+#define BNGetDataReferencesFromForTypeField(...) ::BinaryNinja::ApiProfile::Instrument<742>(::BNGetDataReferencesFromForTypeField)(__VA_ARGS__)
+#define BNGetTypeReferencesForTypeField(...) ::BinaryNinja::ApiProfile::Instrument<743>(::BNGetTypeReferencesForTypeField)(__VA_ARGS__)
+#define BNGetCodeReferencesForTypeFrom(...) ::BinaryNinja::ApiProfile::Instrument<744>(::BNGetCodeReferencesForTypeFrom)(__VA_ARGS__)
+#define BNGetCodeReferencesForTypeFromInRange(...) ::BinaryNinja::ApiProfile::Instrument<745>(::BNGetCodeReferencesForTypeFromInRange)(__VA_ARGS__)
+#define BNGetCodeReferencesForTypeFieldsFrom(...) ::BinaryNinja::ApiProfile::Instrument<746>(::BNGetCodeReferencesForTypeFieldsFrom)(__VA_ARGS__)
+#define BNGetCodeReferencesForTypeFieldsFromInRange(...) ::BinaryNinja::ApiProfile::Instrument<747>(::BNGetCodeReferencesForTypeFieldsFromInRange)(__VA_ARGS__)
+#define BNGetAllFieldsReferenced(...) ::BinaryNinja::ApiProfile::Instrument<748>(::BNGetAllFieldsReferenced)(__VA_ARGS__)
+#define BNGetAllSizesReferenced(...) ::BinaryNinja::ApiProfile::Instrument<749>(::BNGetAllSizesReferenced)(__VA_ARGS__)
+#define BNGetAllTypesReferenced(...) ::BinaryNinja::ApiProfile::Instrument<750>(::BNGetAllTypesReferenced)(__VA_ARGS__)
+#define BNGetSizesReferenced(...) ::BinaryNinja::ApiProfile::Instrument<751>(::BNGetSizesReferenced)(__VA_ARGS__)
+#define BNGetTypesReferenced(...) ::BinaryNinja::ApiProfile::Instrument<752>(::BNGetTypesReferenced)(__VA_ARGS__)
+#define BNGetOutgoingDirectTypeReferences(...) ::BinaryNinja::ApiProfile::Instrument<753>(::BNGetOutgoingDirectTypeReferences)(__VA_ARGS__)
+#define BNGetOutgoingRecursiveTypeReferences(...) ::BinaryNinja::ApiProfile::Instrument<754>(::BNGetOutgoingRecursiveTypeReferences)(__VA_ARGS__)
+#define BNGetIncomingDirectTypeReferences(...) ::BinaryNinja::ApiProfile::Instrument<755>(::BNGetIncomingDirectTypeReferences)(__VA_ARGS__)
+#define BNGetIncomingRecursiveTypeReferences(...) ::BinaryNinja::ApiProfile::Instrument<756>(::BNGetIncomingRecursiveTypeReferences)(__VA_ARGS__)
+#define BNRegisterGlobalFunctionRecognizer(...) ::BinaryNinja::ApiProfile::Instrument<757>(::BNRegisterGlobalFunctionRecognizer)(__VA_ARGS__)
+#define BNGetStringAtAddress(...) ::BinaryNinja::ApiProfile::Instrument<758>(::BNGetStringAtAddress)(__VA_ARGS__)
+#define BNGetStrings(...) ::BinaryNinja::ApiProfile::Instrument<759>(::BNGetStrings)(__VA_ARGS__)
+#define BNGetStringsInRange(...) ::BinaryNinja::ApiProfile::Instrument<760>(::BNGetStringsInRange)(__VA_ARGS__)
+#define BNFreeStringReferenceList(...) ::BinaryNinja::ApiProfile::Instrument<761>(::BNFreeStringReferenceList)(__VA_ARGS__)
+#define BNGetStackLayout(...) ::BinaryNinja::ApiProfile::Instrument<762>(::BNGetStackLayout)(__VA_ARGS__)
+#define BNFreeVariableNameAndTypeList(...) ::BinaryNinja::ApiProfile::Instrument<763>(::BNFreeVariableNameAndTypeList)(__VA_ARGS__)
+#define BNCreateAutoStackVariable(...) ::BinaryNinja::ApiProfile::Instrument<764>(::BNCreateAutoStackVariable)(__VA_ARGS__)
+#define BNCreateUserStackVariable(...) ::BinaryNinja::ApiProfile::Instrument<765>(::BNCreateUserStackVariable)(__VA_ARGS__)
+#define BNDeleteAutoStackVariable(...) ::BinaryNinja::ApiProfile::Instrument<766>(::BNDeleteAutoStackVariable)(__VA_ARGS__)
+#define BNDeleteUserStackVariable(...) ::BinaryNinja::ApiProfile::Instrument<767>(::BNDeleteUserStackVariable)(__VA_ARGS__)
+#define BNGetStackVariableAtFrameOffset(...) ::BinaryNinja::ApiProfile::Instrument<768>(::BNGetStackVariableAtFrameOffset)(__VA_ARGS__)
+#define BNFreeVariableNameAndType(...) ::BinaryNinja::ApiProfile::Instrument<769>(::BNFreeVariableNameAndType)(__VA_ARGS__)
+#define BNGetFunctionVariables(...) ::BinaryNinja::ApiProfile::Instrument<770>(::BNGetFunctionVariables)(__VA_ARGS__)
+#define BNCreateAutoVariable(...) ::BinaryNinja::ApiProfile::Instrument<771>(::BNCreateAutoVariable)(__VA_ARGS__)
+#define BNCreateUserVariable(...) ::BinaryNinja::ApiProfile::Instrument<772>(::BNCreateUserVariable)(__VA_ARGS__)
+#define BNDeleteUserVariable(...) ::BinaryNinja::ApiProfile::Instrument<773>(::BNDeleteUserVariable)(__VA_ARGS__)
+#define BNIsVariableUserDefined(...) ::BinaryNinja::ApiProfile::Instrument<774>(::BNIsVariableUserDefined)(__VA_ARGS__)
+#define BNGetVariableType(...) ::BinaryNinja::ApiProfile::Instrument<775>(::BNGetVariableType)(__VA_ARGS__)
+#define BNGetVariableName(...) ::BinaryNinja::ApiProfile::Instrument<776>(::BNGetVariableName)(__VA_ARGS__)
+#define BNGetVariableNameOrDefault(...) ::BinaryNinja::ApiProfile::Instrument<777>(::BNGetVariableNameOrDefault)(__VA_ARGS__)
+#define BNGetLastSeenVariableNameOrDefault(...) ::BinaryNinja::ApiProfile::Instrument<778>(::BNGetLastSeenVariableNameOrDefault)(__VA_ARGS__)
+#define BNToVariableIdentifier(...) ::BinaryNinja::ApiProfile::Instrument<779>(::BNToVariableIdentifier)(__VA_ARGS__)
+#define BNFromVariableIdentifier(...) ::BinaryNinja::ApiProfile::Instrument<780>(::BNFromVariableIdentifier)(__VA_ARGS__)
+#define BNGetFunctionVariableDeadStoreElimination(...) ::BinaryNinja::ApiProfile::Instrument<781>(::BNGetFunctionVariableDeadStoreElimination)(__VA_ARGS__)
+#define BNSetFunctionVariableDeadStoreElimination(...) ::BinaryNinja::ApiProfile::Instrument<782>(::BNSetFunctionVariableDeadStoreElimination)(__VA_ARGS__)
+#define BNGetMergedVariables(...) ::BinaryNinja::ApiProfile::Instrument<783>(::BNGetMergedVariables)(__VA_ARGS__)
+#define BNFreeMergedVariableList(...) ::BinaryNinja::ApiProfile::Instrument<784>(::BNFreeMergedVariableList)(__VA_ARGS__)
+#define BNMergeVariables(...) ::BinaryNinja::ApiProfile::Instrument<785>(::BNMergeVariables)(__VA_ARGS__)
+#define BNUnmergeVariables(...) ::BinaryNinja::ApiProfile::Instrument<786>(::BNUnmergeVariables)(__VA_ARGS__)
+#define BNGetSplitVariables(...) ::BinaryNinja::ApiProfile::Instrument<787>(::BNGetSplitVariables)(__VA_ARGS__)
+#define BNSplitVariable(...) ::BinaryNinja::ApiProfile::Instrument<788>(::BNSplitVariable)(__VA_ARGS__)
+#define BNUnsplitVariable(...) ::BinaryNinja::ApiProfile::Instrument<789>(::BNUnsplitVariable)(__VA_ARGS__)
+#define BNGetFunctionCallSites(...) ::BinaryNinja::ApiProfile::Instrument<790>(::BNGetFunctionCallSites)(__VA_ARGS__)
+#define BNGetCallees(...) ::BinaryNinja::ApiProfile::Instrument<791>(::BNGetCallees)(__VA_ARGS__)
+#define BNGetCallers(...) ::BinaryNinja::ApiProfile::Instrument<792>(::BNGetCallers)(__VA_ARGS__)
+#define BNSetAutoIndirectBranches(...) ::BinaryNinja::ApiProfile::Instrument<793>(::BNSetAutoIndirectBranches)(__VA_ARGS__)
+#define BNSetUserIndirectBranches(...) ::BinaryNinja::ApiProfile::Instrument<794>(::BNSetUserIndirectBranches)(__VA_ARGS__)
+#define BNGetIndirectBranches(...) ::BinaryNinja::ApiProfile::Instrument<795>(::BNGetIndirectBranches)(__VA_ARGS__)
+#define BNGetIndirectBranchesAt(...) ::BinaryNinja::ApiProfile::Instrument<796>(::BNGetIndirectBranchesAt)(__VA_ARGS__)
+#define BNFreeIndirectBranchList(...) ::BinaryNinja::ApiProfile::Instrument<797>(::BNFreeIndirectBranchList)(__VA_ARGS__)
+#define BNGetUnresolvedIndirectBranches(...) ::BinaryNinja::ApiProfile::Instrument<798>(::BNGetUnresolvedIndirectBranches)(__VA_ARGS__)
+#define BNHasUnresolvedIndirectBranches(...) ::BinaryNinja::ApiProfile::Instrument<799>(::BNHasUnresolvedIndirectBranches)(__VA_ARGS__)
+#define BNSetAutoCallTypeAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<800>(::BNSetAutoCallTypeAdjustment)(__VA_ARGS__)
+#define BNSetUserCallTypeAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<801>(::BNSetUserCallTypeAdjustment)(__VA_ARGS__)
+#define BNSetAutoCallStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<802>(::BNSetAutoCallStackAdjustment)(__VA_ARGS__)
+#define BNSetUserCallStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<803>(::BNSetUserCallStackAdjustment)(__VA_ARGS__)
+#define BNSetAutoCallRegisterStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<804>(::BNSetAutoCallRegisterStackAdjustment)(__VA_ARGS__)
+#define BNSetUserCallRegisterStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<805>(::BNSetUserCallRegisterStackAdjustment)(__VA_ARGS__)
+#define BNSetAutoCallRegisterStackAdjustmentForRegisterStack(...) ::BinaryNinja::ApiProfile::Instrument<806>(::BNSetAutoCallRegisterStackAdjustmentForRegisterStack)(__VA_ARGS__)
+#define BNSetUserCallRegisterStackAdjustmentForRegisterStack(...) ::BinaryNinja::ApiProfile::Instrument<807>(::BNSetUserCallRegisterStackAdjustmentForRegisterStack)(__VA_ARGS__)
+#define BNGetCallTypeAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<808>(::BNGetCallTypeAdjustment)(__VA_ARGS__)
+#define BNGetCallStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<809>(::BNGetCallStackAdjustment)(__VA_ARGS__)
+#define BNGetCallRegisterStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<810>(::BNGetCallRegisterStackAdjustment)(__VA_ARGS__)
+#define BNGetCallRegisterStackAdjustmentForRegisterStack(...) ::BinaryNinja::ApiProfile::Instrument<811>(::BNGetCallRegisterStackAdjustmentForRegisterStack)(__VA_ARGS__)
+#define BNIsCallInstruction(...) ::BinaryNinja::ApiProfile::Instrument<812>(::BNIsCallInstruction)(__VA_ARGS__)
+#define BNGetFunctionBlockAnnotations(...) ::BinaryNinja::ApiProfile::Instrument<813>(::BNGetFunctionBlockAnnotations)(__VA_ARGS__)
+#define BNGetIntegerConstantDisplayType(...) ::BinaryNinja::ApiProfile::Instrument<814>(::BNGetIntegerConstantDisplayType)(__VA_ARGS__)
+#define BNSetIntegerConstantDisplayType(...) ::BinaryNinja::ApiProfile::Instrument<815>(::BNSetIntegerConstantDisplayType)(__VA_ARGS__)
+#define BNGetIntegerConstantDisplayTypeEnumerationType(...) ::BinaryNinja::ApiProfile::Instrument<816>(::BNGetIntegerConstantDisplayTypeEnumerationType)(__VA_ARGS__)
+#define BNSetIntegerConstantDisplayTypeEnumerationType(...) ::BinaryNinja::ApiProfile::Instrument<817>(::BNSetIntegerConstantDisplayTypeEnumerationType)(__VA_ARGS__)
+#define BNIsFunctionTooLarge(...) ::BinaryNinja::ApiProfile::Instrument<818>(::BNIsFunctionTooLarge)(__VA_ARGS__)
+#define BNIsFunctionAnalysisSkipped(...) ::BinaryNinja::ApiProfile::Instrument<819>(::BNIsFunctionAnalysisSkipped)(__VA_ARGS__)
+#define BNGetAnalysisSkipReason(...) ::BinaryNinja::ApiProfile::Instrument<820>(::BNGetAnalysisSkipReason)(__VA_ARGS__)
+#define BNGetFunctionAnalysisSkipOverride(...) ::BinaryNinja::ApiProfile::Instrument<821>(::BNGetFunctionAnalysisSkipOverride)(__VA_ARGS__)
+#define BNSetFunctionAnalysisSkipOverride(...) ::BinaryNinja::ApiProfile::Instrument<822>(::BNSetFunctionAnalysisSkipOverride)(__VA_ARGS__)
+#define BNGetGotoLabelName(...) ::BinaryNinja::ApiProfile::Instrument<823>(::BNGetGotoLabelName)(__VA_ARGS__)
+#define BNSetUserGotoLabelName(...) ::BinaryNinja::ApiProfile::Instrument<824>(::BNSetUserGotoLabelName)(__VA_ARGS__)
+#define BNGetParametersForAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<825>(::BNGetParametersForAnalysis)(__VA_ARGS__)
+#define BNSetParametersForAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<826>(::BNSetParametersForAnalysis)(__VA_ARGS__)
+#define BNGetMaxFunctionSizeForAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<827>(::BNGetMaxFunctionSizeForAnalysis)(__VA_ARGS__)
+#define BNSetMaxFunctionSizeForAnalysis(...) ::BinaryNinja::ApiProfile::Instrument<828>(::BNSetMaxFunctionSizeForAnalysis)(__VA_ARGS__)
+#define BNGetNewAutoFunctionAnalysisSuppressed(...) ::BinaryNinja::ApiProfile::Instrument<829>(::BNGetNewAutoFunctionAnalysisSuppressed)(__VA_ARGS__)
+#define BNSetNewAutoFunctionAnalysisSuppressed(...) ::BinaryNinja::ApiProfile::Instrument<830>(::BNSetNewAutoFunctionAnalysisSuppressed)(__VA_ARGS__)
+#define BNAddAnalysisCompletionEvent(...) ::BinaryNinja::ApiProfile::Instrument<831>(::BNAddAnalysisCompletionEvent)(__VA_ARGS__)
+#define BNNewAnalysisCompletionEventReference(...) ::BinaryNinja::ApiProfile::Instrument<832>(::BNNewAnalysisCompletionEventReference)(__VA_ARGS__)
+#define BNFreeAnalysisCompletionEvent(...) ::BinaryNinja::ApiProfile::Instrument<833>(::BNFreeAnalysisCompletionEvent)(__VA_ARGS__)
+#define BNCancelAnalysisCompletionEvent(...) ::BinaryNinja::ApiProfile::Instrument<834>(::BNCancelAnalysisCompletionEvent)(__VA_ARGS__)
+#define BNGetAnalysisInfo(...) ::BinaryNinja::ApiProfile::Instrument<835>(::BNGetAnalysisInfo)(__VA_ARGS__)
+#define BNFreeAnalysisInfo(...) ::BinaryNinja::ApiProfile::Instrument<836>(::BNFreeAnalysisInfo)(__VA_ARGS__)
+#define BNGetAnalysisProgress(...) ::BinaryNinja::ApiProfile::Instrument<837>(::BNGetAnalysisProgress)(__VA_ARGS__)
+#define BNGetBackgroundAnalysisTask(...) ::BinaryNinja::ApiProfile::Instrument<838>(::BNGetBackgroundAnalysisTask)(__VA_ARGS__)
+#define BNGetNextFunctionStartAfterAddress(...) ::BinaryNinja::ApiProfile::Instrument<839>(::BNGetNextFunctionStartAfterAddress)(__VA_ARGS__)
+#define BNGetNextBasicBlockStartAfterAddress(...) ::BinaryNinja::ApiProfile::Instrument<840>(::BNGetNextBasicBlockStartAfterAddress)(__VA_ARGS__)
+#define BNGetNextDataAfterAddress(...) ::BinaryNinja::ApiProfile::Instrument<841>(::BNGetNextDataAfterAddress)(__VA_ARGS__)
+#define BNGetNextDataVariableStartAfterAddress(...) ::BinaryNinja::ApiProfile::Instrument<842>(::BNGetNextDataVariableStartAfterAddress)(__VA_ARGS__)
+#define BNGetPreviousFunctionStartBeforeAddress(...) ::BinaryNinja::ApiProfile::Instrument<843>(::BNGetPreviousFunctionStartBeforeAddress)(__VA_ARGS__)
+#define BNGetPreviousBasicBlockStartBeforeAddress(...) ::BinaryNinja::ApiProfile::Instrument<844>(::BNGetPreviousBasicBlockStartBeforeAddress)(__VA_ARGS__)
+#define BNGetPreviousBasicBlockEndBeforeAddress(...) ::BinaryNinja::ApiProfile::Instrument<845>(::BNGetPreviousBasicBlockEndBeforeAddress)(__VA_ARGS__)
+#define BNGetPreviousDataBeforeAddress(...) ::BinaryNinja::ApiProfile::Instrument<846>(::BNGetPreviousDataBeforeAddress)(__VA_ARGS__)
+#define BNGetPreviousDataVariableStartBeforeAddress(...) ::BinaryNinja::ApiProfile::Instrument<847>(::BNGetPreviousDataVariableStartBeforeAddress)(__VA_ARGS__)
+#define BNCreateLinearViewDisassembly(...) ::BinaryNinja::ApiProfile::Instrument<848>(::BNCreateLinearViewDisassembly)(__VA_ARGS__)
+#define BNCreateLinearViewLiftedIL(...) ::BinaryNinja::ApiProfile::Instrument<849>(::BNCreateLinearViewLiftedIL)(__VA_ARGS__)
+#define BNCreateLinearViewLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<850>(::BNCreateLinearViewLowLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewLowLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<851>(::BNCreateLinearViewLowLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<852>(::BNCreateLinearViewMediumLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewMediumLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<853>(::BNCreateLinearViewMediumLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewMappedMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<854>(::BNCreateLinearViewMappedMediumLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewMappedMediumLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<855>(::BNCreateLinearViewMappedMediumLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewHighLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<856>(::BNCreateLinearViewHighLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewHighLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<857>(::BNCreateLinearViewHighLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewLanguageRepresentation(...) ::BinaryNinja::ApiProfile::Instrument<858>(::BNCreateLinearViewLanguageRepresentation)(__VA_ARGS__)
+#define BNCreateLinearViewDataOnly(...) ::BinaryNinja::ApiProfile::Instrument<859>(::BNCreateLinearViewDataOnly)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionDisassembly(...) ::BinaryNinja::ApiProfile::Instrument<860>(::BNCreateLinearViewSingleFunctionDisassembly)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionLiftedIL(...) ::BinaryNinja::ApiProfile::Instrument<861>(::BNCreateLinearViewSingleFunctionLiftedIL)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<862>(::BNCreateLinearViewSingleFunctionLowLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionLowLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<863>(::BNCreateLinearViewSingleFunctionLowLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<864>(::BNCreateLinearViewSingleFunctionMediumLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionMediumLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<865>(::BNCreateLinearViewSingleFunctionMediumLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionMappedMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<866>(::BNCreateLinearViewSingleFunctionMappedMediumLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionMappedMediumLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<867>(::BNCreateLinearViewSingleFunctionMappedMediumLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionHighLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<868>(::BNCreateLinearViewSingleFunctionHighLevelIL)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionHighLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<869>(::BNCreateLinearViewSingleFunctionHighLevelILSSAForm)(__VA_ARGS__)
+#define BNCreateLinearViewSingleFunctionLanguageRepresentation(...) ::BinaryNinja::ApiProfile::Instrument<870>(::BNCreateLinearViewSingleFunctionLanguageRepresentation)(__VA_ARGS__)
+#define BNNewLinearViewObjectReference(...) ::BinaryNinja::ApiProfile::Instrument<871>(::BNNewLinearViewObjectReference)(__VA_ARGS__)
+#define BNFreeLinearViewObject(...) ::BinaryNinja::ApiProfile::Instrument<872>(::BNFreeLinearViewObject)(__VA_ARGS__)
+#define BNGetFirstLinearViewObjectChild(...) ::BinaryNinja::ApiProfile::Instrument<873>(::BNGetFirstLinearViewObjectChild)(__VA_ARGS__)
+#define BNGetLastLinearViewObjectChild(...) ::BinaryNinja::ApiProfile::Instrument<874>(::BNGetLastLinearViewObjectChild)(__VA_ARGS__)
+#define BNGetPreviousLinearViewObjectChild(...) ::BinaryNinja::ApiProfile::Instrument<875>(::BNGetPreviousLinearViewObjectChild)(__VA_ARGS__)
+#define BNGetNextLinearViewObjectChild(...) ::BinaryNinja::ApiProfile::Instrument<876>(::BNGetNextLinearViewObjectChild)(__VA_ARGS__)
+#define BNGetLinearViewObjectChildForAddress(...) ::BinaryNinja::ApiProfile::Instrument<877>(::BNGetLinearViewObjectChildForAddress)(__VA_ARGS__)
+#define BNGetLinearViewObjectChildForIdentifier(...) ::BinaryNinja::ApiProfile::Instrument<878>(::BNGetLinearViewObjectChildForIdentifier)(__VA_ARGS__)
+#define BNGetLinearViewObjectLines(...) ::BinaryNinja::ApiProfile::Instrument<879>(::BNGetLinearViewObjectLines)(__VA_ARGS__)
+#define BNFreeLinearDisassemblyLines(...) ::BinaryNinja::ApiProfile::Instrument<880>(::BNFreeLinearDisassemblyLines)(__VA_ARGS__)
+#define BNGetLinearViewObjectStart(...) ::BinaryNinja::ApiProfile::Instrument<881>(::BNGetLinearViewObjectStart)(__VA_ARGS__)
+#define BNGetLinearViewObjectEnd(...) ::BinaryNinja::ApiProfile::Instrument<882>(::BNGetLinearViewObjectEnd)(__VA_ARGS__)
+#define BNGetLinearViewObjectIdentifier(...) ::BinaryNinja::ApiProfile::Instrument<883>(::BNGetLinearViewObjectIdentifier)(__VA_ARGS__)
+#define BNFreeLinearViewObjectIdentifier(...) ::BinaryNinja::ApiProfile::Instrument<884>(::BNFreeLinearViewObjectIdentifier)(__VA_ARGS__)
+#define BNCompareLinearViewObjectChildren(...) ::BinaryNinja::ApiProfile::Instrument<885>(::BNCompareLinearViewObjectChildren)(__VA_ARGS__)
+#define BNGetLinearViewObjectOrderingIndexTotal(...) ::BinaryNinja::ApiProfile::Instrument<886>(::BNGetLinearViewObjectOrderingIndexTotal)(__VA_ARGS__)
+#define BNGetLinearViewObjectOrderingIndexForChild(...) ::BinaryNinja::ApiProfile::Instrument<887>(::BNGetLinearViewObjectOrderingIndexForChild)(__VA_ARGS__)
+#define BNGetLinearViewObjectChildForOrderingIndex(...) ::BinaryNinja::ApiProfile::Instrument<888>(::BNGetLinearViewObjectChildForOrderingIndex)(__VA_ARGS__)
+#define BNCreateLinearViewCursor(...) ::BinaryNinja::ApiProfile::Instrument<889>(::BNCreateLinearViewCursor)(__VA_ARGS__)
+#define BNDuplicateLinearViewCursor(...) ::BinaryNinja::ApiProfile::Instrument<890>(::BNDuplicateLinearViewCursor)(__VA_ARGS__)
+#define BNNewLinearViewCursorReference(...) ::BinaryNinja::ApiProfile::Instrument<891>(::BNNewLinearViewCursorReference)(__VA_ARGS__)
+#define BNFreeLinearViewCursor(...) ::BinaryNinja::ApiProfile::Instrument<892>(::BNFreeLinearViewCursor)(__VA_ARGS__)
+#define BNIsLinearViewCursorBeforeBegin(...) ::BinaryNinja::ApiProfile::Instrument<893>(::BNIsLinearViewCursorBeforeBegin)(__VA_ARGS__)
+#define BNIsLinearViewCursorAfterEnd(...) ::BinaryNinja::ApiProfile::Instrument<894>(::BNIsLinearViewCursorAfterEnd)(__VA_ARGS__)
+#define BNGetLinearViewCursorCurrentObject(...) ::BinaryNinja::ApiProfile::Instrument<895>(::BNGetLinearViewCursorCurrentObject)(__VA_ARGS__)
+#define BNGetLinearViewCursorPath(...) ::BinaryNinja::ApiProfile::Instrument<896>(::BNGetLinearViewCursorPath)(__VA_ARGS__)
+#define BNFreeLinearViewCursorPath(...) ::BinaryNinja::ApiProfile::Instrument<897>(::BNFreeLinearViewCursorPath)(__VA_ARGS__)
+#define BNGetLinearViewCursorPathObjects(...) ::BinaryNinja::ApiProfile::Instrument<898>(::BNGetLinearViewCursorPathObjects)(__VA_ARGS__)
+#define BNFreeLinearViewCursorPathObjects(...) ::BinaryNinja::ApiProfile::Instrument<899>(::BNFreeLinearViewCursorPathObjects)(__VA_ARGS__)
+#define BNGetLinearViewCursorOrderingIndex(...) ::BinaryNinja::ApiProfile::Instrument<900>(::BNGetLinearViewCursorOrderingIndex)(__VA_ARGS__)
+#define BNGetLinearViewCursorOrderingIndexTotal(...) ::BinaryNinja::ApiProfile::Instrument<901>(::BNGetLinearViewCursorOrderingIndexTotal)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToBegin(...) ::BinaryNinja::ApiProfile::Instrument<902>(::BNSeekLinearViewCursorToBegin)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToEnd(...) ::BinaryNinja::ApiProfile::Instrument<903>(::BNSeekLinearViewCursorToEnd)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToAddress(...) ::BinaryNinja::ApiProfile::Instrument<904>(::BNSeekLinearViewCursorToAddress)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToPath(...) ::BinaryNinja::ApiProfile::Instrument<905>(::BNSeekLinearViewCursorToPath)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToPathAndAddress(...) ::BinaryNinja::ApiProfile::Instrument<906>(::BNSeekLinearViewCursorToPathAndAddress)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToCursorPath(...) ::BinaryNinja::ApiProfile::Instrument<907>(::BNSeekLinearViewCursorToCursorPath)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToCursorPathAndAddress(...) ::BinaryNinja::ApiProfile::Instrument<908>(::BNSeekLinearViewCursorToCursorPathAndAddress)(__VA_ARGS__)
+#define BNSeekLinearViewCursorToOrderingIndex(...) ::BinaryNinja::ApiProfile::Instrument<909>(::BNSeekLinearViewCursorToOrderingIndex)(__VA_ARGS__)
+#define BNLinearViewCursorNext(...) ::BinaryNinja::ApiProfile::Instrument<910>(::BNLinearViewCursorNext)(__VA_ARGS__)
+#define BNLinearViewCursorPrevious(...) ::BinaryNinja::ApiProfile::Instrument<911>(::BNLinearViewCursorPrevious)(__VA_ARGS__)
+#define BNGetLinearViewCursorLines(...) ::BinaryNinja::ApiProfile::Instrument<912>(::BNGetLinearViewCursorLines)(__VA_ARGS__)
+#define BNCompareLinearViewCursors(...) ::BinaryNinja::ApiProfile::Instrument<913>(::BNCompareLinearViewCursors)(__VA_ARGS__)
+#define BNDefineDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<914>(::BNDefineDataVariable)(__VA_ARGS__)
+#define BNDefineUserDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<915>(::BNDefineUserDataVariable)(__VA_ARGS__)
+#define BNUndefineDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<916>(::BNUndefineDataVariable)(__VA_ARGS__)
+#define BNUndefineUserDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<917>(::BNUndefineUserDataVariable)(__VA_ARGS__)
+#define BNGetDataVariables(...) ::BinaryNinja::ApiProfile::Instrument<918>(::BNGetDataVariables)(__VA_ARGS__)
+#define BNFreeDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<919>(::BNFreeDataVariable)(__VA_ARGS__)
+#define BNFreeDataVariables(...) ::BinaryNinja::ApiProfile::Instrument<920>(::BNFreeDataVariables)(__VA_ARGS__)
+#define BNFreeDataVariableAndName(...) ::BinaryNinja::ApiProfile::Instrument<921>(::BNFreeDataVariableAndName)(__VA_ARGS__)
+#define BNFreeDataVariablesAndName(...) ::BinaryNinja::ApiProfile::Instrument<922>(::BNFreeDataVariablesAndName)(__VA_ARGS__)
+#define BNFreeDataVariableAndNameAndDebugParserList(...) ::BinaryNinja::ApiProfile::Instrument<923>(::BNFreeDataVariableAndNameAndDebugParserList)(__VA_ARGS__)
+#define BNGetDataVariableAtAddress(...) ::BinaryNinja::ApiProfile::Instrument<924>(::BNGetDataVariableAtAddress)(__VA_ARGS__)
+#define BNParseTypeString(...) ::BinaryNinja::ApiProfile::Instrument<925>(::BNParseTypeString)(__VA_ARGS__)
+#define BNParseTypesString(...) ::BinaryNinja::ApiProfile::Instrument<926>(::BNParseTypesString)(__VA_ARGS__)
+#define BNFreeQualifiedNameAndType(...) ::BinaryNinja::ApiProfile::Instrument<927>(::BNFreeQualifiedNameAndType)(__VA_ARGS__)
+#define BNFreeQualifiedNameAndTypeArray(...) ::BinaryNinja::ApiProfile::Instrument<928>(::BNFreeQualifiedNameAndTypeArray)(__VA_ARGS__)
+#define BNFreeQualifiedNameTypeAndId(...) ::BinaryNinja::ApiProfile::Instrument<929>(::BNFreeQualifiedNameTypeAndId)(__VA_ARGS__)
+#define BNEscapeTypeName(...) ::BinaryNinja::ApiProfile::Instrument<930>(::BNEscapeTypeName)(__VA_ARGS__)
+#define BNUnescapeTypeName(...) ::BinaryNinja::ApiProfile::Instrument<931>(::BNUnescapeTypeName)(__VA_ARGS__)
+#define BNGetAnalysisTypeList(...) ::BinaryNinja::ApiProfile::Instrument<932>(::BNGetAnalysisTypeList)(__VA_ARGS__)
+#define BNGetAnalysisDependencySortedTypeList(...) ::BinaryNinja::ApiProfile::Instrument<933>(::BNGetAnalysisDependencySortedTypeList)(__VA_ARGS__)
+#define BNFreeTypeAndNameList(...) ::BinaryNinja::ApiProfile::Instrument<934>(::BNFreeTypeAndNameList)(__VA_ARGS__)
+#define BNFreeTypeIdList(...) ::BinaryNinja::ApiProfile::Instrument<935>(::BNFreeTypeIdList)(__VA_ARGS__)
+#define BNGetAnalysisTypeNames(...) ::BinaryNinja::ApiProfile::Instrument<936>(::BNGetAnalysisTypeNames)(__VA_ARGS__)
+#define BNFreeTypeNameList(...) ::BinaryNinja::ApiProfile::Instrument<937>(::BNFreeTypeNameList)(__VA_ARGS__)
+#define BNGetAnalysisTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<938>(::BNGetAnalysisTypeContainer)(__VA_ARGS__)
+#define BNGetAnalysisAutoTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<939>(::BNGetAnalysisAutoTypeContainer)(__VA_ARGS__)
+#define BNGetAnalysisUserTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<940>(::BNGetAnalysisUserTypeContainer)(__VA_ARGS__)
+#define BNGetAnalysisTypeByName(...) ::BinaryNinja::ApiProfile::Instrument<941>(::BNGetAnalysisTypeByName)(__VA_ARGS__)
+#define BNGetAnalysisTypeByRef(...) ::BinaryNinja::ApiProfile::Instrument<942>(::BNGetAnalysisTypeByRef)(__VA_ARGS__)
+#define BNGetAnalysisTypeById(...) ::BinaryNinja::ApiProfile::Instrument<943>(::BNGetAnalysisTypeById)(__VA_ARGS__)
+#define BNGetAnalysisTypeId(...) ::BinaryNinja::ApiProfile::Instrument<944>(::BNGetAnalysisTypeId)(__VA_ARGS__)
+#define BNGetAnalysisTypeNameById(...) ::BinaryNinja::ApiProfile::Instrument<945>(::BNGetAnalysisTypeNameById)(__VA_ARGS__)
+#define BNIsAnalysisTypeAutoDefined(...) ::BinaryNinja::ApiProfile::Instrument<946>(::BNIsAnalysisTypeAutoDefined)(__VA_ARGS__)
+#define BNDefineAnalysisType(...) ::BinaryNinja::ApiProfile::Instrument<947>(::BNDefineAnalysisType)(__VA_ARGS__)
+#define BNDefineUserAnalysisType(...) ::BinaryNinja::ApiProfile::Instrument<948>(::BNDefineUserAnalysisType)(__VA_ARGS__)
+#define BNDefineAnalysisTypes(...) ::BinaryNinja::ApiProfile::Instrument<949>(::BNDefineAnalysisTypes)(__VA_ARGS__)
+#define BNDefineUserAnalysisTypes(...) ::BinaryNinja::ApiProfile::Instrument<950>(::BNDefineUserAnalysisTypes)(__VA_ARGS__)
+#define BNUndefineAnalysisType(...) ::BinaryNinja::ApiProfile::Instrument<951>(::BNUndefineAnalysisType)(__VA_ARGS__)
+#define BNUndefineUserAnalysisType(...) ::BinaryNinja::ApiProfile::Instrument<952>(::BNUndefineUserAnalysisType)(__VA_ARGS__)
+#define BNRenameAnalysisType(...) ::BinaryNinja::ApiProfile::Instrument<953>(::BNRenameAnalysisType)(__VA_ARGS__)
+#define BNGenerateAutoTypeId(...) ::BinaryNinja::ApiProfile::Instrument<954>(::BNGenerateAutoTypeId)(__VA_ARGS__)
+#define BNGenerateAutoPlatformTypeId(...) ::BinaryNinja::ApiProfile::Instrument<955>(::BNGenerateAutoPlatformTypeId)(__VA_ARGS__)
+#define BNGenerateAutoDemangledTypeId(...) ::BinaryNinja::ApiProfile::Instrument<956>(::BNGenerateAutoDemangledTypeId)(__VA_ARGS__)
+#define BNGetAutoPlatformTypeIdSource(...) ::BinaryNinja::ApiProfile::Instrument<957>(::BNGetAutoPlatformTypeIdSource)(__VA_ARGS__)
+#define BNGetAutoDemangledTypeIdSource(...) ::BinaryNinja::ApiProfile::Instrument<958>(::BNGetAutoDemangledTypeIdSource)(__VA_ARGS__)
+#define BNGenerateAutoDebugTypeId(...) ::BinaryNinja::ApiProfile::Instrument<959>(::BNGenerateAutoDebugTypeId)(__VA_ARGS__)
+#define BNGetAutoDebugTypeIdSource(...) ::BinaryNinja::ApiProfile::Instrument<960>(::BNGetAutoDebugTypeIdSource)(__VA_ARGS__)
+#define BNRegisterPlatformTypes(...) ::BinaryNinja::ApiProfile::Instrument<961>(::BNRegisterPlatformTypes)(__VA_ARGS__)
+#define BNLookupImportedTypePlatform(...) ::BinaryNinja::ApiProfile::Instrument<962>(::BNLookupImportedTypePlatform)(__VA_ARGS__)
+#define BNReanalyzeAllFunctions(...) ::BinaryNinja::ApiProfile::Instrument<963>(::BNReanalyzeAllFunctions)(__VA_ARGS__)
+#define BNReanalyzeFunction(...) ::BinaryNinja::ApiProfile::Instrument<964>(::BNReanalyzeFunction)(__VA_ARGS__)
+#define BNMarkUpdatesRequired(...) ::BinaryNinja::ApiProfile::Instrument<965>(::BNMarkUpdatesRequired)(__VA_ARGS__)
+#define BNMarkCallerUpdatesRequired(...) ::BinaryNinja::ApiProfile::Instrument<966>(::BNMarkCallerUpdatesRequired)(__VA_ARGS__)
+#define BNGetWorkflowForBinaryView(...) ::BinaryNinja::ApiProfile::Instrument<967>(::BNGetWorkflowForBinaryView)(__VA_ARGS__)
+#define BNGetWorkflowForFunction(...) ::BinaryNinja::ApiProfile::Instrument<968>(::BNGetWorkflowForFunction)(__VA_ARGS__)
+#define BNPostWorkflowRequestForFunction(...) ::BinaryNinja::ApiProfile::Instrument<969>(::BNPostWorkflowRequestForFunction)(__VA_ARGS__)
+#define BNGetProvenanceString(...) ::BinaryNinja::ApiProfile::Instrument<970>(::BNGetProvenanceString)(__VA_ARGS__)
+#define BNGetInstructionHighlight(...) ::BinaryNinja::ApiProfile::Instrument<971>(::BNGetInstructionHighlight)(__VA_ARGS__)
+#define BNSetAutoInstructionHighlight(...) ::BinaryNinja::ApiProfile::Instrument<972>(::BNSetAutoInstructionHighlight)(__VA_ARGS__)
+#define BNSetUserInstructionHighlight(...) ::BinaryNinja::ApiProfile::Instrument<973>(::BNSetUserInstructionHighlight)(__VA_ARGS__)
+#define BNGetBasicBlockHighlight(...) ::BinaryNinja::ApiProfile::Instrument<974>(::BNGetBasicBlockHighlight)(__VA_ARGS__)
+#define BNSetAutoBasicBlockHighlight(...) ::BinaryNinja::ApiProfile::Instrument<975>(::BNSetAutoBasicBlockHighlight)(__VA_ARGS__)
+#define BNSetUserBasicBlockHighlight(...) ::BinaryNinja::ApiProfile::Instrument<976>(::BNSetUserBasicBlockHighlight)(__VA_ARGS__)
+#define BNFreeTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<977>(::BNFreeTypeContainer)(__VA_ARGS__)
+#define BNDuplicateTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<978>(::BNDuplicateTypeContainer)(__VA_ARGS__)
+#define BNTypeContainerGetId(...) ::BinaryNinja::ApiProfile::Instrument<979>(::BNTypeContainerGetId)(__VA_ARGS__)
+#define BNTypeContainerGetName(...) ::BinaryNinja::ApiProfile::Instrument<980>(::BNTypeContainerGetName)(__VA_ARGS__)
+#define BNTypeContainerGetType(...) ::BinaryNinja::ApiProfile::Instrument<981>(::BNTypeContainerGetType)(__VA_ARGS__)
+#define BNTypeContainerIsMutable(...) ::BinaryNinja::ApiProfile::Instrument<982>(::BNTypeContainerIsMutable)(__VA_ARGS__)
+#define BNTypeContainerGetPlatform(...) ::BinaryNinja::ApiProfile::Instrument<983>(::BNTypeContainerGetPlatform)(__VA_ARGS__)
+#define BNTypeContainerAddTypes(...) ::BinaryNinja::ApiProfile::Instrument<984>(::BNTypeContainerAddTypes)(__VA_ARGS__)
+#define BNTypeContainerRenameType(...) ::BinaryNinja::ApiProfile::Instrument<985>(::BNTypeContainerRenameType)(__VA_ARGS__)
+#define BNTypeContainerDeleteType(...) ::BinaryNinja::ApiProfile::Instrument<986>(::BNTypeContainerDeleteType)(__VA_ARGS__)
+#define BNTypeContainerGetTypeId(...) ::BinaryNinja::ApiProfile::Instrument<987>(::BNTypeContainerGetTypeId)(__VA_ARGS__)
+#define BNTypeContainerGetTypeName(...) ::BinaryNinja::ApiProfile::Instrument<988>(::BNTypeContainerGetTypeName)(__VA_ARGS__)
+#define BNTypeContainerGetTypeById(...) ::BinaryNinja::ApiProfile::Instrument<989>(::BNTypeContainerGetTypeById)(__VA_ARGS__)
+#define BNTypeContainerGetTypes(...) ::BinaryNinja::ApiProfile::Instrument<990>(::BNTypeContainerGetTypes)(__VA_ARGS__)
+#define BNTypeContainerGetTypeByName(...) ::BinaryNinja::ApiProfile::Instrument<991>(::BNTypeContainerGetTypeByName)(__VA_ARGS__)
+#define BNTypeContainerGetTypeIds(...) ::BinaryNinja::ApiProfile::Instrument<992>(::BNTypeContainerGetTypeIds)(__VA_ARGS__)
+#define BNTypeContainerGetTypeNames(...) ::BinaryNinja::ApiProfile::Instrument<993>(::BNTypeContainerGetTypeNames)(__VA_ARGS__)
+#define BNTypeContainerGetTypeNamesAndIds(...) ::BinaryNinja::ApiProfile::Instrument<994>(::BNTypeContainerGetTypeNamesAndIds)(__VA_ARGS__)
+#define BNTypeContainerParseTypesFromSource(...) ::BinaryNinja::ApiProfile::Instrument<995>(::BNTypeContainerParseTypesFromSource)(__VA_ARGS__)
+#define BNCreateTagType(...) ::BinaryNinja::ApiProfile::Instrument<996>(::BNCreateTagType)(__VA_ARGS__)
+#define BNNewTagTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<997>(::BNNewTagTypeReference)(__VA_ARGS__)
+#define BNFreeTagType(...) ::BinaryNinja::ApiProfile::Instrument<998>(::BNFreeTagType)(__VA_ARGS__)
+#define BNFreeTagTypeList(...) ::BinaryNinja::ApiProfile::Instrument<999>(::BNFreeTagTypeList)(__VA_ARGS__)
+#define BNTagTypeGetView(...) ::BinaryNinja::ApiProfile::Instrument<1000>(::BNTagTypeGetView)(__VA_ARGS__)
+#define BNTagTypeGetId(...) ::BinaryNinja::ApiProfile::Instrument<1001>(::BNTagTypeGetId)(__VA_ARGS__)
+#define BNTagTypeGetName(...) ::BinaryNinja::ApiProfile::Instrument<1002>(::BNTagTypeGetName)(__VA_ARGS__)
+#define BNTagTypeSetName(...) ::BinaryNinja::ApiProfile::Instrument<1003>(::BNTagTypeSetName)(__VA_ARGS__)
+#define BNTagTypeGetIcon(...) ::BinaryNinja::ApiProfile::Instrument<1004>(::BNTagTypeGetIcon)(__VA_ARGS__)
+#define BNTagTypeSetIcon(...) ::BinaryNinja::ApiProfile::Instrument<1005>(::BNTagTypeSetIcon)(__VA_ARGS__)
+#define BNTagTypeGetVisible(...) ::BinaryNinja::ApiProfile::Instrument<1006>(::BNTagTypeGetVisible)(__VA_ARGS__)
+#define BNTagTypeSetVisible(...) ::BinaryNinja::ApiProfile::Instrument<1007>(::BNTagTypeSetVisible)(__VA_ARGS__)
+#define BNTagTypeGetType(...) ::BinaryNinja::ApiProfile::Instrument<1008>(::BNTagTypeGetType)(__VA_ARGS__)
+#define BNTagTypeSetType(...) ::BinaryNinja::ApiProfile::Instrument<1009>(::BNTagTypeSetType)(__VA_ARGS__)
+#define BNCreateTag(...) ::BinaryNinja::ApiProfile::Instrument<1010>(::BNCreateTag)(__VA_ARGS__)
+#define BNNewTagReference(...) ::BinaryNinja::ApiProfile::Instrument<1011>(::BNNewTagReference)(__VA_ARGS__)
+#define BNFreeTag(...) ::BinaryNinja::ApiProfile::Instrument<1012>(::BNFreeTag)(__VA_ARGS__)
+#define BNFreeTagList(...) ::BinaryNinja::ApiProfile::Instrument<1013>(::BNFreeTagList)(__VA_ARGS__)
+#define BNTagGetId(...) ::BinaryNinja::ApiProfile::Instrument<1014>(::BNTagGetId)(__VA_ARGS__)
+#define BNTagGetType(...) ::BinaryNinja::ApiProfile::Instrument<1015>(::BNTagGetType)(__VA_ARGS__)
+#define BNTagGetData(...) ::BinaryNinja::ApiProfile::Instrument<1016>(::BNTagGetData)(__VA_ARGS__)
+#define BNTagSetData(...) ::BinaryNinja::ApiProfile::Instrument<1017>(::BNTagSetData)(__VA_ARGS__)
+#define BNAddTagType(...) ::BinaryNinja::ApiProfile::Instrument<1018>(::BNAddTagType)(__VA_ARGS__)
+#define BNRemoveTagType(...) ::BinaryNinja::ApiProfile::Instrument<1019>(::BNRemoveTagType)(__VA_ARGS__)
+#define BNGetTagType(...) ::BinaryNinja::ApiProfile::Instrument<1020>(::BNGetTagType)(__VA_ARGS__)
+#define BNGetTagTypeWithType(...) ::BinaryNinja::ApiProfile::Instrument<1021>(::BNGetTagTypeWithType)(__VA_ARGS__)
+#define BNGetTagTypeById(...) ::BinaryNinja::ApiProfile::Instrument<1022>(::BNGetTagTypeById)(__VA_ARGS__)
+#define BNGetTagTypeByIdWithType(...) ::BinaryNinja::ApiProfile::Instrument<1023>(::BNGetTagTypeByIdWithType)(__VA_ARGS__)
+#define BNGetTagTypes(...) ::BinaryNinja::ApiProfile::Instrument<1024>(::BNGetTagTypes)(__VA_ARGS__)
+#define BNAddTag(...) ::BinaryNinja::ApiProfile::Instrument<1025>(::BNAddTag)(__VA_ARGS__)
+#define BNGetTag(...) ::BinaryNinja::ApiProfile::Instrument<1026>(::BNGetTag)(__VA_ARGS__)
+#define BNRemoveTag(...) ::BinaryNinja::ApiProfile::Instrument<1027>(::BNRemoveTag)(__VA_ARGS__)
+#define BNGetAllTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1028>(::BNGetAllTagReferences)(__VA_ARGS__)
+#define BNGetAllAddressTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1029>(::BNGetAllAddressTagReferences)(__VA_ARGS__)
+#define BNGetAllFunctionTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1030>(::BNGetAllFunctionTagReferences)(__VA_ARGS__)
+#define BNGetAllTagReferencesOfType(...) ::BinaryNinja::ApiProfile::Instrument<1031>(::BNGetAllTagReferencesOfType)(__VA_ARGS__)
+#define BNGetTagReferencesOfType(...) ::BinaryNinja::ApiProfile::Instrument<1032>(::BNGetTagReferencesOfType)(__VA_ARGS__)
+#define BNGetDataTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1033>(::BNGetDataTagReferences)(__VA_ARGS__)
+#define BNGetAutoDataTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1034>(::BNGetAutoDataTagReferences)(__VA_ARGS__)
+#define BNGetUserDataTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1035>(::BNGetUserDataTagReferences)(__VA_ARGS__)
+#define BNRemoveTagReference(...) ::BinaryNinja::ApiProfile::Instrument<1036>(::BNRemoveTagReference)(__VA_ARGS__)
+#define BNFreeTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1037>(::BNFreeTagReferences)(__VA_ARGS__)
+#define BNGetDataTags(...) ::BinaryNinja::ApiProfile::Instrument<1038>(::BNGetDataTags)(__VA_ARGS__)
+#define BNGetAutoDataTags(...) ::BinaryNinja::ApiProfile::Instrument<1039>(::BNGetAutoDataTags)(__VA_ARGS__)
+#define BNGetUserDataTags(...) ::BinaryNinja::ApiProfile::Instrument<1040>(::BNGetUserDataTags)(__VA_ARGS__)
+#define BNGetDataTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1041>(::BNGetDataTagsOfType)(__VA_ARGS__)
+#define BNGetAutoDataTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1042>(::BNGetAutoDataTagsOfType)(__VA_ARGS__)
+#define BNGetUserDataTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1043>(::BNGetUserDataTagsOfType)(__VA_ARGS__)
+#define BNGetDataTagsInRange(...) ::BinaryNinja::ApiProfile::Instrument<1044>(::BNGetDataTagsInRange)(__VA_ARGS__)
+#define BNGetAutoDataTagsInRange(...) ::BinaryNinja::ApiProfile::Instrument<1045>(::BNGetAutoDataTagsInRange)(__VA_ARGS__)
+#define BNGetUserDataTagsInRange(...) ::BinaryNinja::ApiProfile::Instrument<1046>(::BNGetUserDataTagsInRange)(__VA_ARGS__)
+#define BNAddAutoDataTag(...) ::BinaryNinja::ApiProfile::Instrument<1047>(::BNAddAutoDataTag)(__VA_ARGS__)
+#define BNRemoveAutoDataTag(...) ::BinaryNinja::ApiProfile::Instrument<1048>(::BNRemoveAutoDataTag)(__VA_ARGS__)
+#define BNRemoveAutoDataTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1049>(::BNRemoveAutoDataTagsOfType)(__VA_ARGS__)
+#define BNAddUserDataTag(...) ::BinaryNinja::ApiProfile::Instrument<1050>(::BNAddUserDataTag)(__VA_ARGS__)
+#define BNRemoveUserDataTag(...) ::BinaryNinja::ApiProfile::Instrument<1051>(::BNRemoveUserDataTag)(__VA_ARGS__)
+#define BNRemoveUserDataTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1052>(::BNRemoveUserDataTagsOfType)(__VA_ARGS__)
+#define BNGetTagReferencesOfTypeCount(...) ::BinaryNinja::ApiProfile::Instrument<1053>(::BNGetTagReferencesOfTypeCount)(__VA_ARGS__)
+#define BNGetAllTagReferencesOfTypeCount(...) ::BinaryNinja::ApiProfile::Instrument<1054>(::BNGetAllTagReferencesOfTypeCount)(__VA_ARGS__)
+#define BNGetAllTagReferenceTypeCounts(...) ::BinaryNinja::ApiProfile::Instrument<1055>(::BNGetAllTagReferenceTypeCounts)(__VA_ARGS__)
+#define BNFreeTagReferenceTypeCounts(...) ::BinaryNinja::ApiProfile::Instrument<1056>(::BNFreeTagReferenceTypeCounts)(__VA_ARGS__)
+#define BNGetFunctionAllTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1057>(::BNGetFunctionAllTagReferences)(__VA_ARGS__)
+#define BNGetFunctionTagReferencesOfType(...) ::BinaryNinja::ApiProfile::Instrument<1058>(::BNGetFunctionTagReferencesOfType)(__VA_ARGS__)
+#define BNGetAddressTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1059>(::BNGetAddressTagReferences)(__VA_ARGS__)
+#define BNGetAutoAddressTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1060>(::BNGetAutoAddressTagReferences)(__VA_ARGS__)
+#define BNGetUserAddressTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1061>(::BNGetUserAddressTagReferences)(__VA_ARGS__)
+#define BNGetAddressTags(...) ::BinaryNinja::ApiProfile::Instrument<1062>(::BNGetAddressTags)(__VA_ARGS__)
+#define BNGetAutoAddressTags(...) ::BinaryNinja::ApiProfile::Instrument<1063>(::BNGetAutoAddressTags)(__VA_ARGS__)
+#define BNGetUserAddressTags(...) ::BinaryNinja::ApiProfile::Instrument<1064>(::BNGetUserAddressTags)(__VA_ARGS__)
+#define BNGetAddressTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1065>(::BNGetAddressTagsOfType)(__VA_ARGS__)
+#define BNGetAutoAddressTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1066>(::BNGetAutoAddressTagsOfType)(__VA_ARGS__)
+#define BNGetUserAddressTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1067>(::BNGetUserAddressTagsOfType)(__VA_ARGS__)
+#define BNGetAddressTagsInRange(...) ::BinaryNinja::ApiProfile::Instrument<1068>(::BNGetAddressTagsInRange)(__VA_ARGS__)
+#define BNGetAutoAddressTagsInRange(...) ::BinaryNinja::ApiProfile::Instrument<1069>(::BNGetAutoAddressTagsInRange)(__VA_ARGS__)
+#define BNGetUserAddressTagsInRange(...) ::BinaryNinja::ApiProfile::Instrument<1070>(::BNGetUserAddressTagsInRange)(__VA_ARGS__)
+#define BNAddAutoAddressTag(...) ::BinaryNinja::ApiProfile::Instrument<1071>(::BNAddAutoAddressTag)(__VA_ARGS__)
+#define BNRemoveAutoAddressTag(...) ::BinaryNinja::ApiProfile::Instrument<1072>(::BNRemoveAutoAddressTag)(__VA_ARGS__)
+#define BNRemoveAutoAddressTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1073>(::BNRemoveAutoAddressTagsOfType)(__VA_ARGS__)
+#define BNAddUserAddressTag(...) ::BinaryNinja::ApiProfile::Instrument<1074>(::BNAddUserAddressTag)(__VA_ARGS__)
+#define BNRemoveUserAddressTag(...) ::BinaryNinja::ApiProfile::Instrument<1075>(::BNRemoveUserAddressTag)(__VA_ARGS__)
+#define BNRemoveUserAddressTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1076>(::BNRemoveUserAddressTagsOfType)(__VA_ARGS__)
+#define BNGetFunctionTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1077>(::BNGetFunctionTagReferences)(__VA_ARGS__)
+#define BNGetAutoFunctionTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1078>(::BNGetAutoFunctionTagReferences)(__VA_ARGS__)
+#define BNGetUserFunctionTagReferences(...) ::BinaryNinja::ApiProfile::Instrument<1079>(::BNGetUserFunctionTagReferences)(__VA_ARGS__)
+#define BNGetFunctionTags(...) ::BinaryNinja::ApiProfile::Instrument<1080>(::BNGetFunctionTags)(__VA_ARGS__)
+#define BNGetAutoFunctionTags(...) ::BinaryNinja::ApiProfile::Instrument<1081>(::BNGetAutoFunctionTags)(__VA_ARGS__)
+#define BNGetUserFunctionTags(...) ::BinaryNinja::ApiProfile::Instrument<1082>(::BNGetUserFunctionTags)(__VA_ARGS__)
+#define BNGetFunctionTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1083>(::BNGetFunctionTagsOfType)(__VA_ARGS__)
+#define BNGetAutoFunctionTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1084>(::BNGetAutoFunctionTagsOfType)(__VA_ARGS__)
+#define BNGetUserFunctionTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1085>(::BNGetUserFunctionTagsOfType)(__VA_ARGS__)
+#define BNAddAutoFunctionTag(...) ::BinaryNinja::ApiProfile::Instrument<1086>(::BNAddAutoFunctionTag)(__VA_ARGS__)
+#define BNRemoveAutoFunctionTag(...) ::BinaryNinja::ApiProfile::Instrument<1087>(::BNRemoveAutoFunctionTag)(__VA_ARGS__)
+#define BNRemoveAutoFunctionTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1088>(::BNRemoveAutoFunctionTagsOfType)(__VA_ARGS__)
+#define BNAddUserFunctionTag(...) ::BinaryNinja::ApiProfile::Instrument<1089>(::BNAddUserFunctionTag)(__VA_ARGS__)
+#define BNRemoveUserFunctionTag(...) ::BinaryNinja::ApiProfile::Instrument<1090>(::BNRemoveUserFunctionTag)(__VA_ARGS__)
+#define BNRemoveUserFunctionTagsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1091>(::BNRemoveUserFunctionTagsOfType)(__VA_ARGS__)
+#define BNGetFunctionAnalysisPerformanceInfo(...) ::BinaryNinja::ApiProfile::Instrument<1092>(::BNGetFunctionAnalysisPerformanceInfo)(__VA_ARGS__)
+#define BNFreeAnalysisPerformanceInfo(...) ::BinaryNinja::ApiProfile::Instrument<1093>(::BNFreeAnalysisPerformanceInfo)(__VA_ARGS__)
+#define BNGetUnresolvedStackAdjustmentGraph(...) ::BinaryNinja::ApiProfile::Instrument<1094>(::BNGetUnresolvedStackAdjustmentGraph)(__VA_ARGS__)
+#define BNSetUserVariableValue(...) ::BinaryNinja::ApiProfile::Instrument<1095>(::BNSetUserVariableValue)(__VA_ARGS__)
+#define BNClearUserVariableValue(...) ::BinaryNinja::ApiProfile::Instrument<1096>(::BNClearUserVariableValue)(__VA_ARGS__)
+#define BNGetAllUserVariableValues(...) ::BinaryNinja::ApiProfile::Instrument<1097>(::BNGetAllUserVariableValues)(__VA_ARGS__)
+#define BNFreeUserVariableValues(...) ::BinaryNinja::ApiProfile::Instrument<1098>(::BNFreeUserVariableValues)(__VA_ARGS__)
+#define BNParsePossibleValueSet(...) ::BinaryNinja::ApiProfile::Instrument<1099>(::BNParsePossibleValueSet)(__VA_ARGS__)
+#define BNRequestFunctionDebugReport(...) ::BinaryNinja::ApiProfile::Instrument<1100>(::BNRequestFunctionDebugReport)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableReferences(...) ::BinaryNinja::ApiProfile::Instrument<1101>(::BNGetMediumLevelILVariableReferences)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableReferencesFrom(...) ::BinaryNinja::ApiProfile::Instrument<1102>(::BNGetMediumLevelILVariableReferencesFrom)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableReferencesInRange(...) ::BinaryNinja::ApiProfile::Instrument<1103>(::BNGetMediumLevelILVariableReferencesInRange)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableReferencesIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<1104>(::BNGetMediumLevelILVariableReferencesIfAvailable)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableReferencesFromIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<1105>(::BNGetMediumLevelILVariableReferencesFromIfAvailable)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableReferencesInRangeIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<1106>(::BNGetMediumLevelILVariableReferencesInRangeIfAvailable)(__VA_ARGS__)
+#define BNGetHighLevelILVariableReferences(...) ::BinaryNinja::ApiProfile::Instrument<1107>(::BNGetHighLevelILVariableReferences)(__VA_ARGS__)
+#define BNGetHighLevelILVariableReferencesFrom(...) ::BinaryNinja::ApiProfile::Instrument<1108>(::BNGetHighLevelILVariableReferencesFrom)(__VA_ARGS__)
+#define BNGetHighLevelILVariableReferencesInRange(...) ::BinaryNinja::ApiProfile::Instrument<1109>(::BNGetHighLevelILVariableReferencesInRange)(__VA_ARGS__)
+#define BNGetHighLevelILVariableReferencesIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<1110>(::BNGetHighLevelILVariableReferencesIfAvailable)(__VA_ARGS__)
+#define BNGetHighLevelILVariableReferencesFromIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<1111>(::BNGetHighLevelILVariableReferencesFromIfAvailable)(__VA_ARGS__)
+#define BNGetHighLevelILVariableReferencesInRangeIfAvailable(...) ::BinaryNinja::ApiProfile::Instrument<1112>(::BNGetHighLevelILVariableReferencesInRangeIfAvailable)(__VA_ARGS__)
+#define BNFreeVariableList(...) ::BinaryNinja::ApiProfile::Instrument<1113>(::BNFreeVariableList)(__VA_ARGS__)
+#define BNFreeVariableReferenceSourceList(...) ::BinaryNinja::ApiProfile::Instrument<1114>(::BNFreeVariableReferenceSourceList)(__VA_ARGS__)
+#define BNCreateAnalysisContext(...) ::BinaryNinja::ApiProfile::Instrument<1115>(::BNCreateAnalysisContext)(__VA_ARGS__)
+#define BNNewAnalysisContextReference(...) ::BinaryNinja::ApiProfile::Instrument<1116>(::BNNewAnalysisContextReference)(__VA_ARGS__)
+#define BNFreeAnalysisContext(...) ::BinaryNinja::ApiProfile::Instrument<1117>(::BNFreeAnalysisContext)(__VA_ARGS__)
+#define BNAnalysisContextGetFunction(...) ::BinaryNinja::ApiProfile::Instrument<1118>(::BNAnalysisContextGetFunction)(__VA_ARGS__)
+#define BNAnalysisContextGetLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1119>(::BNAnalysisContextGetLowLevelILFunction)(__VA_ARGS__)
+#define BNAnalysisContextGetMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1120>(::BNAnalysisContextGetMediumLevelILFunction)(__VA_ARGS__)
+#define BNAnalysisContextGetHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1121>(::BNAnalysisContextGetHighLevelILFunction)(__VA_ARGS__)
+#define BNSetBasicBlockList(...) ::BinaryNinja::ApiProfile::Instrument<1122>(::BNSetBasicBlockList)(__VA_ARGS__)
+#define BNSetLiftedILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1123>(::BNSetLiftedILFunction)(__VA_ARGS__)
+#define BNSetLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1124>(::BNSetLowLevelILFunction)(__VA_ARGS__)
+#define BNSetMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1125>(::BNSetMediumLevelILFunction)(__VA_ARGS__)
+#define BNSetHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1126>(::BNSetHighLevelILFunction)(__VA_ARGS__)
+#define BNAnalysisContextInform(...) ::BinaryNinja::ApiProfile::Instrument<1127>(::BNAnalysisContextInform)(__VA_ARGS__)
+#define BNCreateActivity(...) ::BinaryNinja::ApiProfile::Instrument<1128>(::BNCreateActivity)(__VA_ARGS__)
+#define BNNewActivityReference(...) ::BinaryNinja::ApiProfile::Instrument<1129>(::BNNewActivityReference)(__VA_ARGS__)
+#define BNFreeActivity(...) ::BinaryNinja::ApiProfile::Instrument<1130>(::BNFreeActivity)(__VA_ARGS__)
+#define BNActivityGetName(...) ::BinaryNinja::ApiProfile::Instrument<1131>(::BNActivityGetName)(__VA_ARGS__)
+#define BNCreateWorkflow(...) ::BinaryNinja::ApiProfile::Instrument<1132>(::BNCreateWorkflow)(__VA_ARGS__)
+#define BNNewWorkflowReference(...) ::BinaryNinja::ApiProfile::Instrument<1133>(::BNNewWorkflowReference)(__VA_ARGS__)
+#define BNFreeWorkflow(...) ::BinaryNinja::ApiProfile::Instrument<1134>(::BNFreeWorkflow)(__VA_ARGS__)
+#define BNGetWorkflowList(...) ::BinaryNinja::ApiProfile::Instrument<1135>(::BNGetWorkflowList)(__VA_ARGS__)
+#define BNFreeWorkflowList(...) ::BinaryNinja::ApiProfile::Instrument<1136>(::BNFreeWorkflowList)(__VA_ARGS__)
+#define BNWorkflowInstance(...) ::BinaryNinja::ApiProfile::Instrument<1137>(::BNWorkflowInstance)(__VA_ARGS__)
+#define BNRegisterWorkflow(...) ::BinaryNinja::ApiProfile::Instrument<1138>(::BNRegisterWorkflow)(__VA_ARGS__)
+#define BNWorkflowClone(...) ::BinaryNinja::ApiProfile::Instrument<1139>(::BNWorkflowClone)(__VA_ARGS__)
+#define BNWorkflowRegisterActivity(...) ::BinaryNinja::ApiProfile::Instrument<1140>(::BNWorkflowRegisterActivity)(__VA_ARGS__)
+#define BNWorkflowContains(...) ::BinaryNinja::ApiProfile::Instrument<1141>(::BNWorkflowContains)(__VA_ARGS__)
+#define BNWorkflowGetConfiguration(...) ::BinaryNinja::ApiProfile::Instrument<1142>(::BNWorkflowGetConfiguration)(__VA_ARGS__)
+#define BNGetWorkflowName(...) ::BinaryNinja::ApiProfile::Instrument<1143>(::BNGetWorkflowName)(__VA_ARGS__)
+#define BNWorkflowIsRegistered(...) ::BinaryNinja::ApiProfile::Instrument<1144>(::BNWorkflowIsRegistered)(__VA_ARGS__)
+#define BNWorkflowSize(...) ::BinaryNinja::ApiProfile::Instrument<1145>(::BNWorkflowSize)(__VA_ARGS__)
+#define BNWorkflowGetActivity(...) ::BinaryNinja::ApiProfile::Instrument<1146>(::BNWorkflowGetActivity)(__VA_ARGS__)
+#define BNWorkflowGetActivityRoots(...) ::BinaryNinja::ApiProfile::Instrument<1147>(::BNWorkflowGetActivityRoots)(__VA_ARGS__)
+#define BNWorkflowGetSubactivities(...) ::BinaryNinja::ApiProfile::Instrument<1148>(::BNWorkflowGetSubactivities)(__VA_ARGS__)
+#define BNWorkflowAssignSubactivities(...) ::BinaryNinja::ApiProfile::Instrument<1149>(::BNWorkflowAssignSubactivities)(__VA_ARGS__)
+#define BNWorkflowClear(...) ::BinaryNinja::ApiProfile::Instrument<1150>(::BNWorkflowClear)(__VA_ARGS__)
+#define BNWorkflowInsert(...) ::BinaryNinja::ApiProfile::Instrument<1151>(::BNWorkflowInsert)(__VA_ARGS__)
+#define BNWorkflowRemove(...) ::BinaryNinja::ApiProfile::Instrument<1152>(::BNWorkflowRemove)(__VA_ARGS__)
+#define BNWorkflowReplace(...) ::BinaryNinja::ApiProfile::Instrument<1153>(::BNWorkflowReplace)(__VA_ARGS__)
+#define BNWorkflowGetGraph(...) ::BinaryNinja::ApiProfile::Instrument<1154>(::BNWorkflowGetGraph)(__VA_ARGS__)
+#define BNWorkflowShowReport(...) ::BinaryNinja::ApiProfile::Instrument<1155>(::BNWorkflowShowReport)(__VA_ARGS__)
+#define BNCreateDisassemblySettings(...) ::BinaryNinja::ApiProfile::Instrument<1156>(::BNCreateDisassemblySettings)(__VA_ARGS__)
+#define BNNewDisassemblySettingsReference(...) ::BinaryNinja::ApiProfile::Instrument<1157>(::BNNewDisassemblySettingsReference)(__VA_ARGS__)
+#define BNDuplicateDisassemblySettings(...) ::BinaryNinja::ApiProfile::Instrument<1158>(::BNDuplicateDisassemblySettings)(__VA_ARGS__)
+#define BNFreeDisassemblySettings(...) ::BinaryNinja::ApiProfile::Instrument<1159>(::BNFreeDisassemblySettings)(__VA_ARGS__)
+#define BNIsDisassemblySettingsOptionSet(...) ::BinaryNinja::ApiProfile::Instrument<1160>(::BNIsDisassemblySettingsOptionSet)(__VA_ARGS__)
+#define BNSetDisassemblySettingsOption(...) ::BinaryNinja::ApiProfile::Instrument<1161>(::BNSetDisassemblySettingsOption)(__VA_ARGS__)
+#define BNGetDisassemblyWidth(...) ::BinaryNinja::ApiProfile::Instrument<1162>(::BNGetDisassemblyWidth)(__VA_ARGS__)
+#define BNSetDisassemblyWidth(...) ::BinaryNinja::ApiProfile::Instrument<1163>(::BNSetDisassemblyWidth)(__VA_ARGS__)
+#define BNGetDisassemblyMaximumSymbolWidth(...) ::BinaryNinja::ApiProfile::Instrument<1164>(::BNGetDisassemblyMaximumSymbolWidth)(__VA_ARGS__)
+#define BNSetDisassemblyMaximumSymbolWidth(...) ::BinaryNinja::ApiProfile::Instrument<1165>(::BNSetDisassemblyMaximumSymbolWidth)(__VA_ARGS__)
+#define BNGetDisassemblyGutterWidth(...) ::BinaryNinja::ApiProfile::Instrument<1166>(::BNGetDisassemblyGutterWidth)(__VA_ARGS__)
+#define BNSetDisassemblyGutterWidth(...) ::BinaryNinja::ApiProfile::Instrument<1167>(::BNSetDisassemblyGutterWidth)(__VA_ARGS__)
+#define BNCreateFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1168>(::BNCreateFlowGraph)(__VA_ARGS__)
+#define BNCreateFunctionGraph(...) ::BinaryNinja::ApiProfile::Instrument<1169>(::BNCreateFunctionGraph)(__VA_ARGS__)
+#define BNCreateLowLevelILFunctionGraph(...) ::BinaryNinja::ApiProfile::Instrument<1170>(::BNCreateLowLevelILFunctionGraph)(__VA_ARGS__)
+#define BNCreateMediumLevelILFunctionGraph(...) ::BinaryNinja::ApiProfile::Instrument<1171>(::BNCreateMediumLevelILFunctionGraph)(__VA_ARGS__)
+#define BNCreateHighLevelILFunctionGraph(...) ::BinaryNinja::ApiProfile::Instrument<1172>(::BNCreateHighLevelILFunctionGraph)(__VA_ARGS__)
+#define BNCreateCustomFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1173>(::BNCreateCustomFlowGraph)(__VA_ARGS__)
+#define BNNewFlowGraphReference(...) ::BinaryNinja::ApiProfile::Instrument<1174>(::BNNewFlowGraphReference)(__VA_ARGS__)
+#define BNFreeFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1175>(::BNFreeFlowGraph)(__VA_ARGS__)
+#define BNGetFunctionForFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1176>(::BNGetFunctionForFlowGraph)(__VA_ARGS__)
+#define BNSetFunctionForFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1177>(::BNSetFunctionForFlowGraph)(__VA_ARGS__)
+#define BNGetViewForFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1178>(::BNGetViewForFlowGraph)(__VA_ARGS__)
+#define BNSetViewForFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1179>(::BNSetViewForFlowGraph)(__VA_ARGS__)
+#define BNGetHorizontalFlowGraphNodeMargin(...) ::BinaryNinja::ApiProfile::Instrument<1180>(::BNGetHorizontalFlowGraphNodeMargin)(__VA_ARGS__)
+#define BNGetVerticalFlowGraphNodeMargin(...) ::BinaryNinja::ApiProfile::Instrument<1181>(::BNGetVerticalFlowGraphNodeMargin)(__VA_ARGS__)
+#define BNSetFlowGraphNodeMargins(...) ::BinaryNinja::ApiProfile::Instrument<1182>(::BNSetFlowGraphNodeMargins)(__VA_ARGS__)
+#define BNStartFlowGraphLayout(...) ::BinaryNinja::ApiProfile::Instrument<1183>(::BNStartFlowGraphLayout)(__VA_ARGS__)
+#define BNIsFlowGraphLayoutComplete(...) ::BinaryNinja::ApiProfile::Instrument<1184>(::BNIsFlowGraphLayoutComplete)(__VA_ARGS__)
+#define BNNewFlowGraphLayoutRequestReference(...) ::BinaryNinja::ApiProfile::Instrument<1185>(::BNNewFlowGraphLayoutRequestReference)(__VA_ARGS__)
+#define BNFreeFlowGraphLayoutRequest(...) ::BinaryNinja::ApiProfile::Instrument<1186>(::BNFreeFlowGraphLayoutRequest)(__VA_ARGS__)
+#define BNIsFlowGraphLayoutRequestComplete(...) ::BinaryNinja::ApiProfile::Instrument<1187>(::BNIsFlowGraphLayoutRequestComplete)(__VA_ARGS__)
+#define BNGetGraphForFlowGraphLayoutRequest(...) ::BinaryNinja::ApiProfile::Instrument<1188>(::BNGetGraphForFlowGraphLayoutRequest)(__VA_ARGS__)
+#define BNAbortFlowGraphLayoutRequest(...) ::BinaryNinja::ApiProfile::Instrument<1189>(::BNAbortFlowGraphLayoutRequest)(__VA_ARGS__)
+#define BNIsILFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1190>(::BNIsILFlowGraph)(__VA_ARGS__)
+#define BNIsLowLevelILFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1191>(::BNIsLowLevelILFlowGraph)(__VA_ARGS__)
+#define BNIsMediumLevelILFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1192>(::BNIsMediumLevelILFlowGraph)(__VA_ARGS__)
+#define BNIsHighLevelILFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1193>(::BNIsHighLevelILFlowGraph)(__VA_ARGS__)
+#define BNGetFlowGraphLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1194>(::BNGetFlowGraphLowLevelILFunction)(__VA_ARGS__)
+#define BNGetFlowGraphMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1195>(::BNGetFlowGraphMediumLevelILFunction)(__VA_ARGS__)
+#define BNGetFlowGraphHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1196>(::BNGetFlowGraphHighLevelILFunction)(__VA_ARGS__)
+#define BNSetFlowGraphLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1197>(::BNSetFlowGraphLowLevelILFunction)(__VA_ARGS__)
+#define BNSetFlowGraphMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1198>(::BNSetFlowGraphMediumLevelILFunction)(__VA_ARGS__)
+#define BNSetFlowGraphHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1199>(::BNSetFlowGraphHighLevelILFunction)(__VA_ARGS__)
+#define BNGetFlowGraphNodes(...) ::BinaryNinja::ApiProfile::Instrument<1200>(::BNGetFlowGraphNodes)(__VA_ARGS__)
+#define BNGetFlowGraphNode(...) ::BinaryNinja::ApiProfile::Instrument<1201>(::BNGetFlowGraphNode)(__VA_ARGS__)
+#define BNGetFlowGraphNodesInRegion(...) ::BinaryNinja::ApiProfile::Instrument<1202>(::BNGetFlowGraphNodesInRegion)(__VA_ARGS__)
+#define BNFreeFlowGraphNodeList(...) ::BinaryNinja::ApiProfile::Instrument<1203>(::BNFreeFlowGraphNodeList)(__VA_ARGS__)
+#define BNFlowGraphHasNodes(...) ::BinaryNinja::ApiProfile::Instrument<1204>(::BNFlowGraphHasNodes)(__VA_ARGS__)
+#define BNAddFlowGraphNode(...) ::BinaryNinja::ApiProfile::Instrument<1205>(::BNAddFlowGraphNode)(__VA_ARGS__)
+#define BNGetFlowGraphWidth(...) ::BinaryNinja::ApiProfile::Instrument<1206>(::BNGetFlowGraphWidth)(__VA_ARGS__)
+#define BNGetFlowGraphHeight(...) ::BinaryNinja::ApiProfile::Instrument<1207>(::BNGetFlowGraphHeight)(__VA_ARGS__)
+#define BNCreateFlowGraphNode(...) ::BinaryNinja::ApiProfile::Instrument<1208>(::BNCreateFlowGraphNode)(__VA_ARGS__)
+#define BNNewFlowGraphNodeReference(...) ::BinaryNinja::ApiProfile::Instrument<1209>(::BNNewFlowGraphNodeReference)(__VA_ARGS__)
+#define BNFreeFlowGraphNode(...) ::BinaryNinja::ApiProfile::Instrument<1210>(::BNFreeFlowGraphNode)(__VA_ARGS__)
+#define BNGetFlowGraphNodeOwner(...) ::BinaryNinja::ApiProfile::Instrument<1211>(::BNGetFlowGraphNodeOwner)(__VA_ARGS__)
+#define BNGetFlowGraphBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<1212>(::BNGetFlowGraphBasicBlock)(__VA_ARGS__)
+#define BNSetFlowGraphBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<1213>(::BNSetFlowGraphBasicBlock)(__VA_ARGS__)
+#define BNGetFlowGraphNodeX(...) ::BinaryNinja::ApiProfile::Instrument<1214>(::BNGetFlowGraphNodeX)(__VA_ARGS__)
+#define BNGetFlowGraphNodeY(...) ::BinaryNinja::ApiProfile::Instrument<1215>(::BNGetFlowGraphNodeY)(__VA_ARGS__)
+#define BNGetFlowGraphNodeWidth(...) ::BinaryNinja::ApiProfile::Instrument<1216>(::BNGetFlowGraphNodeWidth)(__VA_ARGS__)
+#define BNGetFlowGraphNodeHeight(...) ::BinaryNinja::ApiProfile::Instrument<1217>(::BNGetFlowGraphNodeHeight)(__VA_ARGS__)
+#define BNGetFlowGraphNodeLines(...) ::BinaryNinja::ApiProfile::Instrument<1218>(::BNGetFlowGraphNodeLines)(__VA_ARGS__)
+#define BNSetFlowGraphNodeLines(...) ::BinaryNinja::ApiProfile::Instrument<1219>(::BNSetFlowGraphNodeLines)(__VA_ARGS__)
+#define BNGetFlowGraphNodeOutgoingEdges(...) ::BinaryNinja::ApiProfile::Instrument<1220>(::BNGetFlowGraphNodeOutgoingEdges)(__VA_ARGS__)
+#define BNGetFlowGraphNodeIncomingEdges(...) ::BinaryNinja::ApiProfile::Instrument<1221>(::BNGetFlowGraphNodeIncomingEdges)(__VA_ARGS__)
+#define BNFreeFlowGraphNodeEdgeList(...) ::BinaryNinja::ApiProfile::Instrument<1222>(::BNFreeFlowGraphNodeEdgeList)(__VA_ARGS__)
+#define BNAddFlowGraphNodeOutgoingEdge(...) ::BinaryNinja::ApiProfile::Instrument<1223>(::BNAddFlowGraphNodeOutgoingEdge)(__VA_ARGS__)
+#define BNGetFlowGraphNodeHighlight(...) ::BinaryNinja::ApiProfile::Instrument<1224>(::BNGetFlowGraphNodeHighlight)(__VA_ARGS__)
+#define BNSetFlowGraphNodeHighlight(...) ::BinaryNinja::ApiProfile::Instrument<1225>(::BNSetFlowGraphNodeHighlight)(__VA_ARGS__)
+#define BNFinishPrepareForLayout(...) ::BinaryNinja::ApiProfile::Instrument<1226>(::BNFinishPrepareForLayout)(__VA_ARGS__)
+#define BNFlowGraphUpdateQueryMode(...) ::BinaryNinja::ApiProfile::Instrument<1227>(::BNFlowGraphUpdateQueryMode)(__VA_ARGS__)
+#define BNFlowGraphHasUpdates(...) ::BinaryNinja::ApiProfile::Instrument<1228>(::BNFlowGraphHasUpdates)(__VA_ARGS__)
+#define BNUpdateFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1229>(::BNUpdateFlowGraph)(__VA_ARGS__)
+#define BNSetFlowGraphOption(...) ::BinaryNinja::ApiProfile::Instrument<1230>(::BNSetFlowGraphOption)(__VA_ARGS__)
+#define BNIsFlowGraphOptionSet(...) ::BinaryNinja::ApiProfile::Instrument<1231>(::BNIsFlowGraphOptionSet)(__VA_ARGS__)
+#define BNIsNodeValidForFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<1232>(::BNIsNodeValidForFlowGraph)(__VA_ARGS__)
+#define BNCreateSymbol(...) ::BinaryNinja::ApiProfile::Instrument<1233>(::BNCreateSymbol)(__VA_ARGS__)
+#define BNNewSymbolReference(...) ::BinaryNinja::ApiProfile::Instrument<1234>(::BNNewSymbolReference)(__VA_ARGS__)
+#define BNFreeSymbol(...) ::BinaryNinja::ApiProfile::Instrument<1235>(::BNFreeSymbol)(__VA_ARGS__)
+#define BNGetSymbolType(...) ::BinaryNinja::ApiProfile::Instrument<1236>(::BNGetSymbolType)(__VA_ARGS__)
+#define BNGetSymbolBinding(...) ::BinaryNinja::ApiProfile::Instrument<1237>(::BNGetSymbolBinding)(__VA_ARGS__)
+#define BNGetSymbolNameSpace(...) ::BinaryNinja::ApiProfile::Instrument<1238>(::BNGetSymbolNameSpace)(__VA_ARGS__)
+#define BNGetSymbolShortName(...) ::BinaryNinja::ApiProfile::Instrument<1239>(::BNGetSymbolShortName)(__VA_ARGS__)
+#define BNGetSymbolFullName(...) ::BinaryNinja::ApiProfile::Instrument<1240>(::BNGetSymbolFullName)(__VA_ARGS__)
+#define BNGetSymbolRawName(...) ::BinaryNinja::ApiProfile::Instrument<1241>(::BNGetSymbolRawName)(__VA_ARGS__)
+#define BNGetSymbolRawBytes(...) ::BinaryNinja::ApiProfile::Instrument<1242>(::BNGetSymbolRawBytes)(__VA_ARGS__)
+#define BNFreeSymbolRawBytes(...) ::BinaryNinja::ApiProfile::Instrument<1243>(::BNFreeSymbolRawBytes)(__VA_ARGS__)
+#define BNGetSymbolAddress(...) ::BinaryNinja::ApiProfile::Instrument<1244>(::BNGetSymbolAddress)(__VA_ARGS__)
+#define BNGetSymbolOrdinal(...) ::BinaryNinja::ApiProfile::Instrument<1245>(::BNGetSymbolOrdinal)(__VA_ARGS__)
+#define BNIsSymbolAutoDefined(...) ::BinaryNinja::ApiProfile::Instrument<1246>(::BNIsSymbolAutoDefined)(__VA_ARGS__)
+#define BNGetSymbolByAddress(...) ::BinaryNinja::ApiProfile::Instrument<1247>(::BNGetSymbolByAddress)(__VA_ARGS__)
+#define BNGetSymbolByRawName(...) ::BinaryNinja::ApiProfile::Instrument<1248>(::BNGetSymbolByRawName)(__VA_ARGS__)
+#define BNGetSymbolsByName(...) ::BinaryNinja::ApiProfile::Instrument<1249>(::BNGetSymbolsByName)(__VA_ARGS__)
+#define BNGetSymbolsByRawName(...) ::BinaryNinja::ApiProfile::Instrument<1250>(::BNGetSymbolsByRawName)(__VA_ARGS__)
+#define BNGetSymbols(...) ::BinaryNinja::ApiProfile::Instrument<1251>(::BNGetSymbols)(__VA_ARGS__)
+#define BNGetSymbolsInRange(...) ::BinaryNinja::ApiProfile::Instrument<1252>(::BNGetSymbolsInRange)(__VA_ARGS__)
+#define BNGetSymbolsOfType(...) ::BinaryNinja::ApiProfile::Instrument<1253>(::BNGetSymbolsOfType)(__VA_ARGS__)
+#define BNGetSymbolsOfTypeInRange(...) ::BinaryNinja::ApiProfile::Instrument<1254>(::BNGetSymbolsOfTypeInRange)(__VA_ARGS__)
+#define BNFreeSymbolList(...) ::BinaryNinja::ApiProfile::Instrument<1255>(::BNFreeSymbolList)(__VA_ARGS__)
+#define BNGetVisibleSymbols(...) ::BinaryNinja::ApiProfile::Instrument<1256>(::BNGetVisibleSymbols)(__VA_ARGS__)
+#define BNDefineAutoSymbol(...) ::BinaryNinja::ApiProfile::Instrument<1257>(::BNDefineAutoSymbol)(__VA_ARGS__)
+#define BNUndefineAutoSymbol(...) ::BinaryNinja::ApiProfile::Instrument<1258>(::BNUndefineAutoSymbol)(__VA_ARGS__)
+#define BNDefineUserSymbol(...) ::BinaryNinja::ApiProfile::Instrument<1259>(::BNDefineUserSymbol)(__VA_ARGS__)
+#define BNUndefineUserSymbol(...) ::BinaryNinja::ApiProfile::Instrument<1260>(::BNUndefineUserSymbol)(__VA_ARGS__)
+#define BNDefineImportedFunction(...) ::BinaryNinja::ApiProfile::Instrument<1261>(::BNDefineImportedFunction)(__VA_ARGS__)
+#define BNDefineAutoSymbolAndVariableOrFunction(...) ::BinaryNinja::ApiProfile::Instrument<1262>(::BNDefineAutoSymbolAndVariableOrFunction)(__VA_ARGS__)
+#define BNBeginBulkModifySymbols(...) ::BinaryNinja::ApiProfile::Instrument<1263>(::BNBeginBulkModifySymbols)(__VA_ARGS__)
+#define BNEndBulkModifySymbols(...) ::BinaryNinja::ApiProfile::Instrument<1264>(::BNEndBulkModifySymbols)(__VA_ARGS__)
+#define BNGetDebugInfo(...) ::BinaryNinja::ApiProfile::Instrument<1265>(::BNGetDebugInfo)(__VA_ARGS__)
+#define BNApplyDebugInfo(...) ::BinaryNinja::ApiProfile::Instrument<1266>(::BNApplyDebugInfo)(__VA_ARGS__)
+#define BNSetDebugInfo(...) ::BinaryNinja::ApiProfile::Instrument<1267>(::BNSetDebugInfo)(__VA_ARGS__)
+#define BNIsApplyingDebugInfo(...) ::BinaryNinja::ApiProfile::Instrument<1268>(::BNIsApplyingDebugInfo)(__VA_ARGS__)
+#define BNImportedFunctionFromImportAddressSymbol(...) ::BinaryNinja::ApiProfile::Instrument<1269>(::BNImportedFunctionFromImportAddressSymbol)(__VA_ARGS__)
+#define BNCreateLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1270>(::BNCreateLowLevelILFunction)(__VA_ARGS__)
+#define BNNewLowLevelILFunctionReference(...) ::BinaryNinja::ApiProfile::Instrument<1271>(::BNNewLowLevelILFunctionReference)(__VA_ARGS__)
+#define BNFreeLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1272>(::BNFreeLowLevelILFunction)(__VA_ARGS__)
+#define BNGetLowLevelILOwnerFunction(...) ::BinaryNinja::ApiProfile::Instrument<1273>(::BNGetLowLevelILOwnerFunction)(__VA_ARGS__)
+#define BNLowLevelILGetCurrentAddress(...) ::BinaryNinja::ApiProfile::Instrument<1274>(::BNLowLevelILGetCurrentAddress)(__VA_ARGS__)
+#define BNLowLevelILSetCurrentAddress(...) ::BinaryNinja::ApiProfile::Instrument<1275>(::BNLowLevelILSetCurrentAddress)(__VA_ARGS__)
+#define BNLowLevelILSetCurrentSourceBlock(...) ::BinaryNinja::ApiProfile::Instrument<1276>(::BNLowLevelILSetCurrentSourceBlock)(__VA_ARGS__)
+#define BNLowLevelILGetInstructionStart(...) ::BinaryNinja::ApiProfile::Instrument<1277>(::BNLowLevelILGetInstructionStart)(__VA_ARGS__)
+#define BNLowLevelILClearIndirectBranches(...) ::BinaryNinja::ApiProfile::Instrument<1278>(::BNLowLevelILClearIndirectBranches)(__VA_ARGS__)
+#define BNLowLevelILSetIndirectBranches(...) ::BinaryNinja::ApiProfile::Instrument<1279>(::BNLowLevelILSetIndirectBranches)(__VA_ARGS__)
+#define BNLowLevelILAddExpr(...) ::BinaryNinja::ApiProfile::Instrument<1280>(::BNLowLevelILAddExpr)(__VA_ARGS__)
+#define BNLowLevelILAddExprWithLocation(...) ::BinaryNinja::ApiProfile::Instrument<1281>(::BNLowLevelILAddExprWithLocation)(__VA_ARGS__)
+#define BNLowLevelILSetExprSourceOperand(...) ::BinaryNinja::ApiProfile::Instrument<1282>(::BNLowLevelILSetExprSourceOperand)(__VA_ARGS__)
+#define BNLowLevelILAddInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1283>(::BNLowLevelILAddInstruction)(__VA_ARGS__)
+#define BNLowLevelILGoto(...) ::BinaryNinja::ApiProfile::Instrument<1284>(::BNLowLevelILGoto)(__VA_ARGS__)
+#define BNLowLevelILGotoWithLocation(...) ::BinaryNinja::ApiProfile::Instrument<1285>(::BNLowLevelILGotoWithLocation)(__VA_ARGS__)
+#define BNLowLevelILIf(...) ::BinaryNinja::ApiProfile::Instrument<1286>(::BNLowLevelILIf)(__VA_ARGS__)
+#define BNLowLevelILIfWithLocation(...) ::BinaryNinja::ApiProfile::Instrument<1287>(::BNLowLevelILIfWithLocation)(__VA_ARGS__)
+#define BNLowLevelILInitLabel(...) ::BinaryNinja::ApiProfile::Instrument<1288>(::BNLowLevelILInitLabel)(__VA_ARGS__)
+#define BNLowLevelILMarkLabel(...) ::BinaryNinja::ApiProfile::Instrument<1289>(::BNLowLevelILMarkLabel)(__VA_ARGS__)
+#define BNFinalizeLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1290>(::BNFinalizeLowLevelILFunction)(__VA_ARGS__)
+#define BNGenerateLowLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1291>(::BNGenerateLowLevelILSSAForm)(__VA_ARGS__)
+#define BNPrepareToCopyLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1292>(::BNPrepareToCopyLowLevelILFunction)(__VA_ARGS__)
+#define BNPrepareToCopyLowLevelILBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<1293>(::BNPrepareToCopyLowLevelILBasicBlock)(__VA_ARGS__)
+#define BNGetLabelForLowLevelILSourceInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1294>(::BNGetLabelForLowLevelILSourceInstruction)(__VA_ARGS__)
+#define BNLowLevelILAddLabelMap(...) ::BinaryNinja::ApiProfile::Instrument<1295>(::BNLowLevelILAddLabelMap)(__VA_ARGS__)
+#define BNLowLevelILAddOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1296>(::BNLowLevelILAddOperandList)(__VA_ARGS__)
+#define BNLowLevelILGetOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1297>(::BNLowLevelILGetOperandList)(__VA_ARGS__)
+#define BNLowLevelILFreeOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1298>(::BNLowLevelILFreeOperandList)(__VA_ARGS__)
+#define BNGetLowLevelILByIndex(...) ::BinaryNinja::ApiProfile::Instrument<1299>(::BNGetLowLevelILByIndex)(__VA_ARGS__)
+#define BNGetLowLevelILIndexForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1300>(::BNGetLowLevelILIndexForInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILInstructionForExpr(...) ::BinaryNinja::ApiProfile::Instrument<1301>(::BNGetLowLevelILInstructionForExpr)(__VA_ARGS__)
+#define BNGetLowLevelILInstructionCount(...) ::BinaryNinja::ApiProfile::Instrument<1302>(::BNGetLowLevelILInstructionCount)(__VA_ARGS__)
+#define BNGetLowLevelILExprCount(...) ::BinaryNinja::ApiProfile::Instrument<1303>(::BNGetLowLevelILExprCount)(__VA_ARGS__)
+#define BNUpdateLowLevelILOperand(...) ::BinaryNinja::ApiProfile::Instrument<1304>(::BNUpdateLowLevelILOperand)(__VA_ARGS__)
+#define BNReplaceLowLevelILExpr(...) ::BinaryNinja::ApiProfile::Instrument<1305>(::BNReplaceLowLevelILExpr)(__VA_ARGS__)
+#define BNSetLowLevelILExprAttributes(...) ::BinaryNinja::ApiProfile::Instrument<1306>(::BNSetLowLevelILExprAttributes)(__VA_ARGS__)
+#define BNAddLowLevelILLabelForAddress(...) ::BinaryNinja::ApiProfile::Instrument<1307>(::BNAddLowLevelILLabelForAddress)(__VA_ARGS__)
+#define BNGetLowLevelILLabelForAddress(...) ::BinaryNinja::ApiProfile::Instrument<1308>(::BNGetLowLevelILLabelForAddress)(__VA_ARGS__)
+#define BNGetLowLevelILExprText(...) ::BinaryNinja::ApiProfile::Instrument<1309>(::BNGetLowLevelILExprText)(__VA_ARGS__)
+#define BNGetLowLevelILInstructionText(...) ::BinaryNinja::ApiProfile::Instrument<1310>(::BNGetLowLevelILInstructionText)(__VA_ARGS__)
+#define BNGetLowLevelILTemporaryRegisterCount(...) ::BinaryNinja::ApiProfile::Instrument<1311>(::BNGetLowLevelILTemporaryRegisterCount)(__VA_ARGS__)
+#define BNGetLowLevelILTemporaryFlagCount(...) ::BinaryNinja::ApiProfile::Instrument<1312>(::BNGetLowLevelILTemporaryFlagCount)(__VA_ARGS__)
+#define BNGetLowLevelILBasicBlockList(...) ::BinaryNinja::ApiProfile::Instrument<1313>(::BNGetLowLevelILBasicBlockList)(__VA_ARGS__)
+#define BNGetLowLevelILBasicBlockForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1314>(::BNGetLowLevelILBasicBlockForInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1315>(::BNGetLowLevelILSSAForm)(__VA_ARGS__)
+#define BNGetLowLevelILNonSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1316>(::BNGetLowLevelILNonSSAForm)(__VA_ARGS__)
+#define BNGetLowLevelILSSAInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1317>(::BNGetLowLevelILSSAInstructionIndex)(__VA_ARGS__)
+#define BNGetLowLevelILNonSSAInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1318>(::BNGetLowLevelILNonSSAInstructionIndex)(__VA_ARGS__)
+#define BNGetLowLevelILSSAExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1319>(::BNGetLowLevelILSSAExprIndex)(__VA_ARGS__)
+#define BNGetLowLevelILNonSSAExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1320>(::BNGetLowLevelILNonSSAExprIndex)(__VA_ARGS__)
+#define BNGetLowLevelILSSARegisterDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1321>(::BNGetLowLevelILSSARegisterDefinition)(__VA_ARGS__)
+#define BNGetLowLevelILSSAFlagDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1322>(::BNGetLowLevelILSSAFlagDefinition)(__VA_ARGS__)
+#define BNGetLowLevelILSSAMemoryDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1323>(::BNGetLowLevelILSSAMemoryDefinition)(__VA_ARGS__)
+#define BNGetLowLevelILSSARegisterUses(...) ::BinaryNinja::ApiProfile::Instrument<1324>(::BNGetLowLevelILSSARegisterUses)(__VA_ARGS__)
+#define BNGetLowLevelILSSAFlagUses(...) ::BinaryNinja::ApiProfile::Instrument<1325>(::BNGetLowLevelILSSAFlagUses)(__VA_ARGS__)
+#define BNGetLowLevelILSSAMemoryUses(...) ::BinaryNinja::ApiProfile::Instrument<1326>(::BNGetLowLevelILSSAMemoryUses)(__VA_ARGS__)
+#define BNGetLowLevelILSSARegisterValue(...) ::BinaryNinja::ApiProfile::Instrument<1327>(::BNGetLowLevelILSSARegisterValue)(__VA_ARGS__)
+#define BNGetLowLevelILSSAFlagValue(...) ::BinaryNinja::ApiProfile::Instrument<1328>(::BNGetLowLevelILSSAFlagValue)(__VA_ARGS__)
+#define BNGetLowLevelILExprValue(...) ::BinaryNinja::ApiProfile::Instrument<1329>(::BNGetLowLevelILExprValue)(__VA_ARGS__)
+#define BNGetLowLevelILPossibleExprValues(...) ::BinaryNinja::ApiProfile::Instrument<1330>(::BNGetLowLevelILPossibleExprValues)(__VA_ARGS__)
+#define BNGetLowLevelILRegisterValueAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1331>(::BNGetLowLevelILRegisterValueAtInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILRegisterValueAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1332>(::BNGetLowLevelILRegisterValueAfterInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILPossibleRegisterValuesAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1333>(::BNGetLowLevelILPossibleRegisterValuesAtInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILPossibleRegisterValuesAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1334>(::BNGetLowLevelILPossibleRegisterValuesAfterInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILFlagValueAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1335>(::BNGetLowLevelILFlagValueAtInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILFlagValueAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1336>(::BNGetLowLevelILFlagValueAfterInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILPossibleFlagValuesAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1337>(::BNGetLowLevelILPossibleFlagValuesAtInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILPossibleFlagValuesAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1338>(::BNGetLowLevelILPossibleFlagValuesAfterInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILStackContentsAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1339>(::BNGetLowLevelILStackContentsAtInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILStackContentsAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1340>(::BNGetLowLevelILStackContentsAfterInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILPossibleStackContentsAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1341>(::BNGetLowLevelILPossibleStackContentsAtInstruction)(__VA_ARGS__)
+#define BNGetLowLevelILPossibleStackContentsAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1342>(::BNGetLowLevelILPossibleStackContentsAfterInstruction)(__VA_ARGS__)
+#define BNGetLowLevelRegisters(...) ::BinaryNinja::ApiProfile::Instrument<1343>(::BNGetLowLevelRegisters)(__VA_ARGS__)
+#define BNGetLowLevelRegisterStacks(...) ::BinaryNinja::ApiProfile::Instrument<1344>(::BNGetLowLevelRegisterStacks)(__VA_ARGS__)
+#define BNGetLowLevelFlags(...) ::BinaryNinja::ApiProfile::Instrument<1345>(::BNGetLowLevelFlags)(__VA_ARGS__)
+#define BNGetLowLevelSSARegistersWithoutVersions(...) ::BinaryNinja::ApiProfile::Instrument<1346>(::BNGetLowLevelSSARegistersWithoutVersions)(__VA_ARGS__)
+#define BNGetLowLevelSSARegisterStacksWithoutVersions(...) ::BinaryNinja::ApiProfile::Instrument<1347>(::BNGetLowLevelSSARegisterStacksWithoutVersions)(__VA_ARGS__)
+#define BNGetLowLevelSSAFlagsWithoutVersions(...) ::BinaryNinja::ApiProfile::Instrument<1348>(::BNGetLowLevelSSAFlagsWithoutVersions)(__VA_ARGS__)
+#define BNGetLowLevelRegisterSSAVersions(...) ::BinaryNinja::ApiProfile::Instrument<1349>(::BNGetLowLevelRegisterSSAVersions)(__VA_ARGS__)
+#define BNGetLowLevelRegisterStackSSAVersions(...) ::BinaryNinja::ApiProfile::Instrument<1350>(::BNGetLowLevelRegisterStackSSAVersions)(__VA_ARGS__)
+#define BNGetLowLevelFlagSSAVersions(...) ::BinaryNinja::ApiProfile::Instrument<1351>(::BNGetLowLevelFlagSSAVersions)(__VA_ARGS__)
+#define BNGetLowLevelMemoryVersions(...) ::BinaryNinja::ApiProfile::Instrument<1352>(::BNGetLowLevelMemoryVersions)(__VA_ARGS__)
+#define BNFreeLLILVariablesList(...) ::BinaryNinja::ApiProfile::Instrument<1353>(::BNFreeLLILVariablesList)(__VA_ARGS__)
+#define BNFreeLLILVariableVersionList(...) ::BinaryNinja::ApiProfile::Instrument<1354>(::BNFreeLLILVariableVersionList)(__VA_ARGS__)
+#define BNGetMediumLevelILForLowLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<1355>(::BNGetMediumLevelILForLowLevelIL)(__VA_ARGS__)
+#define BNGetMappedMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<1356>(::BNGetMappedMediumLevelIL)(__VA_ARGS__)
+#define BNGetMediumLevelILInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1357>(::BNGetMediumLevelILInstructionIndex)(__VA_ARGS__)
+#define BNGetMediumLevelILExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1358>(::BNGetMediumLevelILExprIndex)(__VA_ARGS__)
+#define BNGetMediumLevelILExprIndexes(...) ::BinaryNinja::ApiProfile::Instrument<1359>(::BNGetMediumLevelILExprIndexes)(__VA_ARGS__)
+#define BNGetMappedMediumLevelILInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1360>(::BNGetMappedMediumLevelILInstructionIndex)(__VA_ARGS__)
+#define BNGetMappedMediumLevelILExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1361>(::BNGetMappedMediumLevelILExprIndex)(__VA_ARGS__)
+#define BNCreateMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1362>(::BNCreateMediumLevelILFunction)(__VA_ARGS__)
+#define BNNewMediumLevelILFunctionReference(...) ::BinaryNinja::ApiProfile::Instrument<1363>(::BNNewMediumLevelILFunctionReference)(__VA_ARGS__)
+#define BNFreeMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1364>(::BNFreeMediumLevelILFunction)(__VA_ARGS__)
+#define BNGetMediumLevelILOwnerFunction(...) ::BinaryNinja::ApiProfile::Instrument<1365>(::BNGetMediumLevelILOwnerFunction)(__VA_ARGS__)
+#define BNMediumLevelILGetCurrentAddress(...) ::BinaryNinja::ApiProfile::Instrument<1366>(::BNMediumLevelILGetCurrentAddress)(__VA_ARGS__)
+#define BNMediumLevelILSetCurrentAddress(...) ::BinaryNinja::ApiProfile::Instrument<1367>(::BNMediumLevelILSetCurrentAddress)(__VA_ARGS__)
+#define BNMediumLevelILGetInstructionStart(...) ::BinaryNinja::ApiProfile::Instrument<1368>(::BNMediumLevelILGetInstructionStart)(__VA_ARGS__)
+#define BNMediumLevelILAddExpr(...) ::BinaryNinja::ApiProfile::Instrument<1369>(::BNMediumLevelILAddExpr)(__VA_ARGS__)
+#define BNMediumLevelILAddExprWithLocation(...) ::BinaryNinja::ApiProfile::Instrument<1370>(::BNMediumLevelILAddExprWithLocation)(__VA_ARGS__)
+#define BNMediumLevelILAddInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1371>(::BNMediumLevelILAddInstruction)(__VA_ARGS__)
+#define BNMediumLevelILGoto(...) ::BinaryNinja::ApiProfile::Instrument<1372>(::BNMediumLevelILGoto)(__VA_ARGS__)
+#define BNMediumLevelILGotoWithLocation(...) ::BinaryNinja::ApiProfile::Instrument<1373>(::BNMediumLevelILGotoWithLocation)(__VA_ARGS__)
+#define BNMediumLevelILIf(...) ::BinaryNinja::ApiProfile::Instrument<1374>(::BNMediumLevelILIf)(__VA_ARGS__)
+#define BNMediumLevelILIfWithLocation(...) ::BinaryNinja::ApiProfile::Instrument<1375>(::BNMediumLevelILIfWithLocation)(__VA_ARGS__)
+#define BNMediumLevelILInitLabel(...) ::BinaryNinja::ApiProfile::Instrument<1376>(::BNMediumLevelILInitLabel)(__VA_ARGS__)
+#define BNMediumLevelILMarkLabel(...) ::BinaryNinja::ApiProfile::Instrument<1377>(::BNMediumLevelILMarkLabel)(__VA_ARGS__)
+#define BNFinalizeMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1378>(::BNFinalizeMediumLevelILFunction)(__VA_ARGS__)
+#define BNGenerateMediumLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1379>(::BNGenerateMediumLevelILSSAForm)(__VA_ARGS__)
+#define BNPrepareToCopyMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1380>(::BNPrepareToCopyMediumLevelILFunction)(__VA_ARGS__)
+#define BNPrepareToCopyMediumLevelILBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<1381>(::BNPrepareToCopyMediumLevelILBasicBlock)(__VA_ARGS__)
+#define BNGetLabelForMediumLevelILSourceInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1382>(::BNGetLabelForMediumLevelILSourceInstruction)(__VA_ARGS__)
+#define BNMediumLevelILAddLabelMap(...) ::BinaryNinja::ApiProfile::Instrument<1383>(::BNMediumLevelILAddLabelMap)(__VA_ARGS__)
+#define BNMediumLevelILAddOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1384>(::BNMediumLevelILAddOperandList)(__VA_ARGS__)
+#define BNMediumLevelILGetOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1385>(::BNMediumLevelILGetOperandList)(__VA_ARGS__)
+#define BNMediumLevelILFreeOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1386>(::BNMediumLevelILFreeOperandList)(__VA_ARGS__)
+#define BNGetMediumLevelILByIndex(...) ::BinaryNinja::ApiProfile::Instrument<1387>(::BNGetMediumLevelILByIndex)(__VA_ARGS__)
+#define BNGetMediumLevelILIndexForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1388>(::BNGetMediumLevelILIndexForInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILInstructionForExpr(...) ::BinaryNinja::ApiProfile::Instrument<1389>(::BNGetMediumLevelILInstructionForExpr)(__VA_ARGS__)
+#define BNGetMediumLevelILInstructionCount(...) ::BinaryNinja::ApiProfile::Instrument<1390>(::BNGetMediumLevelILInstructionCount)(__VA_ARGS__)
+#define BNGetMediumLevelILExprCount(...) ::BinaryNinja::ApiProfile::Instrument<1391>(::BNGetMediumLevelILExprCount)(__VA_ARGS__)
+#define BNUpdateMediumLevelILOperand(...) ::BinaryNinja::ApiProfile::Instrument<1392>(::BNUpdateMediumLevelILOperand)(__VA_ARGS__)
+#define BNMarkMediumLevelILInstructionForRemoval(...) ::BinaryNinja::ApiProfile::Instrument<1393>(::BNMarkMediumLevelILInstructionForRemoval)(__VA_ARGS__)
+#define BNReplaceMediumLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1394>(::BNReplaceMediumLevelILInstruction)(__VA_ARGS__)
+#define BNReplaceMediumLevelILExpr(...) ::BinaryNinja::ApiProfile::Instrument<1395>(::BNReplaceMediumLevelILExpr)(__VA_ARGS__)
+#define BNSetMediumLevelILExprAttributes(...) ::BinaryNinja::ApiProfile::Instrument<1396>(::BNSetMediumLevelILExprAttributes)(__VA_ARGS__)
+#define BNGetMediumLevelILExprText(...) ::BinaryNinja::ApiProfile::Instrument<1397>(::BNGetMediumLevelILExprText)(__VA_ARGS__)
+#define BNGetMediumLevelILInstructionText(...) ::BinaryNinja::ApiProfile::Instrument<1398>(::BNGetMediumLevelILInstructionText)(__VA_ARGS__)
+#define BNGetMediumLevelILBasicBlockList(...) ::BinaryNinja::ApiProfile::Instrument<1399>(::BNGetMediumLevelILBasicBlockList)(__VA_ARGS__)
+#define BNGetMediumLevelILBasicBlockForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1400>(::BNGetMediumLevelILBasicBlockForInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1401>(::BNGetMediumLevelILSSAForm)(__VA_ARGS__)
+#define BNGetMediumLevelILNonSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1402>(::BNGetMediumLevelILNonSSAForm)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1403>(::BNGetMediumLevelILSSAInstructionIndex)(__VA_ARGS__)
+#define BNGetMediumLevelILNonSSAInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1404>(::BNGetMediumLevelILNonSSAInstructionIndex)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1405>(::BNGetMediumLevelILSSAExprIndex)(__VA_ARGS__)
+#define BNGetMediumLevelILNonSSAExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1406>(::BNGetMediumLevelILNonSSAExprIndex)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAVarDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1407>(::BNGetMediumLevelILSSAVarDefinition)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAMemoryDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1408>(::BNGetMediumLevelILSSAMemoryDefinition)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAVarUses(...) ::BinaryNinja::ApiProfile::Instrument<1409>(::BNGetMediumLevelILSSAVarUses)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAMemoryUses(...) ::BinaryNinja::ApiProfile::Instrument<1410>(::BNGetMediumLevelILSSAMemoryUses)(__VA_ARGS__)
+#define BNIsMediumLevelILSSAVarLive(...) ::BinaryNinja::ApiProfile::Instrument<1411>(::BNIsMediumLevelILSSAVarLive)(__VA_ARGS__)
+#define BNGetMediumLevelILVariables(...) ::BinaryNinja::ApiProfile::Instrument<1412>(::BNGetMediumLevelILVariables)(__VA_ARGS__)
+#define BNGetMediumLevelILAliasedVariables(...) ::BinaryNinja::ApiProfile::Instrument<1413>(::BNGetMediumLevelILAliasedVariables)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableSSAVersions(...) ::BinaryNinja::ApiProfile::Instrument<1414>(::BNGetMediumLevelILVariableSSAVersions)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableDefinitions(...) ::BinaryNinja::ApiProfile::Instrument<1415>(::BNGetMediumLevelILVariableDefinitions)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableUses(...) ::BinaryNinja::ApiProfile::Instrument<1416>(::BNGetMediumLevelILVariableUses)(__VA_ARGS__)
+#define BNGetMediumLevelILLiveInstructionsForVariable(...) ::BinaryNinja::ApiProfile::Instrument<1417>(::BNGetMediumLevelILLiveInstructionsForVariable)(__VA_ARGS__)
+#define BNGetDefaultIndexForMediumLevelILVariableDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1418>(::BNGetDefaultIndexForMediumLevelILVariableDefinition)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAVarValue(...) ::BinaryNinja::ApiProfile::Instrument<1419>(::BNGetMediumLevelILSSAVarValue)(__VA_ARGS__)
+#define BNGetMediumLevelILExprValue(...) ::BinaryNinja::ApiProfile::Instrument<1420>(::BNGetMediumLevelILExprValue)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleSSAVarValues(...) ::BinaryNinja::ApiProfile::Instrument<1421>(::BNGetMediumLevelILPossibleSSAVarValues)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleExprValues(...) ::BinaryNinja::ApiProfile::Instrument<1422>(::BNGetMediumLevelILPossibleExprValues)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAVarVersionAtILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1423>(::BNGetMediumLevelILSSAVarVersionAtILInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILSSAMemoryVersionAtILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1424>(::BNGetMediumLevelILSSAMemoryVersionAtILInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableForRegisterAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1425>(::BNGetMediumLevelILVariableForRegisterAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableForFlagAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1426>(::BNGetMediumLevelILVariableForFlagAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILVariableForStackLocationAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1427>(::BNGetMediumLevelILVariableForStackLocationAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILRegisterValueAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1428>(::BNGetMediumLevelILRegisterValueAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILRegisterValueAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1429>(::BNGetMediumLevelILRegisterValueAfterInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleRegisterValuesAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1430>(::BNGetMediumLevelILPossibleRegisterValuesAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleRegisterValuesAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1431>(::BNGetMediumLevelILPossibleRegisterValuesAfterInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILFlagValueAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1432>(::BNGetMediumLevelILFlagValueAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILFlagValueAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1433>(::BNGetMediumLevelILFlagValueAfterInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleFlagValuesAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1434>(::BNGetMediumLevelILPossibleFlagValuesAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleFlagValuesAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1435>(::BNGetMediumLevelILPossibleFlagValuesAfterInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILStackContentsAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1436>(::BNGetMediumLevelILStackContentsAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILStackContentsAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1437>(::BNGetMediumLevelILStackContentsAfterInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleStackContentsAtInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1438>(::BNGetMediumLevelILPossibleStackContentsAtInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILPossibleStackContentsAfterInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1439>(::BNGetMediumLevelILPossibleStackContentsAfterInstruction)(__VA_ARGS__)
+#define BNGetMediumLevelILBranchDependence(...) ::BinaryNinja::ApiProfile::Instrument<1440>(::BNGetMediumLevelILBranchDependence)(__VA_ARGS__)
+#define BNGetAllMediumLevelILBranchDependence(...) ::BinaryNinja::ApiProfile::Instrument<1441>(::BNGetAllMediumLevelILBranchDependence)(__VA_ARGS__)
+#define BNFreeILBranchDependenceList(...) ::BinaryNinja::ApiProfile::Instrument<1442>(::BNFreeILBranchDependenceList)(__VA_ARGS__)
+#define BNGetLowLevelILForMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<1443>(::BNGetLowLevelILForMediumLevelIL)(__VA_ARGS__)
+#define BNGetLowLevelILInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1444>(::BNGetLowLevelILInstructionIndex)(__VA_ARGS__)
+#define BNGetLowLevelILExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1445>(::BNGetLowLevelILExprIndex)(__VA_ARGS__)
+#define BNGetLowLevelILExprIndexes(...) ::BinaryNinja::ApiProfile::Instrument<1446>(::BNGetLowLevelILExprIndexes)(__VA_ARGS__)
+#define BNGetHighLevelILForMediumLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<1447>(::BNGetHighLevelILForMediumLevelIL)(__VA_ARGS__)
+#define BNGetHighLevelILInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1448>(::BNGetHighLevelILInstructionIndex)(__VA_ARGS__)
+#define BNGetHighLevelILExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1449>(::BNGetHighLevelILExprIndex)(__VA_ARGS__)
+#define BNGetHighLevelILExprIndexes(...) ::BinaryNinja::ApiProfile::Instrument<1450>(::BNGetHighLevelILExprIndexes)(__VA_ARGS__)
+#define BNGetMediumLevelILExprType(...) ::BinaryNinja::ApiProfile::Instrument<1451>(::BNGetMediumLevelILExprType)(__VA_ARGS__)
+#define BNSetMediumLevelILExprType(...) ::BinaryNinja::ApiProfile::Instrument<1452>(::BNSetMediumLevelILExprType)(__VA_ARGS__)
+#define BNCreateHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1453>(::BNCreateHighLevelILFunction)(__VA_ARGS__)
+#define BNNewHighLevelILFunctionReference(...) ::BinaryNinja::ApiProfile::Instrument<1454>(::BNNewHighLevelILFunctionReference)(__VA_ARGS__)
+#define BNFreeHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1455>(::BNFreeHighLevelILFunction)(__VA_ARGS__)
+#define BNGetHighLevelILOwnerFunction(...) ::BinaryNinja::ApiProfile::Instrument<1456>(::BNGetHighLevelILOwnerFunction)(__VA_ARGS__)
+#define BNHighLevelILGetCurrentAddress(...) ::BinaryNinja::ApiProfile::Instrument<1457>(::BNHighLevelILGetCurrentAddress)(__VA_ARGS__)
+#define BNHighLevelILSetCurrentAddress(...) ::BinaryNinja::ApiProfile::Instrument<1458>(::BNHighLevelILSetCurrentAddress)(__VA_ARGS__)
+#define BNHighLevelILAddExpr(...) ::BinaryNinja::ApiProfile::Instrument<1459>(::BNHighLevelILAddExpr)(__VA_ARGS__)
+#define BNHighLevelILAddExprWithLocation(...) ::BinaryNinja::ApiProfile::Instrument<1460>(::BNHighLevelILAddExprWithLocation)(__VA_ARGS__)
+#define BNGetHighLevelILRootExpr(...) ::BinaryNinja::ApiProfile::Instrument<1461>(::BNGetHighLevelILRootExpr)(__VA_ARGS__)
+#define BNSetHighLevelILRootExpr(...) ::BinaryNinja::ApiProfile::Instrument<1462>(::BNSetHighLevelILRootExpr)(__VA_ARGS__)
+#define BNFinalizeHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1463>(::BNFinalizeHighLevelILFunction)(__VA_ARGS__)
+#define BNGenerateHighLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1464>(::BNGenerateHighLevelILSSAForm)(__VA_ARGS__)
+#define BNHighLevelILAddOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1465>(::BNHighLevelILAddOperandList)(__VA_ARGS__)
+#define BNHighLevelILGetOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1466>(::BNHighLevelILGetOperandList)(__VA_ARGS__)
+#define BNHighLevelILFreeOperandList(...) ::BinaryNinja::ApiProfile::Instrument<1467>(::BNHighLevelILFreeOperandList)(__VA_ARGS__)
+#define BNGetHighLevelILByIndex(...) ::BinaryNinja::ApiProfile::Instrument<1468>(::BNGetHighLevelILByIndex)(__VA_ARGS__)
+#define BNGetHighLevelILIndexForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1469>(::BNGetHighLevelILIndexForInstruction)(__VA_ARGS__)
+#define BNGetHighLevelILInstructionForExpr(...) ::BinaryNinja::ApiProfile::Instrument<1470>(::BNGetHighLevelILInstructionForExpr)(__VA_ARGS__)
+#define BNGetHighLevelILInstructionCount(...) ::BinaryNinja::ApiProfile::Instrument<1471>(::BNGetHighLevelILInstructionCount)(__VA_ARGS__)
+#define BNGetHighLevelILExprCount(...) ::BinaryNinja::ApiProfile::Instrument<1472>(::BNGetHighLevelILExprCount)(__VA_ARGS__)
+#define BNGetMediumLevelILForHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1473>(::BNGetMediumLevelILForHighLevelILFunction)(__VA_ARGS__)
+#define BNGetMediumLevelILExprIndexFromHighLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<1474>(::BNGetMediumLevelILExprIndexFromHighLevelIL)(__VA_ARGS__)
+#define BNGetMediumLevelILExprIndexesFromHighLevelIL(...) ::BinaryNinja::ApiProfile::Instrument<1475>(::BNGetMediumLevelILExprIndexesFromHighLevelIL)(__VA_ARGS__)
+#define BNUpdateHighLevelILOperand(...) ::BinaryNinja::ApiProfile::Instrument<1476>(::BNUpdateHighLevelILOperand)(__VA_ARGS__)
+#define BNReplaceHighLevelILExpr(...) ::BinaryNinja::ApiProfile::Instrument<1477>(::BNReplaceHighLevelILExpr)(__VA_ARGS__)
+#define BNSetHighLevelILExprAttributes(...) ::BinaryNinja::ApiProfile::Instrument<1478>(::BNSetHighLevelILExprAttributes)(__VA_ARGS__)
+#define BNGetHighLevelILExprText(...) ::BinaryNinja::ApiProfile::Instrument<1479>(::BNGetHighLevelILExprText)(__VA_ARGS__)
+#define BNGetHighLevelILExprType(...) ::BinaryNinja::ApiProfile::Instrument<1480>(::BNGetHighLevelILExprType)(__VA_ARGS__)
+#define BNSetHighLevelILExprType(...) ::BinaryNinja::ApiProfile::Instrument<1481>(::BNSetHighLevelILExprType)(__VA_ARGS__)
+#define BNGetHighLevelILBasicBlockList(...) ::BinaryNinja::ApiProfile::Instrument<1482>(::BNGetHighLevelILBasicBlockList)(__VA_ARGS__)
+#define BNGetHighLevelILBasicBlockForInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1483>(::BNGetHighLevelILBasicBlockForInstruction)(__VA_ARGS__)
+#define BNGetHighLevelILSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1484>(::BNGetHighLevelILSSAForm)(__VA_ARGS__)
+#define BNGetHighLevelILNonSSAForm(...) ::BinaryNinja::ApiProfile::Instrument<1485>(::BNGetHighLevelILNonSSAForm)(__VA_ARGS__)
+#define BNGetHighLevelILSSAInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1486>(::BNGetHighLevelILSSAInstructionIndex)(__VA_ARGS__)
+#define BNGetHighLevelILNonSSAInstructionIndex(...) ::BinaryNinja::ApiProfile::Instrument<1487>(::BNGetHighLevelILNonSSAInstructionIndex)(__VA_ARGS__)
+#define BNGetHighLevelILSSAExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1488>(::BNGetHighLevelILSSAExprIndex)(__VA_ARGS__)
+#define BNGetHighLevelILNonSSAExprIndex(...) ::BinaryNinja::ApiProfile::Instrument<1489>(::BNGetHighLevelILNonSSAExprIndex)(__VA_ARGS__)
+#define BNGetHighLevelILSSAVarDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1490>(::BNGetHighLevelILSSAVarDefinition)(__VA_ARGS__)
+#define BNGetHighLevelILSSAMemoryDefinition(...) ::BinaryNinja::ApiProfile::Instrument<1491>(::BNGetHighLevelILSSAMemoryDefinition)(__VA_ARGS__)
+#define BNGetHighLevelILSSAVarUses(...) ::BinaryNinja::ApiProfile::Instrument<1492>(::BNGetHighLevelILSSAVarUses)(__VA_ARGS__)
+#define BNGetHighLevelILSSAMemoryUses(...) ::BinaryNinja::ApiProfile::Instrument<1493>(::BNGetHighLevelILSSAMemoryUses)(__VA_ARGS__)
+#define BNIsHighLevelILSSAVarLive(...) ::BinaryNinja::ApiProfile::Instrument<1494>(::BNIsHighLevelILSSAVarLive)(__VA_ARGS__)
+#define BNIsHighLevelILSSAVarLiveAt(...) ::BinaryNinja::ApiProfile::Instrument<1495>(::BNIsHighLevelILSSAVarLiveAt)(__VA_ARGS__)
+#define BNIsHighLevelILVarLiveAt(...) ::BinaryNinja::ApiProfile::Instrument<1496>(::BNIsHighLevelILVarLiveAt)(__VA_ARGS__)
+#define BNGetHighLevelILVariables(...) ::BinaryNinja::ApiProfile::Instrument<1497>(::BNGetHighLevelILVariables)(__VA_ARGS__)
+#define BNGetHighLevelILAliasedVariables(...) ::BinaryNinja::ApiProfile::Instrument<1498>(::BNGetHighLevelILAliasedVariables)(__VA_ARGS__)
+#define BNGetHighLevelILVariableSSAVersions(...) ::BinaryNinja::ApiProfile::Instrument<1499>(::BNGetHighLevelILVariableSSAVersions)(__VA_ARGS__)
+#define BNGetHighLevelILVariableDefinitions(...) ::BinaryNinja::ApiProfile::Instrument<1500>(::BNGetHighLevelILVariableDefinitions)(__VA_ARGS__)
+#define BNGetHighLevelILVariableUses(...) ::BinaryNinja::ApiProfile::Instrument<1501>(::BNGetHighLevelILVariableUses)(__VA_ARGS__)
+#define BNGetHighLevelILSSAVarVersionAtILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1502>(::BNGetHighLevelILSSAVarVersionAtILInstruction)(__VA_ARGS__)
+#define BNGetHighLevelILSSAMemoryVersionAtILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1503>(::BNGetHighLevelILSSAMemoryVersionAtILInstruction)(__VA_ARGS__)
+#define BNGetHighLevelILExprIndexForLabel(...) ::BinaryNinja::ApiProfile::Instrument<1504>(::BNGetHighLevelILExprIndexForLabel)(__VA_ARGS__)
+#define BNGetHighLevelILUsesForLabel(...) ::BinaryNinja::ApiProfile::Instrument<1505>(::BNGetHighLevelILUsesForLabel)(__VA_ARGS__)
+#define BNHighLevelILExprLessThan(...) ::BinaryNinja::ApiProfile::Instrument<1506>(::BNHighLevelILExprLessThan)(__VA_ARGS__)
+#define BNHighLevelILExprEqual(...) ::BinaryNinja::ApiProfile::Instrument<1507>(::BNHighLevelILExprEqual)(__VA_ARGS__)
+#define BNNewTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1508>(::BNNewTypeLibrary)(__VA_ARGS__)
+#define BNNewTypeLibraryReference(...) ::BinaryNinja::ApiProfile::Instrument<1509>(::BNNewTypeLibraryReference)(__VA_ARGS__)
+#define BNDuplicateTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1510>(::BNDuplicateTypeLibrary)(__VA_ARGS__)
+#define BNLoadTypeLibraryFromFile(...) ::BinaryNinja::ApiProfile::Instrument<1511>(::BNLoadTypeLibraryFromFile)(__VA_ARGS__)
+#define BNTypeLibraryDecompressToFile(...) ::BinaryNinja::ApiProfile::Instrument<1512>(::BNTypeLibraryDecompressToFile)(__VA_ARGS__)
+#define BNFreeTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1513>(::BNFreeTypeLibrary)(__VA_ARGS__)
+#define BNLookupTypeLibraryByName(...) ::BinaryNinja::ApiProfile::Instrument<1514>(::BNLookupTypeLibraryByName)(__VA_ARGS__)
+#define BNLookupTypeLibraryByGuid(...) ::BinaryNinja::ApiProfile::Instrument<1515>(::BNLookupTypeLibraryByGuid)(__VA_ARGS__)
+#define BNGetArchitectureTypeLibraries(...) ::BinaryNinja::ApiProfile::Instrument<1516>(::BNGetArchitectureTypeLibraries)(__VA_ARGS__)
+#define BNFreeTypeLibraryList(...) ::BinaryNinja::ApiProfile::Instrument<1517>(::BNFreeTypeLibraryList)(__VA_ARGS__)
+#define BNFinalizeTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1518>(::BNFinalizeTypeLibrary)(__VA_ARGS__)
+#define BNGetTypeLibraryArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<1519>(::BNGetTypeLibraryArchitecture)(__VA_ARGS__)
+#define BNSetTypeLibraryName(...) ::BinaryNinja::ApiProfile::Instrument<1520>(::BNSetTypeLibraryName)(__VA_ARGS__)
+#define BNGetTypeLibraryName(...) ::BinaryNinja::ApiProfile::Instrument<1521>(::BNGetTypeLibraryName)(__VA_ARGS__)
+#define BNAddTypeLibraryAlternateName(...) ::BinaryNinja::ApiProfile::Instrument<1522>(::BNAddTypeLibraryAlternateName)(__VA_ARGS__)
+#define BNGetTypeLibraryAlternateNames(...) ::BinaryNinja::ApiProfile::Instrument<1523>(::BNGetTypeLibraryAlternateNames)(__VA_ARGS__)
+#define BNSetTypeLibraryDependencyName(...) ::BinaryNinja::ApiProfile::Instrument<1524>(::BNSetTypeLibraryDependencyName)(__VA_ARGS__)
+#define BNGetTypeLibraryDependencyName(...) ::BinaryNinja::ApiProfile::Instrument<1525>(::BNGetTypeLibraryDependencyName)(__VA_ARGS__)
+#define BNSetTypeLibraryGuid(...) ::BinaryNinja::ApiProfile::Instrument<1526>(::BNSetTypeLibraryGuid)(__VA_ARGS__)
+#define BNGetTypeLibraryGuid(...) ::BinaryNinja::ApiProfile::Instrument<1527>(::BNGetTypeLibraryGuid)(__VA_ARGS__)
+#define BNClearTypeLibraryPlatforms(...) ::BinaryNinja::ApiProfile::Instrument<1528>(::BNClearTypeLibraryPlatforms)(__VA_ARGS__)
+#define BNAddTypeLibraryPlatform(...) ::BinaryNinja::ApiProfile::Instrument<1529>(::BNAddTypeLibraryPlatform)(__VA_ARGS__)
+#define BNGetTypeLibraryPlatforms(...) ::BinaryNinja::ApiProfile::Instrument<1530>(::BNGetTypeLibraryPlatforms)(__VA_ARGS__)
+#define BNTypeLibraryStoreMetadata(...) ::BinaryNinja::ApiProfile::Instrument<1531>(::BNTypeLibraryStoreMetadata)(__VA_ARGS__)
+#define BNTypeLibraryQueryMetadata(...) ::BinaryNinja::ApiProfile::Instrument<1532>(::BNTypeLibraryQueryMetadata)(__VA_ARGS__)
+#define BNTypeLibraryRemoveMetadata(...) ::BinaryNinja::ApiProfile::Instrument<1533>(::BNTypeLibraryRemoveMetadata)(__VA_ARGS__)
+#define BNGetTypeLibraryTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<1534>(::BNGetTypeLibraryTypeContainer)(__VA_ARGS__)
+#define BNAddTypeLibraryNamedObject(...) ::BinaryNinja::ApiProfile::Instrument<1535>(::BNAddTypeLibraryNamedObject)(__VA_ARGS__)
+#define BNAddTypeLibraryNamedType(...) ::BinaryNinja::ApiProfile::Instrument<1536>(::BNAddTypeLibraryNamedType)(__VA_ARGS__)
+#define BNAddTypeLibraryNamedTypeSource(...) ::BinaryNinja::ApiProfile::Instrument<1537>(::BNAddTypeLibraryNamedTypeSource)(__VA_ARGS__)
+#define BNGetTypeLibraryNamedObject(...) ::BinaryNinja::ApiProfile::Instrument<1538>(::BNGetTypeLibraryNamedObject)(__VA_ARGS__)
+#define BNGetTypeLibraryNamedType(...) ::BinaryNinja::ApiProfile::Instrument<1539>(::BNGetTypeLibraryNamedType)(__VA_ARGS__)
+#define BNGetTypeLibraryNamedObjects(...) ::BinaryNinja::ApiProfile::Instrument<1540>(::BNGetTypeLibraryNamedObjects)(__VA_ARGS__)
+#define BNGetTypeLibraryNamedTypes(...) ::BinaryNinja::ApiProfile::Instrument<1541>(::BNGetTypeLibraryNamedTypes)(__VA_ARGS__)
+#define BNWriteTypeLibraryToFile(...) ::BinaryNinja::ApiProfile::Instrument<1542>(::BNWriteTypeLibraryToFile)(__VA_ARGS__)
+#define BNAddBinaryViewTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1543>(::BNAddBinaryViewTypeLibrary)(__VA_ARGS__)
+#define BNGetBinaryViewTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1544>(::BNGetBinaryViewTypeLibrary)(__VA_ARGS__)
+#define BNGetBinaryViewTypeLibraries(...) ::BinaryNinja::ApiProfile::Instrument<1545>(::BNGetBinaryViewTypeLibraries)(__VA_ARGS__)
+#define BNBinaryViewImportTypeLibraryType(...) ::BinaryNinja::ApiProfile::Instrument<1546>(::BNBinaryViewImportTypeLibraryType)(__VA_ARGS__)
+#define BNBinaryViewImportTypeLibraryObject(...) ::BinaryNinja::ApiProfile::Instrument<1547>(::BNBinaryViewImportTypeLibraryObject)(__VA_ARGS__)
+#define BNBinaryViewExportTypeToTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1548>(::BNBinaryViewExportTypeToTypeLibrary)(__VA_ARGS__)
+#define BNBinaryViewExportObjectToTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1549>(::BNBinaryViewExportObjectToTypeLibrary)(__VA_ARGS__)
+#define BNBinaryViewSetManualDependencies(...) ::BinaryNinja::ApiProfile::Instrument<1550>(::BNBinaryViewSetManualDependencies)(__VA_ARGS__)
+#define BNBinaryViewRecordImportedObjectLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1551>(::BNBinaryViewRecordImportedObjectLibrary)(__VA_ARGS__)
+#define BNBinaryViewLookupImportedObjectLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1552>(::BNBinaryViewLookupImportedObjectLibrary)(__VA_ARGS__)
+#define BNBinaryViewLookupImportedTypeLibrary(...) ::BinaryNinja::ApiProfile::Instrument<1553>(::BNBinaryViewLookupImportedTypeLibrary)(__VA_ARGS__)
+#define BNCreateLanguageRepresentationFunction(...) ::BinaryNinja::ApiProfile::Instrument<1554>(::BNCreateLanguageRepresentationFunction)(__VA_ARGS__)
+#define BNNewLanguageRepresentationFunctionReference(...) ::BinaryNinja::ApiProfile::Instrument<1555>(::BNNewLanguageRepresentationFunctionReference)(__VA_ARGS__)
+#define BNFreeLanguageRepresentationFunction(...) ::BinaryNinja::ApiProfile::Instrument<1556>(::BNFreeLanguageRepresentationFunction)(__VA_ARGS__)
+#define BNGetLanguageRepresentationOwnerFunction(...) ::BinaryNinja::ApiProfile::Instrument<1557>(::BNGetLanguageRepresentationOwnerFunction)(__VA_ARGS__)
+#define BNTypesEqual(...) ::BinaryNinja::ApiProfile::Instrument<1558>(::BNTypesEqual)(__VA_ARGS__)
+#define BNTypesNotEqual(...) ::BinaryNinja::ApiProfile::Instrument<1559>(::BNTypesNotEqual)(__VA_ARGS__)
+#define BNCreateVoidType(...) ::BinaryNinja::ApiProfile::Instrument<1560>(::BNCreateVoidType)(__VA_ARGS__)
+#define BNCreateBoolType(...) ::BinaryNinja::ApiProfile::Instrument<1561>(::BNCreateBoolType)(__VA_ARGS__)
+#define BNCreateIntegerType(...) ::BinaryNinja::ApiProfile::Instrument<1562>(::BNCreateIntegerType)(__VA_ARGS__)
+#define BNCreateFloatType(...) ::BinaryNinja::ApiProfile::Instrument<1563>(::BNCreateFloatType)(__VA_ARGS__)
+#define BNCreateWideCharType(...) ::BinaryNinja::ApiProfile::Instrument<1564>(::BNCreateWideCharType)(__VA_ARGS__)
+#define BNCreateStructureType(...) ::BinaryNinja::ApiProfile::Instrument<1565>(::BNCreateStructureType)(__VA_ARGS__)
+#define BNCreateEnumerationType(...) ::BinaryNinja::ApiProfile::Instrument<1566>(::BNCreateEnumerationType)(__VA_ARGS__)
+#define BNCreateEnumerationTypeOfWidth(...) ::BinaryNinja::ApiProfile::Instrument<1567>(::BNCreateEnumerationTypeOfWidth)(__VA_ARGS__)
+#define BNCreatePointerType(...) ::BinaryNinja::ApiProfile::Instrument<1568>(::BNCreatePointerType)(__VA_ARGS__)
+#define BNCreatePointerTypeOfWidth(...) ::BinaryNinja::ApiProfile::Instrument<1569>(::BNCreatePointerTypeOfWidth)(__VA_ARGS__)
+#define BNCreateArrayType(...) ::BinaryNinja::ApiProfile::Instrument<1570>(::BNCreateArrayType)(__VA_ARGS__)
+#define BNCreateFunctionType(...) ::BinaryNinja::ApiProfile::Instrument<1571>(::BNCreateFunctionType)(__VA_ARGS__)
+#define BNNewTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1572>(::BNNewTypeReference)(__VA_ARGS__)
+#define BNDuplicateType(...) ::BinaryNinja::ApiProfile::Instrument<1573>(::BNDuplicateType)(__VA_ARGS__)
+#define BNGetTypeAndName(...) ::BinaryNinja::ApiProfile::Instrument<1574>(::BNGetTypeAndName)(__VA_ARGS__)
+#define BNFreeType(...) ::BinaryNinja::ApiProfile::Instrument<1575>(::BNFreeType)(__VA_ARGS__)
+#define BNFreeTypeList(...) ::BinaryNinja::ApiProfile::Instrument<1576>(::BNFreeTypeList)(__VA_ARGS__)
+#define BNCreateTypeBuilderFromType(...) ::BinaryNinja::ApiProfile::Instrument<1577>(::BNCreateTypeBuilderFromType)(__VA_ARGS__)
+#define BNCreateVoidTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1578>(::BNCreateVoidTypeBuilder)(__VA_ARGS__)
+#define BNCreateBoolTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1579>(::BNCreateBoolTypeBuilder)(__VA_ARGS__)
+#define BNCreateIntegerTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1580>(::BNCreateIntegerTypeBuilder)(__VA_ARGS__)
+#define BNCreateFloatTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1581>(::BNCreateFloatTypeBuilder)(__VA_ARGS__)
+#define BNCreateWideCharTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1582>(::BNCreateWideCharTypeBuilder)(__VA_ARGS__)
+#define BNCreateStructureTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1583>(::BNCreateStructureTypeBuilder)(__VA_ARGS__)
+#define BNCreateStructureTypeBuilderWithBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1584>(::BNCreateStructureTypeBuilderWithBuilder)(__VA_ARGS__)
+#define BNCreateEnumerationTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1585>(::BNCreateEnumerationTypeBuilder)(__VA_ARGS__)
+#define BNCreateEnumerationTypeBuilderWithBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1586>(::BNCreateEnumerationTypeBuilderWithBuilder)(__VA_ARGS__)
+#define BNCreatePointerTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1587>(::BNCreatePointerTypeBuilder)(__VA_ARGS__)
+#define BNCreatePointerTypeBuilderOfWidth(...) ::BinaryNinja::ApiProfile::Instrument<1588>(::BNCreatePointerTypeBuilderOfWidth)(__VA_ARGS__)
+#define BNCreateArrayTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1589>(::BNCreateArrayTypeBuilder)(__VA_ARGS__)
+#define BNCreateFunctionTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1590>(::BNCreateFunctionTypeBuilder)(__VA_ARGS__)
+#define BNFinalizeTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1591>(::BNFinalizeTypeBuilder)(__VA_ARGS__)
+#define BNDuplicateTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1592>(::BNDuplicateTypeBuilder)(__VA_ARGS__)
+#define BNGetTypeBuilderTypeAndName(...) ::BinaryNinja::ApiProfile::Instrument<1593>(::BNGetTypeBuilderTypeAndName)(__VA_ARGS__)
+#define BNFreeTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1594>(::BNFreeTypeBuilder)(__VA_ARGS__)
+#define BNTypeGetTypeName(...) ::BinaryNinja::ApiProfile::Instrument<1595>(::BNTypeGetTypeName)(__VA_ARGS__)
+#define BNGetTypeClass(...) ::BinaryNinja::ApiProfile::Instrument<1596>(::BNGetTypeClass)(__VA_ARGS__)
+#define BNGetTypeWidth(...) ::BinaryNinja::ApiProfile::Instrument<1597>(::BNGetTypeWidth)(__VA_ARGS__)
+#define BNGetTypeAlignment(...) ::BinaryNinja::ApiProfile::Instrument<1598>(::BNGetTypeAlignment)(__VA_ARGS__)
+#define BNGetIntegerTypeDisplayType(...) ::BinaryNinja::ApiProfile::Instrument<1599>(::BNGetIntegerTypeDisplayType)(__VA_ARGS__)
+#define BNSetIntegerTypeDisplayType(...) ::BinaryNinja::ApiProfile::Instrument<1600>(::BNSetIntegerTypeDisplayType)(__VA_ARGS__)
+#define BNIsTypeSigned(...) ::BinaryNinja::ApiProfile::Instrument<1601>(::BNIsTypeSigned)(__VA_ARGS__)
+#define BNIsTypeConst(...) ::BinaryNinja::ApiProfile::Instrument<1602>(::BNIsTypeConst)(__VA_ARGS__)
+#define BNIsTypeVolatile(...) ::BinaryNinja::ApiProfile::Instrument<1603>(::BNIsTypeVolatile)(__VA_ARGS__)
+#define BNIsTypeFloatingPoint(...) ::BinaryNinja::ApiProfile::Instrument<1604>(::BNIsTypeFloatingPoint)(__VA_ARGS__)
+#define BNGetChildType(...) ::BinaryNinja::ApiProfile::Instrument<1605>(::BNGetChildType)(__VA_ARGS__)
+#define BNGetTypeCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1606>(::BNGetTypeCallingConvention)(__VA_ARGS__)
+#define BNGetTypeParameters(...) ::BinaryNinja::ApiProfile::Instrument<1607>(::BNGetTypeParameters)(__VA_ARGS__)
+#define BNFreeTypeParameterList(...) ::BinaryNinja::ApiProfile::Instrument<1608>(::BNFreeTypeParameterList)(__VA_ARGS__)
+#define BNTypeHasVariableArguments(...) ::BinaryNinja::ApiProfile::Instrument<1609>(::BNTypeHasVariableArguments)(__VA_ARGS__)
+#define BNFunctionTypeCanReturn(...) ::BinaryNinja::ApiProfile::Instrument<1610>(::BNFunctionTypeCanReturn)(__VA_ARGS__)
+#define BNIsTypePure(...) ::BinaryNinja::ApiProfile::Instrument<1611>(::BNIsTypePure)(__VA_ARGS__)
+#define BNGetTypeStructure(...) ::BinaryNinja::ApiProfile::Instrument<1612>(::BNGetTypeStructure)(__VA_ARGS__)
+#define BNGetTypeEnumeration(...) ::BinaryNinja::ApiProfile::Instrument<1613>(::BNGetTypeEnumeration)(__VA_ARGS__)
+#define BNGetTypeNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1614>(::BNGetTypeNamedTypeReference)(__VA_ARGS__)
+#define BNGetTypeElementCount(...) ::BinaryNinja::ApiProfile::Instrument<1615>(::BNGetTypeElementCount)(__VA_ARGS__)
+#define BNGetTypeOffset(...) ::BinaryNinja::ApiProfile::Instrument<1616>(::BNGetTypeOffset)(__VA_ARGS__)
+#define BNGetTypeStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<1617>(::BNGetTypeStackAdjustment)(__VA_ARGS__)
+#define BNTypeGetStructureName(...) ::BinaryNinja::ApiProfile::Instrument<1618>(::BNTypeGetStructureName)(__VA_ARGS__)
+#define BNGetRegisteredTypeName(...) ::BinaryNinja::ApiProfile::Instrument<1619>(::BNGetRegisteredTypeName)(__VA_ARGS__)
+#define BNTypeGetReferenceType(...) ::BinaryNinja::ApiProfile::Instrument<1620>(::BNTypeGetReferenceType)(__VA_ARGS__)
+#define BNGetTypeAlternateName(...) ::BinaryNinja::ApiProfile::Instrument<1621>(::BNGetTypeAlternateName)(__VA_ARGS__)
+#define BNTypeGetSystemCallNumber(...) ::BinaryNinja::ApiProfile::Instrument<1622>(::BNTypeGetSystemCallNumber)(__VA_ARGS__)
+#define BNTypeIsSystemCall(...) ::BinaryNinja::ApiProfile::Instrument<1623>(::BNTypeIsSystemCall)(__VA_ARGS__)
+#define BNGetTypeString(...) ::BinaryNinja::ApiProfile::Instrument<1624>(::BNGetTypeString)(__VA_ARGS__)
+#define BNGetTypeStringBeforeName(...) ::BinaryNinja::ApiProfile::Instrument<1625>(::BNGetTypeStringBeforeName)(__VA_ARGS__)
+#define BNGetTypeStringAfterName(...) ::BinaryNinja::ApiProfile::Instrument<1626>(::BNGetTypeStringAfterName)(__VA_ARGS__)
+#define BNGetTypeTokens(...) ::BinaryNinja::ApiProfile::Instrument<1627>(::BNGetTypeTokens)(__VA_ARGS__)
+#define BNGetTypeTokensBeforeName(...) ::BinaryNinja::ApiProfile::Instrument<1628>(::BNGetTypeTokensBeforeName)(__VA_ARGS__)
+#define BNGetTypeTokensAfterName(...) ::BinaryNinja::ApiProfile::Instrument<1629>(::BNGetTypeTokensAfterName)(__VA_ARGS__)
+#define BNTypeWithReplacedStructure(...) ::BinaryNinja::ApiProfile::Instrument<1630>(::BNTypeWithReplacedStructure)(__VA_ARGS__)
+#define BNTypeWithReplacedEnumeration(...) ::BinaryNinja::ApiProfile::Instrument<1631>(::BNTypeWithReplacedEnumeration)(__VA_ARGS__)
+#define BNTypeWithReplacedNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1632>(::BNTypeWithReplacedNamedTypeReference)(__VA_ARGS__)
+#define BNAddTypeMemberTokens(...) ::BinaryNinja::ApiProfile::Instrument<1633>(::BNAddTypeMemberTokens)(__VA_ARGS__)
+#define BNGetTypeLines(...) ::BinaryNinja::ApiProfile::Instrument<1634>(::BNGetTypeLines)(__VA_ARGS__)
+#define BNFreeTypeDefinitionLineList(...) ::BinaryNinja::ApiProfile::Instrument<1635>(::BNFreeTypeDefinitionLineList)(__VA_ARGS__)
+#define BNTypeBuilderGetTypeName(...) ::BinaryNinja::ApiProfile::Instrument<1636>(::BNTypeBuilderGetTypeName)(__VA_ARGS__)
+#define BNTypeBuilderSetTypeName(...) ::BinaryNinja::ApiProfile::Instrument<1637>(::BNTypeBuilderSetTypeName)(__VA_ARGS__)
+#define BNTypeBuilderSetAlternateName(...) ::BinaryNinja::ApiProfile::Instrument<1638>(::BNTypeBuilderSetAlternateName)(__VA_ARGS__)
+#define BNGetTypeBuilderClass(...) ::BinaryNinja::ApiProfile::Instrument<1639>(::BNGetTypeBuilderClass)(__VA_ARGS__)
+#define BNTypeBuilderSetSystemCallNumber(...) ::BinaryNinja::ApiProfile::Instrument<1640>(::BNTypeBuilderSetSystemCallNumber)(__VA_ARGS__)
+#define BNGetTypeBuilderWidth(...) ::BinaryNinja::ApiProfile::Instrument<1641>(::BNGetTypeBuilderWidth)(__VA_ARGS__)
+#define BNGetTypeBuilderAlignment(...) ::BinaryNinja::ApiProfile::Instrument<1642>(::BNGetTypeBuilderAlignment)(__VA_ARGS__)
+#define BNIsTypeBuilderSigned(...) ::BinaryNinja::ApiProfile::Instrument<1643>(::BNIsTypeBuilderSigned)(__VA_ARGS__)
+#define BNIsTypeBuilderConst(...) ::BinaryNinja::ApiProfile::Instrument<1644>(::BNIsTypeBuilderConst)(__VA_ARGS__)
+#define BNIsTypeBuilderVolatile(...) ::BinaryNinja::ApiProfile::Instrument<1645>(::BNIsTypeBuilderVolatile)(__VA_ARGS__)
+#define BNIsTypeBuilderFloatingPoint(...) ::BinaryNinja::ApiProfile::Instrument<1646>(::BNIsTypeBuilderFloatingPoint)(__VA_ARGS__)
+#define BNGetTypeBuilderChildType(...) ::BinaryNinja::ApiProfile::Instrument<1647>(::BNGetTypeBuilderChildType)(__VA_ARGS__)
+#define BNGetTypeBuilderCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1648>(::BNGetTypeBuilderCallingConvention)(__VA_ARGS__)
+#define BNGetTypeBuilderParameters(...) ::BinaryNinja::ApiProfile::Instrument<1649>(::BNGetTypeBuilderParameters)(__VA_ARGS__)
+#define BNTypeBuilderHasVariableArguments(...) ::BinaryNinja::ApiProfile::Instrument<1650>(::BNTypeBuilderHasVariableArguments)(__VA_ARGS__)
+#define BNFunctionTypeBuilderCanReturn(...) ::BinaryNinja::ApiProfile::Instrument<1651>(::BNFunctionTypeBuilderCanReturn)(__VA_ARGS__)
+#define BNIsTypeBuilderPure(...) ::BinaryNinja::ApiProfile::Instrument<1652>(::BNIsTypeBuilderPure)(__VA_ARGS__)
+#define BNGetTypeBuilderStructure(...) ::BinaryNinja::ApiProfile::Instrument<1653>(::BNGetTypeBuilderStructure)(__VA_ARGS__)
+#define BNGetTypeBuilderEnumeration(...) ::BinaryNinja::ApiProfile::Instrument<1654>(::BNGetTypeBuilderEnumeration)(__VA_ARGS__)
+#define BNGetTypeBuilderNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1655>(::BNGetTypeBuilderNamedTypeReference)(__VA_ARGS__)
+#define BNSetTypeBuilderNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1656>(::BNSetTypeBuilderNamedTypeReference)(__VA_ARGS__)
+#define BNGetTypeBuilderElementCount(...) ::BinaryNinja::ApiProfile::Instrument<1657>(::BNGetTypeBuilderElementCount)(__VA_ARGS__)
+#define BNGetTypeBuilderOffset(...) ::BinaryNinja::ApiProfile::Instrument<1658>(::BNGetTypeBuilderOffset)(__VA_ARGS__)
+#define BNSetTypeBuilderOffset(...) ::BinaryNinja::ApiProfile::Instrument<1659>(::BNSetTypeBuilderOffset)(__VA_ARGS__)
+#define BNSetFunctionTypeBuilderCanReturn(...) ::BinaryNinja::ApiProfile::Instrument<1660>(::BNSetFunctionTypeBuilderCanReturn)(__VA_ARGS__)
+#define BNSetTypeBuilderPure(...) ::BinaryNinja::ApiProfile::Instrument<1661>(::BNSetTypeBuilderPure)(__VA_ARGS__)
+#define BNSetFunctionTypeBuilderParameters(...) ::BinaryNinja::ApiProfile::Instrument<1662>(::BNSetFunctionTypeBuilderParameters)(__VA_ARGS__)
+#define BNTypeBuilderSetConst(...) ::BinaryNinja::ApiProfile::Instrument<1663>(::BNTypeBuilderSetConst)(__VA_ARGS__)
+#define BNTypeBuilderSetVolatile(...) ::BinaryNinja::ApiProfile::Instrument<1664>(::BNTypeBuilderSetVolatile)(__VA_ARGS__)
+#define BNTypeBuilderSetSigned(...) ::BinaryNinja::ApiProfile::Instrument<1665>(::BNTypeBuilderSetSigned)(__VA_ARGS__)
+#define BNTypeBuilderSetChildType(...) ::BinaryNinja::ApiProfile::Instrument<1666>(::BNTypeBuilderSetChildType)(__VA_ARGS__)
+#define BNGetTypeBuilderStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<1667>(::BNGetTypeBuilderStackAdjustment)(__VA_ARGS__)
+#define BNTypeBuilderGetStructureName(...) ::BinaryNinja::ApiProfile::Instrument<1668>(::BNTypeBuilderGetStructureName)(__VA_ARGS__)
+#define BNTypeBuilderGetReferenceType(...) ::BinaryNinja::ApiProfile::Instrument<1669>(::BNTypeBuilderGetReferenceType)(__VA_ARGS__)
+#define BNGetTypeBuilderAlternateName(...) ::BinaryNinja::ApiProfile::Instrument<1670>(::BNGetTypeBuilderAlternateName)(__VA_ARGS__)
+#define BNTypeBuilderIsSystemCall(...) ::BinaryNinja::ApiProfile::Instrument<1671>(::BNTypeBuilderIsSystemCall)(__VA_ARGS__)
+#define BNTypeBuilderGetSystemCallNumber(...) ::BinaryNinja::ApiProfile::Instrument<1672>(::BNTypeBuilderGetSystemCallNumber)(__VA_ARGS__)
+#define BNTypeBuilderSetStackAdjustment(...) ::BinaryNinja::ApiProfile::Instrument<1673>(::BNTypeBuilderSetStackAdjustment)(__VA_ARGS__)
+#define BNGetTypeBuilderString(...) ::BinaryNinja::ApiProfile::Instrument<1674>(::BNGetTypeBuilderString)(__VA_ARGS__)
+#define BNGetTypeBuilderStringBeforeName(...) ::BinaryNinja::ApiProfile::Instrument<1675>(::BNGetTypeBuilderStringBeforeName)(__VA_ARGS__)
+#define BNGetTypeBuilderStringAfterName(...) ::BinaryNinja::ApiProfile::Instrument<1676>(::BNGetTypeBuilderStringAfterName)(__VA_ARGS__)
+#define BNGetTypeBuilderTokens(...) ::BinaryNinja::ApiProfile::Instrument<1677>(::BNGetTypeBuilderTokens)(__VA_ARGS__)
+#define BNGetTypeBuilderTokensBeforeName(...) ::BinaryNinja::ApiProfile::Instrument<1678>(::BNGetTypeBuilderTokensBeforeName)(__VA_ARGS__)
+#define BNGetTypeBuilderTokensAfterName(...) ::BinaryNinja::ApiProfile::Instrument<1679>(::BNGetTypeBuilderTokensAfterName)(__VA_ARGS__)
+#define BNCreateNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1680>(::BNCreateNamedTypeReference)(__VA_ARGS__)
+#define BNCreateNamedTypeReferenceFromTypeAndId(...) ::BinaryNinja::ApiProfile::Instrument<1681>(::BNCreateNamedTypeReferenceFromTypeAndId)(__VA_ARGS__)
+#define BNCreateNamedTypeReferenceFromType(...) ::BinaryNinja::ApiProfile::Instrument<1682>(::BNCreateNamedTypeReferenceFromType)(__VA_ARGS__)
+#define BNCreateNamedTypeReferenceBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1683>(::BNCreateNamedTypeReferenceBuilder)(__VA_ARGS__)
+#define BNCreateNamedTypeReferenceBuilderWithBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1684>(::BNCreateNamedTypeReferenceBuilderWithBuilder)(__VA_ARGS__)
+#define BNCreateNamedTypeReferenceBuilderFromTypeAndId(...) ::BinaryNinja::ApiProfile::Instrument<1685>(::BNCreateNamedTypeReferenceBuilderFromTypeAndId)(__VA_ARGS__)
+#define BNCreateNamedTypeReferenceBuilderFromType(...) ::BinaryNinja::ApiProfile::Instrument<1686>(::BNCreateNamedTypeReferenceBuilderFromType)(__VA_ARGS__)
+#define BNCreateNamedType(...) ::BinaryNinja::ApiProfile::Instrument<1687>(::BNCreateNamedType)(__VA_ARGS__)
+#define BNGetTypeReferenceClass(...) ::BinaryNinja::ApiProfile::Instrument<1688>(::BNGetTypeReferenceClass)(__VA_ARGS__)
+#define BNGetTypeReferenceId(...) ::BinaryNinja::ApiProfile::Instrument<1689>(::BNGetTypeReferenceId)(__VA_ARGS__)
+#define BNGetTypeReferenceName(...) ::BinaryNinja::ApiProfile::Instrument<1690>(::BNGetTypeReferenceName)(__VA_ARGS__)
+#define BNFreeQualifiedName(...) ::BinaryNinja::ApiProfile::Instrument<1691>(::BNFreeQualifiedName)(__VA_ARGS__)
+#define BNFreeQualifiedNameArray(...) ::BinaryNinja::ApiProfile::Instrument<1692>(::BNFreeQualifiedNameArray)(__VA_ARGS__)
+#define BNFreeNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1693>(::BNFreeNamedTypeReference)(__VA_ARGS__)
+#define BNNewNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1694>(::BNNewNamedTypeReference)(__VA_ARGS__)
+#define BNCreateNamedTypeBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1695>(::BNCreateNamedTypeBuilder)(__VA_ARGS__)
+#define BNFreeNamedTypeReferenceBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1696>(::BNFreeNamedTypeReferenceBuilder)(__VA_ARGS__)
+#define BNSetNamedTypeReferenceBuilderTypeClass(...) ::BinaryNinja::ApiProfile::Instrument<1697>(::BNSetNamedTypeReferenceBuilderTypeClass)(__VA_ARGS__)
+#define BNSetNamedTypeReferenceBuilderTypeId(...) ::BinaryNinja::ApiProfile::Instrument<1698>(::BNSetNamedTypeReferenceBuilderTypeId)(__VA_ARGS__)
+#define BNSetNamedTypeReferenceBuilderName(...) ::BinaryNinja::ApiProfile::Instrument<1699>(::BNSetNamedTypeReferenceBuilderName)(__VA_ARGS__)
+#define BNFinalizeNamedTypeReferenceBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1700>(::BNFinalizeNamedTypeReferenceBuilder)(__VA_ARGS__)
+#define BNGetTypeReferenceBuilderClass(...) ::BinaryNinja::ApiProfile::Instrument<1701>(::BNGetTypeReferenceBuilderClass)(__VA_ARGS__)
+#define BNGetTypeReferenceBuilderId(...) ::BinaryNinja::ApiProfile::Instrument<1702>(::BNGetTypeReferenceBuilderId)(__VA_ARGS__)
+#define BNGetTypeReferenceBuilderName(...) ::BinaryNinja::ApiProfile::Instrument<1703>(::BNGetTypeReferenceBuilderName)(__VA_ARGS__)
+#define BNCreateStructureBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1704>(::BNCreateStructureBuilder)(__VA_ARGS__)
+#define BNCreateStructureBuilderWithOptions(...) ::BinaryNinja::ApiProfile::Instrument<1705>(::BNCreateStructureBuilderWithOptions)(__VA_ARGS__)
+#define BNCreateStructureBuilderFromStructure(...) ::BinaryNinja::ApiProfile::Instrument<1706>(::BNCreateStructureBuilderFromStructure)(__VA_ARGS__)
+#define BNDuplicateStructureBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1707>(::BNDuplicateStructureBuilder)(__VA_ARGS__)
+#define BNFinalizeStructureBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1708>(::BNFinalizeStructureBuilder)(__VA_ARGS__)
+#define BNNewStructureReference(...) ::BinaryNinja::ApiProfile::Instrument<1709>(::BNNewStructureReference)(__VA_ARGS__)
+#define BNFreeStructure(...) ::BinaryNinja::ApiProfile::Instrument<1710>(::BNFreeStructure)(__VA_ARGS__)
+#define BNFreeStructureBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1711>(::BNFreeStructureBuilder)(__VA_ARGS__)
+#define BNGetStructureMemberByName(...) ::BinaryNinja::ApiProfile::Instrument<1712>(::BNGetStructureMemberByName)(__VA_ARGS__)
+#define BNGetStructureMemberAtOffset(...) ::BinaryNinja::ApiProfile::Instrument<1713>(::BNGetStructureMemberAtOffset)(__VA_ARGS__)
+#define BNFreeStructureMember(...) ::BinaryNinja::ApiProfile::Instrument<1714>(::BNFreeStructureMember)(__VA_ARGS__)
+#define BNGetStructureMembers(...) ::BinaryNinja::ApiProfile::Instrument<1715>(::BNGetStructureMembers)(__VA_ARGS__)
+#define BNFreeStructureMemberList(...) ::BinaryNinja::ApiProfile::Instrument<1716>(::BNFreeStructureMemberList)(__VA_ARGS__)
+#define BNGetStructureMembersIncludingInherited(...) ::BinaryNinja::ApiProfile::Instrument<1717>(::BNGetStructureMembersIncludingInherited)(__VA_ARGS__)
+#define BNFreeInheritedStructureMemberList(...) ::BinaryNinja::ApiProfile::Instrument<1718>(::BNFreeInheritedStructureMemberList)(__VA_ARGS__)
+#define BNGetMemberIncludingInheritedAtOffset(...) ::BinaryNinja::ApiProfile::Instrument<1719>(::BNGetMemberIncludingInheritedAtOffset)(__VA_ARGS__)
+#define BNFreeInheritedStructureMember(...) ::BinaryNinja::ApiProfile::Instrument<1720>(::BNFreeInheritedStructureMember)(__VA_ARGS__)
+#define BNGetStructureWidth(...) ::BinaryNinja::ApiProfile::Instrument<1721>(::BNGetStructureWidth)(__VA_ARGS__)
+#define BNGetStructurePointerOffset(...) ::BinaryNinja::ApiProfile::Instrument<1722>(::BNGetStructurePointerOffset)(__VA_ARGS__)
+#define BNGetStructureAlignment(...) ::BinaryNinja::ApiProfile::Instrument<1723>(::BNGetStructureAlignment)(__VA_ARGS__)
+#define BNIsStructurePacked(...) ::BinaryNinja::ApiProfile::Instrument<1724>(::BNIsStructurePacked)(__VA_ARGS__)
+#define BNIsStructureUnion(...) ::BinaryNinja::ApiProfile::Instrument<1725>(::BNIsStructureUnion)(__VA_ARGS__)
+#define BNStructurePropagatesDataVariableReferences(...) ::BinaryNinja::ApiProfile::Instrument<1726>(::BNStructurePropagatesDataVariableReferences)(__VA_ARGS__)
+#define BNGetStructureType(...) ::BinaryNinja::ApiProfile::Instrument<1727>(::BNGetStructureType)(__VA_ARGS__)
+#define BNGetBaseStructuresForStructure(...) ::BinaryNinja::ApiProfile::Instrument<1728>(::BNGetBaseStructuresForStructure)(__VA_ARGS__)
+#define BNFreeBaseStructureList(...) ::BinaryNinja::ApiProfile::Instrument<1729>(::BNFreeBaseStructureList)(__VA_ARGS__)
+#define BNStructureWithReplacedStructure(...) ::BinaryNinja::ApiProfile::Instrument<1730>(::BNStructureWithReplacedStructure)(__VA_ARGS__)
+#define BNStructureWithReplacedEnumeration(...) ::BinaryNinja::ApiProfile::Instrument<1731>(::BNStructureWithReplacedEnumeration)(__VA_ARGS__)
+#define BNStructureWithReplacedNamedTypeReference(...) ::BinaryNinja::ApiProfile::Instrument<1732>(::BNStructureWithReplacedNamedTypeReference)(__VA_ARGS__)
+#define BNGetStructureBuilderMemberByName(...) ::BinaryNinja::ApiProfile::Instrument<1733>(::BNGetStructureBuilderMemberByName)(__VA_ARGS__)
+#define BNGetStructureBuilderMemberAtOffset(...) ::BinaryNinja::ApiProfile::Instrument<1734>(::BNGetStructureBuilderMemberAtOffset)(__VA_ARGS__)
+#define BNGetStructureBuilderMembers(...) ::BinaryNinja::ApiProfile::Instrument<1735>(::BNGetStructureBuilderMembers)(__VA_ARGS__)
+#define BNGetStructureBuilderWidth(...) ::BinaryNinja::ApiProfile::Instrument<1736>(::BNGetStructureBuilderWidth)(__VA_ARGS__)
+#define BNSetStructureBuilderWidth(...) ::BinaryNinja::ApiProfile::Instrument<1737>(::BNSetStructureBuilderWidth)(__VA_ARGS__)
+#define BNGetStructureBuilderPointerOffset(...) ::BinaryNinja::ApiProfile::Instrument<1738>(::BNGetStructureBuilderPointerOffset)(__VA_ARGS__)
+#define BNSetStructureBuilderPointerOffset(...) ::BinaryNinja::ApiProfile::Instrument<1739>(::BNSetStructureBuilderPointerOffset)(__VA_ARGS__)
+#define BNGetStructureBuilderAlignment(...) ::BinaryNinja::ApiProfile::Instrument<1740>(::BNGetStructureBuilderAlignment)(__VA_ARGS__)
+#define BNSetStructureBuilderAlignment(...) ::BinaryNinja::ApiProfile::Instrument<1741>(::BNSetStructureBuilderAlignment)(__VA_ARGS__)
+#define BNIsStructureBuilderPacked(...) ::BinaryNinja::ApiProfile::Instrument<1742>(::BNIsStructureBuilderPacked)(__VA_ARGS__)
+#define BNSetStructureBuilderPacked(...) ::BinaryNinja::ApiProfile::Instrument<1743>(::BNSetStructureBuilderPacked)(__VA_ARGS__)
+#define BNIsStructureBuilderUnion(...) ::BinaryNinja::ApiProfile::Instrument<1744>(::BNIsStructureBuilderUnion)(__VA_ARGS__)
+#define BNSetStructureBuilderType(...) ::BinaryNinja::ApiProfile::Instrument<1745>(::BNSetStructureBuilderType)(__VA_ARGS__)
+#define BNStructureBuilderPropagatesDataVariableReferences(...) ::BinaryNinja::ApiProfile::Instrument<1746>(::BNStructureBuilderPropagatesDataVariableReferences)(__VA_ARGS__)
+#define BNSetStructureBuilderPropagatesDataVariableReferences(...) ::BinaryNinja::ApiProfile::Instrument<1747>(::BNSetStructureBuilderPropagatesDataVariableReferences)(__VA_ARGS__)
+#define BNGetStructureBuilderType(...) ::BinaryNinja::ApiProfile::Instrument<1748>(::BNGetStructureBuilderType)(__VA_ARGS__)
+#define BNGetBaseStructuresForStructureBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1749>(::BNGetBaseStructuresForStructureBuilder)(__VA_ARGS__)
+#define BNSetBaseStructuresForStructureBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1750>(::BNSetBaseStructuresForStructureBuilder)(__VA_ARGS__)
+#define BNAddStructureBuilderMember(...) ::BinaryNinja::ApiProfile::Instrument<1751>(::BNAddStructureBuilderMember)(__VA_ARGS__)
+#define BNAddStructureBuilderMemberAtOffset(...) ::BinaryNinja::ApiProfile::Instrument<1752>(::BNAddStructureBuilderMemberAtOffset)(__VA_ARGS__)
+#define BNRemoveStructureBuilderMember(...) ::BinaryNinja::ApiProfile::Instrument<1753>(::BNRemoveStructureBuilderMember)(__VA_ARGS__)
+#define BNReplaceStructureBuilderMember(...) ::BinaryNinja::ApiProfile::Instrument<1754>(::BNReplaceStructureBuilderMember)(__VA_ARGS__)
+#define BNCreateEnumerationBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1755>(::BNCreateEnumerationBuilder)(__VA_ARGS__)
+#define BNCreateEnumerationBuilderFromEnumeration(...) ::BinaryNinja::ApiProfile::Instrument<1756>(::BNCreateEnumerationBuilderFromEnumeration)(__VA_ARGS__)
+#define BNDuplicateEnumerationBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1757>(::BNDuplicateEnumerationBuilder)(__VA_ARGS__)
+#define BNFinalizeEnumerationBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1758>(::BNFinalizeEnumerationBuilder)(__VA_ARGS__)
+#define BNNewEnumerationReference(...) ::BinaryNinja::ApiProfile::Instrument<1759>(::BNNewEnumerationReference)(__VA_ARGS__)
+#define BNFreeEnumeration(...) ::BinaryNinja::ApiProfile::Instrument<1760>(::BNFreeEnumeration)(__VA_ARGS__)
+#define BNFreeEnumerationBuilder(...) ::BinaryNinja::ApiProfile::Instrument<1761>(::BNFreeEnumerationBuilder)(__VA_ARGS__)
+#define BNGetEnumerationMembers(...) ::BinaryNinja::ApiProfile::Instrument<1762>(::BNGetEnumerationMembers)(__VA_ARGS__)
+#define BNGetEnumerationTokensForValue(...) ::BinaryNinja::ApiProfile::Instrument<1763>(::BNGetEnumerationTokensForValue)(__VA_ARGS__)
+#define BNFreeEnumerationMemberList(...) ::BinaryNinja::ApiProfile::Instrument<1764>(::BNFreeEnumerationMemberList)(__VA_ARGS__)
+#define BNGetEnumerationBuilderMembers(...) ::BinaryNinja::ApiProfile::Instrument<1765>(::BNGetEnumerationBuilderMembers)(__VA_ARGS__)
+#define BNAddEnumerationBuilderMember(...) ::BinaryNinja::ApiProfile::Instrument<1766>(::BNAddEnumerationBuilderMember)(__VA_ARGS__)
+#define BNAddEnumerationBuilderMemberWithValue(...) ::BinaryNinja::ApiProfile::Instrument<1767>(::BNAddEnumerationBuilderMemberWithValue)(__VA_ARGS__)
+#define BNRemoveEnumerationBuilderMember(...) ::BinaryNinja::ApiProfile::Instrument<1768>(::BNRemoveEnumerationBuilderMember)(__VA_ARGS__)
+#define BNReplaceEnumerationBuilderMember(...) ::BinaryNinja::ApiProfile::Instrument<1769>(::BNReplaceEnumerationBuilderMember)(__VA_ARGS__)
+#define BNCreateStructureFromOffsetAccess(...) ::BinaryNinja::ApiProfile::Instrument<1770>(::BNCreateStructureFromOffsetAccess)(__VA_ARGS__)
+#define BNCreateStructureMemberFromAccess(...) ::BinaryNinja::ApiProfile::Instrument<1771>(::BNCreateStructureMemberFromAccess)(__VA_ARGS__)
+#define BNAddExpressionParserMagicValue(...) ::BinaryNinja::ApiProfile::Instrument<1772>(::BNAddExpressionParserMagicValue)(__VA_ARGS__)
+#define BNRemoveExpressionParserMagicValue(...) ::BinaryNinja::ApiProfile::Instrument<1773>(::BNRemoveExpressionParserMagicValue)(__VA_ARGS__)
+#define BNAddExpressionParserMagicValues(...) ::BinaryNinja::ApiProfile::Instrument<1774>(::BNAddExpressionParserMagicValues)(__VA_ARGS__)
+#define BNRemoveExpressionParserMagicValues(...) ::BinaryNinja::ApiProfile::Instrument<1775>(::BNRemoveExpressionParserMagicValues)(__VA_ARGS__)
+#define BNGetExpressionParserMagicValue(...) ::BinaryNinja::ApiProfile::Instrument<1776>(::BNGetExpressionParserMagicValue)(__VA_ARGS__)
+#define BNGetFunctionParentComponents(...) ::BinaryNinja::ApiProfile::Instrument<1777>(::BNGetFunctionParentComponents)(__VA_ARGS__)
+#define BNGetDataVariableParentComponents(...) ::BinaryNinja::ApiProfile::Instrument<1778>(::BNGetDataVariableParentComponents)(__VA_ARGS__)
+#define BNCheckForStringAnnotationType(...) ::BinaryNinja::ApiProfile::Instrument<1779>(::BNCheckForStringAnnotationType)(__VA_ARGS__)
+#define BNLoadFilename(...) ::BinaryNinja::ApiProfile::Instrument<1780>(::BNLoadFilename)(__VA_ARGS__)
+#define BNLoadBinaryView(...) ::BinaryNinja::ApiProfile::Instrument<1781>(::BNLoadBinaryView)(__VA_ARGS__)
+#define BNPreprocessSource(...) ::BinaryNinja::ApiProfile::Instrument<1782>(::BNPreprocessSource)(__VA_ARGS__)
+#define BNParseTypesFromSource(...) ::BinaryNinja::ApiProfile::Instrument<1783>(::BNParseTypesFromSource)(__VA_ARGS__)
+#define BNParseTypesFromSourceFile(...) ::BinaryNinja::ApiProfile::Instrument<1784>(::BNParseTypesFromSourceFile)(__VA_ARGS__)
+#define BNRegisterTypeParser(...) ::BinaryNinja::ApiProfile::Instrument<1785>(::BNRegisterTypeParser)(__VA_ARGS__)
+#define BNGetTypeParserList(...) ::BinaryNinja::ApiProfile::Instrument<1786>(::BNGetTypeParserList)(__VA_ARGS__)
+#define BNFreeTypeParserList(...) ::BinaryNinja::ApiProfile::Instrument<1787>(::BNFreeTypeParserList)(__VA_ARGS__)
+#define BNGetTypeParserByName(...) ::BinaryNinja::ApiProfile::Instrument<1788>(::BNGetTypeParserByName)(__VA_ARGS__)
+#define BNGetDefaultTypeParser(...) ::BinaryNinja::ApiProfile::Instrument<1789>(::BNGetDefaultTypeParser)(__VA_ARGS__)
+#define BNGetTypeParserName(...) ::BinaryNinja::ApiProfile::Instrument<1790>(::BNGetTypeParserName)(__VA_ARGS__)
+#define BNGetTypeParserOptionText(...) ::BinaryNinja::ApiProfile::Instrument<1791>(::BNGetTypeParserOptionText)(__VA_ARGS__)
+#define BNTypeParserPreprocessSource(...) ::BinaryNinja::ApiProfile::Instrument<1792>(::BNTypeParserPreprocessSource)(__VA_ARGS__)
+#define BNTypeParserParseTypesFromSource(...) ::BinaryNinja::ApiProfile::Instrument<1793>(::BNTypeParserParseTypesFromSource)(__VA_ARGS__)
+#define BNTypeParserParseTypeString(...) ::BinaryNinja::ApiProfile::Instrument<1794>(::BNTypeParserParseTypeString)(__VA_ARGS__)
+#define BNParseTypeParserOptionsText(...) ::BinaryNinja::ApiProfile::Instrument<1795>(::BNParseTypeParserOptionsText)(__VA_ARGS__)
+#define BNFormatTypeParserParseErrors(...) ::BinaryNinja::ApiProfile::Instrument<1796>(::BNFormatTypeParserParseErrors)(__VA_ARGS__)
+#define BNRegisterTypePrinter(...) ::BinaryNinja::ApiProfile::Instrument<1797>(::BNRegisterTypePrinter)(__VA_ARGS__)
+#define BNGetTypePrinterList(...) ::BinaryNinja::ApiProfile::Instrument<1798>(::BNGetTypePrinterList)(__VA_ARGS__)
+#define BNFreeTypePrinterList(...) ::BinaryNinja::ApiProfile::Instrument<1799>(::BNFreeTypePrinterList)(__VA_ARGS__)
+#define BNGetTypePrinterByName(...) ::BinaryNinja::ApiProfile::Instrument<1800>(::BNGetTypePrinterByName)(__VA_ARGS__)
+#define BNGetTypePrinterName(...) ::BinaryNinja::ApiProfile::Instrument<1801>(::BNGetTypePrinterName)(__VA_ARGS__)
+#define BNGetTypePrinterTypeTokens(...) ::BinaryNinja::ApiProfile::Instrument<1802>(::BNGetTypePrinterTypeTokens)(__VA_ARGS__)
+#define BNGetTypePrinterTypeTokensBeforeName(...) ::BinaryNinja::ApiProfile::Instrument<1803>(::BNGetTypePrinterTypeTokensBeforeName)(__VA_ARGS__)
+#define BNGetTypePrinterTypeTokensAfterName(...) ::BinaryNinja::ApiProfile::Instrument<1804>(::BNGetTypePrinterTypeTokensAfterName)(__VA_ARGS__)
+#define BNGetTypePrinterTypeString(...) ::BinaryNinja::ApiProfile::Instrument<1805>(::BNGetTypePrinterTypeString)(__VA_ARGS__)
+#define BNGetTypePrinterTypeStringBeforeName(...) ::BinaryNinja::ApiProfile::Instrument<1806>(::BNGetTypePrinterTypeStringBeforeName)(__VA_ARGS__)
+#define BNGetTypePrinterTypeStringAfterName(...) ::BinaryNinja::ApiProfile::Instrument<1807>(::BNGetTypePrinterTypeStringAfterName)(__VA_ARGS__)
+#define BNGetTypePrinterTypeLines(...) ::BinaryNinja::ApiProfile::Instrument<1808>(::BNGetTypePrinterTypeLines)(__VA_ARGS__)
+#define BNTypePrinterPrintAllTypes(...) ::BinaryNinja::ApiProfile::Instrument<1809>(::BNTypePrinterPrintAllTypes)(__VA_ARGS__)
+#define BNTypePrinterDefaultPrintAllTypes(...) ::BinaryNinja::ApiProfile::Instrument<1810>(::BNTypePrinterDefaultPrintAllTypes)(__VA_ARGS__)
+#define BNFreeTypeParserResult(...) ::BinaryNinja::ApiProfile::Instrument<1811>(::BNFreeTypeParserResult)(__VA_ARGS__)
+#define BNFreeTypeParserErrors(...) ::BinaryNinja::ApiProfile::Instrument<1812>(::BNFreeTypeParserErrors)(__VA_ARGS__)
+#define BNGetUpdateChannels(...) ::BinaryNinja::ApiProfile::Instrument<1813>(::BNGetUpdateChannels)(__VA_ARGS__)
+#define BNFreeUpdateChannelList(...) ::BinaryNinja::ApiProfile::Instrument<1814>(::BNFreeUpdateChannelList)(__VA_ARGS__)
+#define BNGetUpdateChannelVersions(...) ::BinaryNinja::ApiProfile::Instrument<1815>(::BNGetUpdateChannelVersions)(__VA_ARGS__)
+#define BNFreeUpdateChannelVersionList(...) ::BinaryNinja::ApiProfile::Instrument<1816>(::BNFreeUpdateChannelVersionList)(__VA_ARGS__)
+#define BNAreUpdatesAvailable(...) ::BinaryNinja::ApiProfile::Instrument<1817>(::BNAreUpdatesAvailable)(__VA_ARGS__)
+#define BNUpdateToVersion(...) ::BinaryNinja::ApiProfile::Instrument<1818>(::BNUpdateToVersion)(__VA_ARGS__)
+#define BNUpdateToLatestVersion(...) ::BinaryNinja::ApiProfile::Instrument<1819>(::BNUpdateToLatestVersion)(__VA_ARGS__)
+#define BNAreAutoUpdatesEnabled(...) ::BinaryNinja::ApiProfile::Instrument<1820>(::BNAreAutoUpdatesEnabled)(__VA_ARGS__)
+#define BNSetAutoUpdatesEnabled(...) ::BinaryNinja::ApiProfile::Instrument<1821>(::BNSetAutoUpdatesEnabled)(__VA_ARGS__)
+#define BNGetTimeSinceLastUpdateCheck(...) ::BinaryNinja::ApiProfile::Instrument<1822>(::BNGetTimeSinceLastUpdateCheck)(__VA_ARGS__)
+#define BNUpdatesChecked(...) ::BinaryNinja::ApiProfile::Instrument<1823>(::BNUpdatesChecked)(__VA_ARGS__)
+#define BNGetActiveUpdateChannel(...) ::BinaryNinja::ApiProfile::Instrument<1824>(::BNGetActiveUpdateChannel)(__VA_ARGS__)
+#define BNSetActiveUpdateChannel(...) ::BinaryNinja::ApiProfile::Instrument<1825>(::BNSetActiveUpdateChannel)(__VA_ARGS__)
+#define BNIsUpdateInstallationPending(...) ::BinaryNinja::ApiProfile::Instrument<1826>(::BNIsUpdateInstallationPending)(__VA_ARGS__)
+#define BNInstallPendingUpdate(...) ::BinaryNinja::ApiProfile::Instrument<1827>(::BNInstallPendingUpdate)(__VA_ARGS__)
+#define BNRegisterPluginCommand(...) ::BinaryNinja::ApiProfile::Instrument<1828>(::BNRegisterPluginCommand)(__VA_ARGS__)
+#define BNRegisterPluginCommandForAddress(...) ::BinaryNinja::ApiProfile::Instrument<1829>(::BNRegisterPluginCommandForAddress)(__VA_ARGS__)
+#define BNRegisterPluginCommandForRange(...) ::BinaryNinja::ApiProfile::Instrument<1830>(::BNRegisterPluginCommandForRange)(__VA_ARGS__)
+#define BNRegisterPluginCommandForFunction(...) ::BinaryNinja::ApiProfile::Instrument<1831>(::BNRegisterPluginCommandForFunction)(__VA_ARGS__)
+#define BNRegisterPluginCommandForLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1832>(::BNRegisterPluginCommandForLowLevelILFunction)(__VA_ARGS__)
+#define BNRegisterPluginCommandForLowLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1833>(::BNRegisterPluginCommandForLowLevelILInstruction)(__VA_ARGS__)
+#define BNRegisterPluginCommandForMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1834>(::BNRegisterPluginCommandForMediumLevelILFunction)(__VA_ARGS__)
+#define BNRegisterPluginCommandForMediumLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1835>(::BNRegisterPluginCommandForMediumLevelILInstruction)(__VA_ARGS__)
+#define BNRegisterPluginCommandForHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1836>(::BNRegisterPluginCommandForHighLevelILFunction)(__VA_ARGS__)
+#define BNRegisterPluginCommandForHighLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1837>(::BNRegisterPluginCommandForHighLevelILInstruction)(__VA_ARGS__)
+#define BNGetAllPluginCommands(...) ::BinaryNinja::ApiProfile::Instrument<1838>(::BNGetAllPluginCommands)(__VA_ARGS__)
+#define BNGetValidPluginCommands(...) ::BinaryNinja::ApiProfile::Instrument<1839>(::BNGetValidPluginCommands)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForAddress(...) ::BinaryNinja::ApiProfile::Instrument<1840>(::BNGetValidPluginCommandsForAddress)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForRange(...) ::BinaryNinja::ApiProfile::Instrument<1841>(::BNGetValidPluginCommandsForRange)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForFunction(...) ::BinaryNinja::ApiProfile::Instrument<1842>(::BNGetValidPluginCommandsForFunction)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForLowLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1843>(::BNGetValidPluginCommandsForLowLevelILFunction)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForLowLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1844>(::BNGetValidPluginCommandsForLowLevelILInstruction)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForMediumLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1845>(::BNGetValidPluginCommandsForMediumLevelILFunction)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForMediumLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1846>(::BNGetValidPluginCommandsForMediumLevelILInstruction)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForHighLevelILFunction(...) ::BinaryNinja::ApiProfile::Instrument<1847>(::BNGetValidPluginCommandsForHighLevelILFunction)(__VA_ARGS__)
+#define BNGetValidPluginCommandsForHighLevelILInstruction(...) ::BinaryNinja::ApiProfile::Instrument<1848>(::BNGetValidPluginCommandsForHighLevelILInstruction)(__VA_ARGS__)
+#define BNFreePluginCommandList(...) ::BinaryNinja::ApiProfile::Instrument<1849>(::BNFreePluginCommandList)(__VA_ARGS__)
+#define BNCreateCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1850>(::BNCreateCallingConvention)(__VA_ARGS__)
+#define BNRegisterCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1851>(::BNRegisterCallingConvention)(__VA_ARGS__)
+#define BNNewCallingConventionReference(...) ::BinaryNinja::ApiProfile::Instrument<1852>(::BNNewCallingConventionReference)(__VA_ARGS__)
+#define BNFreeCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1853>(::BNFreeCallingConvention)(__VA_ARGS__)
+#define BNGetArchitectureCallingConventions(...) ::BinaryNinja::ApiProfile::Instrument<1854>(::BNGetArchitectureCallingConventions)(__VA_ARGS__)
+#define BNFreeCallingConventionList(...) ::BinaryNinja::ApiProfile::Instrument<1855>(::BNFreeCallingConventionList)(__VA_ARGS__)
+#define BNGetArchitectureCallingConventionByName(...) ::BinaryNinja::ApiProfile::Instrument<1856>(::BNGetArchitectureCallingConventionByName)(__VA_ARGS__)
+#define BNGetCallingConventionArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<1857>(::BNGetCallingConventionArchitecture)(__VA_ARGS__)
+#define BNGetCallingConventionName(...) ::BinaryNinja::ApiProfile::Instrument<1858>(::BNGetCallingConventionName)(__VA_ARGS__)
+#define BNGetCallerSavedRegisters(...) ::BinaryNinja::ApiProfile::Instrument<1859>(::BNGetCallerSavedRegisters)(__VA_ARGS__)
+#define BNGetCalleeSavedRegisters(...) ::BinaryNinja::ApiProfile::Instrument<1860>(::BNGetCalleeSavedRegisters)(__VA_ARGS__)
+#define BNGetIntegerArgumentRegisters(...) ::BinaryNinja::ApiProfile::Instrument<1861>(::BNGetIntegerArgumentRegisters)(__VA_ARGS__)
+#define BNGetFloatArgumentRegisters(...) ::BinaryNinja::ApiProfile::Instrument<1862>(::BNGetFloatArgumentRegisters)(__VA_ARGS__)
+#define BNAreArgumentRegistersSharedIndex(...) ::BinaryNinja::ApiProfile::Instrument<1863>(::BNAreArgumentRegistersSharedIndex)(__VA_ARGS__)
+#define BNAreArgumentRegistersUsedForVarArgs(...) ::BinaryNinja::ApiProfile::Instrument<1864>(::BNAreArgumentRegistersUsedForVarArgs)(__VA_ARGS__)
+#define BNIsStackReservedForArgumentRegisters(...) ::BinaryNinja::ApiProfile::Instrument<1865>(::BNIsStackReservedForArgumentRegisters)(__VA_ARGS__)
+#define BNIsStackAdjustedOnReturn(...) ::BinaryNinja::ApiProfile::Instrument<1866>(::BNIsStackAdjustedOnReturn)(__VA_ARGS__)
+#define BNIsEligibleForHeuristics(...) ::BinaryNinja::ApiProfile::Instrument<1867>(::BNIsEligibleForHeuristics)(__VA_ARGS__)
+#define BNGetIntegerReturnValueRegister(...) ::BinaryNinja::ApiProfile::Instrument<1868>(::BNGetIntegerReturnValueRegister)(__VA_ARGS__)
+#define BNGetHighIntegerReturnValueRegister(...) ::BinaryNinja::ApiProfile::Instrument<1869>(::BNGetHighIntegerReturnValueRegister)(__VA_ARGS__)
+#define BNGetFloatReturnValueRegister(...) ::BinaryNinja::ApiProfile::Instrument<1870>(::BNGetFloatReturnValueRegister)(__VA_ARGS__)
+#define BNGetGlobalPointerRegister(...) ::BinaryNinja::ApiProfile::Instrument<1871>(::BNGetGlobalPointerRegister)(__VA_ARGS__)
+#define BNGetImplicitlyDefinedRegisters(...) ::BinaryNinja::ApiProfile::Instrument<1872>(::BNGetImplicitlyDefinedRegisters)(__VA_ARGS__)
+#define BNGetIncomingRegisterValue(...) ::BinaryNinja::ApiProfile::Instrument<1873>(::BNGetIncomingRegisterValue)(__VA_ARGS__)
+#define BNGetIncomingFlagValue(...) ::BinaryNinja::ApiProfile::Instrument<1874>(::BNGetIncomingFlagValue)(__VA_ARGS__)
+#define BNGetVariablesForParametersDefaultPermittedArgs(...) ::BinaryNinja::ApiProfile::Instrument<1875>(::BNGetVariablesForParametersDefaultPermittedArgs)(__VA_ARGS__)
+#define BNGetVariablesForParameters(...) ::BinaryNinja::ApiProfile::Instrument<1876>(::BNGetVariablesForParameters)(__VA_ARGS__)
+#define BNGetParameterOrderingForVariables(...) ::BinaryNinja::ApiProfile::Instrument<1877>(::BNGetParameterOrderingForVariables)(__VA_ARGS__)
+#define BNGetStackAdjustmentForVariables(...) ::BinaryNinja::ApiProfile::Instrument<1878>(::BNGetStackAdjustmentForVariables)(__VA_ARGS__)
+#define BNGetRegisterStackAdjustments(...) ::BinaryNinja::ApiProfile::Instrument<1879>(::BNGetRegisterStackAdjustments)(__VA_ARGS__)
+#define BNGetIncomingVariableForParameterVariable(...) ::BinaryNinja::ApiProfile::Instrument<1880>(::BNGetIncomingVariableForParameterVariable)(__VA_ARGS__)
+#define BNGetParameterVariableForIncomingVariable(...) ::BinaryNinja::ApiProfile::Instrument<1881>(::BNGetParameterVariableForIncomingVariable)(__VA_ARGS__)
+#define BNGetDefaultIncomingVariableForParameterVariable(...) ::BinaryNinja::ApiProfile::Instrument<1882>(::BNGetDefaultIncomingVariableForParameterVariable)(__VA_ARGS__)
+#define BNGetDefaultParameterVariableForIncomingVariable(...) ::BinaryNinja::ApiProfile::Instrument<1883>(::BNGetDefaultParameterVariableForIncomingVariable)(__VA_ARGS__)
+#define BNGetArchitectureDefaultCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1884>(::BNGetArchitectureDefaultCallingConvention)(__VA_ARGS__)
+#define BNGetArchitectureCdeclCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1885>(::BNGetArchitectureCdeclCallingConvention)(__VA_ARGS__)
+#define BNGetArchitectureStdcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1886>(::BNGetArchitectureStdcallCallingConvention)(__VA_ARGS__)
+#define BNGetArchitectureFastcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1887>(::BNGetArchitectureFastcallCallingConvention)(__VA_ARGS__)
+#define BNSetArchitectureDefaultCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1888>(::BNSetArchitectureDefaultCallingConvention)(__VA_ARGS__)
+#define BNSetArchitectureCdeclCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1889>(::BNSetArchitectureCdeclCallingConvention)(__VA_ARGS__)
+#define BNSetArchitectureStdcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1890>(::BNSetArchitectureStdcallCallingConvention)(__VA_ARGS__)
+#define BNSetArchitectureFastcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1891>(::BNSetArchitectureFastcallCallingConvention)(__VA_ARGS__)
+#define BNCreatePlatform(...) ::BinaryNinja::ApiProfile::Instrument<1892>(::BNCreatePlatform)(__VA_ARGS__)
+#define BNCreatePlatformWithTypes(...) ::BinaryNinja::ApiProfile::Instrument<1893>(::BNCreatePlatformWithTypes)(__VA_ARGS__)
+#define BNRegisterPlatform(...) ::BinaryNinja::ApiProfile::Instrument<1894>(::BNRegisterPlatform)(__VA_ARGS__)
+#define BNNewPlatformReference(...) ::BinaryNinja::ApiProfile::Instrument<1895>(::BNNewPlatformReference)(__VA_ARGS__)
+#define BNFreePlatform(...) ::BinaryNinja::ApiProfile::Instrument<1896>(::BNFreePlatform)(__VA_ARGS__)
+#define BNGetPlatformName(...) ::BinaryNinja::ApiProfile::Instrument<1897>(::BNGetPlatformName)(__VA_ARGS__)
+#define BNGetPlatformArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<1898>(::BNGetPlatformArchitecture)(__VA_ARGS__)
+#define BNGetPlatformByName(...) ::BinaryNinja::ApiProfile::Instrument<1899>(::BNGetPlatformByName)(__VA_ARGS__)
+#define BNGetPlatformList(...) ::BinaryNinja::ApiProfile::Instrument<1900>(::BNGetPlatformList)(__VA_ARGS__)
+#define BNGetPlatformListByArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<1901>(::BNGetPlatformListByArchitecture)(__VA_ARGS__)
+#define BNGetPlatformListByOS(...) ::BinaryNinja::ApiProfile::Instrument<1902>(::BNGetPlatformListByOS)(__VA_ARGS__)
+#define BNGetPlatformListByOSAndArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<1903>(::BNGetPlatformListByOSAndArchitecture)(__VA_ARGS__)
+#define BNFreePlatformList(...) ::BinaryNinja::ApiProfile::Instrument<1904>(::BNFreePlatformList)(__VA_ARGS__)
+#define BNGetPlatformOSList(...) ::BinaryNinja::ApiProfile::Instrument<1905>(::BNGetPlatformOSList)(__VA_ARGS__)
+#define BNFreePlatformOSList(...) ::BinaryNinja::ApiProfile::Instrument<1906>(::BNFreePlatformOSList)(__VA_ARGS__)
+#define BNGetPlatformDefaultCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1907>(::BNGetPlatformDefaultCallingConvention)(__VA_ARGS__)
+#define BNGetPlatformCdeclCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1908>(::BNGetPlatformCdeclCallingConvention)(__VA_ARGS__)
+#define BNGetPlatformStdcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1909>(::BNGetPlatformStdcallCallingConvention)(__VA_ARGS__)
+#define BNGetPlatformFastcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1910>(::BNGetPlatformFastcallCallingConvention)(__VA_ARGS__)
+#define BNGetPlatformCallingConventions(...) ::BinaryNinja::ApiProfile::Instrument<1911>(::BNGetPlatformCallingConventions)(__VA_ARGS__)
+#define BNGetPlatformSystemCallConvention(...) ::BinaryNinja::ApiProfile::Instrument<1912>(::BNGetPlatformSystemCallConvention)(__VA_ARGS__)
+#define BNRegisterPlatformCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1913>(::BNRegisterPlatformCallingConvention)(__VA_ARGS__)
+#define BNRegisterPlatformDefaultCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1914>(::BNRegisterPlatformDefaultCallingConvention)(__VA_ARGS__)
+#define BNRegisterPlatformCdeclCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1915>(::BNRegisterPlatformCdeclCallingConvention)(__VA_ARGS__)
+#define BNRegisterPlatformStdcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1916>(::BNRegisterPlatformStdcallCallingConvention)(__VA_ARGS__)
+#define BNRegisterPlatformFastcallCallingConvention(...) ::BinaryNinja::ApiProfile::Instrument<1917>(::BNRegisterPlatformFastcallCallingConvention)(__VA_ARGS__)
+#define BNSetPlatformSystemCallConvention(...) ::BinaryNinja::ApiProfile::Instrument<1918>(::BNSetPlatformSystemCallConvention)(__VA_ARGS__)
+#define BNGetArchitectureStandalonePlatform(...) ::BinaryNinja::ApiProfile::Instrument<1919>(::BNGetArchitectureStandalonePlatform)(__VA_ARGS__)
+#define BNGetRelatedPlatform(...) ::BinaryNinja::ApiProfile::Instrument<1920>(::BNGetRelatedPlatform)(__VA_ARGS__)
+#define BNAddRelatedPlatform(...) ::BinaryNinja::ApiProfile::Instrument<1921>(::BNAddRelatedPlatform)(__VA_ARGS__)
+#define BNGetAssociatedPlatformByAddress(...) ::BinaryNinja::ApiProfile::Instrument<1922>(::BNGetAssociatedPlatformByAddress)(__VA_ARGS__)
+#define BNGetPlatformTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<1923>(::BNGetPlatformTypeContainer)(__VA_ARGS__)
+#define BNGetPlatformTypes(...) ::BinaryNinja::ApiProfile::Instrument<1924>(::BNGetPlatformTypes)(__VA_ARGS__)
+#define BNGetPlatformVariables(...) ::BinaryNinja::ApiProfile::Instrument<1925>(::BNGetPlatformVariables)(__VA_ARGS__)
+#define BNGetPlatformFunctions(...) ::BinaryNinja::ApiProfile::Instrument<1926>(::BNGetPlatformFunctions)(__VA_ARGS__)
+#define BNGetPlatformSystemCalls(...) ::BinaryNinja::ApiProfile::Instrument<1927>(::BNGetPlatformSystemCalls)(__VA_ARGS__)
+#define BNFreeSystemCallList(...) ::BinaryNinja::ApiProfile::Instrument<1928>(::BNFreeSystemCallList)(__VA_ARGS__)
+#define BNGetPlatformTypeByName(...) ::BinaryNinja::ApiProfile::Instrument<1929>(::BNGetPlatformTypeByName)(__VA_ARGS__)
+#define BNGetPlatformVariableByName(...) ::BinaryNinja::ApiProfile::Instrument<1930>(::BNGetPlatformVariableByName)(__VA_ARGS__)
+#define BNGetPlatformFunctionByName(...) ::BinaryNinja::ApiProfile::Instrument<1931>(::BNGetPlatformFunctionByName)(__VA_ARGS__)
+#define BNGetPlatformSystemCallName(...) ::BinaryNinja::ApiProfile::Instrument<1932>(::BNGetPlatformSystemCallName)(__VA_ARGS__)
+#define BNGetPlatformSystemCallType(...) ::BinaryNinja::ApiProfile::Instrument<1933>(::BNGetPlatformSystemCallType)(__VA_ARGS__)
+#define BNGetPlatformTypeLibraries(...) ::BinaryNinja::ApiProfile::Instrument<1934>(::BNGetPlatformTypeLibraries)(__VA_ARGS__)
+#define BNGetPlatformTypeLibrariesByName(...) ::BinaryNinja::ApiProfile::Instrument<1935>(::BNGetPlatformTypeLibrariesByName)(__VA_ARGS__)
+#define BNDemangleMS(...) ::BinaryNinja::ApiProfile::Instrument<1936>(::BNDemangleMS)(__VA_ARGS__)
+#define BNDemangleMSWithOptions(...) ::BinaryNinja::ApiProfile::Instrument<1937>(::BNDemangleMSWithOptions)(__VA_ARGS__)
+#define BNDemangleMSPlatform(...) ::BinaryNinja::ApiProfile::Instrument<1938>(::BNDemangleMSPlatform)(__VA_ARGS__)
+#define BNRegisterDownloadProvider(...) ::BinaryNinja::ApiProfile::Instrument<1939>(::BNRegisterDownloadProvider)(__VA_ARGS__)
+#define BNGetDownloadProviderList(...) ::BinaryNinja::ApiProfile::Instrument<1940>(::BNGetDownloadProviderList)(__VA_ARGS__)
+#define BNFreeDownloadProviderList(...) ::BinaryNinja::ApiProfile::Instrument<1941>(::BNFreeDownloadProviderList)(__VA_ARGS__)
+#define BNGetDownloadProviderByName(...) ::BinaryNinja::ApiProfile::Instrument<1942>(::BNGetDownloadProviderByName)(__VA_ARGS__)
+#define BNGetDownloadProviderName(...) ::BinaryNinja::ApiProfile::Instrument<1943>(::BNGetDownloadProviderName)(__VA_ARGS__)
+#define BNCreateDownloadProviderInstance(...) ::BinaryNinja::ApiProfile::Instrument<1944>(::BNCreateDownloadProviderInstance)(__VA_ARGS__)
+#define BNInitDownloadInstance(...) ::BinaryNinja::ApiProfile::Instrument<1945>(::BNInitDownloadInstance)(__VA_ARGS__)
+#define BNNewDownloadInstanceReference(...) ::BinaryNinja::ApiProfile::Instrument<1946>(::BNNewDownloadInstanceReference)(__VA_ARGS__)
+#define BNFreeDownloadInstance(...) ::BinaryNinja::ApiProfile::Instrument<1947>(::BNFreeDownloadInstance)(__VA_ARGS__)
+#define BNFreeDownloadInstanceResponse(...) ::BinaryNinja::ApiProfile::Instrument<1948>(::BNFreeDownloadInstanceResponse)(__VA_ARGS__)
+#define BNPerformDownloadRequest(...) ::BinaryNinja::ApiProfile::Instrument<1949>(::BNPerformDownloadRequest)(__VA_ARGS__)
+#define BNPerformCustomRequest(...) ::BinaryNinja::ApiProfile::Instrument<1950>(::BNPerformCustomRequest)(__VA_ARGS__)
+#define BNReadDataForDownloadInstance(...) ::BinaryNinja::ApiProfile::Instrument<1951>(::BNReadDataForDownloadInstance)(__VA_ARGS__)
+#define BNWriteDataForDownloadInstance(...) ::BinaryNinja::ApiProfile::Instrument<1952>(::BNWriteDataForDownloadInstance)(__VA_ARGS__)
+#define BNNotifyProgressForDownloadInstance(...) ::BinaryNinja::ApiProfile::Instrument<1953>(::BNNotifyProgressForDownloadInstance)(__VA_ARGS__)
+#define BNGetErrorForDownloadInstance(...) ::BinaryNinja::ApiProfile::Instrument<1954>(::BNGetErrorForDownloadInstance)(__VA_ARGS__)
+#define BNSetErrorForDownloadInstance(...) ::BinaryNinja::ApiProfile::Instrument<1955>(::BNSetErrorForDownloadInstance)(__VA_ARGS__)
+#define BNRegisterWebsocketProvider(...) ::BinaryNinja::ApiProfile::Instrument<1956>(::BNRegisterWebsocketProvider)(__VA_ARGS__)
+#define BNGetWebsocketProviderList(...) ::BinaryNinja::ApiProfile::Instrument<1957>(::BNGetWebsocketProviderList)(__VA_ARGS__)
+#define BNFreeWebsocketProviderList(...) ::BinaryNinja::ApiProfile::Instrument<1958>(::BNFreeWebsocketProviderList)(__VA_ARGS__)
+#define BNGetWebsocketProviderByName(...) ::BinaryNinja::ApiProfile::Instrument<1959>(::BNGetWebsocketProviderByName)(__VA_ARGS__)
+#define BNGetWebsocketProviderName(...) ::BinaryNinja::ApiProfile::Instrument<1960>(::BNGetWebsocketProviderName)(__VA_ARGS__)
+#define BNCreateWebsocketProviderClient(...) ::BinaryNinja::ApiProfile::Instrument<1961>(::BNCreateWebsocketProviderClient)(__VA_ARGS__)
+#define BNInitWebsocketClient(...) ::BinaryNinja::ApiProfile::Instrument<1962>(::BNInitWebsocketClient)(__VA_ARGS__)
+#define BNNewWebsocketClientReference(...) ::BinaryNinja::ApiProfile::Instrument<1963>(::BNNewWebsocketClientReference)(__VA_ARGS__)
+#define BNFreeWebsocketClient(...) ::BinaryNinja::ApiProfile::Instrument<1964>(::BNFreeWebsocketClient)(__VA_ARGS__)
+#define BNConnectWebsocketClient(...) ::BinaryNinja::ApiProfile::Instrument<1965>(::BNConnectWebsocketClient)(__VA_ARGS__)
+#define BNNotifyWebsocketClientConnect(...) ::BinaryNinja::ApiProfile::Instrument<1966>(::BNNotifyWebsocketClientConnect)(__VA_ARGS__)
+#define BNNotifyWebsocketClientDisconnect(...) ::BinaryNinja::ApiProfile::Instrument<1967>(::BNNotifyWebsocketClientDisconnect)(__VA_ARGS__)
+#define BNNotifyWebsocketClientError(...) ::BinaryNinja::ApiProfile::Instrument<1968>(::BNNotifyWebsocketClientError)(__VA_ARGS__)
+#define BNNotifyWebsocketClientReadData(...) ::BinaryNinja::ApiProfile::Instrument<1969>(::BNNotifyWebsocketClientReadData)(__VA_ARGS__)
+#define BNWriteWebsocketClientData(...) ::BinaryNinja::ApiProfile::Instrument<1970>(::BNWriteWebsocketClientData)(__VA_ARGS__)
+#define BNDisconnectWebsocketClient(...) ::BinaryNinja::ApiProfile::Instrument<1971>(::BNDisconnectWebsocketClient)(__VA_ARGS__)
+#define BNRegisterScriptingProvider(...) ::BinaryNinja::ApiProfile::Instrument<1972>(::BNRegisterScriptingProvider)(__VA_ARGS__)
+#define BNGetScriptingProviderList(...) ::BinaryNinja::ApiProfile::Instrument<1973>(::BNGetScriptingProviderList)(__VA_ARGS__)
+#define BNFreeScriptingProviderList(...) ::BinaryNinja::ApiProfile::Instrument<1974>(::BNFreeScriptingProviderList)(__VA_ARGS__)
+#define BNGetScriptingProviderByName(...) ::BinaryNinja::ApiProfile::Instrument<1975>(::BNGetScriptingProviderByName)(__VA_ARGS__)
+#define BNGetScriptingProviderByAPIName(...) ::BinaryNinja::ApiProfile::Instrument<1976>(::BNGetScriptingProviderByAPIName)(__VA_ARGS__)
+#define BNGetScriptingProviderName(...) ::BinaryNinja::ApiProfile::Instrument<1977>(::BNGetScriptingProviderName)(__VA_ARGS__)
+#define BNGetScriptingProviderAPIName(...) ::BinaryNinja::ApiProfile::Instrument<1978>(::BNGetScriptingProviderAPIName)(__VA_ARGS__)
+#define BNCreateScriptingProviderInstance(...) ::BinaryNinja::ApiProfile::Instrument<1979>(::BNCreateScriptingProviderInstance)(__VA_ARGS__)
+#define BNLoadScriptingProviderModule(...) ::BinaryNinja::ApiProfile::Instrument<1980>(::BNLoadScriptingProviderModule)(__VA_ARGS__)
+#define BNInstallScriptingProviderModules(...) ::BinaryNinja::ApiProfile::Instrument<1981>(::BNInstallScriptingProviderModules)(__VA_ARGS__)
+#define BNInitScriptingInstance(...) ::BinaryNinja::ApiProfile::Instrument<1982>(::BNInitScriptingInstance)(__VA_ARGS__)
+#define BNNewScriptingInstanceReference(...) ::BinaryNinja::ApiProfile::Instrument<1983>(::BNNewScriptingInstanceReference)(__VA_ARGS__)
+#define BNFreeScriptingInstance(...) ::BinaryNinja::ApiProfile::Instrument<1984>(::BNFreeScriptingInstance)(__VA_ARGS__)
+#define BNNotifyOutputForScriptingInstance(...) ::BinaryNinja::ApiProfile::Instrument<1985>(::BNNotifyOutputForScriptingInstance)(__VA_ARGS__)
+#define BNNotifyWarningForScriptingInstance(...) ::BinaryNinja::ApiProfile::Instrument<1986>(::BNNotifyWarningForScriptingInstance)(__VA_ARGS__)
+#define BNNotifyErrorForScriptingInstance(...) ::BinaryNinja::ApiProfile::Instrument<1987>(::BNNotifyErrorForScriptingInstance)(__VA_ARGS__)
+#define BNNotifyInputReadyStateForScriptingInstance(...) ::BinaryNinja::ApiProfile::Instrument<1988>(::BNNotifyInputReadyStateForScriptingInstance)(__VA_ARGS__)
+#define BNRegisterScriptingInstanceOutputListener(...) ::BinaryNinja::ApiProfile::Instrument<1989>(::BNRegisterScriptingInstanceOutputListener)(__VA_ARGS__)
+#define BNUnregisterScriptingInstanceOutputListener(...) ::BinaryNinja::ApiProfile::Instrument<1990>(::BNUnregisterScriptingInstanceOutputListener)(__VA_ARGS__)
+#define BNGetScriptingInstanceDelimiters(...) ::BinaryNinja::ApiProfile::Instrument<1991>(::BNGetScriptingInstanceDelimiters)(__VA_ARGS__)
+#define BNSetScriptingInstanceDelimiters(...) ::BinaryNinja::ApiProfile::Instrument<1992>(::BNSetScriptingInstanceDelimiters)(__VA_ARGS__)
+#define BNGetScriptingInstanceInputReadyState(...) ::BinaryNinja::ApiProfile::Instrument<1993>(::BNGetScriptingInstanceInputReadyState)(__VA_ARGS__)
+#define BNExecuteScriptInput(...) ::BinaryNinja::ApiProfile::Instrument<1994>(::BNExecuteScriptInput)(__VA_ARGS__)
+#define BNExecuteScriptInputFromFilename(...) ::BinaryNinja::ApiProfile::Instrument<1995>(::BNExecuteScriptInputFromFilename)(__VA_ARGS__)
+#define BNCancelScriptInput(...) ::BinaryNinja::ApiProfile::Instrument<1996>(::BNCancelScriptInput)(__VA_ARGS__)
+#define BNScriptingInstanceReleaseBinaryView(...) ::BinaryNinja::ApiProfile::Instrument<1997>(::BNScriptingInstanceReleaseBinaryView)(__VA_ARGS__)
+#define BNSetScriptingInstanceCurrentBinaryView(...) ::BinaryNinja::ApiProfile::Instrument<1998>(::BNSetScriptingInstanceCurrentBinaryView)(__VA_ARGS__)
+#define BNSetScriptingInstanceCurrentFunction(...) ::BinaryNinja::ApiProfile::Instrument<1999>(::BNSetScriptingInstanceCurrentFunction)(__VA_ARGS__)
+#define BNSetScriptingInstanceCurrentBasicBlock(...) ::BinaryNinja::ApiProfile::Instrument<2000>(::BNSetScriptingInstanceCurrentBasicBlock)(__VA_ARGS__)
+#define BNSetScriptingInstanceCurrentAddress(...) ::BinaryNinja::ApiProfile::Instrument<2001>(::BNSetScriptingInstanceCurrentAddress)(__VA_ARGS__)
+#define BNSetScriptingInstanceCurrentSelection(...) ::BinaryNinja::ApiProfile::Instrument<2002>(::BNSetScriptingInstanceCurrentSelection)(__VA_ARGS__)
+#define BNScriptingInstanceCompleteInput(...) ::BinaryNinja::ApiProfile::Instrument<2003>(::BNScriptingInstanceCompleteInput)(__VA_ARGS__)
+#define BNStopScriptingInstance(...) ::BinaryNinja::ApiProfile::Instrument<2004>(::BNStopScriptingInstance)(__VA_ARGS__)
+#define BNRegisterMainThread(...) ::BinaryNinja::ApiProfile::Instrument<2005>(::BNRegisterMainThread)(__VA_ARGS__)
+#define BNNewMainThreadActionReference(...) ::BinaryNinja::ApiProfile::Instrument<2006>(::BNNewMainThreadActionReference)(__VA_ARGS__)
+#define BNFreeMainThreadAction(...) ::BinaryNinja::ApiProfile::Instrument<2007>(::BNFreeMainThreadAction)(__VA_ARGS__)
+#define BNExecuteMainThreadAction(...) ::BinaryNinja::ApiProfile::Instrument<2008>(::BNExecuteMainThreadAction)(__VA_ARGS__)
+#define BNIsMainThreadActionDone(...) ::BinaryNinja::ApiProfile::Instrument<2009>(::BNIsMainThreadActionDone)(__VA_ARGS__)
+#define BNWaitForMainThreadAction(...) ::BinaryNinja::ApiProfile::Instrument<2010>(::BNWaitForMainThreadAction)(__VA_ARGS__)
+#define BNExecuteOnMainThread(...) ::BinaryNinja::ApiProfile::Instrument<2011>(::BNExecuteOnMainThread)(__VA_ARGS__)
+#define BNExecuteOnMainThreadAndWait(...) ::BinaryNinja::ApiProfile::Instrument<2012>(::BNExecuteOnMainThreadAndWait)(__VA_ARGS__)
+#define BNIsMainThread(...) ::BinaryNinja::ApiProfile::Instrument<2013>(::BNIsMainThread)(__VA_ARGS__)
+#define BNWorkerEnqueue(...) ::BinaryNinja::ApiProfile::Instrument<2014>(::BNWorkerEnqueue)(__VA_ARGS__)
+#define BNWorkerEnqueueNamed(...) ::BinaryNinja::ApiProfile::Instrument<2015>(::BNWorkerEnqueueNamed)(__VA_ARGS__)
+#define BNWorkerPriorityEnqueue(...) ::BinaryNinja::ApiProfile::Instrument<2016>(::BNWorkerPriorityEnqueue)(__VA_ARGS__)
+#define BNWorkerPriorityEnqueueNamed(...) ::BinaryNinja::ApiProfile::Instrument<2017>(::BNWorkerPriorityEnqueueNamed)(__VA_ARGS__)
+#define BNWorkerInteractiveEnqueue(...) ::BinaryNinja::ApiProfile::Instrument<2018>(::BNWorkerInteractiveEnqueue)(__VA_ARGS__)
+#define BNWorkerInteractiveEnqueueNamed(...) ::BinaryNinja::ApiProfile::Instrument<2019>(::BNWorkerInteractiveEnqueueNamed)(__VA_ARGS__)
+#define BNGetWorkerThreadCount(...) ::BinaryNinja::ApiProfile::Instrument<2020>(::BNGetWorkerThreadCount)(__VA_ARGS__)
+#define BNSetWorkerThreadCount(...) ::BinaryNinja::ApiProfile::Instrument<2021>(::BNSetWorkerThreadCount)(__VA_ARGS__)
+#define BNBeginBackgroundTask(...) ::BinaryNinja::ApiProfile::Instrument<2022>(::BNBeginBackgroundTask)(__VA_ARGS__)
+#define BNFinishBackgroundTask(...) ::BinaryNinja::ApiProfile::Instrument<2023>(::BNFinishBackgroundTask)(__VA_ARGS__)
+#define BNSetBackgroundTaskProgressText(...) ::BinaryNinja::ApiProfile::Instrument<2024>(::BNSetBackgroundTaskProgressText)(__VA_ARGS__)
+#define BNIsBackgroundTaskCancelled(...) ::BinaryNinja::ApiProfile::Instrument<2025>(::BNIsBackgroundTaskCancelled)(__VA_ARGS__)
+#define BNGetRunningBackgroundTasks(...) ::BinaryNinja::ApiProfile::Instrument<2026>(::BNGetRunningBackgroundTasks)(__VA_ARGS__)
+#define BNNewBackgroundTaskReference(...) ::BinaryNinja::ApiProfile::Instrument<2027>(::BNNewBackgroundTaskReference)(__VA_ARGS__)
+#define BNFreeBackgroundTask(...) ::BinaryNinja::ApiProfile::Instrument<2028>(::BNFreeBackgroundTask)(__VA_ARGS__)
+#define BNFreeBackgroundTaskList(...) ::BinaryNinja::ApiProfile::Instrument<2029>(::BNFreeBackgroundTaskList)(__VA_ARGS__)
+#define BNGetBackgroundTaskProgressText(...) ::BinaryNinja::ApiProfile::Instrument<2030>(::BNGetBackgroundTaskProgressText)(__VA_ARGS__)
+#define BNCanCancelBackgroundTask(...) ::BinaryNinja::ApiProfile::Instrument<2031>(::BNCanCancelBackgroundTask)(__VA_ARGS__)
+#define BNCancelBackgroundTask(...) ::BinaryNinja::ApiProfile::Instrument<2032>(::BNCancelBackgroundTask)(__VA_ARGS__)
+#define BNIsBackgroundTaskFinished(...) ::BinaryNinja::ApiProfile::Instrument<2033>(::BNIsBackgroundTaskFinished)(__VA_ARGS__)
+#define BNRegisterInteractionHandler(...) ::BinaryNinja::ApiProfile::Instrument<2034>(::BNRegisterInteractionHandler)(__VA_ARGS__)
+#define BNMarkdownToHTML(...) ::BinaryNinja::ApiProfile::Instrument<2035>(::BNMarkdownToHTML)(__VA_ARGS__)
+#define BNShowPlainTextReport(...) ::BinaryNinja::ApiProfile::Instrument<2036>(::BNShowPlainTextReport)(__VA_ARGS__)
+#define BNShowMarkdownReport(...) ::BinaryNinja::ApiProfile::Instrument<2037>(::BNShowMarkdownReport)(__VA_ARGS__)
+#define BNShowHTMLReport(...) ::BinaryNinja::ApiProfile::Instrument<2038>(::BNShowHTMLReport)(__VA_ARGS__)
+#define BNShowGraphReport(...) ::BinaryNinja::ApiProfile::Instrument<2039>(::BNShowGraphReport)(__VA_ARGS__)
+#define BNShowReportCollection(...) ::BinaryNinja::ApiProfile::Instrument<2040>(::BNShowReportCollection)(__VA_ARGS__)
+#define BNGetTextLineInput(...) ::BinaryNinja::ApiProfile::Instrument<2041>(::BNGetTextLineInput)(__VA_ARGS__)
+#define BNGetIntegerInput(...) ::BinaryNinja::ApiProfile::Instrument<2042>(::BNGetIntegerInput)(__VA_ARGS__)
+#define BNGetAddressInput(...) ::BinaryNinja::ApiProfile::Instrument<2043>(::BNGetAddressInput)(__VA_ARGS__)
+#define BNGetChoiceInput(...) ::BinaryNinja::ApiProfile::Instrument<2044>(::BNGetChoiceInput)(__VA_ARGS__)
+#define BNGetLargeChoiceInput(...) ::BinaryNinja::ApiProfile::Instrument<2045>(::BNGetLargeChoiceInput)(__VA_ARGS__)
+#define BNGetOpenFileNameInput(...) ::BinaryNinja::ApiProfile::Instrument<2046>(::BNGetOpenFileNameInput)(__VA_ARGS__)
+#define BNGetSaveFileNameInput(...) ::BinaryNinja::ApiProfile::Instrument<2047>(::BNGetSaveFileNameInput)(__VA_ARGS__)
+#define BNGetDirectoryNameInput(...) ::BinaryNinja::ApiProfile::Instrument<2048>(::BNGetDirectoryNameInput)(__VA_ARGS__)
+#define BNGetFormInput(...) ::BinaryNinja::ApiProfile::Instrument<2049>(::BNGetFormInput)(__VA_ARGS__)
+#define BNFreeFormInputResults(...) ::BinaryNinja::ApiProfile::Instrument<2050>(::BNFreeFormInputResults)(__VA_ARGS__)
+#define BNShowMessageBox(...) ::BinaryNinja::ApiProfile::Instrument<2051>(::BNShowMessageBox)(__VA_ARGS__)
+#define BNOpenUrl(...) ::BinaryNinja::ApiProfile::Instrument<2052>(::BNOpenUrl)(__VA_ARGS__)
+#define BNRunProgressDialog(...) ::BinaryNinja::ApiProfile::Instrument<2053>(::BNRunProgressDialog)(__VA_ARGS__)
+#define BNCreateReportCollection(...) ::BinaryNinja::ApiProfile::Instrument<2054>(::BNCreateReportCollection)(__VA_ARGS__)
+#define BNNewReportCollectionReference(...) ::BinaryNinja::ApiProfile::Instrument<2055>(::BNNewReportCollectionReference)(__VA_ARGS__)
+#define BNFreeReportCollection(...) ::BinaryNinja::ApiProfile::Instrument<2056>(::BNFreeReportCollection)(__VA_ARGS__)
+#define BNGetReportCollectionCount(...) ::BinaryNinja::ApiProfile::Instrument<2057>(::BNGetReportCollectionCount)(__VA_ARGS__)
+#define BNGetReportType(...) ::BinaryNinja::ApiProfile::Instrument<2058>(::BNGetReportType)(__VA_ARGS__)
+#define BNGetReportView(...) ::BinaryNinja::ApiProfile::Instrument<2059>(::BNGetReportView)(__VA_ARGS__)
+#define BNGetReportTitle(...) ::BinaryNinja::ApiProfile::Instrument<2060>(::BNGetReportTitle)(__VA_ARGS__)
+#define BNGetReportContents(...) ::BinaryNinja::ApiProfile::Instrument<2061>(::BNGetReportContents)(__VA_ARGS__)
+#define BNGetReportPlainText(...) ::BinaryNinja::ApiProfile::Instrument<2062>(::BNGetReportPlainText)(__VA_ARGS__)
+#define BNGetReportFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<2063>(::BNGetReportFlowGraph)(__VA_ARGS__)
+#define BNAddPlainTextReportToCollection(...) ::BinaryNinja::ApiProfile::Instrument<2064>(::BNAddPlainTextReportToCollection)(__VA_ARGS__)
+#define BNAddMarkdownReportToCollection(...) ::BinaryNinja::ApiProfile::Instrument<2065>(::BNAddMarkdownReportToCollection)(__VA_ARGS__)
+#define BNAddHTMLReportToCollection(...) ::BinaryNinja::ApiProfile::Instrument<2066>(::BNAddHTMLReportToCollection)(__VA_ARGS__)
+#define BNAddGraphReportToCollection(...) ::BinaryNinja::ApiProfile::Instrument<2067>(::BNAddGraphReportToCollection)(__VA_ARGS__)
+#define BNUpdateReportFlowGraph(...) ::BinaryNinja::ApiProfile::Instrument<2068>(::BNUpdateReportFlowGraph)(__VA_ARGS__)
+#define BNIsGNU3MangledString(...) ::BinaryNinja::ApiProfile::Instrument<2069>(::BNIsGNU3MangledString)(__VA_ARGS__)
+#define BNDemangleGNU3(...) ::BinaryNinja::ApiProfile::Instrument<2070>(::BNDemangleGNU3)(__VA_ARGS__)
+#define BNDemangleGNU3WithOptions(...) ::BinaryNinja::ApiProfile::Instrument<2071>(::BNDemangleGNU3WithOptions)(__VA_ARGS__)
+#define BNFreeDemangledName(...) ::BinaryNinja::ApiProfile::Instrument<2072>(::BNFreeDemangledName)(__VA_ARGS__)
+#define BNPluginGetApis(...) ::BinaryNinja::ApiProfile::Instrument<2073>(::BNPluginGetApis)(__VA_ARGS__)
+#define BNPluginGetAuthor(...) ::BinaryNinja::ApiProfile::Instrument<2074>(::BNPluginGetAuthor)(__VA_ARGS__)
+#define BNPluginGetDescription(...) ::BinaryNinja::ApiProfile::Instrument<2075>(::BNPluginGetDescription)(__VA_ARGS__)
+#define BNPluginGetLicense(...) ::BinaryNinja::ApiProfile::Instrument<2076>(::BNPluginGetLicense)(__VA_ARGS__)
+#define BNPluginGetLicenseText(...) ::BinaryNinja::ApiProfile::Instrument<2077>(::BNPluginGetLicenseText)(__VA_ARGS__)
+#define BNPluginGetLongdescription(...) ::BinaryNinja::ApiProfile::Instrument<2078>(::BNPluginGetLongdescription)(__VA_ARGS__)
+#define BNPluginGetMinimumVersion(...) ::BinaryNinja::ApiProfile::Instrument<2079>(::BNPluginGetMinimumVersion)(__VA_ARGS__)
+#define BNPluginGetName(...) ::BinaryNinja::ApiProfile::Instrument<2080>(::BNPluginGetName)(__VA_ARGS__)
+#define BNPluginGetProjectUrl(...) ::BinaryNinja::ApiProfile::Instrument<2081>(::BNPluginGetProjectUrl)(__VA_ARGS__)
+#define BNPluginGetPackageUrl(...) ::BinaryNinja::ApiProfile::Instrument<2082>(::BNPluginGetPackageUrl)(__VA_ARGS__)
+#define BNPluginGetAuthorUrl(...) ::BinaryNinja::ApiProfile::Instrument<2083>(::BNPluginGetAuthorUrl)(__VA_ARGS__)
+#define BNPluginGetVersion(...) ::BinaryNinja::ApiProfile::Instrument<2084>(::BNPluginGetVersion)(__VA_ARGS__)
+#define BNPluginGetCommit(...) ::BinaryNinja::ApiProfile::Instrument<2085>(::BNPluginGetCommit)(__VA_ARGS__)
+#define BNFreePluginTypes(...) ::BinaryNinja::ApiProfile::Instrument<2086>(::BNFreePluginTypes)(__VA_ARGS__)
+#define BNNewPluginReference(...) ::BinaryNinja::ApiProfile::Instrument<2087>(::BNNewPluginReference)(__VA_ARGS__)
+#define BNFreePlugin(...) ::BinaryNinja::ApiProfile::Instrument<2088>(::BNFreePlugin)(__VA_ARGS__)
+#define BNPluginGetPath(...) ::BinaryNinja::ApiProfile::Instrument<2089>(::BNPluginGetPath)(__VA_ARGS__)
+#define BNPluginGetSubdir(...) ::BinaryNinja::ApiProfile::Instrument<2090>(::BNPluginGetSubdir)(__VA_ARGS__)
+#define BNPluginGetDependencies(...) ::BinaryNinja::ApiProfile::Instrument<2091>(::BNPluginGetDependencies)(__VA_ARGS__)
+#define BNPluginIsInstalled(...) ::BinaryNinja::ApiProfile::Instrument<2092>(::BNPluginIsInstalled)(__VA_ARGS__)
+#define BNPluginIsEnabled(...) ::BinaryNinja::ApiProfile::Instrument<2093>(::BNPluginIsEnabled)(__VA_ARGS__)
+#define BNPluginGetPluginStatus(...) ::BinaryNinja::ApiProfile::Instrument<2094>(::BNPluginGetPluginStatus)(__VA_ARGS__)
+#define BNPluginGetPluginTypes(...) ::BinaryNinja::ApiProfile::Instrument<2095>(::BNPluginGetPluginTypes)(__VA_ARGS__)
+#define BNPluginEnable(...) ::BinaryNinja::ApiProfile::Instrument<2096>(::BNPluginEnable)(__VA_ARGS__)
+#define BNPluginDisable(...) ::BinaryNinja::ApiProfile::Instrument<2097>(::BNPluginDisable)(__VA_ARGS__)
+#define BNPluginInstall(...) ::BinaryNinja::ApiProfile::Instrument<2098>(::BNPluginInstall)(__VA_ARGS__)
+#define BNPluginInstallDependencies(...) ::BinaryNinja::ApiProfile::Instrument<2099>(::BNPluginInstallDependencies)(__VA_ARGS__)
+#define BNPluginUninstall(...) ::BinaryNinja::ApiProfile::Instrument<2100>(::BNPluginUninstall)(__VA_ARGS__)
+#define BNPluginUpdate(...) ::BinaryNinja::ApiProfile::Instrument<2101>(::BNPluginUpdate)(__VA_ARGS__)
+#define BNPluginGetInstallInstructions(...) ::BinaryNinja::ApiProfile::Instrument<2102>(::BNPluginGetInstallInstructions)(__VA_ARGS__)
+#define BNPluginGetPlatforms(...) ::BinaryNinja::ApiProfile::Instrument<2103>(::BNPluginGetPlatforms)(__VA_ARGS__)
+#define BNFreePluginPlatforms(...) ::BinaryNinja::ApiProfile::Instrument<2104>(::BNFreePluginPlatforms)(__VA_ARGS__)
+#define BNPluginGetRepository(...) ::BinaryNinja::ApiProfile::Instrument<2105>(::BNPluginGetRepository)(__VA_ARGS__)
+#define BNPluginIsBeingDeleted(...) ::BinaryNinja::ApiProfile::Instrument<2106>(::BNPluginIsBeingDeleted)(__VA_ARGS__)
+#define BNPluginIsBeingUpdated(...) ::BinaryNinja::ApiProfile::Instrument<2107>(::BNPluginIsBeingUpdated)(__VA_ARGS__)
+#define BNPluginIsRunning(...) ::BinaryNinja::ApiProfile::Instrument<2108>(::BNPluginIsRunning)(__VA_ARGS__)
+#define BNPluginIsUpdatePending(...) ::BinaryNinja::ApiProfile::Instrument<2109>(::BNPluginIsUpdatePending)(__VA_ARGS__)
+#define BNPluginIsDisablePending(...) ::BinaryNinja::ApiProfile::Instrument<2110>(::BNPluginIsDisablePending)(__VA_ARGS__)
+#define BNPluginIsDeletePending(...) ::BinaryNinja::ApiProfile::Instrument<2111>(::BNPluginIsDeletePending)(__VA_ARGS__)
+#define BNPluginIsUpdateAvailable(...) ::BinaryNinja::ApiProfile::Instrument<2112>(::BNPluginIsUpdateAvailable)(__VA_ARGS__)
+#define BNPluginAreDependenciesBeingInstalled(...) ::BinaryNinja::ApiProfile::Instrument<2113>(::BNPluginAreDependenciesBeingInstalled)(__VA_ARGS__)
+#define BNPluginGetProjectData(...) ::BinaryNinja::ApiProfile::Instrument<2114>(::BNPluginGetProjectData)(__VA_ARGS__)
+#define BNPluginGetLastUpdate(...) ::BinaryNinja::ApiProfile::Instrument<2115>(::BNPluginGetLastUpdate)(__VA_ARGS__)
+#define BNNewRepositoryReference(...) ::BinaryNinja::ApiProfile::Instrument<2116>(::BNNewRepositoryReference)(__VA_ARGS__)
+#define BNFreeRepository(...) ::BinaryNinja::ApiProfile::Instrument<2117>(::BNFreeRepository)(__VA_ARGS__)
+#define BNRepositoryGetUrl(...) ::BinaryNinja::ApiProfile::Instrument<2118>(::BNRepositoryGetUrl)(__VA_ARGS__)
+#define BNRepositoryGetRepoPath(...) ::BinaryNinja::ApiProfile::Instrument<2119>(::BNRepositoryGetRepoPath)(__VA_ARGS__)
+#define BNRepositoryGetPlugins(...) ::BinaryNinja::ApiProfile::Instrument<2120>(::BNRepositoryGetPlugins)(__VA_ARGS__)
+#define BNFreeRepositoryPluginList(...) ::BinaryNinja::ApiProfile::Instrument<2121>(::BNFreeRepositoryPluginList)(__VA_ARGS__)
+#define BNRepositoryFreePluginDirectoryList(...) ::BinaryNinja::ApiProfile::Instrument<2122>(::BNRepositoryFreePluginDirectoryList)(__VA_ARGS__)
+#define BNRepositoryGetPluginByPath(...) ::BinaryNinja::ApiProfile::Instrument<2123>(::BNRepositoryGetPluginByPath)(__VA_ARGS__)
+#define BNRepositoryGetPluginsPath(...) ::BinaryNinja::ApiProfile::Instrument<2124>(::BNRepositoryGetPluginsPath)(__VA_ARGS__)
+#define BNCreateRepositoryManager(...) ::BinaryNinja::ApiProfile::Instrument<2125>(::BNCreateRepositoryManager)(__VA_ARGS__)
+#define BNNewRepositoryManagerReference(...) ::BinaryNinja::ApiProfile::Instrument<2126>(::BNNewRepositoryManagerReference)(__VA_ARGS__)
+#define BNFreeRepositoryManager(...) ::BinaryNinja::ApiProfile::Instrument<2127>(::BNFreeRepositoryManager)(__VA_ARGS__)
+#define BNRepositoryManagerCheckForUpdates(...) ::BinaryNinja::ApiProfile::Instrument<2128>(::BNRepositoryManagerCheckForUpdates)(__VA_ARGS__)
+#define BNRepositoryManagerGetRepositories(...) ::BinaryNinja::ApiProfile::Instrument<2129>(::BNRepositoryManagerGetRepositories)(__VA_ARGS__)
+#define BNFreeRepositoryManagerRepositoriesList(...) ::BinaryNinja::ApiProfile::Instrument<2130>(::BNFreeRepositoryManagerRepositoriesList)(__VA_ARGS__)
+#define BNRepositoryManagerAddRepository(...) ::BinaryNinja::ApiProfile::Instrument<2131>(::BNRepositoryManagerAddRepository)(__VA_ARGS__)
+#define BNRepositoryGetRepositoryByPath(...) ::BinaryNinja::ApiProfile::Instrument<2132>(::BNRepositoryGetRepositoryByPath)(__VA_ARGS__)
+#define BNGetRepositoryManager(...) ::BinaryNinja::ApiProfile::Instrument<2133>(::BNGetRepositoryManager)(__VA_ARGS__)
+#define BNRepositoryManagerGetDefaultRepository(...) ::BinaryNinja::ApiProfile::Instrument<2134>(::BNRepositoryManagerGetDefaultRepository)(__VA_ARGS__)
+#define BNNewComponentReference(...) ::BinaryNinja::ApiProfile::Instrument<2135>(::BNNewComponentReference)(__VA_ARGS__)
+#define BNFreeComponent(...) ::BinaryNinja::ApiProfile::Instrument<2136>(::BNFreeComponent)(__VA_ARGS__)
+#define BNComponentGetContainedFunctions(...) ::BinaryNinja::ApiProfile::Instrument<2137>(::BNComponentGetContainedFunctions)(__VA_ARGS__)
+#define BNComponentGetContainedComponents(...) ::BinaryNinja::ApiProfile::Instrument<2138>(::BNComponentGetContainedComponents)(__VA_ARGS__)
+#define BNComponentGetContainedDataVariables(...) ::BinaryNinja::ApiProfile::Instrument<2139>(::BNComponentGetContainedDataVariables)(__VA_ARGS__)
+#define BNComponentGetReferencedDataVariables(...) ::BinaryNinja::ApiProfile::Instrument<2140>(::BNComponentGetReferencedDataVariables)(__VA_ARGS__)
+#define BNComponentGetReferencedDataVariablesRecursive(...) ::BinaryNinja::ApiProfile::Instrument<2141>(::BNComponentGetReferencedDataVariablesRecursive)(__VA_ARGS__)
+#define BNComponentGetReferencedTypes(...) ::BinaryNinja::ApiProfile::Instrument<2142>(::BNComponentGetReferencedTypes)(__VA_ARGS__)
+#define BNComponentGetReferencedTypesRecursive(...) ::BinaryNinja::ApiProfile::Instrument<2143>(::BNComponentGetReferencedTypesRecursive)(__VA_ARGS__)
+#define BNFreeComponents(...) ::BinaryNinja::ApiProfile::Instrument<2144>(::BNFreeComponents)(__VA_ARGS__)
+#define BNComponentFreeReferencedTypes(...) ::BinaryNinja::ApiProfile::Instrument<2145>(::BNComponentFreeReferencedTypes)(__VA_ARGS__)
+#define BNComponentGetParent(...) ::BinaryNinja::ApiProfile::Instrument<2146>(::BNComponentGetParent)(__VA_ARGS__)
+#define BNComponentContainsFunction(...) ::BinaryNinja::ApiProfile::Instrument<2147>(::BNComponentContainsFunction)(__VA_ARGS__)
+#define BNComponentContainsComponent(...) ::BinaryNinja::ApiProfile::Instrument<2148>(::BNComponentContainsComponent)(__VA_ARGS__)
+#define BNComponentContainsDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<2149>(::BNComponentContainsDataVariable)(__VA_ARGS__)
+#define BNComponentAddFunctionReference(...) ::BinaryNinja::ApiProfile::Instrument<2150>(::BNComponentAddFunctionReference)(__VA_ARGS__)
+#define BNComponentAddComponent(...) ::BinaryNinja::ApiProfile::Instrument<2151>(::BNComponentAddComponent)(__VA_ARGS__)
+#define BNComponentAddDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<2152>(::BNComponentAddDataVariable)(__VA_ARGS__)
+#define BNComponentRemoveComponent(...) ::BinaryNinja::ApiProfile::Instrument<2153>(::BNComponentRemoveComponent)(__VA_ARGS__)
+#define BNComponentRemoveFunctionReference(...) ::BinaryNinja::ApiProfile::Instrument<2154>(::BNComponentRemoveFunctionReference)(__VA_ARGS__)
+#define BNComponentRemoveAllFunctions(...) ::BinaryNinja::ApiProfile::Instrument<2155>(::BNComponentRemoveAllFunctions)(__VA_ARGS__)
+#define BNComponentRemoveDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<2156>(::BNComponentRemoveDataVariable)(__VA_ARGS__)
+#define BNComponentAddAllMembersFromComponent(...) ::BinaryNinja::ApiProfile::Instrument<2157>(::BNComponentAddAllMembersFromComponent)(__VA_ARGS__)
+#define BNComponentGetGuid(...) ::BinaryNinja::ApiProfile::Instrument<2158>(::BNComponentGetGuid)(__VA_ARGS__)
+#define BNComponentsEqual(...) ::BinaryNinja::ApiProfile::Instrument<2159>(::BNComponentsEqual)(__VA_ARGS__)
+#define BNComponentsNotEqual(...) ::BinaryNinja::ApiProfile::Instrument<2160>(::BNComponentsNotEqual)(__VA_ARGS__)
+#define BNComponentGetDisplayName(...) ::BinaryNinja::ApiProfile::Instrument<2161>(::BNComponentGetDisplayName)(__VA_ARGS__)
+#define BNComponentGetOriginalName(...) ::BinaryNinja::ApiProfile::Instrument<2162>(::BNComponentGetOriginalName)(__VA_ARGS__)
+#define BNComponentSetName(...) ::BinaryNinja::ApiProfile::Instrument<2163>(::BNComponentSetName)(__VA_ARGS__)
+#define BNComponentGetView(...) ::BinaryNinja::ApiProfile::Instrument<2164>(::BNComponentGetView)(__VA_ARGS__)
+#define BNLlvmServicesInit(...) ::BinaryNinja::ApiProfile::Instrument<2165>(::BNLlvmServicesInit)(__VA_ARGS__)
+#define BNLlvmServicesAssemble(...) ::BinaryNinja::ApiProfile::Instrument<2166>(::BNLlvmServicesAssemble)(__VA_ARGS__)
+#define BNLlvmServicesAssembleFree(...) ::BinaryNinja::ApiProfile::Instrument<2167>(::BNLlvmServicesAssembleFree)(__VA_ARGS__)
+#define BNDeleteFile(...) ::BinaryNinja::ApiProfile::Instrument<2168>(::BNDeleteFile)(__VA_ARGS__)
+#define BNDeleteDirectory(...) ::BinaryNinja::ApiProfile::Instrument<2169>(::BNDeleteDirectory)(__VA_ARGS__)
+#define BNCreateDirectory(...) ::BinaryNinja::ApiProfile::Instrument<2170>(::BNCreateDirectory)(__VA_ARGS__)
+#define BNPathExists(...) ::BinaryNinja::ApiProfile::Instrument<2171>(::BNPathExists)(__VA_ARGS__)
+#define BNGetParentPath(...) ::BinaryNinja::ApiProfile::Instrument<2172>(::BNGetParentPath)(__VA_ARGS__)
+#define BNIsPathDirectory(...) ::BinaryNinja::ApiProfile::Instrument<2173>(::BNIsPathDirectory)(__VA_ARGS__)
+#define BNIsPathRegularFile(...) ::BinaryNinja::ApiProfile::Instrument<2174>(::BNIsPathRegularFile)(__VA_ARGS__)
+#define BNFileSize(...) ::BinaryNinja::ApiProfile::Instrument<2175>(::BNFileSize)(__VA_ARGS__)
+#define BNRenameFile(...) ::BinaryNinja::ApiProfile::Instrument<2176>(::BNRenameFile)(__VA_ARGS__)
+#define BNCopyFile(...) ::BinaryNinja::ApiProfile::Instrument<2177>(::BNCopyFile)(__VA_ARGS__)
+#define BNGetFileName(...) ::BinaryNinja::ApiProfile::Instrument<2178>(::BNGetFileName)(__VA_ARGS__)
+#define BNGetFileExtension(...) ::BinaryNinja::ApiProfile::Instrument<2179>(::BNGetFileExtension)(__VA_ARGS__)
+#define BNGetFilePathsInDirectory(...) ::BinaryNinja::ApiProfile::Instrument<2180>(::BNGetFilePathsInDirectory)(__VA_ARGS__)
+#define BNAppendPath(...) ::BinaryNinja::ApiProfile::Instrument<2181>(::BNAppendPath)(__VA_ARGS__)
+#define BNFreePath(...) ::BinaryNinja::ApiProfile::Instrument<2182>(::BNFreePath)(__VA_ARGS__)
+#define BNCreateSettings(...) ::BinaryNinja::ApiProfile::Instrument<2183>(::BNCreateSettings)(__VA_ARGS__)
+#define BNNewSettingsReference(...) ::BinaryNinja::ApiProfile::Instrument<2184>(::BNNewSettingsReference)(__VA_ARGS__)
+#define BNFreeSettings(...) ::BinaryNinja::ApiProfile::Instrument<2185>(::BNFreeSettings)(__VA_ARGS__)
+#define BNLoadSettingsFile(...) ::BinaryNinja::ApiProfile::Instrument<2186>(::BNLoadSettingsFile)(__VA_ARGS__)
+#define BNSettingsSetResourceId(...) ::BinaryNinja::ApiProfile::Instrument<2187>(::BNSettingsSetResourceId)(__VA_ARGS__)
+#define BNSettingsRegisterGroup(...) ::BinaryNinja::ApiProfile::Instrument<2188>(::BNSettingsRegisterGroup)(__VA_ARGS__)
+#define BNSettingsRegisterSetting(...) ::BinaryNinja::ApiProfile::Instrument<2189>(::BNSettingsRegisterSetting)(__VA_ARGS__)
+#define BNSettingsContains(...) ::BinaryNinja::ApiProfile::Instrument<2190>(::BNSettingsContains)(__VA_ARGS__)
+#define BNSettingsIsEmpty(...) ::BinaryNinja::ApiProfile::Instrument<2191>(::BNSettingsIsEmpty)(__VA_ARGS__)
+#define BNSettingsKeysList(...) ::BinaryNinja::ApiProfile::Instrument<2192>(::BNSettingsKeysList)(__VA_ARGS__)
+#define BNSettingsQueryPropertyStringList(...) ::BinaryNinja::ApiProfile::Instrument<2193>(::BNSettingsQueryPropertyStringList)(__VA_ARGS__)
+#define BNSettingsUpdateProperty(...) ::BinaryNinja::ApiProfile::Instrument<2194>(::BNSettingsUpdateProperty)(__VA_ARGS__)
+#define BNSettingsUpdateBoolProperty(...) ::BinaryNinja::ApiProfile::Instrument<2195>(::BNSettingsUpdateBoolProperty)(__VA_ARGS__)
+#define BNSettingsUpdateDoubleProperty(...) ::BinaryNinja::ApiProfile::Instrument<2196>(::BNSettingsUpdateDoubleProperty)(__VA_ARGS__)
+#define BNSettingsUpdateInt64Property(...) ::BinaryNinja::ApiProfile::Instrument<2197>(::BNSettingsUpdateInt64Property)(__VA_ARGS__)
+#define BNSettingsUpdateUInt64Property(...) ::BinaryNinja::ApiProfile::Instrument<2198>(::BNSettingsUpdateUInt64Property)(__VA_ARGS__)
+#define BNSettingsUpdateStringProperty(...) ::BinaryNinja::ApiProfile::Instrument<2199>(::BNSettingsUpdateStringProperty)(__VA_ARGS__)
+#define BNSettingsUpdateStringListProperty(...) ::BinaryNinja::ApiProfile::Instrument<2200>(::BNSettingsUpdateStringListProperty)(__VA_ARGS__)
+#define BNSettingsDeserializeSchema(...) ::BinaryNinja::ApiProfile::Instrument<2201>(::BNSettingsDeserializeSchema)(__VA_ARGS__)
+#define BNSettingsSerializeSchema(...) ::BinaryNinja::ApiProfile::Instrument<2202>(::BNSettingsSerializeSchema)(__VA_ARGS__)
+#define BNDeserializeSettings(...) ::BinaryNinja::ApiProfile::Instrument<2203>(::BNDeserializeSettings)(__VA_ARGS__)
+#define BNSerializeSettings(...) ::BinaryNinja::ApiProfile::Instrument<2204>(::BNSerializeSettings)(__VA_ARGS__)
+#define BNSettingsReset(...) ::BinaryNinja::ApiProfile::Instrument<2205>(::BNSettingsReset)(__VA_ARGS__)
+#define BNSettingsResetAll(...) ::BinaryNinja::ApiProfile::Instrument<2206>(::BNSettingsResetAll)(__VA_ARGS__)
+#define BNSettingsGetBool(...) ::BinaryNinja::ApiProfile::Instrument<2207>(::BNSettingsGetBool)(__VA_ARGS__)
+#define BNSettingsGetDouble(...) ::BinaryNinja::ApiProfile::Instrument<2208>(::BNSettingsGetDouble)(__VA_ARGS__)
+#define BNSettingsGetInt64(...) ::BinaryNinja::ApiProfile::Instrument<2209>(::BNSettingsGetInt64)(__VA_ARGS__)
+#define BNSettingsGetUInt64(...) ::BinaryNinja::ApiProfile::Instrument<2210>(::BNSettingsGetUInt64)(__VA_ARGS__)
+#define BNSettingsGetString(...) ::BinaryNinja::ApiProfile::Instrument<2211>(::BNSettingsGetString)(__VA_ARGS__)
+#define BNSettingsGetStringList(...) ::BinaryNinja::ApiProfile::Instrument<2212>(::BNSettingsGetStringList)(__VA_ARGS__)
+#define BNSettingsGetJson(...) ::BinaryNinja::ApiProfile::Instrument<2213>(::BNSettingsGetJson)(__VA_ARGS__)
+#define BNSettingsSetBool(...) ::BinaryNinja::ApiProfile::Instrument<2214>(::BNSettingsSetBool)(__VA_ARGS__)
+#define BNSettingsSetDouble(...) ::BinaryNinja::ApiProfile::Instrument<2215>(::BNSettingsSetDouble)(__VA_ARGS__)
+#define BNSettingsSetInt64(...) ::BinaryNinja::ApiProfile::Instrument<2216>(::BNSettingsSetInt64)(__VA_ARGS__)
+#define BNSettingsSetUInt64(...) ::BinaryNinja::ApiProfile::Instrument<2217>(::BNSettingsSetUInt64)(__VA_ARGS__)
+#define BNSettingsSetString(...) ::BinaryNinja::ApiProfile::Instrument<2218>(::BNSettingsSetString)(__VA_ARGS__)
+#define BNSettingsSetStringList(...) ::BinaryNinja::ApiProfile::Instrument<2219>(::BNSettingsSetStringList)(__VA_ARGS__)
+#define BNSettingsSetJson(...) ::BinaryNinja::ApiProfile::Instrument<2220>(::BNSettingsSetJson)(__VA_ARGS__)
+#define BNNewMetadataReference(...) ::BinaryNinja::ApiProfile::Instrument<2221>(::BNNewMetadataReference)(__VA_ARGS__)
+#define BNCreateMetadataBooleanData(...) ::BinaryNinja::ApiProfile::Instrument<2222>(::BNCreateMetadataBooleanData)(__VA_ARGS__)
+#define BNCreateMetadataStringData(...) ::BinaryNinja::ApiProfile::Instrument<2223>(::BNCreateMetadataStringData)(__VA_ARGS__)
+#define BNCreateMetadataUnsignedIntegerData(...) ::BinaryNinja::ApiProfile::Instrument<2224>(::BNCreateMetadataUnsignedIntegerData)(__VA_ARGS__)
+#define BNCreateMetadataSignedIntegerData(...) ::BinaryNinja::ApiProfile::Instrument<2225>(::BNCreateMetadataSignedIntegerData)(__VA_ARGS__)
+#define BNCreateMetadataDoubleData(...) ::BinaryNinja::ApiProfile::Instrument<2226>(::BNCreateMetadataDoubleData)(__VA_ARGS__)
+#define BNCreateMetadataOfType(...) ::BinaryNinja::ApiProfile::Instrument<2227>(::BNCreateMetadataOfType)(__VA_ARGS__)
+#define BNCreateMetadataRawData(...) ::BinaryNinja::ApiProfile::Instrument<2228>(::BNCreateMetadataRawData)(__VA_ARGS__)
+#define BNCreateMetadataArray(...) ::BinaryNinja::ApiProfile::Instrument<2229>(::BNCreateMetadataArray)(__VA_ARGS__)
+#define BNCreateMetadataValueStore(...) ::BinaryNinja::ApiProfile::Instrument<2230>(::BNCreateMetadataValueStore)(__VA_ARGS__)
+#define BNCreateMetadataBooleanListData(...) ::BinaryNinja::ApiProfile::Instrument<2231>(::BNCreateMetadataBooleanListData)(__VA_ARGS__)
+#define BNCreateMetadataUnsignedIntegerListData(...) ::BinaryNinja::ApiProfile::Instrument<2232>(::BNCreateMetadataUnsignedIntegerListData)(__VA_ARGS__)
+#define BNCreateMetadataSignedIntegerListData(...) ::BinaryNinja::ApiProfile::Instrument<2233>(::BNCreateMetadataSignedIntegerListData)(__VA_ARGS__)
+#define BNCreateMetadataDoubleListData(...) ::BinaryNinja::ApiProfile::Instrument<2234>(::BNCreateMetadataDoubleListData)(__VA_ARGS__)
+#define BNCreateMetadataStringListData(...) ::BinaryNinja::ApiProfile::Instrument<2235>(::BNCreateMetadataStringListData)(__VA_ARGS__)
+#define BNMetadataIsEqual(...) ::BinaryNinja::ApiProfile::Instrument<2236>(::BNMetadataIsEqual)(__VA_ARGS__)
+#define BNMetadataSetValueForKey(...) ::BinaryNinja::ApiProfile::Instrument<2237>(::BNMetadataSetValueForKey)(__VA_ARGS__)
+#define BNMetadataGetForKey(...) ::BinaryNinja::ApiProfile::Instrument<2238>(::BNMetadataGetForKey)(__VA_ARGS__)
+#define BNMetadataArrayAppend(...) ::BinaryNinja::ApiProfile::Instrument<2239>(::BNMetadataArrayAppend)(__VA_ARGS__)
+#define BNMetadataRemoveKey(...) ::BinaryNinja::ApiProfile::Instrument<2240>(::BNMetadataRemoveKey)(__VA_ARGS__)
+#define BNMetadataSize(...) ::BinaryNinja::ApiProfile::Instrument<2241>(::BNMetadataSize)(__VA_ARGS__)
+#define BNMetadataGetForIndex(...) ::BinaryNinja::ApiProfile::Instrument<2242>(::BNMetadataGetForIndex)(__VA_ARGS__)
+#define BNMetadataRemoveIndex(...) ::BinaryNinja::ApiProfile::Instrument<2243>(::BNMetadataRemoveIndex)(__VA_ARGS__)
+#define BNFreeMetadataArray(...) ::BinaryNinja::ApiProfile::Instrument<2244>(::BNFreeMetadataArray)(__VA_ARGS__)
+#define BNFreeMetadataValueStore(...) ::BinaryNinja::ApiProfile::Instrument<2245>(::BNFreeMetadataValueStore)(__VA_ARGS__)
+#define BNFreeMetadata(...) ::BinaryNinja::ApiProfile::Instrument<2246>(::BNFreeMetadata)(__VA_ARGS__)
+#define BNFreeMetadataRaw(...) ::BinaryNinja::ApiProfile::Instrument<2247>(::BNFreeMetadataRaw)(__VA_ARGS__)
+#define BNFreeMetadataBooleanList(...) ::BinaryNinja::ApiProfile::Instrument<2248>(::BNFreeMetadataBooleanList)(__VA_ARGS__)
+#define BNFreeMetadataUnsignedIntegerList(...) ::BinaryNinja::ApiProfile::Instrument<2249>(::BNFreeMetadataUnsignedIntegerList)(__VA_ARGS__)
+#define BNFreeMetadataSignedIntegerList(...) ::BinaryNinja::ApiProfile::Instrument<2250>(::BNFreeMetadataSignedIntegerList)(__VA_ARGS__)
+#define BNFreeMetadataDoubleList(...) ::BinaryNinja::ApiProfile::Instrument<2251>(::BNFreeMetadataDoubleList)(__VA_ARGS__)
+#define BNFreeMetadataStringList(...) ::BinaryNinja::ApiProfile::Instrument<2252>(::BNFreeMetadataStringList)(__VA_ARGS__)
+#define BNMetadataGetBoolean(...) ::BinaryNinja::ApiProfile::Instrument<2253>(::BNMetadataGetBoolean)(__VA_ARGS__)
+#define BNMetadataGetString(...) ::BinaryNinja::ApiProfile::Instrument<2254>(::BNMetadataGetString)(__VA_ARGS__)
+#define BNMetadataGetUnsignedInteger(...) ::BinaryNinja::ApiProfile::Instrument<2255>(::BNMetadataGetUnsignedInteger)(__VA_ARGS__)
+#define BNMetadataGetSignedInteger(...) ::BinaryNinja::ApiProfile::Instrument<2256>(::BNMetadataGetSignedInteger)(__VA_ARGS__)
+#define BNMetadataGetDouble(...) ::BinaryNinja::ApiProfile::Instrument<2257>(::BNMetadataGetDouble)(__VA_ARGS__)
+#define BNMetadataGetBooleanList(...) ::BinaryNinja::ApiProfile::Instrument<2258>(::BNMetadataGetBooleanList)(__VA_ARGS__)
+#define BNMetadataGetStringList(...) ::BinaryNinja::ApiProfile::Instrument<2259>(::BNMetadataGetStringList)(__VA_ARGS__)
+#define BNMetadataGetUnsignedIntegerList(...) ::BinaryNinja::ApiProfile::Instrument<2260>(::BNMetadataGetUnsignedIntegerList)(__VA_ARGS__)
+#define BNMetadataGetSignedIntegerList(...) ::BinaryNinja::ApiProfile::Instrument<2261>(::BNMetadataGetSignedIntegerList)(__VA_ARGS__)
+#define BNMetadataGetDoubleList(...) ::BinaryNinja::ApiProfile::Instrument<2262>(::BNMetadataGetDoubleList)(__VA_ARGS__)
+#define BNMetadataGetRaw(...) ::BinaryNinja::ApiProfile::Instrument<2263>(::BNMetadataGetRaw)(__VA_ARGS__)
+#define BNMetadataGetArray(...) ::BinaryNinja::ApiProfile::Instrument<2264>(::BNMetadataGetArray)(__VA_ARGS__)
+#define BNMetadataGetValueStore(...) ::BinaryNinja::ApiProfile::Instrument<2265>(::BNMetadataGetValueStore)(__VA_ARGS__)
+#define BNMetadataGetType(...) ::BinaryNinja::ApiProfile::Instrument<2266>(::BNMetadataGetType)(__VA_ARGS__)
+#define BNMetadataIsBoolean(...) ::BinaryNinja::ApiProfile::Instrument<2267>(::BNMetadataIsBoolean)(__VA_ARGS__)
+#define BNMetadataIsString(...) ::BinaryNinja::ApiProfile::Instrument<2268>(::BNMetadataIsString)(__VA_ARGS__)
+#define BNMetadataIsUnsignedInteger(...) ::BinaryNinja::ApiProfile::Instrument<2269>(::BNMetadataIsUnsignedInteger)(__VA_ARGS__)
+#define BNMetadataIsSignedInteger(...) ::BinaryNinja::ApiProfile::Instrument<2270>(::BNMetadataIsSignedInteger)(__VA_ARGS__)
+#define BNMetadataIsDouble(...) ::BinaryNinja::ApiProfile::Instrument<2271>(::BNMetadataIsDouble)(__VA_ARGS__)
+#define BNMetadataIsBooleanList(...) ::BinaryNinja::ApiProfile::Instrument<2272>(::BNMetadataIsBooleanList)(__VA_ARGS__)
+#define BNMetadataIsStringList(...) ::BinaryNinja::ApiProfile::Instrument<2273>(::BNMetadataIsStringList)(__VA_ARGS__)
+#define BNMetadataIsUnsignedIntegerList(...) ::BinaryNinja::ApiProfile::Instrument<2274>(::BNMetadataIsUnsignedIntegerList)(__VA_ARGS__)
+#define BNMetadataIsSignedIntegerList(...) ::BinaryNinja::ApiProfile::Instrument<2275>(::BNMetadataIsSignedIntegerList)(__VA_ARGS__)
+#define BNMetadataIsDoubleList(...) ::BinaryNinja::ApiProfile::Instrument<2276>(::BNMetadataIsDoubleList)(__VA_ARGS__)
+#define BNMetadataIsRaw(...) ::BinaryNinja::ApiProfile::Instrument<2277>(::BNMetadataIsRaw)(__VA_ARGS__)
+#define BNMetadataIsArray(...) ::BinaryNinja::ApiProfile::Instrument<2278>(::BNMetadataIsArray)(__VA_ARGS__)
+#define BNMetadataIsKeyValueStore(...) ::BinaryNinja::ApiProfile::Instrument<2279>(::BNMetadataIsKeyValueStore)(__VA_ARGS__)
+#define BNBinaryViewStoreMetadata(...) ::BinaryNinja::ApiProfile::Instrument<2280>(::BNBinaryViewStoreMetadata)(__VA_ARGS__)
+#define BNBinaryViewQueryMetadata(...) ::BinaryNinja::ApiProfile::Instrument<2281>(::BNBinaryViewQueryMetadata)(__VA_ARGS__)
+#define BNBinaryViewRemoveMetadata(...) ::BinaryNinja::ApiProfile::Instrument<2282>(::BNBinaryViewRemoveMetadata)(__VA_ARGS__)
+#define BNBinaryViewGetLoadSettingsTypeNames(...) ::BinaryNinja::ApiProfile::Instrument<2283>(::BNBinaryViewGetLoadSettingsTypeNames)(__VA_ARGS__)
+#define BNBinaryViewGetLoadSettings(...) ::BinaryNinja::ApiProfile::Instrument<2284>(::BNBinaryViewGetLoadSettings)(__VA_ARGS__)
+#define BNBinaryViewSetLoadSettings(...) ::BinaryNinja::ApiProfile::Instrument<2285>(::BNBinaryViewSetLoadSettings)(__VA_ARGS__)
+#define BNNewRelocationReference(...) ::BinaryNinja::ApiProfile::Instrument<2286>(::BNNewRelocationReference)(__VA_ARGS__)
+#define BNFreeRelocation(...) ::BinaryNinja::ApiProfile::Instrument<2287>(::BNFreeRelocation)(__VA_ARGS__)
+#define BNRelocationGetInfo(...) ::BinaryNinja::ApiProfile::Instrument<2288>(::BNRelocationGetInfo)(__VA_ARGS__)
+#define BNRelocationGetArchitecture(...) ::BinaryNinja::ApiProfile::Instrument<2289>(::BNRelocationGetArchitecture)(__VA_ARGS__)
+#define BNRelocationGetTarget(...) ::BinaryNinja::ApiProfile::Instrument<2290>(::BNRelocationGetTarget)(__VA_ARGS__)
+#define BNRelocationGetReloc(...) ::BinaryNinja::ApiProfile::Instrument<2291>(::BNRelocationGetReloc)(__VA_ARGS__)
+#define BNRelocationGetSymbol(...) ::BinaryNinja::ApiProfile::Instrument<2292>(::BNRelocationGetSymbol)(__VA_ARGS__)
+#define BNCreateSegment(...) ::BinaryNinja::ApiProfile::Instrument<2293>(::BNCreateSegment)(__VA_ARGS__)
+#define BNNewSegmentReference(...) ::BinaryNinja::ApiProfile::Instrument<2294>(::BNNewSegmentReference)(__VA_ARGS__)
+#define BNFreeSegment(...) ::BinaryNinja::ApiProfile::Instrument<2295>(::BNFreeSegment)(__VA_ARGS__)
+#define BNSegmentGetRelocationRanges(...) ::BinaryNinja::ApiProfile::Instrument<2296>(::BNSegmentGetRelocationRanges)(__VA_ARGS__)
+#define BNSegmentGetRelocationsCount(...) ::BinaryNinja::ApiProfile::Instrument<2297>(::BNSegmentGetRelocationsCount)(__VA_ARGS__)
+#define BNSegmentGetRelocationRangesAtAddress(...) ::BinaryNinja::ApiProfile::Instrument<2298>(::BNSegmentGetRelocationRangesAtAddress)(__VA_ARGS__)
+#define BNSegmentRangeContainsRelocation(...) ::BinaryNinja::ApiProfile::Instrument<2299>(::BNSegmentRangeContainsRelocation)(__VA_ARGS__)
+#define BNFreeRelocationRanges(...) ::BinaryNinja::ApiProfile::Instrument<2300>(::BNFreeRelocationRanges)(__VA_ARGS__)
+#define BNSegmentGetStart(...) ::BinaryNinja::ApiProfile::Instrument<2301>(::BNSegmentGetStart)(__VA_ARGS__)
+#define BNSegmentGetLength(...) ::BinaryNinja::ApiProfile::Instrument<2302>(::BNSegmentGetLength)(__VA_ARGS__)
+#define BNSegmentGetEnd(...) ::BinaryNinja::ApiProfile::Instrument<2303>(::BNSegmentGetEnd)(__VA_ARGS__)
+#define BNSegmentGetDataEnd(...) ::BinaryNinja::ApiProfile::Instrument<2304>(::BNSegmentGetDataEnd)(__VA_ARGS__)
+#define BNSegmentGetDataOffset(...) ::BinaryNinja::ApiProfile::Instrument<2305>(::BNSegmentGetDataOffset)(__VA_ARGS__)
+#define BNSegmentGetDataLength(...) ::BinaryNinja::ApiProfile::Instrument<2306>(::BNSegmentGetDataLength)(__VA_ARGS__)
+#define BNSegmentGetFlags(...) ::BinaryNinja::ApiProfile::Instrument<2307>(::BNSegmentGetFlags)(__VA_ARGS__)
+#define BNSegmentIsAutoDefined(...) ::BinaryNinja::ApiProfile::Instrument<2308>(::BNSegmentIsAutoDefined)(__VA_ARGS__)
+#define BNSegmentSetLength(...) ::BinaryNinja::ApiProfile::Instrument<2309>(::BNSegmentSetLength)(__VA_ARGS__)
+#define BNSegmentSetDataOffset(...) ::BinaryNinja::ApiProfile::Instrument<2310>(::BNSegmentSetDataOffset)(__VA_ARGS__)
+#define BNSegmentSetDataLength(...) ::BinaryNinja::ApiProfile::Instrument<2311>(::BNSegmentSetDataLength)(__VA_ARGS__)
+#define BNSegmentSetFlags(...) ::BinaryNinja::ApiProfile::Instrument<2312>(::BNSegmentSetFlags)(__VA_ARGS__)
+#define BNNewSectionReference(...) ::BinaryNinja::ApiProfile::Instrument<2313>(::BNNewSectionReference)(__VA_ARGS__)
+#define BNFreeSection(...) ::BinaryNinja::ApiProfile::Instrument<2314>(::BNFreeSection)(__VA_ARGS__)
+#define BNSectionGetName(...) ::BinaryNinja::ApiProfile::Instrument<2315>(::BNSectionGetName)(__VA_ARGS__)
+#define BNSectionGetType(...) ::BinaryNinja::ApiProfile::Instrument<2316>(::BNSectionGetType)(__VA_ARGS__)
+#define BNSectionGetStart(...) ::BinaryNinja::ApiProfile::Instrument<2317>(::BNSectionGetStart)(__VA_ARGS__)
+#define BNSectionGetLength(...) ::BinaryNinja::ApiProfile::Instrument<2318>(::BNSectionGetLength)(__VA_ARGS__)
+#define BNSectionGetEnd(...) ::BinaryNinja::ApiProfile::Instrument<2319>(::BNSectionGetEnd)(__VA_ARGS__)
+#define BNSectionGetLinkedSection(...) ::BinaryNinja::ApiProfile::Instrument<2320>(::BNSectionGetLinkedSection)(__VA_ARGS__)
+#define BNSectionGetInfoSection(...) ::BinaryNinja::ApiProfile::Instrument<2321>(::BNSectionGetInfoSection)(__VA_ARGS__)
+#define BNSectionGetInfoData(...) ::BinaryNinja::ApiProfile::Instrument<2322>(::BNSectionGetInfoData)(__VA_ARGS__)
+#define BNSectionGetAlign(...) ::BinaryNinja::ApiProfile::Instrument<2323>(::BNSectionGetAlign)(__VA_ARGS__)
+#define BNSectionGetEntrySize(...) ::BinaryNinja::ApiProfile::Instrument<2324>(::BNSectionGetEntrySize)(__VA_ARGS__)
+#define BNSectionGetSemantics(...) ::BinaryNinja::ApiProfile::Instrument<2325>(::BNSectionGetSemantics)(__VA_ARGS__)
+#define BNSectionIsAutoDefined(...) ::BinaryNinja::ApiProfile::Instrument<2326>(::BNSectionIsAutoDefined)(__VA_ARGS__)
+#define BNCreateDataRenderer(...) ::BinaryNinja::ApiProfile::Instrument<2327>(::BNCreateDataRenderer)(__VA_ARGS__)
+#define BNNewDataRendererReference(...) ::BinaryNinja::ApiProfile::Instrument<2328>(::BNNewDataRendererReference)(__VA_ARGS__)
+#define BNIsValidForData(...) ::BinaryNinja::ApiProfile::Instrument<2329>(::BNIsValidForData)(__VA_ARGS__)
+#define BNGetLinesForData(...) ::BinaryNinja::ApiProfile::Instrument<2330>(::BNGetLinesForData)(__VA_ARGS__)
+#define BNRenderLinesForData(...) ::BinaryNinja::ApiProfile::Instrument<2331>(::BNRenderLinesForData)(__VA_ARGS__)
+#define BNFreeDataRenderer(...) ::BinaryNinja::ApiProfile::Instrument<2332>(::BNFreeDataRenderer)(__VA_ARGS__)
+#define BNGetDataRendererContainer(...) ::BinaryNinja::ApiProfile::Instrument<2333>(::BNGetDataRendererContainer)(__VA_ARGS__)
+#define BNRegisterGenericDataRenderer(...) ::BinaryNinja::ApiProfile::Instrument<2334>(::BNRegisterGenericDataRenderer)(__VA_ARGS__)
+#define BNRegisterTypeSpecificDataRenderer(...) ::BinaryNinja::ApiProfile::Instrument<2335>(::BNRegisterTypeSpecificDataRenderer)(__VA_ARGS__)
+#define BNParseExpression(...) ::BinaryNinja::ApiProfile::Instrument<2336>(::BNParseExpression)(__VA_ARGS__)
+#define BNFreeParseError(...) ::BinaryNinja::ApiProfile::Instrument<2337>(::BNFreeParseError)(__VA_ARGS__)
+#define BNGetCurrentStackTraceString(...) ::BinaryNinja::ApiProfile::Instrument<2338>(::BNGetCurrentStackTraceString)(__VA_ARGS__)
+#define BNRegisterObjectRefDebugTrace(...) ::BinaryNinja::ApiProfile::Instrument<2339>(::BNRegisterObjectRefDebugTrace)(__VA_ARGS__)
+#define BNUnregisterObjectRefDebugTrace(...) ::BinaryNinja::ApiProfile::Instrument<2340>(::BNUnregisterObjectRefDebugTrace)(__VA_ARGS__)
+#define BNGetMemoryUsageInfo(...) ::BinaryNinja::ApiProfile::Instrument<2341>(::BNGetMemoryUsageInfo)(__VA_ARGS__)
+#define BNFreeMemoryUsageInfo(...) ::BinaryNinja::ApiProfile::Instrument<2342>(::BNFreeMemoryUsageInfo)(__VA_ARGS__)
+#define BNGetAddressRenderedWidth(...) ::BinaryNinja::ApiProfile::Instrument<2343>(::BNGetAddressRenderedWidth)(__VA_ARGS__)
+#define BNRustSimplifyStrToFQN(...) ::BinaryNinja::ApiProfile::Instrument<2344>(::BNRustSimplifyStrToFQN)(__VA_ARGS__)
+#define BNRustSimplifyStrToStr(...) ::BinaryNinja::ApiProfile::Instrument<2345>(::BNRustSimplifyStrToStr)(__VA_ARGS__)
+#define BNRegisterDebugInfoParser(...) ::BinaryNinja::ApiProfile::Instrument<2346>(::BNRegisterDebugInfoParser)(__VA_ARGS__)
+#define BNUnregisterDebugInfoParser(...) ::BinaryNinja::ApiProfile::Instrument<2347>(::BNUnregisterDebugInfoParser)(__VA_ARGS__)
+#define BNGetDebugInfoParserByName(...) ::BinaryNinja::ApiProfile::Instrument<2348>(::BNGetDebugInfoParserByName)(__VA_ARGS__)
+#define BNGetDebugInfoParsers(...) ::BinaryNinja::ApiProfile::Instrument<2349>(::BNGetDebugInfoParsers)(__VA_ARGS__)
+#define BNGetDebugInfoParsersForView(...) ::BinaryNinja::ApiProfile::Instrument<2350>(::BNGetDebugInfoParsersForView)(__VA_ARGS__)
+#define BNGetDebugInfoParserName(...) ::BinaryNinja::ApiProfile::Instrument<2351>(::BNGetDebugInfoParserName)(__VA_ARGS__)
+#define BNIsDebugInfoParserValidForView(...) ::BinaryNinja::ApiProfile::Instrument<2352>(::BNIsDebugInfoParserValidForView)(__VA_ARGS__)
+#define BNParseDebugInfo(...) ::BinaryNinja::ApiProfile::Instrument<2353>(::BNParseDebugInfo)(__VA_ARGS__)
+#define BNNewDebugInfoParserReference(...) ::BinaryNinja::ApiProfile::Instrument<2354>(::BNNewDebugInfoParserReference)(__VA_ARGS__)
+#define BNFreeDebugInfoParserReference(...) ::BinaryNinja::ApiProfile::Instrument<2355>(::BNFreeDebugInfoParserReference)(__VA_ARGS__)
+#define BNFreeDebugInfoParserList(...) ::BinaryNinja::ApiProfile::Instrument<2356>(::BNFreeDebugInfoParserList)(__VA_ARGS__)
+#define BNNewDebugInfoReference(...) ::BinaryNinja::ApiProfile::Instrument<2357>(::BNNewDebugInfoReference)(__VA_ARGS__)
+#define BNFreeDebugInfoReference(...) ::BinaryNinja::ApiProfile::Instrument<2358>(::BNFreeDebugInfoReference)(__VA_ARGS__)
+#define BNGetDebugParserNames(...) ::BinaryNinja::ApiProfile::Instrument<2359>(::BNGetDebugParserNames)(__VA_ARGS__)
+#define BNGetDebugInfoTypeContainer(...) ::BinaryNinja::ApiProfile::Instrument<2360>(::BNGetDebugInfoTypeContainer)(__VA_ARGS__)
+#define BNRemoveDebugParserInfo(...) ::BinaryNinja::ApiProfile::Instrument<2361>(::BNRemoveDebugParserInfo)(__VA_ARGS__)
+#define BNRemoveDebugParserTypes(...) ::BinaryNinja::ApiProfile::Instrument<2362>(::BNRemoveDebugParserTypes)(__VA_ARGS__)
+#define BNRemoveDebugParserFunctions(...) ::BinaryNinja::ApiProfile::Instrument<2363>(::BNRemoveDebugParserFunctions)(__VA_ARGS__)
+#define BNRemoveDebugParserDataVariables(...) ::BinaryNinja::ApiProfile::Instrument<2364>(::BNRemoveDebugParserDataVariables)(__VA_ARGS__)
+#define BNAddDebugType(...) ::BinaryNinja::ApiProfile::Instrument<2365>(::BNAddDebugType)(__VA_ARGS__)
+#define BNGetDebugTypes(...) ::BinaryNinja::ApiProfile::Instrument<2366>(::BNGetDebugTypes)(__VA_ARGS__)
+#define BNGetDebugTypeByName(...) ::BinaryNinja::ApiProfile::Instrument<2367>(::BNGetDebugTypeByName)(__VA_ARGS__)
+#define BNGetDebugTypesByName(...) ::BinaryNinja::ApiProfile::Instrument<2368>(::BNGetDebugTypesByName)(__VA_ARGS__)
+#define BNRemoveDebugTypeByName(...) ::BinaryNinja::ApiProfile::Instrument<2369>(::BNRemoveDebugTypeByName)(__VA_ARGS__)
+#define BNFreeDebugTypes(...) ::BinaryNinja::ApiProfile::Instrument<2370>(::BNFreeDebugTypes)(__VA_ARGS__)
+#define BNAddDebugFunction(...) ::BinaryNinja::ApiProfile::Instrument<2371>(::BNAddDebugFunction)(__VA_ARGS__)
+#define BNGetDebugFunctions(...) ::BinaryNinja::ApiProfile::Instrument<2372>(::BNGetDebugFunctions)(__VA_ARGS__)
+#define BNRemoveDebugFunctionByIndex(...) ::BinaryNinja::ApiProfile::Instrument<2373>(::BNRemoveDebugFunctionByIndex)(__VA_ARGS__)
+#define BNFreeDebugFunctions(...) ::BinaryNinja::ApiProfile::Instrument<2374>(::BNFreeDebugFunctions)(__VA_ARGS__)
+#define BNAddDebugDataVariable(...) ::BinaryNinja::ApiProfile::Instrument<2375>(::BNAddDebugDataVariable)(__VA_ARGS__)
+#define BNAddDebugDataVariableInfo(...) ::BinaryNinja::ApiProfile::Instrument<2376>(::BNAddDebugDataVariableInfo)(__VA_ARGS__)
+#define BNGetDebugDataVariables(...) ::BinaryNinja::ApiProfile::Instrument<2377>(::BNGetDebugDataVariables)(__VA_ARGS__)
+#define BNGetDebugDataVariableByName(...) ::BinaryNinja::ApiProfile::Instrument<2378>(::BNGetDebugDataVariableByName)(__VA_ARGS__)
+#define BNGetDebugDataVariableByAddress(...) ::BinaryNinja::ApiProfile::Instrument<2379>(::BNGetDebugDataVariableByAddress)(__VA_ARGS__)
+#define BNGetDebugDataVariablesByName(...) ::BinaryNinja::ApiProfile::Instrument<2380>(::BNGetDebugDataVariablesByName)(__VA_ARGS__)
+#define BNGetDebugDataVariablesByAddress(...) ::BinaryNinja::ApiProfile::Instrument<2381>(::BNGetDebugDataVariablesByAddress)(__VA_ARGS__)
+#define BNRemoveDebugDataVariableByAddress(...) ::BinaryNinja::ApiProfile::Instrument<2382>(::BNRemoveDebugDataVariableByAddress)(__VA_ARGS__)
+#define BNRegisterSecretsProvider(...) ::BinaryNinja::ApiProfile::Instrument<2383>(::BNRegisterSecretsProvider)(__VA_ARGS__)
+#define BNGetSecretsProviderList(...) ::BinaryNinja::ApiProfile::Instrument<2384>(::BNGetSecretsProviderList)(__VA_ARGS__)
+#define BNFreeSecretsProviderList(...) ::BinaryNinja::ApiProfile::Instrument<2385>(::BNFreeSecretsProviderList)(__VA_ARGS__)
+#define BNGetSecretsProviderByName(...) ::BinaryNinja::ApiProfile::Instrument<2386>(::BNGetSecretsProviderByName)(__VA_ARGS__)
+#define BNGetSecretsProviderName(...) ::BinaryNinja::ApiProfile::Instrument<2387>(::BNGetSecretsProviderName)(__VA_ARGS__)
+#define BNSecretsProviderHasData(...) ::BinaryNinja::ApiProfile::Instrument<2388>(::BNSecretsProviderHasData)(__VA_ARGS__)
+#define BNGetSecretsProviderData(...) ::BinaryNinja::ApiProfile::Instrument<2389>(::BNGetSecretsProviderData)(__VA_ARGS__)
+#define BNStoreSecretsProviderData(...) ::BinaryNinja::ApiProfile::Instrument<2390>(::BNStoreSecretsProviderData)(__VA_ARGS__)
+#define BNDeleteSecretsProviderData(...) ::BinaryNinja::ApiProfile::Instrument<2391>(::BNDeleteSecretsProviderData)(__VA_ARGS__)
+#define BNCreateSymbolQueue(...) ::BinaryNinja::ApiProfile::Instrument<2392>(::BNCreateSymbolQueue)(__VA_ARGS__)
+#define BNDestroySymbolQueue(...) ::BinaryNinja::ApiProfile::Instrument<2393>(::BNDestroySymbolQueue)(__VA_ARGS__)
+#define BNAppendSymbolQueue(...) ::BinaryNinja::ApiProfile::Instrument<2394>(::BNAppendSymbolQueue)(__VA_ARGS__)
+#define BNProcessSymbolQueue(...) ::BinaryNinja::ApiProfile::Instrument<2395>(::BNProcessSymbolQueue)(__VA_ARGS__)
+#define BNCoreEnumToString(...) ::BinaryNinja::ApiProfile::Instrument<2396>(::BNCoreEnumToString)(__VA_ARGS__)
+#define BNCoreEnumFromString(...) ::BinaryNinja::ApiProfile::Instrument<2397>(::BNCoreEnumFromString)(__VA_ARGS__)
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "binaryninjaapi.h"
+
+namespace Benchmarks
+{
+	// Work done by one iteration of a benchmark, used to report per item and per byte rates
+	struct BenchmarkCounters
+	{
+		uint64_t items = 0;
+		uint64_t bytes = 0;
+		// Largest growth in resident memory seen in a single iteration, for benchmarks that measure footprint
+		uint64_t residentBytes = 0;
+	};
+
+	// Resident set size of the current process in bytes, or zero if it cannot be determined
+	uint64_t GetResidentMemory();
+
+	struct BenchmarkContext
+	{
+		BinaryNinja::Ref<BinaryNinja::BinaryView> view;
+		// A bounded sample of functions so that whole-program passes stay reasonably quick on large binaries
+		std::vector<BinaryNinja::Ref<BinaryNinja::Function>> functions;
+	};
+
+	typedef std::function<void(BenchmarkContext& context, BenchmarkCounters& counters)> BenchmarkFunction;
+
+	struct Benchmark
+	{
+		std::string name;
+		BenchmarkFunction func;
+	};
+
+	std::vector<Benchmark>& GetBenchmarks();
+
+	struct BenchmarkRegistration
+	{
+		BenchmarkRegistration(const std::string& name, const BenchmarkFunction& func)
+		{
+			GetBenchmarks().push_back({name, func});
+		}
+	};
+
+	// A self check, such as comparing an optimized implementation against a reference one. Returns false and
+	// describes the first mismatch in error on failure.
+	typedef std::function<bool(std::string& error)> VerificationFunction;
+
+	struct Verification
+	{
+		std::string name;
+		VerificationFunction func;
+	};
+
+	std::vector<Verification>& GetVerifications();
+
+	struct VerificationRegistration
+	{
+		VerificationRegistration(const std::string& name, const VerificationFunction& func)
+		{
+			GetVerifications().push_back({name, func});
+		}
+	};
+
+	// Prevents the compiler from discarding a value computed only for timing purposes
+	template <class T>
+	void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+#endif
+	}
+}  // namespace Benchmarks
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+#define BENCHMARK(name, ...) \
+	static ::Benchmarks::BenchmarkRegistration BENCHMARK_CONCAT(g_benchmark, __LINE__)(name, __VA_ARGS__)
+#define VERIFY(name, ...) \
+	static ::Benchmarks::VerificationRegistration BENCHMARK_CONCAT(g_verification, __LINE__)(name, __VA_ARGS__)
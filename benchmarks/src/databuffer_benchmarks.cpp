@@ -0,0 +1,307 @@
+/*
+ * Benchmarks for DataBuffer construction, moves, reads into caller
+ * provided storage and the vectorized compare, search, hash and
+ * encoding kernels, along with self checks for those kernels.
+ */
+
+#include <algorithm>
+#include <random>
+
+#include "benchmark.h"
+#include "databufferkernels.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+BENCHMARK("DataBuffer/CreateSmall", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	uint8_t data[16] = {};
+	for (size_t i = 0; i < 100000; i++)
+	{
+		DataBuffer buffer(data, sizeof(data));
+		DoNotOptimize(buffer.GetData());
+		counters.items++;
+	}
+});
+
+
+BENCHMARK("DataBuffer/Move", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	DataBuffer buffer(0x1000);
+	for (size_t i = 0; i < 100000; i++)
+	{
+		DataBuffer moved(std::move(buffer));
+		buffer = std::move(moved);
+		counters.items++;
+	}
+	DoNotOptimize(buffer.GetData());
+});
+
+
+// Many small reads, as done by file format parsers, allocating a new buffer each time
+BENCHMARK("BinaryView/ReadBufferSmall", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	uint64_t start = context.view->GetStart();
+	uint64_t len = min<uint64_t>(context.view->GetLength(), 0x100000);
+	for (uint64_t offset = 0; (offset + 16) <= len; offset += 16)
+	{
+		DataBuffer buffer = context.view->ReadBuffer(start + offset, 16);
+		counters.items++;
+		counters.bytes += buffer.GetLength();
+	}
+});
+
+
+// The same reads into a reused buffer
+BENCHMARK("BinaryView/ReadBufferSmallReused", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	uint64_t start = context.view->GetStart();
+	uint64_t len = min<uint64_t>(context.view->GetLength(), 0x100000);
+	DataBuffer buffer;
+	for (uint64_t offset = 0; (offset + 16) <= len; offset += 16)
+	{
+		counters.bytes += context.view->ReadBuffer(buffer, start + offset, 16);
+		counters.items++;
+	}
+});
+
+
+BENCHMARK("BinaryReader/ReadSpan", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	BinaryReader reader(context.view);
+	reader.Seek(context.view->GetStart());
+	uint64_t len = min<uint64_t>(context.view->GetLength(), 0x100000);
+	uint8_t header[16];
+	for (uint64_t offset = 0; (offset + sizeof(header)) <= len; offset += sizeof(header))
+	{
+		if (!reader.TryRead(Span<uint8_t>(header)))
+			break;
+		counters.items++;
+		counters.bytes += sizeof(header);
+	}
+	DoNotOptimize(header[0]);
+});
+
+
+BENCHMARK("BinaryReader/ReadString", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	BinaryReader reader(context.view);
+	reader.Seek(context.view->GetStart());
+	uint64_t len = min<uint64_t>(context.view->GetLength(), 0x100000);
+	string str;
+	for (uint64_t offset = 0; (offset + 16) <= len; offset += 16)
+	{
+		if (!reader.TryReadString(str, 16))
+			break;
+		counters.items++;
+		counters.bytes += str.size();
+	}
+});
+
+
+// Kernel benchmarks run once per implementation the CPU supports, on a buffer read from the start of the view
+
+static DataBuffer GetKernelInput(BenchmarkContext& context)
+{
+	DataBuffer result = context.view->ReadBuffer(context.view->GetStart(), 0x100000);
+	if (result.GetLength() < 0x100000)
+		result.SetSize(0x100000);
+	return result;
+}
+
+
+template <class Func>
+static void RegisterKernelBenchmark(const string& name, Func func)
+{
+	for (auto impl : DataBufferKernels::GetSupportedImplementations())
+	{
+		GetBenchmarks().push_back({name + "/" + DataBufferKernels::GetImplementationName(impl),
+			[=](BenchmarkContext& context, BenchmarkCounters& counters) {
+				DataBufferKernels::Implementation previous = DataBufferKernels::GetImplementation();
+				DataBufferKernels::SetImplementation(impl);
+				func(context, counters);
+				DataBufferKernels::SetImplementation(previous);
+			}});
+	}
+}
+
+
+static bool RegisterKernelBenchmarks()
+{
+	RegisterKernelBenchmark("DataBuffer/Equal", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		DataBuffer a = GetKernelInput(context);
+		DataBuffer b = a;
+		DoNotOptimize(a == b);
+		counters.items++;
+		counters.bytes += a.GetLength();
+	});
+	RegisterKernelBenchmark("DataBuffer/Find", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		DataBuffer data = GetKernelInput(context);
+		// A needle that should not occur, so the whole buffer is scanned
+		const char needle[] = "\x7f\x45\x4c\x46\xfe\xed\xfa\xce\x00\x01";
+		size_t offset;
+		DoNotOptimize(data.Find(needle, sizeof(needle) - 1, offset));
+		counters.items++;
+		counters.bytes += data.GetLength();
+	});
+	RegisterKernelBenchmark("DataBuffer/Crc32c", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		DataBuffer data = GetKernelInput(context);
+		DoNotOptimize(data.GetCrc32c());
+		counters.items++;
+		counters.bytes += data.GetLength();
+	});
+	RegisterKernelBenchmark("DataBuffer/Hash64", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		DataBuffer data = GetKernelInput(context);
+		DoNotOptimize(data.GetHash64());
+		counters.items++;
+		counters.bytes += data.GetLength();
+	});
+	RegisterKernelBenchmark("DataBuffer/ToBase64", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		DataBuffer data = GetKernelInput(context);
+		DoNotOptimize(data.ToBase64().size());
+		counters.items++;
+		counters.bytes += data.GetLength();
+	});
+	RegisterKernelBenchmark("DataBuffer/FromBase64", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		string encoded = GetKernelInput(context).ToBase64();
+		DoNotOptimize(DataBuffer::FromBase64(encoded).GetLength());
+		counters.items++;
+		counters.bytes += encoded.size();
+	});
+	RegisterKernelBenchmark("DataBuffer/ToHex", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		DataBuffer data = GetKernelInput(context);
+		DoNotOptimize(data.ToHex().size());
+		counters.items++;
+		counters.bytes += data.GetLength();
+	});
+	RegisterKernelBenchmark("DataBuffer/FromHex", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+		string encoded = GetKernelInput(context).ToHex();
+		DataBuffer decoded;
+		DoNotOptimize(DataBuffer::FromHex(encoded, decoded));
+		counters.items++;
+		counters.bytes += encoded.size();
+	});
+	return true;
+}
+
+
+static bool g_kernelBenchmarksRegistered = RegisterKernelBenchmarks();
+
+
+// Fuzzes every vector implementation against the scalar one, and the base64 encoder and decoder against the core.
+// Inputs are random bytes with lengths around the vector block sizes, drawn from small alphabets half of the time so
+// that searches find partial matches.
+VERIFY("DataBuffer/Kernels", [](string& error) {
+	mt19937_64 rng(0x42);
+	auto randomBytes = [&](size_t len, bool smallAlphabet) {
+		string result(len, '\0');
+		for (auto& c : result)
+			c = (char)(smallAlphabet ? (rng() % 3) : (rng() & 0xff));
+		return result;
+	};
+
+	auto implementations = DataBufferKernels::GetSupportedImplementations();
+	DataBufferKernels::Implementation previous = DataBufferKernels::GetImplementation();
+	for (size_t iteration = 0; iteration < 100000; iteration++)
+	{
+		bool smallAlphabet = (iteration & 1) != 0;
+		size_t len = rng() % ((iteration % 100) == 0 ? 4096 : 160);
+		string a = randomBytes(len, smallAlphabet);
+		string b = a;
+		if (len && (rng() & 1))
+			b[rng() % len] ^= (char)(1 + (rng() % 255));
+		string needle = randomBytes(rng() % 12, smallAlphabet);
+		if ((len > needle.size()) && (rng() & 1))
+			needle = a.substr(rng() % (len - needle.size()), needle.size());
+
+		DataBufferKernels::SetImplementation(DataBufferKernels::ScalarImplementation);
+		DataBuffer bufferA(a.data(), a.size()), bufferB(b.data(), b.size());
+		bool equal = (bufferA == bufferB);
+		size_t found = (size_t)-1;
+		bufferA.Find(needle.data(), needle.size(), found);
+		uint32_t crc = bufferA.GetCrc32c();
+		string base64 = bufferA.ToBase64();
+		string hex = bufferA.ToHex();
+
+		// Corrupt the encodings some of the time to exercise rejection of invalid input
+		string base64Input = base64;
+		string hexInput = hex;
+		if (!base64Input.empty() && ((rng() % 4) == 0))
+			base64Input[rng() % base64Input.size()] = (char)(rng() & 0xff);
+		if (!hexInput.empty() && ((rng() % 4) == 0))
+			hexInput[rng() % hexInput.size()] = (char)(rng() & 0xff);
+		if (rng() & 1)
+			transform(hexInput.begin(), hexInput.end(), hexInput.begin(), ::toupper);
+		DataBuffer base64Decoded = DataBuffer::FromBase64(base64Input);
+		DataBuffer hexDecoded;
+		bool hexValid = DataBuffer::FromHex(hexInput, hexDecoded);
+
+		char* coreBase64 = BNDataBufferToBase64(bufferA.GetBufferObject());
+		bool coreMatches = (base64 == coreBase64);
+		BNFreeString(coreBase64);
+		if (!coreMatches)
+		{
+			error = "ToBase64 differs from the core for length " + to_string(len);
+			return false;
+		}
+		DataBuffer coreDecoded(BNDecodeBase64(base64Input.c_str()));
+		if (base64Decoded != coreDecoded)
+		{
+			error = "FromBase64 differs from the core for input " + base64Input;
+			return false;
+		}
+		if (base64Input == base64 && base64Decoded != bufferA)
+		{
+			error = "FromBase64 does not round trip for length " + to_string(len);
+			return false;
+		}
+
+		for (auto impl : implementations)
+		{
+			if (impl == DataBufferKernels::ScalarImplementation)
+				continue;
+			DataBufferKernels::SetImplementation(impl);
+			string name = DataBufferKernels::GetImplementationName(impl);
+			size_t implFound = (size_t)-1;
+			bufferA.Find(needle.data(), needle.size(), implFound);
+			DataBuffer implHexDecoded;
+			bool implHexValid = DataBuffer::FromHex(hexInput, implHexDecoded);
+
+			const char* mismatch = nullptr;
+			if ((bufferA == bufferB) != equal)
+				mismatch = "Equal";
+			else if (implFound != found)
+				mismatch = "Find";
+			else if (bufferA.GetCrc32c() != crc)
+				mismatch = "Crc32c";
+			else if (bufferA.ToBase64() != base64)
+				mismatch = "ToBase64";
+			else if (DataBuffer::FromBase64(base64Input) != base64Decoded)
+				mismatch = "FromBase64";
+			else if (bufferA.ToHex() != hex)
+				mismatch = "ToHex";
+			else if ((implHexValid != hexValid) || (hexValid && (implHexDecoded != hexDecoded)))
+				mismatch = "FromHex";
+			if (mismatch)
+			{
+				error = string(mismatch) + " (" + name + ") differs from scalar for length " + to_string(len);
+				DataBufferKernels::SetImplementation(previous);
+				return false;
+			}
+		}
+	}
+	DataBufferKernels::SetImplementation(previous);
+	return true;
+});
+
+
+VERIFY("DataBuffer/KnownHashes", [](string& error) {
+	DataBuffer check("123456789", 9);
+	if (check.GetCrc32c() != 0xe3069283)
+	{
+		error = "CRC-32C check value mismatch";
+		return false;
+	}
+	if (DataBuffer().GetHash64() != 0xef46db3751d8e999ULL)
+	{
+		error = "XXH64 of the empty input mismatch";
+		return false;
+	}
+	return true;
+});
@@ -0,0 +1,96 @@
+/*
+ * Benchmarks comparing the JSON and CBOR encodings used for
+ * KeyValueStore values and Database globals.
+ */
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+// Shaped like a typical analysis cache: many small records with integer and string fields
+static Json::Value GetCacheValue()
+{
+	Json::Value result(Json::arrayValue);
+	for (uint64_t i = 0; i < 20000; i++)
+	{
+		Json::Value record(Json::objectValue);
+		record["address"] = (Json::UInt64)(0x400000 + (i * 0x10));
+		record["name"] = fmt::format("sub_{:x}", 0x400000 + (i * 0x10));
+		record["size"] = (Json::UInt64)(i % 512);
+		record["score"] = (double)i / 7.0;
+		result.append(record);
+	}
+	return result;
+}
+
+
+BENCHMARK("Encoding/JsonRoundTrip", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Json::Value value = GetCacheValue();
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "";
+	string json = Json::writeString(builder, value);
+	unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+	Json::Value result;
+	string errors;
+	reader->parse(json.data(), json.data() + json.size(), &result, &errors);
+	counters.items += result.size();
+	counters.bytes += json.size();
+});
+
+
+BENCHMARK("Encoding/CborRoundTrip", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Json::Value value = GetCacheValue();
+	DataBuffer cbor = EncodeCbor(value);
+	Json::Value result;
+	string errors;
+	DecodeCbor((const uint8_t*)cbor.GetData(), cbor.GetLength(), result, errors);
+	counters.items += result.size();
+	counters.bytes += cbor.GetLength();
+});
+
+
+BENCHMARK("Encoding/CborStreamingScan", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	DataBuffer cbor = EncodeCbor(GetCacheValue());
+	CborReader reader(cbor);
+	CborItem item;
+	uint64_t total = 0;
+	while (reader.Next(item))
+	{
+		if (item.type == CborUnsignedItem)
+			total += item.unsignedValue;
+		counters.items++;
+	}
+	DoNotOptimize(total);
+	counters.bytes += cbor.GetLength();
+});
+
+
+VERIFY("Encoding/CborRoundTrip", [](string& error) {
+	Json::Value value = GetCacheValue();
+	value.append(Json::Value());
+	value.append(true);
+	value.append((Json::Int64)-5);
+	value.append(string("embedded\0nul", 12));
+	DataBuffer cbor = EncodeCbor(value);
+	Json::Value result;
+	if (!DecodeCbor((const uint8_t*)cbor.GetData(), cbor.GetLength(), result, error))
+		return false;
+	if (!(result == value))
+	{
+		error = "decoded value differs";
+		return false;
+	}
+
+	Ref<KeyValueStore> store = new KeyValueStore();
+	store->SetValue("json", value);
+	store->SetValue("cbor", value, CborValueEncoding);
+	if (!(store->GetValue("json") == value) || !(store->GetValue("cbor") == value))
+	{
+		error = "KeyValueStore value differs after round trip";
+		return false;
+	}
+	return true;
+});
@@ -0,0 +1,72 @@
+/*
+ * Benchmarks for the cost of log calls, both when their level is
+ * disabled and when messages are queued for asynchronous delivery,
+ * and for writing structured records to a binary log file.
+ */
+
+#include <cstdio>
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+BENCHMARK("Logger/DisabledDebug", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Ref<Logger> logger = LogRegistry::CreateLogger("Benchmarks.Disabled");
+	logger->SetMinimumLevel(WarningLog);
+	for (size_t i = 0; i < 100000; i++)
+	{
+		logger->LogDebugF("visited block {:#x} with {} instructions", i * 0x10, i);
+		counters.items++;
+	}
+});
+
+
+BENCHMARK("Logger/CompiledOutTrace", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Ref<Logger> logger = LogRegistry::CreateLogger("Benchmarks.Trace");
+	for (size_t i = 0; i < 100000; i++)
+	{
+		BN_LOG_TRACE(logger, "visited block {:#x} with {} instructions", i * 0x10, i);
+		counters.items++;
+	}
+});
+
+
+// Messages are logged at DebugLog into a logger whose level lets them through, so they reach the core's listeners
+BENCHMARK("Logger/AsyncDebug", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Ref<Logger> logger = LogRegistry::CreateLogger("Benchmarks.Async");
+	logger->SetMinimumLevel(DebugLog);
+	EnableAsyncLogging();
+	for (size_t i = 0; i < 10000; i++)
+	{
+		logger->LogDebugF("visited block {:#x} with {} instructions", i * 0x10, i);
+		counters.items++;
+	}
+	DisableAsyncLogging();
+});
+
+
+BENCHMARK("LogSink/BinaryLogWriter", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	string path = "api_benchmarks.bnlog";
+	{
+		BinaryLogWriter writer(path, 1ULL << 32, 1);
+		uint32_t loggerId = LogSink::GetLoggerId("Benchmarks.Sink");
+		vector<string> messages(1024);
+		vector<LogRecord> batch(messages.size());
+		for (size_t i = 0; i < 100; i++)
+		{
+			for (size_t j = 0; j < batch.size(); j++)
+			{
+				size_t n = i * batch.size() + j;
+				messages[j] = fmt::format("visited block {:#x} with {} instructions", n * 0x10, n % 97);
+				batch[j] = {n, 0, DebugLog, loggerId, 1, messages[j]};
+				counters.bytes += messages[j].size();
+			}
+			writer.LogBatch(batch);
+			counters.items += batch.size();
+		}
+		writer.Flush();
+	}
+	remove(path.c_str());
+});
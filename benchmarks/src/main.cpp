@@ -0,0 +1,243 @@
+/*
+ * Benchmarks for the C++ API wrapper, run against a sample binary.
+ * Results are written as JSON so they can be compared between API
+ * revisions.
+ *
+ * USAGE: api_benchmarks <file_name> [--filter <substring>]
+ *            [--min-time <seconds>] [--max-functions <count>]
+ *            [--output <file.json>]
+ *        api_benchmarks --verify [--filter <substring>]
+ *
+ * --verify runs the self checks instead, which fuzz optimized code paths
+ * against their reference implementations.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+
+#ifdef WIN32
+	#include <windows.h>
+	#include <psapi.h>
+#elif defined(__APPLE__)
+	#include <mach/mach.h>
+#else
+	#include <unistd.h>
+#endif
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+vector<Benchmark>& Benchmarks::GetBenchmarks()
+{
+	static vector<Benchmark> benchmarks;
+	return benchmarks;
+}
+
+
+vector<Verification>& Benchmarks::GetVerifications()
+{
+	static vector<Verification> verifications;
+	return verifications;
+}
+
+
+uint64_t Benchmarks::GetResidentMemory()
+{
+#ifdef WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return 0;
+	return counters.WorkingSetSize;
+#elif defined(__APPLE__)
+	mach_task_basic_info_data_t info;
+	mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+	if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS)
+		return 0;
+	return info.resident_size;
+#else
+	FILE* fp = fopen("/proc/self/statm", "r");
+	if (!fp)
+		return 0;
+	unsigned long long size = 0, resident = 0;
+	int fields = fscanf(fp, "%llu %llu", &size, &resident);
+	fclose(fp);
+	if (fields != 2)
+		return 0;
+	return resident * (uint64_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+
+static int RunVerifications(const string& filter)
+{
+	size_t failures = 0;
+	for (auto& verification : GetVerifications())
+	{
+		if (!filter.empty() && (verification.name.find(filter) == string::npos))
+			continue;
+		string error;
+		if (verification.func(error))
+		{
+			cerr << "PASS " << verification.name << endl;
+		}
+		else
+		{
+			cerr << "FAIL " << verification.name << ": " << error << endl;
+			failures++;
+		}
+	}
+
+	// Shutting down is required to allow for clean exit of the core
+	BNShutdown();
+
+	return failures ? 1 : 0;
+}
+
+
+static Json::Value RunBenchmark(const Benchmark& benchmark, BenchmarkContext& context, double minTime)
+{
+	// One untimed run to warm caches and force any lazy analysis the benchmark depends on
+	BenchmarkCounters warmup;
+	benchmark.func(context, warmup);
+
+	BenchmarkCounters total;
+	uint64_t iterations = 0;
+	auto start = chrono::steady_clock::now();
+	double elapsed = 0;
+	do
+	{
+		BenchmarkCounters counters;
+		benchmark.func(context, counters);
+		total.items += counters.items;
+		total.bytes += counters.bytes;
+		if (counters.residentBytes > total.residentBytes)
+			total.residentBytes = counters.residentBytes;
+		iterations++;
+		elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	} while (elapsed < minTime);
+
+	Json::Value result(Json::objectValue);
+	result["name"] = benchmark.name;
+	result["iterations"] = (Json::UInt64)iterations;
+	result["seconds"] = elapsed;
+	result["ns_per_iteration"] = (elapsed * 1e9) / (double)iterations;
+	result["items"] = (Json::UInt64)total.items;
+	result["bytes"] = (Json::UInt64)total.bytes;
+	if (total.items != 0)
+	{
+		result["ns_per_item"] = (elapsed * 1e9) / (double)total.items;
+		result["items_per_second"] = (double)total.items / elapsed;
+	}
+	if (total.bytes != 0)
+		result["bytes_per_second"] = (double)total.bytes / elapsed;
+	if (total.residentBytes != 0)
+		result["resident_bytes"] = (Json::UInt64)total.residentBytes;
+	return result;
+}
+
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		cerr << "USAGE: " << argv[0]
+		     << " <file_name> [--filter <substring>] [--min-time <seconds>] [--max-functions <count>]"
+		        " [--output <file.json>]"
+		     << endl;
+		cerr << "       " << argv[0] << " --verify [--filter <substring>]" << endl;
+		return -1;
+	}
+
+	if (strcmp(argv[1], "--verify") == 0)
+	{
+		string filter;
+		if ((argc > 3) && (strcmp(argv[2], "--filter") == 0))
+			filter = argv[3];
+		return RunVerifications(filter);
+	}
+
+	string filter, outputPath;
+	double minTime = 1.0;
+	size_t maxFunctions = 500;
+	for (int i = 2; i < argc; i++)
+	{
+		if ((strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc))
+			filter = argv[++i];
+		else if ((strcmp(argv[i], "--min-time") == 0) && ((i + 1) < argc))
+			minTime = atof(argv[++i]);
+		else if ((strcmp(argv[i], "--max-functions") == 0) && ((i + 1) < argc))
+			maxFunctions = strtoul(argv[++i], nullptr, 0);
+		else if ((strcmp(argv[i], "--output") == 0) && ((i + 1) < argc))
+			outputPath = argv[++i];
+		else
+		{
+			cerr << "Unknown argument " << argv[i] << endl;
+			return -1;
+		}
+	}
+
+	/* In order to initiate the bundled plugins properly, the location
+	 * of where bundled plugins directory is must be set. */
+	SetBundledPluginDirectory(GetBundledPluginDirectory());
+	InitPlugins();
+
+	BenchmarkContext context;
+	context.view = Load(argv[1]);
+	if (!context.view)
+	{
+		fprintf(stderr, "Could not open input file.\n");
+		return -1;
+	}
+	context.functions = context.view->GetAnalysisFunctionList();
+	if (context.functions.size() > maxFunctions)
+		context.functions.resize(maxFunctions);
+
+	Json::Value results(Json::arrayValue);
+	for (auto& benchmark : GetBenchmarks())
+	{
+		if (!filter.empty() && (benchmark.name.find(filter) == string::npos))
+			continue;
+		cerr << benchmark.name << "..." << endl;
+		results.append(RunBenchmark(benchmark, context, minTime));
+	}
+
+	Json::Value report(Json::objectValue);
+	report["version"] = GetVersionString();
+	report["build_id"] = (Json::UInt)GetBuildId();
+	report["binary"] = argv[1];
+	report["timestamp"] = (Json::Int64)time(nullptr);
+	report["function_count"] = (Json::UInt64)context.functions.size();
+	report["min_time"] = minTime;
+	report["benchmarks"] = results;
+
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "  ";
+	string json = Json::writeString(builder, report);
+	if (outputPath.empty())
+	{
+		cout << json << endl;
+	}
+	else
+	{
+		ofstream out(outputPath);
+		out << json << endl;
+	}
+
+	context.functions.clear();
+	context.view->GetFile()->Close();
+	context.view = nullptr;
+
+	// Shutting down is required to allow for clean exit of the core
+	BNShutdown();
+
+	return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * Benchmarks for round-tripping large numeric vectors through
+ * Metadata, as element lists and as typed arrays.
+ */
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+static vector<double> GetFeatureVector()
+{
+	vector<double> result(16384);
+	for (size_t i = 0; i < result.size(); i++)
+		result[i] = (double)i * 0.5;
+	return result;
+}
+
+
+BENCHMARK("Metadata/DoubleListRoundTrip", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	vector<double> features = GetFeatureVector();
+	for (size_t i = 0; i < 100; i++)
+	{
+		Ref<Metadata> metadata = new Metadata(features);
+		vector<double> result = metadata->GetDoubleList();
+		DoNotOptimize(result);
+		counters.items += result.size();
+		counters.bytes += result.size() * sizeof(double);
+	}
+});
+
+
+BENCHMARK("Metadata/TypedArrayRoundTrip", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	vector<double> features = GetFeatureVector();
+	for (size_t i = 0; i < 100; i++)
+	{
+		Ref<Metadata> metadata = Metadata::CreateArray(features);
+		MetadataArray<double> result;
+		metadata->GetArray(result);
+		DoNotOptimize(result.data());
+		counters.items += result.size();
+		counters.bytes += result.size() * sizeof(double);
+	}
+});
+
+
+VERIFY("Metadata/TypedArray", [](string& error) {
+	vector<double> features = GetFeatureVector();
+	Ref<Metadata> metadata = Metadata::CreateArray(features);
+	MetadataArray<double> result;
+	if (!metadata->IsRaw() || !metadata->GetArray(result) || (result.size() != features.size()))
+	{
+		error = "typed array was not read back";
+		return false;
+	}
+	for (size_t i = 0; i < features.size(); i++)
+	{
+		if (result[i] != features[i])
+		{
+			error = fmt::format("element {} differs", i);
+			return false;
+		}
+	}
+	MetadataArray<float> wrongType;
+	if (metadata->GetArray(wrongType))
+	{
+		error = "typed array was read with the wrong element type";
+		return false;
+	}
+	return true;
+});
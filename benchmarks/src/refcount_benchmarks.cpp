@@ -0,0 +1,94 @@
+/*
+ * Benchmarks for the cost of holding and copying references to core
+ * objects in tight loops over functions and basic blocks.
+ */
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+BENCHMARK("Ref/CopyFunction", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		for (size_t i = 0; i < 100; i++)
+		{
+			Ref<Function> copy = func;
+			DoNotOptimize(copy.GetPtr());
+			counters.items++;
+		}
+	}
+});
+
+
+BENCHMARK("Ref/BorrowFunction", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		for (size_t i = 0; i < 100; i++)
+		{
+			BorrowedRef<Function> borrowed = func;
+			DoNotOptimize(borrowed.GetPtr());
+			counters.items++;
+		}
+	}
+});
+
+
+BENCHMARK("Ref/FunctionLoopByValue", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (size_t i = 0; i < 100; i++)
+	{
+		for (auto func : context.functions)
+		{
+			DoNotOptimize(func.GetPtr());
+			counters.items++;
+		}
+	}
+});
+
+
+BENCHMARK("Ref/FunctionLoopBorrowed", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (size_t i = 0; i < 100; i++)
+	{
+		for (BorrowedRef<Function> func : context.functions)
+		{
+			DoNotOptimize(func.GetPtr());
+			counters.items++;
+		}
+	}
+});
+
+
+BENCHMARK("Ref/BasicBlockLoopByValue", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		auto blocks = func->GetBasicBlocks();
+		for (size_t i = 0; i < 10; i++)
+		{
+			for (auto block : blocks)
+			{
+				for (auto& edge : block->GetOutgoingEdges())
+					DoNotOptimize(edge.target.GetPtr());
+				counters.items++;
+			}
+		}
+	}
+});
+
+
+BENCHMARK("Ref/BasicBlockLoopBorrowed", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		auto blocks = func->GetBasicBlocks();
+		for (size_t i = 0; i < 10; i++)
+		{
+			for (BorrowedRef<BasicBlock> block : blocks)
+			{
+				for (auto& edge : block->GetOutgoingEdges())
+					DoNotOptimize(edge.target.GetPtr());
+				counters.items++;
+			}
+		}
+	}
+});
@@ -0,0 +1,68 @@
+/*
+ * Benchmarks comparing settings reads through the core with reads
+ * through CachedSetting handles.
+ */
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+BENCHMARK("Settings/GetBool", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	Ref<Settings> settings = Settings::Instance();
+	size_t enabled = 0;
+	for (size_t i = 0; i < 10000; i++)
+	{
+		enabled += settings->Get<bool>("analysis.linearSweep.autorun", context.view) ? 1 : 0;
+		counters.items++;
+	}
+	DoNotOptimize(enabled);
+});
+
+
+BENCHMARK("Settings/CachedGetBool", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	CachedSetting<bool> setting("analysis.linearSweep.autorun");
+	size_t enabled = 0;
+	for (size_t i = 0; i < 10000; i++)
+	{
+		enabled += setting.Get(context.view) ? 1 : 0;
+		counters.items++;
+	}
+	DoNotOptimize(enabled);
+});
+
+
+BENCHMARK("Settings/GetStringList", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	Ref<Settings> settings = Settings::Instance();
+	size_t total = 0;
+	for (size_t i = 0; i < 10000; i++)
+	{
+		total += settings->Get<vector<string>>("files.universal.architecturePreference", context.view).size();
+		counters.items++;
+	}
+	DoNotOptimize(total);
+});
+
+
+BENCHMARK("Settings/CachedGetStringList", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	CachedSetting<vector<string>> setting("files.universal.architecturePreference");
+	size_t total = 0;
+	for (size_t i = 0; i < 10000; i++)
+	{
+		total += setting.Get(context.view).size();
+		counters.items++;
+	}
+	DoNotOptimize(total);
+});
+
+
+BENCHMARK("Settings/GetGroup", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	Ref<Settings> settings = Settings::Instance();
+	for (size_t i = 0; i < 10; i++)
+	{
+		Json::Value values = settings->GetGroup("analysis", context.view);
+		counters.items += values.size();
+	}
+});
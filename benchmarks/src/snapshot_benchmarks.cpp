@@ -0,0 +1,114 @@
+/*
+ * Self checks for snapshot data written by SnapshotWriter, read back
+ * through Snapshot::ReadData.
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <random>
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+static bool CompareStores(KeyValueStore* expected, KeyValueStore* actual, const string& label, string& error)
+{
+	vector<string> expectedKeys = expected->GetKeys();
+	vector<string> actualKeys = actual->GetKeys();
+	sort(expectedKeys.begin(), expectedKeys.end());
+	sort(actualKeys.begin(), actualKeys.end());
+	if (expectedKeys != actualKeys)
+	{
+		error = fmt::format("{}: read back {} keys, expected {}", label, actualKeys.size(), expectedKeys.size());
+		return false;
+	}
+	for (auto& key : expectedKeys)
+	{
+		if (expected->GetBuffer(key) != actual->GetBuffer(key))
+		{
+			error = fmt::format("{}: value of '{}' differs after the round trip", label, key);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+static size_t GetStoredSize(Snapshot* snapshot)
+{
+	Ref<KeyValueStore> stored = new KeyValueStore(BNReadSnapshotData(snapshot->GetObject()));
+	return stored->DataSize();
+}
+
+
+// Writes a plain snapshot and two incremental descendants with small chunks, so that values span chunks and
+// unchanged values are resolved from both ancestors, and checks that each reads back as written
+VERIFY("Snapshot/ChunkedRoundTrip", [](string& error) {
+	filesystem::path directory = filesystem::temp_directory_path() / "api_benchmarks_snapshot";
+	error_code ec;
+	filesystem::remove_all(directory, ec);
+	filesystem::create_directories(directory, ec);
+	string path = (directory / "snapshot.bndb").string();
+
+	mt19937_64 rng(0x44);
+	auto randomBuffer = [&](size_t len, bool compressible) {
+		DataBuffer data(len);
+		for (size_t i = 0; i < len; i++)
+			data[i] = compressible ? (uint8_t)(i / 64) : (uint8_t)(rng() & 0xff);
+		return data;
+	};
+
+	Ref<FileMetadata> file = new FileMetadata();
+	Ref<BinaryView> view = new BinaryData(file, randomBuffer(0x1000, false));
+	if (!file->CreateDatabase(path, view, new SaveSettings()))
+	{
+		error = "could not create a database";
+		return false;
+	}
+	Ref<Database> database = file->GetDatabase();
+
+	Ref<KeyValueStore> data = new KeyValueStore();
+	data->SetBuffer("empty", DataBuffer());
+	data->SetBuffer("small", randomBuffer(100, false));
+	data->SetBuffer("spanning", randomBuffer(20000, false));
+	data->SetBuffer("compressible", randomBuffer(50000, true));
+	for (size_t i = 0; i < 32; i++)
+		data->SetBuffer(fmt::format("value{}", i), randomBuffer(rng() % 3000, (i & 1) != 0));
+
+	SnapshotWriterSettings settings;
+	settings.chunkSize = 4096;
+	settings.threadCount = 4;
+	SnapshotWriter plainWriter(database, settings);
+	int64_t plainId =
+	    plainWriter.WriteSnapshotData({database->GetCurrentSnapshot()->GetId()}, view, "plain", data, false);
+	Ref<Snapshot> plain = database->GetSnapshot(plainId);
+	if (!CompareStores(data, plain->ReadData(), "plain", error))
+		return false;
+
+	settings.incremental = true;
+	SnapshotWriter incrementalWriter(database, settings);
+	data->SetBuffer("small", randomBuffer(120, false));
+	data->SetBuffer("value3", randomBuffer(5000, false));
+	data->SetBuffer("added", randomBuffer(700, true));
+	int64_t firstId = incrementalWriter.WriteSnapshotData({plainId}, view, "first", data, false);
+	Ref<Snapshot> first = database->GetSnapshot(firstId);
+	if (!CompareStores(data, first->ReadData(), "incremental", error))
+		return false;
+	if (GetStoredSize(first) >= GetStoredSize(plain))
+	{
+		error = "incremental snapshot stores unchanged values again";
+		return false;
+	}
+
+	data->SetBuffer("spanning", randomBuffer(20000, false));
+	int64_t secondId = incrementalWriter.WriteSnapshotData({firstId}, view, "second", data, false);
+	if (!CompareStores(data, database->GetSnapshot(secondId)->ReadData(), "second incremental", error))
+		return false;
+
+	file->Close();
+	filesystem::remove_all(directory, ec);
+	return true;
+});
@@ -0,0 +1,218 @@
+/*
+ * Benchmarks comparing one-shot transforms with reads through a
+ * TransformedBinaryView, along with a self check of the streaming
+ * transforms against the core.
+ */
+
+#include <cctype>
+#include <random>
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+static const size_t g_payloadSize = 16 * 1024 * 1024;
+
+
+static map<string, DataBuffer> GetXorParams()
+{
+	return {{"key", DataBuffer("\x5a\xa5\x3c\xc3\x0f", 5)}};
+}
+
+
+static const DataBuffer& GetEncodedPayload()
+{
+	static DataBuffer payload;
+	if (payload.GetLength() == 0)
+	{
+		DataBuffer plain(g_payloadSize);
+		mt19937_64 rng(0x42);
+		for (size_t i = 0; i < g_payloadSize; i++)
+			plain[i] = (uint8_t)(rng() % 16);
+		Transform::GetByName("XOR")->Encode(plain, payload, GetXorParams());
+	}
+	return payload;
+}
+
+
+BENCHMARK("Transform/OneShotDecode", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	const DataBuffer& payload = GetEncodedPayload();
+	uint64_t before = GetResidentMemory();
+	DataBuffer output;
+	Transform::GetByName("XOR")->Decode(payload, output, GetXorParams());
+	uint64_t after = GetResidentMemory();
+	counters.bytes += output.GetLength();
+	counters.residentBytes = (after > before) ? after - before : 0;
+	DoNotOptimize(output.GetData());
+});
+
+
+BENCHMARK("Transform/StreamedViewRead", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Ref<BinaryData> source = new BinaryData(new FileMetadata(), GetEncodedPayload());
+	uint64_t before = GetResidentMemory();
+	Ref<TransformedBinaryView> view = TransformedBinaryView::Create(
+	    source, 0, source->GetLength(), Transform::GetByName("XOR"), GetXorParams());
+	if (!view)
+		return;
+	uint8_t buffer[0x1000];
+	uint64_t total = 0;
+	for (uint64_t offset = 0; offset < view->GetLength(); offset += sizeof(buffer))
+	{
+		size_t len = view->Read(buffer, offset, sizeof(buffer));
+		total += buffer[0];
+		counters.bytes += len;
+	}
+	uint64_t after = GetResidentMemory();
+	counters.residentBytes = (after > before) ? after - before : 0;
+	DoNotOptimize(total);
+});
+
+
+static bool CoreTransformBuffer(const string& name, bool encode, const DataBuffer& input, DataBuffer& output,
+    const map<string, DataBuffer>& params)
+{
+	vector<DataBuffer::ScopedObject> values;
+	values.reserve(params.size());
+	vector<BNTransformParameter> list;
+	for (auto& i : params)
+	{
+		values.emplace_back(i.second);
+		list.push_back({i.first.c_str(), values.back()});
+	}
+	BNTransform* xform = BNGetTransformByName(name.c_str());
+	if (!xform)
+		return false;
+	if (encode)
+		return BNEncode(xform, DataBuffer::ScopedObject(input), output.GetBufferObject(), list.data(), list.size());
+	return BNDecode(xform, DataBuffer::ScopedObject(input), output.GetBufferObject(), list.data(), list.size());
+}
+
+
+// Feeds random inputs to the streaming transforms in random chunk sizes and checks that the output matches the
+// core's one-shot implementation of the same transform
+VERIFY("Transform/Streaming", [](string& error) {
+	mt19937_64 rng(0x42);
+	struct Case
+	{
+		const char* name;
+		bool encode;
+		bool textInput;
+	};
+	const Case cases[] = {{"RawHex", true, false}, {"RawHex", false, true}, {"Base64", false, true},
+	    {"XOR", false, false}, {"XOR", true, false}, {"RC4", true, false}, {"RC4", false, false}};
+
+	for (size_t iteration = 0; iteration < 2000; iteration++)
+	{
+		const Case& test = cases[iteration % (sizeof(cases) / sizeof(cases[0]))];
+		size_t len = rng() % ((iteration % 50) == 0 ? 0x10000 : 300);
+		DataBuffer input(len);
+		for (size_t i = 0; i < len; i++)
+			input[i] = (uint8_t)(rng() & 0xff);
+		if (test.textInput)
+		{
+			string text = strcmp(test.name, "Base64") == 0 ? input.ToBase64() : input.ToHex();
+			input = DataBuffer(text.data(), text.size());
+		}
+		map<string, DataBuffer> params;
+		DataBuffer key(1 + (rng() % 32));
+		for (size_t i = 0; i < key.GetLength(); i++)
+			key[i] = (uint8_t)(rng() & 0xff);
+		params["key"] = key;
+
+		DataBuffer expected;
+		if (!CoreTransformBuffer(test.name, test.encode, input, expected, params))
+			continue;
+
+		Ref<Transform> xform = Transform::GetByName(test.name);
+		Ref<TransformStream> stream = test.encode ? xform->CreateEncodeStream() : xform->CreateDecodeStream();
+		DataBuffer output;
+		bool ok = stream->Begin(params);
+		for (size_t offset = 0; ok && (offset < input.GetLength());)
+		{
+			size_t chunk = min<size_t>(1 + (rng() % 5000), input.GetLength() - offset);
+			ok = stream->Update(input.GetDataAt(offset), chunk, output);
+			offset += chunk;
+		}
+		ok = ok && stream->Finish(output);
+		if (!ok || (output != expected))
+		{
+			error = fmt::format("{} {} differs from the core for length {}", test.name,
+			    test.encode ? "encode" : "decode", input.GetLength());
+			return false;
+		}
+
+		DataBuffer oneShot;
+		ok = test.encode ? xform->Encode(input, oneShot, params) : xform->Decode(input, oneShot, params);
+		if (!ok || (oneShot != expected))
+		{
+			error = fmt::format("one-shot {} {} differs from the core for length {}", test.name,
+			    test.encode ? "encode" : "decode", input.GetLength());
+			return false;
+		}
+	}
+	return true;
+});
+
+
+// Feeds damaged text to the streaming decoders. Whatever a stream accepts must be accepted by the core with the
+// same output, since the one-shot calls only fall back to the core when the stream rejects its input.
+VERIFY("Transform/StreamingMalformed", [](string& error) {
+	mt19937_64 rng(0x43);
+	const char* const names[] = {"RawHex", "Base64"};
+	const char* const insertions[] = {" ", "\n", "\r\n", "\t", "=", "==", "-", "_", "\0", "g", "\xff"};
+
+	for (size_t iteration = 0; iteration < 4000; iteration++)
+	{
+		const char* name = names[iteration & 1];
+		DataBuffer data(rng() % 64);
+		for (size_t i = 0; i < data.GetLength(); i++)
+			data[i] = (uint8_t)(rng() & 0xff);
+		string text = strcmp(name, "Base64") == 0 ? data.ToBase64() : data.ToHex();
+
+		size_t edits = 1 + (rng() % 3);
+		for (size_t edit = 0; edit < edits; edit++)
+		{
+			size_t position = text.empty() ? 0 : (size_t)(rng() % (text.size() + 1));
+			switch (rng() % 4)
+			{
+			case 0:
+			{
+				const char* insertion = insertions[rng() % (sizeof(insertions) / sizeof(insertions[0]))];
+				text.insert(position, insertion, max<size_t>(strlen(insertion), 1));
+				break;
+			}
+			case 1:
+				if (!text.empty())
+					text.erase(min(position, text.size() - 1), 1);
+				break;
+			case 2:
+				if (position < text.size())
+					text[position] = (char)(rng() & 0xff);
+				break;
+			default:
+				if (position < text.size())
+					text[position] = (char)(isupper((uint8_t)text[position]) ? tolower((uint8_t)text[position]) :
+					                                                           toupper((uint8_t)text[position]));
+				break;
+			}
+		}
+
+		DataBuffer input(text.data(), text.size());
+		map<string, DataBuffer> params;
+		DataBuffer streamed;
+		Ref<TransformStream> stream = Transform::GetByName(name)->CreateDecodeStream();
+		if (!stream->Process(input, streamed, params))
+			continue;
+		DataBuffer expected;
+		if (!CoreTransformBuffer(name, false, input, expected, params) || (streamed != expected))
+		{
+			error = fmt::format("{} decode of \"{}\" is accepted by the stream but not decoded the same by the core",
+			    name, input.ToEscapedString());
+			return false;
+		}
+	}
+	return true;
+});
@@ -0,0 +1,364 @@
+/*
+ * Self checks for StructureBuilder::ComputeLayout, AddMembers and
+ * ReplaceMembers against structures laid out by the core.
+ */
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+// A member as added to the reference structure, one core call at a time
+struct ReferenceMember
+{
+	Ref<Type> type;
+	string name;
+	uint64_t offset = StructureMemberDescriptor::AutoOffset;
+};
+
+
+static void AddReferenceMembers(StructureBuilder& builder, const vector<ReferenceMember>& members)
+{
+	for (auto& member : members)
+	{
+		if (member.offset == StructureMemberDescriptor::AutoOffset)
+			builder.AddMember(member.type, member.name);
+		else
+			builder.AddMemberAtOffset(member.type, member.name, member.offset);
+	}
+}
+
+
+static vector<StructureMemberDescriptor> GetDescriptors(const vector<ReferenceMember>& members)
+{
+	vector<StructureMemberDescriptor> result;
+	for (auto& member : members)
+	{
+		StructureMemberDescriptor descriptor;
+		descriptor.type = member.type;
+		descriptor.name = member.name.c_str();
+		descriptor.offset = member.offset;
+		result.push_back(descriptor);
+	}
+	return result;
+}
+
+
+static bool CompareStructures(Structure* expected, Structure* actual, const string& label, string& error)
+{
+	if (expected->GetWidth() != actual->GetWidth())
+	{
+		error = fmt::format("{}: width {:#x}, core computed {:#x}", label, actual->GetWidth(), expected->GetWidth());
+		return false;
+	}
+	if (expected->GetAlignment() != actual->GetAlignment())
+	{
+		error = fmt::format(
+		    "{}: alignment {}, core computed {}", label, actual->GetAlignment(), expected->GetAlignment());
+		return false;
+	}
+	if ((expected->GetStructureType() != actual->GetStructureType()) || (expected->IsPacked() != actual->IsPacked()))
+	{
+		error = fmt::format("{}: structure variant or packing differs from the core", label);
+		return false;
+	}
+
+	vector<StructureMember> expectedMembers = expected->GetMembers();
+	vector<StructureMember> actualMembers = actual->GetMembers();
+	if (expectedMembers.size() != actualMembers.size())
+	{
+		error = fmt::format("{}: {} members, core has {}", label, actualMembers.size(), expectedMembers.size());
+		return false;
+	}
+	for (size_t i = 0; i < expectedMembers.size(); i++)
+	{
+		const StructureMember& e = expectedMembers[i];
+		const StructureMember& a = actualMembers[i];
+		if ((e.name != a.name) || (e.offset != a.offset) || (e.type->GetString() != a.type->GetString()))
+		{
+			error = fmt::format("{}: member {} is '{}' {} at {:#x}, core has '{}' {} at {:#x}", label, i, a.name,
+			    a.type->GetString(), a.offset, e.name, e.type->GetString(), e.offset);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// Lays out the members locally and through the core, and checks that the computed layout, the structure
+// committed by AddMembers and the core's own placement all agree
+static bool CheckLayout(const vector<ReferenceMember>& members, BNStructureVariant variant, bool packed,
+    const string& label, string& error)
+{
+	StructureBuilder reference(variant, packed);
+	AddReferenceMembers(reference, members);
+	Ref<Structure> expected = reference.Finalize();
+
+	vector<StructureMemberDescriptor> descriptors = GetDescriptors(members);
+	StructureLayout layout;
+	if (!StructureBuilder::ComputeLayout(descriptors, variant, packed, layout, error))
+	{
+		error = fmt::format("{}: layout rejected: {}", label, error);
+		return false;
+	}
+	if ((layout.width != expected->GetWidth()) || (layout.alignment != expected->GetAlignment()))
+	{
+		error = fmt::format("{}: computed width {:#x} alignment {}, core computed width {:#x} alignment {}", label,
+		    layout.width, layout.alignment, expected->GetWidth(), expected->GetAlignment());
+		return false;
+	}
+
+	StructureBuilder builder(variant, packed);
+	if (!builder.AddMembers(descriptors, error))
+	{
+		error = fmt::format("{}: members rejected: {}", label, error);
+		return false;
+	}
+	Ref<Structure> actual = builder.Finalize();
+	if (!CompareStructures(expected, actual, label, error))
+		return false;
+
+	// Offset lookups answered locally must match the core's, including in padding and past the end
+	vector<StructureMember> expectedMembers = expected->GetMembers();
+	for (uint64_t offset = 0; offset <= layout.width; offset++)
+	{
+		StructureMember member;
+		bool coreFound = expected->GetMemberAtOffset((int64_t)offset, member);
+		size_t index;
+		bool found = layout.FindMemberAtOffset(offset, index);
+		if (coreFound != found)
+		{
+			error = fmt::format("{}: offset {:#x} {} a member locally but {} in the core", label, offset,
+			    found ? "has" : "has no", coreFound ? "has one" : "has none");
+			return false;
+		}
+		if (found && (variant != UnionStructureType) && (members[index].name != member.name))
+		{
+			error = fmt::format("{}: offset {:#x} is in '{}' locally but '{}' in the core", label, offset,
+			    members[index].name, member.name);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+VERIFY("Structure/ComputeLayout", [](string& error) {
+	Ref<Type> i8 = Type::IntegerType(1, true);
+	Ref<Type> i16 = Type::IntegerType(2, true);
+	Ref<Type> i32 = Type::IntegerType(4, true);
+	Ref<Type> i64 = Type::IntegerType(8, true);
+	Ref<Type> f64 = Type::FloatType(8);
+	Ref<Type> chars = Type::ArrayType(i8, 3);
+
+	StructureBuilder innerBuilder;
+	innerBuilder.AddMember(i8, "tag");
+	innerBuilder.AddMember(i64, "value");
+	Ref<Type> inner = Type::StructureType(innerBuilder.Finalize());
+
+	vector<ReferenceMember> mixed = {
+	    {i8, "a"}, {i32, "b"}, {i8, "c"}, {i64, "d"}, {i16, "e"}, {chars, "f"}, {f64, "g"}, {i8, "h"}};
+	if (!CheckLayout(mixed, StructStructureType, false, "aligned", error))
+		return false;
+	if (!CheckLayout(mixed, ClassStructureType, false, "aligned class", error))
+		return false;
+	if (!CheckLayout(mixed, StructStructureType, true, "packed", error))
+		return false;
+	if (!CheckLayout(mixed, UnionStructureType, false, "union", error))
+		return false;
+	if (!CheckLayout(mixed, UnionStructureType, true, "packed union", error))
+		return false;
+
+	vector<ReferenceMember> nested = {{i8, "a"}, {inner, "b"}, {i16, "c"}, {inner, "d"}};
+	if (!CheckLayout(nested, StructStructureType, false, "nested", error))
+		return false;
+	if (!CheckLayout(nested, StructStructureType, true, "packed nested", error))
+		return false;
+
+	vector<ReferenceMember> placed = {{i32, "a", 0x10}, {i16, "b", 4}, {i8, "c"}, {i64, "d", 0x20}, {i8, "e"}};
+	if (!CheckLayout(placed, StructStructureType, false, "explicit offsets", error))
+		return false;
+	if (!CheckLayout(placed, StructStructureType, true, "packed explicit offsets", error))
+		return false;
+
+	vector<ReferenceMember> empty;
+	return CheckLayout(empty, StructStructureType, false, "empty", error);
+});
+
+
+VERIFY("Structure/ComputeLayoutBitfields", [](string& error) {
+	Ref<Type> u8 = Type::IntegerType(1, false);
+	Ref<Type> u32 = Type::IntegerType(4, false);
+
+	// a, b and c share the first unit, d does not fit in what is left of it, e and f have a different width
+	struct Bitfield
+	{
+		Type* type;
+		const char* name;
+		uint8_t bits;
+		uint64_t offset;
+		uint8_t position;
+	};
+	vector<Bitfield> bitfields = {{u32, "a", 3, 0, 0}, {u32, "b", 5, 0, 3}, {u32, "c", 20, 0, 8},
+	    {u32, "d", 30, 4, 0}, {u8, "e", 2, 8, 0}, {u8, "f", 6, 8, 2}, {u8, "g", 1, 9, 0}};
+	vector<StructureMemberDescriptor> descriptors;
+	for (auto& bitfield : bitfields)
+	{
+		StructureMemberDescriptor descriptor;
+		descriptor.type = bitfield.type;
+		descriptor.name = bitfield.name;
+		descriptor.bitWidth = bitfield.bits;
+		descriptors.push_back(descriptor);
+	}
+
+	StructureLayout layout;
+	if (!StructureBuilder::ComputeLayout(descriptors, StructStructureType, false, layout, error))
+	{
+		error = "bitfield layout rejected: " + error;
+		return false;
+	}
+	for (size_t i = 0; i < bitfields.size(); i++)
+	{
+		const StructureMemberLayout& placement = layout.members[i];
+		if ((placement.offset != bitfields[i].offset) || (placement.bitPosition != bitfields[i].position))
+		{
+			error = fmt::format("bitfield '{}' placed at {:#x} bit {}, expected {:#x} bit {}", bitfields[i].name,
+			    placement.offset, placement.bitPosition, bitfields[i].offset, bitfields[i].position);
+			return false;
+		}
+	}
+
+	// The core has no bitfields, so each storage unit is committed as one member named after its first bitfield.
+	// The result must match the core laying out those storage units.
+	StructureBuilder reference;
+	AddReferenceMembers(reference, {{u32, "a"}, {u32, "d"}, {u8, "e"}, {u8, "g"}});
+	Ref<Structure> expected = reference.Finalize();
+	StructureBuilder builder;
+	if (!builder.AddMembers(descriptors, error))
+	{
+		error = "bitfield members rejected: " + error;
+		return false;
+	}
+	if (!CompareStructures(expected, builder.Finalize(), "bitfields", error))
+		return false;
+
+	// A bitfield wider than its type is rejected
+	StructureMemberDescriptor wide;
+	wide.type = u8;
+	wide.name = "wide";
+	wide.bitWidth = 9;
+	if (StructureBuilder::ComputeLayout(Span<const StructureMemberDescriptor>(&wide, 1), StructStructureType, false,
+	        layout, error))
+	{
+		error = "a 9 bit bitfield of an 8 bit type was accepted";
+		return false;
+	}
+	error.clear();
+	return true;
+});
+
+
+VERIFY("Structure/ComputeLayoutOverlap", [](string& error) {
+	Ref<Type> i16 = Type::IntegerType(2, true);
+	Ref<Type> i32 = Type::IntegerType(4, true);
+
+	// Overlapping explicit offsets are rejected in a structure and accepted in a union
+	vector<ReferenceMember> overlapping = {{i32, "a", 0}, {i16, "b", 2}};
+	vector<StructureMemberDescriptor> descriptors = GetDescriptors(overlapping);
+	StructureLayout layout;
+	if (StructureBuilder::ComputeLayout(descriptors, StructStructureType, false, layout, error))
+	{
+		error = "overlapping members were accepted in a structure";
+		return false;
+	}
+	if (!CheckLayout(overlapping, UnionStructureType, false, "overlapping union", error))
+		return false;
+
+	// A rejected AddMembers leaves the builder untouched
+	StructureBuilder builder;
+	builder.AddMember(i32, "existing");
+	if (builder.AddMembers(descriptors, error) || (builder.GetMembers().size() != 1))
+	{
+		error = "overlapping members were added to a structure";
+		return false;
+	}
+
+	// New members at an explicit offset are checked against the existing ones, automatically placed members go
+	// after them
+	vector<ReferenceMember> intoExisting = {{i16, "b", 2}};
+	vector<StructureMemberDescriptor> intoExistingDescriptors = GetDescriptors(intoExisting);
+	if (builder.AddMembers(intoExistingDescriptors, error) || (builder.GetMembers().size() != 1))
+	{
+		error = "a member overlapping an existing member was added";
+		return false;
+	}
+	vector<ReferenceMember> appended = {{i16, "b"}, {i32, "c"}, {i16, "d", 0x10}};
+	vector<StructureMemberDescriptor> appendedDescriptors = GetDescriptors(appended);
+	if (!builder.AddMembers(appendedDescriptors, error))
+	{
+		error = "appending members was rejected: " + error;
+		return false;
+	}
+	StructureBuilder reference;
+	reference.AddMember(i32, "existing");
+	AddReferenceMembers(reference, appended);
+	return CompareStructures(reference.Finalize(), builder.Finalize(), "appended", error);
+});
+
+
+VERIFY("Structure/ReplaceMembers", [](string& error) {
+	Ref<Type> i8 = Type::IntegerType(1, true);
+	Ref<Type> i32 = Type::IntegerType(4, true);
+	Ref<Type> i64 = Type::IntegerType(8, true);
+
+	Ref<NamedTypeReference> base = new NamedTypeReference(ClassNamedTypeClass, "base-id", QualifiedName("Base"));
+	vector<BaseStructure> bases = {BaseStructure(base, 0, 0x10)};
+
+	for (bool packed : {false, true})
+	{
+		string label = packed ? "packed replace" : "replace";
+		StructureBuilder builder(ClassStructureType, packed);
+		builder.SetBaseStructures(bases);
+		builder.SetPointerOffset(8);
+		builder.SetPropagateDataVariableReferences(true);
+		builder.AddMember(i64, "old1");
+		builder.AddMember(i8, "old2");
+		builder.AddMember(i64, "old3");
+		builder.AddMember(i64, "old4");
+
+		vector<ReferenceMember> members = {{i32, "vtable", 0}, {i8, "a", 0x10}, {i64, "b"}, {i32, "c"}};
+		vector<StructureMemberDescriptor> descriptors = GetDescriptors(members);
+		if (!builder.ReplaceMembers(descriptors, error))
+		{
+			error = fmt::format("{}: members rejected: {}", label, error);
+			return false;
+		}
+		Ref<Structure> actual = builder.Finalize();
+
+		StructureBuilder reference(ClassStructureType, packed);
+		AddReferenceMembers(reference, members);
+		if (!CompareStructures(reference.Finalize(), actual, label, error))
+			return false;
+
+		vector<BaseStructure> actualBases = actual->GetBaseStructures();
+		if ((actualBases.size() != 1) || (actualBases[0].type->GetTypeId() != "base-id") ||
+		    (actualBases[0].offset != 0) || (actualBases[0].width != 0x10))
+		{
+			error = fmt::format("{}: base structures were not preserved", label);
+			return false;
+		}
+		if (actual->GetPointerOffset() != 8)
+		{
+			error = fmt::format("{}: pointer offset {}, expected 8", label, actual->GetPointerOffset());
+			return false;
+		}
+		if (!actual->PropagateDataVariableReferences())
+		{
+			error = fmt::format("{}: data variable reference propagation was not preserved", label);
+			return false;
+		}
+	}
+	return true;
+});
@@ -0,0 +1,110 @@
+/*
+ * Benchmarks comparing a full type library load with lookups through
+ * a LazyTypeLibrary converted from the same library.
+ */
+
+#include <filesystem>
+
+#include "benchmark.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+namespace
+{
+	struct TypeLibraryFixture
+	{
+		string libraryPath;
+		string lazyDirectory;
+		vector<QualifiedName> names;
+	};
+}  // namespace
+
+
+// The largest type library available for the view's platform, written out once as both a .bntl file and a
+// lazy library directory, along with a spread out sample of its type names
+static const TypeLibraryFixture& GetFixture(BenchmarkContext& context)
+{
+	static TypeLibraryFixture fixture;
+	static bool initialized = false;
+	if (initialized)
+		return fixture;
+	initialized = true;
+
+	Ref<Platform> platform = context.view->GetDefaultPlatform();
+	if (!platform)
+		return fixture;
+	Ref<TypeLibrary> largest;
+	vector<QualifiedNameAndType> types;
+	for (auto& library : platform->GetTypeLibraries())
+	{
+		vector<QualifiedNameAndType> libraryTypes = library->GetNamedTypes();
+		if (libraryTypes.size() > types.size())
+		{
+			largest = library;
+			types = std::move(libraryTypes);
+		}
+	}
+	if (!largest)
+		return fixture;
+
+	filesystem::path directory = filesystem::temp_directory_path() / "api_benchmarks_typelibrary";
+	error_code ec;
+	filesystem::remove_all(directory, ec);
+	filesystem::create_directories(directory, ec);
+	string libraryPath = (directory / "library.bntl").string();
+	string lazyDirectory = (directory / "library.lazy").string();
+	largest->WriteToFile(libraryPath);
+	if (!LazyTypeLibrary::Convert(largest, lazyDirectory))
+		return fixture;
+
+	fixture.libraryPath = libraryPath;
+	fixture.lazyDirectory = lazyDirectory;
+	size_t stride = max<size_t>(types.size() / 200, 1);
+	for (size_t i = 0; i < types.size(); i += stride)
+		fixture.names.push_back(types[i].name);
+	return fixture;
+}
+
+
+BENCHMARK("TypeLibrary/LoadFromFile", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	const TypeLibraryFixture& fixture = GetFixture(context);
+	if (fixture.names.empty())
+		return;
+	uint64_t before = GetResidentMemory();
+	Ref<TypeLibrary> library = TypeLibrary::LoadFromFile(fixture.libraryPath);
+	if (!library)
+		return;
+	size_t found = 0;
+	for (auto& name : fixture.names)
+	{
+		if (library->GetNamedType(name))
+			found++;
+		counters.items++;
+	}
+	uint64_t after = GetResidentMemory();
+	counters.residentBytes = (after > before) ? after - before : 0;
+	DoNotOptimize(found);
+});
+
+
+BENCHMARK("TypeLibrary/LazyLookup", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	const TypeLibraryFixture& fixture = GetFixture(context);
+	if (fixture.names.empty())
+		return;
+	uint64_t before = GetResidentMemory();
+	Ref<LazyTypeLibrary> library = LazyTypeLibrary::Open(fixture.lazyDirectory);
+	if (!library)
+		return;
+	size_t found = 0;
+	for (auto& name : fixture.names)
+	{
+		found += library->GetNamedTypeWithDependencies(name).size();
+		counters.items++;
+	}
+	uint64_t after = GetResidentMemory();
+	counters.residentBytes = (after > before) ? after - before : 0;
+	DoNotOptimize(found);
+});
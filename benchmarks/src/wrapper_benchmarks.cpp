@@ -0,0 +1,454 @@
+/*
+ * Benchmarks covering the hot paths of the C++ wrapper: binary reads,
+ * IL traversal, analysis object enumeration, notification dispatch and
+ * type/architecture queries.
+ */
+
+#include <algorithm>
+
+#include "benchmark.h"
+#include "lowlevelilinstruction.h"
+#include "mediumlevelilinstruction.h"
+#include "highlevelilinstruction.h"
+
+using namespace BinaryNinja;
+using namespace Benchmarks;
+using namespace std;
+
+
+// Bytes of each segment that is backed by file data, capped to keep a single iteration short
+static vector<pair<uint64_t, uint64_t>> GetReadableRanges(BinaryView* view, uint64_t maxTotal = 0x100000)
+{
+	vector<pair<uint64_t, uint64_t>> result;
+	uint64_t total = 0;
+	for (auto& segment : view->GetSegments())
+	{
+		uint64_t len = min(segment->GetDataLength(), segment->GetEnd() - segment->GetStart());
+		len = min(len, maxTotal - total);
+		if (len == 0)
+			continue;
+		result.emplace_back(segment->GetStart(), len);
+		total += len;
+		if (total >= maxTotal)
+			break;
+	}
+	return result;
+}
+
+
+template <class T, T (BinaryReader::*ReadFunc)()>
+static void BenchmarkReaderLoop(BenchmarkContext& context, BenchmarkCounters& counters)
+{
+	BinaryReader reader(context.view);
+	T sum = 0;
+	for (auto& range : GetReadableRanges(context.view))
+	{
+		reader.Seek(range.first);
+		for (uint64_t i = 0; (i + sizeof(T)) <= range.second; i += sizeof(T))
+		{
+			sum += (reader.*ReadFunc)();
+			counters.items++;
+			counters.bytes += sizeof(T);
+		}
+	}
+	DoNotOptimize(sum);
+}
+
+
+BENCHMARK("BinaryReader/Read8", (BenchmarkReaderLoop<uint8_t, &BinaryReader::Read8>));
+BENCHMARK("BinaryReader/Read32", (BenchmarkReaderLoop<uint32_t, &BinaryReader::Read32>));
+BENCHMARK("BinaryReader/Read64", (BenchmarkReaderLoop<uint64_t, &BinaryReader::Read64>));
+
+
+BENCHMARK("BinaryView/Read64K", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	const size_t blockSize = 0x10000;
+	vector<uint8_t> buffer(blockSize);
+	for (auto& range : GetReadableRanges(context.view, 0x1000000))
+	{
+		for (uint64_t offset = 0; offset < range.second; offset += blockSize)
+		{
+			size_t len = context.view->Read(buffer.data(), range.first + offset,
+				(size_t)min<uint64_t>(blockSize, range.second - offset));
+			counters.items++;
+			counters.bytes += len;
+		}
+	}
+	DoNotOptimize(buffer[0]);
+});
+
+
+BENCHMARK("BinaryView/ReadDataBuffer64K", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	const size_t blockSize = 0x10000;
+	for (auto& range : GetReadableRanges(context.view, 0x1000000))
+	{
+		for (uint64_t offset = 0; offset < range.second; offset += blockSize)
+		{
+			DataBuffer buffer = context.view->ReadBuffer(range.first + offset,
+				(size_t)min<uint64_t>(blockSize, range.second - offset));
+			counters.items++;
+			counters.bytes += buffer.GetLength();
+		}
+	}
+});
+
+
+BENCHMARK("LowLevelIL/VisitExprs", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		Ref<LowLevelILFunction> il = func->GetLowLevelIL();
+		if (!il)
+			continue;
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+		{
+			il->GetInstruction(i).VisitExprs([&](const LowLevelILInstruction& expr) {
+				DoNotOptimize(expr.operation);
+				counters.items++;
+				return true;
+			});
+		}
+	}
+});
+
+
+BENCHMARK("MediumLevelIL/VisitExprs", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		Ref<MediumLevelILFunction> il = func->GetMediumLevelIL();
+		if (!il)
+			continue;
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+		{
+			il->GetInstruction(i).VisitExprs([&](const MediumLevelILInstruction& expr) {
+				DoNotOptimize(expr.operation);
+				counters.items++;
+				return true;
+			});
+		}
+	}
+});
+
+
+BENCHMARK("HighLevelIL/VisitExprs", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		Ref<HighLevelILFunction> il = func->GetHighLevelIL();
+		if (!il)
+			continue;
+		il->GetRootExpr().VisitExprs([&](const HighLevelILInstruction& expr) {
+			DoNotOptimize(expr.operation);
+			counters.items++;
+			return true;
+		});
+	}
+});
+
+
+BENCHMARK("MediumLevelIL/Operands", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		Ref<MediumLevelILFunction> il = func->GetMediumLevelIL();
+		if (!il)
+			continue;
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+		{
+			il->GetInstruction(i).VisitExprs([&](const MediumLevelILInstruction& expr) {
+				for (auto operand : expr.GetOperands())
+				{
+					DoNotOptimize(operand.GetType());
+					counters.items++;
+				}
+				return true;
+			});
+		}
+	}
+});
+
+
+BENCHMARK("BinaryView/GetAnalysisFunctionList", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	auto functions = context.view->GetAnalysisFunctionList();
+	counters.items += functions.size();
+});
+
+
+BENCHMARK("Function/GetBasicBlocks", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		for (auto& block : func->GetBasicBlocks())
+		{
+			DoNotOptimize(block->GetStart());
+			counters.items++;
+		}
+	}
+});
+
+
+BENCHMARK("BinaryView/GetSymbols", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& symbol : context.view->GetSymbols())
+	{
+		DoNotOptimize(symbol->GetAddress());
+		counters.items++;
+	}
+});
+
+
+// Symbols are resolved but only counted when added, so that the view is left unchanged
+static const size_t g_symbolQueueCount = 100000;
+
+static vector<string> GetSymbolQueueNames()
+{
+	vector<string> names;
+	names.reserve(g_symbolQueueCount);
+	for (size_t i = 0; i < g_symbolQueueCount; i++)
+		names.push_back(fmt::format("import_{}", i));
+	return names;
+}
+
+
+struct SymbolQueueTaskContext
+{
+	const vector<string>* names;
+	vector<uint64_t> added;
+};
+
+
+static pair<Ref<Symbol>, Ref<Type>> ResolveSymbolQueueTask(void* ctxt, uint64_t data)
+{
+	auto context = (SymbolQueueTaskContext*)ctxt;
+	return {new Symbol(ImportedFunctionSymbol, (*context->names)[data], 0x1000 + (data * 8)), nullptr};
+}
+
+
+static void AddSymbolQueueTask(void* ctxt, uint64_t data, Symbol*, Type*)
+{
+	((SymbolQueueTaskContext*)ctxt)->added.push_back(data);
+}
+
+
+BENCHMARK("SymbolQueue/Callbacks", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	static const vector<string> names = GetSymbolQueueNames();
+	SymbolQueue queue;
+	for (size_t i = 0; i < names.size(); i++)
+	{
+		queue.Append(
+			[&, i]() {
+				return pair<Ref<Symbol>, Ref<Type>>(
+					new Symbol(ImportedFunctionSymbol, names[i], 0x1000 + (i * 8)), nullptr);
+			},
+			[&](Symbol*, Type*) { counters.items++; });
+	}
+	queue.Process();
+});
+
+
+BENCHMARK("SymbolQueue/Tasks", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	static const vector<string> names = GetSymbolQueueNames();
+	SymbolQueueTaskContext taskContext {&names, {}};
+	SymbolQueue queue(context.view);
+	queue.ReserveTasks(names.size());
+	for (size_t i = 0; i < names.size(); i++)
+		queue.AppendTask(ResolveSymbolQueueTask, AddSymbolQueueTask, &taskContext, i);
+	queue.Process();
+	counters.items += taskContext.added.size();
+});
+
+
+VERIFY("SymbolQueue/TaskOrder", [](string& error) {
+	vector<string> names = GetSymbolQueueNames();
+	SymbolQueueTaskContext taskContext {&names, {}};
+	// A small batch size gives many batches, so that resolving overlaps with adding
+	SymbolQueue queue(nullptr, 8, 1000);
+	for (size_t i = 0; i < names.size(); i++)
+		queue.AppendTask(ResolveSymbolQueueTask, AddSymbolQueueTask, &taskContext, i);
+	queue.Process();
+	if (taskContext.added.size() != names.size())
+	{
+		error = fmt::format("{} of {} symbols were added", taskContext.added.size(), names.size());
+		return false;
+	}
+	for (size_t i = 0; i < taskContext.added.size(); i++)
+	{
+		if (taskContext.added[i] != i)
+		{
+			error = fmt::format("symbol {} was added at position {}", taskContext.added[i], i);
+			return false;
+		}
+	}
+	return true;
+});
+
+
+BENCHMARK("BinaryView/GetCodeReferences", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		counters.items += context.view->GetCodeReferences(func->GetStart()).size() + 1;
+	}
+});
+
+
+class WriteCounter : public BinaryDataNotification
+{
+  public:
+	uint64_t m_count = 0;
+
+	WriteCounter() : BinaryDataNotification(DataWritten) {}
+
+	virtual void OnBinaryDataWritten(BinaryView*, uint64_t, size_t) override { m_count++; }
+};
+
+
+BENCHMARK("BinaryView/NotificationDispatch", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	auto ranges = GetReadableRanges(context.view, 0x1000);
+	if (ranges.empty())
+		return;
+
+	// Rewriting identical bytes still dispatches a write notification without changing the view contents
+	uint64_t addr = ranges[0].first;
+	uint8_t value;
+	if (context.view->Read(&value, addr, 1) != 1)
+		return;
+
+	WriteCounter notification;
+	context.view->RegisterNotification(&notification);
+	for (size_t i = 0; i < 1000; i++)
+		context.view->Write(addr, &value, 1);
+	context.view->UnregisterNotification(&notification);
+	counters.items += notification.m_count;
+});
+
+
+BENCHMARK("Type/StructureMembers", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& type : context.view->GetTypes())
+	{
+		if (type.second->GetClass() != StructureTypeClass)
+			continue;
+		Ref<Structure> structure = type.second->GetStructure();
+		if (!structure)
+			continue;
+		for (auto& member : structure->GetMembers())
+		{
+			StructureMember result;
+			structure->GetMemberAtOffset(member.offset, result);
+			counters.items++;
+		}
+	}
+});
+
+
+// An error code style enumeration, large enough that finding a member by scanning is noticeable
+static Ref<Enumeration> GetLargeEnumeration()
+{
+	static Ref<Enumeration> enumeration = []() {
+		EnumerationBuilder builder;
+		for (uint64_t i = 0; i < 2000; i++)
+			builder.AddMemberWithValue("ERROR_" + to_string(i), 0xc0000000 + i * 3);
+		return builder.Finalize();
+	}();
+	return enumeration;
+}
+
+
+BENCHMARK("Type/EnumerationMemberScan", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Ref<Enumeration> enumeration = GetLargeEnumeration();
+	size_t found = 0;
+	for (uint64_t i = 0; i < 1000; i++)
+	{
+		for (auto& member : enumeration->GetMembers())
+		{
+			if (member.value == 0xc0000000 + i * 5)
+			{
+				found++;
+				break;
+			}
+		}
+		counters.items++;
+	}
+	DoNotOptimize(found);
+});
+
+
+BENCHMARK("Type/EnumerationIndexLookup", [](BenchmarkContext&, BenchmarkCounters& counters) {
+	Ref<Enumeration> enumeration = GetLargeEnumeration();
+	size_t found = 0;
+	for (uint64_t i = 0; i < 1000; i++)
+	{
+		Ref<EnumerationIndex> index = enumeration->GetIndex();
+		if (index->GetMemberForValue(0xc0000000 + i * 5))
+			found++;
+		counters.items++;
+	}
+	DoNotOptimize(found);
+});
+
+
+VERIFY("Type/EnumerationFlags", [](string& error) {
+	EnumerationBuilder builder;
+	builder.AddMemberWithValue("NONE", 0);
+	builder.AddMemberWithValue("READ", 1);
+	builder.AddMemberWithValue("WRITE", 2);
+	builder.AddMemberWithValue("EXECUTE", 4);
+	builder.AddMemberWithValue("READ_WRITE", 3);
+	Ref<Enumeration> enumeration = builder.Finalize();
+	Ref<EnumerationIndex> index = enumeration->GetIndex();
+	if (index != enumeration->GetIndex())
+	{
+		error = "index was rebuilt for the same enumeration";
+		return false;
+	}
+
+	vector<size_t> members;
+	auto names = [&]() {
+		string result;
+		for (size_t i : members)
+			result += (result.empty() ? "" : "|") + index->GetMembers()[i].name;
+		return result;
+	};
+	struct
+	{
+		uint64_t value;
+		bool complete;
+		const char* expected;
+	} cases[] = {{0, true, "NONE"}, {1, true, "READ"}, {3, true, "READ_WRITE"}, {7, true, "EXECUTE|READ_WRITE"},
+	    {5, true, "EXECUTE|READ"}, {8, false, ""}, {9, false, ""}};
+	for (auto& test : cases)
+	{
+		bool complete = index->DecomposeFlags(test.value, members);
+		if ((complete != test.complete) || (complete && (names() != test.expected)))
+		{
+			error = fmt::format("value {} decomposed as '{}' (complete {})", test.value, names(), complete);
+			return false;
+		}
+	}
+
+	const EnumerationMember* member = index->GetMemberForValue(2);
+	if (!member || (member->name != "WRITE") || index->GetMemberForValue(16))
+	{
+		error = "value lookup mismatch";
+		return false;
+	}
+	return true;
+});
+
+
+BENCHMARK("Architecture/Disassemble", [](BenchmarkContext& context, BenchmarkCounters& counters) {
+	for (auto& func : context.functions)
+	{
+		Ref<Architecture> arch = func->GetArchitecture();
+		size_t maxLen = arch->GetMaxInstructionLength();
+		vector<uint8_t> buffer(maxLen);
+		for (auto& block : func->GetBasicBlocks())
+		{
+			for (uint64_t addr = block->GetStart(); addr < block->GetEnd();)
+			{
+				size_t len = context.view->Read(buffer.data(), addr, maxLen);
+				InstructionInfo info;
+				if (!arch->GetInstructionInfo(buffer.data(), addr, len, info) || (info.length == 0))
+					break;
+				vector<InstructionTextToken> tokens;
+				arch->GetInstructionText(buffer.data(), addr, len, tokens);
+				addr += info.length;
+				counters.items++;
+				counters.bytes += info.length;
+			}
+		}
+	}
+});
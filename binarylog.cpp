@@ -0,0 +1,447 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#define _CRT_SECURE_NO_WARNINGS
+#include <cstdio>
+#include <cstring>
+#include "binaryninjaapi.h"
+#include "databufferkernels.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+// File layout: an 8 byte file header followed by chunks. Each chunk has a 24 byte header (magic, flags, stored size,
+// uncompressed size, record count, CRC32C of the uncompressed payload) followed by the stored payload. A payload is
+// a sequence of entries, each starting with a tag byte:
+//   logger:  varint id, varint length, name
+//   record:  u64 timestamp, varint session, u8 level, varint logger id, varint thread id, varint length, message
+// Logger entries precede the first record that uses them in every file, so each file can be read on its own.
+static const uint8_t g_binaryLogMagic[4] = {'B', 'N', 'L', 'G'};
+static const uint8_t g_binaryLogChunkMagic[4] = {'B', 'N', 'L', 'C'};
+static const uint32_t g_binaryLogVersion = 1;
+static const size_t g_binaryLogHeaderSize = 8;
+static const size_t g_binaryLogChunkHeaderSize = 24;
+static const uint32_t g_binaryLogChunkCompressed = 1;
+static const uint8_t g_binaryLogLoggerEntry = 0;
+static const uint8_t g_binaryLogRecordEntry = 1;
+// Chunks claiming to be larger than this, stored or uncompressed, are treated as corrupt. Writers flush well below
+// it, a chunk only exceeds the configured chunk size by its last record.
+static const uint32_t g_binaryLogMaxChunkSize = 256 * 1024 * 1024;
+
+
+static void WriteLE32(uint8_t* out, uint32_t value)
+{
+	for (size_t i = 0; i < 4; i++)
+		out[i] = (uint8_t)(value >> (i * 8));
+}
+
+
+static uint32_t ReadLE32(const uint8_t* in)
+{
+	uint32_t value = 0;
+	for (size_t i = 0; i < 4; i++)
+		value |= (uint32_t)in[i] << (i * 8);
+	return value;
+}
+
+
+// Number of bytes between the current position and the end of the file
+static bool GetRemainingLength(FILE* file, uint64_t& remaining)
+{
+#ifdef WIN32
+	int64_t pos = _ftelli64(file);
+	if ((pos < 0) || (_fseeki64(file, 0, SEEK_END) != 0))
+		return false;
+	int64_t end = _ftelli64(file);
+	if ((end < pos) || (_fseeki64(file, pos, SEEK_SET) != 0))
+		return false;
+#else
+	off_t pos = ftello(file);
+	if ((pos < 0) || (fseeko(file, 0, SEEK_END) != 0))
+		return false;
+	off_t end = ftello(file);
+	if ((end < pos) || (fseeko(file, pos, SEEK_SET) != 0))
+		return false;
+#endif
+	remaining = (uint64_t)(end - pos);
+	return true;
+}
+
+
+static void AppendVarInt(vector<uint8_t>& out, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		out.push_back((uint8_t)(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back((uint8_t)value);
+}
+
+
+static bool ReadVarInt(const vector<uint8_t>& in, size_t& offset, uint64_t& value)
+{
+	value = 0;
+	for (size_t shift = 0; shift < 64; shift += 7)
+	{
+		if (offset >= in.size())
+			return false;
+		uint8_t byte = in[offset++];
+		value |= (uint64_t)(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return true;
+	}
+	return false;
+}
+
+
+BinaryLogWriter::BinaryLogWriter(const string& path, uint64_t maxFileSize, size_t maxFiles, size_t chunkSize) :
+	m_path(path), m_maxFileSize(maxFileSize), m_maxFiles(maxFiles ? maxFiles : 1), m_chunkSize(chunkSize),
+	m_file(nullptr), m_fileSize(0), m_chunkRecords(0), m_writeError(false)
+{
+	m_chunk.reserve(m_chunkSize + 1024);
+
+	// Logs from a previous run are kept by rotating them out of the way
+	FILE* existing = fopen(m_path.c_str(), "rb");
+	if (existing)
+	{
+		fclose(existing);
+		Rotate();
+	}
+	else
+	{
+		OpenFile();
+	}
+}
+
+
+BinaryLogWriter::~BinaryLogWriter()
+{
+	Flush();
+	if (m_file)
+		fclose(m_file);
+}
+
+
+bool BinaryLogWriter::OpenFile()
+{
+	m_file = fopen(m_path.c_str(), "wb");
+	m_fileSize = 0;
+	m_loggersWritten.clear();
+	if (!m_file)
+		return false;
+
+	uint8_t header[g_binaryLogHeaderSize];
+	memcpy(header, g_binaryLogMagic, 4);
+	WriteLE32(&header[4], g_binaryLogVersion);
+	if (fwrite(header, 1, sizeof(header), m_file) != sizeof(header))
+	{
+		fclose(m_file);
+		m_file = nullptr;
+		return false;
+	}
+	m_fileSize = sizeof(header);
+	return true;
+}
+
+
+void BinaryLogWriter::Rotate()
+{
+	if (m_file)
+	{
+		fclose(m_file);
+		m_file = nullptr;
+	}
+
+	if (m_maxFiles <= 1)
+	{
+		remove(m_path.c_str());
+	}
+	else
+	{
+		remove((m_path + "." + to_string(m_maxFiles - 1)).c_str());
+		for (size_t i = m_maxFiles - 1; i > 1; i--)
+			rename((m_path + "." + to_string(i - 1)).c_str(), (m_path + "." + to_string(i)).c_str());
+		rename(m_path.c_str(), (m_path + ".1").c_str());
+	}
+	OpenFile();
+}
+
+
+bool BinaryLogWriter::WriteChunk()
+{
+	if (m_chunk.empty())
+		return true;
+	if (!m_file)
+	{
+		// The file could not be created; records are dropped rather than buffered without bound
+		m_chunk.clear();
+		m_chunkRecords = 0;
+		m_writeError = true;
+		return false;
+	}
+
+	DataBuffer payload(m_chunk.data(), m_chunk.size());
+	DataBuffer compressed;
+	uint32_t flags = 0;
+	const DataBuffer* stored = &payload;
+	if (payload.ZlibCompress(compressed) && (compressed.GetLength() < payload.GetLength()))
+	{
+		flags |= g_binaryLogChunkCompressed;
+		stored = &compressed;
+	}
+
+	uint8_t header[g_binaryLogChunkHeaderSize];
+	memcpy(header, g_binaryLogChunkMagic, 4);
+	WriteLE32(&header[4], flags);
+	WriteLE32(&header[8], (uint32_t)stored->GetLength());
+	WriteLE32(&header[12], (uint32_t)m_chunk.size());
+	WriteLE32(&header[16], m_chunkRecords);
+	WriteLE32(&header[20], DataBufferKernels::Crc32c(m_chunk.data(), m_chunk.size()));
+	bool ok = (fwrite(header, 1, sizeof(header), m_file) == sizeof(header)) &&
+		(fwrite(stored->GetData(), 1, stored->GetLength(), m_file) == stored->GetLength());
+	m_fileSize += sizeof(header) + stored->GetLength();
+
+	m_chunk.clear();
+	m_chunkRecords = 0;
+	if (!ok)
+	{
+		// A partially written chunk ends the file for readers, so continue in a new one
+		m_writeError = true;
+		Rotate();
+		return false;
+	}
+	if (m_fileSize >= m_maxFileSize)
+		Rotate();
+	return true;
+}
+
+
+void BinaryLogWriter::LogBatch(const vector<LogRecord>& records)
+{
+	for (auto& record : records)
+	{
+		if ((record.loggerId >= m_loggersWritten.size()) || !m_loggersWritten[record.loggerId])
+		{
+			if (record.loggerId >= m_loggersWritten.size())
+				m_loggersWritten.resize(record.loggerId + 1, false);
+			m_loggersWritten[record.loggerId] = true;
+			string name = GetLoggerName(record.loggerId);
+			m_chunk.push_back(g_binaryLogLoggerEntry);
+			AppendVarInt(m_chunk, record.loggerId);
+			AppendVarInt(m_chunk, name.size());
+			m_chunk.insert(m_chunk.end(), name.begin(), name.end());
+		}
+
+		m_chunk.push_back(g_binaryLogRecordEntry);
+		for (size_t i = 0; i < 8; i++)
+			m_chunk.push_back((uint8_t)(record.timestamp >> (i * 8)));
+		AppendVarInt(m_chunk, record.session);
+		m_chunk.push_back((uint8_t)record.level);
+		AppendVarInt(m_chunk, record.loggerId);
+		AppendVarInt(m_chunk, record.threadId);
+		AppendVarInt(m_chunk, record.message.size());
+		m_chunk.insert(m_chunk.end(), record.message.begin(), record.message.end());
+		m_chunkRecords++;
+
+		if (m_chunk.size() >= m_chunkSize)
+			WriteChunk();
+	}
+}
+
+
+void BinaryLogWriter::Flush()
+{
+	WriteChunk();
+	if (m_file && (fflush(m_file) != 0))
+		m_writeError = true;
+}
+
+
+BinaryLogReader::BinaryLogReader() : m_file(nullptr), m_offset(0), m_corrupt(false) {}
+
+
+BinaryLogReader::~BinaryLogReader()
+{
+	Close();
+}
+
+
+bool BinaryLogReader::Open(const string& path)
+{
+	Close();
+	m_file = fopen(path.c_str(), "rb");
+	if (!m_file)
+		return false;
+
+	uint8_t header[g_binaryLogHeaderSize];
+	if ((fread(header, 1, sizeof(header), m_file) != sizeof(header)) || (memcmp(header, g_binaryLogMagic, 4) != 0) ||
+		(ReadLE32(&header[4]) != g_binaryLogVersion))
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+
+void BinaryLogReader::Close()
+{
+	if (m_file)
+	{
+		fclose(m_file);
+		m_file = nullptr;
+	}
+	m_chunk.clear();
+	m_offset = 0;
+	m_corrupt = false;
+	m_loggerNames.clear();
+}
+
+
+bool BinaryLogReader::ReadChunk()
+{
+	m_chunk.clear();
+	m_offset = 0;
+	if (!m_file)
+		return false;
+
+	uint8_t header[g_binaryLogChunkHeaderSize];
+	size_t headerRead = fread(header, 1, sizeof(header), m_file);
+	if (headerRead == 0)
+		return false;
+	if ((headerRead != sizeof(header)) || (memcmp(header, g_binaryLogChunkMagic, 4) != 0))
+	{
+		m_corrupt = true;
+		return false;
+	}
+
+	uint32_t flags = ReadLE32(&header[4]);
+	uint32_t storedSize = ReadLE32(&header[8]);
+	uint32_t size = ReadLE32(&header[12]);
+	uint32_t crc = ReadLE32(&header[20]);
+
+	// Check the sizes before allocating anything, so a corrupt header cannot force a huge allocation
+	uint64_t remaining;
+	if ((storedSize > g_binaryLogMaxChunkSize) || (size > g_binaryLogMaxChunkSize) ||
+		!GetRemainingLength(m_file, remaining) || (storedSize > remaining) ||
+		(!(flags & g_binaryLogChunkCompressed) && (storedSize != size)))
+	{
+		m_corrupt = true;
+		return false;
+	}
+
+	DataBuffer stored(storedSize);
+	if (fread(stored.GetData(), 1, storedSize, m_file) != storedSize)
+	{
+		m_corrupt = true;
+		return false;
+	}
+
+	const DataBuffer* payload = &stored;
+	DataBuffer decompressed;
+	if (flags & g_binaryLogChunkCompressed)
+	{
+		if (!stored.ZlibDecompress(decompressed))
+		{
+			m_corrupt = true;
+			return false;
+		}
+		payload = &decompressed;
+	}
+
+	if ((payload->GetLength() != size) ||
+		(DataBufferKernels::Crc32c((const uint8_t*)payload->GetData(), size) != crc))
+	{
+		m_corrupt = true;
+		return false;
+	}
+
+	const uint8_t* data = (const uint8_t*)payload->GetData();
+	m_chunk.assign(data, data + size);
+	return true;
+}
+
+
+bool BinaryLogReader::Next(LogRecord& record)
+{
+	while (true)
+	{
+		if (m_offset >= m_chunk.size())
+		{
+			if (!ReadChunk())
+				return false;
+			continue;
+		}
+
+		uint8_t tag = m_chunk[m_offset++];
+		uint64_t id, session, level, tid, length;
+		if (tag == g_binaryLogLoggerEntry)
+		{
+			if (!ReadVarInt(m_chunk, m_offset, id) || !ReadVarInt(m_chunk, m_offset, length) ||
+				(id > 0xffffffff) || (length > (m_chunk.size() - m_offset)))
+				break;
+			if (id >= m_loggerNames.size())
+				m_loggerNames.resize((size_t)id + 1);
+			m_loggerNames[(size_t)id].assign((const char*)&m_chunk[m_offset], (size_t)length);
+			m_offset += (size_t)length;
+			continue;
+		}
+		if (tag != g_binaryLogRecordEntry)
+			break;
+
+		if ((m_chunk.size() - m_offset) < 8)
+			break;
+		uint64_t timestamp = 0;
+		for (size_t i = 0; i < 8; i++)
+			timestamp |= (uint64_t)m_chunk[m_offset + i] << (i * 8);
+		m_offset += 8;
+		if (!ReadVarInt(m_chunk, m_offset, session) || (m_offset >= m_chunk.size()))
+			break;
+		level = m_chunk[m_offset++];
+		if (!ReadVarInt(m_chunk, m_offset, id) || !ReadVarInt(m_chunk, m_offset, tid) ||
+			!ReadVarInt(m_chunk, m_offset, length) || (id > 0xffffffff) || (length > (m_chunk.size() - m_offset)))
+			break;
+
+		record.timestamp = timestamp;
+		record.session = (size_t)session;
+		record.level = (BNLogLevel)level;
+		record.loggerId = (uint32_t)id;
+		record.threadId = (size_t)tid;
+		record.message = string_view((const char*)&m_chunk[m_offset], (size_t)length);
+		m_offset += (size_t)length;
+		return true;
+	}
+
+	m_corrupt = true;
+	m_chunk.clear();
+	m_offset = 0;
+	return false;
+}
+
+
+string BinaryLogReader::GetLoggerName(uint32_t loggerId) const
+{
+	if (loggerId >= m_loggerNames.size())
+		return "";
+	return m_loggerNames[loggerId];
+}
@@ -20,6 +20,7 @@
 
 #include "binaryninjaapi.h"
 #include <numeric>
+#include <thread>
 
 using namespace BinaryNinja;
 using namespace std;
@@ -183,7 +184,7 @@ bool BinaryNinja::ExecuteWorkerProcess(const string& path, const vector<string>&
 	char* outputStr;
 	char* errorStr;
 	bool result = BNExecuteWorkerProcess(
-	    path.c_str(), argArray, input.GetBufferObject(), &outputStr, &errorStr, stdoutIsText, stderrIsText);
+	    path.c_str(), argArray, DataBuffer::ScopedObject(input), &outputStr, &errorStr, stdoutIsText, stderrIsText);
 
 	output = outputStr;
 	errors = errorStr;
@@ -361,6 +362,55 @@ void BinaryNinja::SetWorkerThreadCount(size_t count)
 }
 
 
+void BinaryNinja::ParallelFor(size_t count, const function<void(size_t)>& action, size_t threadCount)
+{
+	if (count == 0)
+		return;
+	if (threadCount == 0)
+		threadCount = GetWorkerThreadCount();
+	if (threadCount == 0)
+		threadCount = 1;
+	threadCount = std::min(threadCount, count);
+
+	atomic<size_t> next(0);
+	atomic<bool> failed(false);
+	exception_ptr error;
+	mutex errorMutex;
+
+	auto worker = [&]() {
+		while (!failed)
+		{
+			size_t i = next.fetch_add(1);
+			if (i >= count)
+				break;
+			try
+			{
+				action(i);
+			}
+			catch (...)
+			{
+				lock_guard<mutex> lock(errorMutex);
+				if (!error)
+					error = current_exception();
+				failed = true;
+			}
+		}
+	};
+
+	// The calling thread participates so that a thread count of one runs inline
+	vector<thread> threads;
+	threads.reserve(threadCount - 1);
+	for (size_t i = 1; i < threadCount; i++)
+		threads.emplace_back(worker);
+	worker();
+	for (auto& t : threads)
+		t.join();
+
+	if (error)
+		rethrow_exception(error);
+}
+
+
 string BinaryNinja::GetUniqueIdentifierString()
 {
 	char* str = BNGetUniqueIdentifierString();
@@ -34,7 +34,9 @@
 #include <exception>
 #include <functional>
 #include <set>
+#include <list>
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
 #include <memory>
 #include <cstdint>
@@ -42,8 +44,12 @@
 #include <type_traits>
 #include <variant>
 #include <optional>
+#include <string_view>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include "binaryninjacore.h"
+#include "apiprofile.h"
 #include "exceptions.h"
 #include "json/json.h"
 #include <fmt/format.h>
@@ -141,7 +147,7 @@ namespace BinaryNinja {
 		std::atomic<int> m_refs;
 		bool m_registeredRef = false;
 		T* m_object;
-		CoreRefCountObject() : m_refs(0), m_object(nullptr) {}
+		CoreRefCountObject() : m_refs(0), m_object(nullptr) { BN_API_PROFILE_ALLOCATION(T); }
 		virtual ~CoreRefCountObject() {}
 
 		T* GetObject() const { return m_object; }
@@ -162,9 +168,13 @@ namespace BinaryNinja {
 			return obj->GetObject();
 		}
 
+		// Unregistered objects hold a single core reference, taken over from the handle they were constructed
+		// with, for as long as any Ref exists. Copies between the first and last Ref only touch the local count,
+		// so passing Ref<T> around does not cross into the core. Registered objects can have references held
+		// through callbacks and keep one core reference per Ref.
 		void AddRef()
 		{
-			if (m_object && (m_refs != 0))
+			if (m_registeredRef && m_object && (m_refs != 0))
 				AddObjectReference(m_object);
 			AddRefInternal();
 		}
@@ -172,12 +182,34 @@ namespace BinaryNinja {
 		void Release()
 		{
 			T* obj = m_object;
-			ReleaseInternal();
-			if (obj)
-				FreeObjectReference(obj);
+			if (m_registeredRef)
+			{
+				ReleaseInternal();
+				if (obj)
+					FreeObjectReference(obj);
+				return;
+			}
+
+			if (m_refs.fetch_sub(1) == 1)
+			{
+				delete this;
+				if (obj)
+					FreeObjectReference(obj);
+			}
 		}
 
-		void AddRefForRegistration() { m_registeredRef = true; }
+		void AddRefForRegistration()
+		{
+			if (m_registeredRef)
+				return;
+			// Switch existing references over to one core reference each
+			if (m_object)
+			{
+				for (int i = 1; i < m_refs; i++)
+					AddObjectReference(m_object);
+			}
+			m_registeredRef = true;
+		}
 
 		void ReleaseForRegistration()
 		{
@@ -208,7 +240,7 @@ namespace BinaryNinja {
 	  public:
 		std::atomic<int> m_refs;
 		T* m_object;
-		StaticCoreRefCountObject() : m_refs(0), m_object(nullptr) {}
+		StaticCoreRefCountObject() : m_refs(0), m_object(nullptr) { BN_API_PROFILE_ALLOCATION(T); }
 		virtual ~StaticCoreRefCountObject() {}
 
 		T* GetObject() const { return m_object; }
@@ -381,6 +413,56 @@ namespace BinaryNinja {
 		T* GetPtr() const { return m_obj; }
 	};
 
+	/*! BorrowedRef is a non-owning view of an object kept alive by a Ref held elsewhere. Constructing, copying and
+	    destroying it does not touch the reference count, which makes it suitable for parameters and loop variables
+	    in hot paths. Convert it to a Ref (or call ToRef) to keep the object beyond the lifetime of the owner.
+
+		\code{.cpp}
+		for (BorrowedRef<Function> func : view->GetAnalysisFunctionList())
+			total += func->GetBasicBlocks().size();
+		\endcode
+
+	    \ingroup refcount
+	*/
+	template <class T>
+	class BorrowedRef
+	{
+		T* m_obj;
+
+	  public:
+		BorrowedRef() : m_obj(nullptr) {}
+		BorrowedRef(std::nullptr_t) : m_obj(nullptr) {}
+		BorrowedRef(const Ref<T>& obj) : m_obj(obj.GetPtr()) {}
+		BorrowedRef(const CallbackRef<T>& obj) : m_obj(obj.GetPtr()) {}
+
+		// Raw pointers are only borrowed when explicitly asked for, as a newly allocated object would otherwise leak
+		explicit BorrowedRef(T* obj) : m_obj(obj) {}
+
+		template <class U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+		BorrowedRef(const Ref<U>& obj) : m_obj(obj.GetPtr())
+		{}
+
+		Ref<T> ToRef() const { return Ref<T>(m_obj); }
+
+		operator T*() const { return m_obj; }
+		T* operator->() const { return m_obj; }
+		T& operator*() const { return *m_obj; }
+		bool operator!() const { return m_obj == nullptr; }
+		bool operator==(const T* obj) const { return T::GetObject(m_obj) == T::GetObject(obj); }
+		bool operator==(const Ref<T>& obj) const { return T::GetObject(m_obj) == T::GetObject(obj.GetPtr()); }
+		bool operator!=(const T* obj) const { return T::GetObject(m_obj) != T::GetObject(obj); }
+		bool operator!=(const Ref<T>& obj) const { return T::GetObject(m_obj) != T::GetObject(obj.GetPtr()); }
+		bool operator<(const T* obj) const { return T::GetObject(m_obj) < T::GetObject(obj); }
+		bool operator<(const Ref<T>& obj) const { return T::GetObject(m_obj) < T::GetObject(obj.GetPtr()); }
+		T* GetPtr() const { return m_obj; }
+	};
+
+	/*! Alias of BorrowedRef
+	    \ingroup refcount
+	*/
+	template <class T>
+	using RefView = BorrowedRef<T>;
+
 	/*!
 		\ingroup confidence
 	*/
@@ -827,6 +909,58 @@ namespace BinaryNinja {
 	*/
 	void CloseLogs();
 
+	/*! Set the minimum level of messages logged through this API. Messages below it are discarded before they are
+		formatted, so disabled log calls cost only a level check. The default of DebugLog passes everything on to the
+		core, which applies the levels of its own listeners.
+
+		@threadsafe
+
+		\ingroup logging
+
+		\param level Minimum level to log
+	*/
+	void SetMinimumLogLevel(BNLogLevel level);
+
+	/*! Get the minimum level of messages logged through this API
+
+		@threadsafe
+
+		\ingroup logging
+	*/
+	BNLogLevel GetMinimumLogLevel();
+
+	/*! Deliver log messages from a background thread instead of the thread that logged them.
+
+		Messages are formatted into a per-thread ring buffer and handed to the core in batches. Errors and alerts
+		are still delivered immediately, after any messages the same thread queued before them. If a thread fills
+		its buffer it delivers its queued messages itself, so messages are never dropped.
+
+		@threadsafe
+
+		\ingroup logging
+
+		\param bufferSize Size in bytes of each thread's ring buffer
+	*/
+	void EnableAsyncLogging(size_t bufferSize = 1 << 20);
+
+	/*! Deliver all queued messages and return to logging from the calling thread
+
+		\note Call this before BNShutdown when asynchronous logging is enabled.
+
+		@threadsafe
+
+		\ingroup logging
+	*/
+	void DisableAsyncLogging();
+
+	/*! Deliver all queued messages and flush registered log sinks before returning
+
+		@threadsafe
+
+		\ingroup logging
+	*/
+	void FlushLogs();
+
 	class FileMetadata;
 	class BinaryView;
 	/*! Logger is a class allowing scoped logging to the console
@@ -839,6 +973,14 @@ namespace BinaryNinja {
 			std::unordered_map<BNLogLevel, std::string> m_iterBuffer;
 			friend struct Iterator;
 
+			std::string m_name;
+			size_t m_sessionId;
+			uint32_t m_loggerId;
+			// Minimum level for this logger in the low byte, and the configuration generation it was read at above it
+			std::atomic<uint64_t> m_levelCache;
+
+			void Init();
+
 			void LogFV(BNLogLevel level, fmt::string_view format, fmt::format_args args);
 			void LogTraceFV(fmt::string_view format, fmt::format_args args);
 			void LogDebugFV(fmt::string_view format, fmt::format_args args);
@@ -1053,8 +1195,101 @@ namespace BinaryNinja {
 				\return The logger session ID
 			*/
 			size_t GetSessionId();
+
+			/*! Set the minimum level of messages logged by every logger with this name. Messages below it are
+				discarded before they are formatted.
+
+					@threadsafe
+
+				\param level Minimum level to log
+			*/
+			void SetMinimumLevel(BNLogLevel level);
+
+			/*! Get the minimum level of messages logged by this logger, which is the level set with SetMinimumLevel
+				or the global level from SetMinimumLogLevel if none was set.
+
+					@threadsafe
+			*/
+			BNLogLevel GetMinimumLevel();
+
+			/*! Check whether messages at the given level would be logged. The answer is cached and refreshed when
+				log levels change or LogListener::UpdateLogListeners is called.
+
+					@threadsafe
+			*/
+			bool IsEnabled(BNLogLevel level);
 	};
 
+	/*! \name Compile time log filtering
+
+		The BN_LOG_* macros log through a Logger and BN_GLOBAL_LOG_* through the global log functions, using fmt-style
+		format strings. Calls below BN_LOG_MIN_LEVEL are removed at compile time, arguments included. The default
+		keeps trace messages in debug builds only, matching LogTrace.
+
+		\code{.cpp}
+		#define BN_LOG_MIN_LEVEL BN_LOG_LEVEL_INFO
+		#include "binaryninjaapi.h"
+
+		BN_LOG_DEBUG(logger, "visited {} blocks", count); // compiled out
+		\endcode
+
+		\ingroup logging
+	*/
+	//! @{
+#define BN_LOG_LEVEL_TRACE 0
+#define BN_LOG_LEVEL_DEBUG 1
+#define BN_LOG_LEVEL_INFO 2
+#define BN_LOG_LEVEL_WARN 3
+#define BN_LOG_LEVEL_ERROR 4
+#define BN_LOG_LEVEL_ALERT 5
+
+#ifndef BN_LOG_MIN_LEVEL
+	#ifdef _DEBUG
+		#define BN_LOG_MIN_LEVEL BN_LOG_LEVEL_TRACE
+	#else
+		#define BN_LOG_MIN_LEVEL BN_LOG_LEVEL_DEBUG
+	#endif
+#endif
+
+#if BN_LOG_MIN_LEVEL <= BN_LOG_LEVEL_TRACE
+	#define BN_LOG_TRACE(logger, ...) (logger)->LogTraceF(__VA_ARGS__)
+	#define BN_GLOBAL_LOG_TRACE(...) ::BinaryNinja::LogTraceF(__VA_ARGS__)
+#else
+	#define BN_LOG_TRACE(logger, ...) ((void)0)
+	#define BN_GLOBAL_LOG_TRACE(...) ((void)0)
+#endif
+#if BN_LOG_MIN_LEVEL <= BN_LOG_LEVEL_DEBUG
+	#define BN_LOG_DEBUG(logger, ...) (logger)->LogDebugF(__VA_ARGS__)
+	#define BN_GLOBAL_LOG_DEBUG(...) ::BinaryNinja::LogDebugF(__VA_ARGS__)
+#else
+	#define BN_LOG_DEBUG(logger, ...) ((void)0)
+	#define BN_GLOBAL_LOG_DEBUG(...) ((void)0)
+#endif
+#if BN_LOG_MIN_LEVEL <= BN_LOG_LEVEL_INFO
+	#define BN_LOG_INFO(logger, ...) (logger)->LogInfoF(__VA_ARGS__)
+	#define BN_GLOBAL_LOG_INFO(...) ::BinaryNinja::LogInfoF(__VA_ARGS__)
+#else
+	#define BN_LOG_INFO(logger, ...) ((void)0)
+	#define BN_GLOBAL_LOG_INFO(...) ((void)0)
+#endif
+#if BN_LOG_MIN_LEVEL <= BN_LOG_LEVEL_WARN
+	#define BN_LOG_WARN(logger, ...) (logger)->LogWarnF(__VA_ARGS__)
+	#define BN_GLOBAL_LOG_WARN(...) ::BinaryNinja::LogWarnF(__VA_ARGS__)
+#else
+	#define BN_LOG_WARN(logger, ...) ((void)0)
+	#define BN_GLOBAL_LOG_WARN(...) ((void)0)
+#endif
+#if BN_LOG_MIN_LEVEL <= BN_LOG_LEVEL_ERROR
+	#define BN_LOG_ERROR(logger, ...) (logger)->LogErrorF(__VA_ARGS__)
+	#define BN_GLOBAL_LOG_ERROR(...) ::BinaryNinja::LogErrorF(__VA_ARGS__)
+#else
+	#define BN_LOG_ERROR(logger, ...) ((void)0)
+	#define BN_GLOBAL_LOG_ERROR(...) ((void)0)
+#endif
+#define BN_LOG_ALERT(logger, ...) (logger)->LogAlertF(__VA_ARGS__)
+#define BN_GLOBAL_LOG_ALERT(...) ::BinaryNinja::LogAlertF(__VA_ARGS__)
+	//! @}
+
 	/*! A class allowing registering and retrieving Loggers
 
 		\see BinaryView::CreateLogger
@@ -1113,6 +1348,181 @@ namespace BinaryNinja {
 		static std::vector<std::string> GetLoggerNames();
 	};
 
+	/*! A single log message as delivered to a LogSink
+
+		\ingroup logging
+	*/
+	struct LogRecord
+	{
+		//! Time the message was logged, in nanoseconds since the Unix epoch
+		uint64_t timestamp;
+		size_t session;
+		BNLogLevel level;
+		//! Interned logger name, see LogSink::GetLoggerName
+		uint32_t loggerId;
+		size_t threadId;
+		//! Message text, only valid for the duration of the call it is passed to
+		std::string_view message;
+	};
+
+	/*! LogSink receives log messages as batches of structured records instead of one formatted string at a time.
+
+		Registering a sink also registers a listener with the core, so messages logged by the core and other modules
+		are delivered alongside those logged through this API. With asynchronous logging enabled (see
+		EnableAsyncLogging) records are queued by the logging thread and delivered from the background thread;
+		otherwise each message is delivered as a batch of one from the thread that logged it.
+
+		Calls into registered sinks are serialized, so implementations do not need to be thread safe.
+
+		\ingroup logging
+	*/
+	class LogSink
+	{
+		BNLogLevel m_minimumLevel;
+		// Per logger minimum levels, indexed by logger id. -1 when the sink's minimum level applies.
+		std::vector<int> m_loggerLevels;
+		std::vector<LogRecord> m_filtered;
+
+	  public:
+		LogSink();
+		virtual ~LogSink() {}
+
+		/*! Start delivering messages to a sink. The sink must stay alive until it is unregistered.
+
+			@threadsafe
+		*/
+		static void RegisterLogSink(LogSink* sink);
+
+		/*! Stop delivering messages to a sink. Queued messages are delivered and the sink is flushed first.
+
+			@threadsafe
+		*/
+		static void UnregisterLogSink(LogSink* sink);
+
+		/*! Get the name of an interned logger id. The global logger has an empty name.
+
+			@threadsafe
+		*/
+		static std::string GetLoggerName(uint32_t loggerId);
+
+		/*! Get the interned id of a logger name
+
+			@threadsafe
+		*/
+		static uint32_t GetLoggerId(const std::string& loggerName);
+
+		/*! Set the minimum level of messages delivered to this sink, for loggers without their own level
+
+			\note Levels should be configured before the sink is registered.
+		*/
+		void SetMinimumLevel(BNLogLevel level);
+		BNLogLevel GetMinimumLevel() const { return m_minimumLevel; }
+
+		/*! Set the minimum level of messages from one logger delivered to this sink
+
+			\note Levels should be configured before the sink is registered.
+		*/
+		void SetLoggerLevel(const std::string& loggerName, BNLogLevel level);
+		bool IsEnabled(uint32_t loggerId, BNLogLevel level) const;
+
+		/*! Lowest level delivered to this sink for any logger */
+		BNLogLevel GetLowestLevel() const;
+
+		/*! Filter a batch by this sink's levels and pass what remains to LogBatch. Called by the logging system. */
+		void Deliver(const std::vector<LogRecord>& records);
+
+		virtual void LogBatch(const std::vector<LogRecord>& records) = 0;
+		virtual void Flush() {}
+	};
+
+	/*! Log sink writing records to a compact binary file, compressed in chunks and rotated by size.
+
+		When the current file exceeds \c maxFileSize it is renamed to \c path.1, older files shift up by one and
+		files beyond \c maxFiles are deleted. Every file is self contained and can be read with BinaryLogReader.
+
+		\note Unregister the writer with LogSink::UnregisterLogSink before destroying it.
+
+		\ingroup logging
+	*/
+	class BinaryLogWriter : public LogSink
+	{
+		std::string m_path;
+		uint64_t m_maxFileSize;
+		size_t m_maxFiles;
+		size_t m_chunkSize;
+		FILE* m_file;
+		uint64_t m_fileSize;
+		std::vector<uint8_t> m_chunk;
+		uint32_t m_chunkRecords;
+		// Logger ids whose names have been written to the current file
+		std::vector<bool> m_loggersWritten;
+		bool m_writeError;
+
+		bool OpenFile();
+		bool WriteChunk();
+		void Rotate();
+
+	  public:
+		BinaryLogWriter(const std::string& path, uint64_t maxFileSize = 64 * 1024 * 1024, size_t maxFiles = 8,
+			size_t chunkSize = 1024 * 1024);
+		virtual ~BinaryLogWriter();
+
+		bool IsOpen() const { return m_file != nullptr; }
+
+		/*! Whether any records have been lost because a write failed or the file could not be created. A failed
+			write ends the current file and logging continues in a new one.
+		*/
+		bool HasWriteError() const { return m_writeError; }
+
+		virtual void LogBatch(const std::vector<LogRecord>& records) override;
+		virtual void Flush() override;
+	};
+
+	/*! Reads files written by BinaryLogWriter
+
+		\code{.cpp}
+		BinaryLogReader reader;
+		if (reader.Open("analysis.bnlog"))
+		{
+			LogRecord record;
+			while (reader.Next(record))
+				printf("%s: %.*s\n", reader.GetLoggerName(record.loggerId).c_str(),
+					(int)record.message.size(), record.message.data());
+		}
+		\endcode
+
+		\ingroup logging
+	*/
+	class BinaryLogReader
+	{
+		FILE* m_file;
+		std::vector<uint8_t> m_chunk;
+		size_t m_offset;
+		bool m_corrupt;
+		std::vector<std::string> m_loggerNames;
+
+		bool ReadChunk();
+
+	  public:
+		BinaryLogReader();
+		~BinaryLogReader();
+		BinaryLogReader(const BinaryLogReader&) = delete;
+		BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+
+		bool Open(const std::string& path);
+		void Close();
+
+		/*! Read the next record. The message stays valid until the next call.
+
+			\return false at the end of the file, or if the file is truncated or corrupt (see IsCorrupt)
+		*/
+		bool Next(LogRecord& record);
+
+		/*! Name of a logger id used by this file's records */
+		std::string GetLoggerName(uint32_t loggerId) const;
+		bool IsCorrupt() const { return m_corrupt; }
+	};
+
 	/*!
 		@addtogroup coreapi
 	 	@{
@@ -1217,9 +1627,164 @@ namespace BinaryNinja {
 		@}
 	*/
 
+	/*! A non-owning view of a contiguous range of elements, used by APIs that fill caller provided
+		storage or expose contiguous data without copying it
+
+		\ingroup databuffer
+	*/
+	template <class T>
+	class Span
+	{
+		T* m_data;
+		size_t m_size;
+
+	  public:
+		Span() : m_data(nullptr), m_size(0) {}
+		Span(T* data, size_t size) : m_data(data), m_size(size) {}
+
+		template <size_t N>
+		Span(T (&data)[N]) : m_data(data), m_size(N)
+		{}
+
+		template <class Container,
+		    typename = typename std::enable_if<
+		        std::is_convertible<decltype(std::declval<Container&>().data()), T*>::value>::type>
+		Span(Container& container) : m_data(container.data()), m_size(container.size())
+		{}
+
+		T* data() const { return m_data; }
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		T* begin() const { return m_data; }
+		T* end() const { return m_data + m_size; }
+		T& operator[](size_t i) const { return m_data[i]; }
+
+		Span<T> subspan(size_t offset, size_t count = (size_t)-1) const
+		{
+			if (offset > m_size)
+				offset = m_size;
+			if (count > (m_size - offset))
+				count = m_size - offset;
+			return Span<T>(m_data + offset, count);
+		}
+	};
+
 	class Metadata;
 	typedef BNMetadataType MetadataType;
 
+	/*! Element types of typed array metadata
+
+		\see Metadata::CreateArray
+		\ingroup binaryview
+	*/
+	enum MetadataArrayElementType : uint8_t
+	{
+		UInt8MetadataArray = 0,
+		UInt32MetadataArray = 1,
+		UInt64MetadataArray = 2,
+		Int64MetadataArray = 3,
+		FloatMetadataArray = 4,
+		DoubleMetadataArray = 5
+	};
+
+	template <typename T>
+	struct MetadataArrayTraits;
+
+	template <>
+	struct MetadataArrayTraits<uint8_t>
+	{
+		static constexpr MetadataArrayElementType ElementType = UInt8MetadataArray;
+	};
+
+	template <>
+	struct MetadataArrayTraits<uint32_t>
+	{
+		static constexpr MetadataArrayElementType ElementType = UInt32MetadataArray;
+	};
+
+	template <>
+	struct MetadataArrayTraits<uint64_t>
+	{
+		static constexpr MetadataArrayElementType ElementType = UInt64MetadataArray;
+	};
+
+	template <>
+	struct MetadataArrayTraits<int64_t>
+	{
+		static constexpr MetadataArrayElementType ElementType = Int64MetadataArray;
+	};
+
+	template <>
+	struct MetadataArrayTraits<float>
+	{
+		static constexpr MetadataArrayElementType ElementType = FloatMetadataArray;
+	};
+
+	template <>
+	struct MetadataArrayTraits<double>
+	{
+		static constexpr MetadataArrayElementType ElementType = DoubleMetadataArray;
+	};
+
+	/*! Contents of a typed array read from Metadata
+
+		Holds the single buffer the core returns and exposes the elements inside it directly. Arrays written on a
+		host of the other byte order are converted once when read.
+
+		\ingroup binaryview
+	*/
+	template <typename T>
+	class MetadataArray
+	{
+		friend class Metadata;
+
+		std::unique_ptr<uint8_t, void (*)(uint8_t*)> m_raw;
+		std::vector<T> m_converted;
+		const T* m_data;
+		size_t m_size;
+
+	  public:
+		MetadataArray() : m_raw(nullptr, BNFreeMetadataRaw), m_data(nullptr), m_size(0) {}
+
+		Span<const T> GetSpan() const { return Span<const T>(m_data, m_size); }
+		const T* data() const { return m_data; }
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		const T* begin() const { return m_data; }
+		const T* end() const { return m_data + m_size; }
+		const T& operator[](size_t i) const { return m_data[i]; }
+	};
+
+	/*! Builds typed array metadata from elements appended in bulk, without an intermediate copy
+
+		\code{.cpp}
+		MetadataArrayBuilder<float> features;
+		features.Reserve(count);
+		for (auto& block : func->GetBasicBlocks())
+			features.Append(GetBlockFeatures(block));
+		bv->StoreMetadata("features", features.Finish());
+		\endcode
+
+		\ingroup binaryview
+	*/
+	template <typename T>
+	class MetadataArrayBuilder
+	{
+		// Serialized form: array header followed by the elements
+		std::vector<uint8_t> m_buffer;
+
+	  public:
+		MetadataArrayBuilder();
+
+		void Reserve(size_t count);
+		void Append(const T& value);
+		void Append(Span<const T> values);
+		size_t GetCount() const;
+
+		/*! Create the metadata object. The builder is left empty. */
+		Ref<Metadata> Finish();
+	};
+
 	/*!
 	    \ingroup binaryview
 	*/
@@ -1365,6 +1930,81 @@ namespace BinaryNinja {
 		std::vector<Ref<Metadata>> GetArray() const;
 		std::map<std::string, Ref<Metadata>> GetKeyValueStore() const;
 
+		/*! Create typed array metadata holding contiguous elements
+
+			Typed arrays are stored as RawDataType metadata with a small header, so they persist as a single blob
+			and remain readable with GetRaw by code that does not know about them.
+
+			@threadsafe
+
+			\param data Elements to store
+			\return The new metadata object
+		*/
+		template <typename T>
+		static Ref<Metadata> CreateArray(Span<const T> data)
+		{
+			return CreateArray(MetadataArrayTraits<T>::ElementType, data.data(), data.size());
+		}
+
+		template <typename T>
+		static Ref<Metadata> CreateArray(const std::vector<T>& data)
+		{
+			return CreateArray(MetadataArrayTraits<T>::ElementType, data.data(), data.size());
+		}
+
+		static Ref<Metadata> CreateArray(MetadataArrayElementType type, const void* data, size_t count);
+
+		/*! Create typed array metadata from a buffer holding the array header followed by the elements. The
+			header is filled in by this function. Used by MetadataArrayBuilder.
+		*/
+		static Ref<Metadata> CreateArrayFromBuffer(MetadataArrayElementType type, std::vector<uint8_t>& buffer);
+
+		/*! Size in bytes of the header that precedes the elements of a serialized typed array */
+		static constexpr size_t ArrayHeaderSize = 16;
+
+		/*! Get the element type of typed array metadata
+
+			\return The element type, or std::nullopt if this is not typed array metadata
+		*/
+		std::optional<MetadataArrayElementType> GetArrayElementType() const;
+
+		/*! Read the elements of typed array metadata
+
+			\param[out] result Receives the elements
+			\return Whether this is a typed array with elements of type T
+		*/
+		template <typename T>
+		bool GetArray(MetadataArray<T>& result) const
+		{
+			const uint8_t* payload;
+			size_t count;
+			bool swapped;
+			uint8_t* raw = GetArrayData(MetadataArrayTraits<T>::ElementType, payload, count, swapped);
+			if (!raw)
+				return false;
+			result.m_raw.reset(raw);
+			result.m_converted.clear();
+			if (swapped)
+			{
+				result.m_converted.resize(count);
+				for (size_t i = 0; i < count; i++)
+				{
+					uint8_t bytes[sizeof(T)];
+					for (size_t j = 0; j < sizeof(T); j++)
+						bytes[j] = payload[(i * sizeof(T)) + sizeof(T) - 1 - j];
+					memcpy(&result.m_converted[i], bytes, sizeof(T));
+				}
+				result.m_raw.reset();
+				result.m_data = result.m_converted.data();
+			}
+			else
+			{
+				result.m_data = (const T*)payload;
+			}
+			result.m_size = count;
+			return true;
+		}
+
 		// For key-value data only
 		/*! Get a Metadata object by key. Only for if IsKeyValueStore == true
 
@@ -1448,8 +2088,52 @@ namespace BinaryNinja {
 		bool IsRaw() const;
 		bool IsArray() const;
 		bool IsKeyValueStore() const;
+		bool IsTypedArray() const;
+
+	  private:
+		// Returns the raw buffer, to be freed with BNFreeMetadataRaw, if this is a typed array of the given type
+		uint8_t* GetArrayData(
+		    MetadataArrayElementType type, const uint8_t*& payload, size_t& count, bool& byteSwapped) const;
 	};
 
+	template <typename T>
+	MetadataArrayBuilder<T>::MetadataArrayBuilder() : m_buffer(Metadata::ArrayHeaderSize)
+	{}
+
+	template <typename T>
+	void MetadataArrayBuilder<T>::Reserve(size_t count)
+	{
+		m_buffer.reserve(Metadata::ArrayHeaderSize + (count * sizeof(T)));
+	}
+
+	template <typename T>
+	void MetadataArrayBuilder<T>::Append(const T& value)
+	{
+		const uint8_t* bytes = (const uint8_t*)&value;
+		m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+	}
+
+	template <typename T>
+	void MetadataArrayBuilder<T>::Append(Span<const T> values)
+	{
+		const uint8_t* bytes = (const uint8_t*)values.data();
+		m_buffer.insert(m_buffer.end(), bytes, bytes + (values.size() * sizeof(T)));
+	}
+
+	template <typename T>
+	size_t MetadataArrayBuilder<T>::GetCount() const
+	{
+		return (m_buffer.size() - Metadata::ArrayHeaderSize) / sizeof(T);
+	}
+
+	template <typename T>
+	Ref<Metadata> MetadataArrayBuilder<T>::Finish()
+	{
+		Ref<Metadata> result = Metadata::CreateArrayFromBuffer(MetadataArrayTraits<T>::ElementType, m_buffer);
+		m_buffer.assign(Metadata::ArrayHeaderSize, 0);
+		return result;
+	}
+
 	class BinaryView;
 
 	/*! OpenView opens a file on disk and returns a BinaryView, attempting to use the most
@@ -1597,6 +2281,168 @@ namespace BinaryNinja {
 	*/
 	bool IsGNU3MangledString(const std::string& mangledName);
 
+	/*!
+		\ingroup demangle
+	*/
+	enum DemangleScheme
+	{
+		NoDemangleScheme,
+		/*! Pick the scheme of each name with GetDemangleScheme */
+		AutoDemangleScheme,
+		MSDemangleScheme,
+		GNU3DemangleScheme
+	};
+
+	/*! Determine which demangler a name is meant for from its prefix: '?' for Microsoft Visual Studio C++ names,
+		"_Z" or "__Z" for GNU3 names. This only looks at the first few characters, so a name it accepts may still
+		fail to demangle.
+
+		\return MSDemangleScheme, GNU3DemangleScheme or NoDemangleScheme
+
+		\ingroup demangle
+	*/
+	DemangleScheme GetDemangleScheme(std::string_view name);
+
+	/*! Classify a list of names with GetDemangleScheme
+
+		\param names Names to classify
+		\param[out] out Receives the scheme of each name, must be at least as long as names
+
+		\ingroup demangle
+	*/
+	void GetDemangleSchemes(Span<const std::string_view> names, Span<DemangleScheme> out);
+
+	/*! Determines if a symbol name looks like a mangled Microsoft Visual Studio C++ name
+
+		\param[in] mangledName a potentially mangled name
+
+		\ingroup demangle
+	*/
+	bool IsMSMangledString(const std::string& mangledName);
+
+	/*! Demangled names kept across DemangleBatch calls, so symbols seen by several loaders or views are only
+		demangled once. Entries are keyed by architecture, scheme, simplification and mangled name.
+
+		@threadsafe
+		\ingroup demangle
+	*/
+	class DemangleCache
+	{
+	  public:
+		struct Entry
+		{
+			bool demangled = false;
+			Ref<Type> type;
+			std::vector<std::string> name;
+		};
+
+	  private:
+		static constexpr size_t ShardCount = 16;
+
+		struct Shard
+		{
+			std::mutex mutex;
+			std::unordered_map<std::string, std::shared_ptr<const Entry>> entries;
+		};
+
+		Shard m_shards[ShardCount];
+
+		static std::string GetKey(Architecture* arch, DemangleScheme scheme, bool simplify, std::string_view name);
+		Shard& GetShard(const std::string& key);
+
+	  public:
+		std::shared_ptr<const Entry> Find(
+		    Architecture* arch, DemangleScheme scheme, bool simplify, std::string_view mangledName);
+		void Insert(Architecture* arch, DemangleScheme scheme, bool simplify, std::string_view mangledName,
+		    std::shared_ptr<const Entry> entry);
+		size_t GetSize();
+		void Clear();
+	};
+
+	/*!
+		\ingroup demangle
+	*/
+	struct DemangleBatchOptions
+	{
+		/*! Scheme used for every name, or AutoDemangleScheme to pick one per name */
+		DemangleScheme scheme = AutoDemangleScheme;
+		/*! Whether to simplify demangled names */
+		bool simplify = false;
+		/*! If set, simplify is taken from this view's "analysis.types.templateSimplifier" setting, read once */
+		BinaryView* view = nullptr;
+		/*! Keep the demangled types. Names alone are cheaper to collect. */
+		bool includeTypes = true;
+		/*! Number of threads demangling names, or 0 to use GetWorkerThreadCount() */
+		size_t threadCount = 0;
+		/*! Optional cache shared between batches */
+		DemangleCache* cache = nullptr;
+	};
+
+	/*! Results of DemangleBatch, in the order of the input names.
+
+		Identical input names share one result. Name components are interned, so a namespace or class that appears
+		in many names is stored once.
+
+		\ingroup demangle
+	*/
+	class DemangleBatchResult
+	{
+		struct Entry
+		{
+			uint32_t firstComponent;
+			uint32_t componentCount;
+			DemangleScheme scheme;
+			bool demangled;
+		};
+
+		std::vector<uint32_t> m_indices;
+		std::vector<Entry> m_entries;
+		std::vector<Ref<Type>> m_types;
+		std::vector<uint32_t> m_nameComponents;
+		std::vector<std::pair<uint32_t, uint32_t>> m_components;
+		std::string m_strings;
+
+		friend DemangleBatchResult DemangleBatch(
+		    Architecture* arch, Span<const std::string_view> names, const DemangleBatchOptions& options);
+
+	  public:
+		size_t size() const { return m_indices.size(); }
+		/*! Number of distinct names in the input */
+		size_t GetUniqueCount() const { return m_entries.size(); }
+		/*! Number of distinct name components across all results */
+		size_t GetInternedComponentCount() const { return m_components.size(); }
+
+		bool IsDemangled(size_t i) const { return m_entries[m_indices[i]].demangled; }
+		DemangleScheme GetScheme(size_t i) const { return m_entries[m_indices[i]].scheme; }
+		/*! Demangled type, or nullptr if there is none or types were not requested */
+		const Ref<Type>& GetType(size_t i) const { return m_types[m_indices[i]]; }
+
+		size_t GetNameComponentCount(size_t i) const { return m_entries[m_indices[i]].componentCount; }
+		std::string_view GetNameComponent(size_t i, size_t component) const
+		{
+			const auto& range = m_components[m_nameComponents[m_entries[m_indices[i]].firstComponent + component]];
+			return std::string_view(m_strings.data() + range.first, range.second);
+		}
+
+		QualifiedName GetName(size_t i) const;
+		std::string GetNameString(size_t i) const;
+	};
+
+	/*! Demangle many names at once.
+
+		Settings are resolved once for the batch, identical names are demangled once, and the remaining names are
+		spread across threads. Names that are not mangled for the selected scheme, or fail to demangle, are reported
+		through DemangleBatchResult::IsDemangled.
+
+		\param[in] arch Architecture for the symbols. Required for pointer and integer sizes.
+		\param[in] names Names to demangle. The strings only need to stay valid for the duration of the call.
+		\param[in] options Scheme, simplification and threading options
+
+		\ingroup demangle
+	*/
+	DemangleBatchResult DemangleBatch(Architecture* arch, Span<const std::string_view> names,
+	    const DemangleBatchOptions& options = DemangleBatchOptions());
+
 	/*!
 		\ingroup mainthread
 	*/
@@ -1667,6 +2513,20 @@ namespace BinaryNinja {
 	*/
 	void SetWorkerThreadCount(size_t count);
 
+	/*! Call \c action once for every index in the range [0, count), spread across a set of threads. Indices are
+		handed out in increasing order and the call returns once every index has been processed. The calling thread
+		takes part in the work. If \c action throws, remaining indices are skipped and the first exception is
+		rethrown on the calling thread.
+
+		@threadsafe
+		\ingroup mainthread
+
+		\param count Number of indices to process
+		\param action Function to call with each index
+		\param threadCount Maximum number of threads to use, or 0 to use GetWorkerThreadCount()
+	*/
+	void ParallelFor(size_t count, const std::function<void(size_t)>& action, size_t threadCount = 0);
+
 	/*!
 	    @threadsafe
 	*/
@@ -1967,14 +2827,55 @@ namespace BinaryNinja {
 
 	std::map<std::string, uint64_t> GetMemoryUsageInfo();
 
-	/*!
+	/*! DataBuffer holds a block of bytes that can be passed to and from the core.
+
+		Buffers of up to InlineCapacity bytes are stored inside the object and only allocate a core buffer when one
+		is needed (GetBufferObject, or growing past the inline capacity). A moved-from buffer is left empty without
+		allocating. Code passing a buffer that may be shared between threads to the core uses DataBuffer::ScopedObject,
+		which never changes the buffer.
+
 		\ingroup databuffer
 	*/
 	class DataBuffer
 	{
-		BNDataBuffer* m_buffer;
+	  public:
+		static constexpr size_t InlineCapacity = 32;
+
+	  private:
+		// Null while the contents are held in m_inline. Mutable so that GetBufferObject can move them into a core
+		// buffer on a const DataBuffer.
+		mutable BNDataBuffer* m_buffer;
+		size_t m_inlineLength;
+		uint8_t m_inline[InlineCapacity];
+
+		void Materialize() const;
 
 	  public:
+		/*! Core buffer holding the contents of a const DataBuffer for the duration of a core call. Buffers stored
+			inline are copied into a temporary core buffer, which is freed when this object is destroyed, so the
+			DataBuffer itself is not modified.
+
+			\code{.cpp}
+			DataBuffer::ScopedObject buffer(data);
+			BNWriteViewBuffer(view, offset, buffer);
+			\endcode
+		*/
+		class ScopedObject
+		{
+			BNDataBuffer* m_object;
+			bool m_owned;
+
+		  public:
+			ScopedObject(const DataBuffer& buf);
+			ScopedObject(ScopedObject&& other);
+			ScopedObject(const ScopedObject&) = delete;
+			ScopedObject& operator=(const ScopedObject&) = delete;
+			~ScopedObject();
+
+			BNDataBuffer* GetObject() const { return m_object; }
+			operator BNDataBuffer*() const { return m_object; }
+		};
+
 		DataBuffer();
 		DataBuffer(size_t len);
 		DataBuffer(const void* data, size_t len);
@@ -1986,7 +2887,13 @@ namespace BinaryNinja {
 		DataBuffer& operator=(const DataBuffer& buf);
 		DataBuffer& operator=(DataBuffer&& buf);
 
-		BNDataBuffer* GetBufferObject() const { return m_buffer; }
+		/*! Get the core object for this buffer, moving inline contents into a core buffer if needed. Pointers
+			returned by GetData before this call may no longer refer to the contents. This changes the storage of a
+			const buffer too, so use ScopedObject to pass a buffer that other threads may be reading to the core.
+
+			@threadunsafe
+		*/
+		BNDataBuffer* GetBufferObject() const;
 
 		/*! Get the raw pointer to the data contained within this buffer
 
@@ -2069,6 +2976,32 @@ namespace BinaryNinja {
 		bool operator==(const DataBuffer& other) const;
 		bool operator!=(const DataBuffer& other) const;
 
+		/*! Find the first occurrence of `data` in this buffer, starting at offset `start`
+
+			@threadunsafe
+
+			\param data Bytes to search for
+			\param[out] result Offset of the match
+			\param start Offset to start searching from
+			\return Whether a match was found
+		*/
+		bool Find(const DataBuffer& data, size_t& result, size_t start = 0) const;
+		bool Find(const void* data, size_t len, size_t& result, size_t start = 0) const;
+
+		/*! Compute the CRC-32C (Castagnoli) checksum of the contents
+
+			@threadunsafe
+
+			\param crc Result of a previous call, to checksum data split over several buffers
+		*/
+		uint32_t GetCrc32c(uint32_t crc = 0) const;
+
+		/*! Compute the 64-bit xxHash (XXH64) of the contents, for hashing and deduplicating buffers
+
+			@threadunsafe
+		*/
+		uint64_t GetHash64(uint64_t seed = 0) const;
+
 		/*! Convert the contents of the DataBuffer to a string
 
 			\param nullTerminates Whether the decoder should stop and return the string after encountering a null (\x00) byte.
@@ -2097,6 +3030,20 @@ namespace BinaryNinja {
 		*/
 		static DataBuffer FromBase64(const std::string& src);
 
+		/*! Convert the contents of this DataBuffer to lowercase hex
+
+			@threadunsafe
+		*/
+		std::string ToHex() const;
+
+		/*! Decode a string of hex digits, of either case
+
+			\param src Input hex string
+			\param[out] output DataBuffer the decoded bytes will be stored in
+			\returns Whether src had an even number of characters that were all hex digits
+		*/
+		static bool FromHex(const std::string& src, DataBuffer& output);
+
 		/*! Compress this databuffer via ZLIB compression
 
 			@threadunsafe
@@ -2289,6 +3236,169 @@ namespace BinaryNinja {
 		DatabaseException(const std::string& desc) : ExceptionWithStackTrace(desc.c_str()) {}
 	};
 
+	/*! Encodings for values stored with KeyValueStore::SetValue and Database::WriteGlobal
+
+		\ingroup database
+	*/
+	enum ValueEncoding
+	{
+		//! Compact JSON text, readable by every version
+		JsonValueEncoding,
+		//! CBOR (RFC 8949) starting with the self-describe tag. Smaller and much faster to write and read than
+		//! JSON, but only readable by versions that support it.
+		CborValueEncoding
+	};
+
+	/*! Kinds of item reported by CborReader
+
+		\ingroup database
+	*/
+	enum CborItemType
+	{
+		CborUnsignedItem,
+		CborNegativeItem,
+		CborBytesItem,
+		CborTextItem,
+		CborArrayItem,
+		CborMapItem,
+		CborTagItem,
+		CborBoolItem,
+		CborNullItem,
+		CborUndefinedItem,
+		CborFloatItem,
+		CborBreakItem
+	};
+
+	/*! One item read by CborReader
+
+		\ingroup database
+	*/
+	struct CborItem
+	{
+		CborItemType type;
+		//! Unsigned value, the encoded argument of a negative integer, or the tag number
+		uint64_t unsignedValue;
+		//! Value of an integer, when it fits in an int64_t
+		int64_t signedValue;
+		double floatValue;
+		bool boolValue;
+		//! Contents of a definite length byte or text string, pointing into the input
+		Span<const uint8_t> data;
+		//! Number of elements of an array, number of pairs of a map, or IndefiniteLength for indefinite length
+		//! arrays, maps and strings
+		uint64_t length;
+
+		static constexpr uint64_t IndefiniteLength = (uint64_t)-1;
+
+		std::string_view GetText() const { return std::string_view((const char*)data.data(), data.size()); }
+	};
+
+	/*! Pull parser for CBOR data, for reading large values without building a Json::Value for them
+
+		Items are returned in document order: an array or map item is followed by its elements (keys and values
+		alternating for maps), and indefinite length containers and strings end with a CborBreakItem. Strings are
+		returned as views into the input, so nothing is copied.
+
+		\code{.cpp}
+		DataBuffer buffer = store->GetBuffer("cache");
+		CborReader reader(buffer);
+		CborItem item;
+		if (reader.Next(item) && (item.type == CborTagItem))
+			reader.Next(item);  // Skip the self-describe tag
+		if (item.type == CborArrayItem)
+		{
+			for (uint64_t i = 0; i < item.length; i++)
+			{
+				CborItem element;
+				if (!reader.Next(element))
+					break;
+				...
+			}
+		}
+		\endcode
+
+		\ingroup database
+	*/
+	class CborReader
+	{
+		const uint8_t* m_data;
+		size_t m_size;
+		size_t m_offset;
+		bool m_error;
+
+		bool SkipContents(const CborItem& item, size_t depth);
+
+	  public:
+		CborReader(const uint8_t* data, size_t size);
+		CborReader(const DataBuffer& buffer);
+
+		/*! Read the next item
+
+			\return false at the end of the input, or on malformed input (see IsError)
+		*/
+		bool Next(CborItem& item);
+
+		/*! Skip the next item, including all elements of an array or map */
+		bool Skip();
+
+		bool AtEnd() const { return m_offset >= m_size; }
+		bool IsError() const { return m_error; }
+		size_t GetOffset() const { return m_offset; }
+	};
+
+	/*! Writes CBOR data item by item, for building large values without a Json::Value
+
+		\ingroup database
+	*/
+	class CborWriter
+	{
+		std::vector<uint8_t> m_data;
+
+		void WriteHead(uint8_t major, uint64_t argument);
+
+	  public:
+		/*! Start the output with the self-describe tag, which is how stored values are recognized as CBOR */
+		void WriteSelfDescribeTag();
+		void WriteUnsigned(uint64_t value);
+		void WriteSigned(int64_t value);
+		void WriteDouble(double value);
+		void WriteBool(bool value);
+		void WriteNull();
+		void WriteText(std::string_view value);
+		void WriteBytes(Span<const uint8_t> value);
+		void BeginArray(uint64_t length);
+		void BeginMap(uint64_t pairs);
+		void WriteValue(const Json::Value& value);
+
+		const std::vector<uint8_t>& GetData() const { return m_data; }
+		DataBuffer GetBuffer() const;
+		void Clear() { m_data.clear(); }
+	};
+
+	/*! Encode a value as CBOR, starting with the self-describe tag
+
+		\ingroup database
+	*/
+	DataBuffer EncodeCbor(const Json::Value& value);
+
+	/*! Decode a CBOR value. Byte strings decode to strings, and map keys that are not text are converted to text.
+
+		\ingroup database
+
+		\param data Encoded value, optionally starting with tags (such as the self-describe tag)
+		\param size Size of the encoded value
+		\param[out] result Decoded value
+		\param[out] errors Description of the problem if decoding fails
+		\return Whether the data was a single well formed CBOR value
+	*/
+	bool DecodeCbor(const uint8_t* data, size_t size, Json::Value& result, std::string& errors);
+
+	/*! Check whether stored data starts with the CBOR self-describe tag
+
+		\ingroup database
+	*/
+	bool IsCborEncoded(const uint8_t* data, size_t size);
+
 	/*! Maintains access to the raw data stored in Snapshots and various
     	other Database-related structures.
 
@@ -2304,10 +3414,18 @@ namespace BinaryNinja {
 		std::vector<std::string> GetKeys() const;
 
 		bool HasValue(const std::string& name) const;
+		/*! Get a value stored with SetValue, in either encoding
+
+			\throws DatabaseException if the key does not exist or the value cannot be decoded
+		*/
 		Json::Value GetValue(const std::string& name) const;
 		DataBuffer GetValueHash(const std::string& name) const;
+
+		/*! Get the stored bytes of a value. The returned buffer refers to the core's copy of the data, so large
+			CBOR values can be read with a CborReader without decoding them as a whole.
+		*/
 		DataBuffer GetBuffer(const std::string& name) const;
-		void SetValue(const std::string& name, const Json::Value& value);
+		void SetValue(const std::string& name, const Json::Value& value, ValueEncoding encoding = JsonValueEncoding);
 		void SetBuffer(const std::string& name, const DataBuffer& value);
 
 		DataBuffer GetSerializedData() const;
@@ -2349,6 +3467,9 @@ namespace BinaryNinja {
 		DataBuffer GetUndoData();
 		std::vector<UndoEntry> GetUndoEntries();
 		std::vector<UndoEntry> GetUndoEntries(const std::function<bool(size_t, size_t)>& progress);
+		/*! Read the data of this snapshot. Data written by a SnapshotWriter is decoded back into its original
+			form, including values an incremental snapshot shares with its ancestors.
+		*/
 		Ref<KeyValueStore> ReadData();
 		Ref<KeyValueStore> ReadData(const std::function<bool(size_t, size_t)>& progress);
 		bool StoreData(const Ref<KeyValueStore>& data, const std::function<bool(size_t, size_t)>& progress);
@@ -2378,8 +3499,9 @@ namespace BinaryNinja {
 
 		std::vector<std::string> GetGlobalKeys() const;
 		bool HasGlobal(const std::string& key) const;
+		/*! Read a global written with WriteGlobal, in either encoding */
 		Json::Value ReadGlobal(const std::string& key) const;
-		void WriteGlobal(const std::string& key, const Json::Value& val);
+		void WriteGlobal(const std::string& key, const Json::Value& val, ValueEncoding encoding = JsonValueEncoding);
 		DataBuffer ReadGlobalData(const std::string& key) const;
 		void WriteGlobalData(const std::string& key, const DataBuffer& val);
 
@@ -2389,6 +3511,101 @@ namespace BinaryNinja {
 		void WriteAnalysisCache(Ref<KeyValueStore> val);
 	};
 
+	/*!
+		\ingroup database
+	*/
+	struct SnapshotWriterSettings
+	{
+		/*! Size of the uncompressed payload in each chunk, in bytes */
+		size_t chunkSize = 4 * 1024 * 1024;
+		/*! Number of chunks compressed concurrently, or 0 to use GetWorkerThreadCount() */
+		size_t threadCount = 0;
+		/*! Store only the values that changed since the first parent snapshot, if it was also written by a
+			SnapshotWriter. Unchanged values are read back from the snapshot that holds them, so that snapshot
+			must not be trimmed or removed while its descendants are in use.
+		*/
+		bool incremental = false;
+	};
+
+	/*! SnapshotWriter stores snapshot data as a sequence of independently compressed chunks.
+
+		The values of the KeyValueStore are laid out back to back and split into fixed size chunks, which are
+		compressed in parallel and added to the stored data in order as they complete, so only a few chunks per
+		thread are held in memory at once. A manifest records where every value lives. Snapshot::ReadData
+		recognizes the manifest and rebuilds the original KeyValueStore, including values held by ancestors of
+		an incremental snapshot.
+
+		\note Chunked data can only be decoded by Snapshot::ReadData in this API, since the core reads snapshot data
+		without knowing about the manifest. This covers data that plugins store and read back themselves. It does
+		not speed up saving the analysis of a .bndb: analysis snapshots are read by the core when the database is
+		opened, so they must still be written with Database::WriteSnapshotData or FileMetadata::SaveAutoSnapshot.
+
+		\b Example:
+		\code{.cpp}
+		SnapshotWriterSettings settings;
+		settings.incremental = true;
+		SnapshotWriter writer(db, settings);
+		int64_t id = writer.WriteSnapshotData({db->GetCurrentSnapshot()->GetId()}, bv, "cache", data, false);
+		\endcode
+
+		\ingroup database
+	*/
+	class SnapshotWriter
+	{
+		Ref<Database> m_database;
+		SnapshotWriterSettings m_settings;
+
+		bool Encode(KeyValueStore* data, Snapshot* parent, KeyValueStore* output,
+		    const std::function<bool(size_t, size_t)>& progress);
+		Json::Value ReadManifest(Snapshot* snapshot);
+
+	  public:
+		SnapshotWriter(Database* database, const SnapshotWriterSettings& settings = SnapshotWriterSettings());
+
+		/*! Write a new snapshot, like Database::WriteSnapshotData
+
+			\param progress Optional progress callback. Return false to cancel the write.
+			\return Id of the new snapshot, or -1 if the write was cancelled
+			\throws DatabaseException if the core fails to write the snapshot
+		*/
+		int64_t WriteSnapshotData(const std::vector<int64_t>& parents, Ref<BinaryView> file, const std::string& name,
+		    const Ref<KeyValueStore>& data, bool autoSave,
+		    const std::function<bool(size_t, size_t)>& progress = nullptr);
+
+		/*! Replace the data of an existing snapshot, like Snapshot::StoreData
+
+			\return true on success, false if the write was cancelled
+			\throws DatabaseException if the core fails to store the data
+		*/
+		bool StoreData(Ref<Snapshot> snapshot, const Ref<KeyValueStore>& data,
+		    const std::function<bool(size_t, size_t)>& progress = nullptr);
+
+		/*! Whether stored snapshot data was written by a SnapshotWriter */
+		static bool IsChunked(KeyValueStore* stored);
+
+		/*! Keep a copy of the manifest of chunked data stored for a snapshot in a database global, so incremental
+			writes can read it without reading the snapshot's data. Clears the copy if \c stored is null or not
+			chunked. Called by SnapshotWriter and Snapshot::StoreData whenever snapshot data is stored.
+
+			\param database Database holding the snapshot
+			\param snapshotId Id of the snapshot
+			\param stored Data as stored for the snapshot, or null before replacing it
+		*/
+		static void RecordManifest(Database* database, int64_t snapshotId, KeyValueStore* stored);
+
+		/*! Rebuild the original data from chunked snapshot data
+
+			\param database Database holding the snapshot, used to resolve values of incremental snapshots
+			\param stored Data as returned by the core for the snapshot
+			\param threadCount Number of chunks decompressed concurrently, or 0 to use GetWorkerThreadCount()
+			\param progress Optional progress callback. Return false to cancel.
+			\return The original data, or nullptr if cancelled
+			\throws DatabaseException if the data is damaged or a referenced snapshot no longer has its data
+		*/
+		static Ref<KeyValueStore> Decode(Database* database, KeyValueStore* stored, size_t threadCount = 0,
+		    const std::function<bool(size_t, size_t)>& progress = nullptr);
+	};
+
 	/*!
 
 		\ingroup undo
@@ -3732,9 +4949,60 @@ namespace BinaryNinja {
 		QueryMetadataException(const std::string& error) : ExceptionWithStackTrace(error) {}
 	};
 
-	/*! \c BinaryView implements a view on binary data, and presents a queryable interface of a binary file.
+	/*! Data variable applied by BinaryView::DefineDataVariables
 
-		One key job of BinaryView is file format parsing which allows Binary Ninja to read, write, insert, remove portions
+		\ingroup binaryview
+	*/
+	struct DataVariableDefinition
+	{
+		uint64_t address;
+		Type* type;
+		uint8_t confidence = BN_FULL_CONFIDENCE;
+	};
+
+	/*! Symbol defined by BinaryView::DefineAutoSymbols. The names are not copied beyond the call.
+
+		\ingroup binaryview
+	*/
+	struct SymbolDefinition
+	{
+		BNSymbolType type;
+		uint64_t address;
+		const char* shortName;
+		// Optional names, defaulting to the short name
+		const char* fullName = nullptr;
+		const char* rawName = nullptr;
+		BNSymbolBinding binding = NoBinding;
+		uint64_t ordinal = 0;
+	};
+
+	/*! Function added by BinaryView::AddFunctionsForAnalysis
+
+		\ingroup binaryview
+	*/
+	struct FunctionDefinition
+	{
+		Platform* platform;
+		uint64_t address;
+		// Optional function type
+		Type* type = nullptr;
+		bool autoDiscovered = false;
+	};
+
+	/*! Tag added at an address by BinaryView::AddDataTags
+
+		\ingroup binaryview
+	*/
+	struct DataTagDefinition
+	{
+		uint64_t address;
+		Tag* tag;
+		bool user = false;
+	};
+
+	/*! \c BinaryView implements a view on binary data, and presents a queryable interface of a binary file.
+
+		One key job of BinaryView is file format parsing which allows Binary Ninja to read, write, insert, remove portions
 		of the file given a virtual address. For the purposes of this documentation we define a virtual address as the
 		memory address that the various pieces of the physical file will be loaded at.
 
@@ -4168,6 +5436,14 @@ namespace BinaryNinja {
 		*/
 		size_t Read(void* dest, uint64_t offset, size_t len);
 
+		/*! Read fills `dest` with bytes starting at virtual address `offset`
+
+		    \param dest Caller provided storage to read into, its size is the number of bytes to read
+		    \param offset virtual address to read from
+		    \return amount of bytes read
+		*/
+		size_t Read(Span<uint8_t> dest, uint64_t offset);
+
 		/*! ReadBuffer reads len bytes from a virtual address into a DataBuffer
 
 		    \param offset virtual address to read from
@@ -4176,6 +5452,16 @@ namespace BinaryNinja {
 		*/
 		DataBuffer ReadBuffer(uint64_t offset, size_t len);
 
+		/*! ReadBuffer reads len bytes from a virtual address into an existing DataBuffer, so that a buffer can be
+		    reused across reads without allocating
+
+		    \param dest DataBuffer to read into, resized to the amount of bytes read
+		    \param offset virtual address to read from
+		    \param len number of bytes to read
+		    \return amount of bytes read
+		*/
+		size_t ReadBuffer(DataBuffer& dest, uint64_t offset, size_t len);
+
 		/*! Write writes `len` bytes data at address `dest` to virtual address `offset`
 
 			\param offset virtual address to write to
@@ -4392,6 +5678,12 @@ namespace BinaryNinja {
 		Ref<Function> AddFunctionForAnalysis(
 			Platform* platform, uint64_t addr, bool autoDiscovered = false, Type* type = nullptr);
 
+		/*! Add many functions as a single undo action, without creating a Function object for each
+
+		    \param functions Platforms, addresses and optional types of the functions
+		*/
+		void AddFunctionsForAnalysis(Span<const FunctionDefinition> functions);
+
 		/*! adds an virtual address to start analysis from for a given platform
 
 		    \param platform Platform for the entry point analysis
@@ -4468,6 +5760,13 @@ namespace BinaryNinja {
 		*/
 		void DefineUserDataVariable(uint64_t addr, const Confidence<Ref<Type>>& type);
 
+		/*! Define many DataVariables as a single undo action
+
+		    \param variables Addresses and types of the DataVariables
+		    \param user Whether the DataVariables are user defined
+		*/
+		void DefineDataVariables(Span<const DataVariableDefinition> variables, bool user = false);
+
 		/*! Undefine a DataVariable at a given address
 
 		    \param addr virtual address of the DataVariable
@@ -4895,6 +6194,13 @@ namespace BinaryNinja {
 		*/
 		void DefineAutoSymbol(Ref<Symbol> sym);
 
+		/*! Define many automatically discovered symbols inside a single bulk symbol modification and undo action.
+			Symbols are created in the default namespace without a Symbol object for each.
+
+			\param symbols Symbols to define, in order. Later symbols take precedence at a shared address.
+		*/
+		void DefineAutoSymbols(Span<const SymbolDefinition> symbols);
+
 		/*! Defines an "Auto" symbol, and a Variable/Function alongside it
 
 			\param platform Platform for the Type being defined
@@ -5027,6 +6333,12 @@ namespace BinaryNinja {
 		*/
 		void AddTag(Ref<Tag> tag, bool user = false);
 
+		/*! Add many tags and reference each at its address as a single undo action
+
+			\param tags Tags and the addresses to add them at
+		*/
+		void AddDataTags(Span<const DataTagDefinition> tags);
+
 		/*! Remove a tag
 
 			\param tag The tag to remove
@@ -6268,6 +7580,19 @@ namespace BinaryNinja {
 			\return DataBuffer containing the bytes read
 		*/
 		DataBuffer Read(size_t len);
+		/*! Fill `dest` from the current cursor position
+
+		    \throws ReadException
+			\param dest Caller provided storage to read into, its size is the number of bytes to read
+		*/
+		void Read(Span<uint8_t> dest);
+		/*! Read from the current cursor position into an existing DataBuffer, resizing it to `len`
+
+		    \throws ReadException
+			\param dest DataBuffer to read into
+			\param len Number of bytes to read
+		*/
+		void Read(DataBuffer& dest, size_t len);
 		template <typename T>
 		T Read();
 		template <typename T>
@@ -6405,6 +7730,13 @@ namespace BinaryNinja {
 		*/
 		bool TryRead(DataBuffer& dest, size_t len);
 
+		/*! Try filling `dest` from the current cursor position
+
+			\param dest Caller provided storage to read into, its size is the number of bytes to read
+			\return Whether the read succeeded
+		*/
+		bool TryRead(Span<uint8_t> dest);
+
 		/*! Try reading a string
 
 			\param dest Reference to a string to write to
@@ -6757,6 +8089,78 @@ namespace BinaryNinja {
 		size_t fixedLength;  // Variable length if zero
 	};
 
+	/*! Incremental encoder or decoder for a Transform, created by Transform::CreateDecodeStream or
+		Transform::CreateEncodeStream. Input is fed in chunks and output is appended as it becomes available, so
+		large inputs can be processed without holding them in memory. Streams implemented in the API keep only a
+		few bytes of state between chunks. Transforms without a streaming implementation collect their input and
+		produce all of their output in Finish.
+
+		A stream may be reused by calling Begin again. Streams are not thread safe.
+
+		\ingroup transform
+	*/
+	class TransformStream : public RefCountObject
+	{
+	  public:
+		/*! Start a new pass over an input, discarding any state from a previous pass
+
+			\param params Transform parameters, such as "key"
+			\return false if the parameters are not valid for the transform
+		*/
+		virtual bool Begin(const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>()) = 0;
+
+		/*! Process the next chunk of input
+
+			\param data Input chunk
+			\param len Length of the input chunk
+			\param output Buffer that output is appended to
+			\return false if the input is not valid for the transform
+		*/
+		virtual bool Update(const void* data, size_t len, DataBuffer& output) = 0;
+
+		/*! Complete the pass, appending any remaining output
+
+			\param output Buffer that output is appended to
+			\return false if the input ended early or was not valid for the transform
+		*/
+		virtual bool Finish(DataBuffer& output) = 0;
+
+		/*! For streams where each output offset corresponds to a known input offset, restart the pass so that
+			feeding input from \c inputOffset onwards produces output starting at \c outputOffset. Must be called
+			after Begin.
+
+			\param outputOffset Output offset to restart at
+			\param inputOffset Set to the input offset to continue feeding from
+			\return false if the stream cannot restart in the middle of its input
+		*/
+		virtual bool Seek(uint64_t outputOffset, uint64_t& inputOffset);
+
+		/*! Compute the length of the output for an input without processing it, where the stream allows it
+
+			\param inputLength Length of the whole input
+			\param outputLength Set to the length of the output
+			\return false if the output length depends on the contents of the input
+		*/
+		virtual bool GetOutputLength(uint64_t inputLength, uint64_t& outputLength);
+
+		/*! Whether output is produced as input is fed. Streams that collect their whole input and produce all of
+			their output in Finish return false.
+
+			\return true unless overridden
+		*/
+		virtual bool IsIncremental() const;
+
+		/*! Run a complete pass over a single buffer
+
+			\param input Input data
+			\param output Set to the output
+			\param params Transform parameters
+			\return Whether every stage of the pass succeeded
+		*/
+		bool Process(const DataBuffer& input, DataBuffer& output,
+		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>());
+	};
+
 	/*! Allows users to implement custom transformations.
 
 	    New transformations may be added at runtime, so an instance of a transform is created like
@@ -6821,9 +8225,26 @@ namespace BinaryNinja {
 		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>());
 		virtual bool Encode(const DataBuffer& input, DataBuffer& output,
 		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>());
+
+		/*! Create a stream that decodes incrementally. The default stream collects the input and calls Decode
+			when it is finished, so transforms that can work on chunks should override this.
+
+			\return New decode stream
+		*/
+		virtual Ref<TransformStream> CreateDecodeStream();
+
+		/*! Create a stream that encodes incrementally. The default stream collects the input and calls Encode
+			when it is finished, so transforms that can work on chunks should override this.
+
+			\return New encode stream
+		*/
+		virtual Ref<TransformStream> CreateEncodeStream();
 	};
 
-	/*!
+	/*! A transform provided by the core. The RawHex, XOR and RC4 transforms and Base64 decoding have streaming
+		implementations in the API, which the one-shot Decode and Encode also use. If a streaming pass rejects its
+		input, the one-shot calls fall back to the core, which remains the reference for unusual input.
+
 		\ingroup transform
 	*/
 	class CoreTransform : public Transform
@@ -6836,6 +8257,100 @@ namespace BinaryNinja {
 		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>()) override;
 		virtual bool Encode(const DataBuffer& input, DataBuffer& output,
 		    const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>()) override;
+
+		virtual Ref<TransformStream> CreateDecodeStream() override;
+		virtual Ref<TransformStream> CreateEncodeStream() override;
+	};
+
+	/*! A read only view of a range of another view as seen through a transform. For incremental streams, output
+		is produced on demand, one block at a time, and recently used blocks are kept in a bounded cache, so packed
+		payloads can be analyzed without materializing them.
+
+		Streams that can seek, such as XOR and RawHex encoding, decode each block independently. Other incremental
+		streams, such as RawHex and Base64 decoding and RC4, are run forward from the start of the range, caching
+		every block they pass, and are restarted when an earlier block is needed again. Memory use is bounded by
+		the block cache for all of these.
+
+		Transforms without an incremental stream, which includes zlib, the ciphers other than XOR and RC4 and most
+		plugin transforms, are not bounded: the whole range is transformed once when the view is created and the
+		output is kept as the view's contents.
+
+		\code{.cpp}
+		Ref<TransformedBinaryView> payload = TransformedBinaryView::Create(view, start, length,
+			Transform::GetByName("XOR"), {{"key", DataBuffer("\x5a", 1)}});
+		\endcode
+
+		@threadsafe
+
+		\ingroup transform
+	*/
+	class TransformedBinaryView : public BinaryView
+	{
+		struct CachedBlock
+		{
+			uint64_t index;
+			DataBuffer data;
+		};
+
+		Ref<BinaryView> m_source;
+		uint64_t m_sourceStart, m_sourceLength;
+		Ref<TransformStream> m_stream;
+		std::map<std::string, DataBuffer> m_params;
+		uint64_t m_length;
+		size_t m_blockSize, m_cacheBlocks;
+
+		std::mutex m_mutex;
+		std::list<CachedBlock> m_cache;
+		std::unordered_map<uint64_t, std::list<CachedBlock>::iterator> m_cacheIndex;
+
+		// State of the current pass. Output before m_outputOffset has been cut into blocks, and output from
+		// m_outputOffset onwards is held in m_pending starting at m_pendingOffset.
+		bool m_passActive = false;
+		bool m_passFinished = false;
+		uint64_t m_inputOffset = 0;
+		uint64_t m_outputOffset = 0;
+		DataBuffer m_pending;
+		size_t m_pendingOffset = 0;
+
+		// Whole output of a stream that is not incremental, which is read directly instead of in blocks
+		bool m_buffered = false;
+		DataBuffer m_output;
+
+		TransformedBinaryView(BinaryView* source, uint64_t start, uint64_t length, TransformStream* stream,
+		    const std::map<std::string, DataBuffer>& params, uint64_t outputLength, size_t blockSize,
+		    size_t cacheBlocks);
+
+		static bool MeasureOutput(BinaryView* source, uint64_t start, uint64_t length, TransformStream* stream,
+		    const std::map<std::string, DataBuffer>& params, size_t chunkSize, uint64_t& outputLength);
+
+		bool BeginPass();
+		void CutBlocks(uint64_t lastIndex);
+		const DataBuffer* GetBlock(uint64_t index);
+
+	  protected:
+		virtual size_t PerformRead(void* dest, uint64_t offset, size_t len) override;
+		virtual bool PerformIsValidOffset(uint64_t offset) override;
+		virtual bool PerformIsOffsetReadable(uint64_t offset) override;
+		virtual bool PerformIsOffsetWritable(uint64_t offset) override;
+		virtual uint64_t PerformGetNextValidOffset(uint64_t offset) override;
+		virtual uint64_t PerformGetLength() const override;
+
+	  public:
+		/*! Create a view of a range of \c source decoded (or encoded) through a transform
+
+			\param source View holding the transform input
+			\param start Start of the input range in \c source
+			\param length Length of the input range
+			\param transform Transform to apply
+			\param params Transform parameters, such as "key"
+			\param encode Whether to encode rather than decode
+			\param blockSize Size of the blocks that output is produced and cached in
+			\param cacheBlocks Maximum number of blocks kept in the cache
+			\return The new view, or nullptr if the parameters or the input are not valid for the transform
+		*/
+		static Ref<TransformedBinaryView> Create(BinaryView* source, uint64_t start, uint64_t length,
+		    Transform* transform, const std::map<std::string, DataBuffer>& params = std::map<std::string, DataBuffer>(),
+		    bool encode = false, size_t blockSize = 0x10000, size_t cacheBlocks = 256);
 	};
 
 	struct InstructionInfo : public BNInstructionInfo
@@ -7618,6 +9133,7 @@ namespace BinaryNinja {
 	class Structure;
 	class NamedTypeReference;
 	class Enumeration;
+	class EnumerationIndex;
 
 	/*!
 		\ingroup variable
@@ -8391,6 +9907,63 @@ namespace BinaryNinja {
 		BNMemberScope scope;
 	};
 
+	/*! Member passed to StructureBuilder::AddMembers and StructureBuilder::ReplaceMembers. The type and name are not
+		referenced or copied, so they must outlive the call.
+
+		\ingroup types
+	*/
+	struct StructureMemberDescriptor
+	{
+		/*! Place the member after the furthest end of the members before it, aligned for its type */
+		static constexpr uint64_t AutoOffset = (uint64_t)-1;
+
+		Type* type;
+		const char* name;
+		uint64_t offset = AutoOffset;
+		uint8_t confidence = BN_FULL_CONFIDENCE;
+		/*! Width in bits for a bitfield member, or 0 for an ordinary member */
+		uint8_t bitWidth = 0;
+		BNMemberAccess access = NoAccess;
+		BNMemberScope scope = NoScope;
+	};
+
+	/*!
+	    \ingroup types
+	*/
+	struct StructureMemberLayout
+	{
+		uint64_t offset;
+		uint64_t width;
+		/*! Bit offset within the storage unit at \c offset, for bitfield members */
+		uint8_t bitPosition;
+		uint8_t bitWidth;
+	};
+
+	/*! Layout of a list of member descriptors, computed by StructureBuilder::ComputeLayout without calling into the
+		core for anything but the width and alignment of each distinct member type
+
+	    \ingroup types
+	*/
+	struct StructureLayout
+	{
+		/*! Placement of each member, in descriptor order */
+		std::vector<StructureMemberLayout> members;
+		/*! Indices into \c members, sorted by offset and then bit position */
+		std::vector<size_t> order;
+		/*! Furthest end of any member in \c order up to and including each position */
+		std::vector<uint64_t> coveredEnd;
+		uint64_t width = 0;
+		size_t alignment = 1;
+
+		/*! Find the member covering a byte offset
+
+			\param offset Offset within the structure
+			\param index Set to the index of the member, in descriptor order
+			\return Whether a member covers the offset
+		*/
+		bool FindMemberAtOffset(uint64_t offset, size_t& index) const;
+	};
+
 	/*!
 	    \ingroup types
 	*/
@@ -8656,6 +10229,59 @@ namespace BinaryNinja {
 		*/
 		StructureBuilder& ReplaceMember(
 		    size_t idx, const Confidence<Ref<Type>>& type, const std::string& name, bool overwriteExisting = true);
+
+		/*! Compute the layout of a list of members following C rules: members are aligned for their type unless
+			the structure is packed, and the width is padded to the structure alignment. Consecutive bitfields
+			share a storage unit while they have the same type width and fit in it. The layout is rejected if
+			two members overlap, other than in a union.
+
+			\param members Members to lay out
+			\param type Structure variant, where unions place every member at offset 0
+			\param packed Whether members are packed without alignment padding
+			\param result Computed layout
+			\param error Description of the problem if the layout is rejected
+			\param startOffset Offset that automatically placed members start at, such as the end of existing members
+			\return Whether the layout is valid
+		*/
+		static bool ComputeLayout(Span<const StructureMemberDescriptor> members, BNStructureVariant type, bool packed,
+		    StructureLayout& result, std::string& error, uint64_t startOffset = 0);
+
+		/*! Validate and add a list of members after the existing ones, using ComputeLayout. Members placed at an
+			explicit offset are rejected if they overlap an existing member of a structure or class.
+
+			The core has no bitfield members, so each bitfield storage unit is added as one member of the storage
+			type, named after the first bitfield in the unit.
+
+			\param members Members to add
+			\param error Description of the problem if the members were rejected
+			\return Whether the members were added
+		*/
+		bool AddMembers(Span<const StructureMemberDescriptor> members, std::string& error);
+
+		/*! Add a list of members with a layout previously computed by ComputeLayout
+
+			\param members Members to add
+			\param layout Layout of \c members
+			\return reference to this StructureBuilder
+		*/
+		StructureBuilder& AddMembers(Span<const StructureMemberDescriptor> members, const StructureLayout& layout);
+
+		/*! Validate a list of members and replace every existing member with them, keeping the other properties
+			of the structure. The width and alignment are set from the computed layout.
+
+			\param members New members
+			\param error Description of the problem if the members were rejected
+			\return Whether the members were replaced
+		*/
+		bool ReplaceMembers(Span<const StructureMemberDescriptor> members, std::string& error);
+
+		/*! Replace every existing member using a layout previously computed by ComputeLayout
+
+			\param members New members
+			\param layout Layout of \c members, computed with a start offset of 0
+			\return reference to this StructureBuilder
+		*/
+		StructureBuilder& ReplaceMembers(Span<const StructureMemberDescriptor> members, const StructureLayout& layout);
 	};
 
 	/*!
@@ -8678,6 +10304,104 @@ namespace BinaryNinja {
 
 		std::vector<InstructionTextToken> GetTokensForValue(uint64_t value, size_t width, Ref<Type> type);
 		std::vector<EnumerationMember> GetMembers() const;
+
+		/*! Shared lookup index for this enumeration, see EnumerationIndex::Get
+
+			@threadsafe
+		*/
+		Ref<EnumerationIndex> GetIndex();
+	};
+
+	/*! Immutable lookup tables for an Enumeration, for code that maps many values to members, such as rendering
+		every operand of a function with a large enumeration applied. Members are copied out of the core once,
+		values are found through a hash map, and flag values are decomposed into members without calling into the
+		core. Tokens from Enumeration::GetTokensForValue are cached per value, width and type.
+
+		Indices are shared: EnumerationIndex::Get returns the same index for as long as the enumeration handle is
+		unchanged. Since enumerations are immutable, a modified enumeration is a new handle and gets a new index.
+
+		@threadsafe
+		\ingroup types
+	*/
+	class EnumerationIndex : public RefCountObject
+	{
+		struct TokenKey
+		{
+			uint64_t value;
+			size_t width;
+			BNType* type;
+
+			bool operator==(const TokenKey& other) const
+			{
+				return (value == other.value) && (width == other.width) && (type == other.type);
+			}
+		};
+
+		struct TokenKeyHash
+		{
+			size_t operator()(const TokenKey& key) const
+			{
+				return std::hash<uint64_t>()(key.value) ^ (std::hash<size_t>()(key.width) << 1) ^
+				    (std::hash<void*>()(key.type) << 2);
+			}
+		};
+
+		struct CachedTokens
+		{
+			// Keeps the type alive so its handle cannot be reused by another type while cached
+			Ref<Type> type;
+			std::vector<InstructionTextToken> tokens;
+		};
+
+		Ref<Enumeration> m_enumeration;
+		std::vector<EnumerationMember> m_members;
+		std::unordered_map<uint64_t, size_t> m_valueMembers;
+		// Members with a nonzero value, most bits first, for decomposing flag values
+		std::vector<size_t> m_flagMembers;
+		uint64_t m_flagMask = 0;
+
+		std::mutex m_tokenMutex;
+		std::unordered_map<TokenKey, CachedTokens, TokenKeyHash> m_tokens;
+
+		EnumerationIndex(Enumeration* enumeration);
+
+	  public:
+		static constexpr size_t MaxCachedTokens = 4096;
+
+		/*! Get the shared index for an enumeration, building it on first use
+
+			\param enumeration Enumeration to index
+			\return Index for the enumeration
+		*/
+		static Ref<EnumerationIndex> Get(Enumeration* enumeration);
+
+		Ref<Enumeration> GetEnumeration() const { return m_enumeration; }
+		const std::vector<EnumerationMember>& GetMembers() const { return m_members; }
+
+		/*! Find the member with a value. When several members share a value, the first one is returned.
+
+			\param value Value to look up
+			\return The member, or nullptr if no member has the value
+		*/
+		const EnumerationMember* GetMemberForValue(uint64_t value) const;
+
+		/*! Split a value into members whose values are disjoint sets of its bits, preferring members that cover
+			more bits. This is how flag enumerations such as protection or characteristics masks are displayed.
+
+			\param value Value to decompose
+			\param members Set to the indices of the members, in descending order of value
+			\return Whether the members cover every bit of the value
+		*/
+		bool DecomposeFlags(uint64_t value, std::vector<size_t>& members) const;
+
+		/*! Cached version of Enumeration::GetTokensForValue
+
+			\param value Value to render
+			\param width Width of the value in bytes
+			\param type Enumeration type the value is displayed as
+			\return Tokens for the value
+		*/
+		std::vector<InstructionTextToken> GetTokensForValue(uint64_t value, size_t width, Ref<Type> type);
 	};
 
 	/*! EnumerationBuilder is a convenience class used for building Enumeration Types.
@@ -12551,50 +14275,308 @@ namespace BinaryNinja {
 	};
 
 	/*!
-		\ingroup functionrecognizer
+		\ingroup highlevelil
 	*/
-	class FunctionRecognizer
+	struct DecompilationExportSettings
 	{
-		static bool RecognizeLowLevelILCallback(
-		    void* ctxt, BNBinaryView* data, BNFunction* func, BNLowLevelILFunction* il);
-		static bool RecognizeMediumLevelILCallback(
-		    void* ctxt, BNBinaryView* data, BNFunction* func, BNMediumLevelILFunction* il);
+		/*! Number of functions rendered concurrently, or 0 to use GetWorkerThreadCount() */
+		size_t threadCount = 0;
+		/*! Upper bound on the size of rendered text waiting to be written to the sink, in bytes. A worker will not
+			start on a new function while the limit is exceeded, unless that function is the next one to be written. */
+		size_t memoryLimit = 256 * 1024 * 1024;
+		/*! Release each function's advanced analysis data once it has been rendered, so the core can evict its IL */
+		bool releaseAnalysisData = true;
+		/*! Settings used to render the text, or nullptr for the defaults */
+		Ref<DisassemblySettings> settings;
+	};
+
+	/*! DecompilationExporter renders the HLIL text of many functions in parallel and delivers it to a sink in
+		increasing address order.
+
+		\b Example:
+		\code{.cpp}
+		DecompilationExporter exporter(bv);
+		exporter.Export([&](Function* func, const vector<DisassemblyTextLine>& lines) {
+			for (auto& line : lines)
+			{
+				for (auto& token : line.tokens)
+					out << token.text;
+				out << "\n";
+			}
+			return true;
+		});
+		\endcode
+
+		\ingroup highlevelil
+	*/
+	class DecompilationExporter
+	{
+		Ref<BinaryView> m_view;
+		DecompilationExportSettings m_settings;
 
 	  public:
-		FunctionRecognizer();
+		typedef std::function<bool(Function* func, const std::vector<DisassemblyTextLine>& lines)> Sink;
 
-		static void RegisterGlobalRecognizer(FunctionRecognizer* recog);
-		static void RegisterArchitectureFunctionRecognizer(Architecture* arch, FunctionRecognizer* recog);
+		DecompilationExporter(BinaryView* view, const DecompilationExportSettings& settings = DecompilationExportSettings());
 
-		virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il);
-		virtual bool RecognizeMediumLevelIL(BinaryView* data, Function* func, MediumLevelILFunction* il);
-	};
+		/*! Render every function in the view and pass the result to \c sink
 
-	class RelocationHandler :
-	    public CoreRefCountObject<BNRelocationHandler, BNNewRelocationHandlerReference, BNFreeRelocationHandler>
-	{
-		static bool GetRelocationInfoCallback(
-		    void* ctxt, BNBinaryView* view, BNArchitecture* arch, BNRelocationInfo* result, size_t resultCount);
-		static bool ApplyRelocationCallback(
-		    void* ctxt, BNBinaryView* view, BNArchitecture* arch, BNRelocation* reloc, uint8_t* dest, size_t len);
-		static size_t GetOperandForExternalRelocationCallback(void* ctxt, const uint8_t* data, uint64_t addr,
-		    size_t length, BNLowLevelILFunction* il, BNRelocation* relocation);
+			The sink is always called from the thread that called Export, one function at a time.
 
-	  protected:
-		RelocationHandler();
-		RelocationHandler(BNRelocationHandler* handler);
-		static void FreeCallback(void* ctxt);
+			\param sink Function receiving the rendered lines. Return false to stop the export.
+			\param progress Optional progress callback, called with the number of functions written so far
+			\return true if every function was written, false if the sink or progress callback cancelled the export
+		*/
+		bool Export(const Sink& sink, const std::function<bool(size_t, size_t)>& progress = {});
 
-	  public:
-		virtual bool GetRelocationInfo(
-		    Ref<BinaryView> view, Ref<Architecture> arch, std::vector<BNRelocationInfo>& result);
-		virtual bool ApplyRelocation(
-		    Ref<BinaryView> view, Ref<Architecture> arch, Ref<Relocation> reloc, uint8_t* dest, size_t len);
-		virtual size_t GetOperandForExternalRelocation(
-		    const uint8_t* data, uint64_t addr, size_t length, Ref<LowLevelILFunction> il, Ref<Relocation> relocation);
-	};
+		/*! Render the given functions and pass the result to \c sink in increasing address order
 
-	class CoreRelocationHandler : public RelocationHandler
+			\param funcs Functions to render
+			\param sink Function receiving the rendered lines. Return false to stop the export.
+			\param progress Optional progress callback, called with the number of functions written so far
+			\return true if every function was written, false if the sink or progress callback cancelled the export
+		*/
+		bool Export(std::vector<Ref<Function>> funcs, const Sink& sink,
+		    const std::function<bool(size_t, size_t)>& progress = {});
+
+		/*! Render the HLIL of a single function the same way Export does
+
+			\param func Function to render
+			\return Lines of the function's decompilation
+		*/
+		std::vector<DisassemblyTextLine> RenderFunction(Function* func);
+
+		/*! Approximate number of bytes held by a set of rendered lines
+
+			\param lines Rendered lines
+			\return Estimated memory usage in bytes
+		*/
+		static size_t EstimateSize(const std::vector<DisassemblyTextLine>& lines);
+	};
+
+	/*!
+		\ingroup lowlevelil
+	*/
+	struct ILArchiveWriteSettings
+	{
+		/*! Number of functions encoded concurrently, or 0 to use GetWorkerThreadCount() */
+		size_t threadCount = 0;
+		/*! IL forms written for each function. Only LowLevelIL, LiftedIL, MediumLevelIL, HighLevelIL and their
+			SSA forms are supported. */
+		std::vector<BNFunctionGraphType> forms = {LowLevelILFunctionGraph, MediumLevelILFunctionGraph,
+		    HighLevelILFunctionGraph};
+		/*! Record the type of every MLIL and HLIL expression */
+		bool includeTypes = true;
+	};
+
+	class ILArchive;
+
+	/*! Thrown when a function, instruction or expression index is out of range for an ILArchive, which includes
+		indices read from a corrupt archive
+
+		\ingroup lowlevelil
+	*/
+	class ILArchiveAccessException : public ExceptionWithStackTrace
+	{
+	  public:
+		ILArchiveAccessException() : ExceptionWithStackTrace("invalid access to IL archive") {}
+	};
+
+	/*! A single expression stored in an ILArchive. The operation is stored as the raw value of the
+		BNLowLevelILOperation, BNMediumLevelILOperation or BNHighLevelILOperation for the form it belongs to.
+		Operands hold the same raw values the core uses, so variables, registers and SSA versions can be decoded
+		with the usual helpers such as Variable::FromIdentifier.
+
+		\ingroup lowlevelil
+	*/
+	struct ILArchiveInstruction
+	{
+		const ILArchive* archive;
+		size_t bodyOffset;
+		size_t exprIndex;
+
+		uint32_t GetOperation() const;
+		template <class T>
+		T GetOperation() const
+		{
+			return (T)GetOperation();
+		}
+		uint32_t GetAttributes() const;
+		size_t GetSize() const;
+		uint32_t GetFlags() const;
+		uint32_t GetSourceOperand() const;
+		uint64_t GetAddress() const;
+		uint64_t GetRawOperandValue(size_t operand) const;
+		ILArchiveInstruction GetRawOperandAsExpr(size_t operand) const;
+		/*! Values of a list operand, such as the parameters of a call or the sources of a phi */
+		std::vector<uint64_t> GetRawOperandAsList(size_t operand) const;
+		/*! HLIL only, index of the parent expression */
+		size_t GetParent() const;
+		/*! MLIL and HLIL only, the type of the expression as text, or an empty string if it is not known */
+		std::string GetType() const;
+	};
+
+	/*! The IL of one function in a single form, as stored in an ILArchive
+
+		\ingroup lowlevelil
+	*/
+	struct ILArchiveILFunction
+	{
+		const ILArchive* archive;
+		size_t bodyOffset;
+
+		BNFunctionGraphType GetForm() const;
+		size_t GetExprCount() const;
+		size_t GetInstructionCount() const;
+		size_t GetIndexForInstruction(size_t i) const;
+		ILArchiveInstruction GetExpr(size_t expr) const;
+		ILArchiveInstruction GetInstruction(size_t i) const;
+		ILArchiveInstruction operator[](size_t i) const { return GetInstruction(i); }
+		/*! Basic blocks as half open [start, end) ranges of instruction indices */
+		std::vector<std::pair<size_t, size_t>> GetBasicBlocks() const;
+	};
+
+	/*! A function stored in an ILArchive
+
+		\ingroup lowlevelil
+	*/
+	struct ILArchiveFunction
+	{
+		const ILArchive* archive;
+		size_t index;
+
+		uint64_t GetStart() const;
+		std::string GetArchitectureName() const;
+		std::string GetSymbolName() const;
+		std::vector<BNFunctionGraphType> GetForms() const;
+		/*! Look up the IL for a form
+
+			\param form Form to look up
+			\param[out] result IL of the function in that form
+			\return Whether the form was stored for this function
+		*/
+		bool GetIL(BNFunctionGraphType form, ILArchiveILFunction& result) const;
+	};
+
+	/*! ILArchive is a compact, versioned, columnar file format holding the IL of the functions in a BinaryView, for
+		offline processing. Archives are written with WriteView and opened by memory mapping the file. Reading an
+		archive does not call into the core, so it can be done without a license or running analysis.
+
+		\b Example:
+		\code{.cpp}
+		ILArchive::WriteView(bv, "out.bnil");
+		...
+		Ref<ILArchive> archive = ILArchive::Open("out.bnil");
+		for (size_t i = 0; i < archive->GetFunctionCount(); i++)
+		{
+			ILArchiveILFunction il;
+			if (!archive->GetFunction(i).GetIL(MediumLevelILFunctionGraph, il))
+				continue;
+			for (size_t j = 0; j < il.GetInstructionCount(); j++)
+				if (il[j].GetOperation<BNMediumLevelILOperation>() == MLIL_CALL)
+					...
+		}
+		\endcode
+
+		\ingroup lowlevelil
+	*/
+	class ILArchive : public RefCountObject
+	{
+		const uint8_t* m_data = nullptr;
+		size_t m_length = 0;
+		std::vector<uint32_t> m_stringOffsets;
+		size_t m_stringData = 0;
+		size_t m_functionCount = 0;
+		size_t m_functionTable = 0;
+#ifdef WIN32
+		HANDLE m_file = INVALID_HANDLE_VALUE;
+		HANDLE m_mapping = nullptr;
+#endif
+
+		ILArchive() = default;
+		bool Load();
+
+		friend struct ILArchiveFunction;
+
+	  public:
+		static constexpr uint32_t Version = 2;
+
+		~ILArchive();
+
+		/*! Write the IL of every function in \c view to a file
+
+			\param view View to serialize
+			\param path Path of the archive, which is overwritten
+			\param settings Forms to include and parallelism
+			\param progress Optional progress callback, called with the number of functions written so far
+			\return Whether the archive was written successfully
+		*/
+		static bool WriteView(BinaryView* view, const std::string& path,
+		    const ILArchiveWriteSettings& settings = ILArchiveWriteSettings(),
+		    const std::function<bool(size_t, size_t)>& progress = {});
+
+		/*! Memory map an archive written with WriteView
+
+			\param path Path of the archive
+			\return The archive, or nullptr if the file could not be opened or is not a valid archive
+		*/
+		static Ref<ILArchive> Open(const std::string& path);
+
+		size_t GetFunctionCount() const { return m_functionCount; }
+		ILArchiveFunction GetFunction(size_t i) const;
+		/*! Find the function starting at \c addr, functions are stored in increasing address order */
+		bool GetFunctionAt(uint64_t addr, ILArchiveFunction& result) const;
+
+		std::string GetString(uint32_t id) const;
+		const uint8_t* GetData() const { return m_data; }
+		size_t GetLength() const { return m_length; }
+	};
+
+	/*!
+		\ingroup functionrecognizer
+	*/
+	class FunctionRecognizer
+	{
+		static bool RecognizeLowLevelILCallback(
+		    void* ctxt, BNBinaryView* data, BNFunction* func, BNLowLevelILFunction* il);
+		static bool RecognizeMediumLevelILCallback(
+		    void* ctxt, BNBinaryView* data, BNFunction* func, BNMediumLevelILFunction* il);
+
+	  public:
+		FunctionRecognizer();
+
+		static void RegisterGlobalRecognizer(FunctionRecognizer* recog);
+		static void RegisterArchitectureFunctionRecognizer(Architecture* arch, FunctionRecognizer* recog);
+
+		virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il);
+		virtual bool RecognizeMediumLevelIL(BinaryView* data, Function* func, MediumLevelILFunction* il);
+	};
+
+	class RelocationHandler :
+	    public CoreRefCountObject<BNRelocationHandler, BNNewRelocationHandlerReference, BNFreeRelocationHandler>
+	{
+		static bool GetRelocationInfoCallback(
+		    void* ctxt, BNBinaryView* view, BNArchitecture* arch, BNRelocationInfo* result, size_t resultCount);
+		static bool ApplyRelocationCallback(
+		    void* ctxt, BNBinaryView* view, BNArchitecture* arch, BNRelocation* reloc, uint8_t* dest, size_t len);
+		static size_t GetOperandForExternalRelocationCallback(void* ctxt, const uint8_t* data, uint64_t addr,
+		    size_t length, BNLowLevelILFunction* il, BNRelocation* relocation);
+
+	  protected:
+		RelocationHandler();
+		RelocationHandler(BNRelocationHandler* handler);
+		static void FreeCallback(void* ctxt);
+
+	  public:
+		virtual bool GetRelocationInfo(
+		    Ref<BinaryView> view, Ref<Architecture> arch, std::vector<BNRelocationInfo>& result);
+		virtual bool ApplyRelocation(
+		    Ref<BinaryView> view, Ref<Architecture> arch, Ref<Relocation> reloc, uint8_t* dest, size_t len);
+		virtual size_t GetOperandForExternalRelocation(
+		    const uint8_t* data, uint64_t addr, size_t length, Ref<LowLevelILFunction> il, Ref<Relocation> relocation);
+	};
+
+	class CoreRelocationHandler : public RelocationHandler
 	{
 	  public:
 		CoreRelocationHandler(BNRelocationHandler* handler);
@@ -13966,6 +15948,8 @@ namespace BinaryNinja {
 	/*!
 		\ingroup typeparser
 	*/
+	class TypeParserCache;
+
 	class TypeParser: public StaticCoreRefCountObject<BNTypeParser>
 	{
 		std::string m_nameForRegister;
@@ -14099,6 +16083,39 @@ namespace BinaryNinja {
 			std::vector<TypeParserError>& errors
 		);
 
+		/*!
+		    Parse many independent source files in parallel and merge them into one result
+
+		    Files are listed in dependency order. When several files define the same name, the definition from the
+		    earliest file is kept, and a warning is reported if a later definition differs from it. Every file is
+		    parsed even if an earlier one fails.
+
+		    \param fileNames Names of the files on disk containing the source, dependencies first
+		    \param platform Platform to assume the types are relevant to
+		    \param existingTypes Map of all existing types to use for parsing context
+		    \param options String arguments to pass as options, e.g. command line arguments
+		    \param includeDirs List of directories to include in the header search path
+		    \param autoTypeSource Optional source of types if used for automatically generated types
+		    \param result Reference to structure into which the merged results will be written
+		    \param errors Reference to a list into which any parse errors will be written
+		    \param cache Optional cache of previous results to reuse and update
+		    \param threadCount Number of files parsed at once, 0 for the worker thread count. Parsers that cannot
+		                       parse concurrently should be given 1.
+		    \return True if every file was parsed successfully
+		*/
+		bool ParseTypesFromSourceFiles(
+			const std::vector<std::string>& fileNames,
+			Ref<Platform> platform,
+			const std::map<QualifiedName, TypeAndId>& existingTypes,
+			const std::vector<std::string>& options,
+			const std::vector<std::string>& includeDirs,
+			const std::string& autoTypeSource,
+			TypeParserResult& result,
+			std::vector<TypeParserError>& errors,
+			TypeParserCache* cache = nullptr,
+			size_t threadCount = 0
+		);
+
 		/*!
 		    Parse a single type and name from a string containing their definition.
 		    \param source Source code to parse
@@ -14160,6 +16177,99 @@ namespace BinaryNinja {
 		) override;
 	};
 
+	/*! Persists parsed TypeParserResults on disk, so that headers parsed in an earlier session are not parsed again
+
+		Results are keyed by the parser, platform, file name, options, include directories, automatic type source,
+		the names, ids and definitions of existing types, and a hash of the source text. Each result is stored as a
+		type library in the cache directory. Headers pulled in through include directories are not part of the key,
+		so the cache should be cleared when they change.
+
+		\code{.cpp}
+		TypeParserCache cache;
+		TypeParserResult result;
+		vector<TypeParserError> errors;
+		cache.ParseTypesFromSource(TypeParser::GetDefault(), source, "windows.h", platform, {}, options, includeDirs,
+			"", result, errors);
+		\endcode
+
+		@threadsafe
+
+		\ingroup typeparser
+	*/
+	class TypeParserCache
+	{
+		std::string m_directory;
+
+		std::string GetPath(const std::string& key) const;
+
+	  public:
+		/*!
+		    \param directory Directory holding the cached results, created when the first result is stored
+		*/
+		explicit TypeParserCache(const std::string& directory = GetDefaultDirectory());
+
+		/*!
+		    \return The typeparsercache directory inside the user directory
+		*/
+		static std::string GetDefaultDirectory();
+
+		/*!
+		    Compute the key identifying a parse of the given source
+		    \return Key for Load and Store
+		*/
+		static std::string GetKey(
+			TypeParser* parser,
+			const std::string& source,
+			const std::string& fileName,
+			Ref<Platform> platform,
+			const std::map<QualifiedName, TypeAndId>& existingTypes,
+			const std::vector<std::string>& options,
+			const std::vector<std::string>& includeDirs,
+			const std::string& autoTypeSource
+		);
+
+		/*!
+		    Read a cached result
+		    \param key Key from GetKey
+		    \param platform Platform the result was parsed for
+		    \param result Reference to structure into which the result will be written
+		    \return True if a result was cached for the key
+		*/
+		bool Load(const std::string& key, Ref<Platform> platform, TypeParserResult& result);
+
+		/*!
+		    Write a result to the cache, replacing any existing result for the key
+		    \param key Key from GetKey
+		    \param platform Platform the result was parsed for
+		    \param result Result to store
+		    \return True if the result was written
+		*/
+		bool Store(const std::string& key, Ref<Platform> platform, const TypeParserResult& result);
+
+		/*!
+		    Parse source with TypeParser::ParseTypesFromSource, reusing a cached result when there is one. Results
+		    are only stored when parsing succeeded without errors.
+		    \return True if parsing was successful
+		*/
+		bool ParseTypesFromSource(
+			TypeParser* parser,
+			const std::string& source,
+			const std::string& fileName,
+			Ref<Platform> platform,
+			const std::map<QualifiedName, TypeAndId>& existingTypes,
+			const std::vector<std::string>& options,
+			const std::vector<std::string>& includeDirs,
+			const std::string& autoTypeSource,
+			TypeParserResult& result,
+			std::vector<TypeParserError>& errors
+		);
+
+		/*!
+		    Remove every cached result
+		*/
+		void Clear();
+	};
+
 	/*!
 		\ingroup typeprinter
 	*/
@@ -14474,6 +16584,8 @@ namespace BinaryNinja {
 	class DownloadProvider : public StaticCoreRefCountObject<BNDownloadProvider>
 	{
 		std::string m_nameForRegister;
+		std::mutex m_idleMutex;
+		std::vector<Ref<DownloadInstance>> m_idleInstances;
 
 	  protected:
 		DownloadProvider(const std::string& name);
@@ -14484,6 +16596,23 @@ namespace BinaryNinja {
 	  public:
 		virtual Ref<DownloadInstance> CreateNewInstance() = 0;
 
+		/*! Get an instance to perform a request with, reusing an idle one if there is one. Providers that keep a
+			connection open per instance can then reuse it for later requests to the same host.
+
+			\note Idle instances belong to this DownloadProvider object, so callers that want connections reused
+			should share one object rather than looking the provider up again for every request.
+
+			@threadsafe
+		*/
+		Ref<DownloadInstance> AcquireInstance();
+
+		/*! Return an instance from AcquireInstance once its request completed. Instances whose request failed
+			should be dropped instead, as their connection may no longer be usable.
+
+			@threadsafe
+		*/
+		void ReleaseInstance(Ref<DownloadInstance> instance);
+
 		static std::vector<Ref<DownloadProvider>> GetList();
 		static Ref<DownloadProvider> GetByName(const std::string& name);
 		static void Register(DownloadProvider* provider);
@@ -15194,6 +17323,31 @@ namespace BinaryNinja {
 		*/
 		std::string GetJson(const std::string& key, Ref<BinaryView> view = nullptr, BNSettingsScope* scope = nullptr);
 
+		/*! Get the current values of several settings at once
+
+			\code{.cpp}
+			Json::Value values = Settings::Instance()->GetMany({"myPlugin.verbose", "myPlugin.maxDepth"}, bv);
+			bool verbose = values["myPlugin.verbose"].asBool();
+			\endcode
+
+			\param keys Keys of the settings to get
+			\param view BinaryView, for factoring in resource-scoped settings
+			\param scope Scope for the settings
+			\return JSON object mapping each key to its value. Unknown keys map to null.
+		*/
+		Json::Value GetMany(const std::vector<std::string>& keys, Ref<BinaryView> view = nullptr,
+		    BNSettingsScope scope = SettingsAutoScope);
+
+		/*! Get the current values of every setting in a group, such as all of a plugin's settings
+
+			\param group Group name, the part of the keys before the first '.'
+			\param view BinaryView, for factoring in resource-scoped settings
+			\param scope Scope for the settings
+			\return JSON object mapping each key in the group to its value
+		*/
+		Json::Value GetGroup(const std::string& group, Ref<BinaryView> view = nullptr,
+		    BNSettingsScope scope = SettingsAutoScope);
+
 		bool Set(const std::string& key, bool value, Ref<BinaryView> view = nullptr,
 		    BNSettingsScope scope = SettingsAutoScope);
 		bool Set(const std::string& key, double value, Ref<BinaryView> view = nullptr,
@@ -15212,6 +17366,171 @@ namespace BinaryNinja {
 		    BNSettingsScope scope = SettingsAutoScope);
 		bool SetJson(const std::string& key, const std::string& value, Ref<BinaryView> view = nullptr,
 		    BNSettingsScope scope = SettingsAutoScope);
+
+		/*! Discard the values cached by every CachedSetting in this module
+
+			Changes made through this API, and destruction of views, invalidate cached values automatically. Call this
+			after settings are changed in a way this module is not told about, such as from Python, the UI or another
+			plugin.
+
+			@threadsafe
+		*/
+		static void InvalidateCachedSettings();
+
+		/*! Generation counter for CachedSetting, incremented whenever cached values must be discarded */
+		static uint64_t GetCacheGeneration() { return m_cacheGeneration.load(std::memory_order_acquire); }
+
+		/*! Make sure cached values are invalidated when views are destroyed. Called by CachedSetting. */
+		static void WatchViewDestruction();
+
+	  private:
+		static inline std::atomic<uint64_t> m_cacheGeneration {1};
+	};
+
+	/*! CachedSetting resolves one setting and caches its value for each view and scope it is read with
+
+		A cached read is a pointer load and a generation check, with no call into the core and no allocation, so
+		settings can be checked in hot loops. Values are refreshed after Settings::InvalidateCachedSettings, which
+		happens automatically for changes made through this API and whenever a view is destroyed.
+
+		Get returns a reference to the cached value. A superseded value is freed by a later refresh once the cache
+		generation has moved on again, so the reference stays valid until the settings have been invalidated twice
+		more. Copy the value to keep it for longer.
+
+		\code{.cpp}
+		static CachedSetting<bool> verbose("myPlugin.verbose");
+
+		for (auto& instr : *il)
+		{
+			if (verbose.Get(bv))
+				LogDebugF("{:#x}", instr.address);
+		}
+		\endcode
+
+		Supported types are those of Settings::Get: bool, double, int64_t, uint64_t, std::string and
+		std::vector<std::string>.
+
+		@threadsafe
+
+		\ingroup settings
+	*/
+	template <typename T>
+	class CachedSetting
+	{
+		struct Entry
+		{
+			BNBinaryView* view;
+			BNSettingsScope scope;
+			uint64_t generation;
+			BNSettingsScope resolvedScope;
+			T value;
+		};
+
+		struct RetiredEntry
+		{
+			std::unique_ptr<Entry> entry;
+			// Generation current when the entry was superseded
+			uint64_t generation;
+		};
+
+		Ref<Settings> m_settings;
+		std::string m_key;
+		std::atomic<Entry*> m_last;
+		std::mutex m_mutex;
+		// Newest entry for each view and scope read since the last change
+		std::vector<std::unique_ptr<Entry>> m_current;
+		// Superseded entries, which reads that loaded m_last before the change may still be using
+		std::vector<RetiredEntry> m_retired;
+
+		const Entry* Refresh(BNBinaryView* view, BNSettingsScope scope)
+		{
+			if (view)
+				Settings::WatchViewDestruction();
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			uint64_t generation = Settings::GetCacheGeneration();
+
+			// Entries superseded before the current generation started are only reachable by reads that have
+			// outlived a further invalidation, which Get does not allow, so they can be freed here without
+			// the fast path having to announce itself
+			size_t kept = 0;
+			for (auto& retired : m_retired)
+			{
+				if (retired.generation == generation)
+					m_retired[kept++] = std::move(retired);
+			}
+			m_retired.resize(kept);
+
+			Entry* current = nullptr;
+			for (size_t i = 0; i < m_current.size();)
+			{
+				if ((m_current[i]->view == view) && (m_current[i]->scope == scope) &&
+				    (m_current[i]->generation == generation))
+				{
+					current = m_current[i].get();
+					i++;
+				}
+				else if (m_current[i]->generation != generation)
+				{
+					// Stale entries are dropped rather than updated, so views that are no longer read (or have
+					// been destroyed) do not keep entries alive
+					m_retired.push_back({std::move(m_current[i]), generation});
+					m_current.erase(m_current.begin() + i);
+				}
+				else
+				{
+					i++;
+				}
+			}
+
+			if (!current)
+			{
+				// The generation is read before the value, so a change that races with this read leaves the new
+				// entry stale instead of caching an outdated value as current
+				std::unique_ptr<Entry> entry(new Entry);
+				entry->view = view;
+				entry->scope = scope;
+				entry->generation = generation;
+				entry->resolvedScope = scope;
+				Ref<BinaryView> viewRef = view ? new BinaryView(BNNewViewReference(view)) : nullptr;
+				entry->value = m_settings->Get<T>(m_key, viewRef, &entry->resolvedScope);
+				current = entry.get();
+				m_current.push_back(std::move(entry));
+			}
+
+			m_last.store(current, std::memory_order_release);
+			return current;
+		}
+
+	  public:
+		CachedSetting(const std::string& key, Ref<Settings> settings = nullptr) :
+		    m_settings(settings ? settings : Settings::Instance()), m_key(key), m_last(nullptr)
+		{}
+
+		CachedSetting(const CachedSetting&) = delete;
+		CachedSetting& operator=(const CachedSetting&) = delete;
+
+		const std::string& GetKey() const { return m_key; }
+
+		/*! Get the value of the setting
+
+			\param view BinaryView, for factoring in resource-scoped settings
+			\param scope Scope to read the setting from
+			\param resolvedScope If not null, receives the scope the value was found in
+			\return Value of the setting, valid until the settings have been invalidated twice more
+		*/
+		const T& Get(BinaryView* view = nullptr, BNSettingsScope scope = SettingsAutoScope,
+		    BNSettingsScope* resolvedScope = nullptr)
+		{
+			BNBinaryView* object = view ? view->GetObject() : nullptr;
+			const Entry* entry = m_last.load(std::memory_order_acquire);
+			if (!entry || (entry->view != object) || (entry->scope != scope) ||
+			    (entry->generation != Settings::GetCacheGeneration()))
+				entry = Refresh(object, scope);
+			if (resolvedScope)
+				*resolvedScope = entry->resolvedScope;
+			return entry->value;
+		}
 	};
 
 	// explicit specializations
@@ -15464,6 +17783,90 @@ namespace BinaryNinja {
 		static int Compare(LinearViewCursor* a, LinearViewCursor* b);
 	};
 
+	/*!
+		\ingroup lineardisassembly
+	*/
+	struct LinearViewExportSettings
+	{
+		/*! Number of chunks rendered concurrently, or 0 to use GetWorkerThreadCount() */
+		size_t threadCount = 0;
+		/*! Number of chunks the view is split into per thread, to even out the work */
+		size_t chunksPerThread = 8;
+		/*! Prefix every line with its address */
+		bool includeAddresses = true;
+		/*! Size of the output file buffer, in bytes */
+		size_t bufferSize = 4 * 1024 * 1024;
+	};
+
+	/*! LinearViewExporter writes the full linear view of a BinaryView as text, rendering independent parts of the
+		address space in parallel.
+
+		The view is split into chunks at function and data variable boundaries. Each chunk is rendered with its own
+		LinearViewObject and LinearViewCursor, and chunks are reassembled in address order.
+
+		\b Example:
+		\code{.cpp}
+		Ref<DisassemblySettings> settings = new DisassemblySettings();
+		LinearViewExporter exporter(bv, LinearViewObject::CreateHighLevelIL, settings);
+		exporter.ExportToFile("out.lst");
+		\endcode
+
+		\ingroup lineardisassembly
+	*/
+	class LinearViewExporter
+	{
+	  public:
+		typedef std::function<Ref<LinearViewObject>(BinaryView* view, DisassemblySettings* settings)> Factory;
+
+	  private:
+		Ref<BinaryView> m_view;
+		Factory m_factory;
+		Ref<DisassemblySettings> m_settings;
+		LinearViewExportSettings m_exportSettings;
+
+		std::vector<uint64_t> GetChunkBoundaries(size_t chunkCount);
+		void RenderChunk(uint64_t start, uint64_t end, bool fromBeginning, std::string& output);
+
+	  public:
+		/*!
+			\param view View to export
+			\param factory Function creating the root object of the linear view, such as
+				LinearViewObject::CreateDisassembly
+			\param settings Settings used to render the text, or nullptr for the defaults
+			\param exportSettings Parallelism and output options
+		*/
+		LinearViewExporter(BinaryView* view, const Factory& factory, DisassemblySettings* settings = nullptr,
+		    const LinearViewExportSettings& exportSettings = LinearViewExportSettings());
+
+		/*! Render the linear view and pass the text of each chunk to \c sink in address order
+
+			The sink is always called from the thread that called Export.
+
+			\param sink Function receiving rendered text. Return false to stop the export.
+			\param progress Optional progress callback, called with the number of chunks written so far
+			\return true if the whole view was written, false if the export was cancelled
+		*/
+		bool Export(const std::function<bool(const std::string& text)>& sink,
+		    const std::function<bool(size_t, size_t)>& progress = {});
+
+		/*! Render the linear view into a file
+
+			\param path Path of the output file, which is overwritten
+			\param progress Optional progress callback, called with the number of chunks written so far
+			\return true if the whole view was written, false if the file could not be written or the export
+				was cancelled
+		*/
+		bool ExportToFile(const std::string& path, const std::function<bool(size_t, size_t)>& progress = {});
+
+		/*! Format a single line the same way the exporter does
+
+			\param line Line to format
+			\param includeAddress Whether to prefix the line with its address
+			\param output String the line is appended to, including a trailing newline
+		*/
+		static void FormatLine(const LinearDisassemblyLine& line, bool includeAddress, std::string& output);
+	};
+
 	/*!
 
 		\ingroup simplifyname
@@ -15527,10 +17930,90 @@ namespace BinaryNinja {
 		DebugFunctionInfo(std::string shortName, std::string fullName, std::string rawName, uint64_t address,
 		    Ref<Type> type, Ref<Platform> platform) :
 		    shortName(shortName),
-		    fullName(fullName), rawName(rawName), address(address), platform(platform)
+		    fullName(fullName), rawName(rawName), address(address), type(type), platform(platform)
 		{}
 	};
 
+	/*! Type added by DebugInfo::AddTypes. The name is not copied and must outlive the call.
+
+		\ingroup debuginfo
+	*/
+	struct DebugTypeDefinition
+	{
+		const char* name;
+		Type* type;
+	};
+
+	/*! Function added by DebugInfo::AddFunctions. Names may be null and are not copied, so they must outlive
+		the call.
+
+		\ingroup debuginfo
+	*/
+	struct DebugFunctionDefinition
+	{
+		const char* shortName;
+		const char* fullName;
+		const char* rawName;
+		uint64_t address;
+		Type* type;
+		Platform* platform;
+	};
+
+	/*! Data variable added by DebugInfo::AddDataVariables. The name may be null and is not copied.
+
+		\ingroup debuginfo
+	*/
+	struct DebugDataVariableDefinition
+	{
+		uint64_t address;
+		Type* type;
+		const char* name;
+	};
+
+	/*! A batch of debug info definitions whose names live in an arena owned by the batch, and whose types and
+		platforms are kept referenced until the batch is destroyed. Debug info parsers fill a batch per unit of
+		work and hand it to DebugInfo::AddBatch or a DebugInfoBatchSink, which avoids converting and copying
+		every entry on its way into the core.
+
+		Batches can be moved but not copied. Moving a batch does not invalidate its definitions.
+
+		\ingroup debuginfo
+	*/
+	class DebugInfoBatch
+	{
+		static constexpr size_t ArenaBlockSize = 64 * 1024;
+
+		std::vector<std::unique_ptr<char[]>> m_blocks;
+		char* m_blockCursor = nullptr;
+		size_t m_blockRemaining = 0;
+		std::vector<Ref<Type>> m_typeReferences;
+		std::vector<Ref<Platform>> m_platformReferences;
+		std::vector<DebugTypeDefinition> m_types;
+		std::vector<DebugFunctionDefinition> m_functions;
+		std::vector<DebugDataVariableDefinition> m_dataVariables;
+
+		const char* StoreString(const std::string& str);
+		Type* ReferenceType(const Ref<Type>& type);
+		Platform* ReferencePlatform(const Ref<Platform>& platform);
+
+	  public:
+		DebugInfoBatch() = default;
+		DebugInfoBatch(DebugInfoBatch&&) = default;
+		DebugInfoBatch& operator=(DebugInfoBatch&&) = default;
+
+		void AddType(const std::string& name, Ref<Type> type);
+		void AddFunction(const DebugFunctionInfo& function);
+		void AddDataVariable(uint64_t address, Ref<Type> type, const std::string& name = "");
+
+		const std::vector<DebugTypeDefinition>& GetTypes() const { return m_types; }
+		const std::vector<DebugFunctionDefinition>& GetFunctions() const { return m_functions; }
+		const std::vector<DebugDataVariableDefinition>& GetDataVariables() const { return m_dataVariables; }
+
+		size_t GetCount() const { return m_types.size() + m_functions.size() + m_dataVariables.size(); }
+		bool IsEmpty() const { return GetCount() == 0; }
+		void Clear();
+	};
+
 	/*!
 		\ingroup debuginfo
 	*/
@@ -15575,6 +18058,90 @@ namespace BinaryNinja {
 		bool AddType(const std::string& name, Ref<Type> type);
 		bool AddFunction(const DebugFunctionInfo& function);
 		bool AddDataVariable(uint64_t address, Ref<Type> type, const std::string& name = "");
+
+		/*! Add many types at once, without converting or copying each entry
+
+			\param types Types to add
+			\return Number of types that were added
+		*/
+		size_t AddTypes(Span<const DebugTypeDefinition> types);
+
+		/*! Add many functions at once, without converting or copying each entry
+
+			\param functions Functions to add
+			\return Number of functions that were added
+		*/
+		size_t AddFunctions(Span<const DebugFunctionDefinition> functions);
+
+		/*! Add many data variables at once, without converting or copying each entry
+
+			\param variables Data variables to add
+			\return Number of data variables that were added
+		*/
+		size_t AddDataVariables(Span<const DebugDataVariableDefinition> variables);
+
+		/*! Add every type, function and data variable in a batch, in that order
+
+			\param batch Batch to add
+			\return Number of entries that were added
+		*/
+		size_t AddBatch(const DebugInfoBatch& batch);
+	};
+
+	/*! Collects batches produced by parser worker threads and adds them to a single DebugInfo. Any thread may
+		submit batches, while only the thread that owns the sink commits them, so the DebugInfo is never
+		modified concurrently. Submitting blocks while too many batches are waiting to be committed, which
+		bounds the memory held by a fast producer.
+
+		\ingroup debuginfo
+	*/
+	class DebugInfoBatchSink
+	{
+		Ref<DebugInfo> m_debugInfo;
+		size_t m_maxPending;
+		std::mutex m_mutex;
+		std::condition_variable m_pendingCond;
+		std::condition_variable m_spaceCond;
+		std::vector<DebugInfoBatch> m_pending;
+		bool m_closed = false;
+		size_t m_committed = 0;
+
+	  public:
+		/*!
+			\param debugInfo DebugInfo that batches are added to
+			\param maxPending Number of uncommitted batches after which Submit blocks, or 0 for no limit
+		*/
+		DebugInfoBatchSink(Ref<DebugInfo> debugInfo, size_t maxPending = 0);
+
+		/*! Queue a batch to be committed
+
+			@threadsafe
+
+			\param batch Batch to queue
+			\return false if the sink was closed and the batch was discarded
+		*/
+		bool Submit(DebugInfoBatch&& batch);
+
+		/*! Stop accepting batches, waking any thread blocked in Submit or Commit
+
+			@threadsafe
+
+			\param discardPending Drop batches that have not been committed yet
+		*/
+		void Close(bool discardPending = false);
+
+		/*! Add all queued batches to the DebugInfo. Must only be called from one thread at a time.
+
+			\param wait Block until a batch is queued or the sink is closed
+			\return false once the sink is closed and every queued batch has been committed
+		*/
+		bool Commit(bool wait = false);
+
+		/*! Number of entries committed so far
+
+			@threadsafe
+		*/
+		size_t GetCommittedCount();
 	};
 
 	/*!
@@ -15612,6 +18179,22 @@ namespace BinaryNinja {
 		virtual bool IsValid(Ref<BinaryView>) = 0;
 		virtual bool ParseInfo(
 			Ref<DebugInfo>, Ref<BinaryView>, Ref<BinaryView>, std::function<bool(size_t, size_t)>) = 0;
+
+	  protected:
+		/*! Parse independent units of debug info, such as DWARF compilation units or PDB modules, on worker
+			threads. Each call to \c parseUnit fills its own batch, which is added to \c debugInfo from the
+			calling thread through a DebugInfoBatchSink. Intended to be called from ParseInfo.
+
+			\param debugInfo DebugInfo to add entries to
+			\param unitCount Number of units to parse
+			\param parseUnit Parses one unit into a batch, returning false to abort the parse. Must be thread safe.
+			\param progress Progress callback, called from the calling thread. Returning false aborts the parse.
+			\param threadCount Maximum number of worker threads, or 0 to use GetWorkerThreadCount()
+			\return false if the parse was aborted
+		*/
+		static bool ParseUnits(Ref<DebugInfo> debugInfo, size_t unitCount,
+		    const std::function<bool(size_t unit, DebugInfoBatch& batch)>& parseUnit,
+		    const std::function<bool(size_t, size_t)>& progress, size_t threadCount = 0);
 	};
 
 	/*! Class for storing secrets (e.g. tokens) in a system-specific manner
@@ -16097,6 +18680,224 @@ namespace BinaryNinja {
 		void Finalize();
 	};
 
+	/*! A type library split into small shards behind a memory-mapped name index, so that a lookup only loads the
+		shard holding the requested type instead of the whole library.
+
+		Libraries are converted once with Convert, which writes a directory holding \c index.bntx and one
+		\c shard_N.bntl type library per shard. Types that reference each other are placed in the same shard where
+		possible. Each index entry lists the named types its type references, so that GetNamedTypeWithDependencies
+		can load exactly the types needed to use a type. Recently used types and shards are kept in LRU caches.
+
+		\code{.cpp}
+		LazyTypeLibrary::Convert(TypeLibrary::LoadFromFile("win32.bntl"), "win32.lazy");
+		Ref<LazyTypeLibrary> library = LazyTypeLibrary::Open("win32.lazy");
+		for (auto& type : library->GetNamedTypeWithDependencies(QualifiedName("OVERLAPPED")))
+			view->DefineType(Type::GenerateAutoTypeId("lazy", type.name), type.name, type.type);
+		\endcode
+
+		@threadsafe
+
+		\ingroup types
+	*/
+	class LazyTypeLibrary : public RefCountObject
+	{
+		struct CachedType
+		{
+			Ref<Type> type;
+			std::list<size_t>::iterator order;
+		};
+
+		struct CachedShard
+		{
+			Ref<TypeLibrary> library;
+			std::list<uint32_t>::iterator order;
+		};
+
+		std::string m_directory;
+		const uint8_t* m_data = nullptr;
+		size_t m_length = 0;
+		size_t m_entryCount = 0;
+		size_t m_entryTable = 0;
+		size_t m_dependencyCount = 0;
+		size_t m_dependencyTable = 0;
+		size_t m_shardCount = 0;
+		size_t m_stringData = 0;
+		size_t m_stringLength = 0;
+		size_t m_typeCount = 0;
+		std::vector<std::string> m_info;
+#ifdef WIN32
+		HANDLE m_file = INVALID_HANDLE_VALUE;
+		HANDLE m_mapping = nullptr;
+#endif
+
+		std::mutex m_cacheMutex;
+		size_t m_typeCacheSize;
+		size_t m_shardCacheSize;
+		std::list<size_t> m_typeOrder;
+		std::unordered_map<size_t, CachedType> m_types;
+		std::list<uint32_t> m_shardOrder;
+		std::unordered_map<uint32_t, CachedShard> m_shards;
+		uint64_t m_shardLoads = 0;
+
+		LazyTypeLibrary(size_t typeCacheSize, size_t shardCacheSize);
+		bool Load();
+		bool FindEntry(const QualifiedName& name, bool object, size_t& result) const;
+		QualifiedName GetEntryName(size_t entry) const;
+		Ref<TypeLibrary> GetShard(uint32_t shard);
+		Ref<Type> GetEntryType(size_t entry);
+		std::vector<QualifiedName> GetEntryNames(bool objects) const;
+
+	  public:
+		static constexpr uint32_t Version = 1;
+		static constexpr size_t DefaultTypesPerShard = 256;
+		static constexpr size_t DefaultTypeCacheSize = 4096;
+		static constexpr size_t DefaultShardCacheSize = 16;
+
+		~LazyTypeLibrary();
+
+		/*! Write \c library in the sharded format
+
+			\param library Library to convert
+			\param directory Directory to write the index and shards to, created if needed
+			\param typesPerShard Number of named types and objects stored in each shard
+			\return Whether every file was written
+		*/
+		static bool Convert(
+		    TypeLibrary* library, const std::string& directory, size_t typesPerShard = DefaultTypesPerShard);
+
+		/*! Memory map the index of a converted library
+
+			\param directory Directory written by Convert
+			\param typeCacheSize Number of deserialized types kept in memory
+			\param shardCacheSize Number of loaded shards kept in memory
+			\return The library, or nullptr if the directory does not hold a valid index
+		*/
+		static Ref<LazyTypeLibrary> Open(const std::string& directory, size_t typeCacheSize = DefaultTypeCacheSize,
+		    size_t shardCacheSize = DefaultShardCacheSize);
+
+		std::string GetName() const;
+		std::string GetGuid() const;
+		std::string GetDependencyName() const;
+		std::string GetArchitectureName() const;
+		std::vector<std::string> GetPlatformNames() const;
+
+		size_t GetNamedTypeCount() const { return m_typeCount; }
+		size_t GetNamedObjectCount() const { return m_entryCount - m_typeCount; }
+		/*! Names are read from the index without loading any shard */
+		std::vector<QualifiedName> GetNamedTypeNames() const;
+		std::vector<QualifiedName> GetNamedObjectNames() const;
+
+		Ref<Type> GetNamedType(const QualifiedName& name);
+		Ref<Type> GetNamedObject(const QualifiedName& name);
+
+		/*! Get a named type along with every named type it references, directly or indirectly
+
+			\param name Name of the type
+			\return The requested type first, followed by its dependencies. Empty if the type does not exist.
+		*/
+		std::vector<QualifiedNameAndType> GetNamedTypeWithDependencies(const QualifiedName& name);
+
+		/*! Number of shards loaded from disk so far, including reloads of shards evicted from the cache */
+		uint64_t GetShardLoadCount();
+	};
+
+	/*! One type produced by the build stage of a TypeImporter
+
+		\ingroup types
+	*/
+	struct TypeImportEntry
+	{
+		/*! Id passed to BinaryView::DefineTypes. When empty, an auto type id is generated from the name. */
+		std::string id;
+		QualifiedName name;
+		Ref<Type> type;
+	};
+
+	/*! Imports a large number of types into a BinaryView, such as every type record of a PDB, in three stages:
+
+		1. Build: a caller provided function turns each source record into a TypeImportEntry. Records are built
+		   on worker threads, so the function must be thread safe and should only use local TypeBuilder and
+		   StructureBuilder objects.
+		2. Sort: entries are ordered so that each type comes after the types it uses by value, following the same
+		   rules as BinaryView::GetDependencySortedTypes. References through pointers do not order types, and
+		   cycles are broken in input order.
+		3. Apply: the sorted entries are defined in chunks, one core call per chunk, so each chunk only refers
+		   to types from earlier chunks or from itself.
+
+		Progress is reported from the calling thread and covers both the build and apply stages.
+
+		\code{.cpp}
+		TypeImporter importer(view);
+		auto ids = importer.Import(records.size(), [&](size_t i, TypeImportEntry& entry) {
+			entry.id = Type::GenerateAutoDebugTypeId(records[i].name);
+			entry.name = records[i].name;
+			entry.type = BuildType(records[i]);
+		});
+		\endcode
+
+		\ingroup types
+	*/
+	class TypeImporter
+	{
+		Ref<BinaryView> m_view;
+		size_t m_threadCount;
+		size_t m_chunkSize;
+
+	  public:
+		typedef std::function<void(size_t index, TypeImportEntry& entry)> BuildFunction;
+		typedef std::function<bool(size_t, size_t)> ProgressFunction;
+
+		static constexpr size_t DefaultChunkSize = 4096;
+
+		/*!
+			\param view View to define types in
+			\param threadCount Maximum number of threads used to build and sort, or 0 to use GetWorkerThreadCount()
+			\param chunkSize Number of types defined per core call
+		*/
+		TypeImporter(Ref<BinaryView> view, size_t threadCount = 0, size_t chunkSize = DefaultChunkSize);
+
+		/*! Run the build stage
+
+			\param count Number of records to build
+			\param build Function filling in the entry for one record. Entries left without a type are dropped.
+			\param progress Progress callback, returning false to cancel
+			\param total Total reported to \c progress, so that the stages can share one progress range
+			\return Built entries in record order, or an empty list if cancelled
+		*/
+		std::vector<TypeImportEntry> Build(size_t count, const BuildFunction& build,
+		    const ProgressFunction& progress = {}, size_t total = 0);
+
+		/*! Run the sort stage
+
+			\param entries Entries to sort
+			\return Indices into \c entries, ordered so that types follow their by-value dependencies
+		*/
+		std::vector<size_t> SortByDependencies(const std::vector<TypeImportEntry>& entries);
+
+		/*! Run the apply stage
+
+			\param entries Entries to define
+			\param order Order to define them in, as returned by SortByDependencies
+			\param progress Progress callback, returning false to stop before the next chunk
+			\param base Progress already reported by earlier stages
+			\param total Total reported to \c progress, or 0 to use the number of entries
+			\return Map of type ids to the names the types were defined with
+		*/
+		std::unordered_map<std::string, QualifiedName> Apply(const std::vector<TypeImportEntry>& entries,
+		    const std::vector<size_t>& order, const ProgressFunction& progress = {}, size_t base = 0,
+		    size_t total = 0);
+
+		/*! Run all three stages
+
+			\param count Number of records to build
+			\param build Function filling in the entry for one record
+			\param progress Progress callback, returning false to cancel
+			\return Map of type ids to the names the types were defined with
+		*/
+		std::unordered_map<std::string, QualifiedName> Import(
+		    size_t count, const BuildFunction& build, const ProgressFunction& progress = {});
+	};
+
 	/*!
 		A TypeContainer is a generic interface to access various Binary Ninja models
 		that contain types. Types are stored with both a unique id and a unique name.
@@ -16279,21 +19080,89 @@ namespace BinaryNinja {
 		);
 	};
 
-	/*!
+	/*! SymbolQueue resolves symbols in parallel and then adds them in the order they were appended.
+
+		Work appended with Append is handed to the core queue, which allocates a pair of callbacks for each symbol.
+		Loaders with a very large number of symbols should use AppendTask instead: tasks are plain function pointers
+		and a 64-bit value stored contiguously, resolved across worker threads in batches. Each batch is added in
+		append order, inside BeginBulkModifySymbols/EndBulkModifySymbols when the queue was created with a view.
+		The next batch is resolved while the current one is being added.
+
+		\code{.cpp}
+		SymbolQueue queue(view);
+		for (size_t i = 0; i < imports.size(); i++)
+			queue.AppendTask(ResolveImport, AddImport, &imports, i);
+		queue.Process();
+		\endcode
+
+		Resolve functions run concurrently and must be thread safe. Add functions are called on the thread
+		calling Process, one at a time.
+
 	    \ingroup binaryview
 	*/
 	class SymbolQueue
 	{
+	public:
+		typedef std::pair<Ref<Symbol>, Ref<Type>> (*ResolveFunction)(void* ctxt, uint64_t data);
+		typedef void (*AddFunction)(void* ctxt, uint64_t data, Symbol* symbol, Type* type);
+
+	private:
+		struct Task
+		{
+			ResolveFunction resolve;
+			AddFunction add;
+			void* context;
+			uint64_t data;
+		};
+
 		BNSymbolQueue* m_object;
+		Ref<BinaryView> m_view;
+		size_t m_threadCount;
+		size_t m_batchSize;
+		std::vector<Task> m_tasks;
 
 		static void ResolveCallback(void* ctxt, BNSymbol** symbol, BNType** type);
 		static void AddCallback(void* ctxt, BNSymbol* symbol, BNType* type);
 
+		void ProcessTasks();
+
 	public:
+		static constexpr size_t DefaultBatchSize = 4096;
+
 		SymbolQueue();
+		/*! Create a queue whose tasks are added to \c view in bulk symbol modification batches
+
+			\param view View the symbols are added to, or nullptr to add without bulk modification
+			\param threadCount Number of threads resolving tasks, 0 for the worker thread count
+			\param batchSize Number of tasks resolved and added together
+		*/
+		SymbolQueue(BinaryView* view, size_t threadCount = 0, size_t batchSize = DefaultBatchSize);
 		~SymbolQueue();
 		void Append(const std::function<std::pair<Ref<Symbol>, Ref<Type>>()>& resolve,
 			const std::function<void(Symbol*, Type*)>& add);
+
+		/*! Queue a task without allocating per symbol state
+
+			Tasks whose resolve function returns no symbol are skipped. \c add receives the type that was returned,
+			which may be nullptr.
+
+			\param resolve Function producing the symbol and type, called with \c ctxt and \c data
+			\param add Function adding the resolved symbol, called with \c ctxt and \c data
+			\param ctxt Context passed to both functions
+			\param data Value identifying the symbol to the functions, such as an index or address
+		*/
+		void AppendTask(ResolveFunction resolve, AddFunction add, void* ctxt, uint64_t data);
+
+		/*! Reserve space for a known number of tasks
+
+			\param count Number of tasks that will be appended
+		*/
+		void ReserveTasks(size_t count);
+
+		/*! Resolve and add everything queued
+
+			Work queued with Append is processed first, followed by tasks in the order they were appended.
+		*/
 		void Process();
 	};
 }  // namespace BinaryNinja
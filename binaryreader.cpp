@@ -64,10 +64,24 @@ DataBuffer BinaryReader::Read(size_t len)
 }
 
 
+void BinaryReader::Read(Span<uint8_t> dest)
+{
+	Read(dest.data(), dest.size());
+}
+
+
+void BinaryReader::Read(DataBuffer& dest, size_t len)
+{
+	dest.SetSize(len);
+	Read(dest.GetData(), len);
+}
+
+
 string BinaryReader::ReadString(size_t len)
 {
-	DataBuffer result = Read(len);
-	return string((const char*)result.GetData(), len);
+	string result(len, '\0');
+	Read(&result[0], len);
+	return result;
 }
 
 
@@ -276,12 +290,18 @@ bool BinaryReader::TryRead(DataBuffer& dest, size_t len)
 }
 
 
+bool BinaryReader::TryRead(Span<uint8_t> dest)
+{
+	return TryRead(dest.data(), dest.size());
+}
+
+
 bool BinaryReader::TryReadString(string& dest, size_t len)
 {
-	DataBuffer result(len);
-	if (!TryRead(result.GetData(), len))
+	string result(len, '\0');
+	if (!TryRead(&result[0], len))
 		return false;
-	dest = string((const char*)result.GetData(), len);
+	dest = std::move(result);
 	return true;
 }
 
@@ -492,9 +512,8 @@ T BinaryReader::Read()
 template <typename T>
 vector<T> BinaryReader::ReadVector(size_t count)
 {
-	T* buff = new T[count];
-	Read((char*)buff, count * sizeof(T));
-	std::vector<T> out(buff, buff + count);
+	std::vector<T> out(count);
+	Read((char*)out.data(), count * sizeof(T));
 	return out;
 }
 
@@ -19,6 +19,7 @@
 // IN THE SOFTWARE.
 
 #include <algorithm>
+#include <future>
 #include <iterator>
 #include <memory>
 #include "binaryninjaapi.h"
@@ -1504,15 +1505,24 @@ DataBuffer BinaryView::ReadBuffer(uint64_t offset, size_t len)
 }
 
 
+size_t BinaryView::ReadBuffer(DataBuffer& dest, uint64_t offset, size_t len)
+{
+	dest.SetSize(len);
+	size_t result = Read(dest.GetData(), offset, len);
+	dest.SetSize(result);
+	return result;
+}
+
+
 size_t BinaryView::WriteBuffer(uint64_t offset, const DataBuffer& data)
 {
-	return BNWriteViewBuffer(m_object, offset, data.GetBufferObject());
+	return BNWriteViewBuffer(m_object, offset, DataBuffer::ScopedObject(data));
 }
 
 
 size_t BinaryView::InsertBuffer(uint64_t offset, const DataBuffer& data)
 {
-	return BNInsertViewBuffer(m_object, offset, data.GetBufferObject());
+	return BNInsertViewBuffer(m_object, offset, DataBuffer::ScopedObject(data));
 }
 
 
@@ -1625,6 +1635,12 @@ size_t BinaryView::Read(void* dest, uint64_t offset, size_t len)
 }
 
 
+size_t BinaryView::Read(Span<uint8_t> dest, uint64_t offset)
+{
+	return Read(dest.data(), offset, dest.size());
+}
+
+
 size_t BinaryView::Write(uint64_t offset, const void* data, size_t len)
 {
 	return BNWriteViewData(m_object, offset, data, len);
@@ -1803,6 +1819,21 @@ Ref<Function> BinaryView::AddFunctionForAnalysis(Platform* platform, uint64_t ad
 }
 
 
+void BinaryView::AddFunctionsForAnalysis(Span<const FunctionDefinition> functions)
+{
+	RunUndoableTransaction([&]() {
+		for (auto& function : functions)
+		{
+			BNFunction* func = BNAddFunctionForAnalysis(m_object, function.platform->GetObject(), function.address,
+				function.autoDiscovered, function.type ? function.type->GetObject() : nullptr);
+			if (func)
+				BNFreeFunction(func);
+		}
+		return true;
+	});
+}
+
+
 void BinaryView::AddEntryPointForAnalysis(Platform* platform, uint64_t addr)
 {
 	BNAddEntryPointForAnalysis(m_object, platform->GetObject(), addr);
@@ -1878,6 +1909,24 @@ void BinaryView::DefineUserDataVariable(uint64_t addr, const Confidence<Ref<Type
 }
 
 
+void BinaryView::DefineDataVariables(Span<const DataVariableDefinition> variables, bool user)
+{
+	RunUndoableTransaction([&]() {
+		for (auto& variable : variables)
+		{
+			BNTypeWithConfidence tc;
+			tc.type = variable.type->GetObject();
+			tc.confidence = variable.confidence;
+			if (user)
+				BNDefineUserDataVariable(m_object, variable.address, &tc);
+			else
+				BNDefineDataVariable(m_object, variable.address, &tc);
+		}
+		return true;
+	});
+}
+
+
 void BinaryView::UndefineDataVariable(uint64_t addr)
 {
 	BNUndefineDataVariable(m_object, addr);
@@ -2787,6 +2836,27 @@ void BinaryView::DefineAutoSymbol(Ref<Symbol> sym)
 }
 
 
+void BinaryView::DefineAutoSymbols(Span<const SymbolDefinition> symbols)
+{
+	BNNameSpace ns = NameSpace().GetAPIObject();
+	RunUndoableTransaction([&]() {
+		BeginBulkModifySymbols();
+		for (auto& symbol : symbols)
+		{
+			const char* fullName = symbol.fullName ? symbol.fullName : symbol.shortName;
+			const char* rawName = symbol.rawName ? symbol.rawName : symbol.shortName;
+			BNSymbol* sym = BNCreateSymbol(symbol.type, symbol.shortName, fullName, rawName, symbol.address,
+			    symbol.binding, &ns, symbol.ordinal);
+			BNDefineAutoSymbol(m_object, sym);
+			BNFreeSymbol(sym);
+		}
+		EndBulkModifySymbols();
+		return true;
+	});
+	NameSpace::FreeAPIObject(&ns);
+}
+
+
 Ref<Symbol> BinaryView::DefineAutoSymbolAndVariableOrFunction(Ref<Platform> platform, Ref<Symbol> sym, Ref<Type> type)
 {
 	BNSymbol* result = BNDefineAutoSymbolAndVariableOrFunction(
@@ -2948,6 +3018,22 @@ void BinaryView::AddTag(Ref<Tag> tag, bool user)
 }
 
 
+void BinaryView::AddDataTags(Span<const DataTagDefinition> tags)
+{
+	RunUndoableTransaction([&]() {
+		for (auto& tag : tags)
+		{
+			BNAddTag(m_object, tag.tag->GetObject(), tag.user);
+			if (tag.user)
+				BNAddUserDataTag(m_object, tag.address, tag.tag->GetObject());
+			else
+				BNAddAutoDataTag(m_object, tag.address, tag.tag->GetObject());
+		}
+		return true;
+	});
+}
+
+
 void BinaryView::RemoveTag(Ref<Tag> tag, bool user)
 {
 	BNRemoveTag(m_object, tag->GetObject(), user);
@@ -4115,7 +4201,7 @@ std::optional<std::pair<Ref<TypeLibrary>, QualifiedName>> BinaryView::LookupImpo
 
 bool BinaryView::FindNextData(uint64_t start, const DataBuffer& data, uint64_t& result, BNFindFlag flags)
 {
-	return BNFindNextData(m_object, start, data.GetBufferObject(), &result, flags);
+	return BNFindNextData(m_object, start, DataBuffer::ScopedObject(data), &result, flags);
 }
 
 bool BinaryView::FindNextText(uint64_t start, const std::string& data, uint64_t& result,
@@ -4184,7 +4270,7 @@ bool BinaryView::FindNextData(uint64_t start, uint64_t end, const DataBuffer& da
 	ProgressContext fp;
 	fp.callback = progress;
 	return BNFindNextDataWithProgress(
-	    m_object, start, end, data.GetBufferObject(), &addr, flags, &fp, ProgressCallback);
+	    m_object, start, end, DataBuffer::ScopedObject(data), &addr, flags, &fp, ProgressCallback);
 }
 
 
@@ -4218,7 +4304,7 @@ bool BinaryView::FindAllData(uint64_t start, uint64_t end, const DataBuffer& dat
 	fp.callback = progress;
 	MatchCallbackContextForDataBuffer mc;
 	mc.func = matchCallback;
-	return BNFindAllDataWithProgress(m_object, start, end, data.GetBufferObject(), flags, &fp, ProgressCallback,
+	return BNFindAllDataWithProgress(m_object, start, end, DataBuffer::ScopedObject(data), flags, &fp, ProgressCallback,
 	    &mc, MatchCallbackForDataBuffer);
 }
 
@@ -4774,7 +4860,7 @@ BinaryData::BinaryData(FileMetadata* file) : BinaryView(BNCreateBinaryDataView(f
 
 
 BinaryData::BinaryData(FileMetadata* file, const DataBuffer& data) :
-	BinaryView(BNCreateBinaryDataViewFromBuffer(file->GetObject(), data.GetBufferObject()))
+	BinaryView(BNCreateBinaryDataViewFromBuffer(file->GetObject(), DataBuffer::ScopedObject(data)))
 {}
 
 
@@ -4844,7 +4930,14 @@ Ref<BinaryView> BinaryNinja::Load(Ref<BinaryView> view, bool updateAnalysis,
 }
 
 
-SymbolQueue::SymbolQueue()
+SymbolQueue::SymbolQueue() : m_threadCount(0), m_batchSize(DefaultBatchSize)
+{
+	m_object = BNCreateSymbolQueue();
+}
+
+
+SymbolQueue::SymbolQueue(BinaryView* view, size_t threadCount, size_t batchSize) :
+	m_view(view), m_threadCount(threadCount), m_batchSize(batchSize ? batchSize : DefaultBatchSize)
 {
 	m_object = BNCreateSymbolQueue();
 }
@@ -4885,7 +4978,93 @@ void SymbolQueue::Append(
 }
 
 
+void SymbolQueue::AppendTask(ResolveFunction resolve, AddFunction add, void* ctxt, uint64_t data)
+{
+	m_tasks.push_back({resolve, add, ctxt, data});
+}
+
+
+void SymbolQueue::ReserveTasks(size_t count)
+{
+	m_tasks.reserve(m_tasks.size() + count);
+}
+
+
+void SymbolQueue::ProcessTasks()
+{
+	struct Batch
+	{
+		size_t start = 0;
+		vector<pair<Ref<Symbol>, Ref<Type>>> results;
+	};
+
+	auto resolve = [this](size_t batch, Batch& out) {
+		out.start = batch * m_batchSize;
+		out.results.clear();
+		out.results.resize(std::min(m_batchSize, m_tasks.size() - out.start));
+		ParallelFor(
+			out.results.size(),
+			[&](size_t i) {
+				const Task& task = m_tasks[out.start + i];
+				out.results[i] = task.resolve(task.context, task.data);
+			},
+			m_threadCount);
+	};
+
+	auto add = [this](Batch& batch) {
+		if (m_view)
+			m_view->BeginBulkModifySymbols();
+		try
+		{
+			for (size_t i = 0; i < batch.results.size(); i++)
+			{
+				auto& result = batch.results[i];
+				if (!result.first)
+					continue;
+				const Task& task = m_tasks[batch.start + i];
+				task.add(task.context, task.data, result.first, result.second);
+			}
+		}
+		catch (...)
+		{
+			if (m_view)
+				m_view->EndBulkModifySymbols();
+			throw;
+		}
+		if (m_view)
+			m_view->EndBulkModifySymbols();
+	};
+
+	// Two batches are in flight: one being added here while the next is resolved by the worker threads
+	size_t batchCount = (m_tasks.size() + m_batchSize - 1) / m_batchSize;
+	Batch batches[2];
+	resolve(0, batches[0]);
+	for (size_t i = 0; i < batchCount; i++)
+	{
+		future<void> next;
+		if ((i + 1) < batchCount)
+			next = async(launch::async, resolve, i + 1, std::ref(batches[(i + 1) % 2]));
+		add(batches[i % 2]);
+		if (next.valid())
+			next.get();
+	}
+}
+
+
 void SymbolQueue::Process()
 {
 	BNProcessSymbolQueue(m_object);
+
+	if (m_tasks.empty())
+		return;
+	try
+	{
+		ProcessTasks();
+	}
+	catch (...)
+	{
+		m_tasks.clear();
+		throw;
+	}
+	m_tasks.clear();
 }
@@ -0,0 +1,632 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+// Nesting deeper than this is treated as malformed input rather than risking the stack
+static const size_t g_maxCborDepth = 512;
+static const uint64_t g_cborSelfDescribeTag = 55799;
+
+
+static double DecodeHalfFloat(uint16_t half)
+{
+	int exponent = (half >> 10) & 0x1f;
+	int mantissa = half & 0x3ff;
+	double value;
+	if (exponent == 0)
+		value = ldexp((double)mantissa, -24);
+	else if (exponent != 31)
+		value = ldexp((double)(mantissa + 1024), exponent - 25);
+	else
+		value = (mantissa == 0) ? numeric_limits<double>::infinity() : numeric_limits<double>::quiet_NaN();
+	return (half & 0x8000) ? -value : value;
+}
+
+
+CborReader::CborReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_offset(0), m_error(false)
+{}
+
+
+CborReader::CborReader(const DataBuffer& buffer) :
+	m_data((const uint8_t*)buffer.GetData()), m_size(buffer.GetLength()), m_offset(0), m_error(false)
+{}
+
+
+bool CborReader::Next(CborItem& item)
+{
+	if (m_error || (m_offset >= m_size))
+		return false;
+
+	item.unsignedValue = 0;
+	item.signedValue = 0;
+	item.floatValue = 0;
+	item.boolValue = false;
+	item.data = Span<const uint8_t>();
+	item.length = 0;
+
+	uint8_t initial = m_data[m_offset++];
+	if (initial == 0xff)
+	{
+		item.type = CborBreakItem;
+		return true;
+	}
+
+	uint8_t major = initial >> 5;
+	uint8_t info = initial & 0x1f;
+	uint64_t argument = 0;
+	bool indefinite = false;
+	if (info < 24)
+	{
+		argument = info;
+	}
+	else if (info <= 27)
+	{
+		size_t bytes = (size_t)1 << (info - 24);
+		if ((m_size - m_offset) < bytes)
+		{
+			m_error = true;
+			return false;
+		}
+		for (size_t i = 0; i < bytes; i++)
+			argument = (argument << 8) | m_data[m_offset + i];
+		m_offset += bytes;
+	}
+	else if ((info == 31) && (major >= 2) && (major <= 5))
+	{
+		indefinite = true;
+	}
+	else
+	{
+		m_error = true;
+		return false;
+	}
+
+	switch (major)
+	{
+	case 0:
+		item.type = CborUnsignedItem;
+		item.unsignedValue = argument;
+		item.signedValue = (argument <= (uint64_t)numeric_limits<int64_t>::max()) ? (int64_t)argument : 0;
+		return true;
+	case 1:
+		item.type = CborNegativeItem;
+		item.unsignedValue = argument;
+		item.signedValue = (argument <= (uint64_t)numeric_limits<int64_t>::max()) ? (-1 - (int64_t)argument) : 0;
+		return true;
+	case 2:
+	case 3:
+		item.type = (major == 2) ? CborBytesItem : CborTextItem;
+		if (indefinite)
+		{
+			item.length = CborItem::IndefiniteLength;
+			return true;
+		}
+		if (argument > (m_size - m_offset))
+		{
+			m_error = true;
+			return false;
+		}
+		item.data = Span<const uint8_t>(m_data + m_offset, (size_t)argument);
+		item.length = argument;
+		m_offset += (size_t)argument;
+		return true;
+	case 4:
+	case 5:
+		item.type = (major == 4) ? CborArrayItem : CborMapItem;
+		item.length = indefinite ? CborItem::IndefiniteLength : argument;
+		return true;
+	case 6:
+		item.type = CborTagItem;
+		item.unsignedValue = argument;
+		return true;
+	default:
+		break;
+	}
+
+	switch (info)
+	{
+	case 20:
+	case 21:
+		item.type = CborBoolItem;
+		item.boolValue = (info == 21);
+		return true;
+	case 22:
+		item.type = CborNullItem;
+		return true;
+	case 25:
+		item.type = CborFloatItem;
+		item.floatValue = DecodeHalfFloat((uint16_t)argument);
+		return true;
+	case 26:
+	{
+		uint32_t bits = (uint32_t)argument;
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+		item.type = CborFloatItem;
+		item.floatValue = value;
+		return true;
+	}
+	case 27:
+		item.type = CborFloatItem;
+		memcpy(&item.floatValue, &argument, sizeof(item.floatValue));
+		return true;
+	default:
+		// Undefined and unassigned simple values
+		item.type = CborUndefinedItem;
+		return true;
+	}
+}
+
+
+bool CborReader::SkipContents(const CborItem& item, size_t depth)
+{
+	if (depth > g_maxCborDepth)
+	{
+		m_error = true;
+		return false;
+	}
+
+	uint64_t count;
+	switch (item.type)
+	{
+	case CborArrayItem:
+	case CborMapItem:
+	case CborBytesItem:
+	case CborTextItem:
+		if (item.length == CborItem::IndefiniteLength)
+		{
+			while (true)
+			{
+				CborItem child;
+				if (!Next(child))
+				{
+					m_error = true;
+					return false;
+				}
+				if (child.type == CborBreakItem)
+					return true;
+				if (!SkipContents(child, depth + 1))
+					return false;
+			}
+		}
+		if ((item.type == CborBytesItem) || (item.type == CborTextItem))
+			return true;
+		count = (item.type == CborMapItem) ? (item.length * 2) : item.length;
+		break;
+	case CborTagItem:
+		count = 1;
+		break;
+	case CborBreakItem:
+		m_error = true;
+		return false;
+	default:
+		return true;
+	}
+
+	for (uint64_t i = 0; i < count; i++)
+	{
+		CborItem child;
+		if (!Next(child) || (child.type == CborBreakItem))
+		{
+			m_error = true;
+			return false;
+		}
+		if (!SkipContents(child, depth + 1))
+			return false;
+	}
+	return true;
+}
+
+
+bool CborReader::Skip()
+{
+	CborItem item;
+	if (!Next(item))
+		return false;
+	return SkipContents(item, 0);
+}
+
+
+void CborWriter::WriteHead(uint8_t major, uint64_t argument)
+{
+	uint8_t type = (uint8_t)(major << 5);
+	if (argument < 24)
+	{
+		m_data.push_back(type | (uint8_t)argument);
+		return;
+	}
+
+	size_t bytes;
+	if (argument <= 0xff)
+	{
+		m_data.push_back(type | 24);
+		bytes = 1;
+	}
+	else if (argument <= 0xffff)
+	{
+		m_data.push_back(type | 25);
+		bytes = 2;
+	}
+	else if (argument <= 0xffffffff)
+	{
+		m_data.push_back(type | 26);
+		bytes = 4;
+	}
+	else
+	{
+		m_data.push_back(type | 27);
+		bytes = 8;
+	}
+	for (size_t i = bytes; i > 0; i--)
+		m_data.push_back((uint8_t)(argument >> ((i - 1) * 8)));
+}
+
+
+void CborWriter::WriteSelfDescribeTag()
+{
+	WriteHead(6, g_cborSelfDescribeTag);
+}
+
+
+void CborWriter::WriteUnsigned(uint64_t value)
+{
+	WriteHead(0, value);
+}
+
+
+void CborWriter::WriteSigned(int64_t value)
+{
+	if (value >= 0)
+		WriteHead(0, (uint64_t)value);
+	else
+		WriteHead(1, (uint64_t)(-1 - value));
+}
+
+
+void CborWriter::WriteDouble(double value)
+{
+	// Values that survive the round trip through single precision are written in half the space
+	float single = (float)value;
+	if (((double)single == value) || (value != value))
+	{
+		uint32_t bits;
+		memcpy(&bits, &single, sizeof(bits));
+		m_data.push_back(0xfa);
+		for (size_t i = 4; i > 0; i--)
+			m_data.push_back((uint8_t)(bits >> ((i - 1) * 8)));
+		return;
+	}
+
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	m_data.push_back(0xfb);
+	for (size_t i = 8; i > 0; i--)
+		m_data.push_back((uint8_t)(bits >> ((i - 1) * 8)));
+}
+
+
+void CborWriter::WriteBool(bool value)
+{
+	m_data.push_back(value ? 0xf5 : 0xf4);
+}
+
+
+void CborWriter::WriteNull()
+{
+	m_data.push_back(0xf6);
+}
+
+
+void CborWriter::WriteText(string_view value)
+{
+	WriteHead(3, value.size());
+	m_data.insert(m_data.end(), value.begin(), value.end());
+}
+
+
+void CborWriter::WriteBytes(Span<const uint8_t> value)
+{
+	WriteHead(2, value.size());
+	m_data.insert(m_data.end(), value.begin(), value.end());
+}
+
+
+void CborWriter::BeginArray(uint64_t length)
+{
+	WriteHead(4, length);
+}
+
+
+void CborWriter::BeginMap(uint64_t pairs)
+{
+	WriteHead(5, pairs);
+}
+
+
+void CborWriter::WriteValue(const Json::Value& value)
+{
+	switch (value.type())
+	{
+	case Json::nullValue:
+		WriteNull();
+		break;
+	case Json::intValue:
+		WriteSigned(value.asInt64());
+		break;
+	case Json::uintValue:
+		WriteUnsigned(value.asUInt64());
+		break;
+	case Json::realValue:
+		WriteDouble(value.asDouble());
+		break;
+	case Json::booleanValue:
+		WriteBool(value.asBool());
+		break;
+	case Json::stringValue:
+	{
+		const char* begin;
+		const char* end;
+		if (value.getString(&begin, &end))
+			WriteText(string_view(begin, (size_t)(end - begin)));
+		else
+			WriteText(string_view());
+		break;
+	}
+	case Json::arrayValue:
+		BeginArray(value.size());
+		for (auto& element : value)
+			WriteValue(element);
+		break;
+	case Json::objectValue:
+		BeginMap(value.size());
+		for (auto i = value.begin(); i != value.end(); ++i)
+		{
+			const char* end;
+			const char* name = i.memberName(&end);
+			WriteText(string_view(name, (size_t)(end - name)));
+			WriteValue(*i);
+		}
+		break;
+	}
+}
+
+
+DataBuffer CborWriter::GetBuffer() const
+{
+	return DataBuffer(m_data.data(), m_data.size());
+}
+
+
+DataBuffer BinaryNinja::EncodeCbor(const Json::Value& value)
+{
+	// Encoding into a per-thread buffer means repeated encodes only allocate for the result
+	static thread_local CborWriter writer;
+	writer.Clear();
+	writer.WriteSelfDescribeTag();
+	writer.WriteValue(value);
+	return writer.GetBuffer();
+}
+
+
+static bool DecodeCborItem(CborReader& reader, const CborItem& item, Json::Value& result, size_t depth, string& errors);
+
+
+static bool DecodeCborString(CborReader& reader, const CborItem& item, string& result, string& errors)
+{
+	if (item.length != CborItem::IndefiniteLength)
+	{
+		result.assign((const char*)item.data.data(), item.data.size());
+		return true;
+	}
+
+	result.clear();
+	while (true)
+	{
+		CborItem chunk;
+		if (!reader.Next(chunk))
+		{
+			errors = "Truncated CBOR string";
+			return false;
+		}
+		if (chunk.type == CborBreakItem)
+			return true;
+		if ((chunk.type != item.type) || (chunk.length == CborItem::IndefiniteLength))
+		{
+			errors = "Malformed CBOR string chunk";
+			return false;
+		}
+		result.append((const char*)chunk.data.data(), chunk.data.size());
+	}
+}
+
+
+// Reads the next item of a container. Returns false with done set at the break ending an indefinite container.
+static bool NextCborElement(CborReader& reader, const CborItem& container, uint64_t index, CborItem& element,
+	bool& done, string& errors)
+{
+	done = false;
+	if ((container.length != CborItem::IndefiniteLength) && (index >= container.length))
+	{
+		done = true;
+		return false;
+	}
+	if (!reader.Next(element))
+	{
+		errors = "Truncated CBOR container";
+		return false;
+	}
+	if (element.type == CborBreakItem)
+	{
+		if (container.length != CborItem::IndefiniteLength)
+		{
+			errors = "Unexpected CBOR break";
+			return false;
+		}
+		done = true;
+		return false;
+	}
+	return true;
+}
+
+
+static bool DecodeCborItem(CborReader& reader, const CborItem& item, Json::Value& result, size_t depth, string& errors)
+{
+	if (depth > g_maxCborDepth)
+	{
+		errors = "CBOR value is nested too deeply";
+		return false;
+	}
+
+	switch (item.type)
+	{
+	case CborUnsignedItem:
+		result = Json::Value((Json::UInt64)item.unsignedValue);
+		return true;
+	case CborNegativeItem:
+		if (item.unsignedValue <= (uint64_t)numeric_limits<int64_t>::max())
+			result = Json::Value((Json::Int64)item.signedValue);
+		else
+			result = Json::Value(-1.0 - (double)item.unsignedValue);
+		return true;
+	case CborBytesItem:
+	case CborTextItem:
+	{
+		string text;
+		if (!DecodeCborString(reader, item, text, errors))
+			return false;
+		result = Json::Value(text);
+		return true;
+	}
+	case CborArrayItem:
+	{
+		result = Json::Value(Json::arrayValue);
+		CborItem element;
+		bool done;
+		for (uint64_t i = 0;; i++)
+		{
+			if (!NextCborElement(reader, item, i, element, done, errors))
+				return done;
+			if (!DecodeCborItem(reader, element, result[(Json::ArrayIndex)i], depth + 1, errors))
+				return false;
+		}
+	}
+	case CborMapItem:
+	{
+		result = Json::Value(Json::objectValue);
+		CborItem key;
+		bool done;
+		for (uint64_t i = 0;; i++)
+		{
+			if (!NextCborElement(reader, item, i, key, done, errors))
+				return done;
+
+			string name;
+			if ((key.type == CborTextItem) || (key.type == CborBytesItem))
+			{
+				if (!DecodeCborString(reader, key, name, errors))
+					return false;
+			}
+			else
+			{
+				Json::Value keyValue;
+				if (!DecodeCborItem(reader, key, keyValue, depth + 1, errors))
+					return false;
+				if (keyValue.isObject() || keyValue.isArray())
+				{
+					errors = "Unsupported CBOR map key";
+					return false;
+				}
+				name = keyValue.asString();
+			}
+
+			CborItem value;
+			if (!reader.Next(value) || (value.type == CborBreakItem))
+			{
+				errors = "Truncated CBOR map";
+				return false;
+			}
+			if (!DecodeCborItem(reader, value, result[name], depth + 1, errors))
+				return false;
+		}
+	}
+	case CborTagItem:
+	{
+		// Tags only annotate the item that follows, which is decoded as is
+		CborItem tagged;
+		if (!reader.Next(tagged) || (tagged.type == CborBreakItem))
+		{
+			errors = "Truncated CBOR tag";
+			return false;
+		}
+		return DecodeCborItem(reader, tagged, result, depth + 1, errors);
+	}
+	case CborBoolItem:
+		result = Json::Value(item.boolValue);
+		return true;
+	case CborNullItem:
+	case CborUndefinedItem:
+		result = Json::Value();
+		return true;
+	case CborFloatItem:
+		result = Json::Value(item.floatValue);
+		return true;
+	default:
+		errors = "Unexpected CBOR break";
+		return false;
+	}
+}
+
+
+bool BinaryNinja::DecodeCbor(const uint8_t* data, size_t size, Json::Value& result, string& errors)
+{
+	CborReader reader(data, size);
+	CborItem item;
+	if (!reader.Next(item))
+	{
+		errors = "Empty or malformed CBOR data";
+		return false;
+	}
+	if (!DecodeCborItem(reader, item, result, 0, errors))
+	{
+		if (errors.empty())
+			errors = "Malformed CBOR data";
+		return false;
+	}
+	if (!reader.AtEnd())
+	{
+		errors = "Trailing data after CBOR value";
+		return false;
+	}
+	return true;
+}
+
+
+bool BinaryNinja::IsCborEncoded(const uint8_t* data, size_t size)
+{
+	return (size >= 3) && (data[0] == 0xd9) && (data[1] == 0xd9) && (data[2] == 0xf7);
+}
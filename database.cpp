@@ -18,6 +18,7 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 #include <cstring>
+#include <sstream>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
@@ -25,6 +26,36 @@ using namespace Json;
 using namespace std;
 
 
+// Readers and writers are expensive to build, so each thread keeps one
+static bool ParseStoredValue(const char* begin, const char* end, Json::Value& result, string& errors)
+{
+	if (IsCborEncoded((const uint8_t*)begin, (size_t)(end - begin)))
+		return DecodeCbor((const uint8_t*)begin, (size_t)(end - begin), result, errors);
+
+	static thread_local unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+	return reader->parse(begin, end, &result, &errors);
+}
+
+
+static const string& WriteCompactJson(const Json::Value& value)
+{
+	static thread_local unique_ptr<Json::StreamWriter> writer;
+	static thread_local ostringstream stream;
+	static thread_local string result;
+	if (!writer)
+	{
+		Json::StreamWriterBuilder builder;
+		builder["indentation"] = "";
+		writer.reset(builder.newStreamWriter());
+	}
+	stream.str("");
+	stream.clear();
+	writer->write(value, &stream);
+	result = stream.str();
+	return result;
+}
+
+
 KeyValueStore::KeyValueStore()
 {
 	m_object = BNCreateKeyValueStore();
@@ -33,7 +64,7 @@ KeyValueStore::KeyValueStore()
 
 KeyValueStore::KeyValueStore(const DataBuffer& buffer)
 {
-	m_object = BNCreateKeyValueStoreFromDataBuffer(buffer.GetBufferObject());
+	m_object = BNCreateKeyValueStoreFromDataBuffer(DataBuffer::ScopedObject(buffer));
 }
 
 
@@ -75,10 +106,9 @@ Json::Value KeyValueStore::GetValue(const std::string& name) const
 	}
 	DataBuffer value = DataBuffer(bnBuffer);
 	Json::Value json;
-	std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 	std::string errors;
-	if (!reader->parse(static_cast<const char*>(value.GetData()),
-	        static_cast<const char*>(value.GetDataAt(value.GetLength())), &json, &errors))
+	const char* data = static_cast<const char*>(value.GetData());
+	if (!ParseStoredValue(data, data + value.GetLength(), json, errors))
 	{
 		throw DatabaseException(errors);
 	}
@@ -108,12 +138,15 @@ DataBuffer KeyValueStore::GetBuffer(const std::string& name) const
 }
 
 
-void KeyValueStore::SetValue(const std::string& name, const Json::Value& value)
+void KeyValueStore::SetValue(const std::string& name, const Json::Value& value, ValueEncoding encoding)
 {
-	Json::StreamWriterBuilder builder;
-	builder["indentation"] = "";
-	string json = Json::writeString(builder, value);
-	if (!BNSetKeyValueStoreValue(m_object, name.c_str(), json.c_str()))
+	if (encoding == CborValueEncoding)
+	{
+		SetBuffer(name, EncodeCbor(value));
+		return;
+	}
+
+	if (!BNSetKeyValueStoreValue(m_object, name.c_str(), WriteCompactJson(value).c_str()))
 	{
 		throw DatabaseException("BNSetKeyValueStoreValue");
 	}
@@ -122,7 +155,7 @@ void KeyValueStore::SetValue(const std::string& name, const Json::Value& value)
 
 void KeyValueStore::SetBuffer(const std::string& name, const DataBuffer& value)
 {
-	if (!BNSetKeyValueStoreBuffer(m_object, name.c_str(), value.GetBufferObject()))
+	if (!BNSetKeyValueStoreBuffer(m_object, name.c_str(), DataBuffer::ScopedObject(value)))
 	{
 		throw DatabaseException("BNSetKeyValueStoreBuffer");
 	}
@@ -352,12 +385,21 @@ Ref<KeyValueStore> Snapshot::ReadData(const std::function<bool(size_t, size_t)>&
 	{
 		throw DatabaseException("BNReadSnapshotData");
 	}
-	return new KeyValueStore(store);
+	Ref<KeyValueStore> data = new KeyValueStore(store);
+	if (!SnapshotWriter::IsChunked(data))
+		return data;
+
+	Ref<KeyValueStore> result = SnapshotWriter::Decode(GetDatabase(), data, 0, progress);
+	if (!result)
+		throw DatabaseException("BNReadSnapshotData");
+	return result;
 }
 
 
 bool Snapshot::StoreData(const Ref<KeyValueStore>& data, const std::function<bool(size_t, size_t)>& progress)
 {
+	Ref<Database> database = GetDatabase();
+	SnapshotWriter::RecordManifest(database, GetId(), nullptr);
 	ProgressContext pctxt;
 	pctxt.callback = progress;
 	bool result = BNSnapshotStoreData(m_object, data->GetObject(), &pctxt, ProgressCallback);
@@ -365,6 +407,7 @@ bool Snapshot::StoreData(const Ref<KeyValueStore>& data, const std::function<boo
 	{
 		throw DatabaseException("BNSnapshotStoreData");
 	}
+	SnapshotWriter::RecordManifest(database, GetId(), data);
 	return result;
 }
 
@@ -484,31 +527,58 @@ bool Database::HasGlobal(const std::string& key) const
 
 Json::Value Database::ReadGlobal(const std::string& key) const
 {
+	Json::Value json;
+	std::string errors;
+
+	// CBOR globals are written as data, since they cannot pass through the string interface. Reading as data
+	// works for both encodings; the string interface is only used if that fails.
+	BNDataBuffer* data = BNReadDatabaseGlobalData(m_object, key.c_str());
+	if (data)
+	{
+		DataBuffer buffer(data);
+		const char* contents = static_cast<const char*>(buffer.GetData());
+		size_t length = buffer.GetLength();
+		if (IsCborEncoded((const uint8_t*)contents, length))
+		{
+			if (!DecodeCbor((const uint8_t*)contents, length, json, errors))
+			{
+				throw DatabaseException(errors);
+			}
+			return json;
+		}
+		while ((length != 0) && (contents[length - 1] == '\0'))
+			length--;
+		if ((length != 0) && ParseStoredValue(contents, contents + length, json, errors))
+			return json;
+		json = Json::Value();
+		errors.clear();
+	}
+
 	char* value = BNReadDatabaseGlobal(m_object, key.c_str());
 	if (value == nullptr)
 	{
 		throw DatabaseException("BNReadDatabaseGlobal");
 	}
 
-	Json::Value json;
-	std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
-	std::string errors;
-	if (!reader->parse(value, value + strlen(value), &json, &errors))
+	bool parsed = ParseStoredValue(value, value + strlen(value), json, errors);
+	BNFreeString(value);
+	if (!parsed)
 	{
 		throw DatabaseException(errors);
 	}
-
-	BNFreeString(value);
 	return json;
 }
 
 
-void Database::WriteGlobal(const std::string& key, const Json::Value& val)
+void Database::WriteGlobal(const std::string& key, const Json::Value& val, ValueEncoding encoding)
 {
-	Json::StreamWriterBuilder builder;
-	builder["indentation"] = "";
-	string json = Json::writeString(builder, val);
-	if (!BNWriteDatabaseGlobal(m_object, key.c_str(), json.c_str()))
+	if (encoding == CborValueEncoding)
+	{
+		WriteGlobalData(key, EncodeCbor(val));
+		return;
+	}
+
+	if (!BNWriteDatabaseGlobal(m_object, key.c_str(), WriteCompactJson(val).c_str()))
 	{
 		throw DatabaseException("BNWriteDatabaseGlobal");
 	}
@@ -528,7 +598,7 @@ DataBuffer Database::ReadGlobalData(const std::string& key) const
 
 void Database::WriteGlobalData(const std::string& key, const DataBuffer& val)
 {
-	if (!BNWriteDatabaseGlobalData(m_object, key.c_str(), val.GetBufferObject()))
+	if (!BNWriteDatabaseGlobalData(m_object, key.c_str(), DataBuffer::ScopedObject(val)))
 	{
 		throw DatabaseException("BNWriteDatabaseGlobalData");
 	}
@@ -18,50 +18,70 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
+#include <cstring>
 #include "binaryninjaapi.h"
+#include "databufferkernels.h"
 
 using namespace BinaryNinja;
 using namespace std;
 
 
-DataBuffer::DataBuffer()
-{
-	m_buffer = BNCreateDataBuffer(nullptr, 0);
-}
+DataBuffer::DataBuffer() : m_buffer(nullptr), m_inlineLength(0) {}
 
 
-DataBuffer::DataBuffer(size_t len)
+DataBuffer::DataBuffer(size_t len) : m_buffer(nullptr), m_inlineLength(0)
 {
-	m_buffer = BNCreateDataBuffer(nullptr, len);
+	if (len <= InlineCapacity)
+	{
+		memset(m_inline, 0, len);
+		m_inlineLength = len;
+	}
+	else
+	{
+		m_buffer = BNCreateDataBuffer(nullptr, len);
+	}
 }
 
 
-DataBuffer::DataBuffer(const void* data, size_t len)
+DataBuffer::DataBuffer(const void* data, size_t len) : m_buffer(nullptr), m_inlineLength(0)
 {
-	m_buffer = BNCreateDataBuffer(data, len);
+	if (len <= InlineCapacity)
+	{
+		if (len != 0)
+			memcpy(m_inline, data, len);
+		m_inlineLength = len;
+	}
+	else
+	{
+		m_buffer = BNCreateDataBuffer(data, len);
+	}
 }
 
 
-DataBuffer::DataBuffer(const DataBuffer& buf)
+DataBuffer::DataBuffer(const DataBuffer& buf) : m_buffer(nullptr), m_inlineLength(buf.m_inlineLength)
 {
-	m_buffer = BNDuplicateDataBuffer(buf.m_buffer);
+	if (buf.m_buffer)
+		m_buffer = BNDuplicateDataBuffer(buf.m_buffer);
+	else
+		memcpy(m_inline, buf.m_inline, m_inlineLength);
 }
 
-DataBuffer::DataBuffer(DataBuffer&& buf)
+DataBuffer::DataBuffer(DataBuffer&& buf) : m_buffer(buf.m_buffer), m_inlineLength(buf.m_inlineLength)
 {
-	m_buffer = buf.m_buffer;
-	buf.m_buffer = BNCreateDataBuffer(nullptr, 0);
+	if (!m_buffer)
+		memcpy(m_inline, buf.m_inline, m_inlineLength);
+	buf.m_buffer = nullptr;
+	buf.m_inlineLength = 0;
 }
 
-DataBuffer::DataBuffer(BNDataBuffer* buf)
-{
-	m_buffer = buf;
-}
+DataBuffer::DataBuffer(BNDataBuffer* buf) : m_buffer(buf), m_inlineLength(0) {}
 
 
 DataBuffer::~DataBuffer()
 {
-	BNFreeDataBuffer(m_buffer);
+	if (m_buffer)
+		BNFreeDataBuffer(m_buffer);
 }
 
 
@@ -69,8 +89,12 @@ DataBuffer& DataBuffer::operator=(const DataBuffer& buf)
 {
 	if (this != &buf)
 	{
-		BNFreeDataBuffer(m_buffer);
-		m_buffer = BNDuplicateDataBuffer(buf.m_buffer);
+		if (m_buffer)
+			BNFreeDataBuffer(m_buffer);
+		m_buffer = buf.m_buffer ? BNDuplicateDataBuffer(buf.m_buffer) : nullptr;
+		m_inlineLength = buf.m_inlineLength;
+		if (!m_buffer)
+			memcpy(m_inline, buf.m_inline, m_inlineLength);
 	}
 
 	return *this;
@@ -80,30 +104,62 @@ DataBuffer& DataBuffer::operator=(DataBuffer&& buf)
 {
 	if (this != &buf)
 	{
-		BNClearDataBuffer(m_buffer);
-		BNDataBuffer* temp = m_buffer;
+		if (m_buffer)
+			BNFreeDataBuffer(m_buffer);
 		m_buffer = buf.m_buffer;
-		buf.m_buffer = temp;
+		m_inlineLength = buf.m_inlineLength;
+		if (!m_buffer)
+			memcpy(m_inline, buf.m_inline, m_inlineLength);
+		buf.m_buffer = nullptr;
+		buf.m_inlineLength = 0;
 	}
 
 	return *this;
 }
 
-bool DataBuffer::operator==(const DataBuffer& other) const
+void DataBuffer::Materialize() const
 {
-	uint8_t* data = (uint8_t*)GetData();
-	uint8_t* otherData = (uint8_t*)other.GetData();
-	if (GetLength() != other.GetLength())
-		return false;
-	if (data == otherData)
-		return true;
+	if (!m_buffer)
+		m_buffer = BNCreateDataBuffer(m_inlineLength ? m_inline : nullptr, m_inlineLength);
+}
+
+BNDataBuffer* DataBuffer::GetBufferObject() const
+{
+	Materialize();
+	return m_buffer;
+}
 
-	for (size_t i = 0; i < GetLength(); i++)
+DataBuffer::ScopedObject::ScopedObject(const DataBuffer& buf) : m_object(buf.m_buffer), m_owned(false)
+{
+	if (!m_object)
 	{
-		if (data[i] != otherData[i])
-			return false;
+		m_object = BNCreateDataBuffer(buf.m_inlineLength ? buf.m_inline : nullptr, buf.m_inlineLength);
+		m_owned = true;
 	}
-	return true;
+}
+
+DataBuffer::ScopedObject::ScopedObject(ScopedObject&& other) : m_object(other.m_object), m_owned(other.m_owned)
+{
+	other.m_object = nullptr;
+	other.m_owned = false;
+}
+
+DataBuffer::ScopedObject::~ScopedObject()
+{
+	if (m_owned)
+		BNFreeDataBuffer(m_object);
+}
+
+bool DataBuffer::operator==(const DataBuffer& other) const
+{
+	const uint8_t* data = (const uint8_t*)GetData();
+	const uint8_t* otherData = (const uint8_t*)other.GetData();
+	size_t len = GetLength();
+	if (len != other.GetLength())
+		return false;
+	if ((data == otherData) || (len == 0))
+		return true;
+	return DataBufferKernels::Equal(data, otherData, len);
 }
 
 bool DataBuffer::operator!=(const DataBuffer& other) const
@@ -111,57 +167,118 @@ bool DataBuffer::operator!=(const DataBuffer& other) const
 	return !(*this == other);
 }
 
+bool DataBuffer::Find(const DataBuffer& data, size_t& result, size_t start) const
+{
+	return Find(data.GetData(), data.GetLength(), result, start);
+}
+
+bool DataBuffer::Find(const void* data, size_t len, size_t& result, size_t start) const
+{
+	size_t total = GetLength();
+	if (start > total)
+		return false;
+	size_t offset =
+		DataBufferKernels::Find((const uint8_t*)GetData() + start, total - start, (const uint8_t*)data, len);
+	if (offset == (size_t)-1)
+		return false;
+	result = start + offset;
+	return true;
+}
+
+uint32_t DataBuffer::GetCrc32c(uint32_t crc) const
+{
+	return DataBufferKernels::Crc32c((const uint8_t*)GetData(), GetLength(), crc);
+}
+
+uint64_t DataBuffer::GetHash64(uint64_t seed) const
+{
+	return DataBufferKernels::XxHash64((const uint8_t*)GetData(), GetLength(), seed);
+}
+
 void* DataBuffer::GetData()
 {
+	if (!m_buffer)
+		return m_inline;
 	return BNGetDataBufferContents(m_buffer);
 }
 
 
 const void* DataBuffer::GetData() const
 {
+	if (!m_buffer)
+		return m_inline;
 	return BNGetDataBufferContents(m_buffer);
 }
 
 
 void* DataBuffer::GetDataAt(size_t offset)
 {
+	if (!m_buffer)
+		return m_inline + offset;
 	return BNGetDataBufferContentsAt(m_buffer, offset);
 }
 
 
 const void* DataBuffer::GetDataAt(size_t offset) const
 {
+	if (!m_buffer)
+		return m_inline + offset;
 	return BNGetDataBufferContentsAt(m_buffer, offset);
 }
 
 
 size_t DataBuffer::GetLength() const
 {
+	if (!m_buffer)
+		return m_inlineLength;
 	return BNGetDataBufferLength(m_buffer);
 }
 
 
 void DataBuffer::SetSize(size_t len)
 {
+	if (!m_buffer && (len <= InlineCapacity))
+	{
+		if (len > m_inlineLength)
+			memset(m_inline + m_inlineLength, 0, len - m_inlineLength);
+		m_inlineLength = len;
+		return;
+	}
+	Materialize();
 	BNSetDataBufferLength(m_buffer, len);
 }
 
 
 void DataBuffer::Clear()
 {
-	BNClearDataBuffer(m_buffer);
+	if (!m_buffer)
+		m_inlineLength = 0;
+	else
+		BNClearDataBuffer(m_buffer);
 }
 
 
 void DataBuffer::Append(const void* data, size_t len)
 {
+	if (!m_buffer && ((m_inlineLength + len) <= InlineCapacity))
+	{
+		if (len != 0)
+			memcpy(m_inline + m_inlineLength, data, len);
+		m_inlineLength += len;
+		return;
+	}
+	// The inline storage stays intact while materializing, so data may point into it
+	Materialize();
 	BNAppendDataBufferContents(m_buffer, data, len);
 }
 
 
 void DataBuffer::Append(const DataBuffer& buf)
 {
-	BNAppendDataBuffer(m_buffer, buf.m_buffer);
+	if (m_buffer && buf.m_buffer)
+		BNAppendDataBuffer(m_buffer, buf.m_buffer);
+	else
+		Append(buf.GetData(), buf.GetLength());
 }
 
 
@@ -173,6 +290,12 @@ void DataBuffer::AppendByte(uint8_t val)
 
 DataBuffer DataBuffer::GetSlice(size_t start, size_t len)
 {
+	if (!m_buffer)
+	{
+		if (start > m_inlineLength)
+			return DataBuffer();
+		return DataBuffer(m_inline + start, std::min(len, m_inlineLength - start));
+	}
 	BNDataBuffer* result = BNGetDataBufferSlice(m_buffer, start, len);
 	return DataBuffer(result);
 }
@@ -192,7 +315,7 @@ const uint8_t& DataBuffer::operator[](size_t offset) const
 
 string DataBuffer::ToEscapedString(bool nullTerminates) const
 {
-	char* str = BNDataBufferToEscapedString(m_buffer, nullTerminates);
+	char* str = BNDataBufferToEscapedString(ScopedObject(*this), nullTerminates);
 	string result = str;
 	BNFreeString(str);
 	return result;
@@ -207,22 +330,50 @@ DataBuffer DataBuffer::FromEscapedString(const string& src)
 
 string DataBuffer::ToBase64() const
 {
-	char* str = BNDataBufferToBase64(m_buffer);
-	string result = str;
-	BNFreeString(str);
+	size_t len = GetLength();
+	string result(DataBufferKernels::GetBase64EncodedLength(len), '\0');
+	DataBufferKernels::Base64Encode((const uint8_t*)GetData(), len, &result[0]);
 	return result;
 }
 
 
 DataBuffer DataBuffer::FromBase64(const string& src)
 {
+	DataBuffer result(src.size() / 4 * 3);
+	size_t len;
+	if (DataBufferKernels::Base64Decode(src.data(), src.size(), (uint8_t*)result.GetData(), len))
+	{
+		result.SetSize(len);
+		return result;
+	}
+
+	// Input that is not canonical base64 is left to the core, which defines how it is handled
 	return DataBuffer(BNDecodeBase64(src.c_str()));
 }
 
 
+string DataBuffer::ToHex() const
+{
+	size_t len = GetLength();
+	string result(len * 2, '\0');
+	DataBufferKernels::HexEncode((const uint8_t*)GetData(), len, &result[0]);
+	return result;
+}
+
+
+bool DataBuffer::FromHex(const string& src, DataBuffer& output)
+{
+	DataBuffer result(src.size() / 2);
+	if (!DataBufferKernels::HexDecode(src.data(), src.size(), (uint8_t*)result.GetData()))
+		return false;
+	output = std::move(result);
+	return true;
+}
+
+
 bool DataBuffer::ZlibCompress(DataBuffer& output) const
 {
-	BNDataBuffer* result = BNZlibCompress(output.m_buffer);
+	BNDataBuffer* result = BNZlibCompress(ScopedObject(*this));
 	if (!result)
 		return false;
 	output = DataBuffer(result);
@@ -232,7 +383,7 @@ bool DataBuffer::ZlibCompress(DataBuffer& output) const
 
 bool DataBuffer::ZlibDecompress(DataBuffer& output) const
 {
-	BNDataBuffer* result = BNZlibDecompress(output.m_buffer);
+	BNDataBuffer* result = BNZlibDecompress(ScopedObject(*this));
 	if (!result)
 		return false;
 	output = DataBuffer(result);
@@ -0,0 +1,971 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <atomic>
+#include <cstring>
+#include "databufferkernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define BN_KERNELS_X86
+	#include <immintrin.h>
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define BN_KERNEL_TARGET(features)
+	#else
+		#define BN_KERNEL_TARGET(features) __attribute__((target(features)))
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define BN_KERNELS_NEON
+	#include <arm_neon.h>
+	#if defined(__ARM_FEATURE_CRC32)
+		#include <arm_acle.h>
+	#endif
+#endif
+
+using namespace BinaryNinja;
+using namespace BinaryNinja::DataBufferKernels;
+using namespace std;
+
+
+static inline uint32_t CountTrailingZeros(uint32_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	unsigned long result;
+	_BitScanForward(&result, value);
+	return (uint32_t)result;
+#else
+	return (uint32_t)__builtin_ctz(value);
+#endif
+}
+
+
+static inline uint64_t Load64(const uint8_t* data)
+{
+	uint64_t result;
+	memcpy(&result, data, sizeof(result));
+	return result;
+}
+
+
+static inline uint32_t Load32(const uint8_t* data)
+{
+	uint32_t result;
+	memcpy(&result, data, sizeof(result));
+	return result;
+}
+
+
+static inline uint64_t LoadLE64(const uint8_t* data)
+{
+	uint64_t value = Load64(data);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	value = __builtin_bswap64(value);
+#endif
+	return value;
+}
+
+
+static inline uint32_t LoadLE32(const uint8_t* data)
+{
+	uint32_t value = Load32(data);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	value = __builtin_bswap32(value);
+#endif
+	return value;
+}
+
+
+// Scalar implementations. These define the expected results for the vector versions.
+
+static bool EqualScalar(const uint8_t* a, const uint8_t* b, size_t len)
+{
+	return memcmp(a, b, len) == 0;
+}
+
+
+static size_t FindScalar(const uint8_t* haystack, size_t haystackLen, const uint8_t* needle, size_t needleLen)
+{
+	if (needleLen == 0)
+		return 0;
+	if (needleLen > haystackLen)
+		return (size_t)-1;
+
+	const uint8_t* cur = haystack;
+	const uint8_t* last = haystack + (haystackLen - needleLen);
+	while (cur <= last)
+	{
+		cur = (const uint8_t*)memchr(cur, needle[0], (size_t)(last - cur) + 1);
+		if (!cur)
+			break;
+		if (memcmp(cur + 1, needle + 1, needleLen - 1) == 0)
+			return (size_t)(cur - haystack);
+		cur++;
+	}
+	return (size_t)-1;
+}
+
+
+struct Crc32cTables
+{
+	uint32_t table[8][256];
+
+	Crc32cTables()
+	{
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			uint32_t crc = i;
+			for (int j = 0; j < 8; j++)
+				crc = (crc >> 1) ^ ((crc & 1) ? 0x82f63b78 : 0);
+			table[0][i] = crc;
+		}
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			for (int j = 1; j < 8; j++)
+				table[j][i] = (table[j - 1][i] >> 8) ^ table[0][table[j - 1][i] & 0xff];
+		}
+	}
+};
+
+
+static const Crc32cTables& GetCrc32cTables()
+{
+	static Crc32cTables tables;
+	return tables;
+}
+
+
+// Slicing-by-8
+static uint32_t Crc32cScalar(const uint8_t* data, size_t len, uint32_t crc)
+{
+	const Crc32cTables& tables = GetCrc32cTables();
+	crc = ~crc;
+	while (len >= 8)
+	{
+		uint32_t lo = LoadLE32(data) ^ crc;
+		uint32_t hi = LoadLE32(data + 4);
+		crc = tables.table[7][lo & 0xff] ^ tables.table[6][(lo >> 8) & 0xff] ^ tables.table[5][(lo >> 16) & 0xff]
+		    ^ tables.table[4][lo >> 24] ^ tables.table[3][hi & 0xff] ^ tables.table[2][(hi >> 8) & 0xff]
+		    ^ tables.table[1][(hi >> 16) & 0xff] ^ tables.table[0][hi >> 24];
+		data += 8;
+		len -= 8;
+	}
+	while (len--)
+		crc = (crc >> 8) ^ tables.table[0][(crc ^ *data++) & 0xff];
+	return ~crc;
+}
+
+
+static const char g_base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char g_hexDigits[] = "0123456789abcdef";
+
+
+struct DecodeTables
+{
+	int8_t base64[256];
+	int8_t hex[256];
+
+	DecodeTables()
+	{
+		memset(base64, -1, sizeof(base64));
+		memset(hex, -1, sizeof(hex));
+		for (int i = 0; i < 64; i++)
+			base64[(uint8_t)g_base64Alphabet[i]] = (int8_t)i;
+		for (int i = 0; i < 10; i++)
+			hex['0' + i] = (int8_t)i;
+		for (int i = 0; i < 6; i++)
+		{
+			hex['a' + i] = (int8_t)(10 + i);
+			hex['A' + i] = (int8_t)(10 + i);
+		}
+	}
+};
+
+
+static const DecodeTables& GetDecodeTables()
+{
+	static DecodeTables tables;
+	return tables;
+}
+
+
+static void Base64EncodeScalar(const uint8_t* data, size_t len, char* out)
+{
+	size_t i = 0;
+	for (; (i + 3) <= len; i += 3)
+	{
+		uint32_t value = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1] << 8) | data[i + 2];
+		*out++ = g_base64Alphabet[value >> 18];
+		*out++ = g_base64Alphabet[(value >> 12) & 63];
+		*out++ = g_base64Alphabet[(value >> 6) & 63];
+		*out++ = g_base64Alphabet[value & 63];
+	}
+	if ((len - i) == 1)
+	{
+		uint32_t value = (uint32_t)data[i] << 16;
+		*out++ = g_base64Alphabet[value >> 18];
+		*out++ = g_base64Alphabet[(value >> 12) & 63];
+		*out++ = '=';
+		*out++ = '=';
+	}
+	else if ((len - i) == 2)
+	{
+		uint32_t value = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1] << 8);
+		*out++ = g_base64Alphabet[value >> 18];
+		*out++ = g_base64Alphabet[(value >> 12) & 63];
+		*out++ = g_base64Alphabet[(value >> 6) & 63];
+		*out++ = '=';
+	}
+}
+
+
+// Decodes the final group of four characters, which may contain padding
+static bool Base64DecodeFinal(const uint8_t* src, uint8_t* out, size_t& outLen)
+{
+	const int8_t* table = GetDecodeTables().base64;
+	int a = table[src[0]], b = table[src[1]];
+	if ((a < 0) || (b < 0))
+		return false;
+	if ((src[2] == '=') && (src[3] == '='))
+	{
+		if (b & 0xf)
+			return false;
+		out[0] = (uint8_t)((a << 2) | (b >> 4));
+		outLen = 1;
+		return true;
+	}
+	int c = table[src[2]];
+	if (c < 0)
+		return false;
+	if (src[3] == '=')
+	{
+		if (c & 3)
+			return false;
+		out[0] = (uint8_t)((a << 2) | (b >> 4));
+		out[1] = (uint8_t)((b << 4) | (c >> 2));
+		outLen = 2;
+		return true;
+	}
+	int d = table[src[3]];
+	if (d < 0)
+		return false;
+	out[0] = (uint8_t)((a << 2) | (b >> 4));
+	out[1] = (uint8_t)((b << 4) | (c >> 2));
+	out[2] = (uint8_t)((c << 6) | d);
+	outLen = 3;
+	return true;
+}
+
+
+// Decodes complete groups of four characters without padding, returning false on any invalid character
+static bool Base64DecodeBlocksScalar(const uint8_t* src, size_t len, uint8_t* out)
+{
+	const int8_t* table = GetDecodeTables().base64;
+	for (size_t i = 0; i < len; i += 4)
+	{
+		int a = table[src[i]], b = table[src[i + 1]], c = table[src[i + 2]], d = table[src[i + 3]];
+		if ((a | b | c | d) < 0)
+			return false;
+		uint32_t value = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | (uint32_t)d;
+		*out++ = (uint8_t)(value >> 16);
+		*out++ = (uint8_t)(value >> 8);
+		*out++ = (uint8_t)value;
+	}
+	return true;
+}
+
+
+static bool Base64DecodeScalar(const char* src, size_t len, uint8_t* out, size_t& outLen)
+{
+	if (len == 0)
+	{
+		outLen = 0;
+		return true;
+	}
+	if (!Base64DecodeBlocksScalar((const uint8_t*)src, len - 4, out))
+		return false;
+	size_t finalLen;
+	if (!Base64DecodeFinal((const uint8_t*)src + len - 4, out + (len - 4) / 4 * 3, finalLen))
+		return false;
+	outLen = (len - 4) / 4 * 3 + finalLen;
+	return true;
+}
+
+
+static void HexEncodeScalar(const uint8_t* data, size_t len, char* out)
+{
+	for (size_t i = 0; i < len; i++)
+	{
+		*out++ = g_hexDigits[data[i] >> 4];
+		*out++ = g_hexDigits[data[i] & 0xf];
+	}
+}
+
+
+static bool HexDecodeScalar(const char* src, size_t len, uint8_t* out)
+{
+	const int8_t* table = GetDecodeTables().hex;
+	for (size_t i = 0; i < len; i += 2)
+	{
+		int hi = table[(uint8_t)src[i]], lo = table[(uint8_t)src[i + 1]];
+		if ((hi | lo) < 0)
+			return false;
+		*out++ = (uint8_t)((hi << 4) | lo);
+	}
+	return true;
+}
+
+
+#ifdef BN_KERNELS_X86
+static bool EqualSSE2(const uint8_t* a, const uint8_t* b, size_t len)
+{
+	size_t i = 0;
+	for (; (i + 16) <= len; i += 16)
+	{
+		__m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+		__m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xffff)
+			return false;
+	}
+	return EqualScalar(a + i, b + i, len - i);
+}
+
+
+BN_KERNEL_TARGET("avx2")
+static bool EqualAVX2(const uint8_t* a, const uint8_t* b, size_t len)
+{
+	size_t i = 0;
+	for (; (i + 64) <= len; i += 64)
+	{
+		__m256i x0 = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i y0 = _mm256_loadu_si256((const __m256i*)(b + i));
+		__m256i x1 = _mm256_loadu_si256((const __m256i*)(a + i + 32));
+		__m256i y1 = _mm256_loadu_si256((const __m256i*)(b + i + 32));
+		__m256i diff = _mm256_or_si256(_mm256_xor_si256(x0, y0), _mm256_xor_si256(x1, y1));
+		if (!_mm256_testz_si256(diff, diff))
+			return false;
+	}
+	for (; (i + 32) <= len; i += 32)
+	{
+		__m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+		if ((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) != 0xffffffff)
+			return false;
+	}
+	return EqualSSE2(a + i, b + i, len - i);
+}
+
+
+// Candidate positions are those where both the first and last bytes of the needle match, checked 16 or 32 at a
+// time. Only candidates are compared in full.
+static size_t FindSSE2(const uint8_t* haystack, size_t haystackLen, const uint8_t* needle, size_t needleLen)
+{
+	if ((needleLen < 2) || (needleLen > haystackLen))
+		return FindScalar(haystack, haystackLen, needle, needleLen);
+
+	__m128i first = _mm_set1_epi8((char)needle[0]);
+	__m128i last = _mm_set1_epi8((char)needle[needleLen - 1]);
+	size_t i = 0;
+	for (; (i + 16 + needleLen - 1) <= haystackLen; i += 16)
+	{
+		__m128i blockFirst = _mm_loadu_si128((const __m128i*)(haystack + i));
+		__m128i blockLast = _mm_loadu_si128((const __m128i*)(haystack + i + needleLen - 1));
+		uint32_t mask = (uint32_t)_mm_movemask_epi8(
+			_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last)));
+		while (mask)
+		{
+			size_t offset = i + CountTrailingZeros(mask);
+			if (memcmp(haystack + offset + 1, needle + 1, needleLen - 2) == 0)
+				return offset;
+			mask &= mask - 1;
+		}
+	}
+	size_t result = FindScalar(haystack + i, haystackLen - i, needle, needleLen);
+	return (result == (size_t)-1) ? result : (i + result);
+}
+
+
+BN_KERNEL_TARGET("avx2")
+static size_t FindAVX2(const uint8_t* haystack, size_t haystackLen, const uint8_t* needle, size_t needleLen)
+{
+	if ((needleLen < 2) || (needleLen > haystackLen))
+		return FindScalar(haystack, haystackLen, needle, needleLen);
+
+	__m256i first = _mm256_set1_epi8((char)needle[0]);
+	__m256i last = _mm256_set1_epi8((char)needle[needleLen - 1]);
+	size_t i = 0;
+	for (; (i + 32 + needleLen - 1) <= haystackLen; i += 32)
+	{
+		__m256i blockFirst = _mm256_loadu_si256((const __m256i*)(haystack + i));
+		__m256i blockLast = _mm256_loadu_si256((const __m256i*)(haystack + i + needleLen - 1));
+		uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+			_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last)));
+		while (mask)
+		{
+			size_t offset = i + CountTrailingZeros(mask);
+			if (memcmp(haystack + offset + 1, needle + 1, needleLen - 2) == 0)
+				return offset;
+			mask &= mask - 1;
+		}
+	}
+	size_t result = FindSSE2(haystack + i, haystackLen - i, needle, needleLen);
+	return (result == (size_t)-1) ? result : (i + result);
+}
+
+
+BN_KERNEL_TARGET("sse4.2")
+static uint32_t Crc32cSSE42(const uint8_t* data, size_t len, uint32_t crc)
+{
+	uint64_t value = ~crc;
+	for (; len >= 8; data += 8, len -= 8)
+		value = _mm_crc32_u64(value, Load64(data));
+	uint32_t result = (uint32_t)value;
+	for (; len > 0; data++, len--)
+		result = _mm_crc32_u8(result, *data);
+	return ~result;
+}
+
+
+// Reshuffles 12 input bytes into 16 six bit indices and maps them to the base64 alphabet (Mula and Lemire)
+BN_KERNEL_TARGET("ssse3")
+static inline __m128i Base64EncodeBlockSSSE3(__m128i in)
+{
+	in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	__m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+	__m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+	__m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+	__m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+	__m128i indices = _mm_or_si128(t1, t3);
+
+	__m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+	__m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+	result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+	const __m128i shift = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+	result = _mm_shuffle_epi8(shift, result);
+	return _mm_add_epi8(result, indices);
+}
+
+
+BN_KERNEL_TARGET("ssse3")
+static void Base64EncodeSSSE3(const uint8_t* data, size_t len, char* out)
+{
+	size_t i = 0;
+	// Each block consumes 12 bytes but loads 16
+	for (; (i + 16) <= len; i += 12)
+	{
+		__m128i in = _mm_loadu_si128((const __m128i*)(data + i));
+		_mm_storeu_si128((__m128i*)out, Base64EncodeBlockSSSE3(in));
+		out += 16;
+	}
+	Base64EncodeScalar(data + i, len - i, out);
+}
+
+
+// Validates and translates 16 base64 characters to their six bit values, then packs them into 12 bytes
+// (Mula and Lemire). Returns false if any character is outside the alphabet.
+BN_KERNEL_TARGET("ssse3")
+static inline bool Base64DecodeBlockSSSE3(__m128i in, __m128i& out)
+{
+	const __m128i lutLo = _mm_setr_epi8(
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+	const __m128i lutHi = _mm_setr_epi8(
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+	__m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibbleMask);
+	__m128i loNibbles = _mm_and_si128(in, nibbleMask);
+	__m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+	__m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+	if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+		return false;
+
+	__m128i isSlash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+	__m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(isSlash, hiNibbles));
+	__m128i values = _mm_add_epi8(in, roll);
+
+	__m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+	merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+	out = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+	return true;
+}
+
+
+BN_KERNEL_TARGET("ssse3")
+static bool Base64DecodeSSSE3(const char* src, size_t len, uint8_t* out, size_t& outLen)
+{
+	if (len == 0)
+	{
+		outLen = 0;
+		return true;
+	}
+
+	// Each block stores 16 bytes but only produces 12, so stop while there is enough output left to absorb the
+	// overrun. The final group of four, which may be padded, is always left to the scalar code.
+	size_t i = 0;
+	uint8_t* cur = out;
+	for (; (i + 24) <= len; i += 16)
+	{
+		__m128i block;
+		if (!Base64DecodeBlockSSSE3(_mm_loadu_si128((const __m128i*)(src + i)), block))
+			return false;
+		_mm_storeu_si128((__m128i*)cur, block);
+		cur += 12;
+	}
+	if (!Base64DecodeBlocksScalar((const uint8_t*)src + i, len - 4 - i, cur))
+		return false;
+	cur += (len - 4 - i) / 4 * 3;
+	size_t finalLen;
+	if (!Base64DecodeFinal((const uint8_t*)src + len - 4, cur, finalLen))
+		return false;
+	outLen = (size_t)(cur - out) + finalLen;
+	return true;
+}
+
+
+BN_KERNEL_TARGET("ssse3")
+static void HexEncodeSSSE3(const uint8_t* data, size_t len, char* out)
+{
+	const __m128i digits = _mm_loadu_si128((const __m128i*)g_hexDigits);
+	const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+	size_t i = 0;
+	for (; (i + 16) <= len; i += 16)
+	{
+		__m128i in = _mm_loadu_si128((const __m128i*)(data + i));
+		__m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), nibbleMask));
+		__m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(in, nibbleMask));
+		_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(hi, lo));
+		_mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi8(hi, lo));
+		out += 32;
+	}
+	HexEncodeScalar(data + i, len - i, out);
+}
+
+
+BN_KERNEL_TARGET("ssse3")
+static bool HexDecodeSSSE3(const char* src, size_t len, uint8_t* out)
+{
+	size_t i = 0;
+	for (; (i + 32) <= len; i += 32)
+	{
+		__m128i values[2];
+		for (int j = 0; j < 2; j++)
+		{
+			__m128i in = _mm_loadu_si128((const __m128i*)(src + i + j * 16));
+			// Signed compares reject bytes of 0x80 and above along with everything outside the digit ranges
+			__m128i digit = _mm_and_si128(
+				_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), in));
+			__m128i lower = _mm_or_si128(in, _mm_set1_epi8(0x20));
+			__m128i letter = _mm_and_si128(
+				_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+			if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xffff)
+				return false;
+			__m128i digitValue = _mm_and_si128(digit, _mm_sub_epi8(in, _mm_set1_epi8('0')));
+			__m128i letterValue = _mm_and_si128(letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+			values[j] = _mm_or_si128(digitValue, letterValue);
+		}
+		// Combine each pair of nibbles, high nibble first
+		__m128i lo = _mm_maddubs_epi16(values[0], _mm_set1_epi16(0x0110));
+		__m128i hi = _mm_maddubs_epi16(values[1], _mm_set1_epi16(0x0110));
+		_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(lo, hi));
+		out += 16;
+	}
+	return HexDecodeScalar(src + i, len - i, out);
+}
+#endif
+
+
+#ifdef BN_KERNELS_NEON
+static bool EqualNEON(const uint8_t* a, const uint8_t* b, size_t len)
+{
+	size_t i = 0;
+	for (; (i + 16) <= len; i += 16)
+	{
+		uint8x16_t diff = veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+		if (vmaxvq_u8(diff) != 0)
+			return false;
+	}
+	return EqualScalar(a + i, b + i, len - i);
+}
+
+
+static size_t FindNEON(const uint8_t* haystack, size_t haystackLen, const uint8_t* needle, size_t needleLen)
+{
+	if ((needleLen < 2) || (needleLen > haystackLen))
+		return FindScalar(haystack, haystackLen, needle, needleLen);
+
+	uint8x16_t first = vdupq_n_u8(needle[0]);
+	uint8x16_t last = vdupq_n_u8(needle[needleLen - 1]);
+	size_t i = 0;
+	for (; (i + 16 + needleLen - 1) <= haystackLen; i += 16)
+	{
+		uint8x16_t match = vandq_u8(
+			vceqq_u8(vld1q_u8(haystack + i), first), vceqq_u8(vld1q_u8(haystack + i + needleLen - 1), last));
+		if (vmaxvq_u8(match) == 0)
+			continue;
+		uint8_t lanes[16];
+		vst1q_u8(lanes, match);
+		for (size_t j = 0; j < 16; j++)
+		{
+			if (lanes[j] && (memcmp(haystack + i + j + 1, needle + 1, needleLen - 2) == 0))
+				return i + j;
+		}
+	}
+	size_t result = FindScalar(haystack + i, haystackLen - i, needle, needleLen);
+	return (result == (size_t)-1) ? result : (i + result);
+}
+
+
+#ifdef __ARM_FEATURE_CRC32
+static uint32_t Crc32cARM(const uint8_t* data, size_t len, uint32_t crc)
+{
+	crc = ~crc;
+	for (; len >= 8; data += 8, len -= 8)
+		crc = __crc32cd(crc, Load64(data));
+	for (; len > 0; data++, len--)
+		crc = __crc32cb(crc, *data);
+	return ~crc;
+}
+#endif
+
+
+static void HexEncodeNEON(const uint8_t* data, size_t len, char* out)
+{
+	const uint8x16_t digits = vld1q_u8((const uint8_t*)g_hexDigits);
+	size_t i = 0;
+	for (; (i + 16) <= len; i += 16)
+	{
+		uint8x16_t in = vld1q_u8(data + i);
+		uint8x16x2_t result;
+		result.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(in, 4));
+		result.val[1] = vqtbl1q_u8(digits, vandq_u8(in, vdupq_n_u8(0x0f)));
+		vst2q_u8((uint8_t*)out, result);
+		out += 32;
+	}
+	HexEncodeScalar(data + i, len - i, out);
+}
+#endif
+
+
+// XXH64, reference algorithm. The four accumulator lanes already run in parallel in scalar registers, so there is
+// no vector variant.
+static const uint64_t g_xxPrime1 = 0x9e3779b185ebca87ULL;
+static const uint64_t g_xxPrime2 = 0xc2b2ae3d27d4eb4fULL;
+static const uint64_t g_xxPrime3 = 0x165667b19e3779f9ULL;
+static const uint64_t g_xxPrime4 = 0x85ebca77c2b2ae63ULL;
+static const uint64_t g_xxPrime5 = 0x27d4eb2f165667c5ULL;
+
+
+static inline uint64_t RotateLeft64(uint64_t value, int count)
+{
+	return (value << count) | (value >> (64 - count));
+}
+
+
+static inline uint64_t XxRound(uint64_t acc, uint64_t input)
+{
+	acc += input * g_xxPrime2;
+	acc = RotateLeft64(acc, 31);
+	return acc * g_xxPrime1;
+}
+
+
+static inline uint64_t XxMergeRound(uint64_t acc, uint64_t value)
+{
+	acc ^= XxRound(0, value);
+	return acc * g_xxPrime1 + g_xxPrime4;
+}
+
+
+uint64_t DataBufferKernels::XxHash64(const uint8_t* data, size_t len, uint64_t seed)
+{
+	const uint8_t* end = data + len;
+	uint64_t hash;
+	if (len >= 32)
+	{
+		uint64_t v1 = seed + g_xxPrime1 + g_xxPrime2;
+		uint64_t v2 = seed + g_xxPrime2;
+		uint64_t v3 = seed;
+		uint64_t v4 = seed - g_xxPrime1;
+		const uint8_t* limit = end - 32;
+		do
+		{
+			v1 = XxRound(v1, LoadLE64(data));
+			v2 = XxRound(v2, LoadLE64(data + 8));
+			v3 = XxRound(v3, LoadLE64(data + 16));
+			v4 = XxRound(v4, LoadLE64(data + 24));
+			data += 32;
+		} while (data <= limit);
+
+		hash = RotateLeft64(v1, 1) + RotateLeft64(v2, 7) + RotateLeft64(v3, 12) + RotateLeft64(v4, 18);
+		hash = XxMergeRound(hash, v1);
+		hash = XxMergeRound(hash, v2);
+		hash = XxMergeRound(hash, v3);
+		hash = XxMergeRound(hash, v4);
+	}
+	else
+	{
+		hash = seed + g_xxPrime5;
+	}
+
+	hash += (uint64_t)len;
+	for (; (data + 8) <= end; data += 8)
+	{
+		hash ^= XxRound(0, LoadLE64(data));
+		hash = RotateLeft64(hash, 27) * g_xxPrime1 + g_xxPrime4;
+	}
+	if ((data + 4) <= end)
+	{
+		hash ^= (uint64_t)LoadLE32(data) * g_xxPrime1;
+		hash = RotateLeft64(hash, 23) * g_xxPrime2 + g_xxPrime3;
+		data += 4;
+	}
+	for (; data < end; data++)
+	{
+		hash ^= (*data) * g_xxPrime5;
+		hash = RotateLeft64(hash, 11) * g_xxPrime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= g_xxPrime2;
+	hash ^= hash >> 29;
+	hash *= g_xxPrime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+
+struct KernelTable
+{
+	bool (*equal)(const uint8_t*, const uint8_t*, size_t);
+	size_t (*find)(const uint8_t*, size_t, const uint8_t*, size_t);
+	uint32_t (*crc32c)(const uint8_t*, size_t, uint32_t);
+	void (*base64Encode)(const uint8_t*, size_t, char*);
+	bool (*base64Decode)(const char*, size_t, uint8_t*, size_t&);
+	void (*hexEncode)(const uint8_t*, size_t, char*);
+	bool (*hexDecode)(const char*, size_t, uint8_t*);
+};
+
+
+struct CpuFeatures
+{
+	bool ssse3 = false;
+	bool sse42 = false;
+	bool avx2 = false;
+
+	CpuFeatures()
+	{
+#ifdef BN_KERNELS_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 0);
+		int maxLeaf = info[0];
+		__cpuid(info, 1);
+		ssse3 = (info[2] & (1 << 9)) != 0;
+		sse42 = (info[2] & (1 << 20)) != 0;
+		bool osSavesAvx = ((info[2] & (1 << 27)) != 0) && ((info[2] & (1 << 28)) != 0)
+		    && ((_xgetbv(0) & 6) == 6);
+		if (osSavesAvx && (maxLeaf >= 7))
+		{
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+#else
+		__builtin_cpu_init();
+		ssse3 = __builtin_cpu_supports("ssse3");
+		sse42 = __builtin_cpu_supports("sse4.2");
+		avx2 = __builtin_cpu_supports("avx2");
+#endif
+#endif
+	}
+};
+
+
+static const CpuFeatures& GetCpuFeatures()
+{
+	static CpuFeatures features;
+	return features;
+}
+
+
+static KernelTable GetKernelTable(Implementation impl)
+{
+	KernelTable table = {EqualScalar, FindScalar, Crc32cScalar, Base64EncodeScalar, Base64DecodeScalar,
+		HexEncodeScalar, HexDecodeScalar};
+	if (impl == ScalarImplementation)
+		return table;
+
+#ifdef BN_KERNELS_X86
+	const CpuFeatures& features = GetCpuFeatures();
+	table.equal = EqualSSE2;
+	table.find = FindSSE2;
+	if (features.sse42)
+		table.crc32c = Crc32cSSE42;
+	if (features.ssse3)
+	{
+		table.base64Encode = Base64EncodeSSSE3;
+		table.base64Decode = Base64DecodeSSSE3;
+		table.hexEncode = HexEncodeSSSE3;
+		table.hexDecode = HexDecodeSSSE3;
+	}
+	if ((impl == Vector256Implementation) && features.avx2)
+	{
+		table.equal = EqualAVX2;
+		table.find = FindAVX2;
+	}
+#endif
+
+#ifdef BN_KERNELS_NEON
+	table.equal = EqualNEON;
+	table.find = FindNEON;
+#ifdef __ARM_FEATURE_CRC32
+	table.crc32c = Crc32cARM;
+#endif
+	table.hexEncode = HexEncodeNEON;
+#endif
+	return table;
+}
+
+
+static Implementation GetBestImplementation()
+{
+#ifdef BN_KERNELS_X86
+	if (GetCpuFeatures().avx2)
+		return Vector256Implementation;
+	return Vector128Implementation;
+#elif defined(BN_KERNELS_NEON)
+	return Vector128Implementation;
+#else
+	return ScalarImplementation;
+#endif
+}
+
+
+struct KernelDispatch
+{
+	KernelTable tables[3];
+	std::atomic<Implementation> current;
+
+	KernelDispatch()
+	{
+		for (int i = 0; i < 3; i++)
+			tables[i] = GetKernelTable((Implementation)i);
+		current = GetBestImplementation();
+	}
+
+	const KernelTable& Get() const { return tables[current.load(std::memory_order_relaxed)]; }
+};
+
+
+static KernelDispatch& GetDispatch()
+{
+	static KernelDispatch dispatch;
+	return dispatch;
+}
+
+
+vector<Implementation> DataBufferKernels::GetSupportedImplementations()
+{
+	vector<Implementation> result = {ScalarImplementation};
+	Implementation best = GetBestImplementation();
+	if (best >= Vector128Implementation)
+		result.push_back(Vector128Implementation);
+	if (best >= Vector256Implementation)
+		result.push_back(Vector256Implementation);
+	return result;
+}
+
+
+Implementation DataBufferKernels::GetImplementation()
+{
+	return GetDispatch().current;
+}
+
+
+const char* DataBufferKernels::GetImplementationName(Implementation impl)
+{
+	switch (impl)
+	{
+#ifdef BN_KERNELS_X86
+	case Vector128Implementation:
+		return "sse";
+	case Vector256Implementation:
+		return "avx2";
+#elif defined(BN_KERNELS_NEON)
+	case Vector128Implementation:
+		return "neon";
+#endif
+	default:
+		return "scalar";
+	}
+}
+
+
+void DataBufferKernels::SetImplementation(Implementation impl)
+{
+	GetDispatch().current = impl;
+}
+
+
+bool DataBufferKernels::Equal(const uint8_t* a, const uint8_t* b, size_t len)
+{
+	return GetDispatch().Get().equal(a, b, len);
+}
+
+
+size_t DataBufferKernels::Find(const uint8_t* haystack, size_t haystackLen, const uint8_t* needle, size_t needleLen)
+{
+	return GetDispatch().Get().find(haystack, haystackLen, needle, needleLen);
+}
+
+
+uint32_t DataBufferKernels::Crc32c(const uint8_t* data, size_t len, uint32_t crc)
+{
+	return GetDispatch().Get().crc32c(data, len, crc);
+}
+
+
+void DataBufferKernels::Base64Encode(const uint8_t* data, size_t len, char* out)
+{
+	GetDispatch().Get().base64Encode(data, len, out);
+}
+
+
+bool DataBufferKernels::Base64Decode(const char* src, size_t len, uint8_t* out, size_t& outLen)
+{
+	if ((len % 4) != 0)
+		return false;
+	return GetDispatch().Get().base64Decode(src, len, out, outLen);
+}
+
+
+void DataBufferKernels::HexEncode(const uint8_t* data, size_t len, char* out)
+{
+	GetDispatch().Get().hexEncode(data, len, out);
+}
+
+
+bool DataBufferKernels::HexDecode(const char* src, size_t len, uint8_t* out)
+{
+	if ((len % 2) != 0)
+		return false;
+	return GetDispatch().Get().hexDecode(src, len, out);
+}
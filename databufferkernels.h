@@ -0,0 +1,92 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Vectorized byte buffer kernels used by DataBuffer. The implementation is chosen at runtime from the instruction
+// sets the CPU supports: SSE2/SSSE3/SSE4.2/AVX2 on x86-64 and NEON on AArch64, with a portable scalar fallback.
+// Every implementation produces identical results.
+
+namespace BinaryNinja
+{
+	namespace DataBufferKernels
+	{
+		enum Implementation
+		{
+			ScalarImplementation,
+			Vector128Implementation,
+			Vector256Implementation
+		};
+
+		/*! Implementations supported by the current CPU, always including ScalarImplementation */
+		std::vector<Implementation> GetSupportedImplementations();
+		Implementation GetImplementation();
+		const char* GetImplementationName(Implementation impl);
+
+		/*! Force a specific implementation, used to verify the vector kernels against the scalar ones
+
+			@threadunsafe
+		*/
+		void SetImplementation(Implementation impl);
+
+		bool Equal(const uint8_t* a, const uint8_t* b, size_t len);
+
+		/*! Find the first occurrence of needle in haystack
+
+			\return Offset of the match, or (size_t)-1 if there is none
+		*/
+		size_t Find(const uint8_t* haystack, size_t haystackLen, const uint8_t* needle, size_t needleLen);
+
+		/*! CRC-32C (Castagnoli) of the data, continuing from a previous result in crc */
+		uint32_t Crc32c(const uint8_t* data, size_t len, uint32_t crc = 0);
+
+		/*! XXH64 hash of the data */
+		uint64_t XxHash64(const uint8_t* data, size_t len, uint64_t seed = 0);
+
+		inline size_t GetBase64EncodedLength(size_t len) { return ((len + 2) / 3) * 4; }
+
+		/*! Encode to padded base64 using the standard alphabet, writing GetBase64EncodedLength(len) characters */
+		void Base64Encode(const uint8_t* data, size_t len, char* out);
+
+		/*! Decode padded base64 using the standard alphabet. Only canonical input is accepted: the length must be a
+			multiple of four, padding may only appear at the end and unused trailing bits must be zero. Anything else
+			returns false so that callers can defer to the core decoder.
+
+			\param out Must have room for len / 4 * 3 bytes
+			\param[out] outLen Number of bytes decoded
+		*/
+		bool Base64Decode(const char* src, size_t len, uint8_t* out, size_t& outLen);
+
+		/*! Encode to lowercase hex, writing len * 2 characters */
+		void HexEncode(const uint8_t* data, size_t len, char* out);
+
+		/*! Decode hex digits of either case. len must be even.
+
+			\param out Must have room for len / 2 bytes
+			\return false if any character is not a hex digit
+		*/
+		bool HexDecode(const char* src, size_t len, uint8_t* out);
+	}  // namespace DataBufferKernels
+}  // namespace BinaryNinja
@@ -22,6 +22,7 @@
 // TODO : Documentation
 
 
+#include <thread>
 #include "binaryninjaapi.h"
 using namespace BinaryNinja;
 using namespace std;
@@ -276,22 +277,15 @@ bool DebugInfo::AddType(const string& name, Ref<Type> type)
 
 bool DebugInfo::AddFunction(const DebugFunctionInfo& function)
 {
+	// The core copies what it keeps, so the names can be passed without duplicating them first
 	BNDebugFunctionInfo input;
-
-	input.shortName = function.shortName.size() ? BNAllocString(function.shortName.c_str()) : nullptr;
-	input.fullName = function.fullName.size() ? BNAllocString(function.fullName.c_str()) : nullptr;
-	input.rawName = function.rawName.size() ? BNAllocString(function.rawName.c_str()) : nullptr;
+	input.shortName = function.shortName.size() ? const_cast<char*>(function.shortName.c_str()) : nullptr;
+	input.fullName = function.fullName.size() ? const_cast<char*>(function.fullName.c_str()) : nullptr;
+	input.rawName = function.rawName.size() ? const_cast<char*>(function.rawName.c_str()) : nullptr;
 	input.address = function.address;
 	input.type = function.type ? function.type->GetObject() : nullptr;
 	input.platform = function.platform ? function.platform->GetObject() : nullptr;
-
-	bool result = BNAddDebugFunction(m_object, &input);
-
-	BNFreeString(input.shortName);
-	BNFreeString(input.fullName);
-	BNFreeString(input.rawName);
-
-	return result;
+	return BNAddDebugFunction(m_object, &input);
 }
 
 
@@ -303,6 +297,212 @@ bool DebugInfo::AddDataVariable(uint64_t address, Ref<Type> type, const string&
 }
 
 
+size_t DebugInfo::AddTypes(Span<const DebugTypeDefinition> types)
+{
+	size_t added = 0;
+	for (auto& type : types)
+	{
+		if (BNAddDebugType(m_object, type.name, type.type->GetObject()))
+			added++;
+	}
+	return added;
+}
+
+
+size_t DebugInfo::AddFunctions(Span<const DebugFunctionDefinition> functions)
+{
+	size_t added = 0;
+	BNDebugFunctionInfo input;
+	for (auto& function : functions)
+	{
+		input.shortName = const_cast<char*>(function.shortName);
+		input.fullName = const_cast<char*>(function.fullName);
+		input.rawName = const_cast<char*>(function.rawName);
+		input.address = function.address;
+		input.type = function.type ? function.type->GetObject() : nullptr;
+		input.platform = function.platform ? function.platform->GetObject() : nullptr;
+		if (BNAddDebugFunction(m_object, &input))
+			added++;
+	}
+	return added;
+}
+
+
+size_t DebugInfo::AddDataVariables(Span<const DebugDataVariableDefinition> variables)
+{
+	size_t added = 0;
+	for (auto& variable : variables)
+	{
+		if (BNAddDebugDataVariable(m_object, variable.address, variable.type->GetObject(), variable.name))
+			added++;
+	}
+	return added;
+}
+
+
+size_t DebugInfo::AddBatch(const DebugInfoBatch& batch)
+{
+	// Types first, so that functions and data variables referring to them by name can be resolved
+	size_t added = AddTypes(batch.GetTypes());
+	added += AddFunctions(batch.GetFunctions());
+	added += AddDataVariables(batch.GetDataVariables());
+	return added;
+}
+
+
+////////////////////
+// DebugInfoBatch //
+////////////////////
+
+
+const char* DebugInfoBatch::StoreString(const string& str)
+{
+	// Type names are passed straight to BNAddDebugType, so empty strings still need a valid pointer
+	if (str.empty())
+		return "";
+
+	size_t size = str.size() + 1;
+	if (size > m_blockRemaining)
+	{
+		// Oversized strings get a block of their own so the current block can keep being filled
+		if (size > (ArenaBlockSize / 4))
+		{
+			m_blocks.emplace_back(new char[size]);
+			char* result = m_blocks.back().get();
+			memcpy(result, str.c_str(), size);
+			return result;
+		}
+		m_blocks.emplace_back(new char[ArenaBlockSize]);
+		m_blockCursor = m_blocks.back().get();
+		m_blockRemaining = ArenaBlockSize;
+	}
+
+	char* result = m_blockCursor;
+	memcpy(result, str.c_str(), size);
+	m_blockCursor += size;
+	m_blockRemaining -= size;
+	return result;
+}
+
+
+Type* DebugInfoBatch::ReferenceType(const Ref<Type>& type)
+{
+	if (!type)
+		return nullptr;
+	m_typeReferences.push_back(type);
+	return type.GetPtr();
+}
+
+
+Platform* DebugInfoBatch::ReferencePlatform(const Ref<Platform>& platform)
+{
+	if (!platform)
+		return nullptr;
+	// Entries from one unit almost always share a platform
+	if (m_platformReferences.empty() || (m_platformReferences.back().GetPtr() != platform.GetPtr()))
+		m_platformReferences.push_back(platform);
+	return platform.GetPtr();
+}
+
+
+void DebugInfoBatch::AddType(const string& name, Ref<Type> type)
+{
+	m_types.push_back({StoreString(name), ReferenceType(type)});
+}
+
+
+void DebugInfoBatch::AddFunction(const DebugFunctionInfo& function)
+{
+	// Empty names are passed as null, as DebugInfo::AddFunction does
+	auto storeName = [&](const string& name) { return name.empty() ? nullptr : StoreString(name); };
+	m_functions.push_back({storeName(function.shortName), storeName(function.fullName), storeName(function.rawName),
+	    function.address, ReferenceType(function.type), ReferencePlatform(function.platform)});
+}
+
+
+void DebugInfoBatch::AddDataVariable(uint64_t address, Ref<Type> type, const string& name)
+{
+	m_dataVariables.push_back({address, ReferenceType(type), name.empty() ? nullptr : StoreString(name)});
+}
+
+
+void DebugInfoBatch::Clear()
+{
+	m_blocks.clear();
+	m_blockCursor = nullptr;
+	m_blockRemaining = 0;
+	m_typeReferences.clear();
+	m_platformReferences.clear();
+	m_types.clear();
+	m_functions.clear();
+	m_dataVariables.clear();
+}
+
+
+////////////////////////
+// DebugInfoBatchSink //
+////////////////////////
+
+
+DebugInfoBatchSink::DebugInfoBatchSink(Ref<DebugInfo> debugInfo, size_t maxPending) :
+    m_debugInfo(debugInfo), m_maxPending(maxPending)
+{}
+
+
+bool DebugInfoBatchSink::Submit(DebugInfoBatch&& batch)
+{
+	unique_lock<mutex> lock(m_mutex);
+	m_spaceCond.wait(lock, [&]() { return m_closed || (m_maxPending == 0) || (m_pending.size() < m_maxPending); });
+	if (m_closed)
+		return false;
+	m_pending.push_back(std::move(batch));
+	m_pendingCond.notify_one();
+	return true;
+}
+
+
+void DebugInfoBatchSink::Close(bool discardPending)
+{
+	unique_lock<mutex> lock(m_mutex);
+	m_closed = true;
+	if (discardPending)
+		m_pending.clear();
+	m_pendingCond.notify_all();
+	m_spaceCond.notify_all();
+}
+
+
+bool DebugInfoBatchSink::Commit(bool wait)
+{
+	vector<DebugInfoBatch> batches;
+	bool closed;
+	{
+		unique_lock<mutex> lock(m_mutex);
+		if (wait)
+			m_pendingCond.wait(lock, [&]() { return m_closed || !m_pending.empty(); });
+		batches.swap(m_pending);
+		closed = m_closed;
+		m_spaceCond.notify_all();
+	}
+
+	// Producers keep filling the queue while the batches taken here are added
+	size_t added = 0;
+	for (auto& batch : batches)
+		added += m_debugInfo->AddBatch(batch);
+
+	unique_lock<mutex> lock(m_mutex);
+	m_committed += added;
+	return !closed || !m_pending.empty();
+}
+
+
+size_t DebugInfoBatchSink::GetCommittedCount()
+{
+	unique_lock<mutex> lock(m_mutex);
+	return m_committed;
+}
+
+
 /////////////////////
 // DebugInfoParser //
 /////////////////////
@@ -420,3 +620,81 @@ CustomDebugInfoParser::CustomDebugInfoParser(const string& name) :
     DebugInfoParser(
         BNNewDebugInfoParserReference(BNRegisterDebugInfoParser(name.c_str(), IsValidCallback, ParseCallback, this)))
 {}
+
+
+bool CustomDebugInfoParser::ParseUnits(Ref<DebugInfo> debugInfo, size_t unitCount,
+    const function<bool(size_t unit, DebugInfoBatch& batch)>& parseUnit, const function<bool(size_t, size_t)>& progress,
+    size_t threadCount)
+{
+	if (threadCount == 0)
+		threadCount = GetWorkerThreadCount();
+
+	// A couple of batches per worker keeps every worker busy while the calling thread commits
+	DebugInfoBatchSink sink(debugInfo, threadCount * 2);
+	atomic<size_t> completed = 0;
+	atomic<bool> aborted = false;
+	mutex errorMutex;
+	exception_ptr error;
+
+	auto parseOne = [&](size_t unit) {
+		if (aborted)
+			return;
+
+		DebugInfoBatch batch;
+		bool ok;
+		try
+		{
+			ok = parseUnit(unit, batch);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(errorMutex);
+			if (!error)
+				error = current_exception();
+			ok = false;
+		}
+
+		if (!ok)
+		{
+			aborted = true;
+			sink.Close(true);
+			return;
+		}
+
+		completed++;
+		sink.Submit(std::move(batch));
+	};
+
+	thread parseThread([&]() {
+		ParallelFor(unitCount, parseOne, threadCount);
+		sink.Close();
+	});
+
+	try
+	{
+		while (sink.Commit(true))
+		{
+			if (progress && !aborted && !progress(completed, unitCount))
+			{
+				aborted = true;
+				sink.Close(true);
+			}
+		}
+	}
+	catch (...)
+	{
+		// Closing the sink wakes producers blocked in Submit, so the workers finish before the exception leaves
+		{
+			unique_lock<mutex> lock(errorMutex);
+			if (!error)
+				error = current_exception();
+		}
+		aborted = true;
+		sink.Close(true);
+	}
+
+	parseThread.join();
+	if (error)
+		rethrow_exception(error);
+	return !aborted;
+}
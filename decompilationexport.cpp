@@ -0,0 +1,208 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <algorithm>
+#include <condition_variable>
+#include <thread>
+#include "binaryninjaapi.h"
+#include "highlevelilinstruction.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+DecompilationExporter::DecompilationExporter(BinaryView* view, const DecompilationExportSettings& settings) :
+    m_view(view), m_settings(settings)
+{
+}
+
+
+vector<DisassemblyTextLine> DecompilationExporter::RenderFunction(Function* func)
+{
+	if (m_settings.releaseAnalysisData)
+		func->RequestAdvancedAnalysisData();
+
+	vector<DisassemblyTextLine> result;
+	try
+	{
+		Ref<HighLevelILFunction> hlil = func->GetHighLevelIL();
+		if (hlil)
+		{
+			result = func->GetTypeTokens(m_settings.settings);
+			vector<DisassemblyTextLine> body = hlil->GetExprText(hlil->GetRootExpr(), true, m_settings.settings);
+			result.insert(result.end(), make_move_iterator(body.begin()), make_move_iterator(body.end()));
+		}
+	}
+	catch (...)
+	{
+		if (m_settings.releaseAnalysisData)
+			func->ReleaseAdvancedAnalysisData();
+		throw;
+	}
+
+	// Dropping the request lets the core discard this function's IL again once we no longer hold a reference
+	if (m_settings.releaseAnalysisData)
+		func->ReleaseAdvancedAnalysisData();
+	return result;
+}
+
+
+size_t DecompilationExporter::EstimateSize(const vector<DisassemblyTextLine>& lines)
+{
+	size_t size = sizeof(lines) + lines.capacity() * sizeof(DisassemblyTextLine);
+	for (auto& line : lines)
+	{
+		size += line.tokens.capacity() * sizeof(InstructionTextToken);
+		size += line.tags.capacity() * sizeof(Ref<Tag>);
+		for (auto& token : line.tokens)
+		{
+			size += token.text.capacity();
+			for (auto& name : token.typeNames)
+				size += sizeof(string) + name.capacity();
+		}
+	}
+	return size;
+}
+
+
+bool DecompilationExporter::Export(const Sink& sink, const function<bool(size_t, size_t)>& progress)
+{
+	return Export(m_view->GetAnalysisFunctionList(), sink, progress);
+}
+
+
+bool DecompilationExporter::Export(
+    vector<Ref<Function>> funcs, const Sink& sink, const function<bool(size_t, size_t)>& progress)
+{
+	sort(funcs.begin(), funcs.end(), [](const Ref<Function>& a, const Ref<Function>& b) {
+		uint64_t aStart = a->GetStart(), bStart = b->GetStart();
+		if (aStart != bStart)
+			return aStart < bStart;
+		return a->GetArchitecture()->GetName() < b->GetArchitecture()->GetName();
+	});
+
+	struct RenderedFunction
+	{
+		bool ready = false;
+		vector<DisassemblyTextLine> lines;
+		size_t size = 0;
+	};
+
+	size_t count = funcs.size();
+	vector<RenderedFunction> rendered(count);
+	mutex renderMutex;
+	condition_variable renderCond;
+	size_t bufferedSize = 0;
+	size_t nextToWrite = 0;
+	bool cancelled = false;
+	exception_ptr error;
+
+	auto renderOne = [&](size_t i) {
+		{
+			// Hold off on new work while too much rendered text is waiting to be written. The function the writer
+			// is waiting for is always allowed through so the export cannot stall.
+			unique_lock<mutex> lock(renderMutex);
+			renderCond.wait(lock,
+			    [&]() { return cancelled || (bufferedSize < m_settings.memoryLimit) || (i == nextToWrite); });
+			if (cancelled)
+				return;
+		}
+
+		vector<DisassemblyTextLine> lines;
+		try
+		{
+			lines = RenderFunction(funcs[i]);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(renderMutex);
+			if (!error)
+				error = current_exception();
+			cancelled = true;
+			renderCond.notify_all();
+			return;
+		}
+
+		size_t size = EstimateSize(lines);
+		unique_lock<mutex> lock(renderMutex);
+		rendered[i].lines = std::move(lines);
+		rendered[i].size = size;
+		rendered[i].ready = true;
+		bufferedSize += size;
+		renderCond.notify_all();
+	};
+
+	thread renderThread([&]() { ParallelFor(count, renderOne, m_settings.threadCount); });
+
+	bool completed = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		vector<DisassemblyTextLine> lines;
+		size_t size;
+		{
+			unique_lock<mutex> lock(renderMutex);
+			renderCond.wait(lock, [&]() { return rendered[i].ready || cancelled; });
+			if (!rendered[i].ready)
+			{
+				completed = false;
+				break;
+			}
+			lines = std::move(rendered[i].lines);
+			size = rendered[i].size;
+		}
+
+		// A throwing callback cancels the renderers like a false return, and is rethrown once they have stopped
+		bool keepGoing;
+		try
+		{
+			keepGoing = sink(funcs[i], lines);
+			if (keepGoing && progress)
+				keepGoing = progress(i + 1, count);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(renderMutex);
+			if (!error)
+				error = current_exception();
+			keepGoing = false;
+		}
+
+		lines = vector<DisassemblyTextLine>();
+		funcs[i] = nullptr;
+
+		unique_lock<mutex> lock(renderMutex);
+		bufferedSize -= size;
+		nextToWrite = i + 1;
+		if (!keepGoing)
+			cancelled = true;
+		renderCond.notify_all();
+		if (!keepGoing)
+		{
+			completed = false;
+			break;
+		}
+	}
+
+	renderThread.join();
+	if (error)
+		rethrow_exception(error);
+	return completed;
+}
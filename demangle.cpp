@@ -1,12 +1,19 @@
 #include "binaryninjaapi.h"
+#include <cstring>
 #include <string>
 using namespace std;
 
 namespace BinaryNinja {
+	static bool GetTemplateSimplifier(BinaryView* view)
+	{
+		static CachedSetting<bool> setting("analysis.types.templateSimplifier");
+		return setting.Get(view);
+	}
+
 	bool DemangleMS(Architecture* arch, const std::string& mangledName, Ref<Type>& outType, QualifiedName& outVarName,
 	    BinaryView* view)
 	{
-		const bool simplify = Settings::Instance()->Get<bool>("analysis.types.templateSimplifier", view);
+		const bool simplify = GetTemplateSimplifier(view);
 		return DemangleMS(arch, mangledName, outType, outVarName, simplify);
 	}
 
@@ -30,7 +37,7 @@ namespace BinaryNinja {
 	bool DemangleGNU3(Ref<Architecture> arch, const std::string& mangledName, Ref<Type>& outType, QualifiedName& outVarName,
 	    BinaryView* view)
 	{
-		const bool simplify = Settings::Instance()->Get<bool>("analysis.types.templateSimplifier", view);
+		const bool simplify = GetTemplateSimplifier(view);
 		return DemangleGNU3(arch, mangledName, outType, outVarName, simplify);
 	}
 
@@ -59,6 +66,247 @@ namespace BinaryNinja {
 	}
 
 
+	bool IsMSMangledString(const std::string& mangledName)
+	{
+		return GetDemangleScheme(mangledName) == MSDemangleScheme;
+	}
+
+
+	DemangleScheme GetDemangleScheme(std::string_view name)
+	{
+		// Only the first three characters matter, copied out so that short names need no bounds checks
+		unsigned char prefix[3] = {0, 0, 0};
+		memcpy(prefix, name.data(), std::min<size_t>(name.size(), 3));
+		if (prefix[0] == '?')
+			return MSDemangleScheme;
+		bool gnu3 = (prefix[0] == '_') & ((prefix[1] == 'Z') | ((prefix[1] == '_') & (prefix[2] == 'Z')));
+		return gnu3 ? GNU3DemangleScheme : NoDemangleScheme;
+	}
+
+
+	void GetDemangleSchemes(Span<const std::string_view> names, Span<DemangleScheme> out)
+	{
+		for (size_t i = 0; i < names.size(); i++)
+			out[i] = GetDemangleScheme(names[i]);
+	}
+
+
+	string DemangleCache::GetKey(Architecture* arch, DemangleScheme scheme, bool simplify, string_view name)
+	{
+		BNArchitecture* object = arch->GetObject();
+		string key;
+		key.reserve(name.size() + sizeof(object) + 2);
+		key.append((const char*)&object, sizeof(object));
+		key.push_back((char)scheme);
+		key.push_back(simplify ? 1 : 0);
+		key.append(name);
+		return key;
+	}
+
+
+	DemangleCache::Shard& DemangleCache::GetShard(const string& key)
+	{
+		return m_shards[hash<string>()(key) % ShardCount];
+	}
+
+
+	shared_ptr<const DemangleCache::Entry> DemangleCache::Find(
+	    Architecture* arch, DemangleScheme scheme, bool simplify, string_view mangledName)
+	{
+		string key = GetKey(arch, scheme, simplify, mangledName);
+		Shard& shard = GetShard(key);
+		lock_guard<mutex> lock(shard.mutex);
+		auto i = shard.entries.find(key);
+		if (i == shard.entries.end())
+			return nullptr;
+		return i->second;
+	}
+
+
+	void DemangleCache::Insert(Architecture* arch, DemangleScheme scheme, bool simplify, string_view mangledName,
+	    shared_ptr<const Entry> entry)
+	{
+		string key = GetKey(arch, scheme, simplify, mangledName);
+		Shard& shard = GetShard(key);
+		lock_guard<mutex> lock(shard.mutex);
+		shard.entries.emplace(std::move(key), std::move(entry));
+	}
+
+
+	size_t DemangleCache::GetSize()
+	{
+		size_t result = 0;
+		for (auto& shard : m_shards)
+		{
+			lock_guard<mutex> lock(shard.mutex);
+			result += shard.entries.size();
+		}
+		return result;
+	}
+
+
+	void DemangleCache::Clear()
+	{
+		for (auto& shard : m_shards)
+		{
+			lock_guard<mutex> lock(shard.mutex);
+			shard.entries.clear();
+		}
+	}
+
+
+	QualifiedName DemangleBatchResult::GetName(size_t i) const
+	{
+		const Entry& entry = m_entries[m_indices[i]];
+		vector<string> components;
+		components.reserve(entry.componentCount);
+		for (size_t j = 0; j < entry.componentCount; j++)
+			components.emplace_back(GetNameComponent(i, j));
+		return QualifiedName(components);
+	}
+
+
+	string DemangleBatchResult::GetNameString(size_t i) const
+	{
+		const Entry& entry = m_entries[m_indices[i]];
+		string result;
+		for (size_t j = 0; j < entry.componentCount; j++)
+		{
+			if (j != 0)
+				result += "::";
+			result += GetNameComponent(i, j);
+		}
+		return result;
+	}
+
+
+	DemangleBatchResult DemangleBatch(
+	    Architecture* arch, Span<const string_view> names, const DemangleBatchOptions& options)
+	{
+		const bool simplify = options.view ? GetTemplateSimplifier(options.view) : options.simplify;
+		DemangleBatchResult result;
+		result.m_indices.resize(names.size());
+
+		// Identical names are demangled once
+		vector<string_view> unique;
+		{
+			unordered_map<string_view, uint32_t> uniqueIndices;
+			uniqueIndices.reserve(names.size());
+			for (size_t i = 0; i < names.size(); i++)
+			{
+				auto inserted = uniqueIndices.emplace(names[i], (uint32_t)unique.size());
+				if (inserted.second)
+					unique.push_back(names[i]);
+				result.m_indices[i] = inserted.first->second;
+			}
+		}
+
+		vector<DemangleScheme> schemes(unique.size(), options.scheme);
+		if (options.scheme == AutoDemangleScheme)
+			GetDemangleSchemes(unique, schemes);
+
+		// Names from the core are kept as returned until they are copied into the result
+		struct Demangled
+		{
+			bool demangled = false;
+			char** name = nullptr;
+			size_t count = 0;
+			Ref<Type> type;
+			shared_ptr<const DemangleCache::Entry> cached;
+		};
+
+		vector<Demangled> demangled(unique.size());
+		ParallelFor(
+		    unique.size(),
+		    [&](size_t i) {
+			    DemangleScheme scheme = schemes[i];
+			    if (scheme == NoDemangleScheme)
+				    return;
+			    Demangled& out = demangled[i];
+			    if (options.cache)
+			    {
+				    out.cached = options.cache->Find(arch, scheme, simplify, unique[i]);
+				    if (out.cached)
+					    return;
+			    }
+
+			    string mangledName(unique[i]);
+			    BNArchitecture* object = arch->GetObject();
+			    BNType* type = nullptr;
+			    if (scheme == MSDemangleScheme)
+				    out.demangled = BNDemangleMS(object, mangledName.c_str(), &type, &out.name, &out.count, simplify);
+			    else
+				    out.demangled = BNDemangleGNU3(object, mangledName.c_str(), &type, &out.name, &out.count, simplify);
+			    if (type)
+			    {
+				    if (options.includeTypes || options.cache)
+					    out.type = new Type(type);
+				    else
+					    BNFreeType(type);
+			    }
+
+			    if (options.cache)
+			    {
+				    auto entry = make_shared<DemangleCache::Entry>();
+				    entry->demangled = out.demangled;
+				    entry->type = out.type;
+				    entry->name.assign(out.name, out.name + out.count);
+				    options.cache->Insert(arch, scheme, simplify, unique[i], entry);
+				    BNFreeDemangledName(&out.name, out.count);
+				    out.name = nullptr;
+				    out.count = 0;
+				    out.cached = std::move(entry);
+			    }
+		    },
+		    options.threadCount);
+
+		// Copy names into the result, storing each distinct component once
+		unordered_map<string_view, uint32_t> componentIds;
+		result.m_entries.resize(unique.size());
+		result.m_types.resize(unique.size());
+		for (size_t i = 0; i < unique.size(); i++)
+		{
+			Demangled& item = demangled[i];
+			DemangleBatchResult::Entry& entry = result.m_entries[i];
+			entry.scheme = schemes[i];
+			entry.firstComponent = (uint32_t)result.m_nameComponents.size();
+			entry.demangled = item.cached ? item.cached->demangled : item.demangled;
+			if (options.includeTypes)
+				result.m_types[i] = item.cached ? item.cached->type : item.type;
+
+			auto addComponent = [&](string_view component) {
+				auto inserted = componentIds.emplace(component, (uint32_t)result.m_components.size());
+				if (inserted.second)
+				{
+					result.m_components.emplace_back((uint32_t)result.m_strings.size(), (uint32_t)component.size());
+					result.m_strings.append(component);
+				}
+				result.m_nameComponents.push_back(inserted.first->second);
+			};
+			if (item.cached)
+			{
+				for (auto& component : item.cached->name)
+					addComponent(component);
+			}
+			else
+			{
+				for (size_t j = 0; j < item.count; j++)
+					addComponent(item.name[j]);
+			}
+			entry.componentCount = (uint32_t)(result.m_nameComponents.size() - entry.firstComponent);
+		}
+
+		// The interned views point into the demangled names, so those are only freed once copying is done
+		componentIds.clear();
+		for (auto& item : demangled)
+		{
+			if (item.name)
+				BNFreeDemangledName(&item.name, item.count);
+		}
+		return result;
+	}
+
+
 	string SimplifyToString(const string& input)
 	{
 		return BNRustSimplifyStrToStr(input.c_str());
@@ -225,6 +225,33 @@ BNDownloadInstance* DownloadProvider::CreateInstanceCallback(void* ctxt)
 }
 
 
+Ref<DownloadInstance> DownloadProvider::AcquireInstance()
+{
+	{
+		lock_guard<mutex> lock(m_idleMutex);
+		if (!m_idleInstances.empty())
+		{
+			Ref<DownloadInstance> instance = std::move(m_idleInstances.back());
+			m_idleInstances.pop_back();
+			return instance;
+		}
+	}
+	return CreateNewInstance();
+}
+
+
+void DownloadProvider::ReleaseInstance(Ref<DownloadInstance> instance)
+{
+	// Enough to keep a connection per worker of a typical request queue
+	static const size_t maxIdleInstances = 16;
+	if (!instance)
+		return;
+	lock_guard<mutex> lock(m_idleMutex);
+	if (m_idleInstances.size() < maxIdleInstances)
+		m_idleInstances.push_back(std::move(instance));
+}
+
+
 vector<Ref<DownloadProvider>> DownloadProvider::GetList()
 {
 	size_t count;
@@ -77,7 +77,7 @@ int main(int argc, char* argv[])
 
 	cout << "---------- 10 Functions ----------" << endl;
 	int x = 0;
-	for (auto func : bv->GetAnalysisFunctionList())
+	for (auto& func : bv->GetAnalysisFunctionList())
 	{
 		cout << hex << func->GetStart() << " " << func->GetSymbol()->GetFullName() << endl;
 		if (++x >= 10)
@@ -0,0 +1,84 @@
+/*
+ * Command line executable that writes the decompilation
+ * of every function in a binary to a text file.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "binaryninjacore.h"
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		cerr << "USAGE: " << argv[0] << " <file_name> <output_file> [memory_limit_mb]" << endl;
+		exit(-1);
+	}
+
+	/* In order to initiate the bundled plugins properly, the location
+	 * of where bundled plugins directory is must be set. */
+	SetBundledPluginDirectory(GetBundledPluginDirectory());
+	InitPlugins();
+
+	Ref<BinaryView> bv = Load(argv[1]);
+	if (!bv)
+	{
+		fprintf(stderr, "Could not open input file.\n");
+		return -1;
+	}
+
+	FILE* out = fopen(argv[2], "w");
+	if (!out)
+	{
+		fprintf(stderr, "Could not open output file.\n");
+		return -1;
+	}
+
+	DecompilationExportSettings settings;
+	if (argc > 3)
+		settings.memoryLimit = strtoull(argv[3], nullptr, 0) * 1024 * 1024;
+	settings.settings = new DisassemblySettings();
+	settings.settings->SetOption(ShowAddress, false);
+
+	DecompilationExporter exporter(bv, settings);
+	string text;
+	bool writeFailed = false;
+	bool completed = exporter.Export(
+	    [&](Function*, const vector<DisassemblyTextLine>& lines) {
+		    text.clear();
+		    for (auto& line : lines)
+		    {
+			    for (auto& token : line.tokens)
+				    text += token.text;
+			    text += '\n';
+		    }
+		    text += '\n';
+		    writeFailed = fwrite(text.data(), 1, text.size(), out) != text.size();
+		    return !writeFailed;
+	    },
+	    [&](size_t current, size_t total) {
+		    fprintf(stderr, "\r%zu / %zu functions", current, total);
+		    return true;
+	    });
+	fprintf(stderr, "\n");
+
+	if (fclose(out) != 0)
+		writeFailed = true;
+	if (writeFailed)
+		fprintf(stderr, "Could not write output file.\n");
+	else if (!completed)
+		fprintf(stderr, "Export did not complete.\n");
+	bv->GetFile()->Close();
+
+	// Shutting down is required to allow for clean exit of the core
+	BNShutdown();
+
+	return (completed && !writeFailed) ? 0 : -1;
+}
@@ -0,0 +1,88 @@
+/*
+ * Command line executable that writes disassembly, MLIL and HLIL
+ * listings of a binary, comparing single threaded and parallel
+ * rendering times.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "binaryninjacore.h"
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+static double TimeExport(BinaryView* bv, const LinearViewExporter::Factory& factory, DisassemblySettings* settings,
+    size_t threads, const string& path)
+{
+	LinearViewExportSettings exportSettings;
+	exportSettings.threadCount = threads;
+	LinearViewExporter exporter(bv, factory, settings, exportSettings);
+
+	auto start = chrono::steady_clock::now();
+	if (!exporter.ExportToFile(path))
+		cerr << "Failed to write " << path << endl;
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		cerr << "USAGE: " << argv[0] << " <file_name> <output_prefix> [threads]" << endl;
+		exit(-1);
+	}
+
+	size_t threads = 8;
+	if (argc > 3)
+		threads = strtoul(argv[3], nullptr, 0);
+
+	/* In order to initiate the bundled plugins properly, the location
+	 * of where bundled plugins directory is must be set. */
+	SetBundledPluginDirectory(GetBundledPluginDirectory());
+	InitPlugins();
+
+	Ref<BinaryView> bv = Load(argv[1]);
+	if (!bv)
+	{
+		fprintf(stderr, "Could not open input file.\n");
+		return -1;
+	}
+
+	Ref<DisassemblySettings> settings = new DisassemblySettings();
+	settings->SetOption(WaitForIL, true);
+
+	struct
+	{
+		const char* name;
+		LinearViewExporter::Factory factory;
+	} kinds[] = {
+	    {"disasm", LinearViewObject::CreateDisassembly},
+	    {"mlil", LinearViewObject::CreateMediumLevelIL},
+	    {"hlil", LinearViewObject::CreateHighLevelIL},
+	};
+
+	// Render everything once up front so both runs see the same cached analysis state
+	for (auto& kind : kinds)
+		TimeExport(bv, kind.factory, settings, threads, string(argv[2]) + "." + kind.name + ".lst");
+
+	printf("%-8s %12s %12s %8s\n", "kind", "serial (s)", "parallel (s)", "speedup");
+	for (auto& kind : kinds)
+	{
+		string path = string(argv[2]) + "." + kind.name + ".lst";
+		double serial = TimeExport(bv, kind.factory, settings, 1, path);
+		double parallel = TimeExport(bv, kind.factory, settings, threads, path);
+		printf("%-8s %12.3f %12.3f %7.2fx\n", kind.name, serial, parallel, parallel > 0 ? serial / parallel : 0.0);
+	}
+
+	bv->GetFile()->Close();
+
+	// Shutting down is required to allow for clean exit of the core
+	BNShutdown();
+
+	return 0;
+}
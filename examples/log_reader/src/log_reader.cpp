@@ -0,0 +1,130 @@
+/*
+ * Command line tool that prints the records of binary log
+ * files written by BinaryLogWriter as text.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "binaryninjacore.h"
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+static const char* LevelName(BNLogLevel level)
+{
+	switch (level)
+	{
+	case DebugLog:
+		return "debug";
+	case InfoLog:
+		return "info";
+	case WarningLog:
+		return "warn";
+	case ErrorLog:
+		return "error";
+	case AlertLog:
+		return "alert";
+	default:
+		return "?";
+	}
+}
+
+static void Usage(const char* name)
+{
+	cerr << "USAGE: " << name << " [--logger <name>] [--level <0-4>] [--session <id>] <file>..." << endl;
+	cerr << "Files rotated by the writer (log.bnlog.2, log.bnlog.1, log.bnlog) should be given oldest first." << endl;
+	exit(-1);
+}
+
+int main(int argc, char* argv[])
+{
+	string loggerFilter;
+	bool filterLogger = false;
+	int minimumLevel = DebugLog;
+	size_t session = 0;
+	bool filterSession = false;
+	vector<string> files;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if ((strcmp(argv[i], "--logger") == 0) && ((i + 1) < argc))
+		{
+			loggerFilter = argv[++i];
+			filterLogger = true;
+		}
+		else if ((strcmp(argv[i], "--level") == 0) && ((i + 1) < argc))
+		{
+			minimumLevel = atoi(argv[++i]);
+		}
+		else if ((strcmp(argv[i], "--session") == 0) && ((i + 1) < argc))
+		{
+			session = strtoull(argv[++i], nullptr, 0);
+			filterSession = true;
+		}
+		else if (argv[i][0] == '-')
+		{
+			Usage(argv[0]);
+		}
+		else
+		{
+			files.push_back(argv[i]);
+		}
+	}
+	if (files.empty())
+		Usage(argv[0]);
+
+	int result = 0;
+	for (auto& file : files)
+	{
+		BinaryLogReader reader;
+		if (!reader.Open(file))
+		{
+			cerr << "Error: " << file << " is not a binary log file" << endl;
+			result = -1;
+			continue;
+		}
+
+		LogRecord record;
+		while (reader.Next(record))
+		{
+			if ((int)record.level < minimumLevel)
+				continue;
+			if (filterSession && (record.session != session))
+				continue;
+			string loggerName = reader.GetLoggerName(record.loggerId);
+			if (filterLogger && (loggerName != loggerFilter))
+				continue;
+
+			time_t seconds = (time_t)(record.timestamp / 1000000000);
+			struct tm parts;
+#ifdef WIN32
+			localtime_s(&parts, &seconds);
+#else
+			localtime_r(&seconds, &parts);
+#endif
+			char timeText[32];
+			strftime(timeText, sizeof(timeText), "%Y-%m-%d %H:%M:%S", &parts);
+			printf("%s.%06u [%s] %s (session %zu, thread %zx): %.*s\n", timeText,
+				(unsigned)((record.timestamp % 1000000000) / 1000), LevelName(record.level),
+				loggerName.empty() ? "-" : loggerName.c_str(), record.session, record.threadId,
+				(int)record.message.size(), record.message.data());
+		}
+
+		if (reader.IsCorrupt())
+		{
+			cerr << "Warning: " << file << " ends with a truncated or corrupt chunk" << endl;
+			result = -1;
+		}
+	}
+
+	// The reader decompresses through the core, which must be shut down for a clean exit
+	BNShutdown();
+	return result;
+}
@@ -340,11 +340,10 @@ QString PEHeaders::GetNameOfEnumerationMember(BinaryViewRef data, const std::str
 	TypeRef type = data->GetTypeByName(enumName);
 	if (type && (type->GetClass() == EnumerationTypeClass))
 	{
-		for (auto& member : type->GetEnumeration()->GetMembers())
-		{
-			if (member.value == value)
-				return QString::fromStdString(member.name);
-		}
+		BinaryNinja::Ref<BinaryNinja::EnumerationIndex> index = type->GetEnumeration()->GetIndex();
+		const BinaryNinja::EnumerationMember* member = index->GetMemberForValue(value);
+		if (member)
+			return QString::fromStdString(member->name);
 	}
 	return QString("0x") + QString::number(value, 16);
 }
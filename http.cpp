@@ -18,6 +18,8 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <algorithm>
+#include <cctype>
 #include <cstring>
 #include <chrono>
 #include <thread>
@@ -41,19 +43,17 @@ namespace BinaryNinjaCore::Http
 namespace BinaryNinja::Http
 #endif
 {
-#define HTTP_MAX_RETRIES    3
-#define HTTP_BACKOFF_FACTOR 1
-
 	struct RequestContext
 	{
 		size_t uploadOffset;
 		size_t downloadLength;
+		size_t downloaded;
 		bool cancelled;
 		const Request& request;
 		Response& response;
 
 		RequestContext(const Request& request, Response& response) :
-		    uploadOffset(0), downloadLength(0), cancelled(false), request(request), response(response)
+		    uploadOffset(0), downloadLength(0), downloaded(0), cancelled(false), request(request), response(response)
 		{}
 	};
 
@@ -100,8 +100,6 @@ namespace BinaryNinja::Http
 	uint64_t HttpWriteCallback(uint8_t* data, uint64_t len, void* ctxt)
 	{
 		auto* request = reinterpret_cast<RequestContext*>(ctxt);
-		// copy can totally take pointers, pretty cool
-		copy(data, &data[len], back_inserter(request->response.body));
 
 		// Detect content length if it has not been found yet
 		if (request->downloadLength == 0)
@@ -111,7 +109,8 @@ namespace BinaryNinja::Http
 			if (found != headers.end())
 			{
 				request->downloadLength = strtoll(found->second.c_str(), nullptr, 10);
-				request->response.body.reserve(request->downloadLength);
+				if (!request->request.m_responseSink)
+					request->response.body.reserve(request->downloadLength);
 			}
 			else
 			{
@@ -119,9 +118,24 @@ namespace BinaryNinja::Http
 			}
 		}
 
+		request->downloaded += len;
+		if (request->request.m_responseSink)
+		{
+			if (!request->request.m_responseSink(data, len))
+			{
+				request->cancelled = true;
+				return 0;
+			}
+		}
+		else
+		{
+			// copy can totally take pointers, pretty cool
+			copy(data, &data[len], back_inserter(request->response.body));
+		}
+
 		if (request->request.m_downloadProgress)
 		{
-			if (!request->request.m_downloadProgress(request->response.body.size(), request->downloadLength))
+			if (!request->request.m_downloadProgress(request->downloaded, request->downloadLength))
 			{
 				// Signal error by returning non-len
 				request->cancelled = true;
@@ -362,89 +376,345 @@ namespace BinaryNinja::Http
 	}
 
 
-	int Perform(const Ref<DownloadInstance>& instance, const Request& request, Response& response)
+	// Make one attempt at a request. Sets retryable to whether another attempt could be made, which is not the
+	// case once the caller cancelled it or data was already passed to its response sink.
+	static int PerformAttempt(
+	    const Ref<DownloadInstance>& instance, const Request& request, Response& response, bool& retryable)
 	{
-		int result = -1;
-		int retry = 0;
-		while (true)
-		{
-			response.response.statusCode = 0;
-			response.response.headers.clear();
-			response.body.clear();
-			response.error.clear();
+		response.response.statusCode = 0;
+		response.response.headers.clear();
+		response.body.clear();
+		response.error.clear();
 
-			if (getenv("BN_DEBUG_HTTP"))
+		if (getenv("BN_DEBUG_HTTP"))
+		{
+			LogDebug("> %s %s", request.m_method.c_str(), request.m_url.c_str());
+			for (auto& header : request.m_headers)
 			{
-				LogDebug("> %s %s", request.m_method.c_str(), request.m_url.c_str());
-				for (auto& header : request.m_headers)
-				{
-					LogDebug("> %s: %s", header.first.c_str(), header.second.c_str());
-				}
-				LogDebug("> ");
-				if (!request.m_body.empty())
+				LogDebug("> %s: %s", header.first.c_str(), header.second.c_str());
+			}
+			LogDebug("> ");
+			if (!request.m_body.empty())
+			{
+				for (size_t i = 0; i < request.m_body.size(); i += 1000)
 				{
-					for (size_t i = 0; i < request.m_body.size(); i += 1000)
-					{
-						LogDebug("> %.*s", (int)std::min(request.m_body.size() - i, (size_t)1000), request.m_body.data() + i);
-					}
+					LogDebug("> %.*s", (int)std::min(request.m_body.size() - i, (size_t)1000), request.m_body.data() + i);
 				}
 			}
+		}
 
-			RequestContext context {request, response};
-			BNDownloadInstanceInputOutputCallbacks callbacks {};
-			memset(&callbacks, 0, sizeof(BNDownloadInstanceInputOutputCallbacks));
-			callbacks.readContext = &context;
-			callbacks.readCallback = &HttpReadCallback;
-			callbacks.writeContext = &context;
-			callbacks.writeCallback = &HttpWriteCallback;
-			result = instance->PerformCustomRequest(
-			    request.m_method, request.m_url, request.m_headers, response.response, &callbacks);
-			if (getenv("BN_DEBUG_HTTP"))
-			{
-				LogDebug("* Function returned: %d", result);
-			}
-			if (result >= 0)
-				break;
+		RequestContext context {request, response};
+		BNDownloadInstanceInputOutputCallbacks callbacks {};
+		memset(&callbacks, 0, sizeof(BNDownloadInstanceInputOutputCallbacks));
+		callbacks.readContext = &context;
+		callbacks.readCallback = &HttpReadCallback;
+		callbacks.writeContext = &context;
+		callbacks.writeCallback = &HttpWriteCallback;
+		int result = instance->PerformCustomRequest(
+		    request.m_method, request.m_url, request.m_headers, response.response, &callbacks);
+		if (getenv("BN_DEBUG_HTTP"))
+		{
+			LogDebug("* Function returned: %d", result);
+		}
 
+		if (result < 0)
+		{
 			if (getenv("BN_DEBUG_HTTP"))
 			{
 				LogDebug("* Error: %s", instance->GetError().c_str());
 			}
 
-			// Request failed, grab its error and try again
+			// Request failed, grab its error so the caller can report it
 			response.error = instance->GetError();
-			if (retry == HTTP_MAX_RETRIES || context.cancelled)
-				break;
-			size_t backoff = 1000 * HTTP_BACKOFF_FACTOR * (2 * pow(2, retry - 1));
-			retry += 1;
-			LogWarn("Attempt %d to %s %s failed, trying again in %zums\n", retry, request.m_method.data(),
-			    request.m_url.data(), backoff);
-			std::this_thread::sleep_for(std::chrono::milliseconds(backoff));
 		}
-
-		if (getenv("BN_DEBUG_HTTP"))
+		else if (getenv("BN_DEBUG_HTTP"))
 		{
-			if (result >= 0)
+			LogDebug("< HTTP %d", response.response.statusCode);
+			for (auto& header : response.response.headers)
 			{
-				LogDebug("< HTTP %d", response.response.statusCode);
-				for (auto& header : response.response.headers)
-				{
-					LogDebug("< %s: %s", header.first.c_str(), header.second.c_str());
-				}
-				LogDebug("< ");
-				if (!response.body.empty())
+				LogDebug("< %s: %s", header.first.c_str(), header.second.c_str());
+			}
+			LogDebug("< ");
+			if (!response.body.empty())
+			{
+				for (size_t i = 0; i < response.body.size(); i += 1000)
 				{
-					for (size_t i = 0; i < response.body.size(); i += 1000)
-					{
-						LogDebug("< %.*s", (int)std::min(response.body.size() - i, (size_t)1000), response.body.data() + i);
-					}
+					LogDebug("< %.*s", (int)std::min(response.body.size() - i, (size_t)1000), response.body.data() + i);
 				}
 			}
 		}
 
+		retryable = !context.cancelled && (!request.m_responseSink || context.downloaded == 0);
+		return result;
+	}
+
+
+	static bool ShouldRetry(const RetryPolicy& retry, size_t attempt, int result, const Response& response)
+	{
+		if (attempt >= retry.maxRetries)
+			return false;
+		if (result < 0)
+			return true;
+		if (!retry.retryServerErrors)
+			return false;
+		switch (response.response.statusCode)
+		{
+		case 429:
+		case BadGateway:
+		case ServiceUnavailable:
+		case GatewayTimeout:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+
+	static chrono::milliseconds GetRetryDelay(const RetryPolicy& retry, size_t attempt, const Response& response)
+	{
+		double delay = (double)retry.initialBackoff.count() * pow(retry.backoffFactor, (double)attempt);
+		if (delay > (double)retry.maxBackoff.count())
+			delay = (double)retry.maxBackoff.count();
+
+		// Servers that are rate limiting may say how long to wait, in seconds
+		for (auto& header : response.response.headers)
+		{
+			static const char name[] = "retry-after";
+			if ((header.first.size() != sizeof(name) - 1)
+			    || !equal(header.first.begin(), header.first.end(), name,
+			        [](char a, char b) { return tolower((unsigned char)a) == b; }))
+				continue;
+			char* end;
+			long long seconds = strtoll(header.second.c_str(), &end, 10);
+			if ((end != header.second.c_str()) && (seconds > 0))
+				delay = std::max(delay, std::min((double)seconds * 1000.0, (double)retry.maxBackoff.count()));
+		}
+		return chrono::milliseconds((int64_t)delay);
+	}
+
+
+	int Perform(const Ref<DownloadInstance>& instance, const Request& request, Response& response)
+	{
+		RetryPolicy retry;
+		retry.retryServerErrors = false;
+		return Perform(instance, request, response, retry);
+	}
+
+
+	int Perform(
+	    const Ref<DownloadInstance>& instance, const Request& request, Response& response, const RetryPolicy& retry)
+	{
+		size_t attempt = 0;
+		while (true)
+		{
+			bool retryable;
+			int result = PerformAttempt(instance, request, response, retryable);
+			if (!retryable || !ShouldRetry(retry, attempt, result, response))
+				return result;
+
+			chrono::milliseconds backoff = GetRetryDelay(retry, attempt, response);
+			attempt += 1;
+			LogWarn("Attempt %zu to %s %s failed, trying again in %lldms\n", attempt, request.m_method.data(),
+			    request.m_url.data(), (long long)backoff.count());
+			std::this_thread::sleep_for(backoff);
+		}
+	}
+
+
+#ifndef BINARYNINJACORE_LIBRARY
+	RequestQueue::RequestQueue(Ref<DownloadProvider> provider, size_t workerCount, const RetryPolicy& retry) :
+	    m_provider(provider), m_retry(retry)
+	{
+		if (workerCount == 0)
+			workerCount = 1;
+		m_workers.reserve(workerCount);
+		for (size_t i = 0; i < workerCount; i++)
+			m_workers.emplace_back([this]() { WorkerThread(); });
+	}
+
+
+	RequestQueue::~RequestQueue()
+	{
+		Cancel();
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_stopping = true;
+		}
+		m_workCond.notify_all();
+		for (auto& worker : m_workers)
+			worker.join();
+	}
+
+
+	void RequestQueue::Enqueue(Request request, CompletionCallback completion)
+	{
+		{
+			// The generation is read under the lock so a request enqueued after Cancel returns is never
+			// tagged with the cancelled generation
+			unique_lock<mutex> lock(m_mutex);
+			uint64_t generation = m_generation;
+
+			// Transfers in progress stop at their next progress update once the queue is cancelled
+			auto downloadProgress = request.m_downloadProgress;
+			request.m_downloadProgress = [this, generation, downloadProgress](size_t progress, size_t total) {
+				if (m_generation != generation)
+					return false;
+				return !downloadProgress || downloadProgress(progress, total);
+			};
+			auto uploadProgress = request.m_uploadProgress;
+			request.m_uploadProgress = [this, generation, uploadProgress](size_t progress, size_t total) {
+				if (m_generation != generation)
+					return false;
+				return !uploadProgress || uploadProgress(progress, total);
+			};
+
+			m_ready.push_back(Item {std::move(request), std::move(completion), 0, generation});
+		}
+		m_workCond.notify_one();
+	}
+
+
+	std::future<Response> RequestQueue::Enqueue(Request request)
+	{
+		auto promise = make_shared<std::promise<Response>>();
+		std::future<Response> result = promise->get_future();
+		Enqueue(std::move(request), [promise](int, Response& response) { promise->set_value(std::move(response)); });
 		return result;
 	}
 
+
+	void RequestQueue::Wait()
+	{
+		unique_lock<mutex> lock(m_mutex);
+		m_idleCond.wait(lock, [&]() { return m_ready.empty() && m_delayed.empty() && (m_active == 0); });
+	}
+
+
+	void RequestQueue::Cancel()
+	{
+		vector<Item> cancelled;
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_generation++;
+			for (auto& item : m_ready)
+				cancelled.push_back(std::move(item));
+			for (auto& item : m_delayed)
+				cancelled.push_back(std::move(item.second));
+			m_ready.clear();
+			m_delayed.clear();
+			// Cancelled requests stay active until their completions have run, so Wait doesn't return early
+			m_active += cancelled.size();
+		}
+
+		for (auto& item : cancelled)
+		{
+			Response response;
+			response.response.statusCode = 0;
+			response.error = "Request cancelled";
+			Complete(item, -1, response);
+		}
+
+		unique_lock<mutex> lock(m_mutex);
+		m_active -= cancelled.size();
+		m_idleCond.notify_all();
+	}
+
+
+	size_t RequestQueue::GetPendingCount() const
+	{
+		unique_lock<mutex> lock(m_mutex);
+		return m_ready.size() + m_delayed.size() + m_active;
+	}
+
+
+	void RequestQueue::Complete(Item& item, int result, Response& response)
+	{
+		if (!item.completion)
+			return;
+		try
+		{
+			item.completion(result, response);
+		}
+		catch (std::exception& e)
+		{
+			LogError("Exception in completion of %s %s: %s", item.request.m_method.c_str(),
+			    item.request.m_url.c_str(), e.what());
+		}
+	}
+
+
+	void RequestQueue::WorkerThread()
+	{
+		unique_lock<mutex> lock(m_mutex);
+		while (true)
+		{
+			auto now = chrono::steady_clock::now();
+			while (!m_delayed.empty() && (m_delayed.begin()->first <= now))
+			{
+				m_ready.push_back(std::move(m_delayed.begin()->second));
+				m_delayed.erase(m_delayed.begin());
+			}
+
+			if (m_ready.empty())
+			{
+				if (m_stopping)
+					return;
+				if (m_delayed.empty())
+					m_workCond.wait(lock);
+				else
+					m_workCond.wait_until(lock, m_delayed.begin()->first);
+				continue;
+			}
+
+			Item item = std::move(m_ready.front());
+			m_ready.pop_front();
+			m_active++;
+			lock.unlock();
+
+			Response response;
+			int result = -1;
+			bool retryable = false;
+			if (item.generation != m_generation)
+			{
+				response.response.statusCode = 0;
+				response.error = "Request cancelled";
+			}
+			else if (Ref<DownloadInstance> instance = m_provider->AcquireInstance())
+			{
+				result = PerformAttempt(instance, item.request, response, retryable);
+				// An instance whose request failed may have a broken connection, so it is not reused
+				if (result >= 0)
+					m_provider->ReleaseInstance(instance);
+			}
+			else
+			{
+				response.response.statusCode = 0;
+				response.error = "Could not create download instance";
+			}
+
+			retryable = retryable && (item.generation == m_generation);
+			if (retryable && ShouldRetry(m_retry, item.attempt, result, response))
+			{
+				chrono::milliseconds backoff = GetRetryDelay(m_retry, item.attempt, response);
+				item.attempt += 1;
+				LogWarn("Attempt %zu to %s %s failed, trying again in %lldms\n", item.attempt,
+				    item.request.m_method.data(), item.request.m_url.data(), (long long)backoff.count());
+				lock.lock();
+				m_delayed.emplace(chrono::steady_clock::now() + backoff, std::move(item));
+				m_active--;
+				m_workCond.notify_one();
+				continue;
+			}
+
+			Complete(item, result, response);
+			lock.lock();
+			m_active--;
+			m_idleCond.notify_all();
+		}
+	}
+#endif
+
+
 	vector<uint8_t> Response::GetRaw() const noexcept { return body; }
 
 
@@ -27,6 +27,16 @@
 #include <functional>
 #include <utility>
 #include <cstdint>
+#include <chrono>
+#ifndef BINARYNINJACORE_LIBRARY
+	#include <atomic>
+	#include <condition_variable>
+	#include <deque>
+	#include <future>
+	#include <map>
+	#include <mutex>
+	#include <thread>
+#endif
 
 #ifdef BINARYNINJACORE_LIBRARY
 	#include "downloadprovider.h"
@@ -198,6 +208,13 @@ namespace BinaryNinja::Http
 		std::function<bool(size_t, size_t)> m_downloadProgress;
 		std::function<bool(size_t, size_t)> m_uploadProgress;
 
+		/*!
+		    Optional function receiving the response body as it arrives, instead of collecting it in
+		    Response::body. Return false to abort the transfer. Requests that have passed data to the sink
+		    are not retried.
+		 */
+		std::function<bool(const uint8_t* data, size_t len)> m_responseSink;
+
 		/*!
 		    Construct an arbitrary HTTP request with an empty body
 		    \param method Request method eg GET
@@ -354,7 +371,25 @@ namespace BinaryNinja::Http
 
 
 	/*!
-	    Perform an HTTP request as specified by a Request, storing results in a Response
+	    Controls how failed requests are retried
+	 */
+	struct RetryPolicy
+	{
+		/*! Number of attempts made after the first one fails */
+		size_t maxRetries = 3;
+		/*! Delay before the first retry, multiplied by backoffFactor for each later one */
+		std::chrono::milliseconds initialBackoff {1000};
+		double backoffFactor = 2.0;
+		std::chrono::milliseconds maxBackoff {30000};
+		/*! Also retry responses with status 429, 502, 503 or 504, honoring Retry-After when present */
+		bool retryServerErrors = true;
+	};
+
+
+	/*!
+	    Perform an HTTP request as specified by a Request, storing results in a Response.
+	    Requests that fail to complete are retried up to three times. Responses are returned whatever
+	    their status code.
 	    \param instance DownloadInstance instance
 	    \param request Input Request structure with fields
 	    \param response Output Response structure with body
@@ -362,6 +397,121 @@ namespace BinaryNinja::Http
 	 */
 	int Perform(const Ref<DownloadInstance>& instance, const Request& request, Response& response);
 
+
+	/*!
+	    Perform an HTTP request as specified by a Request, retrying as specified by a RetryPolicy.
+	    Retries wait on the calling thread.
+	    \param instance DownloadInstance instance
+	    \param request Input Request structure with fields
+	    \param response Output Response structure with body
+	    \param retry When and how often to retry
+	    \return Zero or greater on success
+	 */
+	int Perform(const Ref<DownloadInstance>& instance, const Request& request, Response& response,
+	    const RetryPolicy& retry);
+
+
+#ifndef BINARYNINJACORE_LIBRARY
+	/*!
+	    Runs HTTP requests concurrently on a fixed set of worker threads.
+
+	    Each worker takes a DownloadInstance from the provider for every request and hands it back when
+	    the request succeeds, so providers that keep connections open per instance reuse them. Failed
+	    requests are put back on the queue with a delay instead of holding a worker while they wait.
+
+	    Any DownloadProvider can be used, so tests can run the queue against a provider that talks to a
+	    local server or answers requests itself.
+
+	    \b Example:
+	    \code{.cpp}
+	    Http::RequestQueue queue(DownloadProvider::GetByName(...), 8);
+	    for (auto& url : urls)
+	        queue.Enqueue(Http::Request::Get(url), [](int result, Http::Response& response) { ... });
+	    queue.Wait();
+	    \endcode
+	 */
+	class RequestQueue
+	{
+	  public:
+		/*!
+		    Called on a worker thread when a request finishes, or on the thread calling Cancel for
+		    requests that had not started
+		    \param result Value Perform would have returned, negative on failure
+		    \param response Response of the last attempt
+		 */
+		typedef std::function<void(int result, Response& response)> CompletionCallback;
+
+	  private:
+		struct Item
+		{
+			Request request;
+			CompletionCallback completion;
+			size_t attempt;
+			uint64_t generation;
+		};
+
+		Ref<DownloadProvider> m_provider;
+		RetryPolicy m_retry;
+		std::vector<std::thread> m_workers;
+		mutable std::mutex m_mutex;
+		std::condition_variable m_workCond;
+		std::condition_variable m_idleCond;
+		std::deque<Item> m_ready;
+		std::multimap<std::chrono::steady_clock::time_point, Item> m_delayed;
+		size_t m_active = 0;
+		bool m_stopping = false;
+		std::atomic<uint64_t> m_generation {0};
+
+		void WorkerThread();
+		static void Complete(Item& item, int result, Response& response);
+
+	  public:
+		/*!
+		    \param provider Provider that performs the requests
+		    \param workerCount Maximum number of requests in flight at once
+		    \param retry When and how often failed requests are retried
+		 */
+		RequestQueue(Ref<DownloadProvider> provider, size_t workerCount = 4, const RetryPolicy& retry = RetryPolicy());
+		/*!
+		    Cancel outstanding requests and wait for the workers to exit
+		 */
+		~RequestQueue();
+
+		RequestQueue(const RequestQueue&) = delete;
+		RequestQueue& operator=(const RequestQueue&) = delete;
+
+		/*!
+		    Add a request to the queue
+		    \param request Request to perform
+		    \param completion Function called once with the outcome
+		 */
+		void Enqueue(Request request, CompletionCallback completion);
+
+		/*!
+		    Add a request to the queue
+		    \param request Request to perform
+		    \return Future receiving the response. Response::error is set if the request failed.
+		 */
+		std::future<Response> Enqueue(Request request);
+
+		/*!
+		    Block until every queued request has completed
+		 */
+		void Wait();
+
+		/*!
+		    Complete every waiting request as failed and abort the transfers in progress. Requests
+		    enqueued afterwards run normally.
+		 */
+		void Cancel();
+
+		/*!
+		    Number of requests that have not completed yet, including those in progress
+		 */
+		size_t GetPendingCount() const;
+	};
+#endif
+
 #undef _STD_VECTOR
 #undef _STD_SET
 #undef _STD_UNORDERED_MAP
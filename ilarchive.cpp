@@ -0,0 +1,974 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#ifdef WIN32
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+#include "binaryninjaapi.h"
+#include "lowlevelilinstruction.h"
+#include "mediumlevelilinstruction.h"
+#include "highlevelilinstruction.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+// File layout (all values in the byte order of the machine that wrote the archive, every section 8 byte aligned):
+//
+//   ArchiveHeader
+//   per function: FormEntry[formCount], then one body per form
+//   FunctionEntry[functionCount], sorted by start address
+//   string table: uint32_t count, uint32_t offsets[count + 1], character data
+//
+// A body is a BodyHeader followed by one column per field, in the order listed in BodyLayout. The header records a
+// byte order mark, and archives written on a machine with the other byte order are rejected when opened.
+
+namespace
+{
+	struct ArchiveHeader
+	{
+		char magic[4];
+		uint32_t version;
+		uint64_t functionCount;
+		uint64_t functionTableOffset;
+		uint64_t stringTableOffset;
+		uint64_t byteOrderMark;
+	};
+
+	struct FunctionEntry
+	{
+		uint64_t start;
+		uint32_t architectureName;
+		uint32_t symbolName;
+		uint32_t formCount;
+		uint32_t reserved;
+		uint64_t formsOffset;
+	};
+
+	struct FormEntry
+	{
+		uint32_t form;
+		uint32_t reserved;
+		uint64_t bodyOffset;
+	};
+
+	struct BodyHeader
+	{
+		uint32_t form;
+		uint32_t operandCount;
+		uint32_t exprCount;
+		uint32_t instrCount;
+		uint32_t blockCount;
+		uint32_t listCount;
+		uint32_t listValueCount;
+		uint32_t reserved;
+	};
+
+	struct ListEntry
+	{
+		uint32_t expr;
+		uint32_t operand;
+		uint32_t offset;
+		uint32_t count;
+	};
+
+	struct BodyLayout
+	{
+		size_t operations, attributes, sizes, flags, sourceOperands, types, parents, addresses, operands;
+		size_t instructions, blocks, lists, listValues, end;
+	};
+
+	const char ArchiveMagic[4] = {'B', 'N', 'I', 'L'};
+	const uint64_t ByteOrderMark = 0x0102030405060708ULL;
+
+	size_t Align8(size_t offset)
+	{
+		return (offset + 7) & ~(size_t)7;
+	}
+
+	BodyLayout GetBodyLayout(const BodyHeader& header, size_t base)
+	{
+		BodyLayout layout;
+		size_t e = header.exprCount;
+		size_t offset = base + sizeof(BodyHeader);
+		auto column = [&](size_t size) {
+			size_t result = offset;
+			offset = Align8(offset + size);
+			return result;
+		};
+		layout.operations = column(e * sizeof(uint32_t));
+		layout.attributes = column(e * sizeof(uint32_t));
+		layout.sizes = column(e * sizeof(uint32_t));
+		layout.flags = column(e * sizeof(uint32_t));
+		layout.sourceOperands = column(e * sizeof(uint32_t));
+		layout.types = column(e * sizeof(uint32_t));
+		layout.parents = column(e * sizeof(uint32_t));
+		layout.addresses = column(e * sizeof(uint64_t));
+		layout.operands = column(e * header.operandCount * sizeof(uint64_t));
+		layout.instructions = column(header.instrCount * sizeof(uint32_t));
+		layout.blocks = column(header.blockCount * 2 * sizeof(uint32_t));
+		layout.lists = column(header.listCount * sizeof(ListEntry));
+		layout.listValues = column(header.listValueCount * sizeof(uint64_t));
+		layout.end = offset;
+		return layout;
+	}
+
+	template <class T>
+	T ReadValue(const uint8_t* data, size_t offset)
+	{
+		T result;
+		memcpy(&result, data + offset, sizeof(T));
+		return result;
+	}
+
+	template <class T>
+	T ReadColumn(const uint8_t* data, size_t column, size_t index)
+	{
+		return ReadValue<T>(data, column + (index * sizeof(T)));
+	}
+
+	class StringTable
+	{
+		mutex m_mutex;
+		unordered_map<string, uint32_t> m_ids;
+		vector<string> m_strings;
+
+	  public:
+		StringTable()
+		{
+			m_strings.push_back("");
+			m_ids[""] = 0;
+		}
+
+		uint32_t Intern(const string& str)
+		{
+			lock_guard<mutex> lock(m_mutex);
+			auto i = m_ids.find(str);
+			if (i != m_ids.end())
+				return i->second;
+			uint32_t id = (uint32_t)m_strings.size();
+			m_strings.push_back(str);
+			m_ids[str] = id;
+			return id;
+		}
+
+		const vector<string>& GetStrings() const { return m_strings; }
+	};
+
+	struct EncodedBody
+	{
+		BodyHeader header;
+		vector<uint32_t> operations, attributes, sizes, flags, sourceOperands, types, parents;
+		vector<uint64_t> addresses, operands;
+		vector<uint32_t> instructions, blocks;
+		vector<ListEntry> lists;
+		vector<uint64_t> listValues;
+
+		void Init(BNFunctionGraphType form, size_t operandCount, size_t exprCount)
+		{
+			memset(&header, 0, sizeof(header));
+			header.form = (uint32_t)form;
+			header.operandCount = (uint32_t)operandCount;
+			header.exprCount = (uint32_t)exprCount;
+			operations.reserve(exprCount);
+			attributes.reserve(exprCount);
+			sizes.reserve(exprCount);
+			flags.reserve(exprCount);
+			sourceOperands.reserve(exprCount);
+			types.reserve(exprCount);
+			parents.reserve(exprCount);
+			addresses.reserve(exprCount);
+			operands.reserve(exprCount * operandCount);
+		}
+
+		void AddList(size_t expr, size_t operand, const uint64_t* values, size_t count)
+		{
+			ListEntry entry;
+			entry.expr = (uint32_t)expr;
+			entry.operand = (uint32_t)operand;
+			entry.offset = (uint32_t)listValues.size();
+			entry.count = (uint32_t)count;
+			lists.push_back(entry);
+			listValues.insert(listValues.end(), values, values + count);
+		}
+
+		void SetBlocks(const vector<Ref<BasicBlock>>& basicBlocks)
+		{
+			for (auto& block : basicBlocks)
+			{
+				blocks.push_back((uint32_t)block->GetStart());
+				blocks.push_back((uint32_t)block->GetEnd());
+			}
+		}
+
+		template <class T>
+		static void AppendColumn(vector<uint8_t>& out, const vector<T>& column)
+		{
+			const uint8_t* data = (const uint8_t*)column.data();
+			out.insert(out.end(), data, data + (column.size() * sizeof(T)));
+			out.resize(Align8(out.size()), 0);
+		}
+
+		void Serialize(vector<uint8_t>& out)
+		{
+			header.instrCount = (uint32_t)instructions.size();
+			header.blockCount = (uint32_t)(blocks.size() / 2);
+			header.listCount = (uint32_t)lists.size();
+			header.listValueCount = (uint32_t)listValues.size();
+
+			const uint8_t* headerData = (const uint8_t*)&header;
+			out.insert(out.end(), headerData, headerData + sizeof(header));
+			AppendColumn(out, operations);
+			AppendColumn(out, attributes);
+			AppendColumn(out, sizes);
+			AppendColumn(out, flags);
+			AppendColumn(out, sourceOperands);
+			AppendColumn(out, types);
+			AppendColumn(out, parents);
+			AppendColumn(out, addresses);
+			AppendColumn(out, operands);
+			AppendColumn(out, instructions);
+			AppendColumn(out, blocks);
+			AppendColumn(out, lists);
+			AppendColumn(out, listValues);
+		}
+	};
+
+	bool IsListOperand(LowLevelILOperandType type)
+	{
+		switch (type)
+		{
+		case IndexListLowLevelOperand:
+		case IndexMapLowLevelOperand:
+		case ExprListLowLevelOperand:
+		case RegisterOrFlagListLowLevelOperand:
+		case SSARegisterListLowLevelOperand:
+		case SSARegisterStackListLowLevelOperand:
+		case SSAFlagListLowLevelOperand:
+		case SSARegisterOrFlagListLowLevelOperand:
+		case RegisterStackAdjustmentsLowLevelOperand:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool IsListOperand(MediumLevelILOperandType type)
+	{
+		switch (type)
+		{
+		case IndexListMediumLevelOperand:
+		case IndexMapMediumLevelOperand:
+		case VariableListMediumLevelOperand:
+		case SSAVariableListMediumLevelOperand:
+		case ExprListMediumLevelOperand:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool IsListOperand(HighLevelILOperandType type)
+	{
+		switch (type)
+		{
+		case ExprListHighLevelOperand:
+		case SSAVariableListHighLevelOperand:
+		case IndexListHighLevelOperand:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	void EncodeIL(LowLevelILFunction* il, BNFunctionGraphType form, EncodedBody& body)
+	{
+		size_t exprCount = il->GetExprCount();
+		body.Init(form, 4, exprCount);
+		for (size_t i = 0; i < exprCount; i++)
+		{
+			BNLowLevelILInstruction raw = il->GetRawExpr(i);
+			body.operations.push_back((uint32_t)raw.operation);
+			body.attributes.push_back(raw.attributes);
+			body.sizes.push_back((uint32_t)raw.size);
+			body.flags.push_back(raw.flags);
+			body.sourceOperands.push_back(raw.sourceOperand);
+			body.types.push_back(0);
+			body.parents.push_back(0);
+			body.addresses.push_back(raw.address);
+			body.operands.insert(body.operands.end(), raw.operands, raw.operands + 4);
+
+			LowLevelILInstruction instr = il->GetExpr(i);
+			for (auto operand : instr.GetOperands())
+			{
+				size_t operandIndex;
+				if (!IsListOperand(operand.GetType()) || !instr.GetOperandIndexForUsage(operand.GetUsage(), operandIndex))
+					continue;
+				size_t count;
+				uint64_t* list = BNLowLevelILGetOperandList(il->GetObject(), i, operandIndex, &count);
+				body.AddList(i, operandIndex, list, count);
+				BNLowLevelILFreeOperandList(list);
+			}
+		}
+
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+			body.instructions.push_back((uint32_t)il->GetIndexForInstruction(i));
+		body.SetBlocks(il->GetBasicBlocks());
+	}
+
+	void EncodeIL(MediumLevelILFunction* il, BNFunctionGraphType form, bool includeTypes, StringTable& strings,
+	    EncodedBody& body)
+	{
+		size_t exprCount = il->GetExprCount();
+		body.Init(form, 5, exprCount);
+		for (size_t i = 0; i < exprCount; i++)
+		{
+			BNMediumLevelILInstruction raw = il->GetRawExpr(i);
+			body.operations.push_back((uint32_t)raw.operation);
+			body.attributes.push_back(raw.attributes);
+			body.sizes.push_back((uint32_t)raw.size);
+			body.flags.push_back(0);
+			body.sourceOperands.push_back(raw.sourceOperand);
+			body.parents.push_back(0);
+			body.addresses.push_back(raw.address);
+			body.operands.insert(body.operands.end(), raw.operands, raw.operands + 5);
+
+			uint32_t typeId = 0;
+			if (includeTypes)
+			{
+				Confidence<Ref<Type>> type = il->GetExprType(i);
+				if (type.GetValue())
+					typeId = strings.Intern(type->GetString());
+			}
+			body.types.push_back(typeId);
+
+			MediumLevelILInstruction instr = il->GetExpr(i);
+			for (auto operand : instr.GetOperands())
+			{
+				size_t operandIndex;
+				if (!IsListOperand(operand.GetType()) || !instr.GetOperandIndexForUsage(operand.GetUsage(), operandIndex))
+					continue;
+				size_t count;
+				uint64_t* list = BNMediumLevelILGetOperandList(il->GetObject(), i, operandIndex, &count);
+				body.AddList(i, operandIndex, list, count);
+				BNMediumLevelILFreeOperandList(list);
+			}
+		}
+
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+			body.instructions.push_back((uint32_t)il->GetIndexForInstruction(i));
+		body.SetBlocks(il->GetBasicBlocks());
+	}
+
+	void EncodeIL(HighLevelILFunction* il, BNFunctionGraphType form, bool includeTypes, StringTable& strings,
+	    EncodedBody& body)
+	{
+		size_t exprCount = il->GetExprCount();
+		body.Init(form, 5, exprCount);
+		for (size_t i = 0; i < exprCount; i++)
+		{
+			BNHighLevelILInstruction raw = il->GetRawExpr(i);
+			body.operations.push_back((uint32_t)raw.operation);
+			body.attributes.push_back(raw.attributes);
+			body.sizes.push_back((uint32_t)raw.size);
+			body.flags.push_back(0);
+			body.sourceOperands.push_back(raw.sourceOperand);
+			body.parents.push_back((uint32_t)raw.parent);
+			body.addresses.push_back(raw.address);
+			body.operands.insert(body.operands.end(), raw.operands, raw.operands + 5);
+
+			uint32_t typeId = 0;
+			if (includeTypes)
+			{
+				Confidence<Ref<Type>> type = il->GetExprType(i);
+				if (type.GetValue())
+					typeId = strings.Intern(type->GetString());
+			}
+			body.types.push_back(typeId);
+
+			HighLevelILInstruction instr = il->GetExpr(i);
+			for (auto operand : instr.GetOperands())
+			{
+				size_t operandIndex;
+				if (!IsListOperand(operand.GetType()) || !instr.GetOperandIndexForUsage(operand.GetUsage(), operandIndex))
+					continue;
+				size_t count;
+				uint64_t* list = BNHighLevelILGetOperandList(il->GetObject(), i, operandIndex, &count);
+				body.AddList(i, operandIndex, list, count);
+				BNHighLevelILFreeOperandList(list);
+			}
+		}
+
+		for (size_t i = 0; i < il->GetInstructionCount(); i++)
+			body.instructions.push_back((uint32_t)il->GetIndexForInstruction(i));
+		body.SetBlocks(il->GetBasicBlocks());
+	}
+
+	// Returns false if the form is not available for this function
+	bool EncodeForm(Function* func, BNFunctionGraphType form, bool includeTypes, StringTable& strings,
+	    EncodedBody& body)
+	{
+		switch (form)
+		{
+		case LowLevelILFunctionGraph:
+		case LiftedILFunctionGraph:
+		case LowLevelILSSAFormFunctionGraph:
+		{
+			Ref<LowLevelILFunction> il = (form == LiftedILFunctionGraph) ? func->GetLiftedIL() : func->GetLowLevelIL();
+			if (il && (form == LowLevelILSSAFormFunctionGraph))
+				il = il->GetSSAForm();
+			if (!il)
+				return false;
+			EncodeIL(il, form, body);
+			return true;
+		}
+		case MediumLevelILFunctionGraph:
+		case MediumLevelILSSAFormFunctionGraph:
+		{
+			Ref<MediumLevelILFunction> il = func->GetMediumLevelIL();
+			if (il && (form == MediumLevelILSSAFormFunctionGraph))
+				il = il->GetSSAForm();
+			if (!il)
+				return false;
+			EncodeIL(il, form, includeTypes, strings, body);
+			return true;
+		}
+		case HighLevelILFunctionGraph:
+		case HighLevelILSSAFormFunctionGraph:
+		{
+			Ref<HighLevelILFunction> il = func->GetHighLevelIL();
+			if (il && (form == HighLevelILSSAFormFunctionGraph))
+				il = il->GetSSAForm();
+			if (!il)
+				return false;
+			EncodeIL(il, form, includeTypes, strings, body);
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+}  // namespace
+
+
+bool ILArchive::WriteView(BinaryView* view, const string& path, const ILArchiveWriteSettings& settings,
+    const function<bool(size_t, size_t)>& progress)
+{
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (!fp)
+		return false;
+
+	ArchiveHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, ArchiveMagic, sizeof(header.magic));
+	header.version = Version;
+	header.byteOrderMark = ByteOrderMark;
+	bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+
+	vector<Ref<Function>> funcs = view->GetAnalysisFunctionList();
+	vector<FunctionEntry> entries(funcs.size());
+	StringTable strings;
+	mutex fileMutex;
+	uint64_t fileOffset = sizeof(header);
+	size_t completed = 0;
+	bool cancelled = false;
+
+	// Functions are encoded independently and appended to the file in completion order, the function table written
+	// at the end records where each one ended up
+	ParallelFor(
+	    funcs.size(),
+	    [&](size_t i) {
+		    {
+			    lock_guard<mutex> lock(fileMutex);
+			    if (cancelled || !ok)
+				    return;
+		    }
+
+		    Function* func = funcs[i];
+		    vector<BNFunctionGraphType> forms;
+		    vector<EncodedBody> bodies;
+		    for (auto form : settings.forms)
+		    {
+			    EncodedBody body;
+			    if (!EncodeForm(func, form, settings.includeTypes, strings, body))
+				    continue;
+			    forms.push_back(form);
+			    bodies.push_back(std::move(body));
+		    }
+
+		    vector<uint8_t> blob(Align8(sizeof(FormEntry) * forms.size()), 0);
+		    vector<uint64_t> bodyOffsets;
+		    for (auto& body : bodies)
+		    {
+			    bodyOffsets.push_back(blob.size());
+			    body.Serialize(blob);
+		    }
+		    bodies.clear();
+
+		    Ref<Symbol> sym = func->GetSymbol();
+		    uint32_t archName = strings.Intern(func->GetArchitecture()->GetName());
+		    uint32_t symName = sym ? strings.Intern(sym->GetFullName()) : 0;
+
+		    lock_guard<mutex> lock(fileMutex);
+		    if (!ok || cancelled)
+			    return;
+		    for (size_t j = 0; j < forms.size(); j++)
+		    {
+			    FormEntry form;
+			    form.form = (uint32_t)forms[j];
+			    form.reserved = 0;
+			    form.bodyOffset = fileOffset + bodyOffsets[j];
+			    memcpy(&blob[j * sizeof(FormEntry)], &form, sizeof(form));
+		    }
+
+		    FunctionEntry& entry = entries[i];
+		    memset(&entry, 0, sizeof(entry));
+		    entry.start = func->GetStart();
+		    entry.architectureName = archName;
+		    entry.symbolName = symName;
+		    entry.formCount = (uint32_t)forms.size();
+		    entry.formsOffset = fileOffset;
+
+		    if (fwrite(blob.data(), 1, blob.size(), fp) != blob.size())
+			    ok = false;
+		    fileOffset += blob.size();
+		    completed++;
+		    if (progress && !progress(completed, funcs.size()))
+			    cancelled = true;
+	    },
+	    settings.threadCount);
+
+	if (ok && !cancelled)
+	{
+		sort(entries.begin(), entries.end(), [](const FunctionEntry& a, const FunctionEntry& b) {
+			return a.start < b.start;
+		});
+		header.functionCount = entries.size();
+		header.functionTableOffset = fileOffset;
+		ok = fwrite(entries.data(), sizeof(FunctionEntry), entries.size(), fp) == entries.size();
+		fileOffset += entries.size() * sizeof(FunctionEntry);
+
+		const vector<string>& table = strings.GetStrings();
+		vector<uint32_t> offsets;
+		uint32_t offset = 0;
+		for (auto& str : table)
+		{
+			offsets.push_back(offset);
+			offset += (uint32_t)str.size();
+		}
+		offsets.push_back(offset);
+
+		header.stringTableOffset = fileOffset;
+		uint32_t count = (uint32_t)table.size();
+		ok = ok && (fwrite(&count, sizeof(count), 1, fp) == 1);
+		ok = ok && (fwrite(offsets.data(), sizeof(uint32_t), offsets.size(), fp) == offsets.size());
+		for (auto& str : table)
+			ok = ok && (fwrite(str.data(), 1, str.size(), fp) == str.size());
+
+		ok = ok && (fseek(fp, 0, SEEK_SET) == 0);
+		ok = ok && (fwrite(&header, sizeof(header), 1, fp) == 1);
+	}
+
+	if (fclose(fp) != 0)
+		ok = false;
+	return ok && !cancelled;
+}
+
+
+Ref<ILArchive> ILArchive::Open(const string& path)
+{
+	Ref<ILArchive> archive = new ILArchive();
+#ifdef WIN32
+	archive->m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+	    FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (archive->m_file == INVALID_HANDLE_VALUE)
+		return nullptr;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(archive->m_file, &size) || (size.QuadPart == 0))
+		return nullptr;
+	archive->m_mapping = CreateFileMappingA(archive->m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!archive->m_mapping)
+		return nullptr;
+	archive->m_data = (const uint8_t*)MapViewOfFile(archive->m_mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!archive->m_data)
+		return nullptr;
+	archive->m_length = (size_t)size.QuadPart;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return nullptr;
+	struct stat st;
+	if ((fstat(fd, &st) != 0) || (st.st_size == 0))
+	{
+		close(fd);
+		return nullptr;
+	}
+	void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return nullptr;
+	archive->m_data = (const uint8_t*)data;
+	archive->m_length = (size_t)st.st_size;
+#endif
+	if (!archive->Load())
+		return nullptr;
+	return archive;
+}
+
+
+ILArchive::~ILArchive()
+{
+#ifdef WIN32
+	if (m_data)
+		UnmapViewOfFile(m_data);
+	if (m_mapping)
+		CloseHandle(m_mapping);
+	if (m_file != INVALID_HANDLE_VALUE)
+		CloseHandle(m_file);
+#else
+	if (m_data)
+		munmap((void*)m_data, m_length);
+#endif
+}
+
+
+bool ILArchive::Load()
+{
+	if (m_length < sizeof(ArchiveHeader))
+		return false;
+	ArchiveHeader header = ReadValue<ArchiveHeader>(m_data, 0);
+	if ((memcmp(header.magic, ArchiveMagic, sizeof(header.magic)) != 0) || (header.version != Version)
+	    || (header.byteOrderMark != ByteOrderMark))
+		return false;
+
+	if ((header.functionTableOffset > m_length)
+	    || (header.functionCount > ((m_length - header.functionTableOffset) / sizeof(FunctionEntry))))
+		return false;
+	m_functionCount = (size_t)header.functionCount;
+	m_functionTable = (size_t)header.functionTableOffset;
+
+	if ((header.stringTableOffset > m_length) || ((m_length - header.stringTableOffset) < sizeof(uint32_t)))
+		return false;
+	size_t offset = (size_t)header.stringTableOffset;
+	uint32_t count = ReadValue<uint32_t>(m_data, offset);
+	offset += sizeof(uint32_t);
+	if (((size_t)count + 1) > ((m_length - offset) / sizeof(uint32_t)))
+		return false;
+	m_stringOffsets.resize((size_t)count + 1);
+	memcpy(m_stringOffsets.data(), m_data + offset, m_stringOffsets.size() * sizeof(uint32_t));
+	m_stringData = offset + (m_stringOffsets.size() * sizeof(uint32_t));
+	for (size_t i = 0; i < count; i++)
+	{
+		if ((m_stringOffsets[i] > m_stringOffsets[i + 1]) || (m_stringOffsets[i + 1] > (m_length - m_stringData)))
+			return false;
+	}
+	return true;
+}
+
+
+string ILArchive::GetString(uint32_t id) const
+{
+	if ((size_t)id + 1 >= m_stringOffsets.size())
+		return "";
+	return string((const char*)m_data + m_stringData + m_stringOffsets[id], m_stringOffsets[id + 1] - m_stringOffsets[id]);
+}
+
+
+ILArchiveFunction ILArchive::GetFunction(size_t i) const
+{
+	if (i >= m_functionCount)
+		throw ILArchiveAccessException();
+	ILArchiveFunction result;
+	result.archive = this;
+	result.index = i;
+	return result;
+}
+
+
+bool ILArchive::GetFunctionAt(uint64_t addr, ILArchiveFunction& result) const
+{
+	size_t lo = 0, hi = m_functionCount;
+	while (lo < hi)
+	{
+		size_t mid = lo + ((hi - lo) / 2);
+		if (ReadColumn<FunctionEntry>(m_data, m_functionTable, mid).start < addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if ((lo >= m_functionCount) || (ReadColumn<FunctionEntry>(m_data, m_functionTable, lo).start != addr))
+		return false;
+	result = GetFunction(lo);
+	return true;
+}
+
+
+static FunctionEntry GetFunctionEntry(const ILArchive* archive, size_t tableOffset, size_t index)
+{
+	return ReadColumn<FunctionEntry>(archive->GetData(), tableOffset, index);
+}
+
+
+uint64_t ILArchiveFunction::GetStart() const
+{
+	return GetFunctionEntry(archive, archive->m_functionTable, index).start;
+}
+
+
+string ILArchiveFunction::GetArchitectureName() const
+{
+	return archive->GetString(GetFunctionEntry(archive, archive->m_functionTable, index).architectureName);
+}
+
+
+string ILArchiveFunction::GetSymbolName() const
+{
+	return archive->GetString(GetFunctionEntry(archive, archive->m_functionTable, index).symbolName);
+}
+
+
+vector<BNFunctionGraphType> ILArchiveFunction::GetForms() const
+{
+	FunctionEntry entry = GetFunctionEntry(archive, archive->m_functionTable, index);
+	vector<BNFunctionGraphType> result;
+	if ((entry.formsOffset > archive->GetLength())
+	    || (entry.formCount > ((archive->GetLength() - entry.formsOffset) / sizeof(FormEntry))))
+		return result;
+	for (size_t i = 0; i < entry.formCount; i++)
+		result.push_back((BNFunctionGraphType)ReadColumn<FormEntry>(archive->GetData(), entry.formsOffset, i).form);
+	return result;
+}
+
+
+bool ILArchiveFunction::GetIL(BNFunctionGraphType form, ILArchiveILFunction& result) const
+{
+	FunctionEntry entry = GetFunctionEntry(archive, archive->m_functionTable, index);
+	size_t length = archive->GetLength();
+	if ((entry.formsOffset > length) || (entry.formCount > ((length - entry.formsOffset) / sizeof(FormEntry))))
+		return false;
+
+	for (size_t i = 0; i < entry.formCount; i++)
+	{
+		FormEntry formEntry = ReadColumn<FormEntry>(archive->GetData(), entry.formsOffset, i);
+		if (formEntry.form != (uint32_t)form)
+			continue;
+
+		// Check that every column of the body lies within the file, so the accessors only need to check indices
+		// against the counts in the header
+		if ((formEntry.bodyOffset > length) || ((length - formEntry.bodyOffset) < sizeof(BodyHeader)))
+			return false;
+		BodyHeader header = ReadValue<BodyHeader>(archive->GetData(), formEntry.bodyOffset);
+		if ((header.operandCount > 5) || (GetBodyLayout(header, formEntry.bodyOffset).end > length))
+			return false;
+
+		result.archive = archive;
+		result.bodyOffset = formEntry.bodyOffset;
+		return true;
+	}
+	return false;
+}
+
+
+static BodyHeader GetBodyHeader(const ILArchive* archive, size_t bodyOffset)
+{
+	return ReadValue<BodyHeader>(archive->GetData(), bodyOffset);
+}
+
+
+BNFunctionGraphType ILArchiveILFunction::GetForm() const
+{
+	return (BNFunctionGraphType)GetBodyHeader(archive, bodyOffset).form;
+}
+
+
+size_t ILArchiveILFunction::GetExprCount() const
+{
+	return GetBodyHeader(archive, bodyOffset).exprCount;
+}
+
+
+size_t ILArchiveILFunction::GetInstructionCount() const
+{
+	return GetBodyHeader(archive, bodyOffset).instrCount;
+}
+
+
+size_t ILArchiveILFunction::GetIndexForInstruction(size_t i) const
+{
+	BodyHeader header = GetBodyHeader(archive, bodyOffset);
+	if (i >= header.instrCount)
+		throw ILArchiveAccessException();
+	BodyLayout layout = GetBodyLayout(header, bodyOffset);
+	return ReadColumn<uint32_t>(archive->GetData(), layout.instructions, i);
+}
+
+
+ILArchiveInstruction ILArchiveILFunction::GetExpr(size_t expr) const
+{
+	if (expr >= GetBodyHeader(archive, bodyOffset).exprCount)
+		throw ILArchiveAccessException();
+	ILArchiveInstruction result;
+	result.archive = archive;
+	result.bodyOffset = bodyOffset;
+	result.exprIndex = expr;
+	return result;
+}
+
+
+ILArchiveInstruction ILArchiveILFunction::GetInstruction(size_t i) const
+{
+	return GetExpr(GetIndexForInstruction(i));
+}
+
+
+vector<pair<size_t, size_t>> ILArchiveILFunction::GetBasicBlocks() const
+{
+	BodyHeader header = GetBodyHeader(archive, bodyOffset);
+	BodyLayout layout = GetBodyLayout(header, bodyOffset);
+	vector<pair<size_t, size_t>> result;
+	result.reserve(header.blockCount);
+	for (size_t i = 0; i < header.blockCount; i++)
+	{
+		result.emplace_back(ReadColumn<uint32_t>(archive->GetData(), layout.blocks, i * 2),
+		    ReadColumn<uint32_t>(archive->GetData(), layout.blocks, (i * 2) + 1));
+	}
+	return result;
+}
+
+
+static BodyLayout GetInstructionLayout(const ILArchiveInstruction* instr)
+{
+	return GetBodyLayout(GetBodyHeader(instr->archive, instr->bodyOffset), instr->bodyOffset);
+}
+
+
+uint32_t ILArchiveInstruction::GetOperation() const
+{
+	return ReadColumn<uint32_t>(archive->GetData(), GetInstructionLayout(this).operations, exprIndex);
+}
+
+
+uint32_t ILArchiveInstruction::GetAttributes() const
+{
+	return ReadColumn<uint32_t>(archive->GetData(), GetInstructionLayout(this).attributes, exprIndex);
+}
+
+
+size_t ILArchiveInstruction::GetSize() const
+{
+	return ReadColumn<uint32_t>(archive->GetData(), GetInstructionLayout(this).sizes, exprIndex);
+}
+
+
+uint32_t ILArchiveInstruction::GetFlags() const
+{
+	return ReadColumn<uint32_t>(archive->GetData(), GetInstructionLayout(this).flags, exprIndex);
+}
+
+
+uint32_t ILArchiveInstruction::GetSourceOperand() const
+{
+	return ReadColumn<uint32_t>(archive->GetData(), GetInstructionLayout(this).sourceOperands, exprIndex);
+}
+
+
+uint64_t ILArchiveInstruction::GetAddress() const
+{
+	return ReadColumn<uint64_t>(archive->GetData(), GetInstructionLayout(this).addresses, exprIndex);
+}
+
+
+size_t ILArchiveInstruction::GetParent() const
+{
+	return ReadColumn<uint32_t>(archive->GetData(), GetInstructionLayout(this).parents, exprIndex);
+}
+
+
+string ILArchiveInstruction::GetType() const
+{
+	return archive->GetString(ReadColumn<uint32_t>(archive->GetData(), GetInstructionLayout(this).types, exprIndex));
+}
+
+
+uint64_t ILArchiveInstruction::GetRawOperandValue(size_t operand) const
+{
+	BodyHeader header = GetBodyHeader(archive, bodyOffset);
+	if (operand >= header.operandCount)
+		return 0;
+	BodyLayout layout = GetBodyLayout(header, bodyOffset);
+	return ReadColumn<uint64_t>(archive->GetData(), layout.operands, (exprIndex * header.operandCount) + operand);
+}
+
+
+ILArchiveInstruction ILArchiveInstruction::GetRawOperandAsExpr(size_t operand) const
+{
+	BodyHeader header = GetBodyHeader(archive, bodyOffset);
+	if (operand >= header.operandCount)
+		throw ILArchiveAccessException();
+	uint64_t expr = GetRawOperandValue(operand);
+	if (expr >= header.exprCount)
+		throw ILArchiveAccessException();
+	ILArchiveInstruction result = *this;
+	result.exprIndex = (size_t)expr;
+	return result;
+}
+
+
+vector<uint64_t> ILArchiveInstruction::GetRawOperandAsList(size_t operand) const
+{
+	BodyHeader header = GetBodyHeader(archive, bodyOffset);
+	BodyLayout layout = GetBodyLayout(header, bodyOffset);
+
+	// List entries are written in expression order, so a binary search finds the first one for this expression
+	size_t lo = 0, hi = header.listCount;
+	while (lo < hi)
+	{
+		size_t mid = lo + ((hi - lo) / 2);
+		if (ReadColumn<ListEntry>(archive->GetData(), layout.lists, mid).expr < exprIndex)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	vector<uint64_t> result;
+	for (; lo < header.listCount; lo++)
+	{
+		ListEntry entry = ReadColumn<ListEntry>(archive->GetData(), layout.lists, lo);
+		if (entry.expr != exprIndex)
+			break;
+		if (entry.operand != operand)
+			continue;
+		if (((size_t)entry.offset + entry.count) > header.listValueCount)
+			break;
+		result.reserve(entry.count);
+		for (size_t i = 0; i < entry.count; i++)
+			result.push_back(ReadColumn<uint64_t>(archive->GetData(), layout.listValues, entry.offset + i));
+		break;
+	}
+	return result;
+}
@@ -0,0 +1,723 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#ifdef WIN32
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+#include "binaryninjaapi.h"
+#include "databufferkernels.h"
+
+using namespace BinaryNinja;
+using namespace std;
+namespace fs = std::filesystem;
+
+// Index layout (all values little endian):
+//
+//   IndexHeader
+//   IndexEntry[entryCount], sorted by name hash, then kind, then name
+//   uint32_t dependencies[dependencyCount], entry indices of the named types each entry references
+//   StringRef info[infoCount]: library name, GUID, dependency name, architecture name, then platform names
+//   string data
+//
+// Names are stored with their components separated by NUL characters.
+
+namespace
+{
+	struct IndexHeader
+	{
+		char magic[4];
+		uint32_t version;
+		uint64_t entryCount;
+		uint64_t typeCount;
+		uint64_t entryTableOffset;
+		uint64_t dependencyCount;
+		uint64_t dependencyTableOffset;
+		uint64_t shardCount;
+		uint64_t infoCount;
+		uint64_t infoTableOffset;
+		uint64_t stringDataOffset;
+		uint64_t stringDataLength;
+	};
+
+	enum EntryKind : uint32_t
+	{
+		NamedTypeEntry = 0,
+		NamedObjectEntry = 1
+	};
+
+	struct IndexEntry
+	{
+		uint64_t hash;
+		uint32_t nameOffset;
+		uint32_t nameLength;
+		uint32_t shard;
+		uint32_t kind;
+		uint32_t dependencyIndex;
+		uint32_t dependencyCount;
+	};
+
+	struct StringRef
+	{
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	enum InfoField
+	{
+		NameInfo = 0,
+		GuidInfo,
+		DependencyNameInfo,
+		ArchitectureNameInfo,
+		FirstPlatformInfo
+	};
+
+	const char IndexMagic[4] = {'B', 'N', 'T', 'X'};
+	const char* IndexFileName = "index.bntx";
+
+	template <typename T>
+	T ReadValue(const uint8_t* data, size_t offset)
+	{
+		T result;
+		memcpy(&result, data + offset, sizeof(T));
+		return result;
+	}
+
+	string EncodeName(const QualifiedName& name)
+	{
+		string result;
+		for (size_t i = 0; i < name.size(); i++)
+		{
+			if (i != 0)
+				result += '\0';
+			result += name[i];
+		}
+		return result;
+	}
+
+	uint64_t HashName(const string& encoded)
+	{
+		return DataBufferKernels::XxHash64((const uint8_t*)encoded.data(), encoded.size());
+	}
+
+	// Names of the named types referenced by a type. References end the walk, so it cannot loop.
+	void CollectReferences(Type* type, vector<QualifiedName>& result)
+	{
+		if (!type)
+			return;
+		switch (type->GetClass())
+		{
+		case NamedTypeReferenceClass:
+			result.push_back(type->GetNamedTypeReference()->GetName());
+			break;
+		case PointerTypeClass:
+		case ArrayTypeClass:
+			CollectReferences(type->GetChildType().GetValue(), result);
+			break;
+		case FunctionTypeClass:
+			CollectReferences(type->GetChildType().GetValue(), result);
+			for (auto& param : type->GetParameters())
+				CollectReferences(param.type.GetValue(), result);
+			break;
+		case StructureTypeClass:
+		{
+			Ref<Structure> structure = type->GetStructure();
+			if (!structure)
+				break;
+			for (auto& base : structure->GetBaseStructures())
+			{
+				if (base.type)
+					result.push_back(base.type->GetName());
+			}
+			for (auto& member : structure->GetMembers())
+				CollectReferences(member.type.GetValue(), result);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	struct ConvertedEntry
+	{
+		QualifiedName name;
+		Ref<Type> type;
+		EntryKind kind;
+		string encodedName;
+		uint64_t hash;
+		uint32_t shard = 0;
+		// Indices of referenced named types, before sorting
+		vector<size_t> dependencies;
+	};
+
+	bool WriteAll(FILE* fp, const void* data, size_t len)
+	{
+		return (len == 0) || (fwrite(data, 1, len, fp) == len);
+	}
+}  // namespace
+
+
+bool LazyTypeLibrary::Convert(TypeLibrary* library, const string& directory, size_t typesPerShard)
+{
+	if (!library || !library->GetObject())
+		return false;
+	if (typesPerShard == 0)
+		typesPerShard = DefaultTypesPerShard;
+
+	error_code ec;
+	fs::create_directories(directory, ec);
+	if (ec)
+		return false;
+
+	vector<ConvertedEntry> entries;
+	for (auto& type : library->GetNamedTypes())
+		entries.push_back({type.name, type.type, NamedTypeEntry, EncodeName(type.name), 0, 0, {}});
+	size_t typeCount = entries.size();
+	for (auto& object : library->GetNamedObjects())
+		entries.push_back({object.name, object.type, NamedObjectEntry, EncodeName(object.name), 0, 0, {}});
+
+	unordered_map<string, size_t> typeIndices;
+	for (size_t i = 0; i < typeCount; i++)
+		typeIndices.emplace(entries[i].encodedName, i);
+	for (auto& entry : entries)
+	{
+		entry.hash = HashName(entry.encodedName);
+		vector<QualifiedName> references;
+		CollectReferences(entry.type, references);
+		for (auto& reference : references)
+		{
+			// References to types from other libraries have no entry here
+			auto i = typeIndices.find(EncodeName(reference));
+			if (i == typeIndices.end())
+				continue;
+			auto& deps = entry.dependencies;
+			if (find(deps.begin(), deps.end(), i->second) == deps.end())
+				deps.push_back(i->second);
+		}
+	}
+
+	// Types are laid out depth first with dependencies before their users, so that a type tends to share a shard
+	// with the types it needs. Objects follow in library order.
+	vector<size_t> layout;
+	layout.reserve(entries.size());
+	vector<bool> visited(typeCount, false);
+	for (size_t root = 0; root < typeCount; root++)
+	{
+		if (visited[root])
+			continue;
+		vector<pair<size_t, size_t>> stack = {{root, 0}};
+		visited[root] = true;
+		while (!stack.empty())
+		{
+			auto& top = stack.back();
+			const vector<size_t>& deps = entries[top.first].dependencies;
+			if (top.second < deps.size())
+			{
+				size_t next = deps[top.second++];
+				if (!visited[next])
+				{
+					visited[next] = true;
+					stack.push_back({next, 0});
+				}
+				continue;
+			}
+			layout.push_back(top.first);
+			stack.pop_back();
+		}
+	}
+	for (size_t i = typeCount; i < entries.size(); i++)
+		layout.push_back(i);
+
+	size_t shardCount = (layout.size() + typesPerShard - 1) / typesPerShard;
+	Ref<Architecture> arch = library->GetArchitecture();
+	string libraryName = library->GetName();
+	for (size_t shard = 0; shard < shardCount; shard++)
+	{
+		Ref<TypeLibrary> shardLibrary = new TypeLibrary(arch, fmt::format("{}.shard{}", libraryName, shard));
+		size_t end = min(layout.size(), (shard + 1) * typesPerShard);
+		for (size_t i = shard * typesPerShard; i < end; i++)
+		{
+			ConvertedEntry& entry = entries[layout[i]];
+			entry.shard = (uint32_t)shard;
+			if (entry.kind == NamedTypeEntry)
+				shardLibrary->AddNamedType(entry.name, entry.type);
+			else
+				shardLibrary->AddNamedObject(entry.name, entry.type);
+		}
+		// WriteToFile does not report failure, so a shard left over from an earlier conversion is removed first
+		// and the new one must exist and have contents before an index referring to it is written
+		fs::path shardPath = fs::path(directory) / fmt::format("shard_{}.bntl", shard);
+		fs::remove(shardPath, ec);
+		shardLibrary->WriteToFile(shardPath.string());
+		uintmax_t shardSize = fs::file_size(shardPath, ec);
+		if (ec || (shardSize == 0))
+		{
+			LogError("Failed to write type library shard '%s'", shardPath.string().c_str());
+			return false;
+		}
+	}
+
+	vector<size_t> order(entries.size());
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = i;
+	sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+		if (entries[a].hash != entries[b].hash)
+			return entries[a].hash < entries[b].hash;
+		if (entries[a].kind != entries[b].kind)
+			return entries[a].kind < entries[b].kind;
+		return entries[a].encodedName < entries[b].encodedName;
+	});
+	vector<uint32_t> sortedIndex(entries.size());
+	for (size_t i = 0; i < order.size(); i++)
+		sortedIndex[order[i]] = (uint32_t)i;
+
+	vector<string> info = {libraryName, library->GetGuid(), library->GetDependencyName(), arch->GetName()};
+	for (auto& platform : library->GetPlatformNames())
+		info.push_back(platform);
+
+	string strings;
+	vector<IndexEntry> table;
+	vector<uint32_t> dependencies;
+	table.reserve(entries.size());
+	for (size_t i : order)
+	{
+		ConvertedEntry& entry = entries[i];
+		IndexEntry indexEntry;
+		indexEntry.hash = entry.hash;
+		indexEntry.nameOffset = (uint32_t)strings.size();
+		indexEntry.nameLength = (uint32_t)entry.encodedName.size();
+		indexEntry.shard = entry.shard;
+		indexEntry.kind = entry.kind;
+		indexEntry.dependencyIndex = (uint32_t)dependencies.size();
+		indexEntry.dependencyCount = (uint32_t)entry.dependencies.size();
+		strings += entry.encodedName;
+		for (size_t dependency : entry.dependencies)
+			dependencies.push_back(sortedIndex[dependency]);
+		table.push_back(indexEntry);
+	}
+	vector<StringRef> infoTable;
+	for (auto& field : info)
+	{
+		infoTable.push_back({(uint32_t)strings.size(), (uint32_t)field.size()});
+		strings += field;
+	}
+
+	IndexHeader header;
+	memcpy(header.magic, IndexMagic, sizeof(header.magic));
+	header.version = Version;
+	header.entryCount = table.size();
+	header.typeCount = typeCount;
+	header.entryTableOffset = sizeof(IndexHeader);
+	header.dependencyCount = dependencies.size();
+	header.dependencyTableOffset = header.entryTableOffset + (table.size() * sizeof(IndexEntry));
+	header.shardCount = shardCount;
+	header.infoCount = infoTable.size();
+	header.infoTableOffset = header.dependencyTableOffset + (dependencies.size() * sizeof(uint32_t));
+	header.stringDataOffset = header.infoTableOffset + (infoTable.size() * sizeof(StringRef));
+	header.stringDataLength = strings.size();
+
+	// Written under a temporary name so that an interrupted conversion never leaves a truncated index behind
+	string path = (fs::path(directory) / IndexFileName).string();
+	string tempPath = path + ".tmp";
+	FILE* fp = fopen(tempPath.c_str(), "wb");
+	if (!fp)
+		return false;
+	bool ok = WriteAll(fp, &header, sizeof(header));
+	ok = ok && WriteAll(fp, table.data(), table.size() * sizeof(IndexEntry));
+	ok = ok && WriteAll(fp, dependencies.data(), dependencies.size() * sizeof(uint32_t));
+	ok = ok && WriteAll(fp, infoTable.data(), infoTable.size() * sizeof(StringRef));
+	ok = ok && WriteAll(fp, strings.data(), strings.size());
+	if (fclose(fp) != 0)
+		ok = false;
+	if (ok)
+		fs::rename(tempPath, path, ec);
+	if (!ok || ec)
+	{
+		fs::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+
+LazyTypeLibrary::LazyTypeLibrary(size_t typeCacheSize, size_t shardCacheSize) :
+    m_typeCacheSize(max<size_t>(typeCacheSize, 1)), m_shardCacheSize(max<size_t>(shardCacheSize, 1))
+{}
+
+
+Ref<LazyTypeLibrary> LazyTypeLibrary::Open(const string& directory, size_t typeCacheSize, size_t shardCacheSize)
+{
+	Ref<LazyTypeLibrary> library = new LazyTypeLibrary(typeCacheSize, shardCacheSize);
+	library->m_directory = directory;
+	string path = (fs::path(directory) / IndexFileName).string();
+#ifdef WIN32
+	library->m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+	    FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (library->m_file == INVALID_HANDLE_VALUE)
+		return nullptr;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(library->m_file, &size) || (size.QuadPart == 0))
+		return nullptr;
+	library->m_mapping = CreateFileMappingA(library->m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!library->m_mapping)
+		return nullptr;
+	library->m_data = (const uint8_t*)MapViewOfFile(library->m_mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!library->m_data)
+		return nullptr;
+	library->m_length = (size_t)size.QuadPart;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return nullptr;
+	struct stat st;
+	if ((fstat(fd, &st) != 0) || (st.st_size == 0))
+	{
+		close(fd);
+		return nullptr;
+	}
+	void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return nullptr;
+	library->m_data = (const uint8_t*)data;
+	library->m_length = (size_t)st.st_size;
+#endif
+	if (!library->Load())
+		return nullptr;
+	return library;
+}
+
+
+LazyTypeLibrary::~LazyTypeLibrary()
+{
+#ifdef WIN32
+	if (m_data)
+		UnmapViewOfFile(m_data);
+	if (m_mapping)
+		CloseHandle(m_mapping);
+	if (m_file != INVALID_HANDLE_VALUE)
+		CloseHandle(m_file);
+#else
+	if (m_data)
+		munmap((void*)m_data, m_length);
+#endif
+}
+
+
+bool LazyTypeLibrary::Load()
+{
+	if (m_length < sizeof(IndexHeader))
+		return false;
+	IndexHeader header = ReadValue<IndexHeader>(m_data, 0);
+	if ((memcmp(header.magic, IndexMagic, sizeof(header.magic)) != 0) || (header.version != Version))
+		return false;
+
+	auto fits = [&](uint64_t offset, uint64_t count, size_t size) {
+		return (offset <= m_length) && (count <= ((m_length - offset) / size));
+	};
+	if (!fits(header.entryTableOffset, header.entryCount, sizeof(IndexEntry))
+	    || !fits(header.dependencyTableOffset, header.dependencyCount, sizeof(uint32_t))
+	    || !fits(header.infoTableOffset, header.infoCount, sizeof(StringRef))
+	    || !fits(header.stringDataOffset, header.stringDataLength, 1) || (header.typeCount > header.entryCount)
+	    || (header.infoCount < FirstPlatformInfo))
+		return false;
+
+	m_entryCount = (size_t)header.entryCount;
+	m_typeCount = (size_t)header.typeCount;
+	m_entryTable = (size_t)header.entryTableOffset;
+	m_dependencyCount = (size_t)header.dependencyCount;
+	m_dependencyTable = (size_t)header.dependencyTableOffset;
+	m_shardCount = (size_t)header.shardCount;
+	m_stringData = (size_t)header.stringDataOffset;
+	m_stringLength = (size_t)header.stringDataLength;
+
+	// Entries are validated up front so that lookups can trust the table
+	for (size_t i = 0; i < m_entryCount; i++)
+	{
+		IndexEntry entry = ReadValue<IndexEntry>(m_data, m_entryTable + (i * sizeof(IndexEntry)));
+		if (((uint64_t)entry.nameOffset + entry.nameLength > m_stringLength) || (entry.shard >= m_shardCount)
+		    || ((uint64_t)entry.dependencyIndex + entry.dependencyCount > m_dependencyCount))
+			return false;
+	}
+	for (size_t i = 0; i < m_dependencyCount; i++)
+	{
+		if (ReadValue<uint32_t>(m_data, m_dependencyTable + (i * sizeof(uint32_t))) >= m_entryCount)
+			return false;
+	}
+
+	for (size_t i = 0; i < (size_t)header.infoCount; i++)
+	{
+		StringRef field = ReadValue<StringRef>(m_data, (size_t)header.infoTableOffset + (i * sizeof(StringRef)));
+		if ((uint64_t)field.offset + field.length > m_stringLength)
+			return false;
+		m_info.emplace_back((const char*)m_data + m_stringData + field.offset, field.length);
+	}
+	return true;
+}
+
+
+bool LazyTypeLibrary::FindEntry(const QualifiedName& name, bool object, size_t& result) const
+{
+	string encoded = EncodeName(name);
+	uint64_t hash = HashName(encoded);
+	uint32_t kind = object ? NamedObjectEntry : NamedTypeEntry;
+
+	size_t low = 0, high = m_entryCount;
+	while (low < high)
+	{
+		size_t mid = low + ((high - low) / 2);
+		if (ReadValue<uint64_t>(m_data, m_entryTable + (mid * sizeof(IndexEntry))) < hash)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	for (size_t i = low; i < m_entryCount; i++)
+	{
+		IndexEntry entry = ReadValue<IndexEntry>(m_data, m_entryTable + (i * sizeof(IndexEntry)));
+		if (entry.hash != hash)
+			break;
+		if ((entry.kind == kind) && (entry.nameLength == encoded.size())
+		    && (memcmp(m_data + m_stringData + entry.nameOffset, encoded.data(), encoded.size()) == 0))
+		{
+			result = i;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+QualifiedName LazyTypeLibrary::GetEntryName(size_t entry) const
+{
+	IndexEntry indexEntry = ReadValue<IndexEntry>(m_data, m_entryTable + (entry * sizeof(IndexEntry)));
+	const char* data = (const char*)m_data + m_stringData + indexEntry.nameOffset;
+	vector<string> components;
+	size_t start = 0;
+	for (size_t i = 0; i <= indexEntry.nameLength; i++)
+	{
+		if ((i == indexEntry.nameLength) || (data[i] == '\0'))
+		{
+			components.emplace_back(data + start, i - start);
+			start = i + 1;
+		}
+	}
+	return QualifiedName(components);
+}
+
+
+vector<QualifiedName> LazyTypeLibrary::GetEntryNames(bool objects) const
+{
+	vector<QualifiedName> result;
+	result.reserve(objects ? GetNamedObjectCount() : GetNamedTypeCount());
+	uint32_t kind = objects ? NamedObjectEntry : NamedTypeEntry;
+	for (size_t i = 0; i < m_entryCount; i++)
+	{
+		if (ReadValue<IndexEntry>(m_data, m_entryTable + (i * sizeof(IndexEntry))).kind == kind)
+			result.push_back(GetEntryName(i));
+	}
+	return result;
+}
+
+
+// Shards are loaded without holding m_cacheMutex, so a slow load doesn't block lookups of cached types. Threads
+// racing to load the same shard keep whichever copy was published first.
+Ref<TypeLibrary> LazyTypeLibrary::GetShard(uint32_t shard)
+{
+	{
+		lock_guard<mutex> lock(m_cacheMutex);
+		auto i = m_shards.find(shard);
+		if (i != m_shards.end())
+		{
+			m_shardOrder.splice(m_shardOrder.begin(), m_shardOrder, i->second.order);
+			return i->second.library;
+		}
+	}
+
+	string path = (fs::path(m_directory) / fmt::format("shard_{}.bntl", shard)).string();
+	BNTypeLibrary* handle = BNLoadTypeLibraryFromFile(path.c_str());
+	if (!handle)
+	{
+		LogError("Unable to load type library shard '%s'", path.c_str());
+		return nullptr;
+	}
+	Ref<TypeLibrary> library = new TypeLibrary(handle);
+
+	lock_guard<mutex> lock(m_cacheMutex);
+	m_shardLoads++;
+	auto i = m_shards.find(shard);
+	if (i != m_shards.end())
+	{
+		m_shardOrder.splice(m_shardOrder.begin(), m_shardOrder, i->second.order);
+		return i->second.library;
+	}
+	m_shardOrder.push_front(shard);
+	m_shards[shard] = {library, m_shardOrder.begin()};
+	while (m_shards.size() > m_shardCacheSize)
+	{
+		m_shards.erase(m_shardOrder.back());
+		m_shardOrder.pop_back();
+	}
+	return library;
+}
+
+
+Ref<Type> LazyTypeLibrary::GetEntryType(size_t entry)
+{
+	{
+		lock_guard<mutex> lock(m_cacheMutex);
+		auto i = m_types.find(entry);
+		if (i != m_types.end())
+		{
+			m_typeOrder.splice(m_typeOrder.begin(), m_typeOrder, i->second.order);
+			return i->second.type;
+		}
+	}
+
+	IndexEntry indexEntry = ReadValue<IndexEntry>(m_data, m_entryTable + (entry * sizeof(IndexEntry)));
+	Ref<TypeLibrary> shard = GetShard(indexEntry.shard);
+	if (!shard)
+		return nullptr;
+	QualifiedName name = GetEntryName(entry);
+	Ref<Type> type = (indexEntry.kind == NamedObjectEntry) ? shard->GetNamedObject(name) : shard->GetNamedType(name);
+	if (!type)
+		return nullptr;
+
+	lock_guard<mutex> lock(m_cacheMutex);
+	auto i = m_types.find(entry);
+	if (i != m_types.end())
+	{
+		m_typeOrder.splice(m_typeOrder.begin(), m_typeOrder, i->second.order);
+		return i->second.type;
+	}
+	m_typeOrder.push_front(entry);
+	m_types[entry] = {type, m_typeOrder.begin()};
+	while (m_types.size() > m_typeCacheSize)
+	{
+		m_types.erase(m_typeOrder.back());
+		m_typeOrder.pop_back();
+	}
+	return type;
+}
+
+
+string LazyTypeLibrary::GetName() const
+{
+	return m_info[NameInfo];
+}
+
+
+string LazyTypeLibrary::GetGuid() const
+{
+	return m_info[GuidInfo];
+}
+
+
+string LazyTypeLibrary::GetDependencyName() const
+{
+	return m_info[DependencyNameInfo];
+}
+
+
+string LazyTypeLibrary::GetArchitectureName() const
+{
+	return m_info[ArchitectureNameInfo];
+}
+
+
+vector<string> LazyTypeLibrary::GetPlatformNames() const
+{
+	return vector<string>(m_info.begin() + FirstPlatformInfo, m_info.end());
+}
+
+
+vector<QualifiedName> LazyTypeLibrary::GetNamedTypeNames() const
+{
+	return GetEntryNames(false);
+}
+
+
+vector<QualifiedName> LazyTypeLibrary::GetNamedObjectNames() const
+{
+	return GetEntryNames(true);
+}
+
+
+Ref<Type> LazyTypeLibrary::GetNamedType(const QualifiedName& name)
+{
+	size_t entry;
+	if (!FindEntry(name, false, entry))
+		return nullptr;
+	return GetEntryType(entry);
+}
+
+
+Ref<Type> LazyTypeLibrary::GetNamedObject(const QualifiedName& name)
+{
+	size_t entry;
+	if (!FindEntry(name, true, entry))
+		return nullptr;
+	return GetEntryType(entry);
+}
+
+
+vector<QualifiedNameAndType> LazyTypeLibrary::GetNamedTypeWithDependencies(const QualifiedName& name)
+{
+	vector<QualifiedNameAndType> result;
+	size_t root;
+	if (!FindEntry(name, false, root))
+		return result;
+
+	vector<size_t> pending = {root};
+	unordered_set<size_t> seen = {root};
+	for (size_t next = 0; next < pending.size(); next++)
+	{
+		size_t entry = pending[next];
+		Ref<Type> type = GetEntryType(entry);
+		if (!type)
+			continue;
+		result.push_back({GetEntryName(entry), type});
+
+		IndexEntry indexEntry = ReadValue<IndexEntry>(m_data, m_entryTable + (entry * sizeof(IndexEntry)));
+		for (size_t i = 0; i < indexEntry.dependencyCount; i++)
+		{
+			size_t dependency = ReadValue<uint32_t>(
+			    m_data, m_dependencyTable + ((indexEntry.dependencyIndex + i) * sizeof(uint32_t)));
+			if (seen.insert(dependency).second)
+				pending.push_back(dependency);
+		}
+	}
+	return result;
+}
+
+
+uint64_t LazyTypeLibrary::GetShardLoadCount()
+{
+	lock_guard<mutex> lock(m_cacheMutex);
+	return m_shardLoads;
+}
@@ -0,0 +1,268 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+// Lines are assigned to chunks by the function that owns them, or by their own address outside of functions,
+// so that a function is never split between two chunks
+static uint64_t GetLineChunkKey(const LinearDisassemblyLine& line)
+{
+	if (line.function)
+		return line.function->GetStart();
+	return line.contents.addr;
+}
+
+
+LinearViewExporter::LinearViewExporter(BinaryView* view, const Factory& factory, DisassemblySettings* settings,
+    const LinearViewExportSettings& exportSettings) :
+    m_view(view), m_factory(factory), m_settings(settings), m_exportSettings(exportSettings)
+{
+	if (!m_settings)
+		m_settings = new DisassemblySettings();
+}
+
+
+void LinearViewExporter::FormatLine(const LinearDisassemblyLine& line, bool includeAddress, string& output)
+{
+	if (includeAddress)
+		fmt::format_to(back_inserter(output), "{:08x}  ", line.contents.addr);
+	for (auto& token : line.contents.tokens)
+		output += token.text;
+	output += '\n';
+}
+
+
+vector<uint64_t> LinearViewExporter::GetChunkBoundaries(size_t chunkCount)
+{
+	vector<uint64_t> objects;
+	for (auto& func : m_view->GetAnalysisFunctionList())
+		objects.push_back(func->GetStart());
+	for (auto& var : m_view->GetDataVariables())
+		objects.push_back(var.first);
+	sort(objects.begin(), objects.end());
+	objects.erase(unique(objects.begin(), objects.end()), objects.end());
+
+	// Split so that each chunk holds roughly the same number of functions and data variables
+	vector<uint64_t> result;
+	for (size_t i = 1; i < chunkCount; i++)
+	{
+		size_t index = (i * objects.size()) / chunkCount;
+		if (index == 0 || index >= objects.size())
+			continue;
+		if (result.empty() || (result.back() != objects[index]))
+			result.push_back(objects[index]);
+	}
+	return result;
+}
+
+
+void LinearViewExporter::RenderChunk(uint64_t start, uint64_t end, bool fromBeginning, string& output)
+{
+	Ref<LinearViewObject> root = m_factory(m_view, m_settings);
+	if (!root)
+		return;
+	Ref<LinearViewCursor> cursor = new LinearViewCursor(root);
+
+	if (fromBeginning)
+	{
+		cursor->SeekToBegin();
+	}
+	else
+	{
+		// Seeking lands on the line for the address, so walk back to the first object that belongs to this chunk,
+		// which picks up any header lines preceding it
+		cursor->SeekToAddress(start);
+		while (true)
+		{
+			if (!cursor->Previous())
+			{
+				if (cursor->IsBeforeBegin())
+					cursor->SeekToBegin();
+				break;
+			}
+			vector<LinearDisassemblyLine> lines = cursor->GetLines();
+			if (!lines.empty() && (GetLineChunkKey(lines[0]) < start))
+			{
+				cursor->Next();
+				break;
+			}
+		}
+	}
+
+	while (!cursor->IsAfterEnd())
+	{
+		vector<LinearDisassemblyLine> lines = cursor->GetLines();
+		if (!lines.empty())
+		{
+			if (GetLineChunkKey(lines[0]) >= end)
+				break;
+			for (auto& line : lines)
+				FormatLine(line, m_exportSettings.includeAddresses, output);
+		}
+		if (!cursor->Next())
+			break;
+	}
+}
+
+
+bool LinearViewExporter::Export(const function<bool(const string& text)>& sink, const function<bool(size_t, size_t)>& progress)
+{
+	size_t threadCount = m_exportSettings.threadCount;
+	if (threadCount == 0)
+		threadCount = GetWorkerThreadCount();
+	if (threadCount == 0)
+		threadCount = 1;
+
+	vector<uint64_t> boundaries = GetChunkBoundaries(threadCount * max<size_t>(m_exportSettings.chunksPerThread, 1));
+	size_t count = boundaries.size() + 1;
+
+	struct RenderedChunk
+	{
+		bool ready = false;
+		string text;
+	};
+
+	vector<RenderedChunk> chunks(count);
+	mutex chunkMutex;
+	condition_variable chunkCond;
+	size_t nextToWrite = 0;
+	bool cancelled = false;
+	exception_ptr error;
+
+	auto renderOne = [&](size_t i) {
+		{
+			// Don't run too far ahead of the writer, completed chunks are held in memory until written
+			unique_lock<mutex> lock(chunkMutex);
+			chunkCond.wait(lock, [&]() { return cancelled || (i < nextToWrite + (threadCount * 2)); });
+			if (cancelled)
+				return;
+		}
+
+		uint64_t start = (i == 0) ? 0 : boundaries[i - 1];
+		uint64_t end = (i < boundaries.size()) ? boundaries[i] : UINT64_MAX;
+		string text;
+		try
+		{
+			RenderChunk(start, end, i == 0, text);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(chunkMutex);
+			if (!error)
+				error = current_exception();
+			cancelled = true;
+			chunkCond.notify_all();
+			return;
+		}
+
+		unique_lock<mutex> lock(chunkMutex);
+		chunks[i].text = std::move(text);
+		chunks[i].ready = true;
+		chunkCond.notify_all();
+	};
+
+	thread renderThread([&]() { ParallelFor(count, renderOne, threadCount); });
+
+	bool completed = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		string text;
+		{
+			unique_lock<mutex> lock(chunkMutex);
+			chunkCond.wait(lock, [&]() { return chunks[i].ready || cancelled; });
+			if (!chunks[i].ready)
+			{
+				completed = false;
+				break;
+			}
+			text = std::move(chunks[i].text);
+		}
+
+		// A throwing callback cancels the renderers like a false return, and is rethrown once they have stopped
+		bool keepGoing;
+		try
+		{
+			keepGoing = sink(text);
+			if (keepGoing && progress)
+				keepGoing = progress(i + 1, count);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(chunkMutex);
+			if (!error)
+				error = current_exception();
+			keepGoing = false;
+		}
+
+		unique_lock<mutex> lock(chunkMutex);
+		nextToWrite = i + 1;
+		if (!keepGoing)
+			cancelled = true;
+		chunkCond.notify_all();
+		if (!keepGoing)
+		{
+			completed = false;
+			break;
+		}
+	}
+
+	renderThread.join();
+	if (error)
+		rethrow_exception(error);
+	return completed;
+}
+
+
+bool LinearViewExporter::ExportToFile(const string& path, const function<bool(size_t, size_t)>& progress)
+{
+	// The buffer is declared first so that it outlives the file, which is closed if the export throws
+	vector<char> buffer(max<size_t>(m_exportSettings.bufferSize, BUFSIZ));
+	unique_ptr<FILE, int (*)(FILE*)> file(fopen(path.c_str(), "wb"), fclose);
+	if (!file)
+		return false;
+	FILE* fp = file.get();
+	setvbuf(fp, buffer.data(), _IOFBF, buffer.size());
+
+	bool writeFailed = false;
+	bool result = Export(
+	    [&](const string& text) {
+		    if (fwrite(text.data(), 1, text.size(), fp) != text.size())
+		    {
+			    writeFailed = true;
+			    return false;
+		    }
+		    return true;
+	    },
+	    progress);
+
+	if (fclose(file.release()) != 0)
+		writeFailed = true;
+	return result && !writeFailed;
+}
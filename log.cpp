@@ -19,14 +19,23 @@
 // IN THE SOFTWARE.
 
 #define _CRT_SECURE_NO_WARNINGS
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <thread>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
 using namespace std;
 
+
+static atomic<int> g_minimumLogLevel {DebugLog};
+// Bumped whenever log levels may have changed, invalidating the levels cached by Logger objects
+static atomic<uint64_t> g_logLevelGeneration {1};
+
 void LogListener::LogMessageCallback(void* ctxt, size_t session, BNLogLevel level, const char* msg, const char* logger_name, size_t tid)
 {
 	LogListener* listener = (LogListener*)ctxt;
@@ -72,36 +81,533 @@ void LogListener::UnregisterLogListener(LogListener* listener)
 void LogListener::UpdateLogListeners()
 {
 	BNUpdateLogListeners();
+	// Listener levels may have changed, so loggers should re-read their configuration
+	g_logLevelGeneration++;
 }
 
 
-static void PerformLog(size_t session, BNLogLevel level, const string& logger_name, size_t tid, const char* fmt, va_list args)
+// Logger names are interned so that queued messages can refer to them by id
+struct LoggerNameTable
 {
-#if defined(_MSC_VER)
-	int len = _vscprintf(fmt, args);
-	if (len < 0)
+	std::mutex tableMutex;
+	std::unordered_map<string, uint32_t> ids;
+	vector<unique_ptr<string>> names;
+	// Per logger minimum levels, indexed by id. -1 when the global level applies.
+	vector<int> levels;
+};
+
+
+static LoggerNameTable& GetLoggerNameTable()
+{
+	static LoggerNameTable table;
+	return table;
+}
+
+
+static uint32_t InternLoggerName(const string& name)
+{
+	LoggerNameTable& table = GetLoggerNameTable();
+	unique_lock<mutex> lock(table.tableMutex);
+	auto i = table.ids.find(name);
+	if (i != table.ids.end())
+		return i->second;
+	uint32_t id = (uint32_t)table.names.size();
+	table.names.emplace_back(new string(name));
+	table.levels.push_back(-1);
+	table.ids[name] = id;
+	return id;
+}
+
+
+// Interned names are never removed, so the returned reference stays valid
+static const string& GetInternedLoggerName(uint32_t id)
+{
+	LoggerNameTable& table = GetLoggerNameTable();
+	unique_lock<mutex> lock(table.tableMutex);
+	return *table.names[id];
+}
+
+
+static uint32_t GetGlobalLoggerId()
+{
+	static uint32_t id = InternLoggerName("");
+	return id;
+}
+
+
+static bool IsGlobalLogLevelEnabled(BNLogLevel level)
+{
+	return (int)level >= g_minimumLogLevel.load(memory_order_relaxed);
+}
+
+
+// Each logging thread owns a single producer, single consumer ring of variable length records. The producer is
+// lock free; consumers (the background thread, or the producer itself when it needs to deliver synchronously) hold
+// consumerMutex.
+struct LogRecordHeader
+{
+	uint32_t size;
+	uint32_t loggerId;
+	uint64_t session;
+	uint64_t tid;
+	uint64_t timestamp;
+	int32_t level;
+	uint32_t messageLength;
+	uint32_t flags;
+	uint32_t reserved;
+};
+
+
+static const uint32_t g_logRecordWrapMarker = 0xffffffff;
+// The record was received from the core by the sink listener, so it must not be sent back to the core
+static const uint32_t g_logRecordFromCore = 1;
+// Records are handed to sinks in batches of at most this many
+static const size_t g_maxLogSinkBatch = 4096;
+
+
+static atomic<bool> g_logSinksActive {false};
+// Set while this thread is calling into the core or into sinks. Messages the core reports back to the sink listener
+// during BNLogString were already delivered to sinks, and messages logged by a sink itself are not fed back into it.
+static thread_local bool t_deliveringToCore = false;
+static thread_local bool t_deliveringToSinks = false;
+
+
+static uint64_t GetLogTimestamp()
+{
+	return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::system_clock::now().time_since_epoch()).count();
+}
+
+
+static void DeliverToSinks(const vector<LogRecord>& records);
+
+
+static void DeliverToCore(size_t session, BNLogLevel level, const char* loggerName, size_t tid, const char* msg)
+{
+	t_deliveringToCore = true;
+	BNLogString(session, level, loggerName, tid, msg);
+	t_deliveringToCore = false;
+}
+
+
+struct LogRing;
+
+
+// The ring this thread is draining, if any. A listener or sink that logs while its messages are being delivered
+// must not wait for the consumerMutex its own thread holds.
+static thread_local LogRing* t_drainingRing = nullptr;
+
+
+struct LogRing
+{
+	vector<uint8_t> data;
+	size_t mask;
+	atomic<size_t> head;
+	atomic<size_t> tail;
+	mutex consumerMutex;
+	atomic<bool> ownerExited;
+	// Guarded by consumerMutex
+	vector<LogRecord> sinkBatch;
+
+	LogRing(size_t size) : data(size), mask(size - 1), head(0), tail(0), ownerExited(false) {}
+
+	bool Push(size_t session, BNLogLevel level, uint32_t loggerId, size_t tid, uint64_t timestamp, const char* msg,
+		size_t len, uint32_t flags)
+	{
+		size_t capacity = data.size();
+		size_t needed = (sizeof(LogRecordHeader) + len + 1 + 7) & ~(size_t)7;
+		if (needed > (capacity / 2))
+			return false;
+
+		size_t curHead = head.load(memory_order_relaxed);
+		size_t curTail = tail.load(memory_order_acquire);
+		size_t pos = curHead & mask;
+		size_t toEnd = capacity - pos;
+		size_t skip = (toEnd < needed) ? toEnd : 0;
+		if ((curHead + skip + needed - curTail) > capacity)
+			return false;
+
+		if (skip >= sizeof(LogRecordHeader))
+		{
+			LogRecordHeader marker = {};
+			marker.loggerId = g_logRecordWrapMarker;
+			memcpy(&data[pos], &marker, sizeof(marker));
+		}
+		pos = (curHead + skip) & mask;
+
+		LogRecordHeader header;
+		header.size = (uint32_t)needed;
+		header.loggerId = loggerId;
+		header.session = session;
+		header.tid = tid;
+		header.timestamp = timestamp;
+		header.level = level;
+		header.messageLength = (uint32_t)len;
+		header.flags = flags;
+		header.reserved = 0;
+		memcpy(&data[pos], &header, sizeof(header));
+		memcpy(&data[pos + sizeof(header)], msg, len);
+		data[pos + sizeof(header) + len] = 0;
+		head.store(curHead + skip + needed, memory_order_release);
+		return true;
+	}
+
+	// Caller must hold consumerMutex
+	size_t Drain()
+	{
+		size_t capacity = data.size();
+		size_t curTail = tail.load(memory_order_relaxed);
+		size_t curHead = head.load(memory_order_acquire);
+		size_t count = 0;
+		// Sink records point into the ring, so the tail is only published once they have been delivered
+		bool sinks = g_logSinksActive.load(memory_order_acquire);
+		LogRing* outerRing = t_drainingRing;
+		t_drainingRing = this;
+		vector<LogRecord>& batch = sinkBatch;
+		batch.clear();
+		while (curTail != curHead)
+		{
+			size_t pos = curTail & mask;
+			size_t toEnd = capacity - pos;
+			if (toEnd < sizeof(LogRecordHeader))
+			{
+				curTail += toEnd;
+				continue;
+			}
+			LogRecordHeader header;
+			memcpy(&header, &data[pos], sizeof(header));
+			if (header.loggerId == g_logRecordWrapMarker)
+			{
+				curTail += toEnd;
+				continue;
+			}
+			const char* msg = (const char*)&data[pos + sizeof(header)];
+			if (!(header.flags & g_logRecordFromCore))
+			{
+				DeliverToCore(header.session, (BNLogLevel)header.level,
+					GetInternedLoggerName(header.loggerId).c_str(), header.tid, msg);
+			}
+			if (sinks)
+			{
+				batch.push_back({header.timestamp, (size_t)header.session, (BNLogLevel)header.level, header.loggerId,
+					(size_t)header.tid, string_view(msg, header.messageLength)});
+				if (batch.size() >= g_maxLogSinkBatch)
+				{
+					DeliverToSinks(batch);
+					batch.clear();
+				}
+			}
+			curTail += header.size;
+			count++;
+		}
+		DeliverToSinks(batch);
+		batch.clear();
+		tail.store(curTail, memory_order_release);
+		t_drainingRing = outerRing;
+		return count;
+	}
+};
+
+
+struct AsyncLogState
+{
+	mutex stateMutex;
+	condition_variable wake;
+	vector<shared_ptr<LogRing>> rings;
+	thread worker;
+	bool running = false;
+	size_t bufferSize = 0;
+	// Bumped on every enable so that threads replace rings created for a previous configuration
+	atomic<uint64_t> generation {0};
+};
+
+
+static AsyncLogState& GetAsyncLogState()
+{
+	static AsyncLogState* state = new AsyncLogState;
+	return *state;
+}
+
+
+static atomic<bool> g_asyncLogging {false};
+
+
+struct ThreadLogRing
+{
+	shared_ptr<LogRing> ring;
+	uint64_t generation = 0;
+
+	~ThreadLogRing()
+	{
+		if (ring)
+			ring->ownerExited = true;
+	}
+};
+
+
+static thread_local ThreadLogRing t_logRing;
+
+
+static LogRing* GetThreadLogRing()
+{
+	AsyncLogState& state = GetAsyncLogState();
+	uint64_t generation = state.generation.load(memory_order_acquire);
+	if (t_logRing.ring && (t_logRing.generation == generation))
+		return t_logRing.ring.get();
+
+	unique_lock<mutex> lock(state.stateMutex);
+	if (!state.running)
+		return nullptr;
+	if (t_logRing.ring)
+		t_logRing.ring->ownerExited = true;
+	size_t size = 4096;
+	while (size < state.bufferSize)
+		size <<= 1;
+	t_logRing.ring = make_shared<LogRing>(size);
+	t_logRing.generation = generation;
+	state.rings.push_back(t_logRing.ring);
+	return t_logRing.ring.get();
+}
+
+
+static size_t DrainLogRings()
+{
+	AsyncLogState& state = GetAsyncLogState();
+	vector<shared_ptr<LogRing>> rings;
+	{
+		unique_lock<mutex> lock(state.stateMutex);
+		rings = state.rings;
+	}
+
+	size_t count = 0;
+	for (auto& ring : rings)
+	{
+		unique_lock<mutex> lock(ring->consumerMutex);
+		count += ring->Drain();
+	}
+
+	// Forget rings whose threads have exited once they are empty
+	unique_lock<mutex> lock(state.stateMutex);
+	state.rings.erase(remove_if(state.rings.begin(), state.rings.end(),
+		[](const shared_ptr<LogRing>& ring) {
+			return ring->ownerExited && (ring->tail.load() == ring->head.load());
+		}), state.rings.end());
+	return count;
+}
+
+
+static void AsyncLogWorker()
+{
+	AsyncLogState& state = GetAsyncLogState();
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock(state.stateMutex);
+			if (!state.running)
+				break;
+			state.wake.wait_for(lock, chrono::milliseconds(10));
+		}
+		DrainLogRings();
+	}
+	DrainLogRings();
+}
+
+
+static void DeliverLogNow(size_t session, BNLogLevel level, uint32_t loggerId, const char* loggerName, size_t tid,
+	uint64_t timestamp, const char* msg, size_t len, uint32_t flags)
+{
+	if (!(flags & g_logRecordFromCore))
+		DeliverToCore(session, level, loggerName, tid, msg);
+	if (g_logSinksActive.load(memory_order_acquire))
+	{
+		// A local batch, as this can run from a listener while a ring's batch is being delivered
+		vector<LogRecord> batch = {{timestamp, session, level, loggerId, tid, string_view(msg, len)}};
+		DeliverToSinks(batch);
+	}
+}
+
+
+// msg must be NUL terminated at msg[len]
+static void DeliverLog(size_t session, BNLogLevel level, uint32_t loggerId, const char* loggerName, size_t tid,
+	const char* msg, size_t len, uint32_t flags = 0)
+{
+	if (t_deliveringToSinks)
+	{
+		// Logged from inside a sink; only the core gets these
+		if (!(flags & g_logRecordFromCore))
+			DeliverToCore(session, level, loggerName, tid, msg);
+		return;
+	}
+
+	uint64_t timestamp = g_logSinksActive.load(memory_order_relaxed) ? GetLogTimestamp() : 0;
+	if (g_asyncLogging.load(memory_order_relaxed))
+	{
+		LogRing* ring = GetThreadLogRing();
+		if (ring)
+		{
+			if ((level < ErrorLog) && ring->Push(session, level, loggerId, tid, timestamp, msg, len, flags))
+				return;
+
+			// Errors, alerts and messages that do not fit are delivered now, after this thread's queued messages.
+			// The lock is released before delivering, so a listener that logs an error does not deadlock. When this
+			// thread is already draining the ring, the queued messages are left to that drain.
+			if (ring != t_drainingRing)
+			{
+				unique_lock<mutex> lock(ring->consumerMutex);
+				ring->Drain();
+			}
+			DeliverLogNow(session, level, loggerId, loggerName, tid, timestamp, msg, len, flags);
+			return;
+		}
+	}
+	DeliverLogNow(session, level, loggerId, loggerName, tid, timestamp, msg, len, flags);
+}
+
+
+// Forwards messages logged by the core and other modules to the registered sinks
+class LogSinkListener : public LogListener
+{
+	atomic<int> m_level {DebugLog};
+
+  public:
+	void SetLevel(BNLogLevel level) { m_level = (int)level; }
+
+	virtual void LogMessage(size_t session, BNLogLevel level, const string& msg, const string& loggerName,
+		size_t tid) override
+	{
+		if (t_deliveringToCore || t_deliveringToSinks)
+			return;
+
+		// Consecutive messages from a thread usually come from the same logger, so skip the intern table lookup
+		static thread_local string lastName;
+		static thread_local uint32_t lastId = 0;
+		static thread_local bool lastValid = false;
+		if (!lastValid || (lastName != loggerName))
+		{
+			lastId = InternLoggerName(loggerName);
+			lastName = loggerName;
+			lastValid = true;
+		}
+		DeliverLog(session, level, lastId, loggerName.c_str(), tid, msg.c_str(), msg.size(), g_logRecordFromCore);
+	}
+
+	virtual BNLogLevel GetLogLevel() override { return (BNLogLevel)m_level.load(); }
+};
+
+
+struct LogSinkRegistry
+{
+	mutex sinkMutex;
+	vector<LogSink*> sinks;
+	LogSinkListener* listener = nullptr;
+};
+
+
+static LogSinkRegistry& GetLogSinkRegistry()
+{
+	static LogSinkRegistry* registry = new LogSinkRegistry;
+	return *registry;
+}
+
+
+static void DeliverToSinks(const vector<LogRecord>& records)
+{
+	if (records.empty())
 		return;
-	char* msg = (char*)malloc(len + 1);
-	if (!msg)
+	LogSinkRegistry& registry = GetLogSinkRegistry();
+	unique_lock<mutex> lock(registry.sinkMutex);
+	t_deliveringToSinks = true;
+	for (auto sink : registry.sinks)
+		sink->Deliver(records);
+	t_deliveringToSinks = false;
+}
+
+
+// Formatting happens into a per-thread buffer, so a message only allocates when it is longer than any previous one
+// from the same thread
+static thread_local fmt::memory_buffer t_formatBuffer;
+static thread_local bool t_formatBufferInUse = false;
+
+
+// Claims the per-thread format buffer for one message. A message logged while the buffer is in use, by a formatter
+// or a listener that logs, gets a buffer of its own so the outer message is left intact.
+class FormatBuffer
+{
+	fmt::memory_buffer m_local;
+	fmt::memory_buffer* m_buffer;
+	bool m_owner;
+
+  public:
+	FormatBuffer() : m_owner(!t_formatBufferInUse)
+	{
+		m_buffer = m_owner ? &t_formatBuffer : &m_local;
+		m_buffer->clear();
+		t_formatBufferInUse = true;
+	}
+
+	~FormatBuffer()
+	{
+		if (m_owner)
+			t_formatBufferInUse = false;
+	}
+
+	FormatBuffer(const FormatBuffer&) = delete;
+	FormatBuffer& operator=(const FormatBuffer&) = delete;
+
+	fmt::memory_buffer& Get() { return *m_buffer; }
+};
+
+
+static void PerformLogFV(size_t session, BNLogLevel level, uint32_t loggerId, const string& loggerName, size_t tid,
+	fmt::string_view format, fmt::format_args args)
+{
+	FormatBuffer buffer;
+	fmt::memory_buffer& out = buffer.Get();
+	fmt::vformat_to(fmt::appender(out), format, args);
+	size_t len = out.size();
+	out.push_back('\0');
+	DeliverLog(session, level, loggerId, loggerName.c_str(), tid, out.data(), len);
+}
+
+
+static void PerformLog(size_t session, BNLogLevel level, uint32_t loggerId, const string& loggerName, size_t tid,
+	const char* fmt, va_list args)
+{
+	va_list copy;
+	va_copy(copy, args);
+	int len = vsnprintf(nullptr, 0, fmt, copy);
+	va_end(copy);
+	if (len < 0)
 		return;
-	if (vsnprintf(msg, len + 1, fmt, args) >= 0)
-		BNLog(session, level, logger_name.c_str(), tid, "%s", msg);
-	free(msg);
-#else
-	char* msg;
-	if (vasprintf(&msg, fmt, args) < 0)
+	FormatBuffer buffer;
+	fmt::memory_buffer& out = buffer.Get();
+	out.resize((size_t)len + 1);
+	if (vsnprintf(out.data(), (size_t)len + 1, fmt, args) < 0)
 		return;
-	BNLog(session, level, logger_name.c_str(), tid, "%s", msg);
-	free(msg);
-#endif
+	DeliverLog(session, level, loggerId, loggerName.c_str(), tid, out.data(), (size_t)len);
+}
+
+
+static void PerformGlobalLog(BNLogLevel level, const char* fmt, va_list args)
+{
+	static const string emptyName;
+	PerformLog(0, level, GetGlobalLoggerId(), emptyName, 0, fmt, args);
+}
+
+
+static void PerformGlobalLogFV(BNLogLevel level, fmt::string_view format, fmt::format_args args)
+{
+	static const string emptyName;
+	PerformLogFV(0, level, GetGlobalLoggerId(), emptyName, 0, format, args);
 }
 
 
 void BinaryNinja::Log(BNLogLevel level, const char* fmt, ...)
 {
+	if (!IsGlobalLogLevelEnabled(level))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(0, level, "", 0, fmt, args);
+	PerformGlobalLog(level, fmt, args);
 	va_end(args);
 }
 
@@ -109,9 +615,11 @@ void BinaryNinja::Log(BNLogLevel level, const char* fmt, ...)
 void BinaryNinja::LogTrace(const char* fmt, ...)
 {
 #ifdef _DEBUG
+	if (!IsGlobalLogLevelEnabled(DebugLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(0, DebugLog, "", 0, fmt, args);
+	PerformGlobalLog(DebugLog, fmt, args);
 	va_end(args);
 #endif
 }
@@ -119,95 +627,110 @@ void BinaryNinja::LogTrace(const char* fmt, ...)
 
 void BinaryNinja::LogDebug(const char* fmt, ...)
 {
+	if (!IsGlobalLogLevelEnabled(DebugLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(0, DebugLog, "", 0, fmt, args);
+	PerformGlobalLog(DebugLog, fmt, args);
 	va_end(args);
 }
 
 
 void BinaryNinja::LogInfo(const char* fmt, ...)
 {
+	if (!IsGlobalLogLevelEnabled(InfoLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(0, InfoLog, "", 0, fmt, args);
+	PerformGlobalLog(InfoLog, fmt, args);
 	va_end(args);
 }
 
 
 void BinaryNinja::LogWarn(const char* fmt, ...)
 {
+	if (!IsGlobalLogLevelEnabled(WarningLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(0, WarningLog, "", 0, fmt, args);
+	PerformGlobalLog(WarningLog, fmt, args);
 	va_end(args);
 }
 
 
 void BinaryNinja::LogError(const char* fmt, ...)
 {
+	if (!IsGlobalLogLevelEnabled(ErrorLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(0, ErrorLog, "", 0, fmt, args);
+	PerformGlobalLog(ErrorLog, fmt, args);
 	va_end(args);
 }
 
 
 void BinaryNinja::LogAlert(const char* fmt, ...)
 {
+	if (!IsGlobalLogLevelEnabled(AlertLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(0, AlertLog, "", 0, fmt, args);
+	PerformGlobalLog(AlertLog, fmt, args);
 	va_end(args);
 }
 
 
 void BinaryNinja::LogFV(BNLogLevel level, fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	Log(level, "%s", value.c_str());
+	if (IsGlobalLogLevelEnabled(level))
+		PerformGlobalLogFV(level, format, args);
 }
 
 
 void BinaryNinja::LogTraceFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogTrace("%s", value.c_str());
+#ifdef _DEBUG
+	if (IsGlobalLogLevelEnabled(DebugLog))
+		PerformGlobalLogFV(DebugLog, format, args);
+#else
+	(void)format;
+	(void)args;
+#endif
 }
 
 
 void BinaryNinja::LogDebugFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogDebug("%s", value.c_str());
+	if (IsGlobalLogLevelEnabled(DebugLog))
+		PerformGlobalLogFV(DebugLog, format, args);
 }
 
 
 void BinaryNinja::LogInfoFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogInfo("%s", value.c_str());
+	if (IsGlobalLogLevelEnabled(InfoLog))
+		PerformGlobalLogFV(InfoLog, format, args);
 }
 
 
 void BinaryNinja::LogWarnFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogWarn("%s", value.c_str());
+	if (IsGlobalLogLevelEnabled(WarningLog))
+		PerformGlobalLogFV(WarningLog, format, args);
 }
 
 
 void BinaryNinja::LogErrorFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogError("%s", value.c_str());
+	if (IsGlobalLogLevelEnabled(ErrorLog))
+		PerformGlobalLogFV(ErrorLog, format, args);
 }
 
 
 void BinaryNinja::LogAlertFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogAlert("%s", value.c_str());
+	if (IsGlobalLogLevelEnabled(AlertLog))
+		PerformGlobalLogFV(AlertLog, format, args);
 }
 
 
@@ -234,6 +757,196 @@ void BinaryNinja::CloseLogs()
 	BNCloseLogs();
 }
 
+
+void BinaryNinja::SetMinimumLogLevel(BNLogLevel level)
+{
+	g_minimumLogLevel = (int)level;
+	g_logLevelGeneration++;
+}
+
+
+BNLogLevel BinaryNinja::GetMinimumLogLevel()
+{
+	return (BNLogLevel)g_minimumLogLevel.load();
+}
+
+
+void BinaryNinja::EnableAsyncLogging(size_t bufferSize)
+{
+	AsyncLogState& state = GetAsyncLogState();
+	unique_lock<mutex> lock(state.stateMutex);
+	if (state.running)
+		return;
+	state.bufferSize = bufferSize;
+	state.running = true;
+	state.generation++;
+	state.worker = thread(AsyncLogWorker);
+	g_asyncLogging = true;
+}
+
+
+void BinaryNinja::DisableAsyncLogging()
+{
+	AsyncLogState& state = GetAsyncLogState();
+	thread worker;
+	{
+		unique_lock<mutex> lock(state.stateMutex);
+		if (!state.running)
+			return;
+		g_asyncLogging = false;
+		state.running = false;
+		state.generation++;
+		worker = std::move(state.worker);
+	}
+	state.wake.notify_all();
+	worker.join();
+	// Messages queued by threads that raced with disabling are delivered here
+	DrainLogRings();
+}
+
+
+void BinaryNinja::FlushLogs()
+{
+	DrainLogRings();
+
+	LogSinkRegistry& registry = GetLogSinkRegistry();
+	unique_lock<mutex> lock(registry.sinkMutex);
+	t_deliveringToSinks = true;
+	for (auto sink : registry.sinks)
+		sink->Flush();
+	t_deliveringToSinks = false;
+}
+
+LogSink::LogSink() : m_minimumLevel(DebugLog) {}
+
+
+void LogSink::RegisterLogSink(LogSink* sink)
+{
+	LogSinkRegistry& registry = GetLogSinkRegistry();
+	LogSinkListener* listener;
+	bool created = false;
+	{
+		unique_lock<mutex> lock(registry.sinkMutex);
+		registry.sinks.push_back(sink);
+		if (!registry.listener)
+		{
+			registry.listener = new LogSinkListener;
+			created = true;
+		}
+		listener = registry.listener;
+
+		BNLogLevel level = AlertLog;
+		for (auto i : registry.sinks)
+			level = std::min(level, i->GetLowestLevel());
+		listener->SetLevel(level);
+		g_logSinksActive = true;
+	}
+
+	// The core may query listener levels while registering, so this happens outside the registry lock
+	if (created)
+		LogListener::RegisterLogListener(listener);
+	else
+		BNUpdateLogListeners();
+}
+
+
+void LogSink::UnregisterLogSink(LogSink* sink)
+{
+	FlushLogs();
+
+	LogSinkRegistry& registry = GetLogSinkRegistry();
+	LogSinkListener* listener = nullptr;
+	{
+		unique_lock<mutex> lock(registry.sinkMutex);
+		auto i = find(registry.sinks.begin(), registry.sinks.end(), sink);
+		if (i == registry.sinks.end())
+			return;
+		registry.sinks.erase(i);
+		t_deliveringToSinks = true;
+		sink->Flush();
+		t_deliveringToSinks = false;
+		if (registry.sinks.empty())
+		{
+			g_logSinksActive = false;
+			listener = registry.listener;
+			registry.listener = nullptr;
+		}
+	}
+
+	if (listener)
+	{
+		LogListener::UnregisterLogListener(listener);
+		delete listener;
+	}
+}
+
+
+string LogSink::GetLoggerName(uint32_t loggerId)
+{
+	return GetInternedLoggerName(loggerId);
+}
+
+
+uint32_t LogSink::GetLoggerId(const string& loggerName)
+{
+	return InternLoggerName(loggerName);
+}
+
+
+void LogSink::SetMinimumLevel(BNLogLevel level)
+{
+	m_minimumLevel = level;
+}
+
+
+void LogSink::SetLoggerLevel(const string& loggerName, BNLogLevel level)
+{
+	uint32_t id = InternLoggerName(loggerName);
+	if (id >= m_loggerLevels.size())
+		m_loggerLevels.resize(id + 1, -1);
+	m_loggerLevels[id] = (int)level;
+}
+
+
+BNLogLevel LogSink::GetLowestLevel() const
+{
+	int level = (int)m_minimumLevel;
+	for (auto i : m_loggerLevels)
+	{
+		if ((i >= 0) && (i < level))
+			level = i;
+	}
+	return (BNLogLevel)level;
+}
+
+
+bool LogSink::IsEnabled(uint32_t loggerId, BNLogLevel level) const
+{
+	if ((loggerId < m_loggerLevels.size()) && (m_loggerLevels[loggerId] >= 0))
+		return (int)level >= m_loggerLevels[loggerId];
+	return level >= m_minimumLevel;
+}
+
+
+void LogSink::Deliver(const vector<LogRecord>& records)
+{
+	if (m_loggerLevels.empty() && (m_minimumLevel == DebugLog))
+	{
+		LogBatch(records);
+		return;
+	}
+
+	m_filtered.clear();
+	for (auto& record : records)
+	{
+		if (IsEnabled(record.loggerId, record.level))
+			m_filtered.push_back(record);
+	}
+	if (!m_filtered.empty())
+		LogBatch(m_filtered);
+}
+
+
 size_t Logger::GetThreadId() const
 {
 	return std::hash<std::thread::id>{}(std::this_thread::get_id());
@@ -242,20 +955,80 @@ size_t Logger::GetThreadId() const
 Logger::Logger(BNLogger* logger)
 {
 	m_object = logger;
+	Init();
 }
 
 
 Logger::Logger(const string& loggerName, size_t sessionId)
 {
 	m_object = BNLogCreateLogger(loggerName.c_str(), sessionId);
+	Init();
+}
+
+
+void Logger::Init()
+{
+	m_levelCache = 0;
+	if (!m_object)
+	{
+		m_sessionId = 0;
+		m_loggerId = GetGlobalLoggerId();
+		return;
+	}
+
+	// The name and session of a logger never change, so they are read once instead of for every message
+	char* name = BNLoggerGetName(m_object);
+	m_name = name;
+	BNFreeString(name);
+	m_sessionId = BNLoggerGetSessionId(m_object);
+	m_loggerId = InternLoggerName(m_name);
+}
+
+
+BNLogLevel Logger::GetMinimumLevel()
+{
+	uint64_t generation = g_logLevelGeneration.load(memory_order_relaxed);
+	uint64_t cache = m_levelCache.load(memory_order_relaxed);
+	if ((cache >> 8) == generation)
+		return (BNLogLevel)(cache & 0xff);
+
+	int level;
+	{
+		LoggerNameTable& table = GetLoggerNameTable();
+		unique_lock<mutex> lock(table.tableMutex);
+		level = table.levels[m_loggerId];
+	}
+	if (level < 0)
+		level = g_minimumLogLevel.load(memory_order_relaxed);
+	m_levelCache.store((generation << 8) | (uint64_t)level, memory_order_relaxed);
+	return (BNLogLevel)level;
+}
+
+
+void Logger::SetMinimumLevel(BNLogLevel level)
+{
+	{
+		LoggerNameTable& table = GetLoggerNameTable();
+		unique_lock<mutex> lock(table.tableMutex);
+		table.levels[m_loggerId] = (int)level;
+	}
+	g_logLevelGeneration++;
+}
+
+
+bool Logger::IsEnabled(BNLogLevel level)
+{
+	return level >= GetMinimumLevel();
 }
 
 
 void Logger::Log(BNLogLevel level, const char* fmt, ...)
 {
+	if (!IsEnabled(level))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), level, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, level, m_loggerId, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
@@ -263,9 +1036,11 @@ void Logger::Log(BNLogLevel level, const char* fmt, ...)
 void Logger::LogTrace(const char* fmt, ...)
 {
 #ifdef _DEBUG
+	if (!IsEnabled(DebugLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), DebugLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, DebugLog, m_loggerId, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 #endif
 }
@@ -273,110 +1048,122 @@ void Logger::LogTrace(const char* fmt, ...)
 
 void Logger::LogDebug(const char* fmt, ...)
 {
+	if (!IsEnabled(DebugLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), DebugLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, DebugLog, m_loggerId, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
 
 void Logger::LogInfo(const char* fmt, ...)
 {
+	if (!IsEnabled(InfoLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), InfoLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, InfoLog, m_loggerId, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
 
 void Logger::LogWarn(const char* fmt, ...)
 {
+	if (!IsEnabled(WarningLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), WarningLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, WarningLog, m_loggerId, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
 
 void Logger::LogError(const char* fmt, ...)
 {
+	if (!IsEnabled(ErrorLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), ErrorLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, ErrorLog, m_loggerId, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
 
 void Logger::LogAlert(const char* fmt, ...)
 {
+	if (!IsEnabled(AlertLog))
+		return;
 	va_list args;
 	va_start(args, fmt);
-	PerformLog(GetSessionId(), AlertLog, GetName(), GetThreadId(), fmt, args);
+	PerformLog(m_sessionId, AlertLog, m_loggerId, m_name, GetThreadId(), fmt, args);
 	va_end(args);
 }
 
 
 void Logger::LogFV(BNLogLevel level, fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	Log(level, "%s", value.c_str());
+	if (IsEnabled(level))
+		PerformLogFV(m_sessionId, level, m_loggerId, m_name, GetThreadId(), format, args);
 }
 
 
 void Logger::LogTraceFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogTrace("%s", value.c_str());
+#ifdef _DEBUG
+	if (IsEnabled(DebugLog))
+		PerformLogFV(m_sessionId, DebugLog, m_loggerId, m_name, GetThreadId(), format, args);
+#else
+	(void)format;
+	(void)args;
+#endif
 }
 
 
 void Logger::LogDebugFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogDebug("%s", value.c_str());
+	if (IsEnabled(DebugLog))
+		PerformLogFV(m_sessionId, DebugLog, m_loggerId, m_name, GetThreadId(), format, args);
 }
 
 
 void Logger::LogInfoFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogInfo("%s", value.c_str());
+	if (IsEnabled(InfoLog))
+		PerformLogFV(m_sessionId, InfoLog, m_loggerId, m_name, GetThreadId(), format, args);
 }
 
 
 void Logger::LogWarnFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogWarn("%s", value.c_str());
+	if (IsEnabled(WarningLog))
+		PerformLogFV(m_sessionId, WarningLog, m_loggerId, m_name, GetThreadId(), format, args);
 }
 
 
 void Logger::LogErrorFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogError("%s", value.c_str());
+	if (IsEnabled(ErrorLog))
+		PerformLogFV(m_sessionId, ErrorLog, m_loggerId, m_name, GetThreadId(), format, args);
 }
 
 
 void Logger::LogAlertFV(fmt::string_view format, fmt::format_args args)
 {
-	std::string value = fmt::vformat(format, args);
-	LogAlert("%s", value.c_str());
+	if (IsEnabled(AlertLog))
+		PerformLogFV(m_sessionId, AlertLog, m_loggerId, m_name, GetThreadId(), format, args);
 }
 
 
 string Logger::GetName()
 {
-	char* name = BNLoggerGetName(m_object);
-	string result = name;
-	BNFreeString(name);
-	return result;
+	return m_name;
 }
 
 
 size_t Logger::GetSessionId()
 {
-	return BNLoggerGetSessionId(m_object);
+	return m_sessionId;
 }
 
 
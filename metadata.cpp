@@ -1,3 +1,4 @@
+#include <cstring>
 #include "binaryninjaapi.h"
 
 using namespace std;
@@ -40,12 +41,7 @@ Metadata::Metadata(MetadataType type)
 
 Metadata::Metadata(const vector<uint8_t>& data)
 {
-	auto input = new uint8_t[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		input[i] = data[i];
-
-	m_object = BNCreateMetadataRawData(input, data.size());
-	delete[] input;
+	m_object = BNCreateMetadataRawData(data.data(), data.size());
 }
 
 Metadata::Metadata(const std::vector<Ref<Metadata>>& data)
@@ -88,32 +84,18 @@ Metadata::Metadata(const std::vector<bool>& data)
 
 Metadata::Metadata(const std::vector<uint64_t>& data)
 {
-	auto* list = new uint64_t[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		list[i] = data[i];
-
-	m_object = BNCreateMetadataUnsignedIntegerListData(list, data.size());
-	delete[] list;
+	// The core copies the list and does not modify it
+	m_object = BNCreateMetadataUnsignedIntegerListData(const_cast<uint64_t*>(data.data()), data.size());
 }
 
 Metadata::Metadata(const std::vector<int64_t>& data)
 {
-	auto* list = new int64_t[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		list[i] = data[i];
-
-	m_object = BNCreateMetadataSignedIntegerListData(list, data.size());
-	delete[] list;
+	m_object = BNCreateMetadataSignedIntegerListData(const_cast<int64_t*>(data.data()), data.size());
 }
 
 Metadata::Metadata(const std::vector<double>& data)
 {
-	auto* list = new double[data.size()];
-	for (size_t i = 0; i < data.size(); i++)
-		list[i] = data[i];
-
-	m_object = BNCreateMetadataDoubleListData(list, data.size());
-	delete[] list;
+	m_object = BNCreateMetadataDoubleListData(const_cast<double*>(data.data()), data.size());
 }
 
 Metadata::Metadata(const std::vector<std::string>& data)
@@ -227,14 +209,7 @@ std::vector<uint64_t> Metadata::GetUnsignedIntegerList() const
 {
 	size_t size;
 	auto list = BNMetadataGetUnsignedIntegerList(m_object, &size);
-
-	std::vector<uint64_t> result;
-	result.reserve(size);
-
-	for (size_t i = 0; i < size; i++)
-	{
-		result.push_back(list[i]);
-	}
+	std::vector<uint64_t> result(list, list + size);
 
 	BNFreeMetadataUnsignedIntegerList(list, size);
 	return result;
@@ -244,14 +219,7 @@ std::vector<int64_t> Metadata::GetSignedIntegerList() const
 {
 	size_t size;
 	auto list = BNMetadataGetSignedIntegerList(m_object, &size);
-
-	std::vector<int64_t> result;
-	result.reserve(size);
-
-	for (size_t i = 0; i < size; i++)
-	{
-		result.push_back(list[i]);
-	}
+	std::vector<int64_t> result(list, list + size);
 
 	BNFreeMetadataSignedIntegerList(list, size);
 	return result;
@@ -278,14 +246,7 @@ std::vector<double> Metadata::GetDoubleList() const
 {
 	size_t size;
 	auto list = BNMetadataGetDoubleList(m_object, &size);
-
-	std::vector<double> result;
-	result.reserve(size);
-
-	for (size_t i = 0; i < size; i++)
-	{
-		result.push_back(list[i]);
-	}
+	std::vector<double> result(list, list + size);
 
 	BNFreeMetadataDoubleList(list, size);
 	return result;
@@ -402,3 +363,156 @@ bool Metadata::IsKeyValueStore() const
 {
 	return BNMetadataIsKeyValueStore(m_object);
 }
+
+
+// Typed arrays are raw data beginning with this header. The elements follow in the byte order of the host that
+// wrote them, which is recorded in the flags.
+struct MetadataArrayHeader
+{
+	char magic[4];
+	uint8_t version;
+	uint8_t elementType;
+	uint8_t flags;
+	uint8_t reserved;
+	uint64_t count;
+};
+
+static_assert(sizeof(MetadataArrayHeader) == Metadata::ArrayHeaderSize, "Typed array header size changed");
+
+static const char g_metadataArrayMagic[4] = {'B', 'N', 'T', 'A'};
+static const uint8_t g_metadataArrayVersion = 1;
+static const uint8_t g_metadataArrayBigEndian = 1;
+
+
+static size_t GetMetadataArrayElementSize(MetadataArrayElementType type)
+{
+	switch (type)
+	{
+	case UInt8MetadataArray:
+		return 1;
+	case UInt32MetadataArray:
+	case FloatMetadataArray:
+		return 4;
+	case UInt64MetadataArray:
+	case Int64MetadataArray:
+	case DoubleMetadataArray:
+		return 8;
+	default:
+		return 0;
+	}
+}
+
+
+static bool IsBigEndianHost()
+{
+	uint16_t value = 1;
+	uint8_t first;
+	memcpy(&first, &value, 1);
+	return first == 0;
+}
+
+
+static uint64_t SwapMetadataArrayCount(uint64_t count)
+{
+	uint64_t result = 0;
+	for (size_t i = 0; i < 8; i++)
+		result |= ((count >> (i * 8)) & 0xff) << ((7 - i) * 8);
+	return result;
+}
+
+
+// Validates the header of a raw buffer, returning the element type and count in host order
+static bool ParseMetadataArrayHeader(
+	const uint8_t* raw, size_t size, MetadataArrayElementType& type, uint64_t& count, bool& byteSwapped)
+{
+	if (!raw || (size < sizeof(MetadataArrayHeader)))
+		return false;
+	MetadataArrayHeader header;
+	memcpy(&header, raw, sizeof(header));
+	if ((memcmp(header.magic, g_metadataArrayMagic, 4) != 0) || (header.version != g_metadataArrayVersion))
+		return false;
+
+	type = (MetadataArrayElementType)header.elementType;
+	size_t elementSize = GetMetadataArrayElementSize(type);
+	if (elementSize == 0)
+		return false;
+	byteSwapped = ((header.flags & g_metadataArrayBigEndian) != 0) != IsBigEndianHost();
+	count = byteSwapped ? SwapMetadataArrayCount(header.count) : header.count;
+	return count == ((size - sizeof(header)) / elementSize) && ((size - sizeof(header)) % elementSize) == 0;
+}
+
+
+Ref<Metadata> Metadata::CreateArrayFromBuffer(MetadataArrayElementType type, vector<uint8_t>& buffer)
+{
+	size_t elementSize = GetMetadataArrayElementSize(type);
+	if ((elementSize == 0) || (buffer.size() < sizeof(MetadataArrayHeader)))
+		return nullptr;
+
+	MetadataArrayHeader header;
+	memcpy(header.magic, g_metadataArrayMagic, 4);
+	header.version = g_metadataArrayVersion;
+	header.elementType = (uint8_t)type;
+	header.flags = IsBigEndianHost() ? g_metadataArrayBigEndian : 0;
+	header.reserved = 0;
+	header.count = (buffer.size() - sizeof(header)) / elementSize;
+	memcpy(buffer.data(), &header, sizeof(header));
+	return new Metadata(BNCreateMetadataRawData(buffer.data(), buffer.size()));
+}
+
+
+Ref<Metadata> Metadata::CreateArray(MetadataArrayElementType type, const void* data, size_t count)
+{
+	size_t elementSize = GetMetadataArrayElementSize(type);
+	if (elementSize == 0)
+		return nullptr;
+	vector<uint8_t> buffer(sizeof(MetadataArrayHeader) + (count * elementSize));
+	if (count != 0)
+		memcpy(&buffer[sizeof(MetadataArrayHeader)], data, count * elementSize);
+	return CreateArrayFromBuffer(type, buffer);
+}
+
+
+uint8_t* Metadata::GetArrayData(
+	MetadataArrayElementType type, const uint8_t*& payload, size_t& count, bool& byteSwapped) const
+{
+	if (!IsRaw())
+		return nullptr;
+
+	size_t size = 0;
+	uint8_t* raw = BNMetadataGetRaw(m_object, &size);
+	MetadataArrayElementType actualType;
+	uint64_t actualCount;
+	if (!ParseMetadataArrayHeader(raw, size, actualType, actualCount, byteSwapped) || (actualType != type))
+	{
+		BNFreeMetadataRaw(raw);
+		return nullptr;
+	}
+
+	payload = raw + sizeof(MetadataArrayHeader);
+	count = (size_t)actualCount;
+	return raw;
+}
+
+
+optional<MetadataArrayElementType> Metadata::GetArrayElementType() const
+{
+	if (!IsRaw())
+		return nullopt;
+
+	size_t size = 0;
+	uint8_t* raw = BNMetadataGetRaw(m_object, &size);
+	MetadataArrayElementType type;
+	uint64_t count;
+	bool byteSwapped;
+	bool valid = ParseMetadataArrayHeader(raw, size, type, count, byteSwapped);
+	BNFreeMetadataRaw(raw);
+	if (!valid)
+		return nullopt;
+	return type;
+}
+
+
+bool Metadata::IsTypedArray() const
+{
+	return GetArrayElementType().has_value();
+}
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+#
+# Generates apiprofileshim.h from binaryninjacore.h. The generated header is only used when the API is built with
+# BN_API_PROFILE, where it redirects every call to a core function through BinaryNinja::ApiProfile::Instrument so that
+# the call can be counted and timed.
+#
+# Run this again whenever binaryninjacore.h changes:
+#     python3 scripts/generate_api_profile.py
+
+import os
+import re
+import sys
+
+api_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+core_header = os.path.join(api_dir, "binaryninjacore.h")
+shim_header = os.path.join(api_dir, "apiprofileshim.h")
+
+declaration_re = re.compile(r"BINARYNINJACOREAPI\s+[^;]*?\b(BN[A-Za-z0-9_]+)\s*\(([^;]*)\)\s*;", re.S)
+
+
+def main():
+    with open(core_header) as f:
+        source = f.read()
+
+    entries = []
+    for match in declaration_re.finditer(source):
+        name, params = match.group(1), match.group(2)
+        if "..." in params:
+            # Variadic functions can't be forwarded through a template, leave them unprofiled
+            continue
+        entries.append(name)
+
+    lines = [
+        "// Generated by scripts/generate_api_profile.py from binaryninjacore.h, do not edit.",
+        "// Only included by apiprofile.h when BN_API_PROFILE is defined.",
+        "#pragma once",
+        "",
+        "namespace BinaryNinja",
+        "{",
+        "\tnamespace ApiProfile",
+        "\t{",
+        f"\t\tconstexpr size_t EntryCount = {len(entries)};",
+        "\t\tinline const char* const EntryNames[EntryCount] = {",
+    ]
+    for name in entries:
+        lines.append(f"\t\t\t\"{name}\",")
+    lines += [
+        "\t\t};",
+        "\t}  // namespace ApiProfile",
+        "}  // namespace BinaryNinja",
+        "",
+    ]
+    for index, name in enumerate(entries):
+        lines.append(f"#define {name}(...) ::BinaryNinja::ApiProfile::Instrument<{index}>(::{name})(__VA_ARGS__)")
+    lines.append("")
+
+    with open(shim_header, "w") as f:
+        f.write("\n".join(lines))
+    print(f"Wrote {len(entries)} entries to {shim_header}")
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -29,13 +29,16 @@ Ref<Settings> Settings::Instance(const std::string& instanceId)
 
 bool Settings::LoadSettingsFile(const string& fileName, BNSettingsScope scope, Ref<BinaryView> view)
 {
-	return BNLoadSettingsFile(m_object, fileName.c_str(), scope, view ? view->GetObject() : nullptr);
+	bool result = BNLoadSettingsFile(m_object, fileName.c_str(), scope, view ? view->GetObject() : nullptr);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 void Settings::SetResourceId(const string& resourceId)
 {
-	return BNSettingsSetResourceId(m_object, resourceId.c_str());
+	BNSettingsSetResourceId(m_object, resourceId.c_str());
+	InvalidateCachedSettings();
 }
 
 
@@ -47,7 +50,9 @@ bool Settings::RegisterGroup(const string& group, const string& title)
 
 bool Settings::RegisterSetting(const string& key, const string& properties)
 {
-	return BNSettingsRegisterSetting(m_object, key.c_str(), properties.c_str());
+	bool result = BNSettingsRegisterSetting(m_object, key.c_str(), properties.c_str());
+	InvalidateCachedSettings();
+	return result;
 }
 
 
@@ -96,49 +101,65 @@ vector<string> Settings::QueryProperty<vector<string>>(const string& key, const
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property)
 {
-	return BNSettingsUpdateProperty(m_object, key.c_str(), property.c_str());
+	bool result = BNSettingsUpdateProperty(m_object, key.c_str(), property.c_str());
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property, bool value)
 {
-	return BNSettingsUpdateBoolProperty(m_object, key.c_str(), property.c_str(), value);
+	bool result = BNSettingsUpdateBoolProperty(m_object, key.c_str(), property.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property, double value)
 {
-	return BNSettingsUpdateDoubleProperty(m_object, key.c_str(), property.c_str(), value);
+	bool result = BNSettingsUpdateDoubleProperty(m_object, key.c_str(), property.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property, int value)
 {
-	return BNSettingsUpdateInt64Property(m_object, key.c_str(), property.c_str(), value);
+	bool result = BNSettingsUpdateInt64Property(m_object, key.c_str(), property.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property, int64_t value)
 {
-	return BNSettingsUpdateInt64Property(m_object, key.c_str(), property.c_str(), value);
+	bool result = BNSettingsUpdateInt64Property(m_object, key.c_str(), property.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property, uint64_t value)
 {
-	return BNSettingsUpdateUInt64Property(m_object, key.c_str(), property.c_str(), value);
+	bool result = BNSettingsUpdateUInt64Property(m_object, key.c_str(), property.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property, const char* value)
 {
-	return BNSettingsUpdateStringProperty(m_object, key.c_str(), property.c_str(), value);
+	bool result = BNSettingsUpdateStringProperty(m_object, key.c_str(), property.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::UpdateProperty(const std::string& key, const std::string& property, const std::string& value)
 {
-	return BNSettingsUpdateStringProperty(m_object, key.c_str(), property.c_str(), value.c_str());
+	bool result = BNSettingsUpdateStringProperty(m_object, key.c_str(), property.c_str(), value.c_str());
+	InvalidateCachedSettings();
+	return result;
 }
 
 
@@ -158,13 +179,16 @@ bool Settings::UpdateProperty(
 	for (size_t i = 0; i < value.size(); i++)
 		BNFreeString(buffer[i]);
 	delete[] buffer;
+	InvalidateCachedSettings();
 	return result;
 }
 
 
 bool Settings::DeserializeSchema(const string& schema, BNSettingsScope scope, bool merge)
 {
-	return BNSettingsDeserializeSchema(m_object, schema.c_str(), scope, merge);
+	bool result = BNSettingsDeserializeSchema(m_object, schema.c_str(), scope, merge);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
@@ -179,7 +203,9 @@ string Settings::SerializeSchema()
 
 bool Settings::DeserializeSettings(const string& contents, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNDeserializeSettings(m_object, contents.c_str(), view ? view->GetObject() : nullptr, scope);
+	bool result = BNDeserializeSettings(m_object, contents.c_str(), view ? view->GetObject() : nullptr, scope);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
@@ -194,13 +220,17 @@ string Settings::SerializeSettings(Ref<BinaryView> view, BNSettingsScope scope)
 
 bool Settings::Reset(const string& key, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsReset(m_object, key.c_str(), view ? view->GetObject() : nullptr, scope);
+	bool result = BNSettingsReset(m_object, key.c_str(), view ? view->GetObject() : nullptr, scope);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::ResetAll(Ref<BinaryView> view, BNSettingsScope scope, bool schemaOnly)
 {
-	return BNSettingsResetAll(m_object, view ? view->GetObject() : nullptr, scope, schemaOnly);
+	bool result = BNSettingsResetAll(m_object, view ? view->GetObject() : nullptr, scope, schemaOnly);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
@@ -259,6 +289,39 @@ vector<string> Settings::Get<vector<string>>(const string& key, Ref<BinaryView>
 }
 
 
+Json::Value Settings::GetMany(const vector<string>& keys, Ref<BinaryView> view, BNSettingsScope scope)
+{
+	BNBinaryView* viewObject = view ? view->GetObject() : nullptr;
+	unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+	Json::Value result(Json::objectValue);
+	for (auto& key : keys)
+	{
+		BNSettingsScope keyScope = scope;
+		char* json = BNSettingsGetJson(m_object, key.c_str(), viewObject, &keyScope);
+		Json::Value value;
+		string errors;
+		if (!reader->parse(json, json + strlen(json), &value, &errors))
+			value = Json::Value();
+		BNFreeString(json);
+		result[key] = std::move(value);
+	}
+	return result;
+}
+
+
+Json::Value Settings::GetGroup(const string& group, Ref<BinaryView> view, BNSettingsScope scope)
+{
+	string prefix = group + ".";
+	vector<string> keys;
+	for (auto& key : Keys())
+	{
+		if (key.compare(0, prefix.size(), prefix) == 0)
+			keys.push_back(key);
+	}
+	return GetMany(keys, view, scope);
+}
+
+
 string Settings::GetJson(const string& key, Ref<BinaryView> view, BNSettingsScope* scope)
 {
 	char* tmpStr = BNSettingsGetJson(m_object, key.c_str(), view ? view->GetObject() : nullptr, scope);
@@ -270,43 +333,57 @@ string Settings::GetJson(const string& key, Ref<BinaryView> view, BNSettingsScop
 
 bool Settings::Set(const string& key, bool value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetBool(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	bool result = BNSettingsSetBool(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::Set(const string& key, double value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetDouble(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	bool result = BNSettingsSetDouble(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::Set(const string& key, int value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetInt64(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	bool result = BNSettingsSetInt64(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::Set(const string& key, int64_t value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetInt64(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	bool result = BNSettingsSetInt64(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::Set(const string& key, uint64_t value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetUInt64(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	bool result = BNSettingsSetUInt64(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::Set(const string& key, const char* value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetString(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	bool result = BNSettingsSetString(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value);
+	InvalidateCachedSettings();
+	return result;
 }
 
 
 bool Settings::Set(const string& key, const string& value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetString(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value.c_str());
+	bool result = BNSettingsSetString(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value.c_str());
+	InvalidateCachedSettings();
+	return result;
 }
 
 
@@ -325,11 +402,47 @@ bool Settings::Set(const string& key, const vector<string>& value, Ref<BinaryVie
 	for (size_t i = 0; i < value.size(); i++)
 		BNFreeString(buffer[i]);
 	delete[] buffer;
+	InvalidateCachedSettings();
 	return result;
 }
 
 
 bool Settings::SetJson(const string& key, const string& value, Ref<BinaryView> view, BNSettingsScope scope)
 {
-	return BNSettingsSetJson(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value.c_str());
+	bool result = BNSettingsSetJson(m_object, view ? view->GetObject() : nullptr, scope, key.c_str(), value.c_str());
+	InvalidateCachedSettings();
+	return result;
+}
+
+
+void Settings::InvalidateCachedSettings()
+{
+	m_cacheGeneration.fetch_add(1, memory_order_acq_rel);
+}
+
+
+static void SettingsViewDestroyed(void*, BNBinaryView*)
+{
+	// A new view may be allocated at the same address, so nothing cached for the old one may be reused
+	Settings::InvalidateCachedSettings();
+}
+
+
+static void SettingsFileDestroyed(void*, BNFileMetadata*) {}
+
+
+static void SettingsFunctionDestroyed(void*, BNFunction*) {}
+
+
+void Settings::WatchViewDestruction()
+{
+	static once_flag registered;
+	call_once(registered, []() {
+		static BNObjectDestructionCallbacks callbacks;
+		callbacks.context = nullptr;
+		callbacks.destructBinaryView = SettingsViewDestroyed;
+		callbacks.destructFileMetadata = SettingsFileDestroyed;
+		callbacks.destructFunction = SettingsFunctionDestroyed;
+		BNRegisterObjectDestructionCallbacks(&callbacks);
+	});
 }
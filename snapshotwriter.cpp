@@ -0,0 +1,558 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+static const char* const g_manifestKey = "__snapshot_writer_manifest";
+static const char* const g_chunkKeyPrefix = "__snapshot_writer_chunk_";
+static const char* const g_manifestGlobalPrefix = "__snapshot_writer_manifest_";
+static const uint32_t g_manifestVersion = 1;
+
+
+struct ChunkedValue
+{
+	string key;
+	uint64_t hash;
+	uint64_t offset;
+	uint64_t length;
+};
+
+
+static bool CompareOffsets(const ChunkedValue& a, const ChunkedValue& b)
+{
+	return a.offset < b.offset;
+}
+
+
+static string GetChunkKey(size_t index)
+{
+	return g_chunkKeyPrefix + to_string(index);
+}
+
+
+static string GetManifestGlobalKey(int64_t snapshotId)
+{
+	return g_manifestGlobalPrefix + to_string(snapshotId);
+}
+
+
+static size_t GetThreadCount(size_t threadCount)
+{
+	if (threadCount == 0)
+		threadCount = GetWorkerThreadCount();
+	if (threadCount == 0)
+		threadCount = 1;
+	return threadCount;
+}
+
+
+static Ref<KeyValueStore> ReadStoredData(Snapshot* snapshot)
+{
+	BNKeyValueStore* store = BNReadSnapshotData(snapshot->GetObject());
+	if (!store)
+		throw DatabaseException("BNReadSnapshotData");
+	return new KeyValueStore(store);
+}
+
+
+// Produce items on a set of threads and consume them in index order on the calling thread. Producers stay at
+// most a few items per thread ahead of the consumer, which bounds the memory held by finished items.
+static bool ProcessInOrder(size_t count, size_t threadCount, const function<DataBuffer(size_t)>& produce,
+    const function<bool(size_t, DataBuffer&)>& consume)
+{
+	if (count == 0)
+		return true;
+
+	struct Item
+	{
+		bool ready = false;
+		DataBuffer data;
+	};
+
+	vector<Item> items(count);
+	mutex itemMutex;
+	condition_variable itemCond;
+	size_t nextToConsume = 0;
+	bool cancelled = false;
+	exception_ptr error;
+
+	auto produceOne = [&](size_t i) {
+		{
+			unique_lock<mutex> lock(itemMutex);
+			itemCond.wait(lock, [&]() { return cancelled || (i < nextToConsume + (threadCount * 2)); });
+			if (cancelled)
+				return;
+		}
+
+		DataBuffer data;
+		try
+		{
+			data = produce(i);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(itemMutex);
+			if (!error)
+				error = current_exception();
+			cancelled = true;
+			itemCond.notify_all();
+			return;
+		}
+
+		unique_lock<mutex> lock(itemMutex);
+		items[i].data = std::move(data);
+		items[i].ready = true;
+		itemCond.notify_all();
+	};
+
+	thread producerThread([&]() { ParallelFor(count, produceOne, threadCount); });
+
+	bool completed = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		DataBuffer data;
+		{
+			unique_lock<mutex> lock(itemMutex);
+			itemCond.wait(lock, [&]() { return items[i].ready || cancelled; });
+			if (!items[i].ready)
+			{
+				completed = false;
+				break;
+			}
+			data = std::move(items[i].data);
+		}
+
+		bool keepGoing;
+		try
+		{
+			keepGoing = consume(i, data);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(itemMutex);
+			if (!error)
+				error = current_exception();
+			keepGoing = false;
+		}
+
+		unique_lock<mutex> lock(itemMutex);
+		nextToConsume = i + 1;
+		if (!keepGoing)
+			cancelled = true;
+		itemCond.notify_all();
+		if (!keepGoing)
+		{
+			completed = false;
+			break;
+		}
+	}
+
+	producerThread.join();
+	if (error)
+		rethrow_exception(error);
+	return completed;
+}
+
+
+// Rebuild the given values, which must be sorted by offset, from the chunks of one snapshot
+static bool DecodeValues(KeyValueStore* stored, const Json::Value& manifest, const vector<ChunkedValue>& values,
+    KeyValueStore* result, size_t threadCount, const function<bool(uint64_t)>& progress)
+{
+	uint64_t chunkSize = manifest["chunkSize"].asUInt64();
+	uint64_t totalSize = manifest["size"].asUInt64();
+	const Json::Value& compressed = manifest["chunks"];
+	if ((chunkSize == 0) || (((totalSize + chunkSize - 1) / chunkSize) != compressed.size()))
+		throw DatabaseException("Snapshot data manifest is damaged");
+
+	vector<ChunkedValue> pending;
+	set<uint64_t> neededSet;
+	for (auto& value : values)
+	{
+		if (value.length == 0)
+		{
+			result->SetBuffer(value.key, DataBuffer());
+			continue;
+		}
+		if ((value.offset + value.length) > totalSize)
+			throw DatabaseException("Snapshot data manifest is damaged");
+		for (uint64_t c = value.offset / chunkSize; c <= ((value.offset + value.length - 1) / chunkSize); c++)
+			neededSet.insert(c);
+		pending.push_back(value);
+	}
+
+	vector<uint64_t> needed(neededSet.begin(), neededSet.end());
+	vector<DataBuffer> storedChunks;
+	storedChunks.reserve(needed.size());
+	for (uint64_t c : needed)
+		storedChunks.push_back(stored->GetBuffer(GetChunkKey(c)));
+
+	auto produce = [&](size_t i) {
+		uint64_t c = needed[i];
+		uint64_t expected = min<uint64_t>(chunkSize, totalSize - (c * chunkSize));
+		DataBuffer data;
+		if (compressed[(Json::ArrayIndex)c].asBool())
+		{
+			if (!storedChunks[i].ZlibDecompress(data))
+				data.Clear();
+		}
+		else
+		{
+			data = std::move(storedChunks[i]);
+		}
+		storedChunks[i] = DataBuffer();
+		if (data.GetLength() != expected)
+			throw DatabaseException("Snapshot data chunk " + to_string(c) + " is damaged");
+		return data;
+	};
+
+	size_t next = 0;
+	DataBuffer current;
+	auto consume = [&](size_t i, DataBuffer& data) {
+		uint64_t chunkStart = needed[i] * chunkSize;
+		uint64_t chunkEnd = chunkStart + data.GetLength();
+		uint64_t copied = 0;
+		while ((next < pending.size()) && (pending[next].offset < chunkEnd))
+		{
+			const ChunkedValue& value = pending[next];
+			uint64_t valueEnd = value.offset + value.length;
+			uint64_t start = max(value.offset, chunkStart);
+			uint64_t end = min(valueEnd, chunkEnd);
+			if (start == value.offset)
+				current = DataBuffer((size_t)value.length);
+			memcpy(current.GetDataAt((size_t)(start - value.offset)), data.GetDataAt((size_t)(start - chunkStart)),
+			    (size_t)(end - start));
+			copied += end - start;
+			if (valueEnd > chunkEnd)
+				break;
+
+			if (current.GetHash64() != value.hash)
+				throw DatabaseException("Snapshot data for '" + value.key + "' does not match its hash");
+			result->SetBuffer(value.key, current);
+			current = DataBuffer();
+			next++;
+		}
+		return !progress || progress(copied);
+	};
+
+	return ProcessInOrder(needed.size(), threadCount, produce, consume);
+}
+
+
+// Encoding covers the first half of the reported progress and the core write the second half
+struct WriteProgress
+{
+	const function<bool(size_t, size_t)>& callback;
+	size_t payloadSize;
+	bool cancelled = false;
+
+	WriteProgress(const function<bool(size_t, size_t)>& cb, size_t size) : callback(cb), payloadSize(size) {}
+
+	bool Report(size_t done, size_t total, bool writing)
+	{
+		if (!callback || cancelled)
+			return !cancelled;
+		size_t scaled = total ? (size_t)((double)done / (double)total * (double)payloadSize) : payloadSize;
+		if (!callback(writing ? (payloadSize + scaled) : scaled, payloadSize * 2))
+			cancelled = true;
+		return !cancelled;
+	}
+};
+
+
+SnapshotWriter::SnapshotWriter(Database* database, const SnapshotWriterSettings& settings) :
+    m_database(database), m_settings(settings)
+{
+	if (m_settings.chunkSize == 0)
+		m_settings.chunkSize = SnapshotWriterSettings().chunkSize;
+}
+
+
+bool SnapshotWriter::Encode(KeyValueStore* data, Snapshot* parent, KeyValueStore* output,
+    const function<bool(size_t, size_t)>& progress)
+{
+	size_t threadCount = GetThreadCount(m_settings.threadCount);
+	vector<string> keys = data->GetKeys();
+	vector<DataBuffer> buffers;
+	buffers.reserve(keys.size());
+	for (auto& key : keys)
+		buffers.push_back(data->GetBuffer(key));
+
+	vector<uint64_t> hashes(keys.size());
+	ParallelFor(keys.size(), [&](size_t i) { hashes[i] = buffers[i].GetHash64(); }, threadCount);
+
+	// Values that are unchanged since the parent refer to the snapshot that stores them
+	map<string, pair<uint64_t, Json::Value>> parentValues;
+	if (m_settings.incremental && parent)
+	{
+		Json::Value parentManifest = ReadManifest(parent);
+		for (auto& value : parentManifest["values"])
+		{
+			Json::Value source =
+			    value.isMember("snapshot") ? value["snapshot"] : Json::Value((Json::Int64)parent->GetId());
+			parentValues[value["key"].asString()] = {value["hash"].asUInt64(), source};
+		}
+	}
+
+	Json::Value manifest(Json::objectValue);
+	manifest["version"] = g_manifestVersion;
+	manifest["chunkSize"] = (Json::UInt64)m_settings.chunkSize;
+	Json::Value& values = manifest["values"] = Json::Value(Json::arrayValue);
+
+	vector<size_t> storedIndices;
+	vector<uint64_t> storedOffsets;
+	vector<uint64_t> storedLengths;
+	uint64_t totalSize = 0;
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		Json::Value entry(Json::objectValue);
+		entry["key"] = keys[i];
+		entry["hash"] = (Json::UInt64)hashes[i];
+		entry["length"] = (Json::UInt64)buffers[i].GetLength();
+		auto parentValue = parentValues.find(keys[i]);
+		if ((parentValue != parentValues.end()) && (parentValue->second.first == hashes[i]))
+		{
+			entry["snapshot"] = parentValue->second.second;
+			buffers[i] = DataBuffer();
+		}
+		else
+		{
+			entry["offset"] = (Json::UInt64)totalSize;
+			storedIndices.push_back(i);
+			storedOffsets.push_back(totalSize);
+			storedLengths.push_back(buffers[i].GetLength());
+			totalSize += buffers[i].GetLength();
+		}
+		values.append(std::move(entry));
+	}
+
+	uint64_t chunkSize = m_settings.chunkSize;
+	size_t chunkCount = (size_t)((totalSize + chunkSize - 1) / chunkSize);
+	vector<uint8_t> chunkCompressed(chunkCount);
+
+	auto produce = [&](size_t c) {
+		uint64_t chunkStart = c * chunkSize;
+		uint64_t chunkEnd = min(chunkStart + chunkSize, totalSize);
+		DataBuffer chunk((size_t)(chunkEnd - chunkStart));
+		auto first = upper_bound(storedOffsets.begin(), storedOffsets.end(), chunkStart);
+		size_t j = (size_t)(first - storedOffsets.begin()) - 1;
+		for (; (j < storedIndices.size()) && (storedOffsets[j] < chunkEnd); j++)
+		{
+			// Values that end before this chunk may already have been released, so only touch overlapping ones
+			uint64_t start = max(storedOffsets[j], chunkStart);
+			uint64_t end = min(storedOffsets[j] + storedLengths[j], chunkEnd);
+			if (end > start)
+				memcpy(chunk.GetDataAt((size_t)(start - chunkStart)),
+				    buffers[storedIndices[j]].GetDataAt((size_t)(start - storedOffsets[j])), (size_t)(end - start));
+		}
+
+		DataBuffer result;
+		if (chunk.ZlibCompress(result) && (result.GetLength() < chunk.GetLength()))
+		{
+			chunkCompressed[c] = 1;
+			return result;
+		}
+		return chunk;
+	};
+
+	// Values are released once every chunk holding part of them has been stored
+	size_t released = 0;
+	auto consume = [&](size_t c, DataBuffer& chunk) {
+		output->SetBuffer(GetChunkKey(c), chunk);
+		uint64_t chunkEnd = min((c + 1) * chunkSize, totalSize);
+		for (; (released < storedIndices.size()) && ((storedOffsets[released] + storedLengths[released]) <= chunkEnd);
+		     released++)
+			buffers[storedIndices[released]] = DataBuffer();
+		return !progress || progress((size_t)chunkEnd, (size_t)totalSize);
+	};
+
+	if (!ProcessInOrder(chunkCount, threadCount, produce, consume))
+		return false;
+
+	manifest["size"] = (Json::UInt64)totalSize;
+	Json::Value& chunks = manifest["chunks"] = Json::Value(Json::arrayValue);
+	for (uint8_t flag : chunkCompressed)
+		chunks.append(flag != 0);
+	output->SetValue(g_manifestKey, manifest, CborValueEncoding);
+	return true;
+}
+
+
+Json::Value SnapshotWriter::ReadManifest(Snapshot* snapshot)
+{
+	if (!m_database->SnapshotHasData(snapshot->GetId()))
+		return Json::Value();
+
+	// The copy kept as a global avoids reading every chunk of the snapshot just to get at its manifest. Snapshots
+	// written before the copy was kept, or whose copy was cleared, are read in full.
+	string key = GetManifestGlobalKey(snapshot->GetId());
+	if (m_database->HasGlobal(key))
+	{
+		Json::Value manifest = m_database->ReadGlobal(key);
+		if (manifest.isObject())
+			return manifest;
+	}
+
+	Ref<KeyValueStore> stored = ReadStoredData(snapshot);
+	if (!IsChunked(stored))
+		return Json::Value();
+	return stored->GetValue(g_manifestKey);
+}
+
+
+void SnapshotWriter::RecordManifest(Database* database, int64_t snapshotId, KeyValueStore* stored)
+{
+	string key = GetManifestGlobalKey(snapshotId);
+	if (stored && IsChunked(stored))
+		database->WriteGlobal(key, stored->GetValue(g_manifestKey), CborValueEncoding);
+	else if (database->HasGlobal(key))
+		database->WriteGlobal(key, Json::Value());
+}
+
+
+int64_t SnapshotWriter::WriteSnapshotData(const vector<int64_t>& parents, Ref<BinaryView> file, const string& name,
+    const Ref<KeyValueStore>& data, bool autoSave, const function<bool(size_t, size_t)>& progress)
+{
+	Ref<Snapshot> parent = parents.empty() ? nullptr : m_database->GetSnapshot(parents[0]);
+	WriteProgress writeProgress(progress, data->DataSize());
+	Ref<KeyValueStore> output = new KeyValueStore();
+	auto encodeProgress = [&](size_t done, size_t total) { return writeProgress.Report(done, total, false); };
+	if (!Encode(data, parent, output, encodeProgress))
+		return -1;
+
+	ProgressContext pctxt;
+	pctxt.callback = [&](size_t done, size_t total) { return writeProgress.Report(done, total, true); };
+	vector<int64_t> parentIds = parents;
+	int64_t result = BNWriteDatabaseSnapshotData(m_database->GetObject(), parentIds.data(), parentIds.size(),
+	    file->GetObject(), name.c_str(), output->GetObject(), autoSave, &pctxt, ProgressCallback);
+	if (result < 0)
+	{
+		if (writeProgress.cancelled)
+			return -1;
+		throw DatabaseException("BNWriteDatabaseSnapshotData");
+	}
+	RecordManifest(m_database, result, output);
+	return result;
+}
+
+
+bool SnapshotWriter::StoreData(Ref<Snapshot> snapshot, const Ref<KeyValueStore>& data,
+    const function<bool(size_t, size_t)>& progress)
+{
+	Ref<Snapshot> parent = snapshot->GetFirstParent();
+	WriteProgress writeProgress(progress, data->DataSize());
+	Ref<KeyValueStore> output = new KeyValueStore();
+	auto encodeProgress = [&](size_t done, size_t total) { return writeProgress.Report(done, total, false); };
+	if (!Encode(data, parent, output, encodeProgress))
+		return false;
+
+	// The old manifest is cleared first, so a failed store can't leave it describing data that was replaced
+	RecordManifest(m_database, snapshot->GetId(), nullptr);
+	ProgressContext pctxt;
+	pctxt.callback = [&](size_t done, size_t total) { return writeProgress.Report(done, total, true); };
+	if (!BNSnapshotStoreData(snapshot->GetObject(), output->GetObject(), &pctxt, ProgressCallback))
+	{
+		if (writeProgress.cancelled)
+			return false;
+		throw DatabaseException("BNSnapshotStoreData");
+	}
+	RecordManifest(m_database, snapshot->GetId(), output);
+	return true;
+}
+
+
+bool SnapshotWriter::IsChunked(KeyValueStore* stored)
+{
+	return stored->HasValue(g_manifestKey);
+}
+
+
+Ref<KeyValueStore> SnapshotWriter::Decode(Database* database, KeyValueStore* stored, size_t threadCount,
+    const function<bool(size_t, size_t)>& progress)
+{
+	threadCount = GetThreadCount(threadCount);
+	Json::Value manifest = stored->GetValue(g_manifestKey);
+	if (manifest["version"].asUInt() != g_manifestVersion)
+		throw DatabaseException("Unsupported snapshot data version");
+
+	vector<ChunkedValue> local;
+	map<int64_t, set<string>> referenced;
+	uint64_t totalSize = 0;
+	for (auto& value : manifest["values"])
+	{
+		string key = value["key"].asString();
+		uint64_t length = value["length"].asUInt64();
+		totalSize += length;
+		if (value.isMember("snapshot"))
+			referenced[value["snapshot"].asInt64()].insert(key);
+		else
+			local.push_back({key, value["hash"].asUInt64(), value["offset"].asUInt64(), length});
+	}
+
+	uint64_t done = 0;
+	auto reportProgress = [&](uint64_t bytes) {
+		done += bytes;
+		return !progress || progress((size_t)done, (size_t)totalSize);
+	};
+
+	sort(local.begin(), local.end(), CompareOffsets);
+	Ref<KeyValueStore> result = new KeyValueStore();
+	if (!DecodeValues(stored, manifest, local, result, threadCount, reportProgress))
+		return nullptr;
+
+	for (auto& [id, keys] : referenced)
+	{
+		Ref<Snapshot> snapshot = database->GetSnapshot(id);
+		if (!snapshot || !database->SnapshotHasData(id))
+			throw DatabaseException("Snapshot data refers to snapshot " + to_string(id) + ", which has no data");
+		Ref<KeyValueStore> ancestorStored = ReadStoredData(snapshot);
+		if (!IsChunked(ancestorStored))
+			throw DatabaseException("Snapshot data refers to snapshot " + to_string(id) + ", which is not chunked");
+
+		Json::Value ancestorManifest = ancestorStored->GetValue(g_manifestKey);
+		vector<ChunkedValue> values;
+		for (auto& value : ancestorManifest["values"])
+		{
+			string key = value["key"].asString();
+			if (value.isMember("offset") && keys.count(key))
+			{
+				values.push_back(
+				    {key, value["hash"].asUInt64(), value["offset"].asUInt64(), value["length"].asUInt64()});
+				keys.erase(key);
+			}
+		}
+		sort(values.begin(), values.end(), CompareOffsets);
+		if (!keys.empty())
+			throw DatabaseException("Snapshot " + to_string(id) + " does not hold '" + *keys.begin() + "'");
+		if (!DecodeValues(ancestorStored, ancestorManifest, values, result, threadCount, reportProgress))
+			return nullptr;
+	}
+	return result;
+}
@@ -32,7 +32,7 @@ TemporaryFile::TemporaryFile()
 
 TemporaryFile::TemporaryFile(const DataBuffer& contents)
 {
-	m_object = BNCreateTemporaryFileWithContents(contents.GetBufferObject());
+	m_object = BNCreateTemporaryFileWithContents(DataBuffer::ScopedObject(contents));
 }
 
 
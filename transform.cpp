@@ -18,12 +18,320 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <cstring>
+#include <string>
 #include "binaryninjaapi.h"
+#include "databufferkernels.h"
 
 using namespace BinaryNinja;
 using namespace std;
 
 
+namespace
+{
+	// Collects the whole input and runs the one-shot transform, for transforms that cannot work on chunks
+	class BufferedTransformStream : public TransformStream
+	{
+		Ref<Transform> m_transform;
+		bool m_encode;
+		map<string, DataBuffer> m_params;
+		DataBuffer m_input;
+
+	  public:
+		BufferedTransformStream(Transform* transform, bool encode) : m_transform(transform), m_encode(encode) {}
+
+		bool Begin(const map<string, DataBuffer>& params) override
+		{
+			m_params = params;
+			m_input = DataBuffer();
+			return true;
+		}
+
+		bool Update(const void* data, size_t len, DataBuffer&) override
+		{
+			m_input.Append(data, len);
+			return true;
+		}
+
+		bool IsIncremental() const override { return false; }
+
+		bool Finish(DataBuffer& output) override
+		{
+			DataBuffer result;
+			bool ok = m_encode ? m_transform->Encode(m_input, result, m_params) :
+			                     m_transform->Decode(m_input, result, m_params);
+			m_input = DataBuffer();
+			if (ok)
+				output.Append(result);
+			return ok;
+		}
+	};
+
+	bool IsSpace(char c)
+	{
+		return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+	}
+
+	// Appends the characters of a chunk, other than whitespace, to a pending run of characters
+	void AppendNonSpace(string& pending, const void* data, size_t len)
+	{
+		const char* chars = (const char*)data;
+		pending.reserve(pending.size() + len);
+		for (size_t i = 0; i < len; i++)
+		{
+			if (!IsSpace(chars[i]))
+				pending.push_back(chars[i]);
+		}
+	}
+
+	class HexEncodeStream : public TransformStream
+	{
+	  public:
+		bool Begin(const map<string, DataBuffer>&) override { return true; }
+
+		bool Update(const void* data, size_t len, DataBuffer& output) override
+		{
+			size_t start = output.GetLength();
+			output.SetSize(start + len * 2);
+			DataBufferKernels::HexEncode((const uint8_t*)data, len, (char*)output.GetDataAt(start));
+			return true;
+		}
+
+		bool Finish(DataBuffer&) override { return true; }
+
+		bool Seek(uint64_t outputOffset, uint64_t& inputOffset) override
+		{
+			if (outputOffset & 1)
+				return false;
+			inputOffset = outputOffset / 2;
+			return true;
+		}
+
+		bool GetOutputLength(uint64_t inputLength, uint64_t& outputLength) override
+		{
+			outputLength = inputLength * 2;
+			return true;
+		}
+	};
+
+	class HexDecodeStream : public TransformStream
+	{
+		// At most one digit is left over between chunks
+		string m_pending;
+
+	  public:
+		bool Begin(const map<string, DataBuffer>&) override
+		{
+			m_pending.clear();
+			return true;
+		}
+
+		bool Update(const void* data, size_t len, DataBuffer& output) override
+		{
+			AppendNonSpace(m_pending, data, len);
+			size_t digits = m_pending.size() & ~(size_t)1;
+			size_t start = output.GetLength();
+			output.SetSize(start + digits / 2);
+			if (!DataBufferKernels::HexDecode(m_pending.data(), digits, (uint8_t*)output.GetDataAt(start)))
+				return false;
+			m_pending.erase(0, digits);
+			return true;
+		}
+
+		bool Finish(DataBuffer&) override { return m_pending.empty(); }
+	};
+
+	class Base64DecodeStream : public TransformStream
+	{
+		// At most three characters of an incomplete group are left over between chunks
+		string m_pending;
+		bool m_ended = false;
+
+	  public:
+		bool Begin(const map<string, DataBuffer>&) override
+		{
+			m_pending.clear();
+			m_ended = false;
+			return true;
+		}
+
+		bool Update(const void* data, size_t len, DataBuffer& output) override
+		{
+			AppendNonSpace(m_pending, data, len);
+			if (m_pending.empty())
+				return true;
+			// Padding ends the encoded data, so nothing may follow it
+			if (m_ended)
+				return false;
+
+			size_t chars = m_pending.size() & ~(size_t)3;
+			if (chars == 0)
+				return true;
+			size_t start = output.GetLength();
+			output.SetSize(start + chars / 4 * 3);
+			size_t decoded;
+			if (!DataBufferKernels::Base64Decode(m_pending.data(), chars, (uint8_t*)output.GetDataAt(start), decoded))
+				return false;
+			output.SetSize(start + decoded);
+			m_ended = m_pending[chars - 1] == '=';
+			m_pending.erase(0, chars);
+			return !m_ended || m_pending.empty();
+		}
+
+		bool Finish(DataBuffer&) override { return m_pending.empty(); }
+	};
+
+	class XorStream : public TransformStream
+	{
+		DataBuffer m_key;
+		uint64_t m_position = 0;
+
+	  public:
+		bool Begin(const map<string, DataBuffer>& params) override
+		{
+			auto key = params.find("key");
+			if ((key == params.end()) || (key->second.GetLength() == 0))
+				return false;
+			m_key = key->second;
+			m_position = 0;
+			return true;
+		}
+
+		bool Update(const void* data, size_t len, DataBuffer& output) override
+		{
+			const uint8_t* in = (const uint8_t*)data;
+			const uint8_t* key = (const uint8_t*)m_key.GetData();
+			size_t keyLen = m_key.GetLength();
+			size_t keyIndex = (size_t)(m_position % keyLen);
+			size_t start = output.GetLength();
+			output.SetSize(start + len);
+			uint8_t* out = (uint8_t*)output.GetDataAt(start);
+			for (size_t i = 0; i < len; i++)
+			{
+				out[i] = in[i] ^ key[keyIndex];
+				if (++keyIndex == keyLen)
+					keyIndex = 0;
+			}
+			m_position += len;
+			return true;
+		}
+
+		bool Finish(DataBuffer&) override { return true; }
+
+		bool Seek(uint64_t outputOffset, uint64_t& inputOffset) override
+		{
+			m_position = outputOffset;
+			inputOffset = outputOffset;
+			return true;
+		}
+
+		bool GetOutputLength(uint64_t inputLength, uint64_t& outputLength) override
+		{
+			outputLength = inputLength;
+			return true;
+		}
+	};
+
+	class Rc4Stream : public TransformStream
+	{
+		uint8_t m_state[256];
+		uint8_t m_i = 0, m_j = 0;
+
+	  public:
+		bool Begin(const map<string, DataBuffer>& params) override
+		{
+			auto key = params.find("key");
+			if ((key == params.end()) || (key->second.GetLength() == 0))
+				return false;
+			const uint8_t* keyData = (const uint8_t*)key->second.GetData();
+			size_t keyLen = key->second.GetLength();
+			for (size_t i = 0; i < 256; i++)
+				m_state[i] = (uint8_t)i;
+			uint8_t j = 0;
+			for (size_t i = 0; i < 256; i++)
+			{
+				j += m_state[i] + keyData[i % keyLen];
+				swap(m_state[i], m_state[j]);
+			}
+			m_i = 0;
+			m_j = 0;
+			return true;
+		}
+
+		bool Update(const void* data, size_t len, DataBuffer& output) override
+		{
+			const uint8_t* in = (const uint8_t*)data;
+			size_t start = output.GetLength();
+			output.SetSize(start + len);
+			uint8_t* out = (uint8_t*)output.GetDataAt(start);
+			for (size_t n = 0; n < len; n++)
+			{
+				m_i++;
+				m_j += m_state[m_i];
+				swap(m_state[m_i], m_state[m_j]);
+				out[n] = in[n] ^ m_state[(uint8_t)(m_state[m_i] + m_state[m_j])];
+			}
+			return true;
+		}
+
+		bool Finish(DataBuffer&) override { return true; }
+
+		bool GetOutputLength(uint64_t inputLength, uint64_t& outputLength) override
+		{
+			outputLength = inputLength;
+			return true;
+		}
+	};
+
+	// Streaming versions of core transforms whose output is fully determined by well formed input. Base64
+	// encoding is left to the core, which decides on details such as line wrapping.
+	Ref<TransformStream> CreateBuiltinStream(const string& name, bool encode)
+	{
+		if (name == "RawHex")
+		{
+			if (encode)
+				return new HexEncodeStream();
+			return new HexDecodeStream();
+		}
+		if ((name == "Base64") && !encode)
+			return new Base64DecodeStream();
+		if (name == "XOR")
+			return new XorStream();
+		if (name == "RC4")
+			return new Rc4Stream();
+		return nullptr;
+	}
+}  // namespace
+
+
+bool TransformStream::Seek(uint64_t, uint64_t&)
+{
+	return false;
+}
+
+
+bool TransformStream::GetOutputLength(uint64_t, uint64_t&)
+{
+	return false;
+}
+
+
+bool TransformStream::IsIncremental() const
+{
+	return true;
+}
+
+
+bool TransformStream::Process(const DataBuffer& input, DataBuffer& output, const map<string, DataBuffer>& params)
+{
+	DataBuffer result;
+	if (!Begin(params) || !Update(input.GetData(), input.GetLength(), result) || !Finish(result))
+		return false;
+	output = std::move(result);
+	return true;
+}
+
+
 Transform::Transform(BNTransform* xform)
 {
 	m_object = xform;
@@ -219,6 +527,18 @@ bool Transform::Encode(const DataBuffer&, DataBuffer&, const map<string, DataBuf
 }
 
 
+Ref<TransformStream> Transform::CreateDecodeStream()
+{
+	return new BufferedTransformStream(this, false);
+}
+
+
+Ref<TransformStream> Transform::CreateEncodeStream()
+{
+	return new BufferedTransformStream(this, true);
+}
+
+
 CoreTransform::CoreTransform(BNTransform* xform) : Transform(xform) {}
 
 
@@ -245,15 +565,24 @@ vector<TransformParameter> CoreTransform::GetParameters() const
 
 bool CoreTransform::Decode(const DataBuffer& input, DataBuffer& output, const map<string, DataBuffer>& params)
 {
+	// The built-in streams reject anything they are not certain to handle exactly like the core, which then
+	// takes over
+	Ref<TransformStream> stream = CreateBuiltinStream(GetName(), false);
+	if (stream && stream->Process(input, output, params))
+		return true;
+
+	vector<DataBuffer::ScopedObject> values;
+	values.reserve(params.size());
 	BNTransformParameter* list = new BNTransformParameter[params.size()];
 	size_t idx = 0;
 	for (auto& i : params)
 	{
+		values.emplace_back(i.second);
 		list[idx].name = i.first.c_str();
-		list[idx++].value = i.second.GetBufferObject();
+		list[idx++].value = values.back();
 	}
 
-	bool result = BNDecode(m_object, input.GetBufferObject(), output.GetBufferObject(), list, idx);
+	bool result = BNDecode(m_object, DataBuffer::ScopedObject(input), output.GetBufferObject(), list, idx);
 
 	delete[] list;
 	return result;
@@ -262,16 +591,43 @@ bool CoreTransform::Decode(const DataBuffer& input, DataBuffer& output, const ma
 
 bool CoreTransform::Encode(const DataBuffer& input, DataBuffer& output, const map<string, DataBuffer>& params)
 {
+	// The built-in streams reject anything they are not certain to handle exactly like the core, which then
+	// takes over
+	Ref<TransformStream> stream = CreateBuiltinStream(GetName(), true);
+	if (stream && stream->Process(input, output, params))
+		return true;
+
+	vector<DataBuffer::ScopedObject> values;
+	values.reserve(params.size());
 	BNTransformParameter* list = new BNTransformParameter[params.size()];
 	size_t idx = 0;
 	for (auto& i : params)
 	{
+		values.emplace_back(i.second);
 		list[idx].name = i.first.c_str();
-		list[idx++].value = i.second.GetBufferObject();
+		list[idx++].value = values.back();
 	}
 
-	bool result = BNEncode(m_object, input.GetBufferObject(), output.GetBufferObject(), list, idx);
+	bool result = BNEncode(m_object, DataBuffer::ScopedObject(input), output.GetBufferObject(), list, idx);
 
 	delete[] list;
 	return result;
 }
+
+
+Ref<TransformStream> CoreTransform::CreateDecodeStream()
+{
+	Ref<TransformStream> stream = CreateBuiltinStream(GetName(), false);
+	if (stream)
+		return stream;
+	return Transform::CreateDecodeStream();
+}
+
+
+Ref<TransformStream> CoreTransform::CreateEncodeStream()
+{
+	Ref<TransformStream> stream = CreateBuiltinStream(GetName(), true);
+	if (stream)
+		return stream;
+	return Transform::CreateEncodeStream();
+}
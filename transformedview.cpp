@@ -0,0 +1,276 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <algorithm>
+#include <cstring>
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+TransformedBinaryView::TransformedBinaryView(BinaryView* source, uint64_t start, uint64_t length,
+    TransformStream* stream, const map<string, DataBuffer>& params, uint64_t outputLength, size_t blockSize,
+    size_t cacheBlocks) :
+	BinaryView("Transformed", source->GetFile(), source),
+	m_source(source), m_sourceStart(start), m_sourceLength(length), m_stream(stream), m_params(params),
+	m_length(outputLength), m_blockSize(blockSize), m_cacheBlocks(cacheBlocks)
+{}
+
+
+bool TransformedBinaryView::MeasureOutput(BinaryView* source, uint64_t start, uint64_t length,
+    TransformStream* stream, const map<string, DataBuffer>& params, size_t chunkSize, uint64_t& outputLength)
+{
+	if (!stream->Begin(params))
+		return false;
+	if (stream->GetOutputLength(length, outputLength))
+		return true;
+
+	// The output length depends on the input, so run one pass and discard the output as it is produced
+	outputLength = 0;
+	DataBuffer output;
+	for (uint64_t offset = 0; offset < length;)
+	{
+		DataBuffer input = source->ReadBuffer(start + offset, (size_t)min<uint64_t>(chunkSize, length - offset));
+		if (input.GetLength() == 0)
+			return false;
+		if (!stream->Update(input.GetData(), input.GetLength(), output))
+			return false;
+		offset += input.GetLength();
+		outputLength += output.GetLength();
+		output.Clear();
+	}
+	if (!stream->Finish(output))
+		return false;
+	outputLength += output.GetLength();
+	return true;
+}
+
+
+Ref<TransformedBinaryView> TransformedBinaryView::Create(BinaryView* source, uint64_t start, uint64_t length,
+    Transform* transform, const map<string, DataBuffer>& params, bool encode, size_t blockSize, size_t cacheBlocks)
+{
+	if (!source || !transform || (blockSize == 0) || (cacheBlocks == 0))
+		return nullptr;
+	Ref<TransformStream> stream = encode ? transform->CreateEncodeStream() : transform->CreateDecodeStream();
+	if (!stream)
+		return nullptr;
+
+	if (!stream->IsIncremental())
+	{
+		// Every pass of such a stream holds the whole input and output, so running it once and keeping the
+		// output costs less than cutting blocks from repeated passes
+		DataBuffer input = source->ReadBuffer(start, (size_t)length);
+		if (input.GetLength() != length)
+			return nullptr;
+		DataBuffer output;
+		if (!stream->Process(input, output, params))
+			return nullptr;
+		Ref<TransformedBinaryView> view =
+		    new TransformedBinaryView(source, start, length, stream, params, output.GetLength(), blockSize, cacheBlocks);
+		view->m_buffered = true;
+		view->m_output = std::move(output);
+		return view;
+	}
+
+	uint64_t outputLength;
+	if (!MeasureOutput(source, start, length, stream, params, blockSize, outputLength))
+		return nullptr;
+	return new TransformedBinaryView(source, start, length, stream, params, outputLength, blockSize, cacheBlocks);
+}
+
+
+bool TransformedBinaryView::BeginPass()
+{
+	m_passActive = m_stream->Begin(m_params);
+	m_passFinished = false;
+	m_inputOffset = 0;
+	m_outputOffset = 0;
+	m_pending.Clear();
+	m_pendingOffset = 0;
+	return m_passActive;
+}
+
+
+void TransformedBinaryView::CutBlocks(uint64_t lastIndex)
+{
+	// Blocks up to and including the requested one are cached, so the requested block is the most recently
+	// used when this returns and cannot have been evicted
+	while (m_outputOffset <= lastIndex * m_blockSize)
+	{
+		size_t available = m_pending.GetLength() - m_pendingOffset;
+		if ((available == 0) || ((available < m_blockSize) && !m_passFinished))
+			break;
+
+		uint64_t index = m_outputOffset / m_blockSize;
+		size_t size = min(available, m_blockSize);
+		if (m_cacheIndex.find(index) == m_cacheIndex.end())
+		{
+			m_cache.push_front(CachedBlock {index, DataBuffer(m_pending.GetDataAt(m_pendingOffset), size)});
+			m_cacheIndex[index] = m_cache.begin();
+			if (m_cache.size() > m_cacheBlocks)
+			{
+				m_cacheIndex.erase(m_cache.back().index);
+				m_cache.pop_back();
+			}
+		}
+		m_pendingOffset += size;
+		m_outputOffset += size;
+	}
+
+	// Compact only once most of the buffer has been consumed, so that cutting a large buffered output one
+	// block at a time does not copy the remainder each time
+	if (m_pendingOffset == m_pending.GetLength())
+	{
+		m_pending.Clear();
+		m_pendingOffset = 0;
+	}
+	else if (m_pendingOffset > m_pending.GetLength() / 2)
+	{
+		m_pending = DataBuffer(m_pending.GetDataAt(m_pendingOffset), m_pending.GetLength() - m_pendingOffset);
+		m_pendingOffset = 0;
+	}
+}
+
+
+const DataBuffer* TransformedBinaryView::GetBlock(uint64_t index)
+{
+	auto cached = m_cacheIndex.find(index);
+	if (cached != m_cacheIndex.end())
+	{
+		m_cache.splice(m_cache.begin(), m_cache, cached->second);
+		return &cached->second->data;
+	}
+
+	uint64_t blockStart = index * m_blockSize;
+	if (!m_passActive || (m_outputOffset != blockStart))
+	{
+		// Jump straight to the block when the stream allows it, otherwise continue the current pass if it
+		// has not yet passed the block, and start over if it has
+		uint64_t inputOffset;
+		if ((m_passActive || BeginPass()) && m_stream->Seek(blockStart, inputOffset))
+		{
+			m_passFinished = false;
+			m_inputOffset = inputOffset;
+			m_outputOffset = blockStart;
+			m_pending.Clear();
+			m_pendingOffset = 0;
+		}
+		else if ((!m_passActive || (m_outputOffset > blockStart)) && !BeginPass())
+		{
+			return nullptr;
+		}
+	}
+
+	while (m_outputOffset <= blockStart)
+	{
+		CutBlocks(index);
+		if ((m_outputOffset > blockStart) || m_passFinished)
+			break;
+
+		if (m_inputOffset < m_sourceLength)
+		{
+			DataBuffer input = m_source->ReadBuffer(m_sourceStart + m_inputOffset,
+			    (size_t)min<uint64_t>(m_blockSize, m_sourceLength - m_inputOffset));
+			if ((input.GetLength() == 0) || !m_stream->Update(input.GetData(), input.GetLength(), m_pending))
+			{
+				m_passActive = false;
+				return nullptr;
+			}
+			m_inputOffset += input.GetLength();
+		}
+		else
+		{
+			if (!m_stream->Finish(m_pending))
+			{
+				m_passActive = false;
+				return nullptr;
+			}
+			m_passFinished = true;
+		}
+	}
+
+	cached = m_cacheIndex.find(index);
+	if (cached == m_cacheIndex.end())
+		return nullptr;
+	return &cached->second->data;
+}
+
+
+size_t TransformedBinaryView::PerformRead(void* dest, uint64_t offset, size_t len)
+{
+	if (m_buffered)
+	{
+		if (offset >= m_length)
+			return 0;
+		size_t size = (size_t)min<uint64_t>(len, m_length - offset);
+		memcpy(dest, m_output.GetDataAt((size_t)offset), size);
+		return size;
+	}
+
+	unique_lock<mutex> lock(m_mutex);
+	size_t done = 0;
+	while ((done < len) && (offset < m_length))
+	{
+		uint64_t index = offset / m_blockSize;
+		const DataBuffer* block = GetBlock(index);
+		if (!block)
+			break;
+		size_t blockOffset = (size_t)(offset - index * m_blockSize);
+		if (blockOffset >= block->GetLength())
+			break;
+		size_t size = min(len - done, block->GetLength() - blockOffset);
+		memcpy((uint8_t*)dest + done, block->GetDataAt(blockOffset), size);
+		done += size;
+		offset += size;
+	}
+	return done;
+}
+
+
+bool TransformedBinaryView::PerformIsValidOffset(uint64_t offset)
+{
+	return offset < m_length;
+}
+
+
+bool TransformedBinaryView::PerformIsOffsetReadable(uint64_t offset)
+{
+	return offset < m_length;
+}
+
+
+bool TransformedBinaryView::PerformIsOffsetWritable(uint64_t)
+{
+	return false;
+}
+
+
+uint64_t TransformedBinaryView::PerformGetNextValidOffset(uint64_t offset)
+{
+	return min(offset, m_length);
+}
+
+
+uint64_t TransformedBinaryView::PerformGetLength() const
+{
+	return m_length;
+}
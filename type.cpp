@@ -19,6 +19,7 @@
 // IN THE SOFTWARE.
 
 #include "binaryninjaapi.h"
+#include <algorithm>
 #include <cinttypes>
 
 using namespace BinaryNinja;
@@ -2613,6 +2614,291 @@ StructureBuilder& StructureBuilder::ReplaceMember(
 }
 
 
+bool StructureLayout::FindMemberAtOffset(uint64_t offset, size_t& index) const
+{
+	// Walk back from the last member starting at or before the offset until no earlier member can reach it
+	auto i = upper_bound(order.begin(), order.end(), offset,
+	    [&](uint64_t value, size_t member) { return value < members[member].offset; });
+	while (i != order.begin())
+	{
+		--i;
+		const StructureMemberLayout& member = members[*i];
+		if ((offset < member.offset + member.width) || ((member.width == 0) && (offset == member.offset)))
+		{
+			index = *i;
+			return true;
+		}
+		if ((coveredEnd[i - order.begin()] <= offset) && (member.offset != offset))
+			break;
+	}
+	return false;
+}
+
+
+static uint64_t AlignOffset(uint64_t offset, size_t alignment)
+{
+	if (alignment <= 1)
+		return offset;
+	return ((offset + alignment - 1) / alignment) * alignment;
+}
+
+
+bool StructureBuilder::ComputeLayout(Span<const StructureMemberDescriptor> members, BNStructureVariant type,
+    bool packed, StructureLayout& result, string& error, uint64_t startOffset)
+{
+	result.members.clear();
+	result.members.reserve(members.size());
+	result.order.clear();
+	result.coveredEnd.clear();
+	result.width = 0;
+	result.alignment = 1;
+
+	// Candidate structures reuse a handful of member types, so the width and alignment of each type is only
+	// requested from the core once
+	unordered_map<Type*, pair<uint64_t, size_t>> typeInfo;
+	bool isUnion = type == UnionStructureType;
+	uint64_t end = startOffset;
+	uint64_t highest = startOffset;
+	uint64_t unitOffset = 0;
+	uint64_t unitWidth = 0;
+	size_t unitBits = 0;
+	for (size_t i = 0; i < members.size(); i++)
+	{
+		const StructureMemberDescriptor& member = members[i];
+		if (!member.type)
+		{
+			error = fmt::format("member {} has no type", i);
+			return false;
+		}
+
+		auto info = typeInfo.find(member.type);
+		if (info == typeInfo.end())
+			info = typeInfo.emplace(member.type, make_pair(member.type->GetWidth(), member.type->GetAlignment())).first;
+		uint64_t width = info->second.first;
+		size_t alignment = (packed || (info->second.second == 0)) ? 1 : info->second.second;
+		bool placed = member.offset != StructureMemberDescriptor::AutoOffset;
+
+		StructureMemberLayout layout = {0, width, 0, member.bitWidth};
+		if (member.bitWidth != 0)
+		{
+			if ((width == 0) || (width > 8) || (member.bitWidth > (width * 8)))
+			{
+				error = fmt::format("bitfield member {} is wider than its type", i);
+				return false;
+			}
+			if (!isUnion && !placed && (unitWidth == width) && ((unitBits + member.bitWidth) <= (width * 8)))
+			{
+				layout.offset = unitOffset;
+				layout.bitPosition = (uint8_t)unitBits;
+				unitBits += member.bitWidth;
+			}
+			else
+			{
+				layout.offset = placed ? member.offset : (isUnion ? startOffset : AlignOffset(end, alignment));
+				unitOffset = layout.offset;
+				unitWidth = isUnion ? 0 : width;
+				unitBits = member.bitWidth;
+			}
+		}
+		else
+		{
+			layout.offset = placed ? member.offset : (isUnion ? startOffset : AlignOffset(end, alignment));
+			unitWidth = 0;
+		}
+
+		if (!isUnion)
+			end = max(end, layout.offset + width);
+		highest = max(highest, layout.offset + width);
+		result.alignment = max(result.alignment, alignment);
+		result.members.push_back(layout);
+	}
+
+	result.order.resize(members.size());
+	for (size_t i = 0; i < members.size(); i++)
+		result.order[i] = i;
+	stable_sort(result.order.begin(), result.order.end(), [&](size_t a, size_t b) {
+		const StructureMemberLayout& first = result.members[a];
+		const StructureMemberLayout& second = result.members[b];
+		if (first.offset != second.offset)
+			return first.offset < second.offset;
+		return first.bitPosition < second.bitPosition;
+	});
+
+	result.coveredEnd.resize(members.size());
+	uint64_t furthest = 0;
+	for (size_t i = 0; i < result.order.size(); i++)
+	{
+		const StructureMemberLayout& layout = result.members[result.order[i]];
+		furthest = max(furthest, layout.offset + layout.width);
+		result.coveredEnd[i] = furthest;
+	}
+
+	if (!isUnion)
+	{
+		// Members are sorted by offset, so tracking the furthest end seen so far finds every overlap
+		uint64_t coveredEnd = 0;
+		size_t coveredBy = 0;
+		bool covered = false;
+		for (size_t i : result.order)
+		{
+			const StructureMemberLayout& layout = result.members[i];
+			if (layout.width == 0)
+				continue;
+			if (covered && (layout.offset < coveredEnd))
+			{
+				const StructureMemberLayout& previous = result.members[coveredBy];
+				bool sameUnit = (previous.bitWidth != 0) && (layout.bitWidth != 0) &&
+				    (previous.offset == layout.offset) && (previous.width == layout.width) &&
+				    ((previous.bitPosition + previous.bitWidth) <= layout.bitPosition);
+				if (!sameUnit)
+				{
+					error = fmt::format("member {} at offset {:#x} overlaps member {} at offset {:#x}", i,
+					    layout.offset, coveredBy, previous.offset);
+					return false;
+				}
+			}
+			if (!covered || ((layout.offset + layout.width) >= coveredEnd))
+			{
+				coveredEnd = layout.offset + layout.width;
+				coveredBy = i;
+				covered = true;
+			}
+		}
+	}
+
+	result.width = AlignOffset(highest, result.alignment);
+	return true;
+}
+
+
+bool StructureBuilder::AddMembers(Span<const StructureMemberDescriptor> members, string& error)
+{
+	StructureLayout layout;
+	uint64_t start = IsUnion() ? 0 : GetWidth();
+	if (!ComputeLayout(members, GetStructureType(), IsPacked(), layout, error, start))
+		return false;
+
+	if (!IsUnion())
+	{
+		// Members are added with overwriteExisting set, so an explicit offset landing on an existing member would
+		// silently replace it. Existing members are sorted by offset with the furthest end seen so far, so each
+		// new member needs one search.
+		size_t count;
+		BNStructureMember* existing = BNGetStructureBuilderMembers(m_object, &count);
+		vector<pair<uint64_t, size_t>> ranges;
+		vector<uint64_t> widths(count);
+		ranges.reserve(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			widths[i] = BNGetTypeWidth(existing[i].type);
+			if (widths[i] != 0)
+				ranges.push_back({existing[i].offset, i});
+		}
+		sort(ranges.begin(), ranges.end());
+		vector<uint64_t> coveredEnd(ranges.size());
+		vector<size_t> coveredBy(ranges.size());
+		for (size_t i = 0; i < ranges.size(); i++)
+		{
+			uint64_t end = ranges[i].first + widths[ranges[i].second];
+			bool extends = (i == 0) || (end > coveredEnd[i - 1]);
+			coveredEnd[i] = extends ? end : coveredEnd[i - 1];
+			coveredBy[i] = extends ? ranges[i].second : coveredBy[i - 1];
+		}
+
+		bool ok = true;
+		for (size_t i = 0; ok && (i < members.size()); i++)
+		{
+			const StructureMemberLayout& placement = layout.members[i];
+			if (placement.width == 0)
+				continue;
+			// Last existing member starting before the end of the new one
+			uint64_t end = placement.offset + placement.width;
+			auto next = lower_bound(ranges.begin(), ranges.end(), make_pair(end, (size_t)0));
+			if (next == ranges.begin())
+				continue;
+			size_t j = (size_t)(next - ranges.begin()) - 1;
+			if (coveredEnd[j] > placement.offset)
+			{
+				const BNStructureMember& previous = existing[coveredBy[j]];
+				error = fmt::format("member {} at offset {:#x} overlaps existing member '{}' at offset {:#x}", i,
+				    placement.offset, previous.name ? previous.name : "", previous.offset);
+				ok = false;
+			}
+		}
+		BNFreeStructureMemberList(existing, count);
+		if (!ok)
+			return false;
+	}
+
+	AddMembers(members, layout);
+	return true;
+}
+
+
+StructureBuilder& StructureBuilder::AddMembers(Span<const StructureMemberDescriptor> members,
+    const StructureLayout& layout)
+{
+	bool isUnion = IsUnion();
+	BNTypeWithConfidence tc;
+	for (size_t i = 0; i < members.size(); i++)
+	{
+		const StructureMemberDescriptor& member = members[i];
+		const StructureMemberLayout& placement = layout.members[i];
+		// Later bitfields of a storage unit are covered by the member added for the first one
+		if ((placement.bitWidth != 0) && (placement.bitPosition != 0))
+			continue;
+		tc.type = member.type->GetObject();
+		tc.confidence = member.confidence;
+		const char* name = member.name ? member.name : "";
+		if (isUnion)
+			BNAddStructureBuilderMember(m_object, &tc, name, member.access, member.scope);
+		else
+			BNAddStructureBuilderMemberAtOffset(
+			    m_object, &tc, name, placement.offset, true, member.access, member.scope);
+	}
+
+	if (layout.width > BNGetStructureBuilderWidth(m_object))
+		BNSetStructureBuilderWidth(m_object, layout.width);
+	if (layout.alignment > BNGetStructureBuilderAlignment(m_object))
+		BNSetStructureBuilderAlignment(m_object, layout.alignment);
+	return *this;
+}
+
+
+bool StructureBuilder::ReplaceMembers(Span<const StructureMemberDescriptor> members, string& error)
+{
+	StructureLayout layout;
+	if (!ComputeLayout(members, GetStructureType(), IsPacked(), layout, error))
+		return false;
+	ReplaceMembers(members, layout);
+	return true;
+}
+
+
+StructureBuilder& StructureBuilder::ReplaceMembers(Span<const StructureMemberDescriptor> members,
+    const StructureLayout& layout)
+{
+	// Starting from an empty builder is one call per copied property rather than one per removed member
+	BNStructureBuilder* replacement =
+	    BNCreateStructureBuilderWithOptions(BNGetStructureBuilderType(m_object), BNIsStructureBuilderPacked(m_object));
+	BNSetStructureBuilderPointerOffset(replacement, BNGetStructureBuilderPointerOffset(m_object));
+	BNSetStructureBuilderPropagatesDataVariableReferences(
+	    replacement, BNStructureBuilderPropagatesDataVariableReferences(m_object));
+	size_t baseCount;
+	BNBaseStructure* bases = BNGetBaseStructuresForStructureBuilder(m_object, &baseCount);
+	if (baseCount != 0)
+		BNSetBaseStructuresForStructureBuilder(replacement, bases, baseCount);
+	BNFreeBaseStructureList(bases, baseCount);
+	BNFreeStructureBuilder(m_object);
+	m_object = replacement;
+
+	AddMembers(members, layout);
+	BNSetStructureBuilderWidth(m_object, layout.width);
+	BNSetStructureBuilderAlignment(m_object, layout.alignment);
+	return *this;
+}
+
+
 Enumeration::Enumeration(BNEnumeration* e)
 {
 	m_object = e;
@@ -2649,6 +2935,142 @@ vector<InstructionTextToken> Enumeration::GetTokensForValue(uint64_t value, size
 }
 
 
+Ref<EnumerationIndex> Enumeration::GetIndex()
+{
+	return EnumerationIndex::Get(this);
+}
+
+
+static size_t CountBits(uint64_t value)
+{
+	size_t count = 0;
+	for (; value; value &= value - 1)
+		count++;
+	return count;
+}
+
+
+EnumerationIndex::EnumerationIndex(Enumeration* enumeration) :
+    m_enumeration(enumeration), m_members(enumeration->GetMembers())
+{
+	m_valueMembers.reserve(m_members.size());
+	for (size_t i = 0; i < m_members.size(); i++)
+	{
+		m_valueMembers.emplace(m_members[i].value, i);
+		if (m_members[i].value != 0)
+			m_flagMembers.push_back(i);
+	}
+
+	// Prefer members covering more bits, so that named combinations such as PAGE_EXECUTE_READWRITE win over
+	// their parts, and keep the first of several members with the same value
+	stable_sort(m_flagMembers.begin(), m_flagMembers.end(), [&](size_t a, size_t b) {
+		size_t aBits = CountBits(m_members[a].value);
+		size_t bBits = CountBits(m_members[b].value);
+		if (aBits != bBits)
+			return aBits > bBits;
+		return m_members[a].value > m_members[b].value;
+	});
+	for (size_t i : m_flagMembers)
+		m_flagMask |= m_members[i].value;
+}
+
+
+Ref<EnumerationIndex> EnumerationIndex::Get(Enumeration* enumeration)
+{
+	static constexpr size_t MaxIndices = 256;
+	static mutex indexMutex;
+	static list<Ref<EnumerationIndex>> recent;
+	static unordered_map<BNEnumeration*, list<Ref<EnumerationIndex>>::iterator> indices;
+
+	// The cached index holds a reference to the enumeration, so its handle cannot be reused while it is cached
+	BNEnumeration* handle = enumeration->GetObject();
+	{
+		unique_lock<mutex> lock(indexMutex);
+		auto i = indices.find(handle);
+		if (i != indices.end())
+		{
+			recent.splice(recent.begin(), recent, i->second);
+			return *i->second;
+		}
+	}
+
+	// Built outside of the lock, as large enumerations take a while to copy. If another thread wins the race
+	// to build the same index, its copy is used instead.
+	Ref<EnumerationIndex> index = new EnumerationIndex(enumeration);
+	unique_lock<mutex> lock(indexMutex);
+	auto i = indices.find(handle);
+	if (i != indices.end())
+		return *i->second;
+	recent.push_front(index);
+	indices[handle] = recent.begin();
+	if (recent.size() > MaxIndices)
+	{
+		indices.erase(recent.back()->m_enumeration->GetObject());
+		recent.pop_back();
+	}
+	return index;
+}
+
+
+const EnumerationMember* EnumerationIndex::GetMemberForValue(uint64_t value) const
+{
+	auto i = m_valueMembers.find(value);
+	if (i == m_valueMembers.end())
+		return nullptr;
+	return &m_members[i->second];
+}
+
+
+bool EnumerationIndex::DecomposeFlags(uint64_t value, vector<size_t>& members) const
+{
+	members.clear();
+	if (value == 0)
+	{
+		auto i = m_valueMembers.find(0);
+		if (i != m_valueMembers.end())
+			members.push_back(i->second);
+		return true;
+	}
+	if ((value & ~m_flagMask) != 0)
+		return false;
+
+	uint64_t covered = 0;
+	for (size_t i : m_flagMembers)
+	{
+		uint64_t memberValue = m_members[i].value;
+		if (((memberValue & ~value) != 0) || ((memberValue & covered) != 0))
+			continue;
+		members.push_back(i);
+		covered |= memberValue;
+		if (covered == value)
+			break;
+	}
+
+	sort(members.begin(), members.end(), [&](size_t a, size_t b) { return m_members[a].value > m_members[b].value; });
+	return covered == value;
+}
+
+
+vector<InstructionTextToken> EnumerationIndex::GetTokensForValue(uint64_t value, size_t width, Ref<Type> type)
+{
+	TokenKey key = {value, width, type ? type->GetObject() : nullptr};
+	{
+		unique_lock<mutex> lock(m_tokenMutex);
+		auto i = m_tokens.find(key);
+		if (i != m_tokens.end())
+			return i->second.tokens;
+	}
+
+	vector<InstructionTextToken> tokens = m_enumeration->GetTokensForValue(value, width, type);
+	unique_lock<mutex> lock(m_tokenMutex);
+	// Rendering touches a bounded set of constants, so running out of room is rare enough to simply start over
+	if (m_tokens.size() >= MaxCachedTokens)
+		m_tokens.clear();
+	m_tokens.emplace(key, CachedTokens {type, tokens});
+	return tokens;
+}
+
+
 EnumerationBuilder::EnumerationBuilder()
 {
 	m_object = BNCreateEnumerationBuilder();
@@ -0,0 +1,312 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <queue>
+#include <thread>
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+namespace
+{
+	string EncodeName(const QualifiedName& name)
+	{
+		string result;
+		for (size_t i = 0; i < name.size(); i++)
+		{
+			if (i != 0)
+				result.push_back('\0');
+			result += name[i];
+		}
+		return result;
+	}
+
+	// Names of the named types a type contains by value. Pointers and function types do not need the referenced
+	// type to be defined first, which is what keeps most self referential types out of cycles.
+	void CollectValueReferences(Type* type, vector<QualifiedName>& result)
+	{
+		if (!type)
+			return;
+		switch (type->GetClass())
+		{
+		case NamedTypeReferenceClass:
+			result.push_back(type->GetNamedTypeReference()->GetName());
+			break;
+		case ArrayTypeClass:
+			CollectValueReferences(type->GetChildType().GetValue(), result);
+			break;
+		case StructureTypeClass:
+		{
+			Ref<Structure> structure = type->GetStructure();
+			if (!structure)
+				break;
+			for (auto& base : structure->GetBaseStructures())
+			{
+				if (base.type)
+					result.push_back(base.type->GetName());
+			}
+			for (auto& member : structure->GetMembers())
+				CollectValueReferences(member.type.GetValue(), result);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}  // namespace
+
+
+TypeImporter::TypeImporter(Ref<BinaryView> view, size_t threadCount, size_t chunkSize) :
+    m_view(view), m_threadCount(threadCount), m_chunkSize(chunkSize ? chunkSize : DefaultChunkSize)
+{}
+
+
+vector<TypeImportEntry> TypeImporter::Build(
+    size_t count, const BuildFunction& build, const ProgressFunction& progress, size_t total)
+{
+	if (total == 0)
+		total = count;
+
+	vector<TypeImportEntry> entries(count);
+	atomic<size_t> completed = 0;
+	atomic<bool> cancelled = false;
+	auto buildOne = [&](size_t i) {
+		if (cancelled)
+			return;
+		build(i, entries[i]);
+		completed++;
+	};
+
+	if (!progress)
+	{
+		ParallelFor(count, buildOne, m_threadCount);
+	}
+	else
+	{
+		// Workers build while the calling thread reports progress, so the callback never runs on a worker
+		mutex doneMutex;
+		condition_variable doneCond;
+		bool done = false;
+		exception_ptr error;
+		thread buildThread([&]() {
+			try
+			{
+				ParallelFor(count, buildOne, m_threadCount);
+			}
+			catch (...)
+			{
+				error = current_exception();
+			}
+			unique_lock<mutex> lock(doneMutex);
+			done = true;
+			doneCond.notify_all();
+		});
+
+		try
+		{
+			while (true)
+			{
+				{
+					unique_lock<mutex> lock(doneMutex);
+					if (doneCond.wait_for(lock, chrono::milliseconds(50), [&]() { return done; }))
+						break;
+				}
+				if (!cancelled && !progress(completed, total))
+					cancelled = true;
+			}
+		}
+		catch (...)
+		{
+			// The workers stop at their next record, and the thread is joined before the exception leaves
+			cancelled = true;
+			buildThread.join();
+			throw;
+		}
+
+		buildThread.join();
+		if (error)
+			rethrow_exception(error);
+		if (cancelled)
+			return {};
+		if (!progress(count, total))
+			return {};
+	}
+
+	entries.erase(remove_if(entries.begin(), entries.end(), [](const TypeImportEntry& entry) { return !entry.type; }),
+	    entries.end());
+	return entries;
+}
+
+
+vector<size_t> TypeImporter::SortByDependencies(const vector<TypeImportEntry>& entries)
+{
+	size_t count = entries.size();
+	unordered_map<string, size_t> indices;
+	indices.reserve(count);
+	for (size_t i = 0; i < count; i++)
+		indices.emplace(EncodeName(entries[i].name), i);
+
+	// References to types outside of this import are already defined, or will never be, so only edges between
+	// entries are kept
+	vector<vector<size_t>> dependencies(count);
+	ParallelFor(
+	    count,
+	    [&](size_t i) {
+		    vector<QualifiedName> references;
+		    CollectValueReferences(entries[i].type, references);
+		    auto& deps = dependencies[i];
+		    for (auto& reference : references)
+		    {
+			    auto found = indices.find(EncodeName(reference));
+			    if ((found == indices.end()) || (found->second == i))
+				    continue;
+			    if (find(deps.begin(), deps.end(), found->second) == deps.end())
+				    deps.push_back(found->second);
+		    }
+	    },
+	    m_threadCount);
+
+	vector<size_t> remaining(count);
+	vector<vector<size_t>> users(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		remaining[i] = dependencies[i].size();
+		for (size_t dep : dependencies[i])
+			users[dep].push_back(i);
+	}
+
+	// Ready entries are taken lowest index first, so the result stays as close to the input order as the
+	// dependencies allow
+	priority_queue<size_t, vector<size_t>, greater<size_t>> ready;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (remaining[i] == 0)
+			ready.push(i);
+	}
+
+	vector<size_t> order;
+	order.reserve(count);
+	vector<bool> emitted(count, false);
+	size_t nextUnemitted = 0;
+	while (order.size() < count)
+	{
+		if (ready.empty())
+		{
+			// Only a cycle is left, so break it at the earliest entry that has not been defined yet
+			while (emitted[nextUnemitted])
+				nextUnemitted++;
+			ready.push(nextUnemitted);
+		}
+
+		size_t i = ready.top();
+		ready.pop();
+		if (emitted[i])
+			continue;
+		emitted[i] = true;
+		order.push_back(i);
+		for (size_t user : users[i])
+		{
+			if ((--remaining[user] == 0) && !emitted[user])
+				ready.push(user);
+		}
+	}
+	return order;
+}
+
+
+unordered_map<string, QualifiedName> TypeImporter::Apply(const vector<TypeImportEntry>& entries,
+    const vector<size_t>& order, const ProgressFunction& progress, size_t base, size_t total)
+{
+	if (total == 0)
+		total = base + order.size();
+
+	unordered_map<string, QualifiedName> result;
+	result.reserve(order.size());
+	vector<BNQualifiedNameTypeAndId> apiTypes;
+	vector<string> generatedIds;
+	bool cancelled = false;
+	for (size_t start = 0; start < order.size(); start += m_chunkSize)
+	{
+		if (progress && !progress(base + start, total))
+		{
+			cancelled = true;
+			break;
+		}
+
+		size_t chunkCount = min(m_chunkSize, order.size() - start);
+		apiTypes.resize(chunkCount);
+		generatedIds.resize(chunkCount);
+		for (size_t i = 0; i < chunkCount; i++)
+		{
+			const TypeImportEntry& entry = entries[order[start + i]];
+			const string* id = &entry.id;
+			if (id->empty())
+			{
+				generatedIds[i] = Type::GenerateAutoTypeId("import", entry.name);
+				id = &generatedIds[i];
+			}
+			apiTypes[i].name = entry.name.GetAPIObject();
+			apiTypes[i].type = entry.type->GetObject();
+			// The core copies the ids it keeps
+			apiTypes[i].id = const_cast<char*>(id->c_str());
+		}
+
+		ProgressContext cb;
+		if (progress)
+			cb.callback = [&](size_t current, size_t) { return progress(base + start + current, total); };
+		else
+			cb.callback = [](size_t, size_t) { return true; };
+		char** resultIds;
+		BNQualifiedName* resultNames;
+		size_t resultCount = BNDefineAnalysisTypes(
+		    m_view->GetObject(), apiTypes.data(), chunkCount, ProgressCallback, &cb, &resultIds, &resultNames);
+
+		for (size_t i = 0; i < resultCount; i++)
+			result.insert({resultIds[i], QualifiedName::FromAPIObject(&resultNames[i])});
+		BNFreeStringList(resultIds, resultCount);
+		BNFreeTypeNameList(resultNames, resultCount);
+		for (size_t i = 0; i < chunkCount; i++)
+			QualifiedName::FreeAPIObject(&apiTypes[i].name);
+	}
+
+	if (progress && !cancelled)
+		progress(base + order.size(), total);
+	return result;
+}
+
+
+unordered_map<string, QualifiedName> TypeImporter::Import(
+    size_t count, const BuildFunction& build, const ProgressFunction& progress)
+{
+	// The build and apply stages get one progress unit per record each. Records dropped by the build have
+	// nothing to apply, so they count as applied up front and the total stays the same throughout.
+	size_t total = count * 2;
+	vector<TypeImportEntry> entries = Build(count, build, progress, total);
+	if (entries.empty())
+		return {};
+	vector<size_t> order = SortByDependencies(entries);
+	return Apply(entries, order, progress, total - entries.size(), total);
+}
@@ -353,10 +353,7 @@ void TypeParser::FreeErrorListCallback(void* ctxt, BNTypeParserError* errors, si
 }
 
 
-bool TypeParser::ParseTypesFromSourceFile(const string& fileName, Ref<Platform> platform,
-	const map<QualifiedName, TypeAndId>& existingTypes, const vector<string>& options,
-	const vector<string>& includeDirs, const string& autoTypeSource, TypeParserResult& result,
-	vector<TypeParserError>& errors)
+static bool ReadSourceFile(const string& fileName, string& source, vector<TypeParserError>& errors)
 {
 	if (!fs::is_regular_file(fileName))
 	{
@@ -364,7 +361,7 @@ bool TypeParser::ParseTypesFromSourceFile(const string& fileName, Ref<Platform>
 		return false;
 	}
 
-	// Read file contents, then parse them
+	// Read file contents, with a trailing newline so that the last line is always terminated
 	FILE* fp = fopen(fileName.c_str(), "rb");
 	if (!fp)
 	{
@@ -377,28 +374,117 @@ bool TypeParser::ParseTypesFromSourceFile(const string& fileName, Ref<Platform>
 	if(size == -1)
 	{
 		errors.push_back(TypeParserError(FatalSeverity, string("error: unable to open '") + fileName));
+		fclose(fp);
 		return false;
 	}
 	fseek(fp, 0, SEEK_SET);
 
-	char* data = new char[size + 2];
-	if (fread(data, 1, size, fp) != (size_t)size)
+	source.resize((size_t)size + 1);
+	if (fread(&source[0], 1, size, fp) != (size_t)size)
 	{
 		errors.push_back(TypeParserError(FatalSeverity, string("error: file '") + fileName + "' could not be read"));
-		delete[] data;
 		fclose(fp);
 		return false;
 	}
-	data[size++] = '\n';
-	data[size] = 0;
+	source[size] = '\n';
 	fclose(fp);
+	return true;
+}
 
-	bool ok = ParseTypesFromSource(data, fileName, platform, existingTypes, options, includeDirs, autoTypeSource, result, errors);
-	delete[] data;
-	return ok;
+
+bool TypeParser::ParseTypesFromSourceFile(const string& fileName, Ref<Platform> platform,
+	const map<QualifiedName, TypeAndId>& existingTypes, const vector<string>& options,
+	const vector<string>& includeDirs, const string& autoTypeSource, TypeParserResult& result,
+	vector<TypeParserError>& errors)
+{
+	string source;
+	if (!ReadSourceFile(fileName, source, errors))
+		return false;
+	return ParseTypesFromSource(
+		source, fileName, platform, existingTypes, options, includeDirs, autoTypeSource, result, errors);
 }
 
 
+// Adds the definitions of one file, keeping the earliest definition of each name
+static void MergeParsedTypes(vector<ParsedType>& merged, unordered_map<QualifiedName, pair<size_t, size_t>>& defined,
+	const vector<ParsedType>& types, size_t file, const vector<string>& fileNames, const char* kind,
+	vector<TypeParserError>& errors)
+{
+	for (auto& type : types)
+	{
+		auto inserted = defined.emplace(type.name, make_pair(merged.size(), file));
+		if (inserted.second)
+		{
+			merged.push_back(type);
+			continue;
+		}
+
+		const ParsedType& existing = merged[inserted.first->second.first];
+		if (*existing.type == *type.type)
+			continue;
+		TypeParserError error(WarningSeverity,
+			fmt::format("{} '{}' differs from its definition in '{}', which is kept", kind, type.name.GetString(),
+				fileNames[inserted.first->second.second]));
+		error.fileName = fileNames[file];
+		errors.push_back(error);
+	}
+}
+
+
+bool TypeParser::ParseTypesFromSourceFiles(const vector<string>& fileNames, Ref<Platform> platform,
+	const map<QualifiedName, TypeAndId>& existingTypes, const vector<string>& options,
+	const vector<string>& includeDirs, const string& autoTypeSource, TypeParserResult& result,
+	vector<TypeParserError>& errors, TypeParserCache* cache, size_t threadCount)
+{
+	struct FileResult
+	{
+		bool ok = false;
+		TypeParserResult result;
+		vector<TypeParserError> errors;
+	};
+
+	vector<FileResult> files(fileNames.size());
+	ParallelFor(
+		fileNames.size(),
+		[&](size_t i) {
+			FileResult& file = files[i];
+			string source;
+			if (!ReadSourceFile(fileNames[i], source, file.errors))
+				return;
+			if (cache)
+			{
+				file.ok = cache->ParseTypesFromSource(this, source, fileNames[i], platform, existingTypes, options,
+					includeDirs, autoTypeSource, file.result, file.errors);
+			}
+			else
+			{
+				file.ok = ParseTypesFromSource(source, fileNames[i], platform, existingTypes, options, includeDirs,
+					autoTypeSource, file.result, file.errors);
+			}
+		},
+		threadCount);
+
+	result.types.clear();
+	result.variables.clear();
+	result.functions.clear();
+	unordered_map<QualifiedName, pair<size_t, size_t>> types, variables, functions;
+	bool ok = true;
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		FileResult& file = files[i];
+		errors.insert(errors.end(), file.errors.begin(), file.errors.end());
+		if (!file.ok)
+		{
+			ok = false;
+			continue;
+		}
+		MergeParsedTypes(result.types, types, file.result.types, i, fileNames, "type", errors);
+		MergeParsedTypes(result.variables, variables, file.result.variables, i, fileNames, "variable", errors);
+		MergeParsedTypes(result.functions, functions, file.result.functions, i, fileNames, "function", errors);
+	}
+	return ok;
+}
+
 CoreTypeParser::CoreTypeParser(BNTypeParser* parser): TypeParser(parser)
 {
 
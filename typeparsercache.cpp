@@ -0,0 +1,313 @@
+// Copyright (c) 2015-2023 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <filesystem>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include "binaryninjaapi.h"
+#include "databufferkernels.h"
+
+using namespace BinaryNinja;
+using namespace std;
+namespace fs = std::filesystem;
+
+// Bumped whenever the layout of the stored metadata changes, so that older entries are ignored
+#define TYPE_PARSER_CACHE_VERSION 1
+
+
+static void AppendKeyField(string& key, const string& name, const string& value)
+{
+	key += name;
+	key += '=';
+	key += to_string(value.size());
+	key += ':';
+	key += value;
+	key += '\n';
+}
+
+
+static string GetTypeParserName(TypeParser* parser)
+{
+	if (!parser->GetObject())
+		return string();
+	char* name = BNGetTypeParserName(parser->GetObject());
+	string result = name;
+	BNFreeString(name);
+	return result;
+}
+
+
+// Everything about an existing type that can change how source referring to it parses: its declaration, size and
+// alignment, and for structures and enumerations their members. Types referenced by name contribute their own
+// entries, so a change to a structure embedded by value changes the key through that structure.
+static void AppendTypeFingerprint(string& entry, Type* type)
+{
+	if (!type)
+		return;
+	entry += type->GetString();
+	entry += fmt::format("\n{}\n{}", type->GetWidth(), type->GetAlignment());
+	if (type->GetClass() == StructureTypeClass)
+	{
+		Ref<Structure> structure = type->GetStructure();
+		if (!structure)
+			return;
+		entry += fmt::format("\n{}{}", (int)structure->GetStructureType(), structure->IsPacked() ? "p" : "");
+		for (auto& base : structure->GetBaseStructures())
+			entry += fmt::format("\nbase {} {} {}", base.type ? base.type->GetName().GetString() : "", base.offset,
+			    base.width);
+		for (auto& member : structure->GetMembers())
+			entry += fmt::format("\n{} {} {}", member.name, member.offset,
+			    member.type.GetValue() ? member.type->GetString() : "");
+	}
+	else if (type->GetClass() == EnumerationTypeClass)
+	{
+		Ref<Enumeration> enumeration = type->GetEnumeration();
+		if (!enumeration)
+			return;
+		for (auto& member : enumeration->GetMembers())
+			entry += fmt::format("\n{} {}", member.name, member.value);
+	}
+}
+
+
+// Names and types of one result category, in order, so that the result is reproduced exactly on load
+static void StoreParsedTypes(TypeLibrary* library, const string& kind, const vector<ParsedType>& types, bool objects)
+{
+	vector<string> names;
+	vector<bool> user;
+	names.reserve(types.size());
+	user.reserve(types.size());
+	for (auto& type : types)
+	{
+		names.push_back(type.name.GetString());
+		user.push_back(type.isUser);
+		if (objects)
+			library->AddNamedObject(type.name, type.type);
+		else
+			library->AddNamedType(type.name, type.type);
+	}
+	library->StoreMetadata("typeParserCache." + kind, new Metadata(names));
+	library->StoreMetadata("typeParserCache." + kind + "User", new Metadata(user));
+}
+
+
+static bool LoadParsedTypes(TypeLibrary* library, const string& kind,
+	const unordered_map<string, QualifiedNameAndType>& defined, vector<ParsedType>& types)
+{
+	Ref<Metadata> names = library->QueryMetadata("typeParserCache." + kind);
+	Ref<Metadata> user = library->QueryMetadata("typeParserCache." + kind + "User");
+	if (!names || !user || !names->IsStringList() || !user->IsBooleanList())
+		return false;
+
+	vector<string> nameList = names->GetStringList();
+	vector<bool> userList = user->GetBooleanList();
+	if (nameList.size() != userList.size())
+		return false;
+
+	types.clear();
+	types.reserve(nameList.size());
+	for (size_t i = 0; i < nameList.size(); i++)
+	{
+		auto type = defined.find(nameList[i]);
+		if (type == defined.end())
+			return false;
+		types.emplace_back(type->second.name, type->second.type, userList[i]);
+	}
+	return true;
+}
+
+
+TypeParserCache::TypeParserCache(const string& directory) : m_directory(directory) {}
+
+
+string TypeParserCache::GetDefaultDirectory()
+{
+	string userDirectory = GetUserDirectory();
+	if (userDirectory.empty())
+		return string();
+	return (fs::path(userDirectory) / "typeparsercache").string();
+}
+
+
+string TypeParserCache::GetPath(const string& key) const
+{
+	uint64_t hash = DataBufferKernels::XxHash64((const uint8_t*)key.data(), key.size());
+	return (fs::path(m_directory) / fmt::format("{:016x}.bntl", hash)).string();
+}
+
+
+string TypeParserCache::GetKey(TypeParser* parser, const string& source, const string& fileName,
+	Ref<Platform> platform, const map<QualifiedName, TypeAndId>& existingTypes, const vector<string>& options,
+	const vector<string>& includeDirs, const string& autoTypeSource)
+{
+	// Existing types are folded into a hash, as there can be many thousands of them. Their contents are included
+	// so that redefining a type under the same name and id does not return results parsed against the old one.
+	uint64_t existingHash = existingTypes.size();
+	string entry;
+	for (auto& type : existingTypes)
+	{
+		entry = type.first.GetString();
+		entry += '\0';
+		entry += type.second.id;
+		entry += '\0';
+		AppendTypeFingerprint(entry, type.second.type);
+		existingHash = DataBufferKernels::XxHash64((const uint8_t*)entry.data(), entry.size(), existingHash);
+	}
+
+	string key;
+	AppendKeyField(key, "version", to_string(TYPE_PARSER_CACHE_VERSION));
+	AppendKeyField(key, "parser", GetTypeParserName(parser));
+	AppendKeyField(key, "platform", platform->GetName());
+	AppendKeyField(key, "file", fileName);
+	AppendKeyField(key, "autoTypeSource", autoTypeSource);
+	for (auto& option : options)
+		AppendKeyField(key, "option", option);
+	for (auto& dir : includeDirs)
+		AppendKeyField(key, "include", dir);
+	AppendKeyField(key, "existingTypes", fmt::format("{:016x}", existingHash));
+	AppendKeyField(key, "sourceLength", to_string(source.size()));
+	AppendKeyField(key, "source",
+		fmt::format("{:016x}", DataBufferKernels::XxHash64((const uint8_t*)source.data(), source.size())));
+	return key;
+}
+
+
+bool TypeParserCache::Load(const string& key, Ref<Platform> platform, TypeParserResult& result)
+{
+	if (m_directory.empty())
+		return false;
+	string path = GetPath(key);
+	error_code ec;
+	if (!fs::is_regular_file(path, ec))
+		return false;
+
+	Ref<TypeLibrary> library = TypeLibrary::LoadFromFile(path);
+	if (!library || !library->GetObject())
+		return false;
+
+	// The file name is only a hash of the key, so the full key is checked as well
+	Ref<Metadata> storedKey = library->QueryMetadata("typeParserCache.key");
+	if (!storedKey || !storedKey->IsString() || (storedKey->GetString() != key))
+		return false;
+	if (library->GetArchitecture()->GetObject() != platform->GetArchitecture()->GetObject())
+		return false;
+
+	unordered_map<string, QualifiedNameAndType> types, objects;
+	for (auto& type : library->GetNamedTypes())
+		types.emplace(type.name.GetString(), type);
+	for (auto& object : library->GetNamedObjects())
+		objects.emplace(object.name.GetString(), object);
+
+	TypeParserResult loaded;
+	if (!LoadParsedTypes(library, "types", types, loaded.types))
+		return false;
+	if (!LoadParsedTypes(library, "variables", objects, loaded.variables))
+		return false;
+	if (!LoadParsedTypes(library, "functions", objects, loaded.functions))
+		return false;
+	result = std::move(loaded);
+	return true;
+}
+
+
+bool TypeParserCache::Store(const string& key, Ref<Platform> platform, const TypeParserResult& result)
+{
+	if (m_directory.empty())
+		return false;
+	error_code ec;
+	fs::create_directories(m_directory, ec);
+	if (ec)
+	{
+		LogWarn("Unable to create type parser cache directory '%s': %s", m_directory.c_str(), ec.message().c_str());
+		return false;
+	}
+
+	// Variables and functions share the named object namespace of a type library
+	unordered_set<string> objectNames;
+	for (auto& variable : result.variables)
+		objectNames.insert(variable.name.GetString());
+	for (auto& function : result.functions)
+	{
+		if (objectNames.count(function.name.GetString()))
+			return false;
+	}
+
+	Ref<TypeLibrary> library = new TypeLibrary(platform->GetArchitecture(), "typeparsercache");
+	library->AddPlatform(platform);
+	library->StoreMetadata("typeParserCache.key", new Metadata(key));
+	StoreParsedTypes(library, "types", result.types, false);
+	StoreParsedTypes(library, "variables", result.variables, true);
+	StoreParsedTypes(library, "functions", result.functions, true);
+	library->Finalize();
+
+	// Written under a unique name and renamed into place, so that concurrent readers never see a partial file
+	string path = GetPath(key);
+	random_device random;
+	string tempPath = path + fmt::format(".{:08x}.tmp", random());
+	library->WriteToFile(tempPath);
+	fs::rename(tempPath, path, ec);
+	if (ec)
+	{
+		fs::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+
+bool TypeParserCache::ParseTypesFromSource(TypeParser* parser, const string& source, const string& fileName,
+	Ref<Platform> platform, const map<QualifiedName, TypeAndId>& existingTypes, const vector<string>& options,
+	const vector<string>& includeDirs, const string& autoTypeSource, TypeParserResult& result,
+	vector<TypeParserError>& errors)
+{
+	string key = GetKey(parser, source, fileName, platform, existingTypes, options, includeDirs, autoTypeSource);
+	if (Load(key, platform, result))
+		return true;
+
+	vector<TypeParserError> parseErrors;
+	bool ok = parser->ParseTypesFromSource(
+		source, fileName, platform, existingTypes, options, includeDirs, autoTypeSource, result, parseErrors);
+	// Results with warnings are not cached, so that the warnings are reported again next time
+	if (ok && parseErrors.empty())
+		Store(key, platform, result);
+	errors.insert(errors.end(), parseErrors.begin(), parseErrors.end());
+	return ok;
+}
+
+
+void TypeParserCache::Clear()
+{
+	if (m_directory.empty())
+		return;
+
+	// Collected first, as removing entries while iterating the directory is unspecified
+	error_code ec;
+	vector<fs::path> paths;
+	for (auto& entry : fs::directory_iterator(m_directory, ec))
+	{
+		string extension = entry.path().extension().string();
+		if ((extension == ".bntl") || (extension == ".tmp"))
+			paths.push_back(entry.path());
+	}
+	for (auto& path : paths)
+		fs::remove(path, ec);
+}